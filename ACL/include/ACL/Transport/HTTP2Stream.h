@@ -19,6 +19,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstdlib>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -110,6 +111,13 @@ public:
      */
     long getResponseCode();
 
+    /**
+     * Returns the @c MessageRequest this stream is posting.
+     *
+     * @return The @c MessageRequest being posted, or @c nullptr if this stream is not posting a request.
+     */
+    std::shared_ptr<avsCommon::avs::MessageRequest> getMessageRequest() const;
+
     /**
      * Notify the current request observer that the transfer is complete with
      * the appropriate SendCompleteStatus code.
@@ -165,6 +173,15 @@ public:
      */
     bool setConnectionTimeout(const std::chrono::seconds timeoutSeconds);
 
+    /**
+     * Set a function to be called when a paused transfer on this stream may be able to make progress, because an
+     * attachment being sent has more data or an attachment being received has more space.  It is retained across
+     * calls to @c reset().
+     *
+     * @param callback The function to call.  It may be called from any thread, and must return quickly.
+     */
+    void setWakeupCallback(std::function<void()> callback);
+
     /**
      * Un-pend all transfers for this stream
      */
@@ -228,6 +245,13 @@ private:
      */
     bool setCommonOptions(const std::string& url, const std::string& authToken);
 
+    /**
+     * Set the data available callback of each attachment reader of the current request.
+     *
+     * @param callback The callback to set, or an empty function to remove the callbacks.
+     */
+    void setReaderCallbacks(std::function<void()> callback);
+
     /**
      * Helper function for calling @c curl_easy_setopt and checking the result.
      *
@@ -282,6 +306,8 @@ private:
     std::shared_ptr<avsCommon::avs::MessageRequest> m_currentRequest;
     /// Whether this stream has any paused transfers.
     bool m_isPaused;
+    /// The function to call when a paused transfer may be able to make progress.
+    std::function<void()> m_wakeupCallback;
     /**
      * The exception message being received from AVS by this stream.  It may be built up over several calls if either
      * the write quanta are small, or if the message is long.
@@ -37,10 +37,13 @@ public:
      *
      * @params maxStreams The maximum number of streams that can be active
      * @params attachmentManager The attachment manager.
+     * @params maxPendingPostStreams The maximum number of POST streams which may be awaiting a response code at once.
+     * A value less than 1 allows any number up to @c maxStreams.
      */
     HTTP2StreamPool(
         const int maxStreams,
-        std::shared_ptr<avsCommon::avs::attachment::AttachmentManager> attachmentManager);
+        std::shared_ptr<avsCommon::avs::attachment::AttachmentManager> attachmentManager,
+        const int maxPendingPostStreams = 0);
 
     /**
      * Grabs an HTTP2Stream from the pool and configures it to be an HTTP GET.
@@ -70,6 +73,30 @@ public:
         std::shared_ptr<avsCommon::avs::MessageRequest> request,
         std::shared_ptr<MessageConsumerInterface> messageConsumer);
 
+    /**
+     * Whether another POST stream may be created without exceeding the limit on streams awaiting a response code,
+     * or the limit on the total number of streams.
+     *
+     * @return Whether @c createPostStream() may be called.
+     */
+    bool canCreatePostStream();
+
+    /**
+     * Gets the POST streams which have been acquired from the pool and are still awaiting a response code.
+     *
+     * @return The POST streams awaiting a response code.
+     */
+    std::vector<std::shared_ptr<HTTP2Stream>> getPendingPostStreams();
+
+    /**
+     * Makes sure the pool holds a stream ready to be acquired, so that the next request does not have to construct
+     * one (and its libcurl handle) while it is being sent.  Does nothing if the pool already holds a stream, or if
+     * the maximum number of streams have been acquired.
+     *
+     * @param messageConsumer The MessageConsumerInterface which should receive messages from AVS.
+     */
+    void prepareStream(std::shared_ptr<MessageConsumerInterface> messageConsumer);
+
     /**
      * Returns an HTTP2Stream back into the pool.
      * @param context Returns the given EventStream back into the pool.
@@ -77,6 +104,15 @@ public:
     void releaseStream(std::shared_ptr<HTTP2Stream> stream);
 
 private:
+    /**
+     * Count the acquired POST streams which have not yet received a response code.
+     *
+     * @note This method must be called while @c m_mutex is acquired.
+     *
+     * @return The number of POST streams awaiting a response code.
+     */
+    int countPendingPostStreamsLocked();
+
     /**
      * Gets a stream from the stream pool  If the pool is empty, returns a new HTTP2Stream.
      *
@@ -93,6 +129,10 @@ private:
     int m_numAcquiredStreams;
     /// The maximum number of streams that can be active in the pool.
     const int m_maxStreams;
+    /// The maximum number of POST streams which may be awaiting a response code at once.
+    const int m_maxPendingPostStreams;
+    /// The POST streams which have been acquired from the pool.
+    std::vector<std::shared_ptr<HTTP2Stream>> m_postStreams;
     /// The attachment manager.
     std::shared_ptr<avsCommon::avs::attachment::AttachmentManager> m_attachmentManager;
     /**
@@ -18,7 +18,7 @@
 
 #include <atomic>
 #include <condition_variable>
-#include <deque>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -32,9 +32,11 @@
 
 #include "AVSCommon/SDKInterfaces/AuthDelegateInterface.h"
 #include "AVSCommon/Utils/LibcurlUtils/CurlMultiHandleWrapper.h"
+#include "AVSCommon/Utils/LibcurlUtils/WakeupPipe.h"
 #include "ACL/Transport/HTTP2Stream.h"
 #include "ACL/Transport/HTTP2StreamPool.h"
 #include "ACL/Transport/MessageConsumerInterface.h"
+#include "ACL/Transport/MessageRequestQueue.h"
 #include "ACL/Transport/PostConnectFactoryInterface.h"
 #include "ACL/Transport/PostConnectObserverInterface.h"
 #include "ACL/Transport/PostConnectSendMessageInterface.h"
@@ -108,6 +110,14 @@ public:
      */
     void removeObserver(std::shared_ptr<TransportObserverInterface> observer);
 
+    /**
+     * Get the counters for one priority level of the queue of outgoing @c MessageRequests.
+     *
+     * @param priority The priority of the level.
+     * @return The counters for the level.
+     */
+    MessageRequestQueue::Statistics getRequestQueueStatistics(avsCommon::avs::MessageRequest::Priority priority);
+
 private:
     /**
      * HTTP2Transport Constructor.
@@ -178,16 +188,18 @@ private:
     void cleanupStalledStreams();
 
     /**
-     * Checks all the currently executing message requests to see if they have HTTP response codes.
+     * Checks whether fewer than the maximum number of concurrent event streams are awaiting HTTP response codes.
      *
-     * @return If all the currently executing message requests have HTTP response codes.
+     * @return Whether another message request may be sent.
      */
     bool canProcessOutgoingMessage();
 
     /**
-     * Send the next @c MessageRequest if any are queued.
+     * Send the next @c MessageRequest which may be sent, if any.
+     *
+     * @return Whether a @c MessageRequest was taken from the queue.
      */
-    void processNextOutgoingMessage();
+    bool processNextOutgoingMessage();
 
     /**
      * Attempts to create a stream that will send a ping to the backend. If a ping stream is in flight, we do not
@@ -257,11 +269,15 @@ private:
     bool enqueueRequest(std::shared_ptr<avsCommon::avs::MessageRequest> request, bool ignoreConnectionStatus = false);
 
     /**
-     * De-queue a @c MessageRequest from (the front of) the queue of @c MessageRequest instances to process.
+     * De-queue the next @c MessageRequest which may be sent from the queue of @c MessageRequest instances to process.
+     * Requests of a higher priority are sent first.  A request may not be sent while a request with the same ordering
+     * key is awaiting a response code, or is ahead of it in the queue.
      *
+     * @param pendingOrderingKeys The ordering keys of the requests which are awaiting a response code.
      * @return The next @c MessageRequest to process (or @c nullptr).
      */
-    std::shared_ptr<avsCommon::avs::MessageRequest> dequeueRequest();
+    std::shared_ptr<avsCommon::avs::MessageRequest> dequeueRequest(
+        const std::unordered_set<std::string>& pendingOrderingKeys);
 
     /**
      * Clear the queue of @c MessageRequest instances, but first call @c onSendCompleted(NOT_CONNECTED) for any
@@ -269,6 +285,12 @@ private:
      */
     void clearQueuedRequests();
 
+    /**
+     * Remove queued @c MessageRequest instances whose deadline has passed, and call @c onSendCompleted(TIMEDOUT) for
+     * each of them.
+     */
+    void expireQueuedRequests();
+
     /**
      * Release the down channel stream.
      *
@@ -347,6 +369,9 @@ private:
     /// Main thread for this class.
     std::thread m_networkThread;
 
+    /// The maximum number of event streams which may be awaiting a response code at once.
+    const int m_maxConcurrentEventStreams;
+
     /// An abstracted HTTP/2 stream pool to ensure that we efficiently and correctly manage our active streams.
     HTTP2StreamPool m_streamPool;
 
@@ -372,7 +397,7 @@ private:
     bool m_disconnectedSent;
 
     /// Queue of @c MessageRequest instances to send. Serialized by @c m_mutex.
-    std::deque<std::shared_ptr<avsCommon::avs::MessageRequest>> m_requestQueue;
+    MessageRequestQueue m_requestQueue;
 
     /// Used to wake the main network thread in connection retry back-off situation.
     std::condition_variable m_wakeRetryTrigger;
@@ -382,6 +407,12 @@ private:
 
     /// PostConnect object is used to perform activities required once a connection is established.
     std::shared_ptr<PostConnectInterface> m_postConnect;
+
+    /// Pipe used to wake @c m_networkThread when it has work to do.
+    std::shared_ptr<avsCommon::utils::libcurlUtils::WakeupPipe> m_wakeupPipe;
+
+    /// Function which wakes @c m_networkThread, given to streams so that paused transfers may be resumed promptly.
+    std::function<void()> m_wakeupCallback;
 };
 
 }  // namespace acl
@@ -0,0 +1,188 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_MESSAGEREQUESTQUEUE_H_
+#define ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_MESSAGEREQUESTQUEUE_H_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <AVSCommon/AVS/MessageRequest.h>
+
+namespace alexaClientSDK {
+namespace acl {
+
+/**
+ * A multi-level queue of @c MessageRequests awaiting transmission, with one FIFO per @c MessageRequest::Priority.
+ * Requests are always dispatched from the highest priority level which has a request that may be sent, so a backlog
+ * of background messages cannot delay an interactive one.
+ *
+ * Each level keeps counters of its depth, throughput and queueing delay, which may be retrieved with
+ * @c getStatistics().
+ *
+ * @note This class is not thread-safe; its owner must serialize access to it.
+ */
+class MessageRequestQueue {
+public:
+    /// Counters describing the requests which have passed through one level of the queue.
+    struct Statistics {
+        /**
+         * Constructor.
+         */
+        Statistics();
+
+        /// The number of requests currently queued.
+        size_t depth;
+
+        /// The largest number of requests which have been queued at once.
+        size_t maxDepth;
+
+        /// The number of requests which have been queued.
+        uint64_t enqueued;
+
+        /// The number of requests which have been dequeued for sending.
+        uint64_t dispatched;
+
+        /// The number of requests which were dropped because their deadline passed while they were queued.
+        uint64_t expired;
+
+        /// The total time that dispatched requests spent in the queue.
+        std::chrono::microseconds totalWaitTime;
+
+        /// The longest time that a dispatched request spent in the queue.
+        std::chrono::microseconds maxWaitTime;
+    };
+
+    /**
+     * Constructor.
+     */
+    MessageRequestQueue();
+
+    /**
+     * Add a request to the back of the level for its priority.
+     *
+     * @param request The request to add.
+     * @param now The current time.
+     */
+    void push(
+        std::shared_ptr<avsCommon::avs::MessageRequest> request,
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+    /**
+     * Remove and return the first request which may be sent, searching the levels from the highest priority down.
+     *
+     * When @c pendingOrderingKeys is given, a request may not be sent while a request with the same ordering key is
+     * awaiting a response code, or is ahead of it in the same level.  A request may overtake a lower priority request
+     * with the same ordering key.
+     *
+     * @param pendingOrderingKeys The ordering keys of the requests which are awaiting a response code, or @c nullptr
+     * if only one request is sent at a time, in which case ordering keys are ignored.
+     * @param now The current time.
+     * @return The next request to send, or @c nullptr if no request may be sent.
+     */
+    std::shared_ptr<avsCommon::avs::MessageRequest> pop(
+        const std::unordered_set<std::string>* pendingOrderingKeys,
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+    /**
+     * Remove and return the requests whose deadline has passed.
+     *
+     * @param now The current time.
+     * @return The expired requests, in priority then queue order.
+     */
+    std::vector<std::shared_ptr<avsCommon::avs::MessageRequest>> popExpired(
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+    /**
+     * Remove and return all of the requests.  This does not count as dispatching or expiring them.
+     *
+     * @return The requests which were queued, in priority then queue order.
+     */
+    std::vector<std::shared_ptr<avsCommon::avs::MessageRequest>> clear();
+
+    /**
+     * Whether the queue is empty.
+     *
+     * @return Whether the queue is empty.
+     */
+    bool empty() const;
+
+    /**
+     * The number of requests in all levels of the queue.
+     *
+     * @return The number of requests in all levels of the queue.
+     */
+    size_t size() const;
+
+    /**
+     * Get the counters for one level of the queue.
+     *
+     * @param priority The priority of the level.
+     * @return The counters for the level.
+     */
+    Statistics getStatistics(avsCommon::avs::MessageRequest::Priority priority) const;
+
+private:
+    /// A queued request.
+    struct Entry {
+        /// The request.
+        std::shared_ptr<avsCommon::avs::MessageRequest> request;
+
+        /// The request's deadline, captured when it was queued.
+        std::chrono::steady_clock::time_point deadline;
+
+        /// When the request was queued.
+        std::chrono::steady_clock::time_point enqueueTime;
+    };
+
+    /// One priority level of the queue.
+    struct Level {
+        /// The requests of this level, in the order they were queued.
+        std::deque<Entry> entries;
+
+        /// The counters for this level.
+        Statistics statistics;
+    };
+
+    /**
+     * Remove an entry from a level and update its counters as a dispatched request.
+     *
+     * @param level The level to remove the entry from.
+     * @param it The entry to remove.
+     * @param now The current time.
+     * @return The request of the removed entry.
+     */
+    std::shared_ptr<avsCommon::avs::MessageRequest> dispatch(
+        Level& level,
+        std::deque<Entry>::iterator it,
+        std::chrono::steady_clock::time_point now);
+
+    /// The levels of the queue, indexed by @c MessageRequest::Priority.
+    std::array<Level, avsCommon::avs::MessageRequest::NUM_PRIORITIES> m_levels;
+
+    /// The number of queued requests which have a deadline, so that @c popExpired() need not scan when there are none.
+    size_t m_numWithDeadline;
+};
+
+}  // namespace acl
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_MESSAGEREQUESTQUEUE_H_
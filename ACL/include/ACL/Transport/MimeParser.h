@@ -20,6 +20,7 @@
 #define ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_MIMEPARSER_H_
 
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <iostream>
 #include <set>
@@ -28,14 +29,13 @@
 #include <AVSCommon/AVS/Attachment/AttachmentManager.h>
 #include <AVSCommon/AVS/Attachment/AttachmentWriter.h>
 
-#include <MultipartParser/MultipartReader.h>
-
 #include "ACL/Transport/MessageConsumerInterface.h"
+#include "ACL/Transport/MultipartStreamParser.h"
 
 namespace alexaClientSDK {
 namespace acl {
 
-class MimeParser {
+class MimeParser : public MultipartStreamParser::PartHandlerInterface {
 public:
     /**
      * Values that express the result of a @c feed() call.
@@ -79,6 +79,14 @@ public:
      */
     void setAttachmentContextId(const std::string& attachmentContextId);
 
+    /**
+     * Set a function to be called when attachments which could not accept all of their data may have space for more.
+     * It is installed on each attachment writer this parser creates, and is retained across calls to @c reset().
+     *
+     * @param callback The function to call when space may be available.
+     */
+    void setSpaceAvailableCallback(std::function<void()> callback);
+
     /**
      * Sets the MIME multipart boundary string that the underlying mime multipart parser
      * uses.
@@ -98,6 +106,13 @@ public:
      */
     void closeActiveAttachmentWriter();
 
+    /// @name MultipartStreamParser::PartHandlerInterface methods
+    /// @{
+    void onPartBegin(const MultipartStreamParser::Headers& headers) override;
+    size_t onPartData(const char* buffer, size_t size) override;
+    void onPartEnd() override;
+    /// @}
+
 private:
     enum ContentType {
         /// The default value, indicating no data.
@@ -110,60 +125,14 @@ private:
         ATTACHMENT
     };
 
-    /**
-     * Callback that gets called when a multipart MIME part begins
-     * @param headers The MIME headers for the upcoming MIME part
-     * @param user A pointer to user set data (should always be an instance of this class)
-     */
-    static void partBeginCallback(const MultipartHeaders& headers, void* userData);
-
-    /**
-     * Callback that gets called when data from a MIME part is available
-     * @param buffer A pointer to the chunk of data provided
-     * @param size The size of the data provided
-     * @param user A pointer to user set data (should always be an instance of this class)
-     */
-    static void partDataCallback(const char* buffer, size_t size, void* userData);
-
-    /**
-     * Callback that gets called when a multipart MIME part ends
-     * @param user A pointer to user set data (should always be an instance of this class)
-     */
-    static void partEndCallback(void* userData);
-
     /**
      * Utility function to encapsulate the logic required to write data to an attachment.
      *
      * @param buffer The data to be written to the attachment.
      * @param size The size of the data to be written to the attachment.
-     * @return A value expressing the final status of the write operation.
+     * @return The number of bytes written.  If this is less than @c size, @c m_dataParsedStatus expresses why.
      */
-    MimeParser::DataParsedStatus writeDataToAttachment(const char* buffer, size_t size);
-
-    /**
-     * Utility function to determine if the given number of bytes has been processed already by this mime parser
-     * in a previous iteration.  This follows the idea that when processing n bytes, a mime parse may succeed
-     * breaking out the first mime part, but fail on the second.  The caller may want to re-drive the same data in
-     * order to parse all the data, and so the first bytes should not be re-processed.  This function clarifies if,
-     * given the current state of the parser, these bytes have been already processed.
-     *
-     * @param size The number of bytes that can be processed.
-     * @return Whether any of these bytes have yet to be processed.
-     */
-    bool shouldProcessBytes(size_t size) const;
-
-    /**
-     * Function to update the parser's state to capture that size bytes have been successfully processed.
-     *
-     * @param size The number of bytes that have been processed.
-     */
-    void updateCurrentByteProgress(size_t size);
-
-    /**
-     * Function to reset the tracking byte counters of the mime parser, which should be called after successfully
-     * parsing a chunk of data.
-     */
-    void resetByteProgressCounters();
+    size_t writeDataToAttachment(const char* buffer, size_t size);
 
     /**
      * Remember if the attachment writer's buffer is full.
@@ -172,46 +141,35 @@ private:
      **/
     void setAttachmentWriterBufferFull(bool isFull);
 
-    /// Tracks whether we've received our first block of data in the stream.
-    bool m_receivedFirstChunk;
     /// Tracks the Content-Type of the current MIME part.
     ContentType m_currDataType;
-    /// Instance of a multipart MIME reader.
-    MultipartReader m_multipartReader;
+    /// Instance of a resumable multipart MIME parser.
+    MultipartStreamParser m_multipartParser;
     /// The object to report back to when JSON MIME parts are received.
     std::shared_ptr<MessageConsumerInterface> m_messageConsumer;
     /// The attachment manager.
     std::shared_ptr<avsCommon::avs::attachment::AttachmentManager> m_attachmentManager;
     /// The contextId, needed for creating attachments.
     std::string m_attachmentContextId;
+    /// The function installed on attachment writers to signal that space may be available.
+    std::function<void()> m_spaceAvailableCallback;
     /**
      * The directive message being received from AVS by this stream.  It may be built up over several calls if either
      * the write quantums are small, or if the message is long.
      */
     std::string m_directiveBeingReceived;
-    /**
-     * The attachment id of the attachment currently being processed.  This variable is needed to prevent duplicate
-     * creation of @c Attachment objects when data is re-driven.
-     */
-    std::string m_attachmentIdBeingReceived;
     /// The current AttachmentWriter.
     std::unique_ptr<avsCommon::avs::attachment::AttachmentWriter> m_attachmentWriter;
     /**
-     * The status of the last feed() call.  This is required as a class data member because the callback functions
-     * this class provides to MultiPartReader do not allow for a return value of our choosing.
+     * The status of the last feed() call.  This is required as a class data member because the part handler methods
+     * this class provides to @c MultipartStreamParser only report how many bytes were accepted.
      */
     DataParsedStatus m_dataParsedStatus;
     /**
-     * In the context of pause & re-drive of the same set of data, this value reflects the current progress of the
-     * mime parser over that data.
-     */
-    size_t m_currentByteProgress;
-    /**
-     * In the context of pause & re-drive of the same set of data, this value reflects how many of those bytes
-     * have been successfully processed by the parser on any iteration.  On a re-drive of the same data, these bytes
-     * should not be re-processed.
+     * The number of bytes of the chunk passed to the last @c feed() call which were consumed before parsing was
+     * suspended.  When that chunk is re-driven, parsing resumes after these bytes.
      */
-    size_t m_totalSuccessfullyProcessedBytes;
+    size_t m_redriveOffset;
     /// Records whether the attachment writer's buffer appears to be full.
     bool m_isAttachmentWriterBufferFull;
 };
@@ -0,0 +1,209 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_MULTIPARTSTREAMPARSER_H_
+#define ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_MULTIPARTSTREAMPARSER_H_
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace alexaClientSDK {
+namespace acl {
+
+/**
+ * A resumable parser for MIME multipart streams.
+ *
+ * Unlike a conventional push parser, the consumer of part data may accept fewer bytes than it is offered.  When that
+ * happens the parser stops exactly at the first byte that was not accepted and reports how many bytes of the input
+ * were consumed.  The parser's state always describes the stream position immediately after the last consumed byte,
+ * so parsing may be resumed by feeding the unconsumed remainder without snapshotting or replaying any state.
+ *
+ * Bytes that were held back while matching what turned out not to be a boundary are regenerated from the boundary
+ * string itself, so the parser never needs to buffer input data.
+ */
+class MultipartStreamParser {
+public:
+    /// The headers of a MIME part.  Header names are stored as received.
+    using Headers = std::multimap<std::string, std::string>;
+
+    /**
+     * Interface for receiving the parts broken out of a multipart stream.
+     */
+    class PartHandlerInterface {
+    public:
+        /**
+         * Destructor.
+         */
+        virtual ~PartHandlerInterface() = default;
+
+        /**
+         * Notification that a new part has started.
+         *
+         * @param headers The MIME headers of the new part.
+         */
+        virtual void onPartBegin(const Headers& headers) = 0;
+
+        /**
+         * Offer a chunk of data belonging to the current part.
+         *
+         * @param data The data of the current part.
+         * @param size The number of bytes of data offered.
+         * @return The number of bytes accepted.  Returning less than @c size suspends the parser.
+         */
+        virtual size_t onPartData(const char* data, size_t size) = 0;
+
+        /**
+         * Notification that the current part has ended.
+         */
+        virtual void onPartEnd() = 0;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param handler The object to notify of parts found in the stream.  It must outlive this parser.
+     */
+    explicit MultipartStreamParser(PartHandlerInterface* handler);
+
+    /**
+     * Set the boundary string and prepare to parse a new stream.
+     *
+     * @param boundary The boundary string, without the leading dashes.
+     */
+    void setBoundary(const std::string& boundary);
+
+    /**
+     * Return the parser to its initial, uninitialized state.  @c setBoundary() must be called before parsing again.
+     */
+    void reset();
+
+    /**
+     * Parse a chunk of the stream.
+     *
+     * @param data The chunk of data to parse.
+     * @param length The number of bytes in @c data.
+     * @return The number of bytes consumed.  This is less than @c length if the handler stopped accepting part data
+     * or if an error was found.  In the former case the caller should feed the unconsumed bytes again later.
+     */
+    size_t feed(const char* data, size_t length);
+
+    /**
+     * Whether the parser has found malformed data or has not been given a boundary.
+     *
+     * @return Whether the parser is in an error state.
+     */
+    bool hasError() const;
+
+    /**
+     * Whether the closing boundary of the stream has been parsed.
+     *
+     * @return Whether the stream is complete.
+     */
+    bool isDone() const;
+
+    /**
+     * Get a description of the most recent error.
+     *
+     * @return A description of the most recent error.
+     */
+    const char* getErrorMessage() const;
+
+private:
+    /// The states of the parser.
+    enum class State {
+        /// Matching the first boundary, optionally preceded by CRLF.
+        START_BOUNDARY,
+        /// Reading a header line.
+        HEADER_LINE,
+        /// Expecting the LF that terminates a header line.
+        HEADER_LINE_LF,
+        /// Checking whether an empty line before any header is followed by a duplicate boundary.
+        DUPLICATE_BOUNDARY,
+        /// Reading part data while looking for the next delimiter.
+        PART_DATA,
+        /// The delimiter has been matched, expecting CRLF or "--".
+        DELIMITER_SUFFIX,
+        /// Expecting the LF of a CRLF that follows a delimiter.
+        DELIMITER_SUFFIX_LF,
+        /// Expecting the second '-' of a closing delimiter.
+        CLOSE_DELIMITER_SUFFIX,
+        /// The closing delimiter has been parsed.  Any epilogue is ignored.
+        DONE,
+        /// Malformed data was found or no boundary has been set.
+        ERROR
+    };
+
+    /**
+     * Enter the error state.
+     *
+     * @param message A description of the error.
+     */
+    void setError(const char* message);
+
+    /**
+     * Process a complete header line accumulated in @c m_headerLine.
+     *
+     * @return Whether the line was valid.
+     */
+    bool processHeaderLine();
+
+    /**
+     * Start the data of a new part, notifying the handler of its headers.
+     */
+    void beginPartData();
+
+    /**
+     * Offer held back bytes (a false boundary match) to the handler as part data.
+     *
+     * @return Whether all of the held back bytes were accepted.
+     */
+    bool flushHeldBack();
+
+    /**
+     * Offer a run of part data from the input to the handler.
+     *
+     * @param data The start of the run.
+     * @param size The size of the run.
+     * @return The number of bytes accepted.
+     */
+    size_t emitPartData(const char* data, size_t size);
+
+    /// The object notified of parts.
+    PartHandlerInterface* m_handler;
+    /// The current state.
+    State m_state;
+    /// The delimiter that separates parts, "\r\n--" followed by the boundary.
+    std::string m_delimiter;
+    /// The number of characters of @c m_delimiter (or of the duplicate boundary) matched so far.
+    size_t m_matchIndex;
+    /// Bytes that were held back as a possible delimiter and must be emitted as part data.
+    std::string m_heldBack;
+    /// How many bytes of @c m_heldBack have been accepted by the handler.
+    size_t m_heldBackOffset;
+    /// The header line being accumulated.
+    std::string m_headerLine;
+    /// The headers of the part being started.
+    Headers m_headers;
+    /// Whether the current part has any header lines.
+    bool m_sawHeaderLine;
+    /// Description of the most recent error.
+    const char* m_errorMessage;
+};
+
+}  // namespace acl
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_MULTIPARTSTREAMPARSER_H_
@@ -160,6 +160,7 @@ bool HTTP2Stream::reset() {
         return false;
     }
     m_parser.reset();
+    setReaderCallbacks(nullptr);
     m_currentRequest.reset();
     m_isPaused = false;
     m_exceptionBeingProcessed.clear();
@@ -308,6 +309,7 @@ bool HTTP2Stream::initPost(
     }
 
     m_currentRequest = request;
+    setReaderCallbacks(m_wakeupCallback);
     return true;
 }
 
@@ -437,6 +439,10 @@ CURL* HTTP2Stream::getCurlHandle() {
     return m_transfer.getCurlHandle();
 }
 
+std::shared_ptr<avsCommon::avs::MessageRequest> HTTP2Stream::getMessageRequest() const {
+    return m_currentRequest;
+}
+
 void HTTP2Stream::notifyRequestObserver() {
     if (m_exceptionBeingProcessed.length() > 0) {
         m_currentRequest->exceptionReceived(m_exceptionBeingProcessed);
@@ -486,6 +492,24 @@ bool HTTP2Stream::setConnectionTimeout(const std::chrono::seconds timeoutSeconds
     return m_transfer.setConnectionTimeout(timeoutSeconds);
 }
 
+void HTTP2Stream::setWakeupCallback(std::function<void()> callback) {
+    m_wakeupCallback = callback;
+    m_parser.setSpaceAvailableCallback(callback);
+    setReaderCallbacks(callback);
+}
+
+void HTTP2Stream::setReaderCallbacks(std::function<void()> callback) {
+    if (!m_currentRequest) {
+        return;
+    }
+    for (int i = 0; i < m_currentRequest->attachmentReadersCount(); ++i) {
+        auto namedReader = m_currentRequest->getAttachmentReader(i);
+        if (namedReader && namedReader->reader) {
+            namedReader->reader->setDataAvailableCallback(callback);
+        }
+    }
+}
+
 void HTTP2Stream::unPause() {
     m_isPaused = false;
     // Call curl_easy_pause() *after* resetting m_pendingBits because curl_easy_pause may call
@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+
 #include <AVSCommon/Utils/Logger/Logger.h>
 #include "ACL/Transport/HTTP2StreamPool.h"
 
@@ -35,9 +37,11 @@ unsigned int HTTP2StreamPool::m_nextStreamId = 1;
 
 HTTP2StreamPool::HTTP2StreamPool(
     const int maxStreams,
-    std::shared_ptr<avsCommon::avs::attachment::AttachmentManager> attachmentManager) :
+    std::shared_ptr<avsCommon::avs::attachment::AttachmentManager> attachmentManager,
+    const int maxPendingPostStreams) :
         m_numAcquiredStreams{0},
         m_maxStreams{maxStreams},
+        m_maxPendingPostStreams{maxPendingPostStreams < 1 ? maxStreams : maxPendingPostStreams},
         m_attachmentManager{attachmentManager} {
 }
 
@@ -63,11 +67,16 @@ std::shared_ptr<HTTP2Stream> HTTP2StreamPool::createPostStream(
     const std::string& authToken,
     std::shared_ptr<avsCommon::avs::MessageRequest> request,
     std::shared_ptr<MessageConsumerInterface> messageConsumer) {
-    std::shared_ptr<HTTP2Stream> stream = getStream(messageConsumer);
     if (!request) {
         ACSDK_ERROR(LX("createPostStreamFailed").d("reason", "nullMessageRequest"));
         return nullptr;
     }
+    if (!canCreatePostStream()) {
+        ACSDK_ERROR(LX("createPostStreamFailed").d("reason", "maxPendingPostStreamsAlreadyAcquired"));
+        request->sendCompleted(avsCommon::sdkInterfaces::MessageRequestObserverInterface::Status::INTERNAL_ERROR);
+        return nullptr;
+    }
+    std::shared_ptr<HTTP2Stream> stream = getStream(messageConsumer);
     if (!stream) {
         ACSDK_ERROR(LX("createPostStreamFailed").d("reason", "getStreamFailed"));
         request->sendCompleted(avsCommon::sdkInterfaces::MessageRequestObserverInterface::Status::INTERNAL_ERROR);
@@ -79,9 +88,37 @@ std::shared_ptr<HTTP2Stream> HTTP2StreamPool::createPostStream(
         releaseStream(stream);
         return nullptr;
     }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_postStreams.push_back(stream);
     return stream;
 }
 
+bool HTTP2StreamPool::canCreatePostStream() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_numAcquiredStreams < m_maxStreams && countPendingPostStreamsLocked() < m_maxPendingPostStreams;
+}
+
+std::vector<std::shared_ptr<HTTP2Stream>> HTTP2StreamPool::getPendingPostStreams() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<std::shared_ptr<HTTP2Stream>> result;
+    for (auto stream : m_postStreams) {
+        if (0 == stream->getResponseCode()) {
+            result.push_back(stream);
+        }
+    }
+    return result;
+}
+
+int HTTP2StreamPool::countPendingPostStreamsLocked() {
+    int count = 0;
+    for (auto stream : m_postStreams) {
+        if (0 == stream->getResponseCode()) {
+            ++count;
+        }
+    }
+    return count;
+}
+
 std::shared_ptr<HTTP2Stream> HTTP2StreamPool::getStream(std::shared_ptr<MessageConsumerInterface> messageConsumer) {
     if (!messageConsumer) {
         ACSDK_ERROR(LX("getStreamFailed").d("reason", "nullptrMessageConsumer"));
@@ -111,6 +148,19 @@ std::shared_ptr<HTTP2Stream> HTTP2StreamPool::getStream(std::shared_ptr<MessageC
     return result;
 }
 
+void HTTP2StreamPool::prepareStream(std::shared_ptr<MessageConsumerInterface> messageConsumer) {
+    if (!messageConsumer) {
+        ACSDK_ERROR(LX("prepareStreamFailed").d("reason", "nullptrMessageConsumer"));
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_pool.empty() || m_numAcquiredStreams >= m_maxStreams) {
+        return;
+    }
+    m_pool.push_back(std::make_shared<HTTP2Stream>(messageConsumer, m_attachmentManager));
+    ACSDK_DEBUG9(LX("prepareStream").d("numAcquiredStreams", m_numAcquiredStreams));
+}
+
 void HTTP2StreamPool::releaseStream(std::shared_ptr<HTTP2Stream> stream) {
     if (!stream) {
         return;
@@ -127,6 +177,7 @@ void HTTP2StreamPool::releaseStream(std::shared_ptr<HTTP2Stream> stream) {
     }
 
     m_numAcquiredStreams--;
+    m_postStreams.erase(std::remove(m_postStreams.begin(), m_postStreams.end(), stream), m_postStreams.end());
 
     ACSDK_DEBUG0(
         LX("releaseStream").d("streamId", stream->getLogicalStreamId()).d("numAcquiredStreams", m_numAcquiredStreams));
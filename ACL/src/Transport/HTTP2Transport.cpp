@@ -13,9 +13,11 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <chrono>
 #include <functional>
 #include <random>
+#include <vector>
 
 #include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <AVSCommon/Utils/LibcurlUtils/HttpResponseCodes.h>
@@ -58,7 +60,7 @@ const static std::string AVS_DOWNCHANNEL_URL_PATH_EXTENSION = "/v20160207/direct
 const static std::string AVS_EVENT_URL_PATH_EXTENSION = "/v20160207/events";
 /// URL to send pings to
 const static std::string AVS_PING_URL_PATH_EXTENSION = "/ping";
-/// Timeout for curl_multi_wait
+/// Timeout for curl_multi_wait while event streams are active, so that stalled streams are noticed.
 const static std::chrono::milliseconds WAIT_FOR_ACTIVITY_TIMEOUT(100);
 /// Timeout for curl_multi_wait while all HTTP/2 event streams are paused.
 const static std::chrono::milliseconds WAIT_FOR_ACTIVITY_WHILE_STREAMS_PAUSED_TIMEOUT(10);
@@ -74,6 +76,31 @@ static const std::chrono::seconds STREAM_PROGRESS_TIMEOUT = std::chrono::seconds
 static const std::string ACL_CONFIG_KEY = "acl";
 /// Key for the 'endpoint' value under the @c ACL_CONFIG_KEY configuration node.
 static const std::string ENDPOINT_KEY = "endpoint";
+/// Key for the 'maxConcurrentEventStreams' value under the @c ACL_CONFIG_KEY configuration node.
+static const std::string MAX_CONCURRENT_EVENT_STREAMS_KEY = "maxConcurrentEventStreams";
+/// Default maximum number of event streams awaiting a response code.  One event at a time is sent by default.
+static const int DEFAULT_MAX_CONCURRENT_EVENT_STREAMS = 1;
+/// The number of streams which are reserved for the downchannel and ping requests.
+static const int NUM_RESERVED_STREAMS = 2;
+
+/**
+ * Read the maximum number of event streams which may be awaiting a response code at once from the configuration,
+ * limited to the streams which are not reserved for the downchannel and ping requests.
+ *
+ * @return The maximum number of concurrent event streams.
+ */
+static int getMaxConcurrentEventStreams() {
+    int maxConcurrentEventStreams = DEFAULT_MAX_CONCURRENT_EVENT_STREAMS;
+    alexaClientSDK::avsCommon::utils::configuration::ConfigurationNode::getRoot()[ACL_CONFIG_KEY].getInt(
+        MAX_CONCURRENT_EVENT_STREAMS_KEY, &maxConcurrentEventStreams, DEFAULT_MAX_CONCURRENT_EVENT_STREAMS);
+    if (maxConcurrentEventStreams < 1 || maxConcurrentEventStreams > MAX_STREAMS - NUM_RESERVED_STREAMS) {
+        ACSDK_WARN(LX("invalidMaxConcurrentEventStreams")
+                       .d("value", maxConcurrentEventStreams)
+                       .d("default", DEFAULT_MAX_CONCURRENT_EVENT_STREAMS));
+        maxConcurrentEventStreams = DEFAULT_MAX_CONCURRENT_EVENT_STREAMS;
+    }
+    return maxConcurrentEventStreams;
+}
 
 #ifdef ACSDK_OPENSSL_MIN_VER_REQUIRED
 /**
@@ -175,6 +202,11 @@ std::shared_ptr<HTTP2Transport> HTTP2Transport::create(
     auto transport = std::shared_ptr<HTTP2Transport>(new HTTP2Transport(
         authDelegate, avsEndpoint, messageConsumerInterface, attachmentManager, postConnectFactory, transportObserver));
 
+    if (!transport->m_wakeupPipe) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "createWakeupPipeFailed"));
+        return nullptr;
+    }
+
     authDelegate->addAuthObserver(transport);
 
     return transport;
@@ -190,16 +222,23 @@ HTTP2Transport::HTTP2Transport(
         m_messageConsumer{messageConsumerInterface},
         m_authDelegate{authDelegate},
         m_avsEndpoint{avsEndpoint},
-        m_streamPool{MAX_STREAMS, attachmentManager},
+        m_maxConcurrentEventStreams{getMaxConcurrentEventStreams()},
+        m_streamPool{MAX_STREAMS, attachmentManager, m_maxConcurrentEventStreams},
         m_disconnectReason{ConnectionStatusObserverInterface::ChangedReason::INTERNAL_ERROR},
         m_isNetworkThreadRunning{false},
         m_isAuthRefreshed{false},
         m_isConnected{false},
         m_isStopping{false},
         m_disconnectedSent{false},
-        m_postConnectFactory{postConnectFactory} {
+        m_postConnectFactory{postConnectFactory},
+        m_wakeupPipe{WakeupPipe::create()} {
     m_observers.insert(observer);
 
+    if (m_wakeupPipe) {
+        auto wakeupPipe = m_wakeupPipe;
+        m_wakeupCallback = [wakeupPipe]() { wakeupPipe->wake(); };
+    }
+
     printCurlDiagnostics();
 
     if (m_avsEndpoint.empty()) {
@@ -327,9 +366,9 @@ void HTTP2Transport::networkLoop() {
     }
 
     /*
-     * Call perform repeatedly to transfer data on active streams. If all the event streams have HTTP2
-     * response codes service the next outgoing message (if any).  While the connection is alive we should have
-     * at least 1 transfer active (the downchannel).
+     * Call perform repeatedly to transfer data on active streams. While fewer than m_maxConcurrentEventStreams event
+     * streams await HTTP2 response codes service the next outgoing messages (if any).  While the connection is alive
+     * we should have at least 1 transfer active (the downchannel).
      */
     int numTransfersLeft = 1;
     auto inactivityTimerStart = std::chrono::steady_clock::now();
@@ -349,11 +388,14 @@ void HTTP2Transport::networkLoop() {
             break;
         }
 
-        if (canProcessOutgoingMessage()) {
-            processNextOutgoingMessage();
+        expireQueuedRequests();
+        while (canProcessOutgoingMessage()) {
+            if (!processNextOutgoingMessage()) {
+                break;
+            }
         }
-
-        auto multiWaitTimeout = WAIT_FOR_ACTIVITY_TIMEOUT;
+        // Have a stream ready for the next event, so that building one is not part of the time taken to send it.
+        m_streamPool.prepareStream(m_messageConsumer);
 
         size_t numberEventStreams = 0;
         size_t numberPausedStreams = 0;
@@ -368,43 +410,51 @@ void HTTP2Transport::networkLoop() {
         }
         bool paused = numberPausedStreams > 0 && (numberPausedStreams == numberEventStreams);
 
-        auto before = std::chrono::time_point<std::chrono::steady_clock>::max();
+        /*
+         * Anything which needs the loop's attention (a queued request, attachment data or space for a paused stream,
+         * or a request to stop) writes to m_wakeupPipe, and libcurl's own timers are honored by wait().  So when no
+         * event streams are active the only reason to wake up is the inactivity ping.  While event streams are active
+         * we also wake periodically to check for stalled streams.
+         */
+        auto multiWaitTimeout = WAIT_FOR_ACTIVITY_TIMEOUT;
         if (paused) {
             multiWaitTimeout = WAIT_FOR_ACTIVITY_WHILE_STREAMS_PAUSED_TIMEOUT;
-            before = std::chrono::steady_clock::now();
+        } else if (0 == numberEventStreams) {
+            auto untilPing = std::chrono::duration_cast<std::chrono::milliseconds>(
+                inactivityTimerStart + INACTIVITY_TIMEOUT - std::chrono::steady_clock::now());
+            multiWaitTimeout = std::max(untilPing, std::chrono::milliseconds::zero());
         }
-
-        // TODO: ACSDK-69 replace timeout with signal fd
+        auto before = std::chrono::steady_clock::now();
 
         int numTransfersUpdated = 0;
-        result = m_multi->wait(multiWaitTimeout, &numTransfersUpdated);
+        result = m_multi->wait(multiWaitTimeout, &numTransfersUpdated, m_wakeupPipe->getReadFd());
         if (result != CURLM_OK) {
             ACSDK_ERROR(
                 LX("networkLoopStopping").d("reason", "multiWaitFailed").d("error", curl_multi_strerror(result)));
             setIsStopping(ConnectionStatusObserverInterface::ChangedReason::INTERNAL_ERROR);
             break;
         }
-
-        // TODO: ACSDK-69 replace this logic with a signal fd
+        bool woken = m_wakeupPipe->consume();
 
         // @note curl_multi_wait will return immediately even if all streams are paused, because HTTP/2 streams
         // are full-duplex - so activity may have occurred on the other side. Therefore, if our intent is
-        // to pause ACL to give attachment readers time to catch up with written data, we must perform a local
-        // sleep of our own.
-        if (paused) {
-            auto after = std::chrono::steady_clock::now();
-            auto elapsed = after - before;
-            auto remaining = multiWaitTimeout - elapsed;
-
-            // sanity check that remainingMs is valid before performing a sleep.
-            if (remaining.count() > 0 && remaining <= WAIT_FOR_ACTIVITY_WHILE_STREAMS_PAUSED_TIMEOUT) {
-                std::this_thread::sleep_for(remaining);
+        // to pause ACL to give attachment readers time to catch up with written data, we must wait ourselves.
+        // Attachments which support it wake us as soon as they have data or space, so the wait normally ends early.
+        if (paused && !woken) {
+            auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                multiWaitTimeout - (std::chrono::steady_clock::now() - before));
+
+            // sanity check that remaining is valid before waiting.
+            if (remaining.count() > 0 && remaining <= WAIT_FOR_ACTIVITY_WHILE_STREAMS_PAUSED_TIMEOUT &&
+                m_wakeupPipe->waitForWake(remaining)) {
+                m_wakeupPipe->consume();
             }
         }
 
         /**
          * If some transfers were updated then reset the start of the inactivity timer to now.  Otherwise,
-         * if the INACTIVITY_TIMEOUT has been reached send a ping to AVS so verify connectivity.
+         * if the INACTIVITY_TIMEOUT has been reached send a ping to AVS so verify connectivity.  Wake-ups through
+         * m_wakeupPipe are not counted in numTransfersUpdated, so they do not hold off the ping.
          */
         auto now = std::chrono::steady_clock::now();
         if (numTransfersUpdated != 0) {
@@ -491,7 +541,8 @@ bool HTTP2Transport::establishConnection() {
         }
         // wait for activity on the downchannel stream, kinda like poll()
         int numTransfersUpdated = 0;
-        result = m_multi->wait(WAIT_FOR_ACTIVITY_TIMEOUT, &numTransfersUpdated);
+        result = m_multi->wait(WAIT_FOR_ACTIVITY_TIMEOUT, &numTransfersUpdated, m_wakeupPipe->getReadFd());
+        m_wakeupPipe->consume();
         if (result != CURLM_OK) {
             ACSDK_ERROR(
                 LX("establishConnectionFailed").d("reason", "waitFailed").d("error", curl_multi_strerror(result)));
@@ -524,6 +575,7 @@ bool HTTP2Transport::setupDownchannelStream() {
         setIsStopping(ConnectionStatusObserverInterface::ChangedReason::INTERNAL_ERROR);
         return false;
     }
+    m_downchannelStream->setWakeupCallback(m_wakeupCallback);
     // Since the downchannel is the first stream to be established, make sure it times out if
     // a connection can't be established.
     if (!m_downchannelStream->setConnectionTimeout(ESTABLISH_CONNECTION_TIMEOUT)) {
@@ -592,21 +644,23 @@ void HTTP2Transport::cleanupStalledStreams() {
 }
 
 bool HTTP2Transport::canProcessOutgoingMessage() {
-    for (auto entry : m_activeStreams) {
-        auto stream = entry.second;
-        // If we have an event that still hasn't received a response code then we cannot send another outgoing message.
-        if (isEventStream(stream) && (stream->getResponseCode() == 0)) {
-            return false;
-        }
-    }
-    // All outstanding streams (if any) have received a response, the next message can now be sent.
-    return true;
+    // The next message may be sent as long as fewer than m_maxConcurrentEventStreams events await a response code.
+    return m_streamPool.canCreatePostStream();
 }
 
-void HTTP2Transport::processNextOutgoingMessage() {
-    auto request = dequeueRequest();
+bool HTTP2Transport::processNextOutgoingMessage() {
+    std::unordered_set<std::string> pendingOrderingKeys;
+    if (m_maxConcurrentEventStreams > 1) {
+        for (auto stream : m_streamPool.getPendingPostStreams()) {
+            auto pendingRequest = stream->getMessageRequest();
+            if (pendingRequest) {
+                pendingOrderingKeys.insert(pendingRequest->getOrderingKey());
+            }
+        }
+    }
+    auto request = dequeueRequest(pendingOrderingKeys);
     if (!request) {
-        return;
+        return false;
     }
     auto authToken = m_authDelegate->getAuthToken();
     if (authToken.empty()) {
@@ -614,7 +668,7 @@ void HTTP2Transport::processNextOutgoingMessage() {
                          .d("reason", "invalidAuth")
                          .sensitive("jsonContext", request->getJsonContent()));
         request->sendCompleted(MessageRequestObserverInterface::Status::INVALID_AUTH);
-        return;
+        return true;
     }
     ACSDK_DEBUG0(LX("processNextOutgoingMessage")
                      .sensitive("jsonContent", request->getJsonContent())
@@ -630,6 +684,7 @@ void HTTP2Transport::processNextOutgoingMessage() {
     std::shared_ptr<HTTP2Stream> stream = m_streamPool.createPostStream(url, authToken, request, m_messageConsumer);
     // note : if the stream is nullptr, the stream pool already called sendCompleted on the MessageRequest.
     if (stream) {
+        stream->setWakeupCallback(m_wakeupCallback);
         stream->setProgressTimeout(STREAM_PROGRESS_TIMEOUT);
         auto result = m_multi->addHandle(stream->getCurlHandle());
         if (result != CURLM_OK) {
@@ -644,6 +699,7 @@ void HTTP2Transport::processNextOutgoingMessage() {
             m_activeStreams.insert(ActiveTransferEntry(stream->getCurlHandle(), stream));
         }
     }
+    return true;
 }
 
 bool HTTP2Transport::sendPing() {
@@ -714,6 +770,7 @@ void HTTP2Transport::setIsStoppingLocked(ConnectionStatusObserverInterface::Chan
     m_disconnectReason = reason;
     m_isStopping = true;
     m_wakeRetryTrigger.notify_one();
+    m_wakeupPipe->wake();
 }
 
 bool HTTP2Transport::isStopping() {
@@ -762,7 +819,8 @@ bool HTTP2Transport::enqueueRequest(std::shared_ptr<MessageRequest> request, boo
     if (!m_isStopping) {
         if (ignoreConnectState || m_isConnected) {
             ACSDK_DEBUG9(LX("enqueueRequest").sensitive("jsonContent", request->getJsonContent()));
-            m_requestQueue.push_back(request);
+            m_requestQueue.push(request);
+            m_wakeupPipe->wake();
             return true;
         } else {
             ACSDK_ERROR(LX("enqueueRequestFailed").d("reason", "isNotConnected"));
@@ -773,22 +831,42 @@ bool HTTP2Transport::enqueueRequest(std::shared_ptr<MessageRequest> request, boo
     return false;
 }
 
-std::shared_ptr<MessageRequest> HTTP2Transport::dequeueRequest() {
+std::shared_ptr<MessageRequest> HTTP2Transport::dequeueRequest(
+    const std::unordered_set<std::string>& pendingOrderingKeys) {
     std::lock_guard<std::mutex> lock(m_mutex);
     if (m_isStopping || m_requestQueue.empty()) {
         return nullptr;
     }
-    auto result = m_requestQueue.front();
-    m_requestQueue.pop_front();
-    return result;
+    // When only one event is in flight at a time, the queue order is the send order.
+    auto request = m_requestQueue.pop(m_maxConcurrentEventStreams > 1 ? &pendingOrderingKeys : nullptr);
+    if (request) {
+        ACSDK_DEBUG9(LX("dequeueRequest").d("priority", request->getPriority()).d("queueSize", m_requestQueue.size()));
+    }
+    return request;
 }
 
 void HTTP2Transport::clearQueuedRequests() {
     std::lock_guard<std::mutex> lock(m_mutex);
-    for (auto request : m_requestQueue) {
+    for (auto request : m_requestQueue.clear()) {
         request->sendCompleted(MessageRequestObserverInterface::Status::NOT_CONNECTED);
     }
-    m_requestQueue.clear();
+}
+
+void HTTP2Transport::expireQueuedRequests() {
+    std::vector<std::shared_ptr<MessageRequest>> expired;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        expired = m_requestQueue.popExpired();
+    }
+    for (auto request : expired) {
+        ACSDK_INFO(LX("requestExpired").d("priority", request->getPriority()));
+        request->sendCompleted(MessageRequestObserverInterface::Status::TIMEDOUT);
+    }
+}
+
+MessageRequestQueue::Statistics HTTP2Transport::getRequestQueueStatistics(MessageRequest::Priority priority) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_requestQueue.getStatistics(priority);
 }
 
 void HTTP2Transport::addObserver(std::shared_ptr<TransportObserverInterface> transportObserver) {
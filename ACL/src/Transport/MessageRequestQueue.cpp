@@ -0,0 +1,176 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+#include "ACL/Transport/MessageRequestQueue.h"
+
+namespace alexaClientSDK {
+namespace acl {
+
+using namespace avsCommon::avs;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("MessageRequestQueue");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/**
+ * Map a priority to the index of its level, treating unknown values as @c NORMAL.
+ *
+ * @param priority The priority to map.
+ * @return The index of the level for @c priority.
+ */
+static size_t toLevelIndex(MessageRequest::Priority priority) {
+    auto index = static_cast<size_t>(priority);
+    if (index >= MessageRequest::NUM_PRIORITIES) {
+        ACSDK_ERROR(LX("toLevelIndexFailed").d("reason", "unknownPriority").d("priority", index));
+        return static_cast<size_t>(MessageRequest::Priority::NORMAL);
+    }
+    return index;
+}
+
+MessageRequestQueue::Statistics::Statistics() :
+        depth{0},
+        maxDepth{0},
+        enqueued{0},
+        dispatched{0},
+        expired{0},
+        totalWaitTime{0},
+        maxWaitTime{0} {
+}
+
+MessageRequestQueue::MessageRequestQueue() : m_numWithDeadline{0} {
+}
+
+void MessageRequestQueue::push(std::shared_ptr<MessageRequest> request, std::chrono::steady_clock::time_point now) {
+    if (!request) {
+        ACSDK_ERROR(LX("pushFailed").d("reason", "nullRequest"));
+        return;
+    }
+    auto& level = m_levels[toLevelIndex(request->getPriority())];
+    auto deadline = request->getDeadline();
+    level.entries.push_back({request, deadline, now});
+    if (deadline != std::chrono::steady_clock::time_point::max()) {
+        ++m_numWithDeadline;
+    }
+    auto& statistics = level.statistics;
+    ++statistics.enqueued;
+    statistics.depth = level.entries.size();
+    statistics.maxDepth = std::max(statistics.maxDepth, statistics.depth);
+}
+
+std::shared_ptr<MessageRequest> MessageRequestQueue::pop(
+    const std::unordered_set<std::string>* pendingOrderingKeys,
+    std::chrono::steady_clock::time_point now) {
+    for (auto& level : m_levels) {
+        if (level.entries.empty()) {
+            continue;
+        }
+        if (!pendingOrderingKeys) {
+            return dispatch(level, level.entries.begin(), now);
+        }
+        // Requests queued behind a blocked request with the same ordering key are blocked too.
+        auto blockedOrderingKeys = *pendingOrderingKeys;
+        for (auto it = level.entries.begin(); it != level.entries.end(); ++it) {
+            if (blockedOrderingKeys.insert(it->request->getOrderingKey()).second) {
+                return dispatch(level, it, now);
+            }
+        }
+    }
+    return nullptr;
+}
+
+std::vector<std::shared_ptr<MessageRequest>> MessageRequestQueue::popExpired(
+    std::chrono::steady_clock::time_point now) {
+    std::vector<std::shared_ptr<MessageRequest>> expired;
+    if (0 == m_numWithDeadline) {
+        return expired;
+    }
+    for (auto& level : m_levels) {
+        auto it = level.entries.begin();
+        while (it != level.entries.end()) {
+            if (it->deadline > now) {
+                ++it;
+                continue;
+            }
+            expired.push_back(it->request);
+            it = level.entries.erase(it);
+            --m_numWithDeadline;
+            ++level.statistics.expired;
+        }
+        level.statistics.depth = level.entries.size();
+    }
+    return expired;
+}
+
+std::vector<std::shared_ptr<MessageRequest>> MessageRequestQueue::clear() {
+    std::vector<std::shared_ptr<MessageRequest>> requests;
+    requests.reserve(size());
+    for (auto& level : m_levels) {
+        for (auto& entry : level.entries) {
+            requests.push_back(entry.request);
+        }
+        level.entries.clear();
+        level.statistics.depth = 0;
+    }
+    m_numWithDeadline = 0;
+    return requests;
+}
+
+bool MessageRequestQueue::empty() const {
+    return 0 == size();
+}
+
+size_t MessageRequestQueue::size() const {
+    size_t size = 0;
+    for (auto& level : m_levels) {
+        size += level.entries.size();
+    }
+    return size;
+}
+
+MessageRequestQueue::Statistics MessageRequestQueue::getStatistics(MessageRequest::Priority priority) const {
+    return m_levels[toLevelIndex(priority)].statistics;
+}
+
+std::shared_ptr<MessageRequest> MessageRequestQueue::dispatch(
+    Level& level,
+    std::deque<Entry>::iterator it,
+    std::chrono::steady_clock::time_point now) {
+    auto request = it->request;
+    if (it->deadline != std::chrono::steady_clock::time_point::max()) {
+        --m_numWithDeadline;
+    }
+    auto waitTime = std::chrono::duration_cast<std::chrono::microseconds>(now - it->enqueueTime);
+    level.entries.erase(it);
+
+    auto& statistics = level.statistics;
+    statistics.depth = level.entries.size();
+    ++statistics.dispatched;
+    statistics.totalWaitTime += waitTime;
+    statistics.maxWaitTime = std::max(statistics.maxWaitTime, waitTime);
+    return request;
+}
+
+}  // namespace acl
+}  // namespace alexaClientSDK
@@ -191,7 +191,7 @@ void MessageRouter::notifyObserverOnConnectionStatusChanged(
             observer->onConnectionStatusChanged(status, reason);
         }
     };
-    m_executor.submit(task);
+    m_executor.execute(task);
 }
 
 void MessageRouter::notifyObserverOnReceive(const std::string& contextId, const std::string& message) {
@@ -201,7 +201,7 @@ void MessageRouter::notifyObserverOnReceive(const std::string& contextId, const
             temp->receive(contextId, message);
         }
     };
-    m_executor.submit(task);
+    m_executor.execute(task);
 }
 
 void MessageRouter::createActiveTransportLocked() {
@@ -256,7 +256,7 @@ void MessageRouter::safelyResetActiveTransportLocked() {
 void MessageRouter::safelyReleaseTransport(std::shared_ptr<TransportInterface> transport) {
     if (transport) {
         auto task = [transport]() { transport->shutdown(); };
-        m_executor.submit(task);
+        m_executor.execute(task);
     }
 }
 
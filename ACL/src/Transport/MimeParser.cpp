@@ -41,12 +41,6 @@ static const std::string MIME_CONTENT_ID_FIELD_NAME = "Content-ID";
 static const std::string MIME_JSON_CONTENT_TYPE = "application/json";
 /// MIME type for binary streams
 static const std::string MIME_OCTET_STREAM_CONTENT_TYPE = "application/octet-stream";
-/// Size of CLRF in chars
-static const int LEADING_CRLF_CHAR_SIZE = 2;
-/// ASCII value of CR
-static const char CARRIAGE_RETURN_ASCII = 13;
-/// ASCII value of LF
-static const char LINE_FEED_ASCII = 10;
 
 /**
  *  Sanitize the Content-ID field in MIME header.
@@ -71,59 +65,66 @@ std::string sanitizeContentId(const std::string& mimeContentId) {
     return sanitizedContentId;
 }
 
+/**
+ * Look up the value of a MIME header.
+ *
+ * @param headers The headers to search.
+ * @param name The name of the header to look up.
+ * @return The value of the first header named @c name, or an empty string if there is none.
+ */
+static std::string getHeaderValue(const MultipartStreamParser::Headers& headers, const std::string& name) {
+    auto it = headers.find(name);
+    return it != headers.end() ? it->second : std::string();
+}
+
 MimeParser::MimeParser(
     std::shared_ptr<MessageConsumerInterface> messageConsumer,
     std::shared_ptr<AttachmentManager> attachmentManager) :
-        m_receivedFirstChunk{false},
         m_currDataType{ContentType::NONE},
+        m_multipartParser{this},
         m_messageConsumer{messageConsumer},
         m_attachmentManager{attachmentManager},
         m_dataParsedStatus{DataParsedStatus::OK},
-        m_currentByteProgress{0},
-        m_totalSuccessfullyProcessedBytes{0},
+        m_redriveOffset{0},
         m_isAttachmentWriterBufferFull{false} {
-    m_multipartReader.onPartBegin = MimeParser::partBeginCallback;
-    m_multipartReader.onPartData = MimeParser::partDataCallback;
-    m_multipartReader.onPartEnd = MimeParser::partEndCallback;
-    m_multipartReader.userData = this;
 }
 
-void MimeParser::partBeginCallback(const MultipartHeaders& headers, void* userData) {
-    MimeParser* parser = static_cast<MimeParser*>(userData);
-
-    if (parser->m_dataParsedStatus != MimeParser::DataParsedStatus::OK) {
-        ACSDK_ERROR(
-            LX("partBeginCallbackFailed").d("reason", "mimeParsingFailed").d("status", parser->m_dataParsedStatus));
+void MimeParser::onPartBegin(const MultipartStreamParser::Headers& headers) {
+    if (m_dataParsedStatus != MimeParser::DataParsedStatus::OK) {
+        ACSDK_ERROR(LX("onPartBeginFailed").d("reason", "mimeParsingFailed").d("status", m_dataParsedStatus));
         return;
     }
 
-    std::string contentType = headers[MIME_CONTENT_TYPE_FIELD_NAME];
+    std::string contentType = getHeaderValue(headers, MIME_CONTENT_TYPE_FIELD_NAME);
     if (contentType.find(MIME_JSON_CONTENT_TYPE) != std::string::npos) {
-        parser->m_currDataType = MimeParser::ContentType::JSON;
+        m_currDataType = MimeParser::ContentType::JSON;
     } else if (contentType.find(MIME_OCTET_STREAM_CONTENT_TYPE) != std::string::npos) {
         if (1 == headers.count(MIME_CONTENT_ID_FIELD_NAME)) {
-            auto contentId = sanitizeContentId(headers[MIME_CONTENT_ID_FIELD_NAME]);
-            auto attachmentId =
-                parser->m_attachmentManager->generateAttachmentId(parser->m_attachmentContextId, contentId);
-
-            if (!parser->m_attachmentWriter && attachmentId != parser->m_attachmentIdBeingReceived) {
-                parser->m_attachmentWriter = parser->m_attachmentManager->createWriter(attachmentId);
-                if (!parser->m_attachmentWriter) {
-                    ACSDK_ERROR(LX("partBeginCallbackFailed")
-                                    .d("reason", "createWriterFailed")
-                                    .d("attachmentId", attachmentId));
+            auto contentId = sanitizeContentId(getHeaderValue(headers, MIME_CONTENT_ID_FIELD_NAME));
+            auto attachmentId = m_attachmentManager->generateAttachmentId(m_attachmentContextId, contentId);
+
+            if (!m_attachmentWriter) {
+                m_attachmentWriter = m_attachmentManager->createWriter(attachmentId);
+                if (!m_attachmentWriter) {
+                    ACSDK_ERROR(
+                        LX("onPartBeginFailed").d("reason", "createWriterFailed").d("attachmentId", attachmentId));
+                } else if (m_spaceAvailableCallback) {
+                    m_attachmentWriter->setSpaceAvailableCallback(m_spaceAvailableCallback);
                 }
             }
         }
-        parser->m_currDataType = MimeParser::ContentType::ATTACHMENT;
+        m_currDataType = MimeParser::ContentType::ATTACHMENT;
+    } else {
+        m_currDataType = MimeParser::ContentType::NONE;
     }
 }
 
-MimeParser::DataParsedStatus MimeParser::writeDataToAttachment(const char* buffer, size_t size) {
+size_t MimeParser::writeDataToAttachment(const char* buffer, size_t size) {
     // Error case.  We can't process the attachment.
     if (!m_attachmentWriter) {
         ACSDK_ERROR(LX("writeDataToAttachmentFailed").d("reason", "nullAttachmentWriter"));
-        return MimeParser::DataParsedStatus::ERROR;
+        m_dataParsedStatus = MimeParser::DataParsedStatus::ERROR;
+        return 0;
     }
 
     auto writeStatus = AttachmentWriter::WriteStatus::OK;
@@ -132,129 +133,88 @@ MimeParser::DataParsedStatus MimeParser::writeDataToAttachment(const char* buffe
     // The underlying memory was closed elsewhere.
     if (AttachmentWriter::WriteStatus::CLOSED == writeStatus) {
         ACSDK_WARN(LX("writeDataToAttachmentFailed").d("reason", "attachmentWriterIsClosed"));
-        return MimeParser::DataParsedStatus::ERROR;
+        m_dataParsedStatus = MimeParser::DataParsedStatus::ERROR;
+        return 0;
     }
 
     // A low-level error with the Attachment occurred.
     if (AttachmentWriter::WriteStatus::ERROR_BYTES_LESS_THAN_WORD_SIZE == writeStatus ||
         AttachmentWriter::WriteStatus::ERROR_INTERNAL == writeStatus) {
         ACSDK_ERROR(LX("writeDataToAttachmentFailed").d("reason", "attachmentWriterInternalError"));
-        return MimeParser::DataParsedStatus::ERROR;
+        m_dataParsedStatus = MimeParser::DataParsedStatus::ERROR;
+        return 0;
     }
 
-    // We're blocked on a slow reader.
-    if (AttachmentWriter::WriteStatus::OK_BUFFER_FULL == writeStatus) {
+    // We're blocked on a slow reader.  Any bytes that were written are kept, and parsing resumes after them.
+    if (AttachmentWriter::WriteStatus::OK_BUFFER_FULL == writeStatus ||
+        (AttachmentWriter::WriteStatus::OK == writeStatus && numWritten > 0 && numWritten < size)) {
         setAttachmentWriterBufferFull(true);
-        return MimeParser::DataParsedStatus::INCOMPLETE;
+        m_dataParsedStatus = MimeParser::DataParsedStatus::INCOMPLETE;
+        return numWritten;
     }
 
     // A final sanity check to ensure we wrote the data we intended to.
-    if (AttachmentWriter::WriteStatus::OK == writeStatus && numWritten != size) {
+    if (numWritten != size) {
         ACSDK_ERROR(LX("writeDataToAttachmentFailed").d("reason", "writeTruncated"));
-        return MimeParser::DataParsedStatus::ERROR;
+        m_dataParsedStatus = MimeParser::DataParsedStatus::ERROR;
+        return 0;
     }
 
     setAttachmentWriterBufferFull(false);
-    return MimeParser::DataParsedStatus::OK;
+    return numWritten;
 }
 
-void MimeParser::partDataCallback(const char* buffer, size_t size, void* userData) {
-    MimeParser* parser = static_cast<MimeParser*>(userData);
-
-    if (MimeParser::DataParsedStatus::INCOMPLETE == parser->m_dataParsedStatus) {
-        ACSDK_DEBUG9(LX("partDataCallbackIgnored").d("reason", "attachmentWriterFullBuffer"));
-        return;
-    }
-
-    if (parser->m_dataParsedStatus != MimeParser::DataParsedStatus::OK) {
-        ACSDK_ERROR(
-            LX("partDataCallbackFailed").d("reason", "mimeParsingError").d("status", parser->m_dataParsedStatus));
-        return;
-    }
-
-    // If we've already processed any of this part in a previous incomplete iteration, let's not process it twice.
-    if (!parser->shouldProcessBytes(size)) {
-        ACSDK_DEBUG9(LX("partDataCallbackSkipped").d("reason", "bytesAlreadyProcessed"));
-        parser->updateCurrentByteProgress(size);
-        parser->m_dataParsedStatus = MimeParser::DataParsedStatus::OK;
-        return;
+size_t MimeParser::onPartData(const char* buffer, size_t size) {
+    if (m_dataParsedStatus != MimeParser::DataParsedStatus::OK) {
+        ACSDK_ERROR(LX("onPartDataFailed").d("reason", "mimeParsingError").d("status", m_dataParsedStatus));
+        return 0;
     }
 
-    // Ok, there is data in this part we've not processed yet.
-
-    // Let's do the math so we only process bytes within this part that have not been processed before.
-    auto bytesAlreadyProcessed = parser->m_totalSuccessfullyProcessedBytes - parser->m_currentByteProgress;
-    auto bytesToProcess = size - bytesAlreadyProcessed;
-
-    // Sanity check that we actually have correctly bounded work to do.
-    if (0 == bytesToProcess || bytesToProcess > size) {
-        ACSDK_ERROR(LX("partDataCallbackFailed")
-                        .d("reason", "invalidBytesToProcess")
-                        .d("bytesToProcess", bytesToProcess)
-                        .d("totalSize", size));
-        parser->m_dataParsedStatus = MimeParser::DataParsedStatus::ERROR;
-        return;
-    }
-
-    // Find the correct offset in the data to process.
-    const char* dataProcessingPoint = &(buffer[bytesAlreadyProcessed]);
-
-    switch (parser->m_currDataType) {
+    switch (m_currDataType) {
         case MimeParser::ContentType::JSON:
-            parser->m_directiveBeingReceived.append(dataProcessingPoint, bytesToProcess);
-            parser->updateCurrentByteProgress(bytesToProcess);
-            break;
+            m_directiveBeingReceived.append(buffer, size);
+            return size;
         case MimeParser::ContentType::ATTACHMENT:
-            parser->m_dataParsedStatus = parser->writeDataToAttachment(dataProcessingPoint, bytesToProcess);
-            if (MimeParser::DataParsedStatus::OK == parser->m_dataParsedStatus) {
-                parser->updateCurrentByteProgress(bytesToProcess);
-            }
-            break;
+            return writeDataToAttachment(buffer, size);
         default:
-            ACSDK_ERROR(LX("partDataCallbackFailed").d("reason", "unsupportedContentType"));
-            parser->m_dataParsedStatus = MimeParser::DataParsedStatus::ERROR;
+            ACSDK_ERROR(LX("onPartDataFailed").d("reason", "unsupportedContentType"));
+            m_dataParsedStatus = MimeParser::DataParsedStatus::ERROR;
+            return 0;
     }
 }
 
-void MimeParser::partEndCallback(void* userData) {
-    MimeParser* parser = static_cast<MimeParser*>(userData);
-
-    if (parser->m_dataParsedStatus != MimeParser::DataParsedStatus::OK) {
-        ACSDK_ERROR(
-            LX("partEndCallbackFailed").d("reason", "mimeParsingError").d("status", parser->m_dataParsedStatus));
+void MimeParser::onPartEnd() {
+    if (m_dataParsedStatus != MimeParser::DataParsedStatus::OK) {
+        ACSDK_ERROR(LX("onPartEndFailed").d("reason", "mimeParsingError").d("status", m_dataParsedStatus));
         return;
     }
 
-    switch (parser->m_currDataType) {
+    switch (m_currDataType) {
         case MimeParser::ContentType::JSON:
-            if (!parser->m_messageConsumer) {
-                ACSDK_ERROR(LX("partEndCallbackFailed")
-                                .d("reason", "nullMessageConsumer")
-                                .d("status", parser->m_dataParsedStatus));
+            if (!m_messageConsumer) {
+                ACSDK_ERROR(LX("onPartEndFailed").d("reason", "nullMessageConsumer").d("status", m_dataParsedStatus));
                 break;
             }
-            // Check there's data to send out, because in a re-drive we may skip a directive that's been seen before.
-            if (parser->m_directiveBeingReceived != "") {
-                parser->m_messageConsumer->consumeMessage(
-                    parser->m_attachmentContextId, parser->m_directiveBeingReceived);
-                parser->m_directiveBeingReceived = "";
-            }
+            m_messageConsumer->consumeMessage(m_attachmentContextId, m_directiveBeingReceived);
+            m_directiveBeingReceived.clear();
             break;
 
         case MimeParser::ContentType::ATTACHMENT:
-            parser->closeActiveAttachmentWriter();
+            closeActiveAttachmentWriter();
             break;
 
         default:
-            ACSDK_ERROR(LX("partEndCallbackFailed").d("reason", "unsupportedContentType"));
+            ACSDK_ERROR(LX("onPartEndFailed").d("reason", "unsupportedContentType"));
     }
+    m_currDataType = ContentType::NONE;
 }
 
 void MimeParser::reset() {
     m_currDataType = ContentType::NONE;
-    m_receivedFirstChunk = false;
-    m_multipartReader.reset();
+    m_multipartParser.reset();
     m_dataParsedStatus = DataParsedStatus::OK;
+    m_redriveOffset = 0;
+    m_directiveBeingReceived.clear();
     closeActiveAttachmentWriter();
     m_isAttachmentWriterBufferFull = false;
 }
@@ -263,8 +223,12 @@ void MimeParser::setAttachmentContextId(const std::string& attachmentContextId)
     m_attachmentContextId = attachmentContextId;
 }
 
+void MimeParser::setSpaceAvailableCallback(std::function<void()> callback) {
+    m_spaceAvailableCallback = callback;
+}
+
 void MimeParser::setBoundaryString(const std::string& boundaryString) {
-    m_multipartReader.setBoundary(boundaryString);
+    m_multipartParser.setBoundary(boundaryString);
 }
 
 /*
@@ -274,53 +238,41 @@ void MimeParser::setBoundaryString(const std::string& boundaryString) {
  * Each invocation of of this function may result any number of directives and attachments being parsed out,
  * and then routed out to observers.
  *
- * As a brief example of how a parse might fail, and what the internal logic needs to do, let's imagine a multipart
- * data chunk arranged as follows (let's say it's chunk x > 0 of the data):
- *
- * [ part of directive 2 | attachment 2 | part of directive 3 ]
- *                             ^
- *                             |
- *
- * If the chunk fails while processing attachment 2 (per the arrow above), then the logic here needs to be careful to
- * ensure that a re-drive is possible, without confusing the underlying MultiPartReader object, which is stateful.
- *
- * The solution is to capture the state of the MultiPartReader object at the start of the function, and if the parse
- * is not successful, restore the object to its initial state, allowing a re-drive.  Otherwise it is left in its
- * resulting state for subsequent data chunks.
+ * The underlying @c MultipartStreamParser stops at the exact byte where an attachment write was refused, and its
+ * state always reflects that position.  So when a chunk is re-driven, the bytes consumed by previous attempts are
+ * simply skipped and parsing continues from where it stopped.  No parser state is copied, and no byte is parsed or
+ * written twice.
  */
 MimeParser::DataParsedStatus MimeParser::feed(char* data, size_t length) {
-    // Capture old state in case the complete parse does not succeed (see function comments).
-    auto oldReader = m_multipartReader;
-    auto oldReceivedFirstChunk = m_receivedFirstChunk;
-    auto oldDataType = m_currDataType;
-
-    /**
-     * Our parser expects no leading CRLF in the data stream. Additionally downchannel streams
-     * include this CRLF but event streams do not. So just remove the CRLF in the first chunk of the stream
-     * if it exists.
-     */
-    if (!m_receivedFirstChunk) {
-        if (length >= LEADING_CRLF_CHAR_SIZE && CARRIAGE_RETURN_ASCII == data[0] && LINE_FEED_ASCII == data[1]) {
-            data += LEADING_CRLF_CHAR_SIZE;
-            length -= LEADING_CRLF_CHAR_SIZE;
-            m_receivedFirstChunk = true;
-        }
+    if (m_redriveOffset > length) {
+        ACSDK_ERROR(LX("feedFailed")
+                        .d("reason", "redriveShorterThanConsumed")
+                        .d("consumed", m_redriveOffset)
+                        .d("length", length));
+        m_redriveOffset = 0;
+        m_dataParsedStatus = DataParsedStatus::ERROR;
+        return m_dataParsedStatus;
     }
+    data += m_redriveOffset;
+    length -= m_redriveOffset;
 
-    // Initialize this before all the feed() callbacks happen (since this persists from previous call).
-    m_currentByteProgress = 0;
     m_dataParsedStatus = DataParsedStatus::OK;
+    auto consumed = m_multipartParser.feed(data, length);
 
-    m_multipartReader.feed(data, length);
+    if (m_multipartParser.hasError()) {
+        ACSDK_ERROR(LX("feedFailed").d("reason", "mimeParsingError").d("error", m_multipartParser.getErrorMessage()));
+        m_dataParsedStatus = DataParsedStatus::ERROR;
+    }
+
+    if (DataParsedStatus::OK == m_dataParsedStatus && consumed < length) {
+        ACSDK_ERROR(LX("feedFailed").d("reason", "dataNotConsumed").d("consumed", consumed).d("length", length));
+        m_dataParsedStatus = DataParsedStatus::ERROR;
+    }
 
-    if (DataParsedStatus::OK == m_dataParsedStatus) {
-        // We parsed all the data ok - reset our counters for the next potential feed of data.
-        resetByteProgressCounters();
+    if (DataParsedStatus::INCOMPLETE == m_dataParsedStatus) {
+        m_redriveOffset += consumed;
     } else {
-        // There was a problem parsing the data - we need to reset the previous mime parser state for re-drive.
-        m_multipartReader = oldReader;
-        m_receivedFirstChunk = oldReceivedFirstChunk;
-        m_currDataType = oldDataType;
+        m_redriveOffset = 0;
     }
 
     return m_dataParsedStatus;
@@ -331,26 +283,9 @@ std::shared_ptr<MessageConsumerInterface> MimeParser::getMessageConsumer() {
 }
 
 void MimeParser::closeActiveAttachmentWriter() {
-    m_attachmentIdBeingReceived = "";
     m_attachmentWriter.reset();
 }
 
-bool MimeParser::shouldProcessBytes(size_t size) const {
-    return (m_currentByteProgress + size) > m_totalSuccessfullyProcessedBytes;
-}
-
-void MimeParser::updateCurrentByteProgress(size_t size) {
-    m_currentByteProgress += size;
-    if (m_currentByteProgress > m_totalSuccessfullyProcessedBytes) {
-        m_totalSuccessfullyProcessedBytes = m_currentByteProgress;
-    }
-}
-
-void MimeParser::resetByteProgressCounters() {
-    m_totalSuccessfullyProcessedBytes = 0;
-    m_currentByteProgress = 0;
-}
-
 void MimeParser::setAttachmentWriterBufferFull(bool isFull) {
     if (isFull == m_isAttachmentWriterBufferFull) {
         return;
@@ -0,0 +1,334 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "ACL/Transport/MultipartStreamParser.h"
+
+namespace alexaClientSDK {
+namespace acl {
+
+/// ASCII value of CR
+static const char CR = '\r';
+/// ASCII value of LF
+static const char LF = '\n';
+/// ASCII value of the hyphen which prefixes boundaries and terminates the closing boundary.
+static const char HYPHEN = '-';
+/// The prefix of a delimiter which precedes the boundary string.
+static const std::string DELIMITER_PREFIX = "\r\n--";
+/// The size of the CRLF which optionally precedes the first boundary and which is part of @c DELIMITER_PREFIX.
+static const size_t CRLF_SIZE = 2;
+/// The separator between a header's name and its value.
+static const char HEADER_SEPARATOR = ':';
+/// Whitespace which may precede a header value.
+static const char* HEADER_WHITESPACE = " \t";
+/// Error message for a parser which has not been given a boundary.
+static const char* UNINITIALIZED_MESSAGE = "Parser uninitialized.";
+
+MultipartStreamParser::MultipartStreamParser(PartHandlerInterface* handler) : m_handler{handler} {
+    reset();
+}
+
+void MultipartStreamParser::setBoundary(const std::string& boundary) {
+    reset();
+    m_delimiter = DELIMITER_PREFIX + boundary;
+    m_state = State::START_BOUNDARY;
+    m_errorMessage = "No error.";
+}
+
+void MultipartStreamParser::reset() {
+    m_state = State::ERROR;
+    m_delimiter.clear();
+    m_matchIndex = 0;
+    m_heldBack.clear();
+    m_heldBackOffset = 0;
+    m_headerLine.clear();
+    m_headers.clear();
+    m_sawHeaderLine = false;
+    m_errorMessage = UNINITIALIZED_MESSAGE;
+}
+
+bool MultipartStreamParser::hasError() const {
+    return State::ERROR == m_state;
+}
+
+bool MultipartStreamParser::isDone() const {
+    return State::DONE == m_state;
+}
+
+const char* MultipartStreamParser::getErrorMessage() const {
+    return m_errorMessage;
+}
+
+void MultipartStreamParser::setError(const char* message) {
+    m_state = State::ERROR;
+    m_errorMessage = message;
+}
+
+size_t MultipartStreamParser::feed(const char* data, size_t length) {
+    size_t i = 0;
+    while (i < length) {
+        char c = data[i];
+        switch (m_state) {
+            case State::START_BOUNDARY:
+                // The leading CRLF of the first delimiter is optional.
+                if (0 == m_matchIndex && HYPHEN == c) {
+                    m_matchIndex = CRLF_SIZE;
+                }
+                if (m_matchIndex < m_delimiter.size()) {
+                    if (c != m_delimiter[m_matchIndex]) {
+                        setError("Malformed. Found different boundary data than the given one.");
+                        return i;
+                    }
+                    ++m_matchIndex;
+                } else if (m_matchIndex == m_delimiter.size()) {
+                    if (c != CR) {
+                        setError("Malformed. Expected CR after boundary.");
+                        return i;
+                    }
+                    ++m_matchIndex;
+                } else {
+                    if (c != LF) {
+                        setError("Malformed. Expected LF after boundary CR.");
+                        return i;
+                    }
+                    m_matchIndex = 0;
+                    m_state = State::HEADER_LINE;
+                }
+                ++i;
+                break;
+
+            case State::HEADER_LINE: {
+                auto end = static_cast<const char*>(memchr(data + i, CR, length - i));
+                if (!end) {
+                    m_headerLine.append(data + i, length - i);
+                    i = length;
+                    break;
+                }
+                m_headerLine.append(data + i, end - (data + i));
+                i = end - data + 1;
+                m_state = State::HEADER_LINE_LF;
+                break;
+            }
+
+            case State::HEADER_LINE_LF:
+                if (c != LF) {
+                    setError("Malformed header: LF expected after CR");
+                    return i;
+                }
+                ++i;
+                if (!processHeaderLine()) {
+                    return i;
+                }
+                break;
+
+            case State::DUPLICATE_BOUNDARY: {
+                // An empty line before any header: this is either a duplicate boundary ("--" boundary CRLF) or the
+                // start of a part without headers.  m_matchIndex counts matched characters of the delimiter, which
+                // starts after its CRLF prefix.
+                if (m_matchIndex < m_delimiter.size()) {
+                    if (c == m_delimiter[m_matchIndex]) {
+                        ++m_matchIndex;
+                        ++i;
+                        break;
+                    }
+                } else if (m_matchIndex == m_delimiter.size()) {
+                    if (CR == c) {
+                        ++m_matchIndex;
+                        ++i;
+                        break;
+                    }
+                } else if (LF == c) {
+                    // Duplicate boundary detected.  Skip over it.
+                    m_matchIndex = 0;
+                    m_state = State::HEADER_LINE;
+                    ++i;
+                    break;
+                }
+                // Not a duplicate boundary.  The characters matched so far are the start of the part's data.
+                auto matched = m_delimiter.substr(CRLF_SIZE, m_matchIndex - CRLF_SIZE);
+                if (m_matchIndex > m_delimiter.size()) {
+                    matched.push_back(CR);
+                }
+                beginPartData();
+                m_heldBack = matched;
+                break;
+            }
+
+            case State::PART_DATA: {
+                if (!flushHeldBack()) {
+                    return i;
+                }
+                if (0 == m_matchIndex) {
+                    // Fast path: everything before the first CR that starts a delimiter (or a prefix of one that
+                    // reaches the end of the input) is part data, and is offered to the handler in a single run.
+                    auto start = data + i;
+                    auto end = data + length;
+                    auto candidate = start;
+                    while (true) {
+                        candidate = static_cast<const char*>(memchr(candidate, CR, end - candidate));
+                        if (!candidate) {
+                            candidate = end;
+                            break;
+                        }
+                        auto compareSize = std::min(static_cast<size_t>(end - candidate), m_delimiter.size());
+                        if (0 == memcmp(candidate, m_delimiter.data(), compareSize)) {
+                            break;
+                        }
+                        ++candidate;
+                    }
+                    size_t runSize = candidate - start;
+                    if (runSize > 0) {
+                        auto accepted = emitPartData(start, runSize);
+                        i += accepted;
+                        if (accepted < runSize) {
+                            return i;
+                        }
+                    }
+                    if (candidate == end) {
+                        break;
+                    }
+                    m_matchIndex = 1;
+                    ++i;
+                    break;
+                }
+                if (c == m_delimiter[m_matchIndex]) {
+                    ++i;
+                    if (++m_matchIndex == m_delimiter.size()) {
+                        m_state = State::DELIMITER_SUFFIX;
+                    }
+                    break;
+                }
+                // False lead.  The matched characters are data, and the current character may start a new match.
+                m_heldBack.assign(m_delimiter, 0, m_matchIndex);
+                m_matchIndex = 0;
+                break;
+            }
+
+            case State::DELIMITER_SUFFIX:
+                if (CR == c) {
+                    m_state = State::DELIMITER_SUFFIX_LF;
+                    ++i;
+                } else if (HYPHEN == c) {
+                    m_state = State::CLOSE_DELIMITER_SUFFIX;
+                    ++i;
+                } else {
+                    m_heldBack = m_delimiter;
+                    m_matchIndex = 0;
+                    m_state = State::PART_DATA;
+                }
+                break;
+
+            case State::DELIMITER_SUFFIX_LF:
+                if (LF == c) {
+                    ++i;
+                    m_matchIndex = 0;
+                    m_state = State::HEADER_LINE;
+                    m_handler->onPartEnd();
+                } else {
+                    m_heldBack = m_delimiter + CR;
+                    m_matchIndex = 0;
+                    m_state = State::PART_DATA;
+                }
+                break;
+
+            case State::CLOSE_DELIMITER_SUFFIX:
+                if (HYPHEN == c) {
+                    ++i;
+                    m_matchIndex = 0;
+                    m_state = State::DONE;
+                    m_handler->onPartEnd();
+                } else {
+                    m_heldBack = m_delimiter + HYPHEN;
+                    m_matchIndex = 0;
+                    m_state = State::PART_DATA;
+                }
+                break;
+
+            case State::DONE:
+                // Ignore the epilogue.
+                return length;
+
+            case State::ERROR:
+                return i;
+        }
+    }
+    return i;
+}
+
+bool MultipartStreamParser::processHeaderLine() {
+    if (m_headerLine.empty()) {
+        if (m_sawHeaderLine) {
+            beginPartData();
+        } else {
+            m_matchIndex = CRLF_SIZE;
+            m_state = State::DUPLICATE_BOUNDARY;
+        }
+        return true;
+    }
+
+    m_state = State::HEADER_LINE;
+
+    if (!m_sawHeaderLine && 0 == m_headerLine.compare(0, std::string::npos, m_delimiter, CRLF_SIZE)) {
+        // Duplicate boundary detected.  Skip over it.
+        m_headerLine.clear();
+        return true;
+    }
+
+    auto separator = m_headerLine.find(HEADER_SEPARATOR);
+    if (std::string::npos == separator || 0 == separator) {
+        setError("Malformed header line.");
+        return false;
+    }
+    auto valueStart = m_headerLine.find_first_not_of(HEADER_WHITESPACE, separator + 1);
+    m_headers.insert(std::make_pair(
+        m_headerLine.substr(0, separator),
+        std::string::npos == valueStart ? std::string() : m_headerLine.substr(valueStart)));
+    m_headerLine.clear();
+    m_sawHeaderLine = true;
+    return true;
+}
+
+void MultipartStreamParser::beginPartData() {
+    m_handler->onPartBegin(m_headers);
+    m_headers.clear();
+    m_headerLine.clear();
+    m_sawHeaderLine = false;
+    m_matchIndex = 0;
+    m_state = State::PART_DATA;
+}
+
+bool MultipartStreamParser::flushHeldBack() {
+    if (m_heldBack.empty()) {
+        return true;
+    }
+    auto remaining = m_heldBack.size() - m_heldBackOffset;
+    m_heldBackOffset += m_handler->onPartData(m_heldBack.data() + m_heldBackOffset, remaining);
+    if (m_heldBackOffset < m_heldBack.size()) {
+        return false;
+    }
+    m_heldBack.clear();
+    m_heldBackOffset = 0;
+    return true;
+}
+
+size_t MultipartStreamParser::emitPartData(const char* data, size_t size) {
+    auto accepted = m_handler->onPartData(data, size);
+    return accepted < size ? accepted : size;
+}
+
+}  // namespace acl
+}  // namespace alexaClientSDK
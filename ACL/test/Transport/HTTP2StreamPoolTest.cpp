@@ -37,6 +37,8 @@ using namespace alexaClientSDK::avsCommon::avs::initialization;
 static const std::string TEST_LIBCURL_URL = "https://www.amazon.com/";
 /// The maximum number of streams in the stream pool
 static const int TEST_MAX_STREAMS = 10;
+/// The maximum number of POST streams awaiting a response code in the limited stream pool.
+static const int TEST_MAX_PENDING_POST_STREAMS = 3;
 /// A test auth string with which to initialize our test stream object.
 static const std::string LIBCURL_TEST_AUTH_STRING = "test_auth_string";
 
@@ -167,6 +169,37 @@ TEST_F(HTTP2StreamPoolTest, ReleaseStreamTestSendMoreThanMaxStreams) {
     }
 }
 
+/**
+ * Verify that the stream prepared by @c prepareStream is the one handed out by the next request, and that preparing
+ * a stream does not count against the maximum number of streams.
+ */
+TEST_F(HTTP2StreamPoolTest, PreparedStreamIsUsedByNextRequest) {
+    m_testableStreamPool->prepareStream(nullptr);
+    m_testableStreamPool->prepareStream(m_testableConsumer);
+    auto prepared =
+        m_testableStreamPool->createGetStream(TEST_LIBCURL_URL, LIBCURL_TEST_AUTH_STRING, m_testableConsumer);
+    ASSERT_NE(prepared, nullptr);
+    m_testableStreamPool->releaseStream(prepared);
+
+    // Preparing again while the pool holds a stream adds nothing, so the released stream is handed out again.
+    m_testableStreamPool->prepareStream(m_testableConsumer);
+    std::vector<std::shared_ptr<HTTP2Stream>> streams;
+    for (int count = 0; count < TEST_MAX_STREAMS; count++) {
+        m_testableStreamPool->prepareStream(m_testableConsumer);
+        streams.push_back(m_testableStreamPool->createPostStream(
+            TEST_LIBCURL_URL, LIBCURL_TEST_AUTH_STRING, m_mockMessageRequest, m_testableConsumer));
+        ASSERT_NE(streams.back(), nullptr);
+    }
+    ASSERT_EQ(streams.front(), prepared);
+
+    // With every stream acquired nothing is prepared, and the limit still applies.
+    m_testableStreamPool->prepareStream(m_testableConsumer);
+    ASSERT_EQ(
+        m_testableStreamPool->createPostStream(
+            TEST_LIBCURL_URL, LIBCURL_TEST_AUTH_STRING, m_mockMessageRequest, m_testableConsumer),
+        nullptr);
+}
+
 /**
  * Try sending nullptr on @c releaseStream after sending max number of streams,
  * check for failure of sending more streams.
@@ -194,6 +227,41 @@ TEST_F(HTTP2StreamPoolTest, ReleaseStreamTestAfterNullTest) {
         ASSERT_EQ(stream_pool.back(), nullptr);
     }
 }
+
+/**
+ * Verify that the number of POST streams awaiting a response code is limited, that GET streams do not count against
+ * the limit, and that releasing a POST stream allows another to be created.
+ */
+TEST_F(HTTP2StreamPoolTest, PendingPostStreamsAreLimited) {
+    HTTP2StreamPool streamPool(TEST_MAX_STREAMS, nullptr, TEST_MAX_PENDING_POST_STREAMS);
+    auto getStream = streamPool.createGetStream(TEST_LIBCURL_URL, LIBCURL_TEST_AUTH_STRING, m_testableConsumer);
+    ASSERT_NE(getStream, nullptr);
+
+    std::vector<std::shared_ptr<HTTP2Stream>> postStreams;
+    for (int count = 0; count < TEST_MAX_PENDING_POST_STREAMS; count++) {
+        ASSERT_TRUE(streamPool.canCreatePostStream());
+        postStreams.push_back(streamPool.createPostStream(
+            TEST_LIBCURL_URL, LIBCURL_TEST_AUTH_STRING, m_mockMessageRequest, m_testableConsumer));
+        ASSERT_NE(postStreams.back(), nullptr);
+        ASSERT_EQ(postStreams.back()->getMessageRequest(), m_mockMessageRequest);
+    }
+    ASSERT_EQ(streamPool.getPendingPostStreams().size(), static_cast<size_t>(TEST_MAX_PENDING_POST_STREAMS));
+    ASSERT_FALSE(streamPool.canCreatePostStream());
+    ASSERT_EQ(
+        streamPool.createPostStream(
+            TEST_LIBCURL_URL, LIBCURL_TEST_AUTH_STRING, m_mockMessageRequest, m_testableConsumer),
+        nullptr);
+
+    streamPool.releaseStream(postStreams.back());
+    postStreams.pop_back();
+    ASSERT_TRUE(streamPool.canCreatePostStream());
+    ASSERT_EQ(streamPool.getPendingPostStreams().size(), postStreams.size());
+    ASSERT_NE(
+        streamPool.createPostStream(
+            TEST_LIBCURL_URL, LIBCURL_TEST_AUTH_STRING, m_mockMessageRequest, m_testableConsumer),
+        nullptr);
+}
+
 }  // namespace test
 }  // namespace acl
 }  // namespace alexaClientSDK
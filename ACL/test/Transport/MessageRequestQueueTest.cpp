@@ -0,0 +1,185 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file MessageRequestQueueTest.cpp
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_set>
+
+#include <gtest/gtest.h>
+
+#include "ACL/Transport/MessageRequestQueue.h"
+
+namespace alexaClientSDK {
+namespace acl {
+namespace test {
+
+using namespace avsCommon::avs;
+
+/// Shorthand for the priority type.
+using Priority = MessageRequest::Priority;
+
+/// An ordering key for testing.
+static const std::string ORDERING_KEY_A = "A";
+
+/// Another ordering key for testing.
+static const std::string ORDERING_KEY_B = "B";
+
+/// The time that requests wait in the queue in the statistics test.
+static const std::chrono::milliseconds WAIT_TIME(50);
+
+/// Test harness for @c MessageRequestQueue.
+class MessageRequestQueueTest : public ::testing::Test {
+public:
+    /**
+     * Create a request.
+     *
+     * @param priority The priority of the request.
+     * @param orderingKey The ordering key of the request.
+     * @return The new request.
+     */
+    std::shared_ptr<MessageRequest> createRequest(
+        Priority priority,
+        const std::string& orderingKey = ORDERING_KEY_A);
+
+    /// The queue under test.
+    MessageRequestQueue m_queue;
+
+    /// The time used as the present in these tests.
+    std::chrono::steady_clock::time_point m_now = std::chrono::steady_clock::now();
+};
+
+std::shared_ptr<MessageRequest> MessageRequestQueueTest::createRequest(
+    Priority priority,
+    const std::string& orderingKey) {
+    auto request = std::make_shared<MessageRequest>("{}");
+    request->setPriority(priority);
+    request->setOrderingKey(orderingKey);
+    return request;
+}
+
+/**
+ * Verify that higher priority requests are dispatched first, and requests of the same priority in FIFO order.
+ */
+TEST_F(MessageRequestQueueTest, dispatchesByPriorityThenFifo) {
+    auto background = createRequest(Priority::BACKGROUND);
+    auto normal1 = createRequest(Priority::NORMAL);
+    auto normal2 = createRequest(Priority::NORMAL);
+    auto interactive = createRequest(Priority::INTERACTIVE);
+    m_queue.push(background, m_now);
+    m_queue.push(normal1, m_now);
+    m_queue.push(normal2, m_now);
+    m_queue.push(interactive, m_now);
+    ASSERT_EQ(m_queue.size(), 4u);
+
+    ASSERT_EQ(m_queue.pop(nullptr, m_now), interactive);
+    ASSERT_EQ(m_queue.pop(nullptr, m_now), normal1);
+    ASSERT_EQ(m_queue.pop(nullptr, m_now), normal2);
+    ASSERT_EQ(m_queue.pop(nullptr, m_now), background);
+    ASSERT_EQ(m_queue.pop(nullptr, m_now), nullptr);
+    ASSERT_TRUE(m_queue.empty());
+}
+
+/**
+ * Verify that ordering keys block requests within a level, but do not stop a higher priority request from overtaking.
+ */
+TEST_F(MessageRequestQueueTest, orderingKeysBlockWithinALevel) {
+    auto normalA1 = createRequest(Priority::NORMAL, ORDERING_KEY_A);
+    auto normalA2 = createRequest(Priority::NORMAL, ORDERING_KEY_A);
+    auto normalB = createRequest(Priority::NORMAL, ORDERING_KEY_B);
+    auto interactiveA = createRequest(Priority::INTERACTIVE, ORDERING_KEY_A);
+    m_queue.push(normalA1, m_now);
+    m_queue.push(normalA2, m_now);
+    m_queue.push(normalB, m_now);
+    m_queue.push(interactiveA, m_now);
+
+    std::unordered_set<std::string> pending;
+    ASSERT_EQ(m_queue.pop(&pending, m_now), interactiveA);
+    ASSERT_EQ(m_queue.pop(&pending, m_now), normalA1);
+    pending.insert(ORDERING_KEY_A);
+    ASSERT_EQ(m_queue.pop(&pending, m_now), normalB);
+    ASSERT_EQ(m_queue.pop(&pending, m_now), nullptr);
+    pending.clear();
+    ASSERT_EQ(m_queue.pop(&pending, m_now), normalA2);
+}
+
+/**
+ * Verify that requests whose deadline has passed are returned by @c popExpired() and counted as expired.
+ */
+TEST_F(MessageRequestQueueTest, expiredRequestsAreRemoved) {
+    auto expiring = createRequest(Priority::BACKGROUND);
+    expiring->setDeadline(m_now + WAIT_TIME);
+    auto other = createRequest(Priority::BACKGROUND);
+    m_queue.push(expiring, m_now);
+    m_queue.push(other, m_now);
+
+    ASSERT_TRUE(m_queue.popExpired(m_now).empty());
+    auto expired = m_queue.popExpired(m_now + WAIT_TIME);
+    ASSERT_EQ(expired.size(), 1u);
+    ASSERT_EQ(expired[0], expiring);
+    ASSERT_EQ(m_queue.size(), 1u);
+
+    auto statistics = m_queue.getStatistics(Priority::BACKGROUND);
+    ASSERT_EQ(statistics.expired, 1u);
+    ASSERT_EQ(statistics.depth, 1u);
+    ASSERT_EQ(m_queue.pop(nullptr, m_now), other);
+}
+
+/**
+ * Verify the depth and wait time counters of a level.
+ */
+TEST_F(MessageRequestQueueTest, statisticsAreCounted) {
+    m_queue.push(createRequest(Priority::NORMAL), m_now);
+    m_queue.push(createRequest(Priority::NORMAL), m_now);
+    m_queue.push(createRequest(Priority::INTERACTIVE), m_now);
+
+    auto statistics = m_queue.getStatistics(Priority::NORMAL);
+    ASSERT_EQ(statistics.depth, 2u);
+    ASSERT_EQ(statistics.maxDepth, 2u);
+    ASSERT_EQ(statistics.enqueued, 2u);
+
+    ASSERT_NE(m_queue.pop(nullptr, m_now), nullptr);
+    ASSERT_NE(m_queue.pop(nullptr, m_now + WAIT_TIME), nullptr);
+    ASSERT_NE(m_queue.pop(nullptr, m_now + WAIT_TIME * 2), nullptr);
+
+    statistics = m_queue.getStatistics(Priority::NORMAL);
+    ASSERT_EQ(statistics.depth, 0u);
+    ASSERT_EQ(statistics.maxDepth, 2u);
+    ASSERT_EQ(statistics.dispatched, 2u);
+    ASSERT_EQ(statistics.totalWaitTime, WAIT_TIME * 3);
+    ASSERT_EQ(statistics.maxWaitTime, WAIT_TIME * 2);
+
+    statistics = m_queue.getStatistics(Priority::INTERACTIVE);
+    ASSERT_EQ(statistics.dispatched, 1u);
+    ASSERT_EQ(statistics.totalWaitTime, std::chrono::microseconds::zero());
+    ASSERT_EQ(m_queue.getStatistics(Priority::BACKGROUND).enqueued, 0u);
+}
+
+/**
+ * Verify that @c clear() returns every queued request.
+ */
+TEST_F(MessageRequestQueueTest, clearReturnsAllRequests) {
+    m_queue.push(createRequest(Priority::BACKGROUND), m_now);
+    m_queue.push(createRequest(Priority::INTERACTIVE), m_now);
+    ASSERT_EQ(m_queue.clear().size(), 2u);
+    ASSERT_TRUE(m_queue.empty());
+    ASSERT_EQ(m_queue.getStatistics(Priority::BACKGROUND).depth, 0u);
+}
+
+}  // namespace test
+}  // namespace acl
+}  // namespace alexaClientSDK
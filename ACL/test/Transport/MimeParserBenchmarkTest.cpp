@@ -0,0 +1,342 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file MimeParserBenchmarkTest.cpp
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/AVS/Attachment/AttachmentManager.h>
+#include <AVSCommon/AVS/Attachment/AttachmentWriter.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <MultipartParser/MultipartReader.h>
+
+#include "ACL/Transport/MimeParser.h"
+#include "TestableConsumer.h"
+
+namespace alexaClientSDK {
+namespace acl {
+namespace test {
+
+using namespace avsCommon::avs::attachment;
+using namespace avsCommon::utils::sds;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("MimeParserBenchmarkTest");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// A test boundary string.
+static const std::string BOUNDARY = "84109348-943b-4446-85e6-e73eda9fac43";
+/// The CRLF which terminates lines.
+static const std::string CRLF = "\r\n";
+/// A test context id.
+static const std::string CONTEXT_ID = "CONTEXT_ID";
+/// A JSON part header.
+static const std::string JSON_HEADERS = "Content-Type: application/json" + CRLF + CRLF;
+/// A directive to precede and follow the attachment.
+static const std::string DIRECTIVE =
+    "{\"directive\":{\"header\":{\"namespace\":\"SpeechSynthesizer\",\"name\":\"Speak\",\"messageId\":\"1\"},"
+    "\"payload\":{\"url\":\"cid:AUDIO\",\"format\":\"AUDIO_MPEG\",\"token\":\"token\"}}}";
+/// Attachment part headers.
+static const std::string ATTACHMENT_HEADERS =
+    "Content-Type: application/octet-stream" + CRLF + "Content-ID: <AUDIO>" + CRLF + CRLF;
+/// The size of the attachment in the benchmark body.
+static const size_t ATTACHMENT_SIZE = 8 * 1024 * 1024;
+/// The size of the chunks passed to @c feed(), matching libcurl's default @c CURL_MAX_WRITE_SIZE.
+static const size_t FEED_SIZE = 16 * 1024;
+/// Each writer refuses one in this many writes, simulating a reader that falls behind.
+static const int REFUSE_WRITE_PERIOD = 3;
+/// The number of times each parser parses the body.
+static const int ITERATIONS = 4;
+/// An upper bound on re-drives of a single chunk, to avoid an infinite loop on failure.
+static const int MAX_REDRIVES = 100;
+
+/**
+ * An @c AttachmentWriter which discards data but counts it, and which periodically reports a full buffer.
+ */
+class ThrottledAttachmentWriter : public AttachmentWriter {
+public:
+    /**
+     * Constructor.
+     *
+     * @param bytesWritten Where to accumulate the number of bytes written.
+     */
+    ThrottledAttachmentWriter(size_t* bytesWritten) : m_bytesWritten{bytesWritten}, m_writeCount{0} {
+    }
+
+    std::size_t write(
+        const void* buf,
+        std::size_t numBytes,
+        WriteStatus* writeStatus,
+        std::chrono::milliseconds timeout) override {
+        if (0 == (++m_writeCount % REFUSE_WRITE_PERIOD)) {
+            *writeStatus = WriteStatus::OK_BUFFER_FULL;
+            return 0;
+        }
+        *writeStatus = WriteStatus::OK;
+        *m_bytesWritten += numBytes;
+        return numBytes;
+    }
+
+    void close() override {
+    }
+
+private:
+    /// Where to accumulate the number of bytes written.
+    size_t* m_bytesWritten;
+    /// The number of calls to @c write().
+    int m_writeCount;
+};
+
+/**
+ * An @c AttachmentManager which hands out @c ThrottledAttachmentWriters.
+ */
+class ThrottledAttachmentManager : public AttachmentManager {
+public:
+    ThrottledAttachmentManager() : AttachmentManager{AttachmentType::IN_PROCESS}, bytesWritten{0} {
+    }
+
+    std::unique_ptr<AttachmentWriter> createWriter(const std::string& attachmentId, WriterPolicy policy) override {
+        return std::unique_ptr<AttachmentWriter>(new ThrottledAttachmentWriter(&bytesWritten));
+    }
+
+    /// The number of attachment bytes written.
+    size_t bytesWritten;
+};
+
+/**
+ * A reproduction of the approach @c MimeParser used before it was made resumable: the @c MultipartReader is copied
+ * before every chunk, restored when an attachment write is refused, and the chunk is replayed from its start while
+ * counting off the bytes that were already written.
+ */
+class SnapshotMimeParser {
+public:
+    /**
+     * Constructor.
+     *
+     * @param attachmentManager Provides the attachment writers.
+     * @param consumer Receives the directives.
+     */
+    SnapshotMimeParser(
+        std::shared_ptr<AttachmentManager> attachmentManager,
+        std::shared_ptr<TestableConsumer> consumer) :
+            m_attachmentManager{attachmentManager},
+            m_consumer{consumer},
+            m_receivedFirstChunk{false},
+            m_isJson{false},
+            m_status{MimeParser::DataParsedStatus::OK},
+            m_currentByteProgress{0},
+            m_totalSuccessfullyProcessedBytes{0} {
+        m_reader.onPartBegin = partBegin;
+        m_reader.onPartData = partData;
+        m_reader.onPartEnd = partEnd;
+        m_reader.userData = this;
+        m_reader.setBoundary(BOUNDARY);
+    }
+
+    /**
+     * Feed a chunk of data, as @c MimeParser::feed() used to.
+     *
+     * @param data The chunk.
+     * @param length The size of the chunk.
+     * @return The status of the parse.
+     */
+    MimeParser::DataParsedStatus feed(const char* data, size_t length) {
+        if (!m_receivedFirstChunk && length >= CRLF.size() && 0 == CRLF.compare(0, CRLF.size(), data, CRLF.size())) {
+            data += CRLF.size();
+            length -= CRLF.size();
+            m_receivedFirstChunk = true;
+        }
+        auto oldReader = m_reader;
+        auto oldIsJson = m_isJson;
+        m_currentByteProgress = 0;
+        m_status = MimeParser::DataParsedStatus::OK;
+        m_reader.feed(data, length);
+        if (MimeParser::DataParsedStatus::OK == m_status) {
+            m_currentByteProgress = 0;
+            m_totalSuccessfullyProcessedBytes = 0;
+        } else {
+            m_reader = oldReader;
+            m_isJson = oldIsJson;
+        }
+        return m_status;
+    }
+
+private:
+    static void partBegin(const MultipartHeaders& headers, void* userData) {
+        auto self = static_cast<SnapshotMimeParser*>(userData);
+        self->m_isJson = headers["Content-Type"].find("json") != std::string::npos;
+        if (!self->m_isJson && !self->m_writer) {
+            self->m_writer = self->m_attachmentManager->createWriter(headers["Content-ID"]);
+        }
+    }
+
+    static void partData(const char* buffer, size_t size, void* userData) {
+        auto self = static_cast<SnapshotMimeParser*>(userData);
+        if (MimeParser::DataParsedStatus::OK != self->m_status) {
+            return;
+        }
+        if (self->m_currentByteProgress + size <= self->m_totalSuccessfullyProcessedBytes) {
+            self->advance(size);
+            return;
+        }
+        auto alreadyProcessed = self->m_totalSuccessfullyProcessedBytes - self->m_currentByteProgress;
+        auto toProcess = size - alreadyProcessed;
+        if (self->m_isJson) {
+            self->m_directive.append(buffer + alreadyProcessed, toProcess);
+            self->advance(toProcess);
+            return;
+        }
+        auto writeStatus = AttachmentWriter::WriteStatus::OK;
+        self->m_writer->write(buffer + alreadyProcessed, toProcess, &writeStatus);
+        if (AttachmentWriter::WriteStatus::OK == writeStatus) {
+            self->advance(toProcess);
+        } else {
+            self->m_status = MimeParser::DataParsedStatus::INCOMPLETE;
+        }
+    }
+
+    static void partEnd(void* userData) {
+        auto self = static_cast<SnapshotMimeParser*>(userData);
+        if (MimeParser::DataParsedStatus::OK != self->m_status) {
+            return;
+        }
+        if (self->m_isJson) {
+            if (!self->m_directive.empty()) {
+                self->m_consumer->consumeMessage(CONTEXT_ID, self->m_directive);
+                self->m_directive.clear();
+            }
+        } else {
+            self->m_writer.reset();
+        }
+    }
+
+    void advance(size_t size) {
+        m_currentByteProgress += size;
+        if (m_currentByteProgress > m_totalSuccessfullyProcessedBytes) {
+            m_totalSuccessfullyProcessedBytes = m_currentByteProgress;
+        }
+    }
+
+    std::shared_ptr<AttachmentManager> m_attachmentManager;
+    std::shared_ptr<TestableConsumer> m_consumer;
+    MultipartReader m_reader;
+    std::unique_ptr<AttachmentWriter> m_writer;
+    std::string m_directive;
+    bool m_receivedFirstChunk;
+    bool m_isJson;
+    MimeParser::DataParsedStatus m_status;
+    size_t m_currentByteProgress;
+    size_t m_totalSuccessfullyProcessedBytes;
+};
+
+/**
+ * Our GTest class.
+ */
+class MimeParserBenchmarkTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_body = CRLF + "--" + BOUNDARY + CRLF + JSON_HEADERS + DIRECTIVE;
+        m_body += CRLF + "--" + BOUNDARY + CRLF + ATTACHMENT_HEADERS;
+        m_body.reserve(m_body.size() + ATTACHMENT_SIZE + 1024);
+        // Pseudo-random audio-like bytes, including CRs and partial boundaries to exercise the boundary search.
+        unsigned int seed = 1;
+        for (size_t i = 0; i < ATTACHMENT_SIZE; ++i) {
+            seed = seed * 1103515245 + 12345;
+            m_body.push_back(static_cast<char>(seed >> 16));
+        }
+        m_body += CRLF + "--" + BOUNDARY + CRLF + JSON_HEADERS + DIRECTIVE;
+        m_body += CRLF + "--" + BOUNDARY + "--" + CRLF;
+    }
+
+    /**
+     * Parse @c m_body in @c FEED_SIZE chunks, re-driving each chunk until it is fully processed.
+     *
+     * @param feed The function that feeds a chunk to the parser under test.
+     * @return The number of calls to @c feed, including re-drives.
+     */
+    template <typename FeedFunction>
+    size_t drive(FeedFunction feed) {
+        size_t calls = 0;
+        for (size_t offset = 0; offset < m_body.size(); offset += FEED_SIZE) {
+            auto size = std::min(FEED_SIZE, m_body.size() - offset);
+            int redrives = 0;
+            auto status = MimeParser::DataParsedStatus::INCOMPLETE;
+            while (MimeParser::DataParsedStatus::INCOMPLETE == status && redrives++ < MAX_REDRIVES) {
+                ++calls;
+                status = feed(&m_body[offset], size);
+            }
+            EXPECT_EQ(status, MimeParser::DataParsedStatus::OK);
+        }
+        return calls;
+    }
+
+    /// The multipart body.
+    std::string m_body;
+};
+
+/**
+ * Compare the throughput of the resumable @c MimeParser with the snapshot and replay approach, on a multi-megabyte
+ * body with frequent back-pressure from the attachment writer.  Both must deliver identical results.
+ */
+TEST_F(MimeParserBenchmarkTest, testThroughputUnderBackPressure) {
+    std::chrono::steady_clock::duration resumableTime{0};
+    std::chrono::steady_clock::duration snapshotTime{0};
+    size_t resumableCalls = 0;
+    size_t snapshotCalls = 0;
+
+    for (int i = 0; i < ITERATIONS; ++i) {
+        auto manager = std::make_shared<ThrottledAttachmentManager>();
+        auto consumer = std::make_shared<TestableConsumer>();
+        MimeParser parser(consumer, manager);
+        parser.setAttachmentContextId(CONTEXT_ID);
+        parser.setBoundaryString(BOUNDARY);
+        auto start = std::chrono::steady_clock::now();
+        resumableCalls += drive([&parser](char* data, size_t size) { return parser.feed(data, size); });
+        resumableTime += std::chrono::steady_clock::now() - start;
+        ASSERT_EQ(manager->bytesWritten, ATTACHMENT_SIZE);
+
+        auto snapshotManager = std::make_shared<ThrottledAttachmentManager>();
+        SnapshotMimeParser snapshotParser(snapshotManager, std::make_shared<TestableConsumer>());
+        start = std::chrono::steady_clock::now();
+        snapshotCalls +=
+            drive([&snapshotParser](char* data, size_t size) { return snapshotParser.feed(data, size); });
+        snapshotTime += std::chrono::steady_clock::now() - start;
+        ASSERT_EQ(snapshotManager->bytesWritten, ATTACHMENT_SIZE);
+    }
+
+    auto megabytes = static_cast<double>(m_body.size()) * ITERATIONS / (1024 * 1024);
+    auto resumableSeconds = std::chrono::duration<double>(resumableTime).count();
+    auto snapshotSeconds = std::chrono::duration<double>(snapshotTime).count();
+    ACSDK_INFO(LX("mimeParserThroughput")
+                   .d("megabytes", megabytes)
+                   .d("resumableMBps", megabytes / resumableSeconds)
+                   .d("resumableFeedCalls", resumableCalls)
+                   .d("snapshotMBps", megabytes / snapshotSeconds)
+                   .d("snapshotFeedCalls", snapshotCalls));
+}
+
+}  // namespace test
+}  // namespace acl
+}  // namespace alexaClientSDK
@@ -0,0 +1,193 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file MultipartStreamParserTest.cpp
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ACL/Transport/MultipartStreamParser.h"
+
+namespace alexaClientSDK {
+namespace acl {
+namespace test {
+
+/// A test boundary string.
+static const std::string BOUNDARY = "84109348-943b-4446-85e6-e73eda9fac43";
+/// The CRLF which terminates lines.
+static const std::string CRLF = "\r\n";
+/// The first boundary line.
+static const std::string BOUNDARY_LINE = "--" + BOUNDARY + CRLF;
+/// A delimiter between parts.
+static const std::string DELIMITER = CRLF + "--" + BOUNDARY + CRLF;
+/// The closing delimiter.
+static const std::string CLOSE_DELIMITER = CRLF + "--" + BOUNDARY + "--" + CRLF;
+/// The content of the first test part, which contains text that partially matches the delimiter.
+static const std::string PART_1 = "{\"a\":1}\r\n--" + BOUNDARY.substr(0, 10) + "\r\r\n-x";
+/// The content of the second test part.
+static const std::string PART_2 = "binary\r\ndata\r\n--" + BOUNDARY + "x";
+/// A complete two part stream.
+static const std::string STREAM = CRLF + BOUNDARY_LINE + "Content-Type: application/json" + CRLF + CRLF + PART_1 +
+                                  DELIMITER + "Content-Type: application/octet-stream" + CRLF +
+                                  "Content-ID: <id>" + CRLF + CRLF + PART_2 + CLOSE_DELIMITER;
+
+/**
+ * Handler which records parts and which may be told to accept a limited number of bytes.
+ */
+class TestHandler : public MultipartStreamParser::PartHandlerInterface {
+public:
+    void onPartBegin(const MultipartStreamParser::Headers& headers) override {
+        headersList.push_back(headers);
+        parts.push_back("");
+    }
+
+    size_t onPartData(const char* data, size_t size) override {
+        if (size > budget) {
+            size = budget;
+        }
+        budget -= size;
+        parts.back().append(data, size);
+        ++dataCalls;
+        return size;
+    }
+
+    void onPartEnd() override {
+        ++endCount;
+    }
+
+    /// Headers of each part.
+    std::vector<MultipartStreamParser::Headers> headersList;
+    /// Data of each part.
+    std::vector<std::string> parts;
+    /// The number of parts ended.
+    int endCount = 0;
+    /// The number of calls to @c onPartData.
+    int dataCalls = 0;
+    /// The number of bytes of part data that may still be accepted.
+    size_t budget = std::string::npos;
+};
+
+/**
+ * Our GTest class.
+ */
+class MultipartStreamParserTest : public ::testing::Test {
+public:
+    MultipartStreamParserTest() : m_parser{&m_handler} {
+        m_parser.setBoundary(BOUNDARY);
+    }
+
+    /**
+     * Verify that @c STREAM was parsed into the expected parts.
+     */
+    void verifyParts() {
+        ASSERT_TRUE(m_parser.isDone());
+        ASSERT_EQ(m_handler.parts.size(), 2u);
+        ASSERT_EQ(m_handler.endCount, 2);
+        EXPECT_EQ(m_handler.parts[0], PART_1);
+        EXPECT_EQ(m_handler.parts[1], PART_2);
+        EXPECT_EQ(m_handler.headersList[0].find("Content-Type")->second, "application/json");
+        EXPECT_EQ(m_handler.headersList[1].find("Content-ID")->second, "<id>");
+    }
+
+    /// The handler receiving parts.
+    TestHandler m_handler;
+    /// The parser under test.
+    MultipartStreamParser m_parser;
+};
+
+/**
+ * Test parsing a stream in a single call.
+ */
+TEST_F(MultipartStreamParserTest, testSingleFeed) {
+    ASSERT_EQ(m_parser.feed(STREAM.data(), STREAM.size()), STREAM.size());
+    verifyParts();
+}
+
+/**
+ * Test parsing a stream one byte at a time, so that every partial match spans calls.
+ */
+TEST_F(MultipartStreamParserTest, testByteAtATime) {
+    for (size_t i = 0; i < STREAM.size(); ++i) {
+        ASSERT_EQ(m_parser.feed(STREAM.data() + i, 1), 1u);
+    }
+    verifyParts();
+}
+
+/**
+ * Test that the parser suspends exactly where the handler stops accepting data, and resumes from there.
+ */
+TEST_F(MultipartStreamParserTest, testSuspendAndResume) {
+    size_t position = 0;
+    int suspensions = 0;
+    while (position < STREAM.size()) {
+        m_handler.budget = 3;
+        auto consumed = m_parser.feed(STREAM.data() + position, STREAM.size() - position);
+        ASSERT_FALSE(m_parser.hasError());
+        position += consumed;
+        if (position < STREAM.size()) {
+            ++suspensions;
+        }
+    }
+    EXPECT_GT(suspensions, 1);
+    verifyParts();
+}
+
+/**
+ * Test that duplicate boundaries before a part's headers are skipped.
+ */
+TEST_F(MultipartStreamParserTest, testDuplicateBoundaries) {
+    std::string stream = BOUNDARY_LINE + BOUNDARY_LINE + CRLF + BOUNDARY_LINE + "Content-Type: application/json" +
+                         CRLF + CRLF + PART_1 + CLOSE_DELIMITER;
+    ASSERT_EQ(m_parser.feed(stream.data(), stream.size()), stream.size());
+    ASSERT_TRUE(m_parser.isDone());
+    ASSERT_EQ(m_handler.parts.size(), 1u);
+    EXPECT_EQ(m_handler.parts[0], PART_1);
+}
+
+/**
+ * Test that an empty line which is not followed by a duplicate boundary starts a part without headers.
+ */
+TEST_F(MultipartStreamParserTest, testPartWithoutHeaders) {
+    std::string data = "--" + BOUNDARY.substr(0, 4) + "data";
+    std::string stream = BOUNDARY_LINE + CRLF + data + CLOSE_DELIMITER;
+    ASSERT_EQ(m_parser.feed(stream.data(), stream.size()), stream.size());
+    ASSERT_EQ(m_handler.parts.size(), 1u);
+    EXPECT_TRUE(m_handler.headersList[0].empty());
+    EXPECT_EQ(m_handler.parts[0], data);
+}
+
+/**
+ * Test that a stream which does not start with the boundary is rejected.
+ */
+TEST_F(MultipartStreamParserTest, testMalformedStart) {
+    std::string stream = "--not-the-boundary" + CRLF;
+    EXPECT_LT(m_parser.feed(stream.data(), stream.size()), stream.size());
+    EXPECT_TRUE(m_parser.hasError());
+}
+
+/**
+ * Test that a parser without a boundary rejects data.
+ */
+TEST_F(MultipartStreamParserTest, testUninitialized) {
+    m_parser.reset();
+    EXPECT_EQ(m_parser.feed(STREAM.data(), STREAM.size()), 0u);
+    EXPECT_TRUE(m_parser.hasError());
+}
+
+}  // namespace test
+}  // namespace acl
+}  // namespace alexaClientSDK
@@ -84,9 +84,10 @@ MessageInterpreter::MessageInterpreter(
 }
 
 void MessageInterpreter::receive(const std::string& contextId, const std::string& message) {
-    Document document;
+    // The parsed message is shared with the directive, so that handlers can read its payload without parsing it again.
+    auto document = std::make_shared<Document>();
 
-    if (!parseJSON(message, &document)) {
+    if (!parseJSON(message, document.get())) {
         const std::string error = "Parsing JSON Document failed";
         sendExceptionEncounteredHelper(m_exceptionEncounteredSender, message, error);
         return;
@@ -94,7 +95,7 @@ void MessageInterpreter::receive(const std::string& contextId, const std::string
 
     // Get iterator to child nodes
     Value::ConstMemberIterator directiveIt;
-    if (!findNode(document, JSON_MESSAGE_DIRECTIVE_KEY, &directiveIt)) {
+    if (!findNode(*document, JSON_MESSAGE_DIRECTIVE_KEY, &directiveIt)) {
         sendParseValueException(JSON_MESSAGE_DIRECTIVE_KEY, message);
         return;
     }
@@ -105,13 +106,20 @@ void MessageInterpreter::receive(const std::string& contextId, const std::string
         return;
     }
 
-    // Retrieve values
+    Value::ConstMemberIterator payloadIt;
+    if (!findNode(directiveIt->value, JSON_MESSAGE_PAYLOAD_KEY, &payloadIt)) {
+        sendParseValueException(JSON_MESSAGE_PAYLOAD_KEY, message);
+        return;
+    }
+
+    // A payload which is an object is shared in place.  Any other payload is handed over as a string, as before.
     std::string payload;
-    if (!retrieveValue(directiveIt->value, JSON_MESSAGE_PAYLOAD_KEY, &payload)) {
+    if (!payloadIt->value.IsObject() && !convertToValue(payloadIt->value, &payload)) {
         sendParseValueException(JSON_MESSAGE_PAYLOAD_KEY, message);
         return;
     }
 
+    // Retrieve values
     std::string avsNamespace;
     if (!retrieveValue(headerIt->value, JSON_MESSAGE_NAMESPACE_KEY, &avsNamespace)) {
         sendParseValueException(JSON_MESSAGE_NAMESPACE_KEY, message);
@@ -141,8 +149,13 @@ void MessageInterpreter::receive(const std::string& contextId, const std::string
     }
 
     auto avsMessageHeader = std::make_shared<AVSMessageHeader>(avsNamespace, avsName, avsMessageId, avsDialogRequestId);
-    std::shared_ptr<AVSDirective> avsDirective =
-        AVSDirective::create(message, avsMessageHeader, payload, m_attachmentManager, contextId);
+    std::shared_ptr<AVSDirective> avsDirective;
+    if (payloadIt->value.IsObject()) {
+        avsDirective = AVSDirective::create(
+            message, document, payloadIt->value, avsMessageHeader, m_attachmentManager, contextId);
+    } else {
+        avsDirective = AVSDirective::create(message, avsMessageHeader, payload, m_attachmentManager, contextId);
+    }
     if (!avsDirective) {
         const std::string errorDescription = "AVSDirective is nullptr, failed to send to DirectiveSequencer";
         ACSDK_ERROR(LX("receiveFailed").d("reason", "createAvsDirectiveFailed"));
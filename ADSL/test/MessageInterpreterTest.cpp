@@ -315,6 +315,13 @@ TEST_F(MessageIntepreterTest, messageIsValidDirective) {
             EXPECT_EQ(avsDirective->getName(), NAME_TEST);
             EXPECT_EQ(avsDirective->getMessageId(), MESSAGE_ID_TEST);
             EXPECT_EQ(avsDirective->getDialogRequestId(), DIALOG_REQUEST_ID_TEST);
+            auto payload = avsDirective->getPayloadValue();
+            EXPECT_NE(payload, nullptr);
+            if (payload) {
+                EXPECT_TRUE(payload->IsObject());
+                EXPECT_EQ(std::string((*payload)["token"].GetString()), "testToken");
+            }
+            EXPECT_EQ(avsDirective->getPayload(), PAYLOAD_TEST);
             return true;
         }));
     m_messageInterpreter->receive(TEST_ATTACHMENT_CONTEXT_ID, SPEAK_DIRECTIVE);
@@ -84,12 +84,12 @@ void AudioActivityTracker::provideState(
     const avsCommon::avs::NamespaceAndName& stateProviderName,
     unsigned int stateRequestToken) {
     ACSDK_DEBUG5(LX("provideState"));
-    m_executor.submit([this, stateRequestToken]() { executeProvideState(stateRequestToken); });
+    m_executor.execute([this, stateRequestToken]() { executeProvideState(stateRequestToken); });
 }
 
 void AudioActivityTracker::notifyOfActivityUpdates(const std::vector<Channel::State>& channelStates) {
     ACSDK_DEBUG5(LX("notifyOfActivityUpdates"));
-    m_executor.submit([this, channelStates]() { executeNotifyOfActivityUpdates(channelStates); });
+    m_executor.execute([this, channelStates]() { executeNotifyOfActivityUpdates(channelStates); });
 }
 
 AudioActivityTracker::AudioActivityTracker(
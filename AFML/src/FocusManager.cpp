@@ -72,7 +72,7 @@ bool FocusManager::acquireChannel(
         return false;
     }
 
-    m_executor.submit([this, channelToAcquire, channelObserver, interface]() {
+    m_executor.execute([this, channelToAcquire, channelObserver, interface]() {
         acquireChannelHelper(channelToAcquire, channelObserver, interface);
     });
     return true;
@@ -93,7 +93,7 @@ std::future<bool> FocusManager::releaseChannel(
         return returnValue;
     }
 
-    m_executor.submit([this, channelToRelease, channelObserver, releaseChannelSuccess, channelName]() {
+    m_executor.execute([this, channelToRelease, channelObserver, releaseChannelSuccess, channelName]() {
         releaseChannelHelper(channelToRelease, channelObserver, releaseChannelSuccess, channelName);
     });
 
@@ -81,7 +81,7 @@ void VisualActivityTracker::provideState(
     const avsCommon::avs::NamespaceAndName& stateProviderName,
     unsigned int stateRequestToken) {
     ACSDK_DEBUG5(LX("provideState"));
-    m_executor.submit([this, stateRequestToken]() { executeProvideState(stateRequestToken); });
+    m_executor.execute([this, stateRequestToken]() { executeProvideState(stateRequestToken); });
 }
 
 void VisualActivityTracker::notifyOfActivityUpdates(const std::vector<Channel::State>& channels) {
@@ -103,7 +103,7 @@ void VisualActivityTracker::notifyOfActivityUpdates(const std::vector<Channel::S
         }
     }
 
-    m_executor.submit([this, channels]() {
+    m_executor.execute([this, channels]() {
         // The last element of the vector is the most recent channel state.
         m_channelState = channels.back();
     });
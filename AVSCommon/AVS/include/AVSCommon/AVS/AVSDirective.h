@@ -17,8 +17,11 @@
 #define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_AVSDIRECTIVE_H_
 
 #include <memory>
+#include <mutex>
 #include <string>
 
+#include <rapidjson/document.h>
+
 #include "Attachment/AttachmentManagerInterface.h"
 #include "AVSMessage.h"
 
@@ -28,6 +31,10 @@ namespace avs {
 
 /**
  * A class representation of the AVS directive.
+ *
+ * A directive may be created from an already parsed JSON document, in which case its payload is shared, read-only,
+ * by every handler through @c getPayloadValue(), and @c getPayload() serializes it only if asked to.  A directive
+ * created from a payload string parses it the first time @c getPayloadValue() is called.
  */
 class AVSDirective : public AVSMessage {
 public:
@@ -48,6 +55,41 @@ public:
         std::shared_ptr<avsCommon::avs::attachment::AttachmentManagerInterface> attachmentManager,
         const std::string& attachmentContextId);
 
+    /**
+     * Create an AVSDirective object whose payload is a node of an already parsed JSON document.
+     *
+     * @param unparsedDirective The unparsed directive JSON string from AVS.
+     * @param document The parsed directive.  It is shared by the created directive and must not be modified.
+     * @param payload The payload of the directive.  This must be an object within @c document.
+     * @param avsMessageHeader The header fields of the directive.
+     * @param attachmentManager The attachment manager.
+     * @param attachmentContextId The contextId required to get attachments from the AttachmentManager.
+     * @return The created AVSDirective object or @c nullptr if creation failed.
+     */
+    static std::unique_ptr<AVSDirective> create(
+        const std::string& unparsedDirective,
+        std::shared_ptr<const rapidjson::Document> document,
+        const rapidjson::Value& payload,
+        std::shared_ptr<AVSMessageHeader> avsMessageHeader,
+        std::shared_ptr<avsCommon::avs::attachment::AttachmentManagerInterface> attachmentManager,
+        const std::string& attachmentContextId);
+
+    /**
+     * Returns the payload of the directive as a string.  If the directive was created from a parsed document, the
+     * payload is serialized on the first call.  Handlers should prefer @c getPayloadValue().
+     *
+     * @return The payload.
+     */
+    std::string getPayload() const override;
+
+    /**
+     * Returns the parsed payload of the directive.  The value is shared by everyone handling the directive, and
+     * remains valid for the lifetime of the directive.
+     *
+     * @return The parsed payload, or @c nullptr if the payload is not valid JSON.
+     */
+    const rapidjson::Value* getPayloadValue() const;
+
     /**
      * Returns a reader for the attachment associated with this directive.
      *
@@ -81,8 +123,42 @@ private:
         std::shared_ptr<avsCommon::avs::attachment::AttachmentManagerInterface> attachmentManager,
         const std::string& attachmentContextId);
 
+    /**
+     * Constructor.
+     *
+     * @param unparsedDirective The unparsed directive JSON string from AVS.
+     * @param document The parsed directive.
+     * @param payload The payload of the directive, within @c document.
+     * @param avsMessageHeader The object representation of an AVS message header.
+     * @param attachmentManager The attachment manager object.
+     * @param attachmentContextId The contextId required to get attachments from the AttachmentManager.
+     */
+    AVSDirective(
+        const std::string& unparsedDirective,
+        std::shared_ptr<const rapidjson::Document> document,
+        const rapidjson::Value* payload,
+        std::shared_ptr<AVSMessageHeader> avsMessageHeader,
+        std::shared_ptr<avsCommon::avs::attachment::AttachmentManagerInterface> attachmentManager,
+        const std::string& attachmentContextId);
+
+    /**
+     * Produce whichever representation of the payload the directive was not created with.  This is called at most
+     * once, through @c m_payloadConversionFlag.
+     */
+    void convertPayload() const;
+
     /// The unparsed directive JSON string from AVS.
     const std::string m_unparsedDirective;
+    /// Whether the directive was created from a parsed document.
+    const bool m_isCreatedFromDocument;
+    /// Guards the one-time conversion of the payload into the representation the directive was not created with.
+    mutable std::once_flag m_payloadConversionFlag;
+    /// The document holding @c m_payloadValue.
+    mutable std::shared_ptr<const rapidjson::Document> m_document;
+    /// The parsed payload, within @c m_document.
+    mutable const rapidjson::Value* m_payloadValue;
+    /// The serialized payload, if the directive was created from a parsed document.
+    mutable std::string m_serializedPayload;
     /// The attachmentManager.
     std::shared_ptr<avsCommon::avs::attachment::AttachmentManagerInterface> m_attachmentManager;
     /// The contextId needed to acquire the right attachment from the attachmentManager.
@@ -78,7 +78,7 @@ public:
      *
      * @return The payload.
      */
-    std::string getPayload() const;
+    virtual std::string getPayload() const;
 
     /**
      * Return a string representation of this @c AVSMessage's header.
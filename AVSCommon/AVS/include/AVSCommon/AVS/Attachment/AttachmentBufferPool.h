@@ -0,0 +1,180 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_ATTACHMENTBUFFERPOOL_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_ATTACHMENTBUFFERPOOL_H_
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+#include "AVSCommon/Utils/SDS/InProcessSDS.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+/**
+ * A pool of the buffers behind @c InProcessAttachments.
+ *
+ * Every attachment used to allocate, and zero, a buffer of its own, so back-to-back dialogs churned megabytes through
+ * the allocator and page faults.  Buffers from the pool instead go back to it once the last @c SharedDataStream using
+ * them is destroyed, which is when the attachment and its last reader and writer are gone, and are handed out again
+ * without being cleared: @c SharedDataStream::create() initializes the header it needs, and data is only read after
+ * it has been written.
+ *
+ * Buffers are pooled by size class.  The creator of an attachment names the class with a @c SizeHint, or asks for a
+ * size of its own, which then forms a class of its own.  A buffer is only allocated when its class has no idle
+ * buffer, so the memory of a class is committed when the class is first used rather than up front, and the idle
+ * buffers kept for reuse are capped.
+ */
+class AttachmentBufferPool : public std::enable_shared_from_this<AttachmentBufferPool> {
+public:
+    /// The kinds of content an attachment may hold, which set the size of its buffer.
+    enum class SizeHint {
+        /// A short sound, such as an earcon.
+        SHORT_SOUND,
+        /// Speech, such as a @c Speak directive's audio.
+        SPEECH,
+        /// A media stream, such as music or a station, which is read as it is written.
+        MEDIA_STREAM
+    };
+
+    /// Statistics about the use of the pool.
+    struct Statistics {
+        /// The number of buffers allocated.
+        size_t buffersAllocated;
+        /// The number of buffers handed out again from the pool.
+        size_t buffersReused;
+        /// The number of buffers in use.
+        size_t buffersInUse;
+        /// The total size of the idle buffers kept for reuse.
+        size_t idleBytes;
+    };
+
+    /// The default cap on the total size of the idle buffers.
+    static const size_t DEFAULT_MAX_IDLE_BYTES;
+
+    /**
+     * Create an AttachmentBufferPool.
+     *
+     * @param maxIdleBytes The cap on the total size of the idle buffers kept for reuse.
+     * @return The new @c AttachmentBufferPool.
+     */
+    static std::shared_ptr<AttachmentBufferPool> create(size_t maxIdleBytes = DEFAULT_MAX_IDLE_BYTES);
+
+    /**
+     * Returns the pool which attachments use unless they are given one.
+     *
+     * @return The default pool.
+     */
+    static std::shared_ptr<AttachmentBufferPool> getDefaultPool();
+
+    /**
+     * Returns the size of the data an attachment of a size class can hold.
+     *
+     * @param hint The size class.
+     * @return The size of the data, in bytes.
+     */
+    static size_t getDataSize(SizeHint hint);
+
+    /**
+     * Create a @c SharedDataStream on a buffer from the pool.
+     *
+     * @param hint The size class of the buffer.
+     * @return The new stream, or @c nullptr if the operation fails.
+     */
+    std::unique_ptr<utils::sds::InProcessSDS> createSDS(SizeHint hint);
+
+    /**
+     * Create a @c SharedDataStream on a buffer from the pool, which can hold a given size of data.
+     *
+     * @param dataSize The size of the data the stream can hold, in bytes.
+     * @return The new stream, or @c nullptr if the operation fails.
+     */
+    std::unique_ptr<utils::sds::InProcessSDS> createSDS(size_t dataSize);
+
+    /**
+     * Returns statistics about the use of the pool.
+     *
+     * @return The statistics.
+     */
+    Statistics getStatistics();
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param maxIdleBytes The cap on the total size of the idle buffers kept for reuse.
+     */
+    AttachmentBufferPool(size_t maxIdleBytes);
+
+    /**
+     * Takes an idle buffer of a given size, or allocates one.
+     *
+     * @param bufferSize The size of the buffer, in bytes.
+     * @return The buffer, which comes back to the pool when the last reference to it is released.
+     */
+    std::shared_ptr<utils::sds::InProcessSDS::Buffer> acquireBuffer(size_t bufferSize);
+
+    /**
+     * Takes back a buffer which is no longer used, or frees it if the pool is full.
+     *
+     * @param buffer The buffer.
+     */
+    void releaseBuffer(utils::sds::InProcessSDS::Buffer* buffer);
+
+    /// The cap on the total size of the idle buffers.
+    const size_t m_maxIdleBytes;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// The idle buffers, by size.
+    std::unordered_map<size_t, std::vector<std::unique_ptr<utils::sds::InProcessSDS::Buffer>>> m_idleBuffers;
+
+    /// Statistics about the use of the pool.
+    Statistics m_statistics;
+};
+
+/**
+ * Write a @c SizeHint value to an @c ostream as a string.
+ *
+ * @param stream The stream to write the value to.
+ * @param hint The value to write to the @c ostream as a string.
+ * @return The @c ostream that was passed in and written to.
+ */
+inline std::ostream& operator<<(std::ostream& stream, AttachmentBufferPool::SizeHint hint) {
+    switch (hint) {
+        case AttachmentBufferPool::SizeHint::SHORT_SOUND:
+            return stream << "SHORT_SOUND";
+        case AttachmentBufferPool::SizeHint::SPEECH:
+            return stream << "SPEECH";
+        case AttachmentBufferPool::SizeHint::MEDIA_STREAM:
+            return stream << "MEDIA_STREAM";
+    }
+    return stream << "UNKNOWN";
+}
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_ATTACHMENTBUFFERPOOL_H_
@@ -19,6 +19,7 @@
 #include <mutex>
 #include <unordered_map>
 
+#include "AVSCommon/AVS/Attachment/AttachmentBufferPool.h"
 #include "AVSCommon/AVS/Attachment/AttachmentManagerInterface.h"
 
 namespace alexaClientSDK {
@@ -75,8 +76,10 @@ public:
      * Constructor.
      *
      * @param attachmentType The type of attachments which will be managed.
+     * @param bufferPool The pool of the buffers of @c IN_PROCESS attachments, which hold speech.  If not specified,
+     *     then the default pool is used.
      */
-    AttachmentManager(AttachmentType attachmentType);
+    AttachmentManager(AttachmentType attachmentType, std::shared_ptr<AttachmentBufferPool> bufferPool = nullptr);
 
     std::string generateAttachmentId(const std::string& contextId, const std::string& contentId) const override;
 
@@ -125,6 +128,8 @@ private:
 
     /// The type of attachments that this manager will create.
     AttachmentType m_attachmentType;
+    /// The pool of the buffers of @c IN_PROCESS attachments.
+    std::shared_ptr<AttachmentBufferPool> m_bufferPool;
     /// The timeout in minutes.  Any attachment whose lifetime exceeds this value will be released.
     std::chrono::minutes m_attachmentExpirationMinutes;
     /// The mutex to ensure the non-static public APIs are thread safe.
@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cstddef>
+#include <functional>
 
 #include "AVSCommon/Utils/SDS/ReaderPolicy.h"
 
@@ -103,6 +104,18 @@ public:
      * @param closePoint The point at which the reader should stop reading from the attachment.
      */
     virtual void close(ClosePoint closePoint = ClosePoint::AFTER_DRAINING_CURRENT_BUFFER) = 0;
+
+    /**
+     * Set a function to be called whenever data may have become available to read, so that a caller which does not
+     * block in @c read() can resume reading without polling.  The function is called from the thread which produced
+     * the data and must return quickly.  An empty function removes any function previously set.
+     *
+     * @param callback The function to call when data may be available.
+     * @return Whether this reader supports the callback.  The default implementation does not.
+     */
+    virtual bool setDataAvailableCallback(std::function<void()> callback) {
+        return false;
+    }
 };
 
 }  // namespace attachment
@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cstddef>
+#include <functional>
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -75,6 +76,18 @@ public:
      * needs to use an attachment.
      */
     virtual void close() = 0;
+
+    /**
+     * Set a function to be called whenever space may have become available to write, so that a caller which does not
+     * block in @c write() can resume writing without polling.  The function is called from the thread which consumed
+     * the data and must return quickly.  An empty function removes any function previously set.
+     *
+     * @param callback The function to call when space may be available.
+     * @return Whether this writer supports the callback.  The default implementation does not.
+     */
+    virtual bool setSpaceAvailableCallback(std::function<void()> callback) {
+        return false;
+    }
 };
 
 }  // namespace attachment
@@ -17,6 +17,7 @@
 #define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_INPROCESSATTACHMENT_H_
 
 #include "AVSCommon/AVS/Attachment/Attachment.h"
+#include "AVSCommon/AVS/Attachment/AttachmentBufferPool.h"
 #include "AVSCommon/AVS/Attachment/InProcessAttachmentReader.h"
 #include "AVSCommon/AVS/Attachment/InProcessAttachmentWriter.h"
 
@@ -43,10 +44,23 @@ public:
      * Constructor.
      *
      * @param id The attachment id.
-     * @param sds The underlying @c SharedDataStream object.  If not specified, then this class will create its own.
+     * @param sds The underlying @c SharedDataStream object.  If not specified, then this class will create its own,
+     *     of @c SDS_BUFFER_DEFAULT_SIZE_IN_BYTES, on a buffer from the default @c AttachmentBufferPool.
      */
     InProcessAttachment(const std::string& id, std::unique_ptr<SDSType> sds = nullptr);
 
+    /**
+     * Constructor, which creates the underlying @c SharedDataStream on a buffer from a pool.
+     *
+     * @param id The attachment id.
+     * @param hint The size class of the buffer.
+     * @param pool The pool of the buffer.  If not specified, then the default pool is used.
+     */
+    InProcessAttachment(
+        const std::string& id,
+        AttachmentBufferPool::SizeHint hint,
+        std::shared_ptr<AttachmentBufferPool> pool = nullptr);
+
     std::unique_ptr<AttachmentWriter> createWriter(
         InProcessAttachmentWriter::SDSTypeWriter::Policy policy =
             InProcessAttachmentWriter::SDSTypeWriter::Policy::ALL_OR_NOTHING) override;
@@ -54,6 +68,9 @@ public:
     std::unique_ptr<AttachmentReader> createReader(InProcessAttachmentReader::SDSTypeReader::Policy policy) override;
 
 private:
+    /// Creates a @c SharedDataStream of its own if none was given, or pooling failed.
+    void createDefaultSDSIfNeeded();
+
     // The sds from which we will create the reader and writer.
     std::shared_ptr<SDSType> m_sds;
 };
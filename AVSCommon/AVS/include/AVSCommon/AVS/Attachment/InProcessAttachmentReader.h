@@ -18,6 +18,9 @@
 
 #include "AVSCommon/Utils/SDS/InProcessSDS.h"
 #include "AVSCommon/Utils/SDS/Reader.h"
+#ifdef SHARED_MEMORY_SDS
+#include "AVSCommon/Utils/SDS/SharedMemorySDS.h"
+#endif
 
 #include "AttachmentReader.h"
 
@@ -27,39 +30,46 @@ namespace avs {
 namespace attachment {
 
 /**
- * A class that provides functionality to read data from an @c Attachment following an in-process memory management
- * model.
+ * A class that provides functionality to read data from an @c Attachment backed by a @c SharedDataStream.  It is
+ * instantiated for @c InProcessSDS, as @c InProcessAttachmentReader, and where it is available for
+ * @c SharedMemorySDS, so that an @c AudioInputStream of either type can be sent as an attachment.
  *
  * @note This class is not thread-safe beyond the thread-safety provided by the underlying SharedDataStream object.
+ *
+ * @tparam SDSTypeT The type of the underlying @c SharedDataStream.
  */
-class InProcessAttachmentReader : public AttachmentReader {
+template <typename SDSTypeT>
+class SDSAttachmentReader : public AttachmentReader {
 public:
     /// Type aliases for convenience.
-    using SDSType = avsCommon::utils::sds::InProcessSDS;
-    using SDSTypeIndex = avsCommon::utils::sds::InProcessSDS::Index;
-    using SDSTypeReader = SDSType::Reader;
+    using SDSType = SDSTypeT;
+    using SDSTypeIndex = typename SDSType::Index;
+    using SDSTypeReader = typename SDSType::Reader;
+
+    /// A contiguous region of the attachment's buffer, as returned by @c peek().
+    using Span = typename SDSTypeReader::Span;
 
     /**
-     * Create an InProcessAttachmentReader.
+     * Create an SDSAttachmentReader.
      *
      * @param policy The policy this reader should adhere to.
      * @param sds The underlying @c SharedDataStream which this object will use.
      * @param index If being constructed from an existing @c SharedDataStream, the index indicates where to read from.
      * @param reference The position in the stream @c offset is applied to.  This parameter defaults to 0, indicating
      *     no offset from the specified reference.
-     * @return Returns a new InProcessAttachmentReader, or nullptr if the operation failed.  This parameter defaults
+     * @return Returns a new SDSAttachmentReader, or nullptr if the operation failed.  This parameter defaults
      *     to @c ABSOLUTE, indicating offset is relative to the very beginning of the Attachment.
      */
-    static std::unique_ptr<InProcessAttachmentReader> create(
-        SDSTypeReader::Policy policy,
+    static std::unique_ptr<SDSAttachmentReader> create(
+        typename SDSTypeReader::Policy policy,
         std::shared_ptr<SDSType> sds,
         SDSTypeIndex offset = 0,
-        SDSTypeReader::Reference reference = SDSTypeReader::Reference::ABSOLUTE);
+        typename SDSTypeReader::Reference reference = SDSTypeReader::Reference::ABSOLUTE);
 
     /**
      * Destructor.
      */
-    ~InProcessAttachmentReader();
+    ~SDSAttachmentReader();
 
     std::size_t read(
         void* buf,
@@ -67,12 +77,45 @@ public:
         ReadStatus* readStatus,
         std::chrono::milliseconds timeoutMs = std::chrono::milliseconds(0)) override;
 
+    /**
+     * Provides in-place access to up to @c numBytes of unread data, without copying or consuming it, as up to two
+     * spans inside the attachment's buffer.  The data must then be consumed with @c commit().  See
+     * @c SharedDataStream::Reader::peek().
+     *
+     * @note Span lengths are in words of the underlying stream, which are bytes for an @c InProcessAttachment.
+     *
+     * @param first Returns the span starting at this reader's position.
+     * @param second Returns the span which continues from the start of the buffer, or an empty span.
+     * @param numBytes The maximum number of bytes to return.
+     * @param readStatus The out-parameter where the resulting state of the read will be expressed, as for @c read().
+     * @param timeoutMs As for @c read().
+     * @return The number of bytes in the two spans.
+     */
+    std::size_t peek(
+        Span* first,
+        Span* second,
+        std::size_t numBytes,
+        ReadStatus* readStatus,
+        std::chrono::milliseconds timeoutMs = std::chrono::milliseconds(0));
+
+    /**
+     * Consumes data previously returned by @c peek().
+     *
+     * @param numBytes The number of bytes to consume.  This must not exceed the number returned by @c peek().
+     * @param readStatus The out-parameter where the resulting state will be expressed.  It is @c ERROR_OVERRUN if the
+     *     data was overwritten before it was consumed.
+     * @return The number of bytes consumed.
+     */
+    std::size_t commit(std::size_t numBytes, ReadStatus* readStatus);
+
     void close(ClosePoint closePoint = ClosePoint::AFTER_DRAINING_CURRENT_BUFFER) override;
 
     bool seek(uint64_t offset) override;
 
     uint64_t getNumUnreadBytes() override;
 
+    bool setDataAvailableCallback(std::function<void()> callback) override;
+
 private:
     /**
      * Constructor.
@@ -80,12 +123,61 @@ private:
      * @param policy The @c ReaderPolicy of this object.
      * @param sds The underlying @c SharedDataStream which this object will use.
      */
-    InProcessAttachmentReader(SDSTypeReader::Policy policy, std::shared_ptr<SDSType> sds);
+    SDSAttachmentReader(typename SDSTypeReader::Policy policy, std::shared_ptr<SDSType> sds);
+
+    /**
+     * Validates the arguments shared by @c read() and @c peek(), and sets @c readStatus accordingly.
+     *
+     * @param numBytes The number of bytes requested.
+     * @param readStatus The out-parameter to set.
+     * @param timeoutMs The timeout requested.
+     * @param[out] numWords Returns the number of words to request from the underlying stream.
+     * @return Whether the read should proceed.
+     */
+    bool prepareRead(
+        std::size_t numBytes,
+        ReadStatus* readStatus,
+        std::chrono::milliseconds timeoutMs,
+        std::size_t* numWords);
+
+    /**
+     * Converts the result of an operation on the underlying stream reader to a number of bytes and a @c ReadStatus.
+     *
+     * @param readResult The number of words processed, or the @c SDSTypeReader::Error.
+     * @param readStatus The out-parameter to set.
+     * @return The number of bytes processed.
+     */
+    std::size_t toBytes(ssize_t readResult, ReadStatus* readStatus);
+
+    /**
+     * Observer of the underlying @c SharedDataStream which calls @c m_dataAvailableCallback.
+     *
+     * @param context The @c SDSAttachmentReader to notify.
+     */
+    static void onDataAvailable(void* context);
 
     /// The underlying @c SharedDataStream reader.
     std::shared_ptr<SDSTypeReader> m_reader;
+
+    /**
+     * The function to call when data may be available.  It is only modified while @c onDataAvailable() is not
+     * registered with @c m_reader, so it needs no lock of its own.
+     */
+    std::function<void()> m_dataAvailableCallback;
 };
 
+/// A reader of an @c Attachment following an in-process memory management model.
+using InProcessAttachmentReader = SDSAttachmentReader<utils::sds::InProcessSDS>;
+
+extern template class SDSAttachmentReader<utils::sds::InProcessSDS>;
+
+#ifdef SHARED_MEMORY_SDS
+/// A reader of an @c Attachment whose data is in memory shared between processes.
+using SharedMemoryAttachmentReader = SDSAttachmentReader<utils::sds::SharedMemorySDS>;
+
+extern template class SDSAttachmentReader<utils::sds::SharedMemorySDS>;
+#endif
+
 }  // namespace attachment
 }  // namespace avs
 }  // namespace avsCommon
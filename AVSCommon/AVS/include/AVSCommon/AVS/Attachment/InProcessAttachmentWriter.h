@@ -37,6 +37,9 @@ public:
     using SDSType = avsCommon::utils::sds::InProcessSDS;
     using SDSTypeWriter = SDSType::Writer;
 
+    /// A contiguous region of the attachment's buffer, as returned by @c reserve().
+    using Span = SDSTypeWriter::Span;
+
     /**
      * Create an InProcessAttachmentWriter.
      *
@@ -59,8 +62,41 @@ public:
         WriteStatus* writeStatus,
         std::chrono::milliseconds timeout = std::chrono::milliseconds(0)) override;
 
+    /**
+     * Reserves up to @c numBytes of space at the end of the attachment to be filled in place, as up to two spans
+     * inside the attachment's buffer.  The data must then be published with @c commit().  See
+     * @c SharedDataStream::Writer::reserve().
+     *
+     * @note Span lengths are in words of the underlying stream, which are bytes for an @c InProcessAttachment.
+     *
+     * @param first Returns the span starting at this writer's position.
+     * @param second Returns the span which continues from the start of the buffer, or an empty span.
+     * @param numBytes The maximum number of bytes to reserve.
+     * @param writeStatus The out-parameter where the resulting state of the write will be expressed, as for
+     *     @c write().
+     * @param timeout As for @c write().
+     * @return The number of bytes in the two spans.
+     */
+    std::size_t reserve(
+        Span* first,
+        Span* second,
+        std::size_t numBytes,
+        WriteStatus* writeStatus,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+    /**
+     * Publishes data written in place after a @c reserve().
+     *
+     * @param numBytes The number of bytes to publish.  This must not exceed the number returned by @c reserve().
+     * @param writeStatus The out-parameter where the resulting state will be expressed.
+     * @return The number of bytes published.
+     */
+    std::size_t commit(std::size_t numBytes, WriteStatus* writeStatus);
+
     void close() override;
 
+    bool setSpaceAvailableCallback(std::function<void()> callback) override;
+
 protected:
     /**
      * Constructor.
@@ -72,8 +108,40 @@ protected:
         std::shared_ptr<SDSType> sds,
         SDSTypeWriter::Policy policy = SDSTypeWriter::Policy::ALL_OR_NOTHING);
 
+    /**
+     * Observer of the underlying @c SharedDataStream which calls @c m_spaceAvailableCallback.
+     *
+     * @param context The @c InProcessAttachmentWriter to notify.
+     */
+    static void onSpaceAvailable(void* context);
+
+    /**
+     * Validates the arguments shared by @c write() and @c reserve(), and sets @c writeStatus accordingly.
+     *
+     * @param numBytes The number of bytes requested.
+     * @param writeStatus The out-parameter to set.
+     * @param[out] numWords Returns the number of words to request from the underlying stream.
+     * @return Whether the write should proceed.
+     */
+    bool prepareWrite(std::size_t numBytes, WriteStatus* writeStatus, std::size_t* numWords);
+
+    /**
+     * Converts the result of an operation on the underlying stream writer to a number of bytes and a @c WriteStatus.
+     *
+     * @param writeResult The number of words processed, or the @c SDSTypeWriter::Error.
+     * @param writeStatus The out-parameter to set.
+     * @return The number of bytes processed.
+     */
+    std::size_t toBytes(ssize_t writeResult, WriteStatus* writeStatus);
+
     /// The underlying @c SharedDataStream reader.
     std::shared_ptr<SDSTypeWriter> m_writer;
+
+    /**
+     * The function to call when space may be available.  It is only modified while @c onSpaceAvailable() is not
+     * registered with @c m_writer, so it needs no lock of its own.
+     */
+    std::function<void()> m_spaceAvailableCallback;
 };
 
 }  // namespace attachment
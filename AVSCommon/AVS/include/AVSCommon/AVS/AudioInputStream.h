@@ -16,14 +16,27 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_AUDIOINPUTSTREAM_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_AUDIOINPUTSTREAM_H_
 
+#ifdef SHARED_MEMORY_AUDIO_INPUT_STREAM
+#include "AVSCommon/Utils/SDS/SharedMemorySDS.h"
+#else
 #include "AVSCommon/Utils/SDS/InProcessSDS.h"
+#endif
 
 namespace alexaClientSDK {
 namespace avsCommon {
 namespace avs {
 
+#ifdef SHARED_MEMORY_AUDIO_INPUT_STREAM
+/**
+ * The type used store and stream binary data.  It works between processes, so the SDK can attach to a stream which
+ * another process writes with @c AudioInputStream::open(), given a @c SharedMemoryBuffer opened by name.  Streams which
+ * the SDK creates itself, from a @c Buffer constructed with a size, are in anonymous memory private to this process.
+ */
+using AudioInputStream = utils::sds::SharedMemorySDS;
+#else
 /// The type used store and stream binary data.
 using AudioInputStream = utils::sds::InProcessSDS;
+#endif
 
 }  // namespace avs
 }  // namespace avsCommon
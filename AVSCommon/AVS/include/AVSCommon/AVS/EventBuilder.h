@@ -23,12 +23,44 @@ namespace alexaClientSDK {
 namespace avsCommon {
 namespace avs {
 
+/**
+ * Builds the start of a JSON event string, which includes the header and an optional @c context but not the payload.
+ * The result is completed with @c completeJsonEventString() once the payload is known, so that an event whose payload
+ * is only known at the last moment can be assembled ahead of time.  The message Id required for the header is a
+ * random string that is generated and added to the header.
+ *
+ * @param nameSpace The namespace of the event to be included in the header.
+ * @param eventName The name of the event to be include in the header.
+ * @param dialogRequestIdValue The value associated with the "dialogRequestId" key.
+ * @param jsonContext Optional @c context to be sent with the event message.
+ * @return A pair object consisting of the messageId and the start of the event JSON string if successful,
+ * else a pair of empty strings.
+ */
+const std::pair<std::string, std::string> buildJsonEventPrefix(
+    const std::string& nameSpace,
+    const std::string& eventName,
+    const std::string& dialogRequestIdValue = "",
+    const std::string& jsonContext = "");
+
+/**
+ * Completes a JSON event string started by @c buildJsonEventPrefix() with its payload.  The payload is checked to be
+ * well formed JSON, and is then copied verbatim into the event string.
+ *
+ * @param eventPrefix The start of the event JSON string, as built by @c buildJsonEventPrefix().
+ * @param jsonPayloadValue The payload value associated with the "payload" key.
+ * @return The event JSON string if successful, else an empty string.
+ */
+std::string completeJsonEventString(std::string eventPrefix, const std::string& jsonPayloadValue = "{}");
+
 /**
  * Builds a JSON event string which includes the header, the @c payload and an optional @c context.
  * The header includes the namespace, name, message Id and an optional @c dialogRequestId.
  * The message Id required for the header is a random string that is generated and added to the
  * header.
  *
+ * The @c payload and @c context are checked to be well formed JSON, and are then copied verbatim into the event
+ * string rather than parsed and serialized again, so their formatting is kept.
+ *
  * @param eventName The name of the event to be include in the header.
  * @param dialogRequestIdString The value associated with the "dialogRequestId" key.
  * @param payload The payload value associated with the "payload" key.
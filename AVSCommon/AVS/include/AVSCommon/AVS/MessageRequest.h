@@ -16,9 +16,11 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_MESSAGEREQUEST_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_MESSAGEREQUEST_H_
 
+#include <chrono>
 #include <cstdlib>
 #include <memory>
 #include <mutex>
+#include <ostream>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -36,6 +38,22 @@ namespace avs {
  */
 class MessageRequest {
 public:
+    /**
+     * The priority classes of messages.  A transport sends all queued messages of a higher priority before any queued
+     * message of a lower priority.
+     */
+    enum class Priority {
+        /// Messages which the user is waiting for, such as @c SpeechRecognizer.Recognize.
+        INTERACTIVE,
+        /// Messages which report state changes, such as playback progress.  This is the default.
+        NORMAL,
+        /// Messages which may be delayed without the user noticing, such as retries, reports and settings.
+        BACKGROUND
+    };
+
+    /// The number of values of @c Priority.
+    static constexpr size_t NUM_PRIORITIES = 3;
+
     /// A struct to hold an @c AttachmentReader alongside its name.
     struct NamedReader {
         /**
@@ -95,6 +113,55 @@ public:
      */
     std::string getUriPathExtension();
 
+    /**
+     * Sets the key which orders this message relative to other messages.  A transport which sends several messages
+     * concurrently will not start sending this message until every message with the same key which was queued before
+     * it has been accepted by AVS.  This should be called before the message is handed to the transport.
+     *
+     * @param orderingKey The ordering key for this message.
+     */
+    void setOrderingKey(const std::string& orderingKey);
+
+    /**
+     * Retrieves the key which orders this message relative to other messages.  Unless one has been set with
+     * @c setOrderingKey(), this is the namespace of the event in the JSON content, so that events from a given
+     * capability are sent in the order they were queued.  The namespace is read from the header on the first call and
+     * cached, so messages whose ordering key is never needed are not scanned.
+     *
+     * @return The ordering key for this message.
+     */
+    std::string getOrderingKey();
+
+    /**
+     * Sets the priority class of this message.  This should be called before the message is handed to the transport.
+     *
+     * @param priority The priority class of this message.
+     */
+    void setPriority(Priority priority);
+
+    /**
+     * Retrieves the priority class of this message.
+     *
+     * @return The priority class of this message, which is @c Priority::NORMAL unless set with @c setPriority().
+     */
+    Priority getPriority();
+
+    /**
+     * Sets the time by which this message must have started to be sent.  If it is still queued at that time, the
+     * transport will drop it and complete it with @c Status::TIMEDOUT.  This should be called before the message is
+     * handed to the transport.
+     *
+     * @param deadline The time by which this message must have started to be sent.
+     */
+    void setDeadline(std::chrono::steady_clock::time_point deadline);
+
+    /**
+     * Retrieves the time by which this message must have started to be sent.
+     *
+     * @return The deadline of this message, or @c std::chrono::steady_clock::time_point::max() if it has none.
+     */
+    std::chrono::steady_clock::time_point getDeadline();
+
     /**
      * Gets the number of @c AttachmentReaders in this message.
      *
@@ -159,10 +226,44 @@ protected:
     /// The path extension to be appended to the base URL when sending.
     std::string m_uriPathExtension;
 
+    /// Mutex to guard access of @c m_hasOrderingKey, @c m_orderingKey, @c m_priority and @c m_deadline.
+    std::mutex m_sendOptionsMutex;
+
+    /// Whether @c m_orderingKey has been set or read from the JSON content.
+    bool m_hasOrderingKey;
+
+    /// The key which orders this message relative to other messages.
+    std::string m_orderingKey;
+
+    /// The priority class of this message.
+    Priority m_priority;
+
+    /// The time by which this message must have started to be sent.
+    std::chrono::steady_clock::time_point m_deadline;
+
     /// The AttachmentReaders of the Attachments data to be sent to AVS.
     std::vector<std::shared_ptr<NamedReader>> m_readers;
 };
 
+/**
+ * Write a @c MessageRequest::Priority value to an @c ostream as a string.
+ *
+ * @param stream The stream to write the value to.
+ * @param priority The priority value to write to the @c ostream as a string.
+ * @return The @c ostream that was passed in and written to.
+ */
+inline std::ostream& operator<<(std::ostream& stream, MessageRequest::Priority priority) {
+    switch (priority) {
+        case MessageRequest::Priority::INTERACTIVE:
+            return stream << "INTERACTIVE";
+        case MessageRequest::Priority::NORMAL:
+            return stream << "NORMAL";
+        case MessageRequest::Priority::BACKGROUND:
+            return stream << "BACKGROUND";
+    }
+    return stream << "UNKNOWN_PRIORITY";
+}
+
 }  // namespace avs
 }  // namespace avsCommon
 }  // namespace alexaClientSDK
@@ -14,6 +14,7 @@
  */
 
 #include "AVSCommon/AVS/AVSDirective.h"
+#include "AVSCommon/Utils/JSON/JSONUtils.h"
 #include "AVSCommon/Utils/Logger/Logger.h"
 
 namespace alexaClientSDK {
@@ -51,6 +52,48 @@ std::unique_ptr<AVSDirective> AVSDirective::create(
         new AVSDirective(unparsedDirective, avsMessageHeader, payload, attachmentManager, attachmentContextId));
 }
 
+std::unique_ptr<AVSDirective> AVSDirective::create(
+    const std::string& unparsedDirective,
+    std::shared_ptr<const rapidjson::Document> document,
+    const rapidjson::Value& payload,
+    std::shared_ptr<AVSMessageHeader> avsMessageHeader,
+    std::shared_ptr<AttachmentManagerInterface> attachmentManager,
+    const std::string& attachmentContextId) {
+    if (!document) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullDocument"));
+        return nullptr;
+    }
+    if (!payload.IsObject()) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "payloadNotAnObject"));
+        return nullptr;
+    }
+    if (!avsMessageHeader) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullMessageHeader"));
+        return nullptr;
+    }
+    if (!attachmentManager) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullAttachmentManager"));
+        return nullptr;
+    }
+    return std::unique_ptr<AVSDirective>(new AVSDirective(
+        unparsedDirective, document, &payload, avsMessageHeader, attachmentManager, attachmentContextId));
+}
+
+std::string AVSDirective::getPayload() const {
+    if (!m_isCreatedFromDocument) {
+        return AVSMessage::getPayload();
+    }
+    std::call_once(m_payloadConversionFlag, &AVSDirective::convertPayload, this);
+    return m_serializedPayload;
+}
+
+const rapidjson::Value* AVSDirective::getPayloadValue() const {
+    if (!m_isCreatedFromDocument) {
+        std::call_once(m_payloadConversionFlag, &AVSDirective::convertPayload, this);
+    }
+    return m_payloadValue;
+}
+
 std::unique_ptr<AttachmentReader> AVSDirective::getAttachmentReader(
     const std::string& contentId,
     sds::ReaderPolicy readerPolicy) const {
@@ -66,10 +109,42 @@ AVSDirective::AVSDirective(
     const std::string& attachmentContextId) :
         AVSMessage{avsMessageHeader, payload},
         m_unparsedDirective{unparsedDirective},
+        m_isCreatedFromDocument{false},
+        m_payloadValue{nullptr},
         m_attachmentManager{attachmentManager},
         m_attachmentContextId{attachmentContextId} {
 }
 
+AVSDirective::AVSDirective(
+    const std::string& unparsedDirective,
+    std::shared_ptr<const rapidjson::Document> document,
+    const rapidjson::Value* payload,
+    std::shared_ptr<AVSMessageHeader> avsMessageHeader,
+    std::shared_ptr<AttachmentManagerInterface> attachmentManager,
+    const std::string& attachmentContextId) :
+        AVSMessage{avsMessageHeader, ""},
+        m_unparsedDirective{unparsedDirective},
+        m_isCreatedFromDocument{true},
+        m_document{document},
+        m_payloadValue{payload},
+        m_attachmentManager{attachmentManager},
+        m_attachmentContextId{attachmentContextId} {
+}
+
+void AVSDirective::convertPayload() const {
+    if (m_isCreatedFromDocument) {
+        json::jsonUtils::convertToValue(*m_payloadValue, &m_serializedPayload);
+        return;
+    }
+    auto document = std::make_shared<rapidjson::Document>();
+    if (!json::jsonUtils::parseJSON(AVSMessage::getPayload(), document.get())) {
+        ACSDK_ERROR(LX("convertPayloadFailed").d("reason", "parseFailed").d("messageId", getMessageId()));
+        return;
+    }
+    m_document = document;
+    m_payloadValue = m_document.get();
+}
+
 std::string AVSDirective::getUnparsedDirective() const {
     return m_unparsedDirective;
 }
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/AVS/Attachment/AttachmentBufferPool.h"
+#include "AVSCommon/AVS/Attachment/InProcessAttachment.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+using namespace avsCommon::utils::sds;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("AttachmentBufferPool");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The size of the data of a short sound, which holds a few seconds of compressed audio.
+static const size_t SHORT_SOUND_DATA_SIZE = 64 * 1024;
+
+const size_t AttachmentBufferPool::DEFAULT_MAX_IDLE_BYTES = 4 * 1024 * 1024;
+
+std::shared_ptr<AttachmentBufferPool> AttachmentBufferPool::create(size_t maxIdleBytes) {
+    return std::shared_ptr<AttachmentBufferPool>(new AttachmentBufferPool(maxIdleBytes));
+}
+
+std::shared_ptr<AttachmentBufferPool> AttachmentBufferPool::getDefaultPool() {
+    static std::shared_ptr<AttachmentBufferPool> defaultPool = create();
+    return defaultPool;
+}
+
+size_t AttachmentBufferPool::getDataSize(SizeHint hint) {
+    switch (hint) {
+        case SizeHint::SHORT_SOUND:
+            return SHORT_SOUND_DATA_SIZE;
+        case SizeHint::SPEECH:
+        case SizeHint::MEDIA_STREAM:
+            return InProcessAttachment::SDS_BUFFER_DEFAULT_SIZE_IN_BYTES;
+    }
+    return InProcessAttachment::SDS_BUFFER_DEFAULT_SIZE_IN_BYTES;
+}
+
+AttachmentBufferPool::AttachmentBufferPool(size_t maxIdleBytes) :
+        m_maxIdleBytes{maxIdleBytes},
+        m_statistics{0, 0, 0, 0} {
+}
+
+std::unique_ptr<InProcessSDS> AttachmentBufferPool::createSDS(SizeHint hint) {
+    return createSDS(getDataSize(hint));
+}
+
+std::unique_ptr<InProcessSDS> AttachmentBufferPool::createSDS(size_t dataSize) {
+    auto bufferSize = InProcessSDS::calculateBufferSize(dataSize);
+    if (0 == bufferSize) {
+        ACSDK_ERROR(LX("createSDSFailed").d("reason", "calculateBufferSizeFailed").d("dataSize", dataSize));
+        return nullptr;
+    }
+    auto sds = InProcessSDS::create(acquireBuffer(bufferSize));
+    if (!sds) {
+        ACSDK_ERROR(LX("createSDSFailed").d("reason", "createInProcessSDSFailed").d("dataSize", dataSize));
+    }
+    return sds;
+}
+
+AttachmentBufferPool::Statistics AttachmentBufferPool::getStatistics() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_statistics;
+}
+
+std::shared_ptr<InProcessSDS::Buffer> AttachmentBufferPool::acquireBuffer(size_t bufferSize) {
+    std::unique_ptr<InProcessSDS::Buffer> buffer;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_idleBuffers.find(bufferSize);
+        if (it != m_idleBuffers.end() && !it->second.empty()) {
+            buffer = std::move(it->second.back());
+            it->second.pop_back();
+            m_statistics.idleBytes -= bufferSize;
+            ++m_statistics.buffersReused;
+        } else {
+            ++m_statistics.buffersAllocated;
+        }
+        ++m_statistics.buffersInUse;
+    }
+    if (!buffer) {
+        buffer.reset(new InProcessSDS::Buffer(bufferSize));
+    }
+    std::weak_ptr<AttachmentBufferPool> weakPool = shared_from_this();
+    return std::shared_ptr<InProcessSDS::Buffer>(buffer.release(), [weakPool](InProcessSDS::Buffer* buffer) {
+        auto pool = weakPool.lock();
+        if (pool) {
+            pool->releaseBuffer(buffer);
+        } else {
+            delete buffer;
+        }
+    });
+}
+
+void AttachmentBufferPool::releaseBuffer(InProcessSDS::Buffer* buffer) {
+    std::unique_ptr<InProcessSDS::Buffer> releasedBuffer(buffer);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    --m_statistics.buffersInUse;
+    if (m_statistics.idleBytes + releasedBuffer->size() > m_maxIdleBytes) {
+        // The buffer is freed once the lock is released.
+        return;
+    }
+    m_statistics.idleBytes += releasedBuffer->size();
+    m_idleBuffers[releasedBuffer->size()].push_back(std::move(releasedBuffer));
+}
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -50,8 +50,11 @@ AttachmentManager::AttachmentManagementDetails::AttachmentManagementDetails() :
         creationTime{std::chrono::steady_clock::now()} {
 }
 
-AttachmentManager::AttachmentManager(AttachmentType attachmentType) :
+AttachmentManager::AttachmentManager(
+    AttachmentType attachmentType,
+    std::shared_ptr<AttachmentBufferPool> bufferPool) :
         m_attachmentType{attachmentType},
+        m_bufferPool{bufferPool ? bufferPool : AttachmentBufferPool::getDefaultPool()},
         m_attachmentExpirationMinutes{ATTACHMENT_MANAGER_TIMOUT_MINUTES_DEFAULT} {
 }
 
@@ -99,7 +102,8 @@ AttachmentManager::AttachmentManagementDetails& AttachmentManager::getDetailsLoc
         switch (m_attachmentType) {
             // The in-process attachment type.
             case AttachmentType::IN_PROCESS:
-                details.attachment = make_unique<InProcessAttachment>(attachmentId);
+                details.attachment = make_unique<InProcessAttachment>(
+                    attachmentId, AttachmentBufferPool::SizeHint::SPEECH, m_bufferPool);
                 break;
         }
 
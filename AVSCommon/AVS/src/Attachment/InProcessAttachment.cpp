@@ -26,6 +26,25 @@ using namespace alexaClientSDK::avsCommon::utils::memory;
 InProcessAttachment::InProcessAttachment(const std::string& id, std::unique_ptr<SDSType> sds) :
         Attachment(id),
         m_sds{std::move(sds)} {
+    if (!m_sds) {
+        m_sds = AttachmentBufferPool::getDefaultPool()->createSDS(SDS_BUFFER_DEFAULT_SIZE_IN_BYTES);
+    }
+    createDefaultSDSIfNeeded();
+}
+
+InProcessAttachment::InProcessAttachment(
+    const std::string& id,
+    AttachmentBufferPool::SizeHint hint,
+    std::shared_ptr<AttachmentBufferPool> pool) :
+        Attachment(id) {
+    if (!pool) {
+        pool = AttachmentBufferPool::getDefaultPool();
+    }
+    m_sds = pool->createSDS(hint);
+    createDefaultSDSIfNeeded();
+}
+
+void InProcessAttachment::createDefaultSDSIfNeeded() {
     if (!m_sds) {
         auto buffSize = SDSType::calculateBufferSize(SDS_BUFFER_DEFAULT_SIZE_IN_BYTES);
         auto buff = std::make_shared<SDSBufferType>(buffSize);
@@ -33,12 +33,13 @@ static const std::string TAG("InProcessAttachmentReader");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-std::unique_ptr<InProcessAttachmentReader> InProcessAttachmentReader::create(
-    SDSTypeReader::Policy policy,
+template <typename SDSTypeT>
+std::unique_ptr<SDSAttachmentReader<SDSTypeT>> SDSAttachmentReader<SDSTypeT>::create(
+    typename SDSTypeReader::Policy policy,
     std::shared_ptr<SDSType> sds,
     SDSTypeIndex offset,
-    SDSTypeReader::Reference reference) {
-    auto reader = std::unique_ptr<InProcessAttachmentReader>(new InProcessAttachmentReader(policy, sds));
+    typename SDSTypeReader::Reference reference) {
+    auto reader = std::unique_ptr<SDSAttachmentReader>(new SDSAttachmentReader(policy, sds));
 
     if (!reader->m_reader) {
         ACSDK_ERROR(LX("createFailed").d("reason", "object not fully created"));
@@ -53,7 +54,10 @@ std::unique_ptr<InProcessAttachmentReader> InProcessAttachmentReader::create(
     return reader;
 }
 
-InProcessAttachmentReader::InProcessAttachmentReader(SDSTypeReader::Policy policy, std::shared_ptr<SDSType> sds) {
+template <typename SDSTypeT>
+SDSAttachmentReader<SDSTypeT>::SDSAttachmentReader(
+    typename SDSTypeReader::Policy policy,
+    std::shared_ptr<SDSType> sds) {
     if (!sds) {
         ACSDK_ERROR(LX("ConstructorFailed").d("reason", "SDS parameter is nullptr"));
         return;
@@ -67,49 +71,100 @@ InProcessAttachmentReader::InProcessAttachmentReader(SDSTypeReader::Policy polic
     }
 }
 
-InProcessAttachmentReader::~InProcessAttachmentReader() {
+template <typename SDSTypeT>
+SDSAttachmentReader<SDSTypeT>::~SDSAttachmentReader() {
+    if (m_reader) {
+        m_reader->removeDataAvailableObserver(onDataAvailable, this);
+    }
     close();
 }
 
-std::size_t InProcessAttachmentReader::read(
+template <typename SDSTypeT>
+std::size_t SDSAttachmentReader<SDSTypeT>::read(
     void* buf,
     std::size_t numBytes,
     ReadStatus* readStatus,
     std::chrono::milliseconds timeoutMs) {
+    std::size_t numWords = 0;
+    if (!prepareRead(numBytes, readStatus, timeoutMs, &numWords)) {
+        return 0;
+    }
+    return toBytes(m_reader->read(buf, numWords, timeoutMs), readStatus);
+}
+
+template <typename SDSTypeT>
+std::size_t SDSAttachmentReader<SDSTypeT>::peek(
+    Span* first,
+    Span* second,
+    std::size_t numBytes,
+    ReadStatus* readStatus,
+    std::chrono::milliseconds timeoutMs) {
+    std::size_t numWords = 0;
+    if (!prepareRead(numBytes, readStatus, timeoutMs, &numWords)) {
+        return 0;
+    }
+    return toBytes(m_reader->peek(first, second, numWords, timeoutMs), readStatus);
+}
+
+template <typename SDSTypeT>
+std::size_t SDSAttachmentReader<SDSTypeT>::commit(std::size_t numBytes, ReadStatus* readStatus) {
     if (!readStatus) {
-        ACSDK_ERROR(LX("readFailed").d("reason", "read status is nullptr"));
+        ACSDK_ERROR(LX("commitFailed").d("reason", "read status is nullptr"));
         return 0;
     }
+    if (!m_reader) {
+        ACSDK_INFO(LX("commitFailed").d("reason", "closed or uninitialized SDS"));
+        *readStatus = ReadStatus::CLOSED;
+        return 0;
+    }
+    *readStatus = ReadStatus::OK;
+    return toBytes(m_reader->commit(numBytes / m_reader->getWordSize()), readStatus);
+}
+
+template <typename SDSTypeT>
+bool SDSAttachmentReader<SDSTypeT>::prepareRead(
+    std::size_t numBytes,
+    ReadStatus* readStatus,
+    std::chrono::milliseconds timeoutMs,
+    std::size_t* numWords) {
+    if (!readStatus) {
+        ACSDK_ERROR(LX("readFailed").d("reason", "read status is nullptr"));
+        return false;
+    }
 
     if (!m_reader) {
         ACSDK_INFO(LX("readFailed").d("reason", "closed or uninitialized SDS"));
         *readStatus = ReadStatus::CLOSED;
-        return 0;
+        return false;
     }
 
     if (timeoutMs.count() < 0) {
         ACSDK_ERROR(LX("readFailed").d("reason", "negative timeout"));
         *readStatus = ReadStatus::ERROR_INTERNAL;
-        return 0;
+        return false;
     }
 
     *readStatus = ReadStatus::OK;
 
     if (0 == numBytes) {
-        return 0;
+        return false;
     }
 
     auto wordSize = m_reader->getWordSize();
     if (numBytes < wordSize) {
         ACSDK_ERROR(LX("readFailed").d("reason", "bytes requested smaller than SDS word size"));
         *readStatus = ReadStatus::ERROR_BYTES_LESS_THAN_WORD_SIZE;
-        return 0;
+        return false;
     }
 
-    std::size_t bytesRead = 0;
-    auto numWords = numBytes / wordSize;
+    *numWords = numBytes / wordSize;
+    return true;
+}
 
-    auto readResult = m_reader->read(buf, numWords, timeoutMs);
+template <typename SDSTypeT>
+std::size_t SDSAttachmentReader<SDSTypeT>::toBytes(ssize_t readResult, ReadStatus* readStatus) {
+    std::size_t bytesRead = 0;
+    auto wordSize = m_reader->getWordSize();
 
     /*
      * Convert SDS return code accordingly:
@@ -122,19 +177,19 @@ std::size_t InProcessAttachmentReader::read(
     if (readResult < 0) {
         switch (readResult) {
             // This means the writer has overwritten the reader.  An attachment cannot recover from this.
-            case SDSType::Reader::Error::OVERRUN:
+            case SDSTypeReader::Error::OVERRUN:
                 *readStatus = ReadStatus::ERROR_OVERRUN;
                 ACSDK_ERROR(LX("readFailed").d("reason", "memory overrun by writer"));
                 close();
                 break;
 
             // This means there is still an active writer, but no data.  A read would block if the policy was blocking.
-            case SDSType::Reader::Error::WOULDBLOCK:
+            case SDSTypeReader::Error::WOULDBLOCK:
                 *readStatus = ReadStatus::OK_WOULDBLOCK;
                 break;
 
             // This means there is still an active writer, but no data.  A read call timed out waiting for data.
-            case SDSType::Reader::Error::TIMEDOUT:
+            case SDSTypeReader::Error::TIMEDOUT:
                 *readStatus = ReadStatus::OK_TIMEDOUT;
                 break;
         }
@@ -155,35 +210,68 @@ std::size_t InProcessAttachmentReader::read(
     return bytesRead;
 }
 
-void InProcessAttachmentReader::close(ClosePoint closePoint) {
+template <typename SDSTypeT>
+void SDSAttachmentReader<SDSTypeT>::close(ClosePoint closePoint) {
     if (m_reader) {
         switch (closePoint) {
             case ClosePoint::IMMEDIATELY:
                 m_reader->close();
                 return;
             case ClosePoint::AFTER_DRAINING_CURRENT_BUFFER:
-                m_reader->close(0, SDSType::Reader::Reference::BEFORE_WRITER);
+                m_reader->close(0, SDSTypeReader::Reference::BEFORE_WRITER);
                 return;
         }
     }
 }
 
-bool InProcessAttachmentReader::seek(uint64_t offset) {
+template <typename SDSTypeT>
+bool SDSAttachmentReader<SDSTypeT>::seek(uint64_t offset) {
     if (m_reader) {
         return m_reader->seek(offset);
     }
     return false;
 }
 
-uint64_t InProcessAttachmentReader::getNumUnreadBytes() {
+template <typename SDSTypeT>
+uint64_t SDSAttachmentReader<SDSTypeT>::getNumUnreadBytes() {
     if (m_reader) {
-        return m_reader->tell(utils::sds::InProcessSDS::Reader::Reference::BEFORE_WRITER);
+        return m_reader->tell(SDSTypeReader::Reference::BEFORE_WRITER);
     }
 
     ACSDK_ERROR(LX("getNumUnreadBytesFailed").d("reason", "noReader"));
     return 0;
 }
 
+template <typename SDSTypeT>
+bool SDSAttachmentReader<SDSTypeT>::setDataAvailableCallback(std::function<void()> callback) {
+    if (!m_reader) {
+        ACSDK_ERROR(LX("setDataAvailableCallbackFailed").d("reason", "noReader"));
+        return false;
+    }
+    m_reader->removeDataAvailableObserver(onDataAvailable, this);
+    m_dataAvailableCallback = callback;
+    if (!m_dataAvailableCallback) {
+        return true;
+    }
+    if (!m_reader->addDataAvailableObserver(onDataAvailable, this)) {
+        ACSDK_ERROR(LX("setDataAvailableCallbackFailed").d("reason", "addDataAvailableObserverFailed"));
+        m_dataAvailableCallback = nullptr;
+        return false;
+    }
+    return true;
+}
+
+template <typename SDSTypeT>
+void SDSAttachmentReader<SDSTypeT>::onDataAvailable(void* context) {
+    static_cast<SDSAttachmentReader*>(context)->m_dataAvailableCallback();
+}
+
+template class SDSAttachmentReader<utils::sds::InProcessSDS>;
+
+#ifdef SHARED_MEMORY_SDS
+template class SDSAttachmentReader<utils::sds::SharedMemorySDS>;
+#endif
+
 }  // namespace attachment
 }  // namespace avs
 }  // namespace avsCommon
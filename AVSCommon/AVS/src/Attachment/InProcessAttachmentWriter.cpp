@@ -55,6 +55,9 @@ InProcessAttachmentWriter::InProcessAttachmentWriter(std::shared_ptr<SDSType> sd
 }
 
 InProcessAttachmentWriter::~InProcessAttachmentWriter() {
+    if (m_writer) {
+        m_writer->removeSpaceAvailableObserver(onSpaceAvailable, this);
+    }
     close();
 }
 
@@ -63,34 +66,73 @@ std::size_t InProcessAttachmentWriter::write(
     std::size_t numBytes,
     WriteStatus* writeStatus,
     std::chrono::milliseconds timeout) {
+    std::size_t numWords = 0;
+    if (!prepareWrite(numBytes, writeStatus, &numWords)) {
+        return 0;
+    }
+    return toBytes(m_writer->write(buff, numWords, timeout), writeStatus);
+}
+
+std::size_t InProcessAttachmentWriter::reserve(
+    Span* first,
+    Span* second,
+    std::size_t numBytes,
+    WriteStatus* writeStatus,
+    std::chrono::milliseconds timeout) {
+    std::size_t numWords = 0;
+    if (!prepareWrite(numBytes, writeStatus, &numWords)) {
+        return 0;
+    }
+    return toBytes(m_writer->reserve(first, second, numWords, timeout), writeStatus);
+}
+
+std::size_t InProcessAttachmentWriter::commit(std::size_t numBytes, WriteStatus* writeStatus) {
     if (!writeStatus) {
-        ACSDK_ERROR(LX("writeFailed").d("reason", "writeStatus is nullptr"));
+        ACSDK_ERROR(LX("commitFailed").d("reason", "writeStatus is nullptr"));
         return 0;
     }
+    if (!m_writer) {
+        ACSDK_ERROR(LX("commitFailed").d("reason", "SDS is closed or uninitialized"));
+        *writeStatus = WriteStatus::CLOSED;
+        return 0;
+    }
+    *writeStatus = WriteStatus::OK;
+    return toBytes(m_writer->commit(numBytes / m_writer->getWordSize()), writeStatus);
+}
+
+bool InProcessAttachmentWriter::prepareWrite(std::size_t numBytes, WriteStatus* writeStatus, std::size_t* numWords) {
+    if (!writeStatus) {
+        ACSDK_ERROR(LX("writeFailed").d("reason", "writeStatus is nullptr"));
+        return false;
+    }
 
     if (!m_writer) {
         ACSDK_ERROR(LX("writeFailed").d("reason", "SDS is closed or uninitialized"));
         *writeStatus = WriteStatus::CLOSED;
         ACSDK_ERROR(LX("InProcessAttachmentWriter : SDS is closed!"));
-        return 0;
+        return false;
     }
 
     *writeStatus = WriteStatus::OK;
 
     if (0 == numBytes) {
-        return 0;
+        return false;
     }
 
     auto wordSize = m_writer->getWordSize();
     if (numBytes < wordSize) {
         ACSDK_ERROR(LX("writeFailed").d("reason", "number of bytes are smaller than the underlying word size"));
         *writeStatus = WriteStatus::ERROR_BYTES_LESS_THAN_WORD_SIZE;
-        return 0;
+        return false;
     }
 
+    *numWords = numBytes / wordSize;
+    return true;
+}
+
+std::size_t InProcessAttachmentWriter::toBytes(ssize_t writeResult, WriteStatus* writeStatus) {
     std::size_t bytesWritten = 0;
-    auto numWords = numBytes / wordSize;
-    auto writeResult = m_writer->write(buff, numWords, timeout);
+    auto wordSize = m_writer->getWordSize();
 
     /*
      * Convert SDS return code accordingly:
@@ -143,6 +185,28 @@ void InProcessAttachmentWriter::close() {
     }
 }
 
+bool InProcessAttachmentWriter::setSpaceAvailableCallback(std::function<void()> callback) {
+    if (!m_writer) {
+        ACSDK_ERROR(LX("setSpaceAvailableCallbackFailed").d("reason", "noWriter"));
+        return false;
+    }
+    m_writer->removeSpaceAvailableObserver(onSpaceAvailable, this);
+    m_spaceAvailableCallback = callback;
+    if (!m_spaceAvailableCallback) {
+        return true;
+    }
+    if (!m_writer->addSpaceAvailableObserver(onSpaceAvailable, this)) {
+        ACSDK_ERROR(LX("setSpaceAvailableCallbackFailed").d("reason", "addSpaceAvailableObserverFailed"));
+        m_spaceAvailableCallback = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void InProcessAttachmentWriter::onSpaceAvailable(void* context) {
+    static_cast<InProcessAttachmentWriter*>(context)->m_spaceAvailableCallback();
+}
+
 }  // namespace attachment
 }  // namespace avs
 }  // namespace avsCommon
@@ -48,7 +48,7 @@ void DialogUXStateAggregator::addObserver(std::shared_ptr<DialogUXStateObserverI
         ACSDK_ERROR(LX("addObserverFailed").d("reason", "nullObserver"));
         return;
     }
-    m_executor.submit([this, observer]() {
+    m_executor.execute([this, observer]() {
         m_observers.insert(observer);
         observer->onDialogUXStateChanged(m_currentState);
     });
@@ -65,7 +65,7 @@ void DialogUXStateAggregator::removeObserver(std::shared_ptr<DialogUXStateObserv
 void DialogUXStateAggregator::onStateChanged(AudioInputProcessorObserverInterface::State state) {
     m_audioInputProcessorState = state;
 
-    m_executor.submit([this, state]() {
+    m_executor.execute([this, state]() {
         switch (state) {
             case AudioInputProcessorObserverInterface::State::IDLE:
                 tryEnterIdleState();
@@ -96,7 +96,7 @@ void DialogUXStateAggregator::onStateChanged(AudioInputProcessorObserverInterfac
 void DialogUXStateAggregator::onStateChanged(SpeechSynthesizerObserverInterface::SpeechSynthesizerState state) {
     m_speechSynthesizerState = state;
 
-    m_executor.submit([this, state]() {
+    m_executor.execute([this, state]() {
         switch (state) {
             case SpeechSynthesizerObserverInterface::SpeechSynthesizerState::PLAYING:
                 onActivityStarted();
@@ -116,7 +116,7 @@ void DialogUXStateAggregator::onStateChanged(SpeechSynthesizerObserverInterface:
 }
 
 void DialogUXStateAggregator::receive(const std::string& contextId, const std::string& message) {
-    m_executor.submit([this]() {
+    m_executor.execute([this]() {
         if (DialogUXStateObserverInterface::DialogUXState::THINKING == m_currentState) {
             /*
              * Stop the long timer and start a short timer so that either the state will change (i.e. Speech begins)
@@ -133,7 +133,7 @@ void DialogUXStateAggregator::receive(const std::string& contextId, const std::s
 void DialogUXStateAggregator::onConnectionStatusChanged(
     const ConnectionStatusObserverInterface::Status status,
     const ConnectionStatusObserverInterface::ChangedReason reason) {
-    m_executor.submit([this, &status]() {
+    m_executor.execute([this, &status]() {
         if (status != avsCommon::sdkInterfaces::ConnectionStatusObserverInterface::Status::CONNECTED) {
             setState(DialogUXStateObserverInterface::DialogUXState::IDLE);
         }
@@ -149,7 +149,7 @@ void DialogUXStateAggregator::notifyObserversOfState() {
 }
 
 void DialogUXStateAggregator::transitionFromThinkingTimedOut() {
-    m_executor.submit([this]() {
+    m_executor.execute([this]() {
         if (DialogUXStateObserverInterface::DialogUXState::THINKING == m_currentState) {
             ACSDK_DEBUG(LX("transitionFromThinkingTimedOut"));
             setState(DialogUXStateObserverInterface::DialogUXState::IDLE);
@@ -158,7 +158,7 @@ void DialogUXStateAggregator::transitionFromThinkingTimedOut() {
 }
 
 void DialogUXStateAggregator::tryEnterIdleStateOnTimer() {
-    m_executor.submit([this]() {
+    m_executor.execute([this]() {
         if (m_currentState != sdkInterfaces::DialogUXStateObserverInterface::DialogUXState::IDLE &&
             m_audioInputProcessorState == AudioInputProcessorObserverInterface::State::IDLE &&
             m_speechSynthesizerState == SpeechSynthesizerObserverInterface::SpeechSynthesizerState::FINISHED) {
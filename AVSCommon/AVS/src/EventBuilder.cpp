@@ -15,8 +15,7 @@
 
 #include "AVSCommon/AVS/EventBuilder.h"
 
-#include <rapidjson/document.h>
-#include <rapidjson/stringbuffer.h>
+#include <rapidjson/reader.h>
 #include <rapidjson/writer.h>
 
 #include "AVSCommon/Utils/Logger/LogEntry.h"
@@ -65,118 +64,239 @@ static const std::string CONTEXT_KEY_STRING = "context";
 /// The event key.
 static const std::string EVENT_KEY_STRING = "event";
 
+/// Room in an event for its keys and punctuation, beyond the strings which are copied into it.
+static const size_t ENVELOPE_SIZE_ESTIMATE = 128;
+
+/**
+ * A @c rapidjson output stream which appends to a @c std::string, so that the header can be written straight into the
+ * event string.
+ */
+class StringOutputStream {
+public:
+    /// The character type of the stream.
+    typedef char Ch;
+
+    /**
+     * Constructor.
+     *
+     * @param output The string to append to.
+     */
+    StringOutputStream(std::string* output) : m_output{output} {
+    }
+
+    /**
+     * Appends a character.
+     *
+     * @param c The character.
+     */
+    void Put(Ch c) {
+        m_output->push_back(c);
+    }
+
+    /// Does nothing, as the string needs no flushing.
+    void Flush() {
+    }
+
+private:
+    /// The string to append to.
+    std::string* m_output;
+};
+
 /**
- * Builds a JSON header object. The header includes the namespace, name, message Id and an optional
+ * A @c rapidjson SAX handler which accepts any well formed JSON text, and notes whether its root value is an object.
+ */
+class RootTypeHandler : public BaseReaderHandler<UTF8<>, RootTypeHandler> {
+public:
+    /// Constructor.
+    RootTypeHandler() : isRootObject{false}, m_isFirstValue{true} {
+    }
+
+    /// Called for every value which is not handled below.
+    bool Default() {
+        m_isFirstValue = false;
+        return true;
+    }
+
+    /// Called at the start of every object.
+    bool StartObject() {
+        if (m_isFirstValue) {
+            isRootObject = true;
+        }
+        return Default();
+    }
+
+    /// Whether the root value is an object.
+    bool isRootObject;
+
+private:
+    /// Whether no value has been seen yet.
+    bool m_isFirstValue;
+};
+
+/**
+ * Checks that a string is a single well formed JSON value, without building a DOM.
+ *
+ * @param json The string.
+ * @param[out] isObject Whether the value is an object.
+ * @return Whether the string is well formed.
+ */
+static bool validateJson(const std::string& json, bool* isObject) {
+    RootTypeHandler handler;
+    Reader reader;
+    StringStream stream(json.c_str());
+    if (reader.Parse(stream, handler).IsError()) {
+        return false;
+    }
+    *isObject = handler.isRootObject;
+    return true;
+}
+
+/**
+ * Writes a JSON header object. The header includes the namespace, name, message Id and an optional
  * @c dialogRequestId. The message Id required for the header is a random string that is generated and added to the
  * header.
  *
  * @param nameSpace The namespace of the event to be included in the header.
  * @param eventName The name of the event to be included in the header.
  * @param dialogRequestIdValue The value associated with the "dialogRequestId" key.
- * @param allocator The rapidjson allocator to use to build the JSON header.
- * @param messageId Will be populated with the generated messageId of the header.
- * @return A header JSON object if successful else an empty object.
+ * @param messageId The message Id of the event.
+ * @param output The string to append the header to.
+ * @return Whether the header was written.
  */
-static Document buildHeader(
+static bool writeHeader(
     const std::string& nameSpace,
     const std::string& eventName,
     const std::string& dialogRequestIdValue,
-    Document::AllocatorType& allocator,
-    std::string* messageId) {
-    Document header(kObjectType);
-
-    if (!messageId) {
-        ACSDK_ERROR(LX("buildHeaderFailed").d("reason", "nullMessageId"));
-        return header;
-    }
-    *messageId = avsCommon::utils::uuidGeneration::generateUUID();
-
-    header.AddMember(StringRef(NAMESPACE_KEY_STRING), nameSpace, allocator);
-    header.AddMember(StringRef(NAME_KEY_STRING), eventName, allocator);
-    header.AddMember(StringRef(MESSAGE_ID_KEY_STRING), *messageId, allocator);
-
+    const std::string& messageId,
+    std::string* output) {
+    StringOutputStream stream(output);
+    Writer<StringOutputStream> writer(stream);
+    writer.StartObject();
+    writer.Key(NAMESPACE_KEY_STRING.c_str(), NAMESPACE_KEY_STRING.size());
+    writer.String(nameSpace.c_str(), nameSpace.size());
+    writer.Key(NAME_KEY_STRING.c_str(), NAME_KEY_STRING.size());
+    writer.String(eventName.c_str(), eventName.size());
+    writer.Key(MESSAGE_ID_KEY_STRING.c_str(), MESSAGE_ID_KEY_STRING.size());
+    writer.String(messageId.c_str(), messageId.size());
     if (!dialogRequestIdValue.empty()) {
-        header.AddMember(StringRef(DIALOG_REQUEST_ID_KEY_STRING), dialogRequestIdValue, allocator);
+        writer.Key(DIALOG_REQUEST_ID_KEY_STRING.c_str(), DIALOG_REQUEST_ID_KEY_STRING.size());
+        writer.String(dialogRequestIdValue.c_str(), dialogRequestIdValue.size());
     }
-    return header;
+    return writer.EndObject() && writer.IsComplete();
 }
 
 /**
- * Builds a JSON event object. The event includes the header and the payload.
+ * Appends a JSON string key and the colon which follows it.  The key must not need escaping.
  *
- * @param header The header value associated with the "header" key.
- * @param jsonPayloadValue The payload value associated with the "payload" key.
- * @param allocator The rapidjson allocator to use to build the JSON header.
- * @return An event JSON object if successful else an empty object.
+ * @param key The key.
+ * @param output The string to append the key to.
  */
-static Document buildEvent(Document* header, const std::string& jsonPayloadValue, Document::AllocatorType& allocator) {
-    Document payload(&allocator);
-    Document event(kObjectType);
-
-    if (!header || header->ObjectEmpty()) {
-        ACSDK_ERROR(LX("buildEventFailed").d("reason", "headerIsNullOrEmpty"));
-        return event;
-    }
-    // Parse the payload to convert to a JSON object. In case of an error, return an empty event value.
-    if (!jsonPayloadValue.empty() && payload.Parse(jsonPayloadValue).HasParseError()) {
-        ACSDK_ERROR(LX("buildEventFailed").d("reason", "errorParsingPayload").sensitive("payload", jsonPayloadValue));
-        return event;
-    }
-
-    event.AddMember(StringRef(HEADER_KEY_STRING), *header, allocator);
-    if (!jsonPayloadValue.empty()) {
-        event.AddMember(StringRef(PAYLOAD_KEY_STRING), payload, allocator);
-    }
-
-    return event;
+static void writeKey(const std::string& key, std::string* output) {
+    output->push_back('"');
+    output->append(key);
+    output->append("\":");
 }
 
-const std::pair<std::string, std::string> buildJsonEventString(
+const std::pair<std::string, std::string> buildJsonEventPrefix(
     const std::string& nameSpace,
     const std::string& eventName,
     const std::string& dialogRequestIdValue,
-    const std::string& jsonPayloadValue,
     const std::string& jsonContext) {
-    Document eventAndContext(kObjectType);
-    Document::AllocatorType& allocator = eventAndContext.GetAllocator();
     const std::pair<std::string, std::string> emptyPair;
 
+    /*
+     * The context is checked without building a DOM, and then copied verbatim into the event, so that it is not
+     * parsed into a DOM and serialized again.  The members of the context object become members of the event's root
+     * object.
+     */
+    size_t contextMembersBegin = 0;
+    size_t contextMembersEnd = 0;
     if (!jsonContext.empty()) {
-        Document context(kObjectType);
-        // The context needs to be parsed to convert to a JSON object.
-        if (context.Parse(jsonContext).HasParseError()) {
+        bool isObject = false;
+        if (!validateJson(jsonContext, &isObject) || !isObject) {
             ACSDK_DEBUG(
-                LX("buildJsonEventStringFailed").d("reason", "parseContextFailed").sensitive("context", jsonContext));
+                LX("buildJsonEventPrefixFailed").d("reason", "parseContextFailed").sensitive("context", jsonContext));
             return emptyPair;
         }
-        eventAndContext.CopyFrom(context, allocator);
+        contextMembersBegin = jsonContext.find('{') + 1;
+        contextMembersEnd = jsonContext.rfind('}');
+        contextMembersBegin = jsonContext.find_first_not_of(" \t\n\r", contextMembersBegin);
+        if (contextMembersBegin == contextMembersEnd) {
+            contextMembersBegin = contextMembersEnd = 0;
+        }
     }
 
-    std::string messageId;
-    Document header = buildHeader(nameSpace, eventName, dialogRequestIdValue, allocator, &messageId);
-    ACSDK_DEBUG(LX("buildJsonEventString").d("messageId", messageId).d("namespace", nameSpace).d("name", eventName));
+    std::string messageId = avsCommon::utils::uuidGeneration::generateUUID();
+    ACSDK_DEBUG(LX("buildJsonEventPrefix").d("messageId", messageId).d("namespace", nameSpace).d("name", eventName));
 
     if (eventName == "SpeechStarted" || eventName == "SpeechFinished" || eventName == "Recognize") {
         ACSDK_METRIC_IDS(TAG, eventName, messageId, dialogRequestIdValue, Metrics::Location::BUILDING_MESSAGE);
     }
 
-    Document event = buildEvent(&header, jsonPayloadValue, allocator);
-
-    if (event.ObjectEmpty()) {
-        ACSDK_ERROR(LX("buildJsonEventStringFailed").d("reason", "buildEventFailed"));
+    std::string eventPrefix;
+    eventPrefix.reserve(
+        (contextMembersEnd - contextMembersBegin) + nameSpace.size() + eventName.size() + messageId.size() +
+        dialogRequestIdValue.size() + ENVELOPE_SIZE_ESTIMATE);
+    eventPrefix.push_back('{');
+    if (contextMembersEnd > contextMembersBegin) {
+        eventPrefix.append(jsonContext, contextMembersBegin, contextMembersEnd - contextMembersBegin);
+        eventPrefix.push_back(',');
+    }
+    writeKey(EVENT_KEY_STRING, &eventPrefix);
+    eventPrefix.push_back('{');
+    writeKey(HEADER_KEY_STRING, &eventPrefix);
+    if (!writeHeader(nameSpace, eventName, dialogRequestIdValue, messageId, &eventPrefix)) {
+        ACSDK_ERROR(LX("buildJsonEventPrefixFailed").d("reason", "writeHeaderFailed"));
         return emptyPair;
     }
 
-    eventAndContext.AddMember(StringRef(EVENT_KEY_STRING), event, allocator);
+    return std::make_pair(messageId, eventPrefix);
+}
+
+std::string completeJsonEventString(std::string eventPrefix, const std::string& jsonPayloadValue) {
+    if (eventPrefix.empty()) {
+        ACSDK_ERROR(LX("completeJsonEventStringFailed").d("reason", "emptyEventPrefix"));
+        return "";
+    }
 
-    StringBuffer eventAndContextBuf;
-    Writer<StringBuffer> writer(eventAndContextBuf);
-    if (!eventAndContext.Accept(writer)) {
-        ACSDK_ERROR(LX("buildJsonEventStringFailed").d("reason", "StringBufferAcceptFailed"));
+    // Check the payload. In case of an error, return an empty string.
+    bool isPayloadObject = false;
+    if (!jsonPayloadValue.empty() && !validateJson(jsonPayloadValue, &isPayloadObject)) {
+        ACSDK_ERROR(LX("completeJsonEventStringFailed")
+                        .d("reason", "errorParsingPayload")
+                        .sensitive("payload", jsonPayloadValue));
+        return "";
+    }
+
+    std::string eventAndContext = std::move(eventPrefix);
+    if (!jsonPayloadValue.empty()) {
+        eventAndContext.reserve(eventAndContext.size() + jsonPayloadValue.size() + ENVELOPE_SIZE_ESTIMATE);
+        eventAndContext.push_back(',');
+        writeKey(PAYLOAD_KEY_STRING, &eventAndContext);
+        eventAndContext.append(jsonPayloadValue);
+    }
+    eventAndContext.append("}}");
+    return eventAndContext;
+}
+
+const std::pair<std::string, std::string> buildJsonEventString(
+    const std::string& nameSpace,
+    const std::string& eventName,
+    const std::string& dialogRequestIdValue,
+    const std::string& jsonPayloadValue,
+    const std::string& jsonContext) {
+    const std::pair<std::string, std::string> emptyPair;
+
+    auto messageIdAndPrefix = buildJsonEventPrefix(nameSpace, eventName, dialogRequestIdValue, jsonContext);
+    if (messageIdAndPrefix.second.empty()) {
+        return emptyPair;
+    }
+    auto eventAndContext = completeJsonEventString(std::move(messageIdAndPrefix.second), jsonPayloadValue);
+    if (eventAndContext.empty()) {
         return emptyPair;
     }
 
-    return std::make_pair(messageId, eventAndContextBuf.GetString());
+    return std::make_pair(messageIdAndPrefix.first, eventAndContext);
 }
 
 }  // namespace avs
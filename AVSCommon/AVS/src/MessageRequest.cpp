@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <rapidjson/reader.h>
+
 #include "AVSCommon/AVS/MessageRequest.h"
 #include "AVSCommon/Utils/Logger/Logger.h"
 
@@ -32,9 +34,126 @@ static const std::string TAG("MessageRequest");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+/// The key in our JSON content which holds the event.
+static const std::string EVENT_KEY = "event";
+/// The key in the event which holds the header.
+static const std::string HEADER_KEY = "header";
+/// The key in the header which holds the namespace.
+static const std::string NAMESPACE_KEY = "namespace";
+
+constexpr size_t MessageRequest::NUM_PRIORITIES;
+
+/**
+ * A @c rapidjson SAX handler which picks the namespace out of the header of an event, and stops the parse as soon as
+ * it has it, so that neither a DOM is built nor the payload scanned.
+ */
+class NamespaceHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, NamespaceHandler> {
+public:
+    /// Constructor.
+    NamespaceHandler() : found{false}, m_depth{0}, m_path{0} {
+    }
+
+    /// Called for every value which is not handled below.
+    bool Default() {
+        // A complete value at this depth ends any part of the path which its key had matched.
+        if (m_depth > 0 && m_path >= m_depth) {
+            m_path = m_depth - 1;
+        }
+        return true;
+    }
+
+    /// Called for every string value.
+    bool String(const char* str, rapidjson::SizeType length, bool) {
+        if (m_path == NAMESPACE_DEPTH && m_depth == NAMESPACE_DEPTH) {
+            nameSpace.assign(str, length);
+            found = true;
+            // Stop here; the rest of the content is not needed.
+            return false;
+        }
+        return Default();
+    }
+
+    /// Called for every key of an object.
+    bool Key(const char* str, rapidjson::SizeType length, bool) {
+        // The path only advances when the next key on it is found directly inside the object reached so far.
+        if (m_path == m_depth - 1 && m_depth <= NAMESPACE_DEPTH) {
+            const std::string& expected = PATH[m_depth - 1];
+            if (expected.size() == length && expected.compare(0, length, str, length) == 0) {
+                ++m_path;
+            }
+        }
+        return true;
+    }
+
+    /// Called at the start of every object.
+    bool StartObject() {
+        ++m_depth;
+        return true;
+    }
+
+    /// Called at the end of every object.
+    bool EndObject(rapidjson::SizeType) {
+        --m_depth;
+        return Default();
+    }
+
+    /// Called at the start of every array.
+    bool StartArray() {
+        ++m_depth;
+        return true;
+    }
+
+    /// Called at the end of every array.
+    bool EndArray(rapidjson::SizeType) {
+        --m_depth;
+        return Default();
+    }
+
+    /// Whether the namespace was found.
+    bool found;
+
+    /// The namespace, if it was found.
+    std::string nameSpace;
+
+private:
+    /// The depth of the object holding the namespace key.
+    static const int NAMESPACE_DEPTH = 3;
+
+    /// The keys leading from the root object to the namespace.
+    static const std::string PATH[NAMESPACE_DEPTH];
+
+    /// How many objects and arrays enclose the current position.
+    int m_depth;
+
+    /// How many keys of @c PATH lead to the current position.
+    int m_path;
+};
+
+const std::string NamespaceHandler::PATH[NamespaceHandler::NAMESPACE_DEPTH] = {EVENT_KEY, HEADER_KEY, NAMESPACE_KEY};
+
+/**
+ * Finds the namespace in the header of an event.
+ *
+ * @param jsonContent The JSON content of the event.
+ * @return The namespace, or an empty string if it could not be found.
+ */
+static std::string findNamespace(const std::string& jsonContent) {
+    NamespaceHandler handler;
+    rapidjson::Reader reader;
+    rapidjson::StringStream stream(jsonContent.c_str());
+    reader.Parse(stream, handler);
+    if (!handler.found) {
+        ACSDK_WARN(LX("findNamespaceFailed").d("reason", "namespaceNotFound"));
+    }
+    return handler.nameSpace;
+}
+
 MessageRequest::MessageRequest(const std::string& jsonContent, const std::string& uriPathExtension) :
         m_jsonContent{jsonContent},
-        m_uriPathExtension{uriPathExtension} {
+        m_uriPathExtension{uriPathExtension},
+        m_hasOrderingKey{false},
+        m_priority{Priority::NORMAL},
+        m_deadline{std::chrono::steady_clock::time_point::max()} {
 }
 
 MessageRequest::~MessageRequest() {
@@ -60,6 +179,41 @@ std::string MessageRequest::getUriPathExtension() {
     return m_uriPathExtension;
 }
 
+void MessageRequest::setOrderingKey(const std::string& orderingKey) {
+    std::lock_guard<std::mutex> lock{m_sendOptionsMutex};
+    m_orderingKey = orderingKey;
+    m_hasOrderingKey = true;
+}
+
+std::string MessageRequest::getOrderingKey() {
+    std::lock_guard<std::mutex> lock{m_sendOptionsMutex};
+    if (!m_hasOrderingKey) {
+        m_orderingKey = findNamespace(m_jsonContent);
+        m_hasOrderingKey = true;
+    }
+    return m_orderingKey;
+}
+
+void MessageRequest::setPriority(Priority priority) {
+    std::lock_guard<std::mutex> lock{m_sendOptionsMutex};
+    m_priority = priority;
+}
+
+MessageRequest::Priority MessageRequest::getPriority() {
+    std::lock_guard<std::mutex> lock{m_sendOptionsMutex};
+    return m_priority;
+}
+
+void MessageRequest::setDeadline(std::chrono::steady_clock::time_point deadline) {
+    std::lock_guard<std::mutex> lock{m_sendOptionsMutex};
+    m_deadline = deadline;
+}
+
+std::chrono::steady_clock::time_point MessageRequest::getDeadline() {
+    std::lock_guard<std::mutex> lock{m_sendOptionsMutex};
+    return m_deadline;
+}
+
 int MessageRequest::attachmentReadersCount() {
     return m_readers.size();
 }
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/AVS/AVSDirective.h"
+#include "AVSCommon/AVS/Attachment/AttachmentManager.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace test {
+
+using namespace avsCommon::avs::attachment;
+
+/// A payload for testing.
+static const std::string PAYLOAD_TEST = R"({"token":"testToken","volume":10})";
+
+/// A directive with @c PAYLOAD_TEST as its payload.
+static const std::string DIRECTIVE_TEST = R"({"directive":{"payload":)" + PAYLOAD_TEST + "}}";
+
+/// A payload which is not valid JSON.
+static const std::string INVALID_PAYLOAD = "invalid }}";
+
+/// AVSDirectiveTest
+class AVSDirectiveTest : public ::testing::Test {
+public:
+    void SetUp() override;
+
+    /// The header of the directives under test.
+    std::shared_ptr<AVSMessageHeader> m_header;
+
+    /// The attachment manager of the directives under test.
+    std::shared_ptr<AttachmentManager> m_attachmentManager;
+};
+
+void AVSDirectiveTest::SetUp() {
+    m_header = std::make_shared<AVSMessageHeader>("namespace", "name", "messageId", "dialogRequestId");
+    m_attachmentManager = std::make_shared<AttachmentManager>(AttachmentManager::AttachmentType::IN_PROCESS);
+}
+
+/**
+ * Verify that a directive created from a payload string provides the parsed payload.
+ */
+TEST_F(AVSDirectiveTest, testPayloadValueFromString) {
+    auto directive = AVSDirective::create(DIRECTIVE_TEST, m_header, PAYLOAD_TEST, m_attachmentManager, "");
+    ASSERT_NE(directive, nullptr);
+    ASSERT_EQ(directive->getPayload(), PAYLOAD_TEST);
+
+    auto payload = directive->getPayloadValue();
+    ASSERT_NE(payload, nullptr);
+    ASSERT_TRUE(payload->IsObject());
+    ASSERT_EQ(std::string((*payload)["token"].GetString()), "testToken");
+    ASSERT_EQ(directive->getPayloadValue(), payload);
+}
+
+/**
+ * Verify that a directive whose payload string is not valid JSON has no parsed payload.
+ */
+TEST_F(AVSDirectiveTest, testInvalidPayloadString) {
+    auto directive = AVSDirective::create(DIRECTIVE_TEST, m_header, INVALID_PAYLOAD, m_attachmentManager, "");
+    ASSERT_NE(directive, nullptr);
+    ASSERT_EQ(directive->getPayloadValue(), nullptr);
+    ASSERT_EQ(directive->getPayload(), INVALID_PAYLOAD);
+}
+
+/**
+ * Verify that a directive created from a parsed document shares the document, and serializes the payload on demand.
+ */
+TEST_F(AVSDirectiveTest, testPayloadFromDocument) {
+    auto document = std::make_shared<rapidjson::Document>();
+    document->Parse(DIRECTIVE_TEST);
+    ASSERT_FALSE(document->HasParseError());
+    const rapidjson::Value& payloadValue = (*document)["directive"]["payload"];
+
+    auto directive =
+        AVSDirective::create(DIRECTIVE_TEST, document, payloadValue, m_header, m_attachmentManager, "");
+    ASSERT_NE(directive, nullptr);
+    ASSERT_EQ(directive->getPayloadValue(), &payloadValue);
+    ASSERT_EQ(directive->getPayload(), PAYLOAD_TEST);
+    ASSERT_EQ(directive->getUnparsedDirective(), DIRECTIVE_TEST);
+
+    // The directive keeps the document alive.
+    document.reset();
+    ASSERT_EQ(std::string((*directive->getPayloadValue())["token"].GetString()), "testToken");
+}
+
+/**
+ * Verify that a directive can not be created from a parsed document whose payload is not an object.
+ */
+TEST_F(AVSDirectiveTest, testPayloadFromDocumentMustBeObject) {
+    auto document = std::make_shared<rapidjson::Document>();
+    document->Parse("[1, 2]");
+    ASSERT_FALSE(document->HasParseError());
+    ASSERT_EQ(AVSDirective::create("", document, *document, m_header, m_attachmentManager, ""), nullptr);
+    ASSERT_EQ(AVSDirective::create("", nullptr, *document, m_header, m_attachmentManager, ""), nullptr);
+}
+
+}  // namespace test
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
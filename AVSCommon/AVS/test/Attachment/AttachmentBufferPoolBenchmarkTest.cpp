@@ -0,0 +1,189 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file AttachmentBufferPoolBenchmarkTest.cpp
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/AVS/Attachment/AttachmentBufferPool.h"
+#include "AVSCommon/AVS/Attachment/InProcessAttachment.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+using namespace alexaClientSDK::avsCommon::avs::attachment;
+using namespace alexaClientSDK::avsCommon::utils::sds;
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace test {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("AttachmentBufferPoolBenchmarkTest");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The number of turns of the scripted session.
+static const int TURN_COUNT = 50;
+
+/// The size of the earcon played at the start of each turn.
+static const size_t EARCON_SIZE = 16 * 1024;
+
+/// The size of the speech of each turn.
+static const size_t SPEECH_SIZE = 192 * 1024;
+
+/// The size of the media streamed in each turn.
+static const size_t MEDIA_SIZE = 512 * 1024;
+
+/// The size of the chunks written and read.
+static const size_t CHUNK_SIZE = 4096;
+
+/// Creates the attachment for a kind of content.
+using AttachmentCreator = std::function<std::shared_ptr<InProcessAttachment>(AttachmentBufferPool::SizeHint)>;
+
+/// How a session went.
+struct SessionResult {
+    /// The time spent creating attachments.
+    std::chrono::nanoseconds allocationTime;
+    /// The highest resident set size seen, above that at the start of the session.
+    long peakRssGrowthKb;
+};
+
+/**
+ * Returns the resident set size of the process.
+ *
+ * @return The resident set size, in kilobytes.
+ */
+static long getRssKb() {
+    std::ifstream statm("/proc/self/statm");
+    long totalPages = 0;
+    long residentPages = 0;
+    statm >> totalPages >> residentPages;
+    return residentPages * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+/**
+ * Stream content through an attachment, as its writer and reader would.
+ *
+ * @param attachment The attachment.
+ * @param size The size of the content.
+ */
+static void streamThrough(std::shared_ptr<InProcessAttachment> attachment, size_t size) {
+    auto writer = attachment->createWriter(WriterPolicy::NONBLOCKABLE);
+    auto reader = attachment->createReader(ReaderPolicy::NONBLOCKING);
+    std::vector<uint8_t> chunk(CHUNK_SIZE, 0x5a);
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    auto readStatus = AttachmentReader::ReadStatus::OK;
+    for (size_t written = 0; written < size; written += CHUNK_SIZE) {
+        writer->write(chunk.data(), chunk.size(), &writeStatus);
+        reader->read(chunk.data(), chunk.size(), &readStatus);
+    }
+}
+
+/**
+ * Create an attachment, and add the time taken to a total.
+ *
+ * @param createAttachment Creates the attachment for a kind of content.
+ * @param hint The kind of content.
+ * @param[in,out] allocationTime The total time spent creating attachments.
+ * @return The attachment.
+ */
+static std::shared_ptr<InProcessAttachment> timeCreation(
+    AttachmentCreator createAttachment,
+    AttachmentBufferPool::SizeHint hint,
+    std::chrono::nanoseconds* allocationTime) {
+    auto start = std::chrono::steady_clock::now();
+    auto attachment = createAttachment(hint);
+    *allocationTime += std::chrono::steady_clock::now() - start;
+    return attachment;
+}
+
+/**
+ * Run a scripted session.  Each turn plays an earcon while the speech of the response arrives, and then streams
+ * media, with the attachments of a turn released before the next turn.
+ *
+ * @param createAttachment Creates the attachment for a kind of content.
+ * @return How the session went.
+ */
+static SessionResult runSession(AttachmentCreator createAttachment) {
+    SessionResult result{std::chrono::nanoseconds::zero(), 0};
+    auto startRss = getRssKb();
+    for (int turn = 0; turn < TURN_COUNT; ++turn) {
+        auto earcon =
+            timeCreation(createAttachment, AttachmentBufferPool::SizeHint::SHORT_SOUND, &result.allocationTime);
+        auto speech = timeCreation(createAttachment, AttachmentBufferPool::SizeHint::SPEECH, &result.allocationTime);
+        streamThrough(earcon, EARCON_SIZE);
+        streamThrough(speech, SPEECH_SIZE);
+        result.peakRssGrowthKb = std::max(result.peakRssGrowthKb, getRssKb() - startRss);
+        earcon.reset();
+        speech.reset();
+
+        auto media =
+            timeCreation(createAttachment, AttachmentBufferPool::SizeHint::MEDIA_STREAM, &result.allocationTime);
+        streamThrough(media, MEDIA_SIZE);
+        result.peakRssGrowthKb = std::max(result.peakRssGrowthKb, getRssKb() - startRss);
+    }
+    return result;
+}
+
+/**
+ * Measure the time spent creating attachments, and the peak resident set size, of a scripted multi-turn session with
+ * buffers from a pool, and with a buffer of its own of the default size for each attachment, as before.
+ */
+TEST(AttachmentBufferPoolBenchmarkTest, multiTurnSession) {
+    // The pool stays alive through the second session, so that its idle buffers are not reused by the allocator.
+    auto pool = AttachmentBufferPool::create();
+    auto pooled = runSession([pool](AttachmentBufferPool::SizeHint hint) {
+        return std::make_shared<InProcessAttachment>("pooled", hint, pool);
+    });
+
+    auto unpooled = runSession([](AttachmentBufferPool::SizeHint hint) {
+        auto buffer = std::make_shared<InProcessSDS::Buffer>(
+            InProcessSDS::calculateBufferSize(InProcessAttachment::SDS_BUFFER_DEFAULT_SIZE_IN_BYTES));
+        return std::make_shared<InProcessAttachment>("unpooled", InProcessSDS::create(buffer));
+    });
+    auto statistics = pool->getStatistics();
+
+    ACSDK_INFO(LX("multiTurnSession")
+                   .d("turns", TURN_COUNT)
+                   .d("unpooledAllocationUs", unpooled.allocationTime.count() / 1000)
+                   .d("unpooledPeakRssGrowthKb", unpooled.peakRssGrowthKb)
+                   .d("pooledAllocationUs", pooled.allocationTime.count() / 1000)
+                   .d("pooledPeakRssGrowthKb", pooled.peakRssGrowthKb)
+                   .d("pooledBuffersAllocated", statistics.buffersAllocated)
+                   .d("pooledBuffersReused", statistics.buffersReused));
+
+    ASSERT_EQ(statistics.buffersAllocated + statistics.buffersReused, static_cast<size_t>(3 * TURN_COUNT));
+    ASSERT_LE(statistics.buffersAllocated, 3u);
+}
+
+}  // namespace test
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
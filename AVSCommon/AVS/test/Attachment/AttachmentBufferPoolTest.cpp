@@ -0,0 +1,183 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file AttachmentBufferPoolTest.cpp
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/AVS/Attachment/AttachmentBufferPool.h"
+#include "AVSCommon/AVS/Attachment/AttachmentManager.h"
+#include "AVSCommon/AVS/Attachment/InProcessAttachment.h"
+
+#include "Common/Common.h"
+
+using namespace alexaClientSDK::avsCommon::avs::attachment;
+using namespace alexaClientSDK::avsCommon::utils::sds;
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace test {
+
+/// Data written to an attachment.
+static const std::string TEST_DATA_ONE = "first attachment";
+
+/// Data written to an attachment on a reused buffer.
+static const std::string TEST_DATA_TWO = "second";
+
+/**
+ * Write a string to an attachment.
+ *
+ * @param attachment The attachment.
+ * @param data The string.
+ */
+static void writeString(std::shared_ptr<InProcessAttachment> attachment, const std::string& data) {
+    auto writer = attachment->createWriter(WriterPolicy::NONBLOCKABLE);
+    ASSERT_NE(writer, nullptr);
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    ASSERT_EQ(writer->write(data.data(), data.size(), &writeStatus), data.size());
+    writer->close();
+}
+
+/**
+ * Read an attachment which its writer has closed.
+ *
+ * @param attachment The attachment.
+ * @return The content of the attachment.
+ */
+static std::string readString(std::shared_ptr<InProcessAttachment> attachment) {
+    auto reader = attachment->createReader(ReaderPolicy::NONBLOCKING);
+    std::string content;
+    char buffer[64];
+    auto readStatus = AttachmentReader::ReadStatus::OK;
+    while (reader && AttachmentReader::ReadStatus::OK == readStatus) {
+        auto bytesRead = reader->read(buffer, sizeof(buffer), &readStatus);
+        content.append(buffer, bytesRead);
+    }
+    return content;
+}
+
+/**
+ * Verify that a buffer goes back to the pool once its attachment is gone, and that an attachment on the reused buffer
+ * holds only its own data.
+ */
+TEST(AttachmentBufferPoolTest, bufferIsReused) {
+    auto pool = AttachmentBufferPool::create();
+    auto attachment = std::make_shared<InProcessAttachment>(
+        TEST_ATTACHMENT_ID_STRING_ONE, AttachmentBufferPool::SizeHint::SPEECH, pool);
+    writeString(attachment, TEST_DATA_ONE);
+    ASSERT_EQ(readString(attachment), TEST_DATA_ONE);
+    attachment.reset();
+
+    attachment = std::make_shared<InProcessAttachment>(
+        TEST_ATTACHMENT_ID_STRING_TWO, AttachmentBufferPool::SizeHint::SPEECH, pool);
+    writeString(attachment, TEST_DATA_TWO);
+    ASSERT_EQ(readString(attachment), TEST_DATA_TWO);
+
+    auto statistics = pool->getStatistics();
+    ASSERT_EQ(statistics.buffersAllocated, 1u);
+    ASSERT_EQ(statistics.buffersReused, 1u);
+    ASSERT_EQ(statistics.buffersInUse, 1u);
+}
+
+/**
+ * Verify that a buffer stays in use while a reader of its attachment is open.
+ */
+TEST(AttachmentBufferPoolTest, bufferIsHeldByReader) {
+    auto pool = AttachmentBufferPool::create();
+    auto attachment = std::make_shared<InProcessAttachment>(
+        TEST_ATTACHMENT_ID_STRING_ONE, AttachmentBufferPool::SizeHint::SPEECH, pool);
+    auto reader = attachment->createReader(ReaderPolicy::NONBLOCKING);
+    attachment.reset();
+    ASSERT_EQ(pool->getStatistics().buffersInUse, 1u);
+    ASSERT_EQ(pool->getStatistics().idleBytes, 0u);
+
+    reader.reset();
+    ASSERT_EQ(pool->getStatistics().buffersInUse, 0u);
+    ASSERT_GT(pool->getStatistics().idleBytes, 0u);
+}
+
+/**
+ * Verify that buffers of different size classes are not mixed up.
+ */
+TEST(AttachmentBufferPoolTest, sizeClassesAreSeparate) {
+    auto pool = AttachmentBufferPool::create();
+    std::make_shared<InProcessAttachment>(
+        TEST_ATTACHMENT_ID_STRING_ONE, AttachmentBufferPool::SizeHint::SHORT_SOUND, pool);
+    std::make_shared<InProcessAttachment>(TEST_ATTACHMENT_ID_STRING_TWO, AttachmentBufferPool::SizeHint::SPEECH, pool);
+    ASSERT_EQ(pool->getStatistics().buffersAllocated, 2u);
+    ASSERT_EQ(pool->getStatistics().buffersReused, 0u);
+
+    auto sds = pool->createSDS(AttachmentBufferPool::getDataSize(AttachmentBufferPool::SizeHint::SHORT_SOUND));
+    ASSERT_NE(sds, nullptr);
+    ASSERT_EQ(sds->getDataSize(), AttachmentBufferPool::getDataSize(AttachmentBufferPool::SizeHint::SHORT_SOUND));
+    ASSERT_EQ(pool->getStatistics().buffersReused, 1u);
+}
+
+/**
+ * Verify that buffers beyond the cap on idle memory are freed.
+ */
+TEST(AttachmentBufferPoolTest, idleBuffersAreCapped) {
+    auto pool = AttachmentBufferPool::create(
+        InProcessSDS::calculateBufferSize(AttachmentBufferPool::getDataSize(AttachmentBufferPool::SizeHint::SPEECH)));
+    auto first = std::make_shared<InProcessAttachment>(
+        TEST_ATTACHMENT_ID_STRING_ONE, AttachmentBufferPool::SizeHint::SPEECH, pool);
+    auto second = std::make_shared<InProcessAttachment>(
+        TEST_ATTACHMENT_ID_STRING_TWO, AttachmentBufferPool::SizeHint::SPEECH, pool);
+    auto idleBytes = InProcessSDS::calculateBufferSize(
+        AttachmentBufferPool::getDataSize(AttachmentBufferPool::SizeHint::SPEECH));
+    first.reset();
+    second.reset();
+    ASSERT_EQ(pool->getStatistics().idleBytes, idleBytes);
+}
+
+/**
+ * Verify that a buffer outliving its pool is freed.
+ */
+TEST(AttachmentBufferPoolTest, bufferOutlivesPool) {
+    auto pool = AttachmentBufferPool::create();
+    auto attachment = std::make_shared<InProcessAttachment>(
+        TEST_ATTACHMENT_ID_STRING_ONE, AttachmentBufferPool::SizeHint::SHORT_SOUND, pool);
+    pool.reset();
+    writeString(attachment, TEST_DATA_ONE);
+    ASSERT_EQ(readString(attachment), TEST_DATA_ONE);
+}
+
+/**
+ * Verify that an @c AttachmentManager takes the buffers of its attachments from its pool, and returns them once the
+ * reader and writer of an attachment are gone.
+ */
+TEST(AttachmentBufferPoolTest, attachmentManagerUsesPool) {
+    auto pool = AttachmentBufferPool::create();
+    AttachmentManager manager(AttachmentManager::AttachmentType::IN_PROCESS, pool);
+    for (int i = 0; i < 3; ++i) {
+        auto writer = manager.createWriter(TEST_ATTACHMENT_ID_STRING_ONE);
+        auto reader = manager.createReader(TEST_ATTACHMENT_ID_STRING_ONE, ReaderPolicy::NONBLOCKING);
+        ASSERT_NE(writer, nullptr);
+        ASSERT_NE(reader, nullptr);
+    }
+    auto statistics = pool->getStatistics();
+    ASSERT_EQ(statistics.buffersAllocated, 1u);
+    ASSERT_EQ(statistics.buffersReused, 2u);
+    ASSERT_EQ(statistics.buffersInUse, 0u);
+}
+
+}  // namespace test
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -13,6 +13,12 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
@@ -230,6 +236,102 @@ TEST_F(AttachmentReaderTest, testAttachmentReaderMultipleReadsOfUnfinishedData)
     testMultipleReads(true);
 }
 
+/**
+ * Test that the data available callback is called when data is written, and is no longer called once cleared.
+ */
+TEST_F(AttachmentReaderTest, testAttachmentReaderDataAvailableCallback) {
+    init();
+
+    int numCalls = 0;
+    ASSERT_TRUE(m_reader->setDataAvailableCallback([&numCalls] { ++numCalls; }));
+
+    auto numWritten = m_writer->write(m_testPattern.data(), TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES);
+    ASSERT_EQ(numWritten, TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES);
+    ASSERT_GT(numCalls, 0);
+
+    ASSERT_TRUE(m_reader->setDataAvailableCallback(nullptr));
+    auto numCallsBeforeClear = numCalls;
+    numWritten = m_writer->write(m_testPattern.data(), TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES);
+    ASSERT_EQ(numWritten, TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES);
+    ASSERT_EQ(numCalls, numCallsBeforeClear);
+}
+
+/**
+ * Test that data which wraps around the end of the buffer can be peeked in place, and is consumed only when committed.
+ */
+TEST_F(AttachmentReaderTest, testAttachmentReaderPeekAndCommit) {
+    init();
+
+    // Write and read part of the buffer, then refill it so that the unread data wraps around its end.
+    auto numWritten = m_writer->write(m_testPattern.data(), TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+    ASSERT_EQ(numWritten, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+    std::vector<uint8_t> result(TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES);
+    auto readStatus = InProcessAttachmentReader::ReadStatus::OK;
+    auto numRead = m_reader->read(result.data(), result.size(), &readStatus);
+    ASSERT_EQ(numRead, result.size());
+    numWritten = m_writer->write(m_testPattern.data(), m_testPattern.size());
+    ASSERT_EQ(numWritten, static_cast<ssize_t>(m_testPattern.size()));
+
+    InProcessAttachmentReader::Span first;
+    InProcessAttachmentReader::Span second;
+    auto numPeeked = m_reader->peek(&first, &second, m_testPattern.size(), &readStatus);
+    ASSERT_EQ(numPeeked, m_testPattern.size());
+    ASSERT_EQ(readStatus, InProcessAttachmentReader::ReadStatus::OK);
+    ASSERT_EQ(first.nWords + second.nWords, m_testPattern.size());
+    ASSERT_GT(second.nWords, 0U);
+    auto firstData = static_cast<const uint8_t*>(first.data);
+    auto secondData = static_cast<const uint8_t*>(second.data);
+    ASSERT_TRUE(std::equal(firstData, firstData + first.nWords, m_testPattern.begin()));
+    ASSERT_TRUE(std::equal(secondData, secondData + second.nWords, m_testPattern.begin() + first.nWords));
+    ASSERT_EQ(m_reader->getNumUnreadBytes(), m_testPattern.size());
+
+    auto numCommitted = m_reader->commit(TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES, &readStatus);
+    ASSERT_EQ(numCommitted, static_cast<size_t>(TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES));
+    ASSERT_EQ(readStatus, InProcessAttachmentReader::ReadStatus::OK);
+    ASSERT_EQ(m_reader->getNumUnreadBytes(), m_testPattern.size() - TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES);
+
+    numRead = m_reader->read(result.data(), result.size(), &readStatus);
+    ASSERT_EQ(numRead, result.size());
+    ASSERT_TRUE(
+        std::equal(result.begin(), result.end(), m_testPattern.begin() + TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES));
+}
+
+#ifdef SHARED_MEMORY_SDS
+/**
+ * Test reading, through a @c SharedMemoryAttachmentReader, a stream which was created in shared memory and then opened
+ * by name, as a stream written by another process would be.
+ */
+TEST_F(AttachmentReaderTest, testSharedMemoryAttachmentReaderReadsStreamOpenedByName) {
+    std::string name = "/AttachmentReaderTest." + std::to_string(getpid());
+    auto bufferSize = SharedMemorySDS::calculateBufferSize(TEST_SDS_BUFFER_SIZE_IN_BYTES);
+    auto createdBuffer = SharedMemoryBuffer::create(name, bufferSize);
+    ASSERT_NE(createdBuffer, nullptr);
+    auto createdStream = SharedMemorySDS::create(createdBuffer);
+    ASSERT_NE(createdStream, nullptr);
+
+    auto openedBuffer = SharedMemoryBuffer::open(name);
+    ASSERT_NE(openedBuffer, nullptr);
+    std::shared_ptr<SharedMemorySDS> openedStream = SharedMemorySDS::open(openedBuffer);
+    ASSERT_NE(openedStream, nullptr);
+    auto reader = SharedMemoryAttachmentReader::create(SharedMemorySDS::Reader::Policy::NONBLOCKING, openedStream);
+    ASSERT_NE(reader, nullptr);
+    // Observers can not be called across processes, so the reader must be polled.
+    ASSERT_FALSE(reader->setDataAvailableCallback([] {}));
+
+    auto writer = createdStream->createWriter(SharedMemorySDS::Writer::Policy::NONBLOCKABLE);
+    ASSERT_NE(writer, nullptr);
+    m_testPattern = createTestPattern(TEST_SDS_BUFFER_SIZE_IN_BYTES);
+    ASSERT_EQ(writer->write(m_testPattern.data(), m_testPattern.size()), static_cast<ssize_t>(m_testPattern.size()));
+
+    std::vector<uint8_t> result(m_testPattern.size());
+    auto readStatus = AttachmentReader::ReadStatus::OK;
+    auto numRead = reader->read(result.data(), result.size(), &readStatus);
+    ASSERT_EQ(numRead, m_testPattern.size());
+    ASSERT_EQ(readStatus, AttachmentReader::ReadStatus::OK);
+    ASSERT_EQ(result, m_testPattern);
+}
+#endif  // SHARED_MEMORY_SDS
+
 }  // namespace test
 }  // namespace avs
 }  // namespace avsCommon
@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
@@ -184,6 +186,61 @@ TEST_F(AttachmentWriterTest, testAttachmentWriterAndReaderMultipleReadsOfUnfinis
     testMultipleReads(false);
 }
 
+/**
+ * Test that the space available callback is called when a reader frees space, and is no longer called once cleared.
+ */
+TEST_F(AttachmentWriterTest, testAttachmentWriterSpaceAvailableCallback) {
+    init();
+
+    int numCalls = 0;
+    ASSERT_TRUE(m_writer->setSpaceAvailableCallback([&numCalls] { ++numCalls; }));
+
+    auto writeStatus = InProcessAttachmentWriter::WriteStatus::OK;
+    auto numWritten = m_writer->write(m_testPattern.data(), m_testPattern.size(), &writeStatus);
+    ASSERT_EQ(numWritten, m_testPattern.size());
+
+    std::vector<uint8_t> result(TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES);
+    auto readStatus = InProcessAttachmentReader::ReadStatus::OK;
+    auto numRead = m_reader->read(result.data(), result.size(), &readStatus);
+    ASSERT_EQ(numRead, result.size());
+    ASSERT_GT(numCalls, 0);
+
+    ASSERT_TRUE(m_writer->setSpaceAvailableCallback(nullptr));
+    auto numCallsBeforeClear = numCalls;
+    numRead = m_reader->read(result.data(), result.size(), &readStatus);
+    ASSERT_EQ(numRead, result.size());
+    ASSERT_EQ(numCalls, numCallsBeforeClear);
+}
+
+/**
+ * Test that space reserved by the writer can be filled in place, and is visible to the reader only once committed.
+ */
+TEST_F(AttachmentWriterTest, testAttachmentWriterReserveAndCommit) {
+    init();
+
+    InProcessAttachmentWriter::Span first;
+    InProcessAttachmentWriter::Span second;
+    auto writeStatus = InProcessAttachmentWriter::WriteStatus::OK;
+    auto numReserved = m_writer->reserve(&first, &second, m_testPattern.size(), &writeStatus);
+    ASSERT_EQ(numReserved, m_testPattern.size());
+    ASSERT_EQ(writeStatus, InProcessAttachmentWriter::WriteStatus::OK);
+    ASSERT_EQ(first.nWords + second.nWords, m_testPattern.size());
+    std::copy(m_testPattern.begin(), m_testPattern.begin() + first.nWords, static_cast<uint8_t*>(first.data));
+    std::copy(m_testPattern.begin() + first.nWords, m_testPattern.end(), static_cast<uint8_t*>(second.data));
+    ASSERT_EQ(m_reader->getNumUnreadBytes(), 0U);
+
+    auto numCommitted = m_writer->commit(TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES, &writeStatus);
+    ASSERT_EQ(numCommitted, static_cast<size_t>(TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES));
+    ASSERT_EQ(writeStatus, InProcessAttachmentWriter::WriteStatus::OK);
+    ASSERT_EQ(m_reader->getNumUnreadBytes(), static_cast<uint64_t>(TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES));
+
+    std::vector<uint8_t> result(m_testPattern.size());
+    auto readStatus = InProcessAttachmentReader::ReadStatus::OK;
+    auto numRead = m_reader->read(result.data(), result.size(), &readStatus);
+    ASSERT_EQ(numRead, static_cast<size_t>(TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES));
+    ASSERT_TRUE(std::equal(result.begin(), result.begin() + numRead, m_testPattern.begin()));
+}
+
 }  // namespace test
 }  // namespace avs
 }  // namespace avsCommon
@@ -0,0 +1,205 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file EventBuilderBenchmarkTest.cpp
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include "AVSCommon/AVS/EventBuilder.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/UUIDGeneration/UUIDGeneration.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace test {
+
+using namespace rapidjson;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("EventBuilderBenchmarkTest");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The sizes of context, and of payload, measured.
+static const size_t FRAGMENT_SIZES[] = {256, 4 * 1024, 32 * 1024, 256 * 1024};
+
+/// The total size of the events built for each fragment size, which sets the number of events.
+static const size_t BYTES_PER_MEASUREMENT = 16 * 1024 * 1024;
+
+/// The namespace of the events.
+static const std::string NAMESPACE("SpeechRecognizer");
+
+/// The name of the events.
+static const std::string NAME("Recognize");
+
+/// The dialog request id of the events.
+static const std::string DIALOG_REQUEST_ID("DialogRequestId_Test");
+
+/**
+ * Builds an event the way @c buildJsonEventString() did before it spliced fragments: the context is parsed and copied
+ * into a new document, the payload is parsed, a header DOM is built, and the whole document is serialized.
+ *
+ * @param nameSpace The namespace of the event.
+ * @param eventName The name of the event.
+ * @param dialogRequestIdValue The dialog request id of the event.
+ * @param jsonPayloadValue The payload of the event.
+ * @param jsonContext The context of the event.
+ * @return The event, or an empty string if it could not be built.
+ */
+static std::string buildJsonEventStringWithDom(
+    const std::string& nameSpace,
+    const std::string& eventName,
+    const std::string& dialogRequestIdValue,
+    const std::string& jsonPayloadValue,
+    const std::string& jsonContext) {
+    Document eventAndContext(kObjectType);
+    Document::AllocatorType& allocator = eventAndContext.GetAllocator();
+    if (!jsonContext.empty()) {
+        Document context(kObjectType);
+        if (context.Parse(jsonContext).HasParseError()) {
+            return "";
+        }
+        eventAndContext.CopyFrom(context, allocator);
+    }
+    Document header(kObjectType);
+    header.AddMember("namespace", nameSpace, allocator);
+    header.AddMember("name", eventName, allocator);
+    header.AddMember("messageId", utils::uuidGeneration::generateUUID(), allocator);
+    if (!dialogRequestIdValue.empty()) {
+        header.AddMember("dialogRequestId", dialogRequestIdValue, allocator);
+    }
+    Document payload(&allocator);
+    if (payload.Parse(jsonPayloadValue).HasParseError()) {
+        return "";
+    }
+    Document event(kObjectType);
+    event.AddMember("header", header, allocator);
+    event.AddMember("payload", payload, allocator);
+    eventAndContext.AddMember("event", event, allocator);
+
+    StringBuffer buffer;
+    Writer<StringBuffer> writer(buffer);
+    if (!eventAndContext.Accept(writer)) {
+        return "";
+    }
+    return buffer.GetString();
+}
+
+/**
+ * Builds a context of about the given size, made of states like those of the capability agents.
+ *
+ * @param size The approximate size.
+ * @return The context.
+ */
+static std::string buildContext(size_t size) {
+    std::string context = "{\"context\":[";
+    for (int i = 0; context.size() < size; ++i) {
+        if (i > 0) {
+            context += ",";
+        }
+        context += "{\"header\":{\"namespace\":\"Namespace" + std::to_string(i) +
+                   "\",\"name\":\"State\"},\"payload\":{\"playerActivity\":\"FINISHED\",\"offsetInMilliseconds\":" +
+                   std::to_string(i * 1000) + ",\"token\":\"token-" + std::to_string(i) + "\",\"volume\":0.5}}";
+    }
+    return context + "]}";
+}
+
+/**
+ * Builds a payload of about the given size.
+ *
+ * @param size The approximate size.
+ * @return The payload.
+ */
+static std::string buildPayload(size_t size) {
+    std::string payload = "{\"profile\":\"CLOSE_TALK\",\"format\":\"AUDIO_L16_RATE_16000_CHANNELS_1\",\"items\":[";
+    for (int i = 0; payload.size() < size; ++i) {
+        if (i > 0) {
+            payload += ",";
+        }
+        payload += "{\"id\":" + std::to_string(i) + ",\"text\":\"item \\\"" + std::to_string(i) + "\\\"\"}";
+    }
+    return payload + "]}";
+}
+
+/**
+ * Removes the messageId from the header of an event.
+ *
+ * @param event The event.
+ */
+static void removeMessageId(Document* event) {
+    (*event)["event"]["header"].RemoveMember("messageId");
+}
+
+/**
+ * Measure the time to build a Recognize event with the DOM-based builder and with the fragment splicing builder, for
+ * contexts and payloads of several sizes, and verify that both build the same event.
+ */
+TEST(EventBuilderBenchmarkTest, buildEventAcrossSizes) {
+    for (auto size : FRAGMENT_SIZES) {
+        auto context = buildContext(size);
+        auto payload = buildPayload(size);
+        auto iterations = std::max<size_t>(1, BYTES_PER_MEASUREMENT / (context.size() + payload.size()));
+
+        std::string domEvent;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            domEvent = buildJsonEventStringWithDom(NAMESPACE, NAME, DIALOG_REQUEST_ID, payload, context);
+        }
+        auto domTime = std::chrono::steady_clock::now() - start;
+
+        std::pair<std::string, std::string> splicedEvent;
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            splicedEvent = buildJsonEventString(NAMESPACE, NAME, DIALOG_REQUEST_ID, payload, context);
+        }
+        auto splicedTime = std::chrono::steady_clock::now() - start;
+
+        auto domNs = std::chrono::duration_cast<std::chrono::nanoseconds>(domTime).count() / iterations;
+        auto splicedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(splicedTime).count() / iterations;
+        ACSDK_INFO(LX("buildEventAcrossSizes")
+                       .d("contextBytes", context.size())
+                       .d("payloadBytes", payload.size())
+                       .d("iterations", iterations)
+                       .d("domNsPerEvent", domNs)
+                       .d("splicedNsPerEvent", splicedNs));
+
+        Document expected;
+        Document actual;
+        ASSERT_FALSE(expected.Parse(domEvent).HasParseError());
+        ASSERT_FALSE(actual.Parse(splicedEvent.second).HasParseError());
+        removeMessageId(&expected);
+        removeMessageId(&actual);
+        ASSERT_TRUE(expected == actual);
+    }
+}
+
+}  // namespace test
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
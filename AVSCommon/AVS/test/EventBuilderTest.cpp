@@ -0,0 +1,124 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file EventBuilderTest.cpp
+
+#include <string>
+
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+
+#include "AVSCommon/AVS/EventBuilder.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace test {
+
+using namespace rapidjson;
+
+/// The namespace of the test event.
+static const std::string NAMESPACE_TEST("Namespace_Test");
+
+/// The name of the test event, which needs escaping.
+static const std::string NAME_TEST("Name\"Test\\");
+
+/// The dialog request id of the test event.
+static const std::string DIALOG_REQUEST_ID_TEST("DialogRequestId_Test");
+
+/// The payload of the test event, with whitespace which is kept.
+static const std::string PAYLOAD_TEST("{ \"key\" : [1, 2, 3] }");
+
+/// A context with two states.
+static const std::string CONTEXT_TEST(
+    " {\"context\":[{\"header\":{\"namespace\":\"A\",\"name\":\"B\"},\"payload\":{}}],\"extra\":true}\n");
+
+/**
+ * Verify that an event with a context and a dialog request id has the context's members, the header and the payload.
+ */
+TEST(EventBuilderTest, eventWithContextAndDialogRequestId) {
+    auto messageIdAndEvent =
+        buildJsonEventString(NAMESPACE_TEST, NAME_TEST, DIALOG_REQUEST_ID_TEST, PAYLOAD_TEST, CONTEXT_TEST);
+    ASSERT_FALSE(messageIdAndEvent.first.empty());
+
+    Document event;
+    ASSERT_FALSE(event.Parse(messageIdAndEvent.second).HasParseError());
+    ASSERT_TRUE(event.IsObject());
+    ASSERT_EQ(event.MemberCount(), 3u);
+    ASSERT_TRUE(event["context"].IsArray());
+    ASSERT_TRUE(event["extra"].GetBool());
+
+    auto& header = event["event"]["header"];
+    ASSERT_EQ(std::string(header["namespace"].GetString()), NAMESPACE_TEST);
+    ASSERT_EQ(std::string(header["name"].GetString()), NAME_TEST);
+    ASSERT_EQ(std::string(header["messageId"].GetString()), messageIdAndEvent.first);
+    ASSERT_EQ(std::string(header["dialogRequestId"].GetString()), DIALOG_REQUEST_ID_TEST);
+    ASSERT_EQ(event["event"]["payload"]["key"].Size(), 3u);
+}
+
+/**
+ * Verify that an event without a context, dialog request id or payload has only a header.
+ */
+TEST(EventBuilderTest, eventWithoutContextOrPayload) {
+    auto messageIdAndEvent = buildJsonEventString(NAMESPACE_TEST, NAME_TEST, "", "", "");
+    Document event;
+    ASSERT_FALSE(event.Parse(messageIdAndEvent.second).HasParseError());
+    ASSERT_EQ(event.MemberCount(), 1u);
+    ASSERT_EQ(event["event"].MemberCount(), 1u);
+    ASSERT_FALSE(event["event"]["header"].HasMember("dialogRequestId"));
+}
+
+/**
+ * Verify that an empty context object adds no members.
+ */
+TEST(EventBuilderTest, eventWithEmptyContext) {
+    auto messageIdAndEvent = buildJsonEventString(NAMESPACE_TEST, NAME_TEST, "", PAYLOAD_TEST, " { } ");
+    Document event;
+    ASSERT_FALSE(event.Parse(messageIdAndEvent.second).HasParseError());
+    ASSERT_EQ(event.MemberCount(), 1u);
+}
+
+/**
+ * Verify that a malformed payload, or a context which is malformed or not an object, fails the event.
+ */
+TEST(EventBuilderTest, malformedFragmentsFail) {
+    ASSERT_TRUE(buildJsonEventString(NAMESPACE_TEST, NAME_TEST, "", "{\"key\":", CONTEXT_TEST).second.empty());
+    ASSERT_TRUE(buildJsonEventString(NAMESPACE_TEST, NAME_TEST, "", "{} {}", CONTEXT_TEST).second.empty());
+    ASSERT_TRUE(buildJsonEventString(NAMESPACE_TEST, NAME_TEST, "", PAYLOAD_TEST, "{\"context\":[}").second.empty());
+    ASSERT_TRUE(buildJsonEventString(NAMESPACE_TEST, NAME_TEST, "", PAYLOAD_TEST, "[{}]").second.empty());
+}
+
+/// Verify that an event started ahead of its payload is completed into the same event as one built all at once.
+TEST(EventBuilderTest, eventCompletedFromPrefix) {
+    auto messageIdAndPrefix = buildJsonEventPrefix(NAMESPACE_TEST, NAME_TEST, DIALOG_REQUEST_ID_TEST, CONTEXT_TEST);
+    ASSERT_FALSE(messageIdAndPrefix.first.empty());
+    ASSERT_FALSE(messageIdAndPrefix.second.empty());
+    auto event = completeJsonEventString(messageIdAndPrefix.second, PAYLOAD_TEST);
+
+    auto expected = buildJsonEventString(NAMESPACE_TEST, NAME_TEST, DIALOG_REQUEST_ID_TEST, PAYLOAD_TEST, CONTEXT_TEST);
+    auto messageIdPosition = expected.second.find(expected.first);
+    ASSERT_NE(messageIdPosition, std::string::npos);
+    expected.second.replace(messageIdPosition, expected.first.size(), messageIdAndPrefix.first);
+    ASSERT_EQ(event, expected.second);
+
+    ASSERT_TRUE(completeJsonEventString(messageIdAndPrefix.second, "{\"key\":").empty());
+    ASSERT_TRUE(completeJsonEventString("", PAYLOAD_TEST).empty());
+    ASSERT_TRUE(buildJsonEventPrefix(NAMESPACE_TEST, NAME_TEST, "", "[{}]").second.empty());
+}
+
+}  // namespace test
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/AVS/MessageRequest.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace test {
+
+/// An event for testing.
+static const std::string EVENT_JSON =
+    "{\"context\":[],\"event\":{\"header\":{\"namespace\":\"SpeechSynthesizer\",\"name\":\"SpeechStarted\","
+    "\"messageId\":\"1\"},\"payload\":{}}}";
+
+/// An event whose context holds headers of its own, ahead of the event.
+static const std::string EVENT_WITH_CONTEXT_JSON =
+    "{\"context\":[{\"header\":{\"namespace\":\"AudioPlayer\",\"name\":\"PlaybackState\"},\"payload\":{}}],"
+    "\"event\":{\"header\":{\"namespace\":\"SpeechSynthesizer\",\"name\":\"SpeechStarted\","
+    "\"messageId\":\"1\"},\"payload\":{\"header\":{\"namespace\":\"Other\"}}}}";
+
+/// The namespace of @c EVENT_JSON.
+static const std::string EVENT_NAMESPACE = "SpeechSynthesizer";
+
+/// An ordering key for testing.
+static const std::string ORDERING_KEY = "testOrderingKey";
+
+/// MessageRequestTest
+class MessageRequestTest : public ::testing::Test {};
+
+/**
+ * Verify that the ordering key defaults to the namespace of the event.
+ */
+TEST_F(MessageRequestTest, testOrderingKeyDefaultsToNamespace) {
+    MessageRequest request(EVENT_JSON);
+    ASSERT_EQ(request.getOrderingKey(), EVENT_NAMESPACE);
+}
+
+/**
+ * Verify that the ordering key is the namespace in the header of the event, not a namespace elsewhere in the content.
+ */
+TEST_F(MessageRequestTest, testOrderingKeyIgnoresContext) {
+    MessageRequest request(EVENT_WITH_CONTEXT_JSON);
+    ASSERT_EQ(request.getOrderingKey(), EVENT_NAMESPACE);
+}
+
+/**
+ * Verify that an ordering key which has been set overrides the namespace of the event.
+ */
+TEST_F(MessageRequestTest, testSetOrderingKey) {
+    MessageRequest request(EVENT_JSON);
+    request.setOrderingKey(ORDERING_KEY);
+    ASSERT_EQ(request.getOrderingKey(), ORDERING_KEY);
+}
+
+/**
+ * Verify that content without an event namespace has an empty ordering key.
+ */
+TEST_F(MessageRequestTest, testOrderingKeyWithoutNamespace) {
+    MessageRequest request("{}");
+    ASSERT_TRUE(request.getOrderingKey().empty());
+}
+
+/**
+ * Verify that a request has normal priority and no deadline unless they are set.
+ */
+TEST_F(MessageRequestTest, testPriorityAndDeadline) {
+    MessageRequest request(EVENT_JSON);
+    ASSERT_EQ(request.getPriority(), MessageRequest::Priority::NORMAL);
+    ASSERT_EQ(request.getDeadline(), std::chrono::steady_clock::time_point::max());
+
+    auto deadline = std::chrono::steady_clock::now();
+    request.setPriority(MessageRequest::Priority::INTERACTIVE);
+    request.setDeadline(deadline);
+    ASSERT_EQ(request.getPriority(), MessageRequest::Priority::INTERACTIVE);
+    ASSERT_EQ(request.getDeadline(), deadline);
+}
+
+}  // namespace test
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
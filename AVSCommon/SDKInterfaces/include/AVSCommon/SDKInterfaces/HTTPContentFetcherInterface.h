@@ -35,7 +35,14 @@ public:
         CONTENT_TYPE,
 
         /// Retrieves the entire body of the remote location.
-        ENTIRE_BODY
+        ENTIRE_BODY,
+
+        /**
+         * Retrieves the content type and streams the body from the same response.  Unlike @c ENTIRE_BODY, the transfer
+         * stops once the fetcher is destroyed, so this may be used on a URL which turns out to be a live stream.
+         * Implementations which do not support this return @c nullptr from @c getContent().
+         */
+        CONTENT_TYPE_AND_BODY
     };
 
     /**
@@ -18,6 +18,7 @@
 
 #include <limits>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "AVSCommon/AVS/AudioInputStream.h"
@@ -60,6 +61,28 @@ public:
         avs::AudioInputStream::Index beginIndex = UNSPECIFIED_INDEX,
         avs::AudioInputStream::Index endIndex = UNSPECIFIED_INDEX,
         std::shared_ptr<const std::vector<char>> KWDMetadata = nullptr) = 0;
+
+    /**
+     * Used to notify the observer that the wake word engine has heard what may be a keyword, before it has confirmed
+     * it.  The observer may use this to start work which a detection would need, and should undo it if
+     * @c onKeyWordRejected() follows instead of @c onKeyWordDetected().  Only engines which score a keyword in
+     * stages report candidates.  The same rules apply as for @c onKeyWordDetected(): return as soon as possible.
+     *
+     * @param stream The stream in which the keyword may have been spoken.
+     * @param keyword The keyword which may have been spoken.
+     */
+    virtual void onKeyWordCandidate(std::shared_ptr<avs::AudioInputStream> stream, std::string keyword) {
+    }
+
+    /**
+     * Used to notify the observer that the wake word engine has rejected the candidate it reported with
+     * @c onKeyWordCandidate().
+     *
+     * @param stream The stream in which the candidate was heard.
+     * @param keyword The keyword of the candidate.
+     */
+    virtual void onKeyWordRejected(std::shared_ptr<avs::AudioInputStream> stream, std::string keyword) {
+    }
 };
 
 }  // namespace sdkInterfaces
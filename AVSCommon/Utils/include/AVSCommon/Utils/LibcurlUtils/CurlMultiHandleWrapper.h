@@ -88,6 +88,18 @@ public:
      */
     CURLMcode wait(std::chrono::milliseconds timeout, int* countHandlesUpdated);
 
+    /**
+     * Wait for actions to perform on the @c libcurl @c handles added to this @c libcurl @c multi @c handle, or for an
+     * additional file descriptor to become readable.  This lets another thread end the wait early.
+     *
+     * @param timeout How long to wait for actions to perform.
+     * @param[out] countHandlesUpdated The number of handles for which actions are ready.  This does not count
+     * @c wakeupFd, so a wake-up alone leaves it zero and is not mistaken for network activity.
+     * @param wakeupFd A file descriptor which ends the wait when it becomes readable.
+     * @return @c libcurl code indicating the result of this operation.
+     */
+    CURLMcode wait(std::chrono::milliseconds timeout, int* countHandlesUpdated, int wakeupFd);
+
     /**
      * Receive the next messages about the @c libcurl @c handles added to this @c libcurl @c multi @c handle.
      *
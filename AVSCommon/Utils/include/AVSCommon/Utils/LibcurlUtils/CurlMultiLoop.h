@@ -0,0 +1,197 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_CURLMULTILOOP_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_CURLMULTILOOP_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <curl/curl.h>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <AVSCommon/Utils/LibcurlUtils/CurlMultiHandleWrapper.h>
+#include <AVSCommon/Utils/LibcurlUtils/WakeupPipe.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+
+/**
+ * A single thread which performs any number of @c libcurl transfers with one @c CurlMultiHandleWrapper.
+ *
+ * Transfers on the same loop reuse each other's connections, and share a @c libcurl share handle which caches DNS
+ * lookups, TLS sessions and (where @c libcurl supports it) connections, so that fetching many small resources from
+ * the same host pays for name resolution and the TLS handshake once rather than once per resource.
+ *
+ * Every @c libcurl callback of a transfer, and every task posted for it, runs on the loop's thread.  They must not
+ * block, because that would stall every other transfer: a write callback which cannot deliver its data should
+ * return @c CURL_WRITEFUNC_PAUSE and post a task which resumes the transfer with @c curl_easy_pause() once it can.
+ */
+class CurlMultiLoop {
+public:
+    /**
+     * Create a CurlMultiLoop, and start its thread.
+     *
+     * @return The new @c CurlMultiLoop, or @c nullptr if the operation fails.
+     */
+    static std::shared_ptr<CurlMultiLoop> create();
+
+    /**
+     * Destructor, which stops any transfers still running without calling their completion functions, and joins the
+     * loop's thread.
+     */
+    ~CurlMultiLoop();
+
+    /**
+     * Start a transfer on the loop.  The handle is attached to the loop's share handle.
+     *
+     * @param handle The @c libcurl easy handle of the transfer, which must stay valid until @c removeTransfer().
+     * @param onDone The function to call on the loop's thread once the transfer ends, with its result.  It is called
+     *     with @c CURLE_FAILED_INIT if the transfer could not be started.
+     * @return Whether the transfer was accepted.
+     */
+    bool addTransfer(CURL* handle, std::function<void(CURLcode)> onDone);
+
+    /**
+     * Stop a transfer if it is still running, and forget it.  Once this returns, none of the transfer's callbacks or
+     * tasks are running and none will be called again, so the handle may be destroyed.  This must not be called from
+     * the transfer's own callbacks or tasks.
+     *
+     * @param handle The @c libcurl easy handle passed to @c addTransfer().
+     */
+    void removeTransfer(CURL* handle);
+
+    /**
+     * Run a task on the loop's thread, unless the transfer is removed first.  Tasks may still be posted for a
+     * transfer which has ended, until it is removed.  This may be called from any thread.
+     *
+     * @param handle The @c libcurl easy handle of the transfer the task belongs to.
+     * @param task The task.
+     * @param delay How long to wait before running the task.
+     */
+    void post(CURL* handle, std::function<void()> task, std::chrono::milliseconds delay = std::chrono::milliseconds(0));
+
+private:
+    /// A transfer known to the loop.
+    struct Transfer {
+        /// The function to call when the transfer ends.
+        std::function<void(CURLcode)> onDone;
+        /// Whether the handle is currently added to the multi handle.
+        bool isRunning;
+    };
+
+    /// A task posted with @c post().
+    struct Task {
+        /// The handle of the transfer the task belongs to.
+        CURL* handle;
+        /// When the task is due.
+        std::chrono::steady_clock::time_point due;
+        /// The task.
+        std::function<void()> task;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param multi The multi handle which performs the transfers.
+     * @param share The share handle which the transfers use.
+     * @param wakeupPipe The pipe which wakes the loop when work is queued for it.
+     */
+    CurlMultiLoop(
+        std::unique_ptr<CurlMultiHandleWrapper> multi,
+        CURLSH* share,
+        std::shared_ptr<WakeupPipe> wakeupPipe);
+
+    /// The loop's thread, which runs until @c m_isShuttingDown is set.
+    void loop();
+
+    /**
+     * Run the tasks which are due, and return how long to wait for the next one.
+     *
+     * @param maxWait The longest wait to return.
+     * @return How long the loop may wait before running tasks again.
+     */
+    std::chrono::milliseconds runTasks(std::chrono::milliseconds maxWait);
+
+    /// Call the completion functions of the transfers which have ended.
+    void completeTransfers();
+
+    /**
+     * Stop and forget a transfer on the loop's thread.
+     *
+     * @param handle The handle of the transfer.
+     */
+    void removeTransferInLoop(CURL* handle);
+
+    /**
+     * Queue a command for the loop's thread.
+     *
+     * @param command The command.
+     */
+    void queueCommand(std::function<void()> command);
+
+    /// The lock function of the share handle.
+    static void lockShare(CURL* handle, curl_lock_data data, curl_lock_access access, void* userPointer);
+
+    /// The unlock function of the share handle.
+    static void unlockShare(CURL* handle, curl_lock_data data, void* userPointer);
+
+    /// The multi handle which performs the transfers, which is only used on the loop's thread.
+    std::unique_ptr<CurlMultiHandleWrapper> m_multi;
+
+    /// The share handle which the transfers use.
+    CURLSH* m_share;
+
+    /// A lock for each kind of data in the share handle.
+    std::mutex m_shareMutexes[CURL_LOCK_DATA_LAST];
+
+    /// The pipe which wakes the loop when work is queued for it.
+    std::shared_ptr<WakeupPipe> m_wakeupPipe;
+
+    /// The transfers known to the loop, which are only used on the loop's thread.
+    std::unordered_map<CURL*, Transfer> m_transfers;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// Notified when the loop has run a command.
+    std::condition_variable m_commandDone;
+
+    /// Commands queued by other threads.
+    std::deque<std::function<void()>> m_commands;
+
+    /// Tasks posted with @c post().
+    std::vector<Task> m_tasks;
+
+    /// Whether the loop is stopping.
+    bool m_isShuttingDown;
+
+    /// The loop's thread.
+    std::thread m_thread;
+};
+
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_CURLMULTILOOP_H_
@@ -17,10 +17,12 @@
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_HTTPCONTENTFETCHERFACTORY_H_
 
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterface.h>
 #include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterfaceFactoryInterface.h>
+#include <AVSCommon/Utils/LibcurlUtils/CurlMultiLoop.h>
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -29,10 +31,20 @@ namespace libcurlUtils {
 
 /**
  * A class that produces @c HTTPContentFetchers.
+ *
+ * The fetchers produced by one factory perform their transfers on a shared @c CurlMultiLoop, so that they reuse each
+ * other's connections, DNS lookups and TLS sessions.  The loop's thread is started by the first call to @c create().
  */
 class HTTPContentFetcherFactory : public avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface {
 public:
     std::unique_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> create(const std::string& url) override;
+
+private:
+    /// Serializes access to @c m_loop.
+    std::mutex m_mutex;
+
+    /// The loop shared by the fetchers, which the fetchers keep alive for as long as they need it.
+    std::shared_ptr<CurlMultiLoop> m_loop;
 };
 
 }  // namespace libcurlUtils
@@ -17,12 +17,16 @@
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_LIBCURLHTTPCONTENTFETCHER_H_
 
 #include <atomic>
+#include <condition_variable>
 #include <future>
+#include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterface.h>
 #include <AVSCommon/Utils/LibcurlUtils/CurlEasyHandleWrapper.h>
+#include <AVSCommon/Utils/LibcurlUtils/CurlMultiLoop.h>
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -32,10 +36,20 @@ namespace libcurlUtils {
 /**
  * A class used to retrieve content from remote URLs. Note that this object will only write to the Attachment while it
  * remains alive. If the object goes out of scope, writing to the Attachment will abort.
+ *
+ * A fetcher either performs its transfer on a thread of its own, or, if it is given a @c CurlMultiLoop, as one of the
+ * loop's transfers.  On a loop, consecutive fetches from the same host reuse the connection, the DNS lookup and the TLS
+ * session, and a full @c AttachmentWriter pauses the transfer instead of blocking the loop.
  */
 class LibCurlHttpContentFetcher : public avsCommon::sdkInterfaces::HTTPContentFetcherInterface {
 public:
-    LibCurlHttpContentFetcher(const std::string& url);
+    /**
+     * Constructor.
+     *
+     * @param url The URL to fetch from.
+     * @param loop The loop to perform the transfer on, or @c nullptr to perform it on a thread of its own.
+     */
+    LibCurlHttpContentFetcher(const std::string& url, std::shared_ptr<CurlMultiLoop> loop = nullptr);
 
     /**
      * @copydoc
@@ -60,10 +74,86 @@ private:
     /// A no-op callback to not parse HTTP bodies.
     static size_t noopCallback(char* data, size_t size, size_t nmemb, void* userData);
 
+    /// The callback to abort a stalled transfer once the fetcher is being destroyed.
+    static int progressCallback(
+        void* userData,
+        curl_off_t downloadTotal,
+        curl_off_t downloaded,
+        curl_off_t uploadTotal,
+        curl_off_t uploaded);
+
+    /// The outcome of writing to @c m_streamWriter without blocking.
+    enum class WriteResult {
+        /// All the data was written.
+        WRITTEN,
+        /// The writer is full, and the rest of the data has to wait for a reader.
+        FULL,
+        /// The writer failed or was closed.
+        FAILED
+    };
+
+    /**
+     * Start the transfer on @c m_loop.
+     *
+     * @param fetchOption The option passed to @c getContent().
+     * @param writerWasCreatedLocally Whether this object created @c m_streamWriter.
+     * @return Whether the transfer was started.
+     */
+    bool startTransferOnLoop(FetchOptions fetchOption, bool writerWasCreatedLocally);
+
+    /**
+     * The body callback of a transfer on @c m_loop, which never blocks.
+     *
+     * @param data The data received.
+     * @param size The number of bytes received.
+     * @return The number of bytes consumed, or @c CURL_WRITEFUNC_PAUSE to pause the transfer.
+     */
+    size_t writeBodyOnLoop(char* data, size_t size);
+
+    /**
+     * Write to @c m_streamWriter without blocking the loop.
+     *
+     * @param data The data to write.
+     * @param size The number of bytes to write.
+     * @param[out] bytesWritten The number of bytes written.
+     * @return The outcome of the write.
+     */
+    WriteResult writeWithoutBlocking(const char* data, size_t size, size_t* bytesWritten);
+
+    /**
+     * Write @c m_pendingBody to @c m_streamWriter without blocking the loop.
+     *
+     * @return The outcome of the write.
+     */
+    WriteResult flushPendingBody();
+
+    /// Arrange for @c onSpaceAvailable() to run on @c m_loop once the writer may have space again.
+    void waitForSpace();
+
+    /// Resume writing once the writer may have space again.  This runs on @c m_loop.
+    void onSpaceAvailable();
+
+    /**
+     * Handle the end of a transfer on @c m_loop.
+     *
+     * @param fetchOption The option passed to @c getContent().
+     * @param result The result of the transfer.
+     */
+    void onTransferDone(FetchOptions fetchOption, CURLcode result);
+
+    /// Resolve the promises, if they have not been resolved yet.
+    void resolvePromises();
+
+    /// Finish the body once all of it has been written, closing a writer which this object created.
+    void finishBody();
+
     /// The URL to fetch from.
     std::string m_url;
 
-    /// A libcurl wrapper.
+    /// The loop which performs the transfer, or @c nullptr if it runs on @c m_thread.
+    std::shared_ptr<CurlMultiLoop> m_loop;
+
+    /// A libcurl wrapper.  This is declared after @c m_loop, so that the handle is cleaned up before the loop's share.
     CurlEasyHandleWrapper m_curlWrapper;
 
     /// A promise to the caller of @c getContent() that the HTTP status code will be set.
@@ -98,6 +188,36 @@ private:
     /// Flag to indicate that the data-fetch operation has completed.
     std::atomic<bool> m_done;
 
+    /// Whether the transfer stops when this object is destroyed, rather than running to the end of the body.
+    bool m_stopOnDestruction;
+
+    /// Whether the promises have been resolved, which is only used on @c m_loop or once the transfer is removed.
+    bool m_arePromisesResolved;
+
+    /// Whether this object created @c m_streamWriter, and closes it at the end of the body.
+    bool m_writerWasCreatedLocally;
+
+    /// Whether a transfer on @c m_loop has received all of the body, although some may still be in @c m_pendingBody.
+    bool m_isTransferDone;
+
+    /// Body data which a transfer on @c m_loop has received but could not write yet.
+    std::vector<char> m_pendingBody;
+
+    /// Whether @c m_streamWriter tells this object when space becomes available.
+    bool m_hasSpaceAvailableCallback;
+
+    /// Whether the transfer was started on @c m_loop.
+    bool m_isTransferOnLoop;
+
+    /// Serializes the notification of @c m_bodyFinished with the destructor's wait for it.
+    std::mutex m_bodyFinishedMutex;
+
+    /// Notified when a transfer on @c m_loop has finished the body.
+    std::condition_variable m_bodyFinished;
+
+    /// Whether a transfer on @c m_loop is waiting for space in @c m_streamWriter.
+    std::atomic<bool> m_isWaitingForSpace;
+
     /**
      * Internal thread that does the curl_easy_perform. The reason for using a thread is that curl_easy_perform may
      * block forever if the URL specified is a live stream.
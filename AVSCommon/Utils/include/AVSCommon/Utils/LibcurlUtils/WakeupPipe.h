@@ -0,0 +1,99 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_WAKEUPPIPE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_WAKEUPPIPE_H_
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+
+/**
+ * A self-pipe which lets any thread wake a network loop that is blocked waiting on file descriptors.
+ *
+ * Calls to @c wake() are coalesced: at most one byte is in the pipe at a time, no matter how often @c wake() is called
+ * before the loop calls @c consume().
+ */
+class WakeupPipe {
+public:
+    /**
+     * Create a WakeupPipe.
+     *
+     * @return The new @c WakeupPipe, or @c nullptr if the pipe could not be created.
+     */
+    static std::shared_ptr<WakeupPipe> create();
+
+    /**
+     * Destructor.
+     */
+    ~WakeupPipe();
+
+    /**
+     * Make the read end of the pipe readable until the next call to @c consume().  This may be called from any thread.
+     */
+    void wake();
+
+    /**
+     * Get the file descriptor to wait on.  It becomes readable when @c wake() is called.
+     *
+     * @return The read end of the pipe.
+     */
+    int getReadFd() const;
+
+    /**
+     * Clear any pending wake-up.  This should only be called by the thread which waits on the pipe.
+     *
+     * @return Whether @c wake() had been called since the last call to @c consume().
+     */
+    bool consume();
+
+    /**
+     * Wait for @c wake() to be called, without consuming the wake-up.
+     *
+     * @param timeout The maximum time to wait.
+     * @return Whether a wake-up is pending.
+     */
+    bool waitForWake(std::chrono::milliseconds timeout);
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param readFd The read end of the pipe.
+     * @param writeFd The write end of the pipe.
+     */
+    WakeupPipe(int readFd, int writeFd);
+
+    /// The read end of the pipe.
+    const int m_readFd;
+
+    /// The write end of the pipe.
+    const int m_writeFd;
+
+    /// Whether a byte has been written to the pipe since the last call to @c consume().
+    std::atomic<bool> m_isWakePending;
+};
+
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_WAKEUPPIPE_H_
@@ -116,6 +116,51 @@ public:
      */
     virtual SourceId setSource(std::shared_ptr<std::istream> stream, bool repeat) = 0;
 
+    /**
+     * Prepare a url source to play as soon as the source set by @c setSource() finishes, without a gap between the two.
+     * The player fetches and decodes the start of the prepared source while the current source plays.
+     *
+     * When the current source finishes, the player calls @c MediaPlayerObserverInterface::onPlaybackFinished() with
+     * the id of the current source, and then @c MediaPlayerObserverInterface::onPlaybackStarted() with the id of the
+     * prepared source, which becomes the current source without a call to @c play().
+     *
+     * A source prepared earlier is discarded.  The prepared source is discarded without callbacks if a new source is
+     * set, or if the current source is stopped or fails.  If the prepared source fails before it starts, an
+     * implementation must call @c MediaPlayerObserverInterface::onPlaybackError() with its id, and the current source
+     * plays on to its end.
+     *
+     * @param url The url of the source to prepare.
+     * @return The @c SourceId of the prepared source.  @c ERROR will be returned if the source failed to be prepared,
+     *     or if the implementation cannot play sources back to back, which is the default.
+     */
+    virtual SourceId prepareNextSource(const std::string& url) {
+        return ERROR;
+    }
+
+    /**
+     * Prepare an @c AttachmentReader source to play as soon as the source set by @c setSource() finishes, without a
+     * gap between the two.  This behaves as @c prepareNextSource() with a url.
+     *
+     * @param attachmentReader Object with which to read an incoming audio attachment.
+     * @param format The audioFormat to be used to interpret raw audio data.
+     * @return The @c SourceId of the prepared source.  @c ERROR will be returned if the source failed to be prepared,
+     *     or if the implementation cannot play sources back to back, which is the default.
+     */
+    virtual SourceId prepareNextSource(
+        std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> attachmentReader,
+        const avsCommon::utils::AudioFormat* format = nullptr) {
+        return ERROR;
+    }
+
+    /**
+     * Discard the source prepared by @c prepareNextSource(), so that playback ends with the current source.
+     *
+     * @return @c true if a prepared source was discarded, or @c false if there was none.
+     */
+    virtual bool cancelNextSource() {
+        return false;
+    }
+
     /**
      * Starts playing audio specified by the @c setSource() call.
      *
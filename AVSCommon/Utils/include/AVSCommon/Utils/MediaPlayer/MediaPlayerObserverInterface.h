@@ -151,6 +151,18 @@ public:
     virtual void onBufferRefilled(SourceId id) {
     }
 
+    /**
+     * This is an indication to the observer that the @c MediaPlayer has read all of the data of the source, so that
+     * what plays next can be prepared while the rest of the source plays out.  This is sent at most once per source.
+     *
+     * @note The observer must quickly return from this callback. Failure to do so could block the @c MediaPlayer from
+     * further processing.
+     *
+     * @param id The id of the source to which this callback corresponds to.
+     */
+    virtual void onPlaybackNearlyFinished(SourceId id) {
+    }
+
     /**
      * This is an indication to the observer that the @c MediaPlayer has found tags in the stream.
      * Tags are key value pairs extracted from the metadata of the stream. There can be multiple
@@ -43,7 +43,7 @@ public:
     static const uint32_t MAGIC_NUMBER = 0x53445348;
 
     /// Version of this header layout.
-    static const uint32_t VERSION = 2;
+    static const uint32_t VERSION = 3;
 
     /**
      * The constructor only initializes a shared pointer to the provided buffer.  Attaching and/or initializing is
@@ -127,6 +127,27 @@ public:
          */
         Mutex writerEnableMutex;
 
+        /**
+         * This field indicates whether there is an enabled @c Writer whose policy is not @c NONBLOCKABLE.  Only such a
+         * @c Writer uses @c oldestUnconsumedCursor, so @c Readers do not keep it up to date while this is @c false.
+         * It is only modified while holding @c writerEnableMutex.
+         */
+        AtomicBool hasBlockableWriter;
+
+        /**
+         * This field counts the @c Readers blocked on @c dataAvailableConditionVariable, plus the registered data
+         * available observers.  @c Writers only lock @c dataAvailableMutex and notify when it is non-zero.  It is only
+         * modified while holding @c dataAvailableMutex.
+         */
+        AtomicIndex dataAvailableWaiters;
+
+        /**
+         * This field counts the @c Writers blocked on @c spaceAvailableConditionVariable, plus the registered space
+         * available observers.  @c Readers only notify when it is non-zero.  It is only modified while holding
+         * @c backwardSeekMutex.
+         */
+        AtomicIndex spaceAvailableWaiters;
+
         /// This field contains the next location to write to.
         AtomicIndex writeStartCursor;
 
@@ -323,8 +344,6 @@ public:
      *     the backwards @c Reader::seek().  To prevent this race condition, this function takes the
      *     @c backwardSeekMutex, which prevents backwards @c Reader::seek()s while @c oldestUnconsumedCursor is being
      *     updated.
-     *
-     * @note As an optimization, we could skip this function if Writer policy is nonblockable (ACSDK-251).
      */
     void updateOldestUnconsumedCursorLocked();
 
@@ -501,6 +520,9 @@ bool SharedDataStream<T>::BufferLayout::init(size_t wordSize, size_t maxReaders)
     header->maxReaders = maxReaders;
     header->isWriterEnabled = false;
     header->hasWriterBeenClosed = false;
+    header->hasBlockableWriter = false;
+    header->dataAvailableWaiters = 0;
+    header->spaceAvailableWaiters = 0;
     header->writeStartCursor = 0;
     header->writeEndCursor = 0;
     header->oldestUnconsumedCursor = 0;
@@ -570,11 +592,14 @@ void SharedDataStream<T>::BufferLayout::detach() {
     }
 
     auto header = getHeader();
-    std::lock_guard<Mutex> lock(header->attachMutex);
+    std::unique_lock<Mutex> lock(header->attachMutex);
     --header->referenceCount;
     if (header->referenceCount > 0) {
         return;
     }
+    // Nobody else is attached, and attachMutex is about to be destroyed along with the rest of the Header, so it must
+    // not be held.
+    lock.unlock();
 
     // Destruction of reader arrays.
     for (size_t id = 0; id < header->maxReaders; ++id) {
@@ -614,7 +639,6 @@ size_t SharedDataStream<T>::BufferLayout::calculateDataOffset(size_t wordSize, s
 
 template <typename T>
 void SharedDataStream<T>::BufferLayout::updateOldestUnconsumedCursor() {
-    // Note: as an optimization, we could skip this function if Writer policy is nonblockable (ACSDK-251).
     std::lock_guard<Mutex> backwardSeekLock(getHeader()->backwardSeekMutex);
     updateOldestUnconsumedCursorLocked();
 }
@@ -623,8 +647,6 @@ template <typename T>
 void SharedDataStream<T>::BufferLayout::updateOldestUnconsumedCursorLocked() {
     auto header = getHeader();
 
-    // Note: as an optimization, we could skip this function if Writer policy is nonblockable (ACSDK-251).
-
     // The only barrier to a blocking writer overrunning a reader is oldestUnconsumedCursor, so we have to be careful
     // not to ever move it ahead of any readers.  The loop below searches through the readers to find the oldest point,
     // without moving oldestUnconsumedCursor.  Note that readers can continue to read while we are looping; it means
@@ -661,9 +683,11 @@ void SharedDataStream<T>::BufferLayout::updateOldestUnconsumedCursorLocked() {
     if (oldest > header->oldestUnconsumedCursor) {
         header->oldestUnconsumedCursor = oldest;
 
-        // Notify the writer(s).
-        // Note: as an optimization, we could skip this if there are no blocking writers (ACSDK-251).
-        header->spaceAvailableConditionVariable.notify_all();
+        // Notify the writer(s).  A blocking writer increments spaceAvailableWaiters while holding backwardSeekMutex
+        // and then checks its predicate, so it can not miss this notification.
+        if (header->spaceAvailableWaiters > 0) {
+            header->spaceAvailableConditionVariable.notify_all();
+        }
     }
 }
 
@@ -22,6 +22,7 @@
 #include <condition_variable>
 #include <string>
 
+#include "ObservableConditionVariable.h"
 #include "SharedDataStream.h"
 
 namespace alexaClientSDK {
@@ -43,8 +44,11 @@ struct InProcessSDSTraits {
     /// A std::mutex provides a lock which will work for in-process usage.
     using Mutex = std::mutex;
 
-    /// A std::condition_variable provides a condition variable which will work for in-process usage.
-    using ConditionVariable = std::condition_variable;
+    /**
+     * A std::condition_variable provides a condition variable which will work for in-process usage.  It is wrapped so
+     * that event loops which cannot block on it may observe its notifications.
+     */
+    using ConditionVariable = ObservableConditionVariable;
 
     /// A unique identifier representing this combination of traits.
     static constexpr const char* traitsName = "alexaClientSDK::avsCommon::utils::sds::InProcessSDSTraits";
@@ -0,0 +1,215 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_OBSERVABLECONDITIONVARIABLE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_OBSERVABLECONDITIONVARIABLE_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/**
+ * A @c std::condition_variable which also calls a small, fixed set of observer functions whenever it is notified.
+ * This allows a thread which cannot block on the condition variable (such as an event loop waiting on file
+ * descriptors) to learn that the condition it is waiting for may have changed.
+ *
+ * The observers are stored in a fixed-size table rather than on the heap, because @c SharedDataStream
+ * placement-constructs its condition variables in the stream's buffer and never destroys them.
+ *
+ * @note Observer functions are called from the notifying thread, possibly while it holds @c SharedDataStream locks.
+ * They must return quickly and must not call back into the stream or into this object.
+ */
+class ObservableConditionVariable {
+public:
+    /// The type of an observer function.  The argument is the context pointer given to @c addObserver().
+    using ObserverFunction = void (*)(void* context);
+
+    /// The maximum number of observers.
+    static constexpr size_t MAX_OBSERVERS = 8;
+
+    /**
+     * Constructor.
+     */
+    ObservableConditionVariable();
+
+    /**
+     * Unblocks one thread waiting on this condition variable, then calls the observers.
+     */
+    void notify_one();
+
+    /**
+     * Unblocks all threads waiting on this condition variable, then calls the observers.
+     */
+    void notify_all();
+
+    /**
+     * Blocks until notified (or spuriously woken).
+     *
+     * @param lock A lock on the mutex protecting the condition.
+     */
+    void wait(std::unique_lock<std::mutex>& lock);
+
+    /**
+     * Blocks until @c predicate returns @c true.
+     *
+     * @param lock A lock on the mutex protecting the condition.
+     * @param predicate The condition to wait for.
+     */
+    template <typename Predicate>
+    void wait(std::unique_lock<std::mutex>& lock, Predicate predicate);
+
+    /**
+     * Blocks until @c predicate returns @c true or @c timeout has elapsed.
+     *
+     * @param lock A lock on the mutex protecting the condition.
+     * @param timeout The maximum time to wait.
+     * @param predicate The condition to wait for.
+     * @return The value of @c predicate when the wait ended.
+     */
+    template <typename Rep, typename Period, typename Predicate>
+    bool wait_for(
+        std::unique_lock<std::mutex>& lock,
+        const std::chrono::duration<Rep, Period>& timeout,
+        Predicate predicate);
+
+    /**
+     * Adds an observer to be called after each notification.
+     *
+     * @param function The function to call.
+     * @param context The argument to pass to @c function.  Together with @c function it identifies the observer.
+     * @return Whether the observer was added.  This fails if @c MAX_OBSERVERS observers are already registered.
+     */
+    bool addObserver(ObserverFunction function, void* context);
+
+    /**
+     * Removes an observer added with @c addObserver().  Once this returns, the observer will not be called again.
+     *
+     * @param function The function passed to @c addObserver().
+     * @param context The context passed to @c addObserver().
+     * @return Whether the observer was found and removed.
+     */
+    bool removeObserver(ObserverFunction function, void* context);
+
+private:
+    /// An observer registration.
+    struct Observer {
+        /// The function to call, or @c nullptr if this entry is unused.
+        ObserverFunction function;
+        /// The argument to pass to @c function.
+        void* context;
+    };
+
+    /**
+     * Calls the registered observers, if any.
+     */
+    void notifyObservers();
+
+    /// The condition variable that waiting threads block on.
+    std::condition_variable m_conditionVariable;
+
+    /// Serializes access to @c m_observers, and ensures an observer is not called after it has been removed.
+    std::mutex m_observerMutex;
+
+    /// The number of registered observers, which lets notifications skip @c m_observerMutex when there are none.
+    std::atomic<size_t> m_numObservers;
+
+    /// The registered observers.
+    Observer m_observers[MAX_OBSERVERS];
+};
+
+inline ObservableConditionVariable::ObservableConditionVariable() : m_numObservers{0}, m_observers{} {
+}
+
+inline void ObservableConditionVariable::notify_one() {
+    m_conditionVariable.notify_one();
+    notifyObservers();
+}
+
+inline void ObservableConditionVariable::notify_all() {
+    m_conditionVariable.notify_all();
+    notifyObservers();
+}
+
+inline void ObservableConditionVariable::wait(std::unique_lock<std::mutex>& lock) {
+    m_conditionVariable.wait(lock);
+}
+
+template <typename Predicate>
+void ObservableConditionVariable::wait(std::unique_lock<std::mutex>& lock, Predicate predicate) {
+    m_conditionVariable.wait(lock, predicate);
+}
+
+template <typename Rep, typename Period, typename Predicate>
+bool ObservableConditionVariable::wait_for(
+    std::unique_lock<std::mutex>& lock,
+    const std::chrono::duration<Rep, Period>& timeout,
+    Predicate predicate) {
+    return m_conditionVariable.wait_for(lock, timeout, predicate);
+}
+
+inline bool ObservableConditionVariable::addObserver(ObserverFunction function, void* context) {
+    if (!function) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_observerMutex);
+    for (auto& observer : m_observers) {
+        if (!observer.function) {
+            observer.function = function;
+            observer.context = context;
+            ++m_numObservers;
+            return true;
+        }
+    }
+    return false;
+}
+
+inline bool ObservableConditionVariable::removeObserver(ObserverFunction function, void* context) {
+    std::lock_guard<std::mutex> lock(m_observerMutex);
+    for (auto& observer : m_observers) {
+        if (observer.function == function && observer.context == context) {
+            observer.function = nullptr;
+            observer.context = nullptr;
+            --m_numObservers;
+            return true;
+        }
+    }
+    return false;
+}
+
+inline void ObservableConditionVariable::notifyObservers() {
+    if (0 == m_numObservers) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_observerMutex);
+    for (auto& observer : m_observers) {
+        if (observer.function) {
+            observer.function(observer.context);
+        }
+    }
+}
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_OBSERVABLECONDITIONVARIABLE_H_
@@ -0,0 +1,160 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_PROCESSSHAREDCONDITIONVARIABLE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_PROCESSSHAREDCONDITIONVARIABLE_H_
+
+#include <chrono>
+#include <mutex>
+
+#include <pthread.h>
+
+#include "ProcessSharedMutex.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/**
+ * A condition variable which works with @c ProcessSharedMutex, and which may be placed in memory shared between
+ * processes.  Timed waits are measured against the monotonic clock.
+ *
+ * Like @c ProcessSharedMutex, it must be constructed exactly once, by the process which initializes the shared memory.
+ */
+class ProcessSharedConditionVariable {
+public:
+    /**
+     * Constructor.
+     */
+    ProcessSharedConditionVariable();
+
+    /**
+     * Destructor.
+     */
+    ~ProcessSharedConditionVariable();
+
+    /// This class is not copyable.
+    ProcessSharedConditionVariable(const ProcessSharedConditionVariable&) = delete;
+
+    /// This class is not copyable.
+    ProcessSharedConditionVariable& operator=(const ProcessSharedConditionVariable&) = delete;
+
+    /**
+     * Unblocks one thread waiting on this condition variable.
+     */
+    void notify_one();
+
+    /**
+     * Unblocks all threads waiting on this condition variable.
+     */
+    void notify_all();
+
+    /**
+     * Blocks until notified (or spuriously woken).
+     *
+     * @param lock A lock on the mutex protecting the condition.
+     * @throws std::system_error If the mutex could not be locked again after the wait.
+     */
+    void wait(std::unique_lock<ProcessSharedMutex>& lock);
+
+    /**
+     * Blocks until @c predicate returns @c true.
+     *
+     * @param lock A lock on the mutex protecting the condition.
+     * @param predicate The condition to wait for.
+     */
+    template <typename Predicate>
+    void wait(std::unique_lock<ProcessSharedMutex>& lock, Predicate predicate);
+
+    /**
+     * Blocks until @c predicate returns @c true or @c timeout has elapsed.
+     *
+     * @param lock A lock on the mutex protecting the condition.
+     * @param timeout The maximum time to wait.
+     * @param predicate The condition to wait for.
+     * @return The value of @c predicate when the wait ended.
+     */
+    template <typename Rep, typename Period, typename Predicate>
+    bool wait_for(
+        std::unique_lock<ProcessSharedMutex>& lock,
+        const std::chrono::duration<Rep, Period>& timeout,
+        Predicate predicate);
+
+    /**
+     * Observers are not supported, since a function in one process cannot be called from another.  This lets a
+     * @c SharedDataStream over shared memory offer the same interface as an in-process one.
+     *
+     * @return @c false.
+     */
+    bool addObserver(void (*)(void*), void*);
+
+    /**
+     * Observers are not supported; see @c addObserver().
+     *
+     * @return @c false.
+     */
+    bool removeObserver(void (*)(void*), void*);
+
+private:
+    /**
+     * Blocks until notified (or spuriously woken), or until @c deadline.
+     *
+     * @param lock A lock on the mutex protecting the condition.
+     * @param deadline When to stop waiting.
+     * @return @c false if @c deadline passed, else @c true.
+     * @throws std::system_error If the mutex could not be locked again after the wait.
+     */
+    bool waitUntil(std::unique_lock<ProcessSharedMutex>& lock, std::chrono::steady_clock::time_point deadline);
+
+    /// The underlying pthread condition variable.
+    pthread_cond_t m_conditionVariable;
+};
+
+template <typename Predicate>
+void ProcessSharedConditionVariable::wait(std::unique_lock<ProcessSharedMutex>& lock, Predicate predicate) {
+    while (!predicate()) {
+        wait(lock);
+    }
+}
+
+template <typename Rep, typename Period, typename Predicate>
+bool ProcessSharedConditionVariable::wait_for(
+    std::unique_lock<ProcessSharedMutex>& lock,
+    const std::chrono::duration<Rep, Period>& timeout,
+    Predicate predicate) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!predicate()) {
+        if (!waitUntil(lock, deadline)) {
+            return predicate();
+        }
+    }
+    return true;
+}
+
+inline bool ProcessSharedConditionVariable::addObserver(void (*)(void*), void*) {
+    return false;
+}
+
+inline bool ProcessSharedConditionVariable::removeObserver(void (*)(void*), void*) {
+    return false;
+}
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_PROCESSSHAREDCONDITIONVARIABLE_H_
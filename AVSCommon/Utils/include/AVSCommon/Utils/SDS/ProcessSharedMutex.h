@@ -0,0 +1,96 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_PROCESSSHAREDMUTEX_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_PROCESSSHAREDMUTEX_H_
+
+#include <pthread.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/**
+ * A mutex which may be placed in memory shared between processes.  It is a process-shared, robust pthread mutex, so
+ * if a process dies while holding it, the next process to lock it takes it over instead of deadlocking.
+ *
+ * The object holds no pointers, so it may be mapped at different addresses in different processes.  It must be
+ * constructed exactly once, by the process which initializes the shared memory; other processes use it in place.
+ */
+class ProcessSharedMutex {
+public:
+    /**
+     * Constructor.
+     */
+    ProcessSharedMutex();
+
+    /**
+     * Destructor.
+     */
+    ~ProcessSharedMutex();
+
+    /// This class is not copyable.
+    ProcessSharedMutex(const ProcessSharedMutex&) = delete;
+
+    /// This class is not copyable.
+    ProcessSharedMutex& operator=(const ProcessSharedMutex&) = delete;
+
+    /**
+     * Waits indefinitely for the mutex to unlock, then locks it.  If the previous owner died while holding it, the
+     * mutex is marked consistent and this call succeeds.
+     *
+     * @throws std::system_error If the mutex could not be locked, for example because it is not recoverable.
+     */
+    void lock();
+
+    /**
+     * Locks the mutex if it is not locked.
+     *
+     * @return Whether the mutex was locked.
+     */
+    bool try_lock();
+
+    /**
+     * Unlocks the mutex.
+     */
+    void unlock();
+
+    /**
+     * Get the underlying pthread mutex.
+     *
+     * @return The underlying pthread mutex.
+     */
+    pthread_mutex_t* native_handle();
+
+    /**
+     * Handle the result of a pthread call which acquires this mutex, recovering it if its previous owner died.
+     *
+     * @param result The return value of the pthread call.
+     * @return Whether this thread now holds the mutex.
+     */
+    bool onAcquire(int result);
+
+private:
+    /// The underlying pthread mutex.
+    pthread_mutex_t m_mutex;
+};
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_PROCESSSHAREDMUTEX_H_
@@ -58,6 +58,14 @@ public:
         ABSOLUTE
     };
 
+    /// A contiguous region of the stream's buffer which may be read in place.
+    struct Span {
+        /// The start of the region.
+        const void* data;
+        /// The length of the region, in @c wordSize words.
+        size_t nWords;
+    };
+
     /**
      * Enumerates error codes which may be returned by @c read().
      *
@@ -114,6 +122,38 @@ public:
      */
     ssize_t read(void* buf, size_t nWords, std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
 
+    /**
+     * This function provides in-place access to data in the stream, without copying or consuming it.  The data is
+     * returned as up to two spans inside the stream's buffer, because it may wrap around the end of the buffer.  Once
+     * the caller is done with (some of) the data, it must @c commit() it to consume it.
+     *
+     * The data stays in the buffer until it is committed, unless the @c Writer's policy is @c NONBLOCKABLE, in which
+     * case it may be overwritten while the caller is looking at it.  @c commit() reports that with @c OVERRUN.
+     *
+     * @param first Returns the span starting at this @c Reader's position.
+     * @param second Returns the span which continues from the start of the buffer, or an empty span if the data does
+     *     not wrap.
+     * @param nWords The maximum number of @c wordSize words to return.
+     * @param timeout As for @c read().
+     * @return The total number of @c wordSize words in the two spans, or zero or a negative @c Error code as for
+     *     @c read().
+     */
+    ssize_t peek(
+        Span* first,
+        Span* second,
+        size_t nWords,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+    /**
+     * This function consumes data previously returned by @c peek().
+     *
+     * @param nWords The number of @c wordSize words to consume.  This must not exceed the number returned by the last
+     *     @c peek().
+     * @return @c nWords if the data was consumed, @c Error::OVERRUN if it was overwritten before it was committed, or
+     *     @c Error::INVALID if @c nWords is zero or more than the available data.
+     */
+    ssize_t commit(size_t nWords);
+
     /**
      * This function moves the @c Reader to the specified location in the stream.  If successful, subsequent calls to
      * @c read() will start from the new location.  For this function to succeed, the specified location *must* point
@@ -174,6 +214,26 @@ public:
      */
     size_t getWordSize() const;
 
+    /**
+     * This function registers a function to be called whenever a @c Writer signals that data may have become
+     * available, so that a @c NONBLOCKING @c Reader can be resumed without polling.  It may only be used with a
+     * @c ConditionVariable type which supports observers, such as the one used by @c InProcessSDS.
+     *
+     * @param function The function to call.  It is called from the @c Writer's thread, and must return quickly
+     *     without calling into this stream.
+     * @param context The argument to pass to @c function.
+     * @return Whether the observer was registered.
+     */
+    bool addDataAvailableObserver(void (*function)(void*), void* context);
+
+    /**
+     * This function removes an observer added with @c addDataAvailableObserver().
+     *
+     * @param function The function passed to @c addDataAvailableObserver().
+     * @param context The argument passed to @c addDataAvailableObserver().
+     */
+    void removeDataAvailableObserver(void (*function)(void*), void* context);
+
     /**
      * Returns the text of an error code.
      *
@@ -247,8 +307,35 @@ ssize_t SharedDataStream<T>::Reader::read(void* buf, size_t nWords, std::chrono:
         return Error::INVALID;
     }
 
+    Span first;
+    Span second;
+    auto result = peek(&first, &second, nWords, timeout);
+    if (result <= 0) {
+        return result;
+    }
+
+    // Copy the two segments.
+    auto buf8 = static_cast<uint8_t*>(buf);
+    memcpy(buf8, first.data, first.nWords * getWordSize());
+    if (second.nWords > 0) {
+        memcpy(buf8 + (first.nWords * getWordSize()), second.data, second.nWords * getWordSize());
+    }
+
+    return commit(result);
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Reader::peek(
+    Span* first,
+    Span* second,
+    size_t nWords,
+    std::chrono::milliseconds timeout) {
+    if (nullptr == first || nullptr == second) {
+        logger::acsdkError(logger::LogEntry(TAG, "peekFailed").d("reason", "nullSpan"));
+        return Error::INVALID;
+    }
     if (0 == nWords) {
-        logger::acsdkError(logger::LogEntry(TAG, "readFailed").d("reason", "invalidNumWords").d("numWords", nWords));
+        logger::acsdkError(logger::LogEntry(TAG, "peekFailed").d("reason", "invalidNumWords").d("numWords", nWords));
         return Error::INVALID;
     }
 
@@ -265,12 +352,7 @@ ssize_t SharedDataStream<T>::Reader::read(void* buf, size_t nWords, std::chrono:
         return Error::OVERRUN;
     }
 
-    std::unique_lock<Mutex> lock(header->dataAvailableMutex, std::defer_lock);
-    if (Policy::BLOCKING == m_policy) {
-        lock.lock();
-    }
-
-    // Figure out how much we can actually copy.
+    // Figure out how much we can actually copy.  The cursors are atomic, so no lock is needed unless we have to wait.
     size_t wordsAvailable = tell(Reference::BEFORE_WRITER);
     if (0 == wordsAvailable) {
         if (header->writeEndCursor > 0 && !header->isWriterEnabled) {
@@ -283,9 +365,17 @@ ssize_t SharedDataStream<T>::Reader::read(void* buf, size_t nWords, std::chrono:
                 return header->hasWriterBeenClosed || tell(Reference::BEFORE_WRITER) > 0;
             };
 
+            // Let the writer know that it needs to notify us before checking the predicate (see Writer::write()).
+            std::unique_lock<Mutex> lock(header->dataAvailableMutex);
+            header->dataAvailableWaiters += 1;
+            bool dataAvailable = true;
             if (std::chrono::milliseconds::zero() == timeout) {
                 header->dataAvailableConditionVariable.wait(lock, predicate);
-            } else if (!header->dataAvailableConditionVariable.wait_for(lock, timeout, predicate)) {
+            } else {
+                dataAvailable = header->dataAvailableConditionVariable.wait_for(lock, timeout, predicate);
+            }
+            header->dataAvailableWaiters = header->dataAvailableWaiters - 1;
+            if (!dataAvailable) {
                 return Error::TIMEDOUT;
             }
         }
@@ -297,9 +387,6 @@ ssize_t SharedDataStream<T>::Reader::read(void* buf, size_t nWords, std::chrono:
         }
     }
 
-    if (Policy::BLOCKING == m_policy) {
-        lock.unlock();
-    }
     if (nWords > wordsAvailable) {
         nWords = wordsAvailable;
     }
@@ -314,26 +401,34 @@ ssize_t SharedDataStream<T>::Reader::read(void* buf, size_t nWords, std::chrono:
     if (beforeWrap > nWords) {
         beforeWrap = nWords;
     }
-    size_t afterWrap = nWords - beforeWrap;
+    first->data = m_bufferLayout->getData(*m_readerCursor);
+    first->nWords = beforeWrap;
+    second->data = m_bufferLayout->getData(*m_readerCursor + beforeWrap);
+    second->nWords = nWords - beforeWrap;
 
-    // Copy the two segments.
-    auto buf8 = static_cast<uint8_t*>(buf);
-    memcpy(buf8, m_bufferLayout->getData(*m_readerCursor), beforeWrap * getWordSize());
-    if (afterWrap > 0) {
-        memcpy(
-            buf8 + (beforeWrap * getWordSize()),
-            m_bufferLayout->getData(*m_readerCursor + beforeWrap),
-            afterWrap * getWordSize());
+    return nWords;
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Reader::commit(size_t nWords) {
+    if (0 == nWords || nWords > tell(Reference::BEFORE_WRITER)) {
+        logger::acsdkError(logger::LogEntry(TAG, "commitFailed").d("reason", "invalidNumWords").d("numWords", nWords));
+        return Error::INVALID;
     }
 
     // Advance the read cursor.
+    auto header = m_bufferLayout->getHeader();
     *m_readerCursor += nWords;
 
     // Final check for overrun (do this before the updateOldestUnconsumedCursor() call below for improved accuracy).
     bool overrun = ((header->writeEndCursor - *m_readerCursor) > m_bufferLayout->getDataSize());
 
-    // Move the unconsumed cursor before returning.
-    m_bufferLayout->updateOldestUnconsumedCursor();
+    // Move the unconsumed cursor before returning.  It is only used by blockable writers and space available
+    // observers, so skip the scan (and its lock) when there are none; a stale oldestUnconsumedCursor is only ever
+    // older than the readers, and the Writer constructor brings it up to date.
+    if (header->hasBlockableWriter || header->spaceAvailableWaiters > 0) {
+        m_bufferLayout->updateOldestUnconsumedCursor();
+    }
 
     // Now we can safely error out if there was an overrun.
     if (overrun) {
@@ -483,6 +578,27 @@ size_t SharedDataStream<T>::Reader::getWordSize() const {
     return m_bufferLayout->getHeader()->wordSize;
 }
 
+template <typename T>
+bool SharedDataStream<T>::Reader::addDataAvailableObserver(void (*function)(void*), void* context) {
+    auto header = m_bufferLayout->getHeader();
+    std::lock_guard<Mutex> lock(header->dataAvailableMutex);
+    if (!header->dataAvailableConditionVariable.addObserver(function, context)) {
+        return false;
+    }
+    // Observers are notified along with blocked readers, so count them as waiters.
+    header->dataAvailableWaiters += 1;
+    return true;
+}
+
+template <typename T>
+void SharedDataStream<T>::Reader::removeDataAvailableObserver(void (*function)(void*), void* context) {
+    auto header = m_bufferLayout->getHeader();
+    std::lock_guard<Mutex> lock(header->dataAvailableMutex);
+    if (header->dataAvailableConditionVariable.removeObserver(function, context)) {
+        header->dataAvailableWaiters = header->dataAvailableWaiters - 1;
+    }
+}
+
 template <typename T>
 std::string SharedDataStream<T>::Reader::errorToString(Error error) {
     switch (error) {
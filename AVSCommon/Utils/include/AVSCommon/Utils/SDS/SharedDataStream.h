@@ -66,8 +66,8 @@ namespace sds {
  *     @li @c DefaultConstructible `(std::is_default_constructible<Mutex> == true)`.
  *     @li @c lock() Waits indefinitely for the mutex to unlock and then locks the mutex.
  *     @li @c unlock Unlocks the mutex.
- *     @li If the stream will be shared between processes, the @c Mutex type *must* be a @c PODType:
- *         `(std::is_pod<Mutex> == true)`.
+ *     @li If the stream will be shared between processes, the @c Mutex type *must* not hold pointers or other
+ *         process-local state (e.g. a @c PODType, or a process-shared pthread mutex such as @c ProcessSharedMutex).
  *
  *     This type must be capable of locking a mutex for readers and writers in the execution environment where the
  *     @c SharedDataStream will be used.
@@ -80,8 +80,9 @@ namespace sds {
  *     @li @c wait(lock, predicate) waits indefinitely using @c lock for the @c predicate to be satisfied.
  *     @li @c wait_for(lock, timeout, predicate) waits using @c lock up to the specified @c timeout for the @c
  *         predicate to be satisfied.
- *     @li If the stream will be shared between processes, the @c ConditionVariable type *must* be a PODType:
- *         `(std::is_pod<ConditionVariable> == true)`.
+ *     @li If the stream will be shared between processes, the @c ConditionVariable type *must* not hold pointers or
+ *         other process-local state (e.g. a @c PODType, or a process-shared pthread condition variable such as
+ *         @c ProcessSharedConditionVariable).
  *
  *     This type must be capable of synchronizing between readers and writers in the execution environment where the
  *     @c SharedDataStream will be used.
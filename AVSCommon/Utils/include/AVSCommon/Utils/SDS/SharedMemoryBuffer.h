@@ -0,0 +1,123 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDMEMORYBUFFER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDMEMORYBUFFER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/**
+ * A @c SharedDataStream @c Buffer which is a named POSIX shared memory object mapped into this process.  One process
+ * @c create()s the object, and others @c open() it by name, so that all of them see the same memory.
+ *
+ * The process which created the object unlinks its name when its @c SharedMemoryBuffer is destroyed.  Processes
+ * which have already opened it keep their mapping until their own @c SharedMemoryBuffer is destroyed.
+ *
+ * A buffer may also be constructed from just a size, in which case it is anonymous memory which only this process
+ * (and its children) can see.  This lets code which creates a buffer of a @c SharedDataStream's @c Buffer type by size
+ * work whether that type is a @c SharedMemoryBuffer or a @c std::vector.
+ */
+class SharedMemoryBuffer {
+public:
+    /**
+     * Constructor.  Maps anonymous, zero-filled shared memory into this process.  If the memory could not be mapped,
+     * the buffer is empty.
+     *
+     * @param size The size of the buffer in bytes.
+     */
+    explicit SharedMemoryBuffer(size_t size);
+
+    /**
+     * Create a new shared memory object and map it into this process.  The object's memory is zero-filled.
+     *
+     * @param name The name of the object.  It must begin with '/' and contain no other '/'.  There must not already be
+     *     an object with this name.
+     * @param size The size of the object in bytes.
+     * @return The new buffer, or @c nullptr if the object could not be created.
+     */
+    static std::shared_ptr<SharedMemoryBuffer> create(const std::string& name, size_t size);
+
+    /**
+     * Map an existing shared memory object, created by this or another process, into this process.
+     *
+     * @param name The name the object was created with.
+     * @return The buffer, or @c nullptr if the object could not be opened.
+     */
+    static std::shared_ptr<SharedMemoryBuffer> open(const std::string& name);
+
+    /**
+     * Destructor.  Unmaps the object, and unlinks its name if this buffer created it.
+     */
+    ~SharedMemoryBuffer();
+
+    /**
+     * Get the mapped memory.
+     *
+     * @return A pointer to the start of the mapped memory.
+     */
+    uint8_t* data();
+
+    /**
+     * Get the size of the mapped memory.
+     *
+     * @return The size of the mapped memory in bytes.
+     */
+    size_t size() const;
+
+    /**
+     * Get the name of the shared memory object.
+     *
+     * @return The name of the shared memory object, which is empty for anonymous memory.
+     */
+    const std::string& getName() const;
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param name The name of the shared memory object.
+     * @param data The start of the mapping.
+     * @param size The size of the mapping.
+     * @param isOwner Whether this buffer created the object, and must unlink it.
+     */
+    SharedMemoryBuffer(const std::string& name, uint8_t* data, size_t size, bool isOwner);
+
+    /// The name of the shared memory object.
+    const std::string m_name;
+
+    /// The start of the mapping.
+    uint8_t* const m_data;
+
+    /// The size of the mapping.
+    const size_t m_size;
+
+    /// Whether this buffer created the object, and must unlink it.
+    const bool m_isOwner;
+};
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDMEMORYBUFFER_H_
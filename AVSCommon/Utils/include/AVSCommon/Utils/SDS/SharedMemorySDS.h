@@ -0,0 +1,75 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDMEMORYSDS_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDMEMORYSDS_H_
+
+#include <atomic>
+#include <cstdint>
+
+#include "ProcessSharedConditionVariable.h"
+#include "ProcessSharedMutex.h"
+#include "SharedDataStream.h"
+#include "SharedMemoryBuffer.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+// Lock-free atomics are address-free, so they work in memory which is mapped at different addresses in each process.
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "SharedMemorySDS requires lock-free 64-bit atomics");
+static_assert(ATOMIC_BOOL_LOCK_FREE == 2, "SharedMemorySDS requires lock-free boolean atomics");
+
+/**
+ * Structure for specifying the traits of a SharedDataStream which works between processes, through a named POSIX
+ * shared memory object.  One process creates a @c SharedMemoryBuffer and a stream with @c SharedDataStream::create(),
+ * and other processes open the buffer by name and attach to the stream with @c SharedDataStream::open().
+ *
+ * The mutexes are robust, so a process which dies while holding one of the stream's locks does not deadlock the
+ * others.
+ *
+ * @note Only available where POSIX shared memory and robust process-shared mutexes are (see AVSCommon's
+ *     CMakeLists.txt, which defines @c SHARED_MEMORY_SDS when they are).
+ */
+struct SharedMemorySDSTraits {
+    /// A lock-free std::atomic is address-free, and so works across processes.
+    using AtomicIndex = std::atomic<uint64_t>;
+
+    /// A lock-free std::atomic is address-free, and so works across processes.
+    using AtomicBool = std::atomic<bool>;
+
+    /// A named POSIX shared memory object holds the stream.
+    using Buffer = SharedMemoryBuffer;
+
+    /// A process-shared, robust pthread mutex.
+    using Mutex = ProcessSharedMutex;
+
+    /// A process-shared pthread condition variable.
+    using ConditionVariable = ProcessSharedConditionVariable;
+
+    /// A unique identifier representing this combination of traits.
+    static constexpr const char* traitsName = "alexaClientSDK::avsCommon::utils::sds::SharedMemorySDSTraits";
+};
+
+/// Type alias for a SharedDataStream which works between processes.
+using SharedMemorySDS = SharedDataStream<SharedMemorySDSTraits>;
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDMEMORYSDS_H_
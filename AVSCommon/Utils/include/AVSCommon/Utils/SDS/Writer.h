@@ -48,6 +48,14 @@ public:
     /// Specifies the policy to use for writing to the stream.
     using Policy = WriterPolicy;
 
+    /// A contiguous region of the stream's buffer which may be written in place.
+    struct Span {
+        /// The start of the region.
+        void* data;
+        /// The length of the region, in @c wordSize words.
+        size_t nWords;
+    };
+
     /**
      * Enumerates error codes which may be returned by @c write().
      *
@@ -96,6 +104,38 @@ public:
      */
     ssize_t write(const void* buf, size_t nWords, std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
 
+    /**
+     * This function reserves space at the end of the stream to be filled in place.  The space is returned as up to
+     * two spans inside the stream's buffer, because it may wrap around the end of the buffer.  Once the caller has
+     * filled in (some of) the space, it must @c commit() it to make it available to @c Readers.
+     *
+     * The policy and @c timeout apply as for @c write(), except that at most @c getDataSize() words of the buffer can
+     * be reserved at once, so larger requests are truncated.  @c write() must not be called while space is reserved.
+     *
+     * @param first Returns the span starting at this @c Writer's position.
+     * @param second Returns the span which continues from the start of the buffer, or an empty span if the space
+     *     does not wrap.
+     * @param nWords The maximum number of @c wordSize words to reserve.
+     * @param timeout As for @c write().
+     * @return The total number of @c wordSize words in the two spans, or zero or a negative @c Error code as for
+     *     @c write().
+     */
+    ssize_t reserve(
+        Span* first,
+        Span* second,
+        size_t nWords,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+    /**
+     * This function publishes data written in place after a @c reserve(), and notifies any waiting @c Readers.
+     *
+     * @param nWords The number of @c wordSize words to publish, from the start of the reserved space.  This must not
+     *     exceed the number returned by the last @c reserve().
+     * @return @c nWords if the data was published, or @c Error::INVALID if @c nWords is zero or more than was
+     *     reserved.
+     */
+    ssize_t commit(size_t nWords);
+
     /**
      * This function reports the current position of the @c Writer in the stream.
      *
@@ -117,6 +157,26 @@ public:
      */
     size_t getWordSize() const;
 
+    /**
+     * This function registers a function to be called whenever a @c Reader signals that space may have become
+     * available, so that a @c NONBLOCKABLE or @c ALL_OR_NOTHING @c Writer can be resumed without polling.  It may only
+     * be used with a @c ConditionVariable type which supports observers, such as the one used by @c InProcessSDS.
+     *
+     * @param function The function to call.  It is called from the @c Reader's thread, and must return quickly
+     *     without calling into this stream.
+     * @param context The argument to pass to @c function.
+     * @return Whether the observer was registered.
+     */
+    bool addSpaceAvailableObserver(void (*function)(void*), void* context);
+
+    /**
+     * This function removes an observer added with @c addSpaceAvailableObserver().
+     *
+     * @param function The function passed to @c addSpaceAvailableObserver().
+     * @param context The argument passed to @c addSpaceAvailableObserver().
+     */
+    void removeSpaceAvailableObserver(void (*function)(void*), void* context);
+
     /**
      * Returns the text of an error code.
      *
@@ -142,6 +202,29 @@ private:
      * @c Header::WriterEnabledMutex.
      */
     bool m_closed;
+
+    /// The number of words reserved by the last @c reserve() which have not yet been committed.
+    size_t m_reservedWords;
+
+    /**
+     * This function implements the policy for claiming space in the stream, shared by @c write() and @c reserve().  On
+     * success it moves @c writeEndCursor to the end of the claimed space and records it in @c m_reservedWords.
+     *
+     * @param nWords The maximum number of @c wordSize words to claim.
+     * @param timeout As for @c write().
+     * @return The number of @c wordSize words claimed, or zero or a negative @c Error code as for @c write().
+     */
+    ssize_t claimSpace(size_t nWords, std::chrono::milliseconds timeout);
+
+    /**
+     * This function splits a region of the stream across the wrap of the buffer.
+     *
+     * @param start The position of the region.
+     * @param nWords The length of the region.
+     * @param first Returns the span starting at @c start.
+     * @param second Returns the span which continues from the start of the buffer.
+     */
+    void getSpans(Index start, size_t nWords, Span* first, Span* second) const;
 };
 
 template <typename T>
@@ -151,11 +234,18 @@ template <typename T>
 SharedDataStream<T>::Writer::Writer(Policy policy, std::shared_ptr<BufferLayout> bufferLayout) :
         m_policy{policy},
         m_bufferLayout{bufferLayout},
-        m_closed{false} {
+        m_closed{false},
+        m_reservedWords{0} {
     // Note - SharedDataStream::createWriter() holds writerEnableMutex while calling this function.
     auto header = m_bufferLayout->getHeader();
     header->isWriterEnabled = true;
     header->writeEndCursor = header->writeStartCursor.load();
+
+    // Readers do not maintain oldestUnconsumedCursor while there is no blockable writer, so bring it up to date.
+    header->hasBlockableWriter = (Policy::NONBLOCKABLE != m_policy);
+    if (header->hasBlockableWriter) {
+        m_bufferLayout->updateOldestUnconsumedCursor();
+    }
 }
 
 template <typename T>
@@ -174,14 +264,99 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
         return Error::INVALID;
     }
 
+    auto result = claimSpace(nWords, timeout);
+    if (result <= 0) {
+        return result;
+    }
+    nWords = result;
+
+    auto wordsToCopy = nWords;
+    auto buf8 = static_cast<const uint8_t*>(buf);
+    if (Policy::ALL_OR_NOTHING == m_policy) {
+        // If we have more data than the SDS can hold and we're not going to be overwriting oldestUnconsumedCursor, we
+        // can safely discard the initial data and just leave the trailing data in the buffer.
+        if (wordsToCopy > m_bufferLayout->getDataSize()) {
+            wordsToCopy = m_bufferLayout->getDataSize();
+            buf8 += (nWords - wordsToCopy) * getWordSize();
+        }
+    }
+
+    // Copy the two segments.
+    Span first;
+    Span second;
+    auto header = m_bufferLayout->getHeader();
+    getSpans(header->writeStartCursor + (nWords - wordsToCopy), wordsToCopy, &first, &second);
+    memcpy(first.data, buf8, first.nWords * getWordSize());
+    if (second.nWords > 0) {
+        memcpy(second.data, buf8 + first.nWords * getWordSize(), second.nWords * getWordSize());
+    }
+
+    return commit(nWords);
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Writer::reserve(
+    Span* first,
+    Span* second,
+    size_t nWords,
+    std::chrono::milliseconds timeout) {
+    if (nullptr == first || nullptr == second) {
+        logger::acsdkError(logger::LogEntry(TAG, "reserveFailed").d("reason", "nullSpan"));
+        return Error::INVALID;
+    }
+    if (0 == nWords) {
+        logger::acsdkError(logger::LogEntry(TAG, "reserveFailed").d("reason", "zeroNumWords"));
+        return Error::INVALID;
+    }
+    if (nWords > m_bufferLayout->getDataSize()) {
+        nWords = m_bufferLayout->getDataSize();
+    }
+
+    auto result = claimSpace(nWords, timeout);
+    if (result > 0) {
+        getSpans(m_bufferLayout->getHeader()->writeStartCursor, result, first, second);
+    }
+    return result;
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Writer::commit(size_t nWords) {
+    if (0 == nWords || nWords > m_reservedWords) {
+        logger::acsdkError(logger::LogEntry(TAG, "commitFailed")
+                               .d("reason", "invalidNumWords")
+                               .d("numWords", nWords)
+                               .d("reservedWords", m_reservedWords));
+        return Error::INVALID;
+    }
+    m_reservedWords = 0;
+
+    auto header = m_bufferLayout->getHeader();
+
+    // Advance the write cursor, and release any reserved space which was not used.
+    header->writeStartCursor += nWords;
+    header->writeEndCursor = header->writeStartCursor.load();
+
+    // Notify the reader(s), if any are waiting.  A blocking reader increments dataAvailableWaiters while holding
+    // dataAvailableMutex and then checks its predicate, so either it sees the new writeStartCursor, or we see it
+    // waiting; briefly taking the mutex ensures that it has gone to sleep before we notify it.
+    if (header->dataAvailableWaiters > 0) {
+        {
+            std::lock_guard<Mutex> dataAvailableLock(header->dataAvailableMutex);
+        }
+        header->dataAvailableConditionVariable.notify_all();
+    }
+
+    return nWords;
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Writer::claimSpace(size_t nWords, std::chrono::milliseconds timeout) {
     auto header = m_bufferLayout->getHeader();
     if (!header->isWriterEnabled) {
-        logger::acsdkError(logger::LogEntry(TAG, "writeFailed").d("reason", "writerDisabled"));
+        logger::acsdkError(logger::LogEntry(TAG, "claimSpaceFailed").d("reason", "writerDisabled"));
         return Error::CLOSED;
     }
 
-    auto wordsToCopy = nWords;
-    auto buf8 = static_cast<const uint8_t*>(buf);
     std::unique_lock<Mutex> backwardSeekLock(header->backwardSeekMutex, std::defer_lock);
     Index writeEnd = header->writeStartCursor + nWords;
 
@@ -189,7 +364,7 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
         case Policy::NONBLOCKABLE:
             // For NONBLOCKABLE, we can truncate the write if it won't fit in the buffer.
             if (nWords > m_bufferLayout->getDataSize()) {
-                wordsToCopy = nWords = m_bufferLayout->getDataSize();
+                nWords = m_bufferLayout->getDataSize();
                 writeEnd = header->writeStartCursor + nWords;
             }
             break;
@@ -220,10 +395,19 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
             backwardSeekLock.lock();
 
             // Wait for space to become available.
-            if (std::chrono::milliseconds::zero() == timeout) {
-                header->spaceAvailableConditionVariable.wait(backwardSeekLock, predicate);
-            } else if (!header->spaceAvailableConditionVariable.wait_for(backwardSeekLock, timeout, predicate)) {
-                return Error::TIMEDOUT;
+            if (!predicate()) {
+                header->spaceAvailableWaiters += 1;
+                bool spaceAvailable = true;
+                if (std::chrono::milliseconds::zero() == timeout) {
+                    header->spaceAvailableConditionVariable.wait(backwardSeekLock, predicate);
+                } else {
+                    spaceAvailable =
+                        header->spaceAvailableConditionVariable.wait_for(backwardSeekLock, timeout, predicate);
+                }
+                header->spaceAvailableWaiters = header->spaceAvailableWaiters - 1;
+                if (!spaceAvailable) {
+                    return Error::TIMEDOUT;
+                }
             }
 
             // Figure out how much space we have.
@@ -238,7 +422,7 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
 
             // For BLOCKING, we can truncate the write if it won't fit in the buffer.
             if (spaceAvailable < nWords) {
-                wordsToCopy = nWords = spaceAvailable;
+                nWords = spaceAvailable;
                 writeEnd = header->writeStartCursor + nWords;
             }
 
@@ -252,51 +436,20 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
         backwardSeekLock.unlock();
     }
 
-    if (Policy::ALL_OR_NOTHING == m_policy) {
-        // If we have more data than the SDS can hold and we're not going to be overwriting oldestUnconsumedCursor, we
-        // can safely discard the initial data and just leave the trailing data in the buffer.
-        if (wordsToCopy > m_bufferLayout->getDataSize()) {
-            wordsToCopy = m_bufferLayout->getDataSize();
-            buf8 += (nWords - wordsToCopy) * getWordSize();
-        }
-    }
-
-    // Split it across the wrap.
-    size_t beforeWrap = m_bufferLayout->wordsUntilWrap(header->writeStartCursor);
-    if (beforeWrap > wordsToCopy) {
-        beforeWrap = wordsToCopy;
-    }
-    size_t afterWrap = wordsToCopy - beforeWrap;
-
-    // Copy the two segments.
-    memcpy(m_bufferLayout->getData(header->writeStartCursor), buf8, beforeWrap * getWordSize());
-    if (afterWrap > 0) {
-        memcpy(
-            m_bufferLayout->getData(header->writeStartCursor + beforeWrap),
-            buf8 + beforeWrap * getWordSize(),
-            afterWrap * getWordSize());
-    }
+    m_reservedWords = nWords;
+    return nWords;
+}
 
-    // Advance the write cursor.
-    // Note: To prevent a race condition and ensure that readers which block on dataAvailableConditionVariable don't
-    // miss a notify, we should always lock the dataAvailableConditionVariable mutex while moving writeStartCursor.  As
-    // an optimization, we skip that lock for NONBLOCKABLE writers under the assumption that they will be writing
-    // continuously, so a missed notification is not significant.
-    // Note: As a further optimization, the lock could be omitted if no blocking readers are in use (ACSDK-251).
-    std::unique_lock<Mutex> dataAvailableLock(header->dataAvailableMutex, std::defer_lock);
-    if (Policy::NONBLOCKABLE == m_policy) {
-        dataAvailableLock.lock();
-    }
-    header->writeStartCursor = header->writeEndCursor.load();
-    if (Policy::NONBLOCKABLE == m_policy) {
-        dataAvailableLock.unlock();
+template <typename T>
+void SharedDataStream<T>::Writer::getSpans(Index start, size_t nWords, Span* first, Span* second) const {
+    size_t beforeWrap = m_bufferLayout->wordsUntilWrap(start);
+    if (beforeWrap > nWords) {
+        beforeWrap = nWords;
     }
-
-    // Notify the reader(s).
-    // Note: as an optimization, we could skip this if there are no blocking readers (ACSDK-251).
-    header->dataAvailableConditionVariable.notify_all();
-
-    return nWords;
+    first->data = m_bufferLayout->getData(start);
+    first->nWords = beforeWrap;
+    second->data = m_bufferLayout->getData(start + beforeWrap);
+    second->nWords = nWords - beforeWrap;
 }
 
 template <typename T>
@@ -313,6 +466,7 @@ void SharedDataStream<T>::Writer::close() {
     }
     if (header->isWriterEnabled) {
         header->isWriterEnabled = false;
+        header->hasBlockableWriter = false;
 
         std::unique_lock<Mutex> dataAvailableLock(header->dataAvailableMutex);
 
@@ -328,6 +482,27 @@ size_t SharedDataStream<T>::Writer::getWordSize() const {
     return m_bufferLayout->getHeader()->wordSize;
 }
 
+template <typename T>
+bool SharedDataStream<T>::Writer::addSpaceAvailableObserver(void (*function)(void*), void* context) {
+    auto header = m_bufferLayout->getHeader();
+    std::lock_guard<Mutex> backwardSeekLock(header->backwardSeekMutex);
+    if (!header->spaceAvailableConditionVariable.addObserver(function, context)) {
+        return false;
+    }
+    // Observers are notified along with blocked writers, so count them as waiters.
+    header->spaceAvailableWaiters += 1;
+    return true;
+}
+
+template <typename T>
+void SharedDataStream<T>::Writer::removeSpaceAvailableObserver(void (*function)(void*), void* context) {
+    auto header = m_bufferLayout->getHeader();
+    std::lock_guard<Mutex> backwardSeekLock(header->backwardSeekMutex);
+    if (header->spaceAvailableConditionVariable.removeObserver(function, context)) {
+        header->spaceAvailableWaiters = header->spaceAvailableWaiters - 1;
+    }
+}
+
 template <typename T>
 std::string SharedDataStream<T>::Writer::errorToString(Error error) {
     switch (error) {
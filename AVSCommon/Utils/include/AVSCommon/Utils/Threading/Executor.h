@@ -19,7 +19,7 @@
 #include <future>
 #include <utility>
 
-#include "AVSCommon/Utils/Threading/TaskThread.h"
+#include "AVSCommon/Utils/Threading/Strand.h"
 #include "AVSCommon/Utils/Threading/TaskQueue.h"
 
 namespace alexaClientSDK {
@@ -28,7 +28,8 @@ namespace utils {
 namespace threading {
 
 /**
- * An Executor is used to run callable types asynchronously.
+ * An Executor is used to run callable types asynchronously.  Tasks submitted to an Executor run one at a time, in
+ * order, on the threads of the process-wide @c ThreadPool.
  */
 class Executor {
 public:
@@ -53,6 +54,17 @@ public:
     template <typename Task, typename... Args>
     auto submit(Task task, Args&&... args) -> std::future<decltype(task(args...))>;
 
+    /**
+     * Submits a callable type (function, lambda expression, bind expression, or another function object) to be executed
+     * on an Executor thread, without creating a @c std::future for its result.  Prefer this to @c submit() when the
+     * result is not needed: a small enough task is queued without any heap allocation.
+     *
+     * @param task A callable type representing a task.
+     * @returns @c true if the task was accepted, or @c false if the executor is shutdown.
+     */
+    template <typename Task>
+    bool execute(Task&& task);
+
     /**
      * Submits a callable type (function, lambda expression, bind expression, or another function object) to the front
      * of the internal queue to be executed on an Executor thread. The future must be checked for validity before
@@ -80,18 +92,31 @@ private:
     /// The queue of tasks to execute.
     std::shared_ptr<TaskQueue> m_taskQueue;
 
-    /// The thread to execute tasks on. The thread must be declared last to be destructed first.
-    std::unique_ptr<TaskThread> m_taskThread;
+    /// Executes the tasks from @c m_taskQueue on the pool.
+    std::shared_ptr<Strand> m_strand;
 };
 
 template <typename Task, typename... Args>
 auto Executor::submit(Task task, Args&&... args) -> std::future<decltype(task(args...))> {
-    return m_taskQueue->push(task, std::forward<Args>(args)...);
+    auto future = m_taskQueue->push(task, std::forward<Args>(args)...);
+    m_strand->notifyTaskQueued();
+    return future;
+}
+
+template <typename Task>
+bool Executor::execute(Task&& task) {
+    if (!m_taskQueue->execute(std::forward<Task>(task))) {
+        return false;
+    }
+    m_strand->notifyTaskQueued();
+    return true;
 }
 
 template <typename Task, typename... Args>
 auto Executor::submitToFront(Task task, Args&&... args) -> std::future<decltype(task(args...))> {
-    return m_taskQueue->pushToFront(task, std::forward<Args>(args)...);
+    auto future = m_taskQueue->pushToFront(task, std::forward<Args>(args)...);
+    m_strand->notifyTaskQueued();
+    return future;
 }
 
 }  // namespace threading
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_STRAND_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_STRAND_H_
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "AVSCommon/Utils/Threading/TaskQueue.h"
+#include "AVSCommon/Utils/Threading/ThreadPool.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/**
+ * A Strand executes the tasks from a TaskQueue one at a time and in order, like a @c TaskThread, but borrows a
+ * @c ThreadPool worker to do so only while the queue has tasks in it.
+ */
+class Strand : public std::enable_shared_from_this<Strand> {
+public:
+    /**
+     * Creates a Strand.
+     *
+     * @param taskQueue The TaskQueue to take tasks from to execute.
+     * @param threadPool The pool to execute tasks on.
+     * @return A new @c Strand, or @c nullptr if an argument is @c nullptr.
+     */
+    static std::shared_ptr<Strand> create(std::shared_ptr<TaskQueue> taskQueue, std::shared_ptr<ThreadPool> threadPool);
+
+    /**
+     * Tells the Strand that a task has been pushed onto its TaskQueue.  This must be called after each push.
+     */
+    void notifyTaskQueued();
+
+    /**
+     * Waits for the task which is executing (if any) to complete.  Used after shutting down the TaskQueue, to make
+     * sure that no more tasks will execute.  When called from inside a task, this returns without waiting.
+     */
+    void waitForRunningTask();
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param taskQueue The TaskQueue to take tasks from to execute.
+     * @param threadPool The pool to execute tasks on.
+     */
+    Strand(std::shared_ptr<TaskQueue> taskQueue, std::shared_ptr<ThreadPool> threadPool);
+
+    /**
+     * Executes tasks from the TaskQueue on a pool worker, until the queue is empty or the Strand has had a fair turn.
+     */
+    void runTasks();
+
+    /**
+     * Submits @c runTasks() to the pool.  @c m_mutex must be locked when calling this function.
+     *
+     * @return Whether the pool accepted it.
+     */
+    bool submitLocked();
+
+    /// A weak pointer to the TaskQueue, if the task queue is no longer accessible, there is no reason to execute tasks.
+    std::weak_ptr<TaskQueue> m_taskQueue;
+
+    /// The pool to execute tasks on.
+    std::shared_ptr<ThreadPool> m_threadPool;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// Notified when @c runTasks() returns its pool worker.
+    std::condition_variable m_idleTrigger;
+
+    /// Whether @c runTasks() has been submitted to the pool and has not finished yet.
+    bool m_scheduled;
+
+    /// The thread executing @c runTasks(), or a default-constructed id if it is not executing.
+    std::thread::id m_runningThread;
+};
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_STRAND_H_
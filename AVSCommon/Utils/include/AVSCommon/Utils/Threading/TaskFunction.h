@@ -0,0 +1,276 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_TASKFUNCTION_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_TASKFUNCTION_H_
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/**
+ * A TaskFunction holds a callable which takes no arguments, like a @c std::function<void()>, but is move-only and
+ * stores callables of up to @c INLINE_SIZE bytes (such as a lambda capturing @c this and a couple of
+ * @c std::shared_ptr) inside itself rather than on the heap.  Larger callables are moved to the heap.
+ */
+class TaskFunction {
+public:
+    /// The size of the callables which are stored without allocating.
+    static constexpr size_t INLINE_SIZE = 6 * sizeof(void*);
+
+    /**
+     * Whether a callable of type @c Callable is stored without allocating.
+     *
+     * @tparam Callable The type of the callable.
+     */
+    template <typename Callable>
+    struct IsStoredInline
+            : std::integral_constant<
+                  bool,
+                  sizeof(Callable) <= INLINE_SIZE && alignof(Callable) <= alignof(std::max_align_t) &&
+                      std::is_nothrow_move_constructible<Callable>::value> {};
+
+    /**
+     * Constructs an empty TaskFunction.
+     */
+    TaskFunction() noexcept;
+
+    /**
+     * Constructs an empty TaskFunction.
+     */
+    TaskFunction(std::nullptr_t) noexcept;
+
+    /**
+     * Constructs a TaskFunction holding a callable.
+     *
+     * @param callable The callable, which is moved or copied into the TaskFunction.
+     */
+    template <
+        typename Callable,
+        typename = typename std::enable_if<
+            !std::is_same<typename std::decay<Callable>::type, TaskFunction>::value &&
+            !std::is_same<typename std::decay<Callable>::type, std::nullptr_t>::value>::type>
+    TaskFunction(Callable&& callable);
+
+    /**
+     * Move constructor.
+     *
+     * @param other The TaskFunction to take the callable from.  It is left empty.
+     */
+    TaskFunction(TaskFunction&& other) noexcept;
+
+    /**
+     * Move assignment.  Destroys the callable held by this TaskFunction, if any.
+     *
+     * @param other The TaskFunction to take the callable from.  It is left empty.
+     * @return This TaskFunction.
+     */
+    TaskFunction& operator=(TaskFunction&& other) noexcept;
+
+    /**
+     * Destroys the callable held by this TaskFunction, if any.
+     *
+     * @return This TaskFunction.
+     */
+    TaskFunction& operator=(std::nullptr_t) noexcept;
+
+    /// Destructor.
+    ~TaskFunction();
+
+    /// Deleted copy constructor.
+    TaskFunction(const TaskFunction&) = delete;
+
+    /// Deleted copy assignment.
+    TaskFunction& operator=(const TaskFunction&) = delete;
+
+    /**
+     * Returns whether this TaskFunction holds a callable.
+     *
+     * @return Whether this TaskFunction holds a callable.
+     */
+    explicit operator bool() const noexcept;
+
+    /**
+     * Calls the callable.  Must not be called on an empty TaskFunction.
+     */
+    void operator()();
+
+private:
+    /// The operations the manager function performs on the stored callable.
+    enum class Operation {
+        /// Move-construct the callable at the destination from the source, and destroy the source.
+        MOVE,
+        /// Destroy the callable at the source.
+        DESTROY
+    };
+
+    /// The type of the function which calls the stored callable.
+    using Invoker = void (*)(void* storage);
+
+    /// The type of the function which moves or destroys the stored callable.
+    using Manager = void (*)(Operation operation, void* source, void* destination);
+
+    /**
+     * The functions which handle a callable stored in @c m_storage.
+     *
+     * @tparam Callable The type of the callable.
+     */
+    template <typename Callable>
+    struct InlineHandler {
+        static void invoke(void* storage) {
+            (*static_cast<Callable*>(storage))();
+        }
+        static void manage(Operation operation, void* source, void* destination) {
+            auto callable = static_cast<Callable*>(source);
+            if (Operation::MOVE == operation) {
+                new (destination) Callable(std::move(*callable));
+            }
+            callable->~Callable();
+        }
+    };
+
+    /**
+     * The functions which handle a callable stored on the heap, with a pointer to it in @c m_storage.
+     *
+     * @tparam Callable The type of the callable.
+     */
+    template <typename Callable>
+    struct HeapHandler {
+        static void invoke(void* storage) {
+            (**static_cast<Callable**>(storage))();
+        }
+        static void manage(Operation operation, void* source, void* destination) {
+            auto callable = static_cast<Callable**>(source);
+            if (Operation::MOVE == operation) {
+                *static_cast<Callable**>(destination) = *callable;
+            } else {
+                delete *callable;
+            }
+        }
+    };
+
+    /**
+     * Stores a callable which fits in @c m_storage.
+     *
+     * @param callable The callable.
+     */
+    template <typename Callable>
+    void store(Callable&& callable, std::true_type);
+
+    /**
+     * Stores a callable on the heap.
+     *
+     * @param callable The callable.
+     */
+    template <typename Callable>
+    void store(Callable&& callable, std::false_type);
+
+    /// Destroys the stored callable, if any, and leaves this TaskFunction empty.
+    void reset() noexcept;
+
+    /// Storage for the callable, or for a pointer to it.
+    typename std::aligned_storage<INLINE_SIZE, alignof(std::max_align_t)>::type m_storage;
+
+    /// Calls the stored callable, or @c nullptr if this TaskFunction is empty.
+    Invoker m_invoke;
+
+    /// Moves or destroys the stored callable, or @c nullptr if this TaskFunction is empty.
+    Manager m_manage;
+};
+
+inline TaskFunction::TaskFunction() noexcept : m_invoke{nullptr}, m_manage{nullptr} {
+}
+
+inline TaskFunction::TaskFunction(std::nullptr_t) noexcept : TaskFunction() {
+}
+
+template <typename Callable, typename>
+TaskFunction::TaskFunction(Callable&& callable) : TaskFunction() {
+    using StoredType = typename std::decay<Callable>::type;
+    store(std::forward<Callable>(callable), IsStoredInline<StoredType>());
+}
+
+inline TaskFunction::TaskFunction(TaskFunction&& other) noexcept : TaskFunction() {
+    *this = std::move(other);
+}
+
+inline TaskFunction& TaskFunction::operator=(TaskFunction&& other) noexcept {
+    if (this != &other) {
+        reset();
+        if (other.m_manage) {
+            other.m_manage(Operation::MOVE, &other.m_storage, &m_storage);
+            m_invoke = other.m_invoke;
+            m_manage = other.m_manage;
+            other.m_invoke = nullptr;
+            other.m_manage = nullptr;
+        }
+    }
+    return *this;
+}
+
+inline TaskFunction& TaskFunction::operator=(std::nullptr_t) noexcept {
+    reset();
+    return *this;
+}
+
+inline TaskFunction::~TaskFunction() {
+    reset();
+}
+
+inline TaskFunction::operator bool() const noexcept {
+    return m_invoke != nullptr;
+}
+
+inline void TaskFunction::operator()() {
+    m_invoke(&m_storage);
+}
+
+template <typename Callable>
+void TaskFunction::store(Callable&& callable, std::true_type) {
+    using StoredType = typename std::decay<Callable>::type;
+    new (&m_storage) StoredType(std::forward<Callable>(callable));
+    m_invoke = &InlineHandler<StoredType>::invoke;
+    m_manage = &InlineHandler<StoredType>::manage;
+}
+
+template <typename Callable>
+void TaskFunction::store(Callable&& callable, std::false_type) {
+    using StoredType = typename std::decay<Callable>::type;
+    *reinterpret_cast<StoredType**>(&m_storage) = new StoredType(std::forward<Callable>(callable));
+    m_invoke = &HeapHandler<StoredType>::invoke;
+    m_manage = &HeapHandler<StoredType>::manage;
+}
+
+inline void TaskFunction::reset() noexcept {
+    if (m_manage) {
+        auto manage = m_manage;
+        m_invoke = nullptr;
+        m_manage = nullptr;
+        manage(Operation::DESTROY, &m_storage, nullptr);
+    }
+}
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_TASKFUNCTION_H_
@@ -18,20 +18,25 @@
 
 #include <atomic>
 #include <condition_variable>
-#include <deque>
 #include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
 #include <utility>
 
+#include "AVSCommon/Utils/Threading/TaskFunction.h"
+
 namespace alexaClientSDK {
 namespace avsCommon {
 namespace utils {
 namespace threading {
 
 /**
- * A TaskQueue contains a queue of tasks to run
+ * A TaskQueue contains a queue of tasks to run.
+ *
+ * The queue is a linked list of nodes which are recycled once their tasks have been taken, and tasks are held in
+ * @c TaskFunction objects, so a task which is small enough and is pushed with @c execute() is queued without any heap
+ * allocation.  @c push() and @c pushToFront() also build the @c std::future for the task's result.
  */
 class TaskQueue {
 public:
@@ -40,6 +45,20 @@ public:
      */
     TaskQueue();
 
+    /**
+     * Destructor.
+     */
+    ~TaskQueue();
+
+    /**
+     * Pushes a task on the back of the queue, without creating a @c std::future for its result.  Use this rather than
+     * @c push() when the result is not needed.
+     *
+     * @param task A task to push to the back of the queue.
+     * @returns @c true if the task was queued, or @c false if the queue is shutdown and the task was dropped.
+     */
+    bool execute(TaskFunction task);
+
     /**
      * Pushes a task on the back of the queue. If the queue is shutdown, the task will be dropped, and an invalid
      * future will be returned.
@@ -68,10 +87,29 @@ public:
      * Returns and removes the task at the front of the queue. If there are no tasks, this call will block until there
      * is one. A @c nullptr will be returned if there are no more tasks expected.
      *
+     * @note This wraps the task in a newly allocated @c std::function.  Consumers which run many tasks should use
+     *     @c pop(TaskFunction*) instead.
+     *
      * @returns A task which the caller assumes ownership of, or @c nullptr if the TaskQueue expects no more tasks.
      */
     std::unique_ptr<std::function<void()>> pop();
 
+    /**
+     * Removes the task at the front of the queue. If there are no tasks, this call will block until there is one.
+     *
+     * @param[out] task Set to the task which was removed.
+     * @returns @c true if a task was removed, or @c false if the TaskQueue expects no more tasks.
+     */
+    bool pop(TaskFunction* task);
+
+    /**
+     * Removes the task at the front of the queue, without waiting for one.
+     *
+     * @param[out] task Set to the task which was removed.
+     * @returns @c true if a task was removed, or @c false if the queue is empty.
+     */
+    bool tryPop(TaskFunction* task);
+
     /**
      * Clears the queue of outstanding tasks and refuses any additional tasks to be pushed onto the queue.
      *
@@ -86,9 +124,39 @@ public:
      */
     bool isShutdown();
 
+    /**
+     * Returns whether or not the queue is empty.
+     *
+     * @returns Whether or not the queue is empty.
+     */
+    bool isEmpty();
+
 private:
-    /// The queue type to use for holding tasks.
-    using Queue = std::deque<std::unique_ptr<std::function<void()>>>;
+    /// A queued task.
+    struct Node {
+        /// The task.
+        TaskFunction task;
+
+        /// The next node in the queue, or in the list of free nodes.
+        Node* next;
+    };
+
+    /**
+     * Pushes a task onto the queue.
+     *
+     * @param front If @c true, push to the front of the queue, else push to the back.
+     * @param task A task to push to the front or back of the queue.
+     * @returns @c true if the task was queued, or @c false if the queue is shutdown and the task was dropped.
+     */
+    bool enqueue(bool front, TaskFunction&& task);
+
+    /**
+     * Removes the task at the front of the queue, which must not be empty, and recycles its node.
+     * @c m_queueMutex must be locked when calling this function.
+     *
+     * @param[out] task Set to the task which was removed.
+     */
+    void dequeueLocked(TaskFunction* task);
 
     /**
      * Pushes a task on the the queue. If the queue is shutdown, the task will be dropped, and an invalid
@@ -103,8 +171,17 @@ private:
     template <typename Task, typename... Args>
     auto pushTo(bool front, Task task, Args&&... args) -> std::future<decltype(task(args...))>;
 
-    /// The queue of tasks
-    Queue m_queue;
+    /// The first node in the queue, or @c nullptr if the queue is empty.
+    Node* m_head;
+
+    /// The last node in the queue, or @c nullptr if the queue is empty.
+    Node* m_tail;
+
+    /// Nodes which are not in use, kept to be reused by later tasks.
+    Node* m_freeNodes;
+
+    /// The number of nodes in @c m_freeNodes.
+    size_t m_freeNodeCount;
 
     /// A condition variable to wait for new tasks to be placed on the queue.
     std::condition_variable m_queueChanged;
@@ -171,13 +248,14 @@ auto TaskQueue::pushTo(bool front, Task task, Args&&... args) -> std::future<dec
      * return value back to the future that the user is waiting on.
      */
     using PackagedTaskType = std::packaged_task<decltype(boundTask())()>;
-    auto packaged_task = std::make_shared<PackagedTaskType>(boundTask);
+    auto packaged_task = std::make_shared<PackagedTaskType>(std::move(boundTask));
 
     // Create a promise/future that we will fulfill when we have cleaned up the task.
     auto cleanupPromise = std::make_shared<std::promise<decltype(task(args...))>>();
     auto cleanupFuture = cleanupPromise->get_future();
 
-    // Remove the return type from the task by wrapping it in a lambda with no return value.
+    // Remove the return type from the task by wrapping it in a lambda with no return value.  The lambda only holds
+    // two pointers, so the TaskFunction stores it without another allocation.
     auto translated_task = [packaged_task, cleanupPromise]() mutable {
         // Execute the task.
         packaged_task->operator()();
@@ -192,17 +270,10 @@ auto TaskQueue::pushTo(bool front, Task task, Args&&... args) -> std::future<dec
     // Release our local reference to packaged task so that the only remaining reference is inside the lambda.
     packaged_task.reset();
 
-    {
-        std::lock_guard<std::mutex> queueLock{m_queueMutex};
-        if (!m_shutdown) {
-            m_queue.emplace(front ? m_queue.begin() : m_queue.end(), new std::function<void()>(translated_task));
-        } else {
-            using FutureType = decltype(task(args...));
-            return std::future<FutureType>();
-        }
+    if (!enqueue(front, std::move(translated_task))) {
+        using FutureType = decltype(task(args...));
+        return std::future<FutureType>();
     }
-
-    m_queueChanged.notify_all();
     return cleanupFuture;
 }
 
@@ -0,0 +1,179 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_THREADPOOL_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_THREADPOOL_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/**
+ * A ThreadPool runs jobs on a bounded set of worker threads.  Workers are started on demand, when a job is submitted
+ * and no worker is idle, and exit again once they have been idle for a while, so the number of threads follows the
+ * number of jobs which are actually running at the same time rather than the number of users of the pool.
+ *
+ * Some jobs block for a long time, waiting on the network or on another job.  If every worker is busy and the oldest
+ * queued job has waited for the stall timeout, the pool assumes its workers are blocked and starts one more worker
+ * beyond the limit, and keeps doing so once per stall timeout until the queue moves again.  Those extra workers exit
+ * like any other once they are idle, so a pool full of blocked jobs can not starve the jobs queued behind them.
+ *
+ * Jobs run in no particular order and may run concurrently.  Use a @c Strand to run a sequence of jobs one at a time.
+ */
+class ThreadPool {
+public:
+    /// The default maximum number of worker threads.
+    static const size_t DEFAULT_MAX_THREADS;
+
+    /// The default time for which a worker waits for a new job before it exits.
+    static const std::chrono::milliseconds DEFAULT_IDLE_TIMEOUT;
+
+    /// The default time for which a job may wait for a worker, when all of them are busy, before another is started.
+    static const std::chrono::milliseconds DEFAULT_STALL_TIMEOUT;
+
+    /**
+     * Returns the process-wide pool which @c Executor and @c Timer instances share.
+     *
+     * @return The default @c ThreadPool.
+     */
+    static std::shared_ptr<ThreadPool> getDefaultThreadPool();
+
+    /**
+     * Constructor.
+     *
+     * @param maxThreads The number of worker threads the pool grows to on demand.  Jobs submitted while this many
+     *     workers are busy wait until one of them is free, or until they have waited for @c stallTimeout.
+     * @param idleTimeout The time for which a worker waits for a new job before it exits.
+     * @param stallTimeout The time for which a job may wait while all workers are busy before the pool starts another
+     *     worker beyond @c maxThreads.
+     */
+    ThreadPool(
+        size_t maxThreads = DEFAULT_MAX_THREADS,
+        std::chrono::milliseconds idleTimeout = DEFAULT_IDLE_TIMEOUT,
+        std::chrono::milliseconds stallTimeout = DEFAULT_STALL_TIMEOUT);
+
+    /**
+     * Destructor.  Jobs which have not started are discarded, and running jobs are waited for.
+     *
+     * @warning The last reference to a @c ThreadPool must not be released by one of its own jobs.
+     */
+    ~ThreadPool();
+
+    /**
+     * Submits a job to run on a worker thread.
+     *
+     * @param job The job to run.
+     * @return @c true if the job was accepted, else @c false.
+     */
+    bool submit(std::function<void()> job);
+
+    /**
+     * Returns the number of worker threads which currently exist.
+     *
+     * @return The number of worker threads.
+     */
+    size_t getThreadCount();
+
+private:
+    /// A job which has not started yet.
+    struct Job {
+        /// The function to run.
+        std::function<void()> function;
+
+        /// When the job was submitted.
+        std::chrono::steady_clock::time_point submitted;
+    };
+
+    /**
+     * Runs jobs until the pool is destroyed, or until no job arrives within the idle timeout.
+     */
+    void workerLoop();
+
+    /**
+     * While jobs are queued, starts another worker each time the oldest of them has waited for the stall timeout.
+     * Exits once the queue is empty.
+     */
+    void stallMonitorLoop();
+
+    /**
+     * Starts a worker.  @c m_mutex must be held.
+     */
+    void startWorker();
+
+    /**
+     * Joins workers which have exited.
+     */
+    void joinRetiredWorkers();
+
+    /// The maximum number of worker threads.
+    const size_t m_maxThreads;
+
+    /// The time for which a worker waits for a new job before it exits.
+    const std::chrono::milliseconds m_idleTimeout;
+
+    /// The time for which a job may wait while all workers are busy before another worker is started.
+    const std::chrono::milliseconds m_stallTimeout;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// Notified when a job is submitted or the pool is destroyed.
+    std::condition_variable m_wakeTrigger;
+
+    /// Jobs which have not started yet.
+    std::deque<Job> m_jobs;
+
+    /// The running workers.
+    std::unordered_map<std::thread::id, std::thread> m_workers;
+
+    /// Workers which have exited but have not been joined yet.
+    std::vector<std::thread> m_retiredWorkers;
+
+    /// The number of workers waiting for a job.
+    size_t m_idleWorkers;
+
+    /// When a worker last started a job.
+    std::chrono::steady_clock::time_point m_lastJobStarted;
+
+    /// Whether the pool is being destroyed.
+    bool m_shutdown;
+
+    /// Notified when the pool is destroyed, to stop @c m_stallMonitor.
+    std::condition_variable m_stallMonitorTrigger;
+
+    /// The thread running @c stallMonitorLoop(), if it has been started.
+    std::thread m_stallMonitor;
+
+    /// Whether @c m_stallMonitor is running @c stallMonitorLoop().
+    bool m_isMonitoringStalls;
+};
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_THREADPOOL_H_
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_LATENCYHISTOGRAM_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_LATENCYHISTOGRAM_H_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * A histogram of latencies with fixed, roughly logarithmic buckets from 1 us to 2 s, which is cheap enough to update
+ * on every operation and small enough to keep one per component.
+ *
+ * This class is not thread-safe.
+ */
+class LatencyHistogram {
+public:
+    /// The number of buckets with an upper bound.  One more bucket holds the latencies above the last bound.
+    static constexpr size_t BOUNDED_BUCKET_COUNT = 20;
+
+    /// The upper bounds of the buckets, inclusive, in ascending order.
+    static const std::array<std::chrono::microseconds, BOUNDED_BUCKET_COUNT> BUCKET_BOUNDS;
+
+    /**
+     * Constructor.
+     */
+    LatencyHistogram();
+
+    /**
+     * Adds a latency to the histogram.
+     *
+     * @param latency The latency.
+     */
+    void record(std::chrono::nanoseconds latency);
+
+    /**
+     * Returns the number of latencies recorded.
+     *
+     * @return The number of latencies recorded.
+     */
+    size_t getCount() const;
+
+    /**
+     * Returns the number of latencies recorded in one bucket.
+     *
+     * @param bucket The index of the bucket, where @c BOUNDED_BUCKET_COUNT is the bucket above the last bound.
+     * @return The number of latencies in the bucket, or zero if there is no such bucket.
+     */
+    size_t getBucketCount(size_t bucket) const;
+
+    /**
+     * Returns the largest latency recorded.
+     *
+     * @return The largest latency recorded, or zero if none has been recorded.
+     */
+    std::chrono::microseconds getMax() const;
+
+    /**
+     * Returns an upper bound for the given percentile: the bound of the bucket which holds it, or the largest latency
+     * recorded if that is smaller or the percentile lies above the last bound.
+     *
+     * @param percentile The percentile, from 0 to 100.
+     * @return The upper bound, or zero if no latency has been recorded.
+     */
+    std::chrono::microseconds getPercentile(unsigned int percentile) const;
+
+    /**
+     * Returns a short summary for logging, with the count, median, 90th and 99th percentiles and maximum.
+     *
+     * @return The summary.
+     */
+    std::string toString() const;
+
+private:
+    /// The number of latencies in each bucket.
+    std::array<size_t, BOUNDED_BUCKET_COUNT + 1> m_buckets;
+
+    /// The number of latencies recorded.
+    size_t m_count;
+
+    /// The largest latency recorded.
+    std::chrono::microseconds m_max;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_LATENCYHISTOGRAM_H_
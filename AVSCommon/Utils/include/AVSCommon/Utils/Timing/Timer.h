@@ -20,6 +20,7 @@
 #include <condition_variable>
 #include <functional>
 #include <future>
+#include <memory>
 #include <mutex>
 #include <thread>
 
@@ -173,18 +174,18 @@ public:
     bool isActive() const;
 
 private:
+    /// The state of a @c Timer, which is shared with the callbacks it schedules on the @c TimerScheduler.
+    class State;
+
     /**
-     * Atomically activates this @c Timer (by setting @c m_running).
+     * Atomically activates this @c Timer (by setting its running flag).
      *
      * @returns @c true if the @c Timer was previously inactive, else @c false.
      */
     bool activate();
 
     /**
-     * Waits for the @c Timer @c period, then calls @c task.
-     *
-     * @tparam Rep A type for measuring 'ticks' in a generic @c std::chrono::duration.
-     * @tparam Period A type for representing the number of ticks per second in a generic @c std::chrono::duration.
+     * Schedules the calls to @c task on the process-wide @c TimerScheduler.  The @c Timer must have been activated.
      *
      * @param delay The non-negative time to wait before making the first @c task call.
      * @param period The non-negative time to wait between subsequent @c task calls.
@@ -194,10 +195,9 @@ private:
      *     @c PeriodType::ABSOLUTE and the task runtime exceeds @c period.
      * @param task A callable type representing a task.
      */
-    template <typename Rep, typename Period>
-    void callTask(
-        std::chrono::duration<Rep, Period> delay,
-        std::chrono::duration<Rep, Period> period,
+    void startTask(
+        std::chrono::nanoseconds delay,
+        std::chrono::nanoseconds period,
         PeriodType periodType,
         size_t maxCount,
         std::function<void()> task);
@@ -207,23 +207,8 @@ private:
      */
     static const std::string TAG;
 
-    /// The condition variable used to wait for @c stop() or period timeouts.
-    std::condition_variable m_waitCondition;
-
-    /// The mutex for @c m_waitCondition.
-    std::mutex m_waitMutex;
-
-    /// The thread to execute tasks on.
-    std::thread m_thread;
-
-    /// Flag which indicates that a @c Timer is active.
-    std::atomic<bool> m_running;
-
-    /**
-     * Flag which requests that the active @c Timer be stopped.  @c m_waitMutex must be locked when modifying this
-     * variable.
-     */
-    bool m_stopping;
+    /// The state of this @c Timer.
+    std::shared_ptr<State> m_state;
 };
 
 template <typename Rep, typename Period, typename Task, typename... Args>
@@ -249,11 +234,6 @@ bool Timer::start(
         return false;
     }
 
-    // Join old timer thread (if any).
-    if (m_thread.joinable()) {
-        m_thread.join();
-    }
-
     // Remove arguments from the task's type by binding the arguments to the task.
     using BoundTaskType = decltype(std::bind(std::forward<Task>(task), std::forward<Args>(args)...));
     auto boundTask = std::make_shared<BoundTaskType>(std::bind(std::forward<Task>(task), std::forward<Args>(args)...));
@@ -261,9 +241,12 @@ bool Timer::start(
     // Remove the return type from the task by wrapping it in a lambda with no return value.
     auto translatedTask = [boundTask]() { boundTask->operator()(); };
 
-    // Kick off the new timer thread.
-    m_thread = std::thread{
-        std::bind(&Timer::callTask<Rep, Period>, this, delay, period, periodType, maxCount, translatedTask)};
+    startTask(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(delay),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(period),
+        periodType,
+        maxCount,
+        translatedTask);
 
     return true;
 }
@@ -288,11 +271,6 @@ auto Timer::start(const std::chrono::duration<Rep, Period>& delay, Task task, Ar
         return std::future<FutureType>();
     }
 
-    // Join old timer thread (if any).
-    if (m_thread.joinable()) {
-        m_thread.join();
-    }
-
     // Remove arguments from the task's type by binding the arguments to the task.
     auto boundTask = std::bind(std::forward<Task>(task), std::forward<Args>(args)...);
 
@@ -307,68 +285,13 @@ auto Timer::start(const std::chrono::duration<Rep, Period>& delay, Task task, Ar
     // Remove the return type from the task by wrapping it in a lambda with no return value.
     auto translatedTask = [packagedTask]() { packagedTask->operator()(); };
 
-    // Kick off the new timer thread.
     static const size_t once = 1;
-    m_thread = std::thread{
-        std::bind(&Timer::callTask<Rep, Period>, this, delay, delay, PeriodType::ABSOLUTE, once, translatedTask)};
+    auto delayNs = std::chrono::duration_cast<std::chrono::nanoseconds>(delay);
+    startTask(delayNs, delayNs, PeriodType::ABSOLUTE, once, translatedTask);
 
     return packagedTask->get_future();
 }
 
-template <typename Rep, typename Period>
-void Timer::callTask(
-    std::chrono::duration<Rep, Period> delay,
-    std::chrono::duration<Rep, Period> period,
-    PeriodType periodType,
-    size_t maxCount,
-    std::function<void()> task) {
-    // Timepoint to measure delay/period against.
-    auto now = std::chrono::steady_clock::now();
-
-    // Flag indicating whether we've drifted off schedule.
-    bool offSchedule = false;
-
-    for (size_t count = 0; maxCount == FOREVER || count < maxCount; ++count) {
-        auto waitTime = (0 == count) ? delay : period;
-        {
-            std::unique_lock<std::mutex> lock(m_waitMutex);
-
-            // Wait for stop() or a delay/period to elapse.
-            if (m_waitCondition.wait_until(lock, now + waitTime, [this]() { return m_stopping; })) {
-                m_stopping = false;
-                m_running = false;
-                return;
-            }
-        }
-
-        switch (periodType) {
-            case PeriodType::ABSOLUTE:
-                // Update our estimate of where we should be after the delay.
-                now += waitTime;
-
-                // Run the task if we're still on schedule.
-                if (!offSchedule) {
-                    task();
-                }
-
-                // If the task runtime put us off schedule, skip the next task run.
-                if (now + period < std::chrono::steady_clock::now()) {
-                    offSchedule = true;
-                } else {
-                    offSchedule = false;
-                }
-                break;
-
-            case PeriodType::RELATIVE:
-                task();
-                now = std::chrono::steady_clock::now();
-                break;
-        }
-    }
-    m_stopping = false;
-    m_running = false;
-}
-
 }  // namespace timing
 }  // namespace utils
 }  // namespace avsCommon
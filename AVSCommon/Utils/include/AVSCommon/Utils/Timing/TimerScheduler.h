@@ -0,0 +1,118 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERSCHEDULER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERSCHEDULER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include "AVSCommon/Utils/Threading/ThreadPool.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * A TimerScheduler keeps the deadlines of many timers on a single thread.  When a deadline passes, its callback is
+ * submitted to a @c ThreadPool, so a slow callback never delays the others.
+ */
+class TimerScheduler {
+public:
+    /// Identifies a scheduled callback.
+    using TimerId = uint64_t;
+
+    /**
+     * Returns the process-wide scheduler which drives all @c Timer instances.
+     *
+     * @return The default @c TimerScheduler.
+     */
+    static std::shared_ptr<TimerScheduler> getInstance();
+
+    /**
+     * Constructor.
+     *
+     * @param threadPool The pool to run callbacks on.
+     */
+    TimerScheduler(std::shared_ptr<threading::ThreadPool> threadPool);
+
+    /**
+     * Destructor.  Callbacks which have not been submitted to the pool are discarded.
+     */
+    ~TimerScheduler();
+
+    /**
+     * Schedules a callback.
+     *
+     * @param deadline The time at which to submit @c callback to the pool.  A deadline which has already passed is
+     *     submitted straight away.
+     * @param callback The callback.
+     * @return An id which can be passed to @c cancel().
+     */
+    TimerId schedule(std::chrono::steady_clock::time_point deadline, std::function<void()> callback);
+
+    /**
+     * Discards a callback which has not been submitted to the pool yet.  Does nothing if it has.
+     *
+     * @param id The id returned by @c schedule().
+     */
+    void cancel(TimerId id);
+
+private:
+    /**
+     * Waits for deadlines and submits their callbacks, until the scheduler is destroyed.
+     */
+    void schedulerLoop();
+
+    /// The pool to run callbacks on.
+    std::shared_ptr<threading::ThreadPool> m_threadPool;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// Notified when an earlier deadline is scheduled, or when the scheduler is destroyed.
+    std::condition_variable m_wakeTrigger;
+
+    /// The scheduled deadlines, earliest first.
+    std::set<std::pair<std::chrono::steady_clock::time_point, TimerId>> m_deadlines;
+
+    /// The scheduled callbacks, with their deadlines.
+    std::unordered_map<TimerId, std::pair<std::chrono::steady_clock::time_point, std::function<void()>>> m_callbacks;
+
+    /// The id for the next call to @c schedule().
+    TimerId m_nextId;
+
+    /// Whether the scheduler is being destroyed.
+    bool m_shutdown;
+
+    /// The thread which waits for deadlines.
+    std::thread m_thread;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERSCHEDULER_H_
@@ -13,7 +13,6 @@
  * permissions and limitations under the License.
  */
 
-#include "AVSCommon/Utils/Memory/Memory.h"
 #include "AVSCommon/Utils/Threading/Executor.h"
 
 namespace alexaClientSDK {
@@ -23,8 +22,7 @@ namespace threading {
 
 Executor::Executor() :
         m_taskQueue{std::make_shared<TaskQueue>()},
-        m_taskThread{memory::make_unique<TaskThread>(m_taskQueue)} {
-    m_taskThread->start();
+        m_strand{Strand::create(m_taskQueue, ThreadPool::getDefaultThreadPool())} {
 }
 
 Executor::~Executor() {
@@ -34,14 +32,15 @@ Executor::~Executor() {
 void Executor::waitForSubmittedTasks() {
     std::promise<void> flushedPromise;
     auto flushedFuture = flushedPromise.get_future();
-    auto task = [&flushedPromise]() { flushedPromise.set_value(); };
-    submit(task);
+    if (!execute([&flushedPromise]() { flushedPromise.set_value(); })) {
+        return;
+    }
     flushedFuture.get();
 }
 
 void Executor::shutdown() {
     m_taskQueue->shutdown();
-    m_taskThread.reset();
+    m_strand->waitForRunningTask();
 }
 
 bool Executor::isShutdown() {
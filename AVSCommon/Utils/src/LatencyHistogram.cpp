@@ -0,0 +1,101 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <sstream>
+
+#include "AVSCommon/Utils/Timing/LatencyHistogram.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+using namespace std::chrono;
+
+constexpr size_t LatencyHistogram::BOUNDED_BUCKET_COUNT;
+
+const std::array<microseconds, LatencyHistogram::BOUNDED_BUCKET_COUNT> LatencyHistogram::BUCKET_BOUNDS = {
+    {microseconds(1),
+     microseconds(2),
+     microseconds(5),
+     microseconds(10),
+     microseconds(20),
+     microseconds(50),
+     microseconds(100),
+     microseconds(200),
+     microseconds(500),
+     milliseconds(1),
+     milliseconds(2),
+     milliseconds(5),
+     milliseconds(10),
+     milliseconds(20),
+     milliseconds(50),
+     milliseconds(100),
+     milliseconds(200),
+     milliseconds(500),
+     milliseconds(1000),
+     milliseconds(2000)}};
+
+LatencyHistogram::LatencyHistogram() : m_count{0}, m_max{0} {
+    m_buckets.fill(0);
+}
+
+void LatencyHistogram::record(nanoseconds latency) {
+    auto bucket = std::lower_bound(BUCKET_BOUNDS.begin(), BUCKET_BOUNDS.end(), latency) - BUCKET_BOUNDS.begin();
+    ++m_buckets[bucket];
+    ++m_count;
+    m_max = std::max(m_max, duration_cast<microseconds>(latency));
+}
+
+size_t LatencyHistogram::getCount() const {
+    return m_count;
+}
+
+size_t LatencyHistogram::getBucketCount(size_t bucket) const {
+    return bucket < m_buckets.size() ? m_buckets[bucket] : 0;
+}
+
+microseconds LatencyHistogram::getMax() const {
+    return m_max;
+}
+
+microseconds LatencyHistogram::getPercentile(unsigned int percentile) const {
+    if (0 == m_count) {
+        return microseconds::zero();
+    }
+    // The number of latencies at or below the percentile, rounded up so that the 100th percentile is the maximum.
+    size_t rank = std::max<size_t>(1, (m_count * std::min(percentile, 100u) + 99) / 100);
+    size_t seen = 0;
+    for (size_t bucket = 0; bucket < BOUNDED_BUCKET_COUNT; ++bucket) {
+        seen += m_buckets[bucket];
+        if (seen >= rank) {
+            return std::min<microseconds>(BUCKET_BOUNDS[bucket], m_max);
+        }
+    }
+    return m_max;
+}
+
+std::string LatencyHistogram::toString() const {
+    std::ostringstream stream;
+    stream << "count=" << m_count << " p50<=" << getPercentile(50).count() << "us p90<=" << getPercentile(90).count()
+           << "us p99<=" << getPercentile(99).count() << "us max=" << m_max.count() << "us";
+    return stream.str();
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
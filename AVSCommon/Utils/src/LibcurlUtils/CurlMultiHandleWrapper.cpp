@@ -101,6 +101,21 @@ CURLMcode CurlMultiHandleWrapper::wait(std::chrono::milliseconds timeout, int* c
     return result;
 }
 
+CURLMcode CurlMultiHandleWrapper::wait(std::chrono::milliseconds timeout, int* countHandlesUpdated, int wakeupFd) {
+    curl_waitfd extraFd;
+    extraFd.fd = wakeupFd;
+    extraFd.events = CURL_WAIT_POLLIN;
+    extraFd.revents = 0;
+    auto result = curl_multi_wait(m_handle, &extraFd, 1, timeout.count(), countHandlesUpdated);
+    if (result != CURLM_OK) {
+        ACSDK_ERROR(LX("curlMultiWaitFailed").d("error", curl_multi_strerror(result)));
+    } else if (countHandlesUpdated && extraFd.revents && *countHandlesUpdated > 0) {
+        // curl_multi_wait() counts the extra descriptor along with its own; callers only want transfer activity.
+        --*countHandlesUpdated;
+    }
+    return result;
+}
+
 CURLMsg* CurlMultiHandleWrapper::infoRead(int* messagesInQueue) {
     return curl_multi_info_read(m_handle, messagesInQueue);
 }
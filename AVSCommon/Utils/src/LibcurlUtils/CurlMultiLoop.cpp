@@ -0,0 +1,283 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <iterator>
+
+#include <AVSCommon/Utils/LibcurlUtils/CurlMultiLoop.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("CurlMultiLoop");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/**
+ * The longest time the loop waits on its sockets.  Work queued for the loop wakes it at once, so this only bounds how
+ * late @c libcurl's own timeouts are noticed.
+ */
+static const std::chrono::milliseconds MAX_WAIT_TIME(1000);
+
+std::shared_ptr<CurlMultiLoop> CurlMultiLoop::create() {
+    auto multi = CurlMultiHandleWrapper::create();
+    if (!multi) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "createCurlMultiHandleWrapperFailed"));
+        return nullptr;
+    }
+    auto wakeupPipe = WakeupPipe::create();
+    if (!wakeupPipe) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "createWakeupPipeFailed"));
+        return nullptr;
+    }
+    auto share = curl_share_init();
+    if (!share) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "curlShareInitFailed"));
+        return nullptr;
+    }
+    auto loop = std::shared_ptr<CurlMultiLoop>(new CurlMultiLoop(std::move(multi), share, wakeupPipe));
+    // Connections are cached by the multi handle anyway, so failing to share them as well is not an error.
+    if (curl_share_setopt(share, CURLSHOPT_LOCKFUNC, lockShare) != CURLSHE_OK ||
+        curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, unlockShare) != CURLSHE_OK ||
+        curl_share_setopt(share, CURLSHOPT_USERDATA, loop.get()) != CURLSHE_OK ||
+        curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS) != CURLSHE_OK ||
+        curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION) != CURLSHE_OK) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "curlShareSetoptFailed"));
+        return nullptr;
+    }
+#if LIBCURL_VERSION_NUM >= 0x073900
+    if (curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT) != CURLSHE_OK) {
+        ACSDK_WARN(LX("create").d("reason", "shareConnectionsFailed"));
+    }
+#endif
+    loop->m_thread = std::thread(&CurlMultiLoop::loop, loop.get());
+    return loop;
+}
+
+CurlMultiLoop::CurlMultiLoop(
+    std::unique_ptr<CurlMultiHandleWrapper> multi,
+    CURLSH* share,
+    std::shared_ptr<WakeupPipe> wakeupPipe) :
+        m_multi{std::move(multi)},
+        m_share{share},
+        m_wakeupPipe{wakeupPipe},
+        m_isShuttingDown{false} {
+}
+
+CurlMultiLoop::~CurlMultiLoop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isShuttingDown = true;
+    }
+    m_wakeupPipe->wake();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    for (auto& transfer : m_transfers) {
+        if (transfer.second.isRunning) {
+            m_multi->removeHandle(transfer.first);
+        }
+        curl_easy_setopt(transfer.first, CURLOPT_SHARE, nullptr);
+    }
+    m_transfers.clear();
+    if (curl_share_cleanup(m_share) != CURLSHE_OK) {
+        ACSDK_ERROR(LX("curlShareCleanupFailed"));
+    }
+}
+
+bool CurlMultiLoop::addTransfer(CURL* handle, std::function<void(CURLcode)> onDone) {
+    if (!handle) {
+        ACSDK_ERROR(LX("addTransferFailed").d("reason", "nullHandle"));
+        return false;
+    }
+    if (curl_easy_setopt(handle, CURLOPT_SHARE, m_share) != CURLE_OK) {
+        ACSDK_ERROR(LX("addTransferFailed").d("reason", "setShareFailed"));
+        return false;
+    }
+    queueCommand([this, handle, onDone]() {
+        if (m_transfers.count(handle)) {
+            ACSDK_ERROR(LX("addTransferFailed").d("reason", "alreadyAdded"));
+            return;
+        }
+        auto result = m_multi->addHandle(handle);
+        m_transfers[handle] = {onDone, CURLM_OK == result};
+        if (result != CURLM_OK) {
+            ACSDK_ERROR(LX("addTransferFailed").d("reason", "addHandleFailed").d("error", curl_multi_strerror(result)));
+            onDone(CURLE_FAILED_INIT);
+        }
+    });
+    return true;
+}
+
+void CurlMultiLoop::removeTransfer(CURL* handle) {
+    if (std::this_thread::get_id() == m_thread.get_id()) {
+        removeTransferInLoop(handle);
+        return;
+    }
+    bool isRemoved = false;
+    queueCommand([this, handle, &isRemoved]() {
+        removeTransferInLoop(handle);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        isRemoved = true;
+    });
+    std::unique_lock<std::mutex> lock(m_mutex);
+    // A loop which is shutting down runs no more commands, and its destructor removes the handle.
+    m_commandDone.wait(lock, [this, &isRemoved]() { return isRemoved || m_isShuttingDown; });
+}
+
+void CurlMultiLoop::post(CURL* handle, std::function<void()> task, std::chrono::milliseconds delay) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push_back({handle, std::chrono::steady_clock::now() + delay, std::move(task)});
+    }
+    m_wakeupPipe->wake();
+}
+
+void CurlMultiLoop::queueCommand(std::function<void()> command) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_commands.push_back(std::move(command));
+    }
+    m_wakeupPipe->wake();
+}
+
+void CurlMultiLoop::loop() {
+    while (true) {
+        std::deque<std::function<void()>> commands;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_isShuttingDown) {
+                break;
+            }
+            commands.swap(m_commands);
+        }
+        if (!commands.empty()) {
+            for (auto& command : commands) {
+                command();
+            }
+            m_commandDone.notify_all();
+        }
+
+        auto waitTime = runTasks(MAX_WAIT_TIME);
+
+        int runningHandles = 0;
+        auto result = m_multi->perform(&runningHandles);
+        if (result != CURLM_OK && result != CURLM_CALL_MULTI_PERFORM) {
+            ACSDK_ERROR(LX("performFailed").d("error", curl_multi_strerror(result)));
+        }
+        completeTransfers();
+
+        long curlTimeout = -1;
+        if (curl_multi_timeout(m_multi->getCurlHandle(), &curlTimeout) == CURLM_OK && curlTimeout >= 0) {
+            waitTime = std::min(waitTime, std::chrono::milliseconds(curlTimeout));
+        }
+        int numFdsReady = 0;
+        m_multi->wait(waitTime, &numFdsReady, m_wakeupPipe->getReadFd());
+        m_wakeupPipe->consume();
+    }
+    m_commandDone.notify_all();
+}
+
+std::chrono::milliseconds CurlMultiLoop::runTasks(std::chrono::milliseconds maxWait) {
+    std::vector<Task> dueTasks;
+    auto waitTime = maxWait;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto now = std::chrono::steady_clock::now();
+        auto notDue = std::stable_partition(
+            m_tasks.begin(), m_tasks.end(), [now](const Task& task) { return task.due <= now; });
+        std::move(m_tasks.begin(), notDue, std::back_inserter(dueTasks));
+        m_tasks.erase(m_tasks.begin(), notDue);
+        for (auto& task : m_tasks) {
+            waitTime = std::min(
+                waitTime, std::chrono::duration_cast<std::chrono::milliseconds>(task.due - now) +
+                              std::chrono::milliseconds(1));
+        }
+    }
+    for (auto& task : dueTasks) {
+        // A task stays pending while other tasks run, so its transfer may have been removed by one of them.
+        if (m_transfers.count(task.handle)) {
+            task.task();
+        }
+    }
+    return waitTime;
+}
+
+void CurlMultiLoop::completeTransfers() {
+    int messagesInQueue = 0;
+    while (auto message = m_multi->infoRead(&messagesInQueue)) {
+        if (message->msg != CURLMSG_DONE) {
+            continue;
+        }
+        auto handle = message->easy_handle;
+        auto result = message->data.result;
+        auto it = m_transfers.find(handle);
+        if (it == m_transfers.end()) {
+            ACSDK_ERROR(LX("completeTransfersFailed").d("reason", "unknownHandle"));
+            m_multi->removeHandle(handle);
+            continue;
+        }
+        // The message belongs to the multi handle, so it is not used after the handle is removed.
+        m_multi->removeHandle(handle);
+        it->second.isRunning = false;
+        auto onDone = it->second.onDone;
+        if (onDone) {
+            onDone(result);
+        }
+    }
+}
+
+void CurlMultiLoop::removeTransferInLoop(CURL* handle) {
+    auto it = m_transfers.find(handle);
+    if (it != m_transfers.end()) {
+        if (it->second.isRunning) {
+            m_multi->removeHandle(handle);
+        }
+        m_transfers.erase(it);
+    }
+    curl_easy_setopt(handle, CURLOPT_SHARE, nullptr);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tasks.erase(
+        std::remove_if(m_tasks.begin(), m_tasks.end(), [handle](const Task& task) { return task.handle == handle; }),
+        m_tasks.end());
+}
+
+void CurlMultiLoop::lockShare(CURL* handle, curl_lock_data data, curl_lock_access access, void* userPointer) {
+    auto loop = static_cast<CurlMultiLoop*>(userPointer);
+    if (loop && data >= 0 && data < CURL_LOCK_DATA_LAST) {
+        loop->m_shareMutexes[data].lock();
+    }
+}
+
+void CurlMultiLoop::unlockShare(CURL* handle, curl_lock_data data, void* userPointer) {
+    auto loop = static_cast<CurlMultiLoop*>(userPointer);
+    if (loop && data >= 0 && data < CURL_LOCK_DATA_LAST) {
+        loop->m_shareMutexes[data].unlock();
+    }
+}
+
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -24,7 +24,16 @@ namespace libcurlUtils {
 
 std::unique_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> HTTPContentFetcherFactory::create(
     const std::string& url) {
-    return avsCommon::utils::memory::make_unique<LibCurlHttpContentFetcher>(url);
+    std::shared_ptr<CurlMultiLoop> loop;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_loop) {
+            m_loop = CurlMultiLoop::create();
+        }
+        loop = m_loop;
+    }
+    // Without a loop, each fetcher performs its transfer on a thread of its own.
+    return avsCommon::utils::memory::make_unique<LibCurlHttpContentFetcher>(url, loop);
 }
 
 }  // namespace libcurlUtils
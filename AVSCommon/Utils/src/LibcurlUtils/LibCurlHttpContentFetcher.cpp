@@ -34,6 +34,12 @@ static const std::string TAG("LibCurlHttpContentFetcher");
  */
 static const std::chrono::milliseconds TIMEOUT_FOR_BLOCKING_WRITE = std::chrono::milliseconds(100);
 
+/**
+ * The timeout for a write to an @c AttachmentWriter from a @c CurlMultiLoop.  A blocking writer takes zero to mean no
+ * timeout, so this is the shortest wait which lets a full writer pause the transfer rather than stall the loop.
+ */
+static const std::chrono::milliseconds TIMEOUT_FOR_LOOP_WRITE = std::chrono::milliseconds(1);
+
 /**
  * Create a LogEntry using this file's TAG and the specified event string.
  *
@@ -86,8 +92,10 @@ size_t LibCurlHttpContentFetcher::bodyCallback(char* data, size_t size, size_t n
     }
     if (!thisObject->m_bodyCallbackBegan) {
         thisObject->m_bodyCallbackBegan = true;
-        thisObject->m_statusCodePromise.set_value(thisObject->m_lastStatusCode);
-        thisObject->m_contentTypePromise.set_value(thisObject->m_lastContentType);
+        thisObject->resolvePromises();
+    }
+    if (thisObject->m_loop) {
+        return thisObject->writeBodyOnLoop(data, size * nmemb);
     }
     auto streamWriter = thisObject->m_streamWriter;
     size_t totalBytesWritten = 0;
@@ -131,11 +139,34 @@ size_t LibCurlHttpContentFetcher::noopCallback(char* data, size_t size, size_t n
     return 0;
 }
 
-LibCurlHttpContentFetcher::LibCurlHttpContentFetcher(const std::string& url) :
+int LibCurlHttpContentFetcher::progressCallback(
+    void* userData,
+    curl_off_t downloadTotal,
+    curl_off_t downloaded,
+    curl_off_t uploadTotal,
+    curl_off_t uploaded) {
+    if (!userData) {
+        ACSDK_ERROR(LX("progressCallback").d("reason", "nullUserDataPointer"));
+        return 1;
+    }
+    LibCurlHttpContentFetcher* thisObject = static_cast<LibCurlHttpContentFetcher*>(userData);
+    // A non-zero return aborts the transfer.
+    return thisObject->m_done ? 1 : 0;
+}
+
+LibCurlHttpContentFetcher::LibCurlHttpContentFetcher(const std::string& url, std::shared_ptr<CurlMultiLoop> loop) :
         m_url{url},
+        m_loop{loop},
         m_bodyCallbackBegan{false},
         m_lastStatusCode{0},
-        m_done{false} {
+        m_done{false},
+        m_stopOnDestruction{false},
+        m_arePromisesResolved{false},
+        m_writerWasCreatedLocally{false},
+        m_isTransferDone{false},
+        m_hasSpaceAvailableCallback{false},
+        m_isTransferOnLoop{false},
+        m_isWaitingForSpace{false} {
     m_hasObjectBeenUsed.clear();
 }
 
@@ -185,6 +216,12 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
                 ACSDK_ERROR(LX("getContentFailed").d("reason", "failedToSetCurlCallback"));
                 return nullptr;
             }
+            if (m_loop) {
+                if (!startTransferOnLoop(fetchOption, false)) {
+                    return nullptr;
+                }
+                break;
+            }
             m_thread = std::thread([this]() {
                 long finalResponseCode = 0;
                 char* contentType = nullptr;
@@ -210,10 +247,25 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
                 }
             });
             break;
+        case FetchOptions::CONTENT_TYPE_AND_BODY:
+            /*
+             * The body callback stops the transfer once m_done is set by the destructor.  The progress callback does
+             * the same while no data is arriving.
+             */
+            m_stopOnDestruction = true;
+            if (curl_easy_setopt(m_curlWrapper.getCurlHandle(), CURLOPT_XFERINFOFUNCTION, progressCallback) !=
+                    CURLE_OK ||
+                curl_easy_setopt(m_curlWrapper.getCurlHandle(), CURLOPT_XFERINFODATA, this) != CURLE_OK ||
+                curl_easy_setopt(m_curlWrapper.getCurlHandle(), CURLOPT_NOPROGRESS, 0L) != CURLE_OK) {
+                ACSDK_ERROR(LX("getContentFailed").d("reason", "failedToSetCurlProgressCallback"));
+                return nullptr;
+            }
+        /* FALL THROUGH - the body is fetched the same way */
         case FetchOptions::ENTIRE_BODY:
             if (!writer) {
                 // Using the url as the identifier for the attachment
-                stream = std::make_shared<avsCommon::avs::attachment::InProcessAttachment>(m_url);
+                stream = std::make_shared<avsCommon::avs::attachment::InProcessAttachment>(
+                    m_url, avsCommon::avs::attachment::AttachmentBufferPool::SizeHint::MEDIA_STREAM);
                 writer = stream->createWriter(sds::WriterPolicy::BLOCKING);
                 writerWasCreatedLocally = true;
             }
@@ -232,15 +284,22 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
                 ACSDK_ERROR(LX("getContentFailed").d("reason", "failedToSetCurlHeaderCallback"));
                 return nullptr;
             }
+            if (m_loop) {
+                if (!startTransferOnLoop(fetchOption, writerWasCreatedLocally)) {
+                    return nullptr;
+                }
+                break;
+            }
             m_thread = std::thread([this, writerWasCreatedLocally]() {
                 auto curlReturnValue = curl_easy_perform(m_curlWrapper.getCurlHandle());
                 if (curlReturnValue != CURLE_OK) {
-                    ACSDK_ERROR(LX("curlEasyPerformFailed").d("error", curl_easy_strerror(curlReturnValue)));
-                }
-                if (!m_bodyCallbackBegan) {
-                    m_statusCodePromise.set_value(m_lastStatusCode);
-                    m_contentTypePromise.set_value(m_lastContentType);
+                    if (m_done) {
+                        ACSDK_DEBUG9(LX("curlEasyPerformStopped").d("reason", "fetcherDestroyed"));
+                    } else {
+                        ACSDK_ERROR(LX("curlEasyPerformFailed").d("error", curl_easy_strerror(curlReturnValue)));
+                    }
                 }
+                resolvePromises();
                 /*
                  * If the writer was created locally, its job is done and can be safely closed.
                  */
@@ -264,7 +323,214 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
         avsCommon::utils::HTTPContent{std::move(httpStatusCodeFuture), std::move(contentTypeFuture), stream});
 }
 
+bool LibCurlHttpContentFetcher::startTransferOnLoop(FetchOptions fetchOption, bool writerWasCreatedLocally) {
+    m_writerWasCreatedLocally = writerWasCreatedLocally;
+    auto handle = m_curlWrapper.getCurlHandle();
+    if (m_streamWriter) {
+        m_hasSpaceAvailableCallback = m_streamWriter->setSpaceAvailableCallback([this, handle]() {
+            if (m_isWaitingForSpace.exchange(false)) {
+                m_loop->post(handle, [this]() { onSpaceAvailable(); });
+            }
+        });
+    }
+    m_isTransferOnLoop = m_loop->addTransfer(
+        handle, [this, fetchOption](CURLcode result) { onTransferDone(fetchOption, result); });
+    if (!m_isTransferOnLoop) {
+        ACSDK_ERROR(LX("getContentFailed").d("reason", "failedToAddTransfer"));
+        if (m_hasSpaceAvailableCallback) {
+            m_streamWriter->setSpaceAvailableCallback(nullptr);
+        }
+    }
+    return m_isTransferOnLoop;
+}
+
+size_t LibCurlHttpContentFetcher::writeBodyOnLoop(char* data, size_t size) {
+    if (!m_streamWriter) {
+        return size;
+    }
+    // This is set before writing, so that space which a reader frees during the write is not missed.
+    m_isWaitingForSpace = true;
+    if (!m_pendingBody.empty()) {
+        switch (flushPendingBody()) {
+            case WriteResult::WRITTEN:
+                break;
+            case WriteResult::FULL:
+                waitForSpace();
+                return CURL_WRITEFUNC_PAUSE;
+            case WriteResult::FAILED:
+                return 0;
+        }
+    }
+    size_t bytesWritten = 0;
+    switch (writeWithoutBlocking(data, size, &bytesWritten)) {
+        case WriteResult::WRITTEN:
+            m_isWaitingForSpace = false;
+            return size;
+        case WriteResult::FULL:
+            if (0 == bytesWritten) {
+                waitForSpace();
+                return CURL_WRITEFUNC_PAUSE;
+            }
+            // A paused transfer delivers all of its data again, so the rest of a partial write is kept here instead.
+            m_pendingBody.assign(data + bytesWritten, data + size);
+            waitForSpace();
+            return size;
+        case WriteResult::FAILED:
+            return 0;
+    }
+    return 0;
+}
+
+LibCurlHttpContentFetcher::WriteResult LibCurlHttpContentFetcher::writeWithoutBlocking(
+    const char* data,
+    size_t size,
+    size_t* bytesWritten) {
+    *bytesWritten = 0;
+    while (*bytesWritten < size) {
+        auto writeStatus = avsCommon::avs::attachment::AttachmentWriter::WriteStatus::OK;
+        auto numBytesWritten =
+            m_streamWriter->write(data + *bytesWritten, size - *bytesWritten, &writeStatus, TIMEOUT_FOR_LOOP_WRITE);
+        *bytesWritten += numBytesWritten;
+        switch (writeStatus) {
+            case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::OK:
+                if (numBytesWritten > 0) {
+                    continue;
+                }
+                return WriteResult::FULL;
+            case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::TIMEDOUT:
+            case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::OK_BUFFER_FULL:
+                return WriteResult::FULL;
+            case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::CLOSED:
+            case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::ERROR_BYTES_LESS_THAN_WORD_SIZE:
+            case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::ERROR_INTERNAL:
+                return WriteResult::FAILED;
+        }
+        ACSDK_ERROR(LX(__func__).m("unexpected writeStatus"));
+        return WriteResult::FAILED;
+    }
+    return WriteResult::WRITTEN;
+}
+
+LibCurlHttpContentFetcher::WriteResult LibCurlHttpContentFetcher::flushPendingBody() {
+    size_t bytesWritten = 0;
+    auto result = writeWithoutBlocking(m_pendingBody.data(), m_pendingBody.size(), &bytesWritten);
+    m_pendingBody.erase(m_pendingBody.begin(), m_pendingBody.begin() + bytesWritten);
+    return result;
+}
+
+void LibCurlHttpContentFetcher::waitForSpace() {
+    /*
+     * The writer's callback resumes the transfer as soon as a reader frees space.  Checking again after the timeout of
+     * a blocking write also covers writers without the callback, and writers which their owner closes meanwhile.
+     */
+    m_loop->post(m_curlWrapper.getCurlHandle(), [this]() { onSpaceAvailable(); }, TIMEOUT_FOR_BLOCKING_WRITE);
+}
+
+void LibCurlHttpContentFetcher::onSpaceAvailable() {
+    if (m_done) {
+        return;
+    }
+    if (!m_isTransferDone) {
+        // This calls the body callback again with the data the transfer was paused on.
+        curl_easy_pause(m_curlWrapper.getCurlHandle(), CURLPAUSE_CONT);
+        return;
+    }
+    m_isWaitingForSpace = true;
+    switch (flushPendingBody()) {
+        case WriteResult::WRITTEN:
+        case WriteResult::FAILED:
+            finishBody();
+            return;
+        case WriteResult::FULL:
+            waitForSpace();
+            return;
+    }
+}
+
+void LibCurlHttpContentFetcher::onTransferDone(FetchOptions fetchOption, CURLcode result) {
+    auto handle = m_curlWrapper.getCurlHandle();
+    if (FetchOptions::CONTENT_TYPE == fetchOption) {
+        // The no-op body callback ends the transfer with a write error once the headers are in.
+        if (result != CURLE_OK && result != CURLE_WRITE_ERROR) {
+            ACSDK_ERROR(LX("curlTransferFailed").d("error", curl_easy_strerror(result)));
+        }
+        long finalResponseCode = 0;
+        char* contentType = nullptr;
+        if (curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &finalResponseCode) != CURLE_OK) {
+            ACSDK_ERROR(LX("curlEasyGetInfoFailed").d("info", "CURLINFO_RESPONSE_CODE"));
+        }
+        if (curl_easy_getinfo(handle, CURLINFO_CONTENT_TYPE, &contentType) != CURLE_OK || !contentType) {
+            ACSDK_ERROR(LX("getContent").d("contentType", "failedToGetContentType").sensitive("url", m_url));
+        }
+        ACSDK_DEBUG9(LX("getContent").d("responseCode", finalResponseCode).sensitive("url", m_url));
+        m_lastStatusCode = finalResponseCode;
+        m_lastContentType = contentType ? contentType : "";
+        resolvePromises();
+        finishBody();
+        return;
+    }
+    if (result != CURLE_OK) {
+        if (m_done) {
+            ACSDK_DEBUG9(LX("curlTransferStopped").d("reason", "fetcherDestroyed"));
+        } else {
+            ACSDK_ERROR(LX("curlTransferFailed").d("error", curl_easy_strerror(result)));
+        }
+    }
+    resolvePromises();
+    m_isTransferDone = true;
+    if (CURLE_OK == result && !m_pendingBody.empty()) {
+        onSpaceAvailable();
+        return;
+    }
+    finishBody();
+}
+
+void LibCurlHttpContentFetcher::resolvePromises() {
+    if (m_arePromisesResolved) {
+        return;
+    }
+    m_arePromisesResolved = true;
+    m_statusCodePromise.set_value(m_lastStatusCode);
+    m_contentTypePromise.set_value(m_lastContentType);
+}
+
+void LibCurlHttpContentFetcher::finishBody() {
+    std::lock_guard<std::mutex> lock(m_bodyFinishedMutex);
+    if (m_done) {
+        return;
+    }
+    m_isTransferDone = true;
+    m_pendingBody.clear();
+    m_isWaitingForSpace = false;
+    /*
+     * If the writer was created locally, its job is done and can be safely closed.  Otherwise its owner must close it
+     * when necessary, as for a transfer on a thread of its own.
+     */
+    if (m_writerWasCreatedLocally && m_streamWriter) {
+        m_streamWriter->close();
+    }
+    m_done = true;
+    m_bodyFinished.notify_all();
+}
+
 LibCurlHttpContentFetcher::~LibCurlHttpContentFetcher() {
+    if (m_isTransferOnLoop) {
+        if (!m_stopOnDestruction) {
+            // As on a thread of its own, the transfer runs to the end of the body unless its writer is closed.
+            std::unique_lock<std::mutex> lock(m_bodyFinishedMutex);
+            m_bodyFinished.wait(lock, [this]() { return m_done.load(); });
+        }
+        if (m_hasSpaceAvailableCallback) {
+            m_streamWriter->setSpaceAvailableCallback(nullptr);
+        }
+        m_loop->removeTransfer(m_curlWrapper.getCurlHandle());
+        resolvePromises();
+        finishBody();
+        return;
+    }
+    if (m_stopOnDestruction) {
+        m_done = true;
+    }
     if (m_thread.joinable()) {
         m_thread.join();
     }
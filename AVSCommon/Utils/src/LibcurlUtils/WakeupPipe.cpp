@@ -0,0 +1,124 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <AVSCommon/Utils/LibcurlUtils/WakeupPipe.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("WakeupPipe");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The size of the buffer used to drain the pipe.
+static const size_t DRAIN_BUFFER_SIZE = 16;
+
+/**
+ * Make a file descriptor non-blocking and close-on-exec.
+ *
+ * @param fd The file descriptor to configure.
+ * @return Whether the file descriptor was configured.
+ */
+static bool configureFd(int fd) {
+    int flags = fcntl(fd, F_GETFL);
+    if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+        return false;
+    }
+    flags = fcntl(fd, F_GETFD);
+    return flags >= 0 && fcntl(fd, F_SETFD, flags | FD_CLOEXEC) >= 0;
+}
+
+std::shared_ptr<WakeupPipe> WakeupPipe::create() {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "pipeFailed").d("error", strerror(errno)));
+        return nullptr;
+    }
+    if (!configureFd(fds[0]) || !configureFd(fds[1])) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "fcntlFailed").d("error", strerror(errno)));
+        close(fds[0]);
+        close(fds[1]);
+        return nullptr;
+    }
+    return std::shared_ptr<WakeupPipe>(new WakeupPipe(fds[0], fds[1]));
+}
+
+WakeupPipe::WakeupPipe(int readFd, int writeFd) : m_readFd{readFd}, m_writeFd{writeFd}, m_isWakePending{false} {
+}
+
+WakeupPipe::~WakeupPipe() {
+    close(m_readFd);
+    close(m_writeFd);
+}
+
+void WakeupPipe::wake() {
+    if (m_isWakePending.exchange(true)) {
+        return;
+    }
+    const char byte = 0;
+    ssize_t result;
+    do {
+        result = write(m_writeFd, &byte, sizeof(byte));
+    } while (result < 0 && EINTR == errno);
+    // EAGAIN means the pipe is full, so the loop will wake anyway.
+    if (result < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+        ACSDK_ERROR(LX("wakeFailed").d("reason", "writeFailed").d("error", strerror(errno)));
+    }
+}
+
+int WakeupPipe::getReadFd() const {
+    return m_readFd;
+}
+
+bool WakeupPipe::consume() {
+    // Drain before clearing the flag.  A wake() which races with this call then either finds the flag still set (and
+    // is consumed here) or writes a fresh byte after it was cleared (and wakes the next wait).
+    char buffer[DRAIN_BUFFER_SIZE];
+    while (read(m_readFd, buffer, sizeof(buffer)) > 0) {
+    }
+    return m_isWakePending.exchange(false);
+}
+
+bool WakeupPipe::waitForWake(std::chrono::milliseconds timeout) {
+    if (m_isWakePending) {
+        return true;
+    }
+    struct pollfd pollFd;
+    pollFd.fd = m_readFd;
+    pollFd.events = POLLIN;
+    pollFd.revents = 0;
+    return poll(&pollFd, 1, static_cast<int>(timeout.count())) > 0;
+}
+
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
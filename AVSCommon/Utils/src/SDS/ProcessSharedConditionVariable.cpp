@@ -0,0 +1,108 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/SDS/ProcessSharedConditionVariable.h"
+
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <system_error>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("ProcessSharedConditionVariable");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The number of nanoseconds in a second.
+static const long NANOSECONDS_PER_SECOND = 1000000000L;
+
+ProcessSharedConditionVariable::ProcessSharedConditionVariable() {
+    pthread_condattr_t attributes;
+    pthread_condattr_init(&attributes);
+    pthread_condattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+    pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+    int result = pthread_cond_init(&m_conditionVariable, &attributes);
+    pthread_condattr_destroy(&attributes);
+    if (result != 0) {
+        ACSDK_ERROR(LX("constructorFailed").d("reason", "pthreadCondInitFailed").d("error", strerror(result)));
+    }
+}
+
+ProcessSharedConditionVariable::~ProcessSharedConditionVariable() {
+    pthread_cond_destroy(&m_conditionVariable);
+}
+
+void ProcessSharedConditionVariable::notify_one() {
+    pthread_cond_signal(&m_conditionVariable);
+}
+
+void ProcessSharedConditionVariable::notify_all() {
+    pthread_cond_broadcast(&m_conditionVariable);
+}
+
+void ProcessSharedConditionVariable::wait(std::unique_lock<ProcessSharedMutex>& lock) {
+    auto mutex = lock.mutex();
+    int result = pthread_cond_wait(&m_conditionVariable, mutex->native_handle());
+    if (!mutex->onAcquire(result)) {
+        throw std::system_error(result, std::system_category());
+    }
+}
+
+bool ProcessSharedConditionVariable::waitUntil(
+    std::unique_lock<ProcessSharedMutex>& lock,
+    std::chrono::steady_clock::time_point deadline) {
+    auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - std::chrono::steady_clock::now());
+    if (remaining <= std::chrono::nanoseconds::zero()) {
+        return false;
+    }
+
+    // The condition variable waits against CLOCK_MONOTONIC, so convert the deadline to that clock.
+    timespec absolute;
+    clock_gettime(CLOCK_MONOTONIC, &absolute);
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(remaining);
+    absolute.tv_sec += static_cast<time_t>(seconds.count());
+    absolute.tv_nsec += static_cast<long>((remaining - seconds).count());
+    if (absolute.tv_nsec >= NANOSECONDS_PER_SECOND) {
+        absolute.tv_sec += 1;
+        absolute.tv_nsec -= NANOSECONDS_PER_SECOND;
+    }
+
+    auto mutex = lock.mutex();
+    int result = pthread_cond_timedwait(&m_conditionVariable, mutex->native_handle(), &absolute);
+    if (ETIMEDOUT == result) {
+        return false;
+    }
+    if (!mutex->onAcquire(result)) {
+        throw std::system_error(result, std::system_category());
+    }
+    return true;
+}
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
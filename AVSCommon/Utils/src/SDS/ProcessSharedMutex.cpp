@@ -0,0 +1,98 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/SDS/ProcessSharedMutex.h"
+
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("ProcessSharedMutex");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+ProcessSharedMutex::ProcessSharedMutex() {
+    pthread_mutexattr_t attributes;
+    pthread_mutexattr_init(&attributes);
+    pthread_mutexattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&attributes, PTHREAD_MUTEX_ROBUST);
+    int result = pthread_mutex_init(&m_mutex, &attributes);
+    pthread_mutexattr_destroy(&attributes);
+    if (result != 0) {
+        ACSDK_ERROR(LX("constructorFailed").d("reason", "pthreadMutexInitFailed").d("error", strerror(result)));
+    }
+}
+
+ProcessSharedMutex::~ProcessSharedMutex() {
+    pthread_mutex_destroy(&m_mutex);
+}
+
+void ProcessSharedMutex::lock() {
+    int result = pthread_mutex_lock(&m_mutex);
+    if (!onAcquire(result)) {
+        throw std::system_error(result, std::system_category());
+    }
+}
+
+bool ProcessSharedMutex::try_lock() {
+    return onAcquire(pthread_mutex_trylock(&m_mutex));
+}
+
+void ProcessSharedMutex::unlock() {
+    int result = pthread_mutex_unlock(&m_mutex);
+    if (result != 0) {
+        ACSDK_ERROR(LX("unlockFailed").d("error", strerror(result)));
+    }
+}
+
+pthread_mutex_t* ProcessSharedMutex::native_handle() {
+    return &m_mutex;
+}
+
+bool ProcessSharedMutex::onAcquire(int result) {
+    switch (result) {
+        case 0:
+            return true;
+        case EOWNERDEAD:
+            // The state this mutex protects in a SharedDataStream is either atomic or re-derived by its users, so it
+            // is safe to carry on.
+            ACSDK_WARN(LX("recoveredMutex").d("reason", "ownerDied"));
+            pthread_mutex_consistent(&m_mutex);
+            return true;
+        case EBUSY:
+            return false;
+        default:
+            ACSDK_ERROR(LX("lockFailed").d("error", strerror(result)));
+            return false;
+    }
+}
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,189 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/SDS/SharedMemoryBuffer.h"
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("SharedMemoryBuffer");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The permissions of new shared memory objects: read and write for the owning user only.
+static const mode_t SHARED_MEMORY_MODE = S_IRUSR | S_IWUSR;
+
+/**
+ * Check that a name is a portable POSIX shared memory object name.
+ *
+ * @param name The name to check.
+ * @return Whether @c name begins with '/' and contains no other '/'.
+ */
+static bool isValidName(const std::string& name) {
+    return name.size() > 1 && '/' == name[0] && std::string::npos == name.find('/', 1);
+}
+
+/**
+ * Map a shared memory object, then close its file descriptor.
+ *
+ * @param fd The file descriptor of the object.
+ * @param size The number of bytes to map.
+ * @return The start of the mapping, or @c nullptr on failure.
+ */
+static uint8_t* mapAndClose(int fd, size_t size) {
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    int error = errno;
+    close(fd);
+    if (MAP_FAILED == data) {
+        ACSDK_ERROR(LX("mapFailed").d("reason", "mmapFailed").d("error", strerror(error)));
+        return nullptr;
+    }
+    return static_cast<uint8_t*>(data);
+}
+
+/**
+ * Map anonymous shared memory.
+ *
+ * @param size The number of bytes to map.
+ * @return The start of the mapping, or @c nullptr on failure.
+ */
+static uint8_t* mapAnonymous(size_t size) {
+    if (0 == size) {
+        ACSDK_ERROR(LX("mapAnonymousFailed").d("reason", "zeroSize"));
+        return nullptr;
+    }
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (MAP_FAILED == data) {
+        ACSDK_ERROR(LX("mapAnonymousFailed").d("reason", "mmapFailed").d("error", strerror(errno)));
+        return nullptr;
+    }
+    return static_cast<uint8_t*>(data);
+}
+
+SharedMemoryBuffer::SharedMemoryBuffer(size_t size) :
+        m_data{mapAnonymous(size)},
+        m_size{m_data ? size : 0},
+        m_isOwner{false} {
+}
+
+std::shared_ptr<SharedMemoryBuffer> SharedMemoryBuffer::create(const std::string& name, size_t size) {
+    if (!isValidName(name)) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "invalidName").d("name", name));
+        return nullptr;
+    }
+    if (0 == size) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "zeroSize"));
+        return nullptr;
+    }
+
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, SHARED_MEMORY_MODE);
+    if (-1 == fd) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "shmOpenFailed").d("name", name).d("error", strerror(errno)));
+        return nullptr;
+    }
+    if (-1 == ftruncate(fd, static_cast<off_t>(size))) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "ftruncateFailed").d("size", size).d("error", strerror(errno)));
+        close(fd);
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+    auto data = mapAndClose(fd, size);
+    if (!data) {
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+    return std::shared_ptr<SharedMemoryBuffer>(new SharedMemoryBuffer(name, data, size, true));
+}
+
+std::shared_ptr<SharedMemoryBuffer> SharedMemoryBuffer::open(const std::string& name) {
+    if (!isValidName(name)) {
+        ACSDK_ERROR(LX("openFailed").d("reason", "invalidName").d("name", name));
+        return nullptr;
+    }
+
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (-1 == fd) {
+        ACSDK_ERROR(LX("openFailed").d("reason", "shmOpenFailed").d("name", name).d("error", strerror(errno)));
+        return nullptr;
+    }
+    struct stat status;
+    if (-1 == fstat(fd, &status)) {
+        ACSDK_ERROR(LX("openFailed").d("reason", "fstatFailed").d("error", strerror(errno)));
+        close(fd);
+        return nullptr;
+    }
+    if (status.st_size <= 0) {
+        ACSDK_ERROR(LX("openFailed").d("reason", "emptyObject").d("name", name));
+        close(fd);
+        return nullptr;
+    }
+    auto size = static_cast<size_t>(status.st_size);
+    auto data = mapAndClose(fd, size);
+    if (!data) {
+        return nullptr;
+    }
+    return std::shared_ptr<SharedMemoryBuffer>(new SharedMemoryBuffer(name, data, size, false));
+}
+
+SharedMemoryBuffer::~SharedMemoryBuffer() {
+    if (m_data && -1 == munmap(m_data, m_size)) {
+        ACSDK_ERROR(LX("destructorFailed").d("reason", "munmapFailed").d("error", strerror(errno)));
+    }
+    if (m_isOwner && -1 == shm_unlink(m_name.c_str())) {
+        ACSDK_ERROR(LX("destructorFailed").d("reason", "shmUnlinkFailed").d("error", strerror(errno)));
+    }
+}
+
+uint8_t* SharedMemoryBuffer::data() {
+    return m_data;
+}
+
+size_t SharedMemoryBuffer::size() const {
+    return m_size;
+}
+
+const std::string& SharedMemoryBuffer::getName() const {
+    return m_name;
+}
+
+SharedMemoryBuffer::SharedMemoryBuffer(const std::string& name, uint8_t* data, size_t size, bool isOwner) :
+        m_name{name},
+        m_data{data},
+        m_size{size},
+        m_isOwner{isOwner} {
+}
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
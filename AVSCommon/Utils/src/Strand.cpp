@@ -0,0 +1,88 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Threading/Strand.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/// The number of tasks a Strand executes before giving other users of the pool a turn.
+static const size_t MAX_TASKS_PER_TURN = 16;
+
+std::shared_ptr<Strand> Strand::create(std::shared_ptr<TaskQueue> taskQueue, std::shared_ptr<ThreadPool> threadPool) {
+    if (!taskQueue || !threadPool) {
+        return nullptr;
+    }
+    return std::shared_ptr<Strand>(new Strand(taskQueue, threadPool));
+}
+
+Strand::Strand(std::shared_ptr<TaskQueue> taskQueue, std::shared_ptr<ThreadPool> threadPool) :
+        m_taskQueue{taskQueue},
+        m_threadPool{threadPool},
+        m_scheduled{false} {
+}
+
+void Strand::notifyTaskQueued() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_scheduled) {
+        m_scheduled = submitLocked();
+    }
+}
+
+void Strand::waitForRunningTask() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idleTrigger.wait(lock, [this] {
+        return std::thread::id() == m_runningThread || std::this_thread::get_id() == m_runningThread;
+    });
+}
+
+void Strand::runTasks() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_runningThread = std::this_thread::get_id();
+    }
+
+    auto taskQueue = m_taskQueue.lock();
+    for (size_t count = 0; taskQueue && count < MAX_TASKS_PER_TURN; ++count) {
+        TaskFunction task;
+        if (!taskQueue->tryPop(&task)) {
+            break;
+        }
+        task();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_runningThread = std::thread::id();
+    // Tasks pushed after the queue was found empty have called (or are blocked in) notifyTaskQueued(), which relies on
+    // this decision being made under m_mutex.
+    if (taskQueue && !taskQueue->isShutdown() && !taskQueue->isEmpty()) {
+        m_scheduled = submitLocked();
+    } else {
+        m_scheduled = false;
+    }
+    m_idleTrigger.notify_all();
+}
+
+bool Strand::submitLocked() {
+    auto self = shared_from_this();
+    return m_threadPool->submit([self] { self->runTasks(); });
+}
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
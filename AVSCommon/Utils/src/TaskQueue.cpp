@@ -20,39 +20,143 @@ namespace avsCommon {
 namespace utils {
 namespace threading {
 
-TaskQueue::TaskQueue() : m_shutdown{false} {
+/// The largest number of unused nodes a queue keeps for reuse.
+static const size_t MAX_FREE_NODES = 64;
+
+TaskQueue::TaskQueue() :
+        m_head{nullptr},
+        m_tail{nullptr},
+        m_freeNodes{nullptr},
+        m_freeNodeCount{0},
+        m_shutdown{false} {
+}
+
+TaskQueue::~TaskQueue() {
+    shutdown();
+    while (m_freeNodes) {
+        auto node = m_freeNodes;
+        m_freeNodes = node->next;
+        delete node;
+    }
+}
+
+bool TaskQueue::execute(TaskFunction task) {
+    return enqueue(false, std::move(task));
 }
 
 std::unique_ptr<std::function<void()>> TaskQueue::pop() {
+    TaskFunction task;
+    if (!pop(&task)) {
+        return nullptr;
+    }
+    auto sharedTask = std::make_shared<TaskFunction>(std::move(task));
+    return std::unique_ptr<std::function<void()>>(new std::function<void()>([sharedTask]() { (*sharedTask)(); }));
+}
+
+bool TaskQueue::pop(TaskFunction* task) {
     std::unique_lock<std::mutex> queueLock{m_queueMutex};
 
-    auto shouldNotWait = [this]() { return m_shutdown || !m_queue.empty(); };
+    auto shouldNotWait = [this]() { return m_shutdown || m_head; };
 
     if (!shouldNotWait()) {
         m_queueChanged.wait(queueLock, shouldNotWait);
     }
 
-    if (!m_queue.empty()) {
-        auto task = std::move(m_queue.front());
+    if (!m_head) {
+        return false;
+    }
+    dequeueLocked(task);
+    return true;
+}
 
-        m_queue.pop_front();
-        return task;
+bool TaskQueue::tryPop(TaskFunction* task) {
+    std::lock_guard<std::mutex> queueLock{m_queueMutex};
+    if (!m_head) {
+        return false;
     }
+    dequeueLocked(task);
+    return true;
+}
 
-    return nullptr;
+bool TaskQueue::enqueue(bool front, TaskFunction&& task) {
+    {
+        std::lock_guard<std::mutex> queueLock{m_queueMutex};
+        if (m_shutdown) {
+            return false;
+        }
+        Node* node = m_freeNodes;
+        if (node) {
+            m_freeNodes = node->next;
+            --m_freeNodeCount;
+        } else {
+            node = new Node;
+        }
+        node->task = std::move(task);
+        if (front) {
+            node->next = m_head;
+            m_head = node;
+            if (!m_tail) {
+                m_tail = node;
+            }
+        } else {
+            node->next = nullptr;
+            if (m_tail) {
+                m_tail->next = node;
+            } else {
+                m_head = node;
+            }
+            m_tail = node;
+        }
+    }
+
+    // Tasks are consumed by a single TaskThread or Strand, so there is never more than one waiter to wake.
+    m_queueChanged.notify_one();
+    return true;
+}
+
+void TaskQueue::dequeueLocked(TaskFunction* task) {
+    auto node = m_head;
+    m_head = node->next;
+    if (!m_head) {
+        m_tail = nullptr;
+    }
+    *task = std::move(node->task);
+    if (m_freeNodeCount < MAX_FREE_NODES) {
+        node->next = m_freeNodes;
+        m_freeNodes = node;
+        ++m_freeNodeCount;
+    } else {
+        delete node;
+    }
 }
 
 void TaskQueue::shutdown() {
-    std::lock_guard<std::mutex> queueLock{m_queueMutex};
-    m_queue.clear();
-    m_shutdown = true;
-    m_queueChanged.notify_all();
+    Node* discarded = nullptr;
+    {
+        std::lock_guard<std::mutex> queueLock{m_queueMutex};
+        discarded = m_head;
+        m_head = nullptr;
+        m_tail = nullptr;
+        m_shutdown = true;
+        m_queueChanged.notify_all();
+    }
+    // Destroy the discarded tasks without holding the lock, as releasing what they captured may call back into here.
+    while (discarded) {
+        auto node = discarded;
+        discarded = node->next;
+        delete node;
+    }
 }
 
 bool TaskQueue::isShutdown() {
     return m_shutdown;
 }
 
+bool TaskQueue::isEmpty() {
+    std::lock_guard<std::mutex> queueLock{m_queueMutex};
+    return !m_head;
+}
+
 }  // namespace threading
 }  // namespace utils
 }  // namespace avsCommon
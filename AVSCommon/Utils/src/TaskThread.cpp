@@ -44,10 +44,10 @@ void TaskThread::processTasksLoop() {
         auto m_actualTaskQueue = m_taskQueue.lock();
 
         if (m_actualTaskQueue && !m_actualTaskQueue->isShutdown()) {
-            auto task = m_actualTaskQueue->pop();
+            TaskFunction task;
 
-            if (task) {
-                task->operator()();
+            if (m_actualTaskQueue->pop(&task)) {
+                task();
             }
         } else {
             // Since we could not get a shared pointer to the the TaskQueue, it must have been destroyed.
@@ -0,0 +1,189 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Threading/ThreadPool.h"
+
+#include <algorithm>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/*
+ * Executor tasks in the SDK sometimes block waiting for work on another Executor, so the limit leaves plenty of room
+ * above the handful of threads which are busy at the same time in practice.
+ */
+const size_t ThreadPool::DEFAULT_MAX_THREADS = 32;
+
+const std::chrono::milliseconds ThreadPool::DEFAULT_IDLE_TIMEOUT = std::chrono::seconds(5);
+
+/*
+ * Long enough that a burst of short jobs is served by the workers which already exist, and short enough that jobs
+ * queued behind blocked workers (a download, a playlist fetch, a wait for focus) are not held up noticeably.
+ */
+const std::chrono::milliseconds ThreadPool::DEFAULT_STALL_TIMEOUT = std::chrono::milliseconds(250);
+
+std::shared_ptr<ThreadPool> ThreadPool::getDefaultThreadPool() {
+    /*
+     * Never destroyed: the last Executor to release the pool during exit may be released by one of the pool's own
+     * jobs, and a pool can not join its own worker.
+     */
+    static auto defaultThreadPool = new std::shared_ptr<ThreadPool>(std::make_shared<ThreadPool>());
+    return *defaultThreadPool;
+}
+
+ThreadPool::ThreadPool(
+    size_t maxThreads,
+    std::chrono::milliseconds idleTimeout,
+    std::chrono::milliseconds stallTimeout) :
+        m_maxThreads{maxThreads > 0 ? maxThreads : 1},
+        m_idleTimeout{idleTimeout},
+        m_stallTimeout{stallTimeout},
+        m_idleWorkers{0},
+        m_shutdown{false},
+        m_isMonitoringStalls{false} {
+}
+
+ThreadPool::~ThreadPool() {
+    std::deque<Job> discardedJobs;
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+        discardedJobs.swap(m_jobs);
+        for (auto& worker : m_workers) {
+            workers.push_back(std::move(worker.second));
+        }
+        m_workers.clear();
+        if (m_stallMonitor.joinable()) {
+            workers.push_back(std::move(m_stallMonitor));
+        }
+    }
+    m_wakeTrigger.notify_all();
+    m_stallMonitorTrigger.notify_all();
+    discardedJobs.clear();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    joinRetiredWorkers();
+}
+
+bool ThreadPool::submit(std::function<void()> job) {
+    if (!job) {
+        return false;
+    }
+    joinRetiredWorkers();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_shutdown) {
+        return false;
+    }
+    m_jobs.push_back({std::move(job), std::chrono::steady_clock::now()});
+    if (m_jobs.size() > m_idleWorkers && m_workers.size() < m_maxThreads) {
+        startWorker();
+        return true;
+    }
+    m_wakeTrigger.notify_one();
+    if (m_jobs.size() > m_idleWorkers && !m_isMonitoringStalls) {
+        // Every worker is busy, so watch for them all being blocked.
+        if (m_stallMonitor.joinable()) {
+            m_retiredWorkers.push_back(std::move(m_stallMonitor));
+        }
+        m_stallMonitor = std::thread(&ThreadPool::stallMonitorLoop, this);
+        m_isMonitoringStalls = true;
+    }
+    return true;
+}
+
+void ThreadPool::startWorker() {
+    std::thread worker(&ThreadPool::workerLoop, this);
+    auto id = worker.get_id();
+    m_workers.emplace(id, std::move(worker));
+}
+
+size_t ThreadPool::getThreadCount() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_workers.size();
+}
+
+void ThreadPool::workerLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        if (!m_jobs.empty()) {
+            auto job = std::move(m_jobs.front().function);
+            m_jobs.pop_front();
+            m_lastJobStarted = std::chrono::steady_clock::now();
+            lock.unlock();
+            job();
+            // Release anything the job captured before taking the lock again.
+            job = nullptr;
+            lock.lock();
+            continue;
+        }
+        if (m_shutdown) {
+            return;
+        }
+        ++m_idleWorkers;
+        bool woken = m_wakeTrigger.wait_for(lock, m_idleTimeout, [this] { return m_shutdown || !m_jobs.empty(); });
+        --m_idleWorkers;
+        if (!woken) {
+            break;
+        }
+    }
+
+    // Nothing to do for a while, so hand this thread over to be joined and exit.
+    auto worker = m_workers.find(std::this_thread::get_id());
+    if (worker != m_workers.end()) {
+        m_retiredWorkers.push_back(std::move(worker->second));
+        m_workers.erase(worker);
+    }
+}
+
+void ThreadPool::stallMonitorLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_shutdown && !m_jobs.empty()) {
+        // The workers are stalled if the oldest job has waited, and no job has started, for the whole stall timeout.
+        auto deadline = std::max(m_jobs.front().submitted, m_lastJobStarted) + m_stallTimeout;
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+            if (m_jobs.size() > m_idleWorkers) {
+                startWorker();
+            }
+            deadline = now + m_stallTimeout;
+        }
+        m_stallMonitorTrigger.wait_until(lock, deadline, [this] { return m_shutdown; });
+    }
+    m_isMonitoringStalls = false;
+}
+
+void ThreadPool::joinRetiredWorkers() {
+    std::vector<std::thread> retiredWorkers;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_retiredWorkers.empty()) {
+            return;
+        }
+        retiredWorkers.swap(m_retiredWorkers);
+    }
+    for (auto& worker : retiredWorkers) {
+        worker.join();
+    }
+}
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
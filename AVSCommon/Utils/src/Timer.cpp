@@ -13,7 +13,13 @@
  * permissions and limitations under the License.
  */
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include "AVSCommon/Utils/Timing/Timer.h"
+#include "AVSCommon/Utils/Timing/TimerScheduler.h"
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -22,33 +28,255 @@ namespace timing {
 
 const std::string Timer::TAG = "Timer";
 
-Timer::Timer() : m_running(false), m_stopping(false) {
+/**
+ * The schedule and task of a @c Timer.  Each deadline is a callback on the @c TimerScheduler which holds a weak
+ * pointer to this object, so a callback which fires after the @c Timer has been stopped or destroyed does nothing.
+ */
+class Timer::State : public std::enable_shared_from_this<Timer::State> {
+public:
+    /// Constructor.
+    State();
+
+    /// @see Timer::activate()
+    bool activate();
+
+    /// @see Timer::isActive()
+    bool isActive() const;
+
+    /// @see Timer::startTask()
+    void start(
+        std::chrono::nanoseconds delay,
+        std::chrono::nanoseconds period,
+        PeriodType periodType,
+        size_t maxCount,
+        std::function<void()> task);
+
+    /// @see Timer::stop()
+    void stop();
+
+private:
+    /**
+     * Schedules the next call to @c onDeadline().  @c m_mutex must be locked when calling this function.
+     *
+     * @param deadline When to call @c onDeadline().
+     */
+    void scheduleLocked(std::chrono::steady_clock::time_point deadline);
+
+    /**
+     * Makes the next @c m_task call, and schedules the one after it.  This is the body of one iteration of the loop
+     * which each @c Timer used to run on its own thread.
+     *
+     * @param generation The value of @c m_generation when the call was scheduled.
+     */
+    void onDeadline(uint64_t generation);
+
+    /**
+     * Deactivates the @c Timer.  @c m_mutex must be locked when calling this function.
+     *
+     * @return The task, which the caller should release after unlocking @c m_mutex.
+     */
+    std::function<void()> finishLocked();
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// Notified when a @c m_task call returns.
+    std::condition_variable m_taskDone;
+
+    /// Flag which indicates that the @c Timer is active.
+    std::atomic<bool> m_running;
+
+    /// Flag which requests that the active @c Timer be stopped once the @c m_task call in progress returns.
+    bool m_stopping;
+
+    /// Incremented by each @c start() and @c stop(), so that callbacks scheduled before them are ignored.
+    uint64_t m_generation;
+
+    /// The scheduler, obtained when the @c Timer is first started.
+    std::shared_ptr<TimerScheduler> m_scheduler;
+
+    /// The id of the scheduled @c onDeadline() callback.
+    TimerScheduler::TimerId m_timerId;
+
+    /// The thread making a @c m_task call, or a default-constructed id if there is no call in progress.
+    std::thread::id m_taskThread;
+
+    /// The time to wait before the first @c m_task call.
+    std::chrono::nanoseconds m_delay;
+
+    /// The time to wait between @c m_task calls.
+    std::chrono::nanoseconds m_period;
+
+    /// The type of @c m_period.
+    PeriodType m_periodType;
+
+    /// The desired number of @c m_task calls.
+    size_t m_maxCount;
+
+    /// The task.
+    std::function<void()> m_task;
+
+    /// The number of deadlines which have passed.
+    size_t m_count;
+
+    /// The time to measure the next deadline from.
+    std::chrono::steady_clock::time_point m_reference;
+
+    /// Whether a slow @c m_task call put the @c Timer off schedule, so that the next call should be skipped.
+    bool m_offSchedule;
+};
+
+Timer::State::State() :
+        m_running{false},
+        m_stopping{false},
+        m_generation{0},
+        m_timerId{0},
+        m_periodType{PeriodType::ABSOLUTE},
+        m_maxCount{0},
+        m_count{0},
+        m_offSchedule{false} {
 }
 
-Timer::~Timer() {
-    stop();
+bool Timer::State::activate() {
+    return !m_running.exchange(true);
 }
 
-void Timer::stop() {
-    {
-        std::lock_guard<std::mutex> lock(m_waitMutex);
-        if (m_running) {
-            m_stopping = true;
+bool Timer::State::isActive() const {
+    return m_running;
+}
+
+void Timer::State::start(
+    std::chrono::nanoseconds delay,
+    std::chrono::nanoseconds period,
+    PeriodType periodType,
+    size_t maxCount,
+    std::function<void()> task) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_scheduler) {
+        m_scheduler = TimerScheduler::getInstance();
+    }
+    ++m_generation;
+    m_stopping = false;
+    m_delay = delay;
+    m_period = period;
+    m_periodType = periodType;
+    m_maxCount = maxCount;
+    m_task = std::move(task);
+    m_count = 0;
+    m_reference = std::chrono::steady_clock::now();
+    m_offSchedule = false;
+    scheduleLocked(m_reference + m_delay);
+}
+
+void Timer::State::stop() {
+    std::function<void()> task;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (!m_running) {
+        return;
+    }
+    if (std::this_thread::get_id() == m_taskThread) {
+        // Called from inside the task; onDeadline() will finish up when it returns.
+        m_stopping = true;
+        return;
+    }
+    if (std::thread::id() != m_taskThread) {
+        // onDeadline() finishes up, under the lock, before this wait can return.
+        m_stopping = true;
+        m_taskDone.wait(lock, [this] { return std::thread::id() == m_taskThread; });
+        return;
+    }
+    if (m_scheduler) {
+        m_scheduler->cancel(m_timerId);
+    }
+    task = finishLocked();
+}
+
+void Timer::State::scheduleLocked(std::chrono::steady_clock::time_point deadline) {
+    std::weak_ptr<State> weakThis = shared_from_this();
+    auto generation = m_generation;
+    m_timerId = m_scheduler->schedule(deadline, [weakThis, generation] {
+        auto state = weakThis.lock();
+        if (state) {
+            state->onDeadline(generation);
         }
-        m_waitCondition.notify_all();
+    });
+}
+
+void Timer::State::onDeadline(uint64_t generation) {
+    std::function<void()> task;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (generation != m_generation || !m_running) {
+        return;
+    }
+
+    auto waitTime = (0 == m_count) ? m_delay : m_period;
+    bool callTask = true;
+    if (PeriodType::ABSOLUTE == m_periodType) {
+        // Update our estimate of where we should be after the delay, and run the task if we're still on schedule.
+        m_reference += waitTime;
+        callTask = !m_offSchedule;
+    }
+
+    if (callTask) {
+        m_taskThread = std::this_thread::get_id();
+        lock.unlock();
+        m_task();
+        lock.lock();
+        m_taskThread = std::thread::id();
+        m_taskDone.notify_all();
+    }
+
+    switch (m_periodType) {
+        case PeriodType::ABSOLUTE:
+            // If the task runtime put us off schedule, skip the next task run.
+            m_offSchedule = m_reference + m_period < std::chrono::steady_clock::now();
+            break;
+        case PeriodType::RELATIVE:
+            m_reference = std::chrono::steady_clock::now();
+            break;
     }
 
-    if (std::this_thread::get_id() != m_thread.get_id() && m_thread.joinable()) {
-        m_thread.join();
+    ++m_count;
+    if (m_stopping || (FOREVER != m_maxCount && m_count >= m_maxCount)) {
+        task = finishLocked();
+        return;
     }
+    scheduleLocked(m_reference + m_period);
+}
+
+std::function<void()> Timer::State::finishLocked() {
+    ++m_generation;
+    m_stopping = false;
+    m_running = false;
+    return std::move(m_task);
+}
+
+Timer::Timer() : m_state{std::make_shared<State>()} {
+}
+
+Timer::~Timer() {
+    stop();
+}
+
+void Timer::stop() {
+    m_state->stop();
 }
 
 bool Timer::isActive() const {
-    return m_running;
+    return m_state->isActive();
 }
 
 bool Timer::activate() {
-    return !m_running.exchange(true);
+    return m_state->activate();
+}
+
+void Timer::startTask(
+    std::chrono::nanoseconds delay,
+    std::chrono::nanoseconds period,
+    PeriodType periodType,
+    size_t maxCount,
+    std::function<void()> task) {
+    m_state->start(delay, period, periodType, maxCount, std::move(task));
 }
 
 }  // namespace timing
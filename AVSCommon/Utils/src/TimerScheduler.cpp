@@ -0,0 +1,100 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Timing/TimerScheduler.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+std::shared_ptr<TimerScheduler> TimerScheduler::getInstance() {
+    static std::shared_ptr<TimerScheduler> instance =
+        std::make_shared<TimerScheduler>(threading::ThreadPool::getDefaultThreadPool());
+    return instance;
+}
+
+TimerScheduler::TimerScheduler(std::shared_ptr<threading::ThreadPool> threadPool) :
+        m_threadPool{threadPool},
+        m_nextId{0},
+        m_shutdown{false} {
+    m_thread = std::thread{&TimerScheduler::schedulerLoop, this};
+}
+
+TimerScheduler::~TimerScheduler() {
+    decltype(m_callbacks) discardedCallbacks;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+        m_deadlines.clear();
+        discardedCallbacks.swap(m_callbacks);
+    }
+    m_wakeTrigger.notify_all();
+    m_thread.join();
+}
+
+TimerScheduler::TimerId TimerScheduler::schedule(
+    std::chrono::steady_clock::time_point deadline,
+    std::function<void()> callback) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto id = ++m_nextId;
+    auto entry = m_deadlines.emplace(deadline, id).first;
+    m_callbacks.emplace(id, std::make_pair(deadline, std::move(callback)));
+    if (m_deadlines.begin() == entry) {
+        m_wakeTrigger.notify_one();
+    }
+    return id;
+}
+
+void TimerScheduler::cancel(TimerId id) {
+    std::function<void()> discardedCallback;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto callback = m_callbacks.find(id);
+    if (callback == m_callbacks.end()) {
+        return;
+    }
+    m_deadlines.erase(std::make_pair(callback->second.first, id));
+    discardedCallback = std::move(callback->second.second);
+    m_callbacks.erase(callback);
+}
+
+void TimerScheduler::schedulerLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_shutdown) {
+        if (m_deadlines.empty()) {
+            m_wakeTrigger.wait(lock);
+            continue;
+        }
+        auto next = *m_deadlines.begin();
+        if (next.first > std::chrono::steady_clock::now()) {
+            // Woken early if an earlier deadline is scheduled, so look again either way.
+            m_wakeTrigger.wait_until(lock, next.first);
+            continue;
+        }
+        m_deadlines.erase(m_deadlines.begin());
+        auto entry = m_callbacks.find(next.second);
+        auto callback = std::move(entry->second.second);
+        m_callbacks.erase(entry);
+
+        lock.unlock();
+        m_threadPool->submit(std::move(callback));
+        lock.lock();
+    }
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
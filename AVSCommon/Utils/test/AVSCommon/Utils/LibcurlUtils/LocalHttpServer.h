@@ -0,0 +1,266 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_TEST_AVSCOMMON_UTILS_LIBCURLUTILS_LOCALHTTPSERVER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_TEST_AVSCOMMON_UTILS_LIBCURLUTILS_LOCALHTTPSERVER_H_
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+namespace test {
+
+/**
+ * A stand-in HTTP/1.1 server on the loopback interface, which keeps connections alive.
+ *
+ * Each new connection waits @c connectionSetupTime before its first response, which stands in for the TCP and TLS
+ * handshakes with a remote server, and every response waits @c roundTrip.  A test therefore sees the cost of a new
+ * connection without this server having to speak TLS.
+ */
+class LocalHttpServer {
+public:
+    /**
+     * Constructor, which starts the server.
+     *
+     * @param connectionSetupTime The extra wait before the first response on each connection.
+     * @param roundTrip The wait before each response.
+     */
+    LocalHttpServer(std::chrono::milliseconds connectionSetupTime, std::chrono::milliseconds roundTrip) :
+            m_connectionSetupTime{connectionSetupTime},
+            m_roundTrip{roundTrip},
+            m_socket{-1},
+            m_port{0},
+            m_isShuttingDown{false},
+            m_connectionCount{0},
+            m_requestCount{0} {
+        m_socket = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t addressLength = sizeof(address);
+        if (m_socket < 0 || bind(m_socket, reinterpret_cast<sockaddr*>(&address), addressLength) != 0 ||
+            listen(m_socket, SOMAXCONN) != 0 ||
+            getsockname(m_socket, reinterpret_cast<sockaddr*>(&address), &addressLength) != 0) {
+            return;
+        }
+        m_port = ntohs(address.sin_port);
+        m_acceptThread = std::thread(&LocalHttpServer::acceptLoop, this);
+    }
+
+    /**
+     * Destructor, which stops the server and drops its connections.
+     */
+    ~LocalHttpServer() {
+        m_isShuttingDown = true;
+        if (m_socket >= 0) {
+            shutdown(m_socket, SHUT_RDWR);
+        }
+        if (m_acceptThread.joinable()) {
+            m_acceptThread.join();
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto connection : m_connections) {
+                shutdown(connection, SHUT_RDWR);
+            }
+        }
+        for (auto& thread : m_connectionThreads) {
+            thread.join();
+        }
+        if (m_socket >= 0) {
+            close(m_socket);
+        }
+    }
+
+    /**
+     * Returns the URL of a path on this server.
+     *
+     * @param path The path, starting with '/'.
+     * @return The URL, or an empty string if the server did not start.
+     */
+    std::string getUrl(const std::string& path) const {
+        return m_port ? "http://127.0.0.1:" + std::to_string(m_port) + path : "";
+    }
+
+    /**
+     * Sets the response to a path.  This must be called before any request is made.
+     *
+     * @param path The path, starting with '/'.
+     * @param contentType The content type of the response, which is left out of the response if empty.
+     * @param body The body of the response.
+     * @param delay An extra wait before the response, like a slow server.
+     */
+    void setResponse(
+        const std::string& path,
+        const std::string& contentType,
+        const std::string& body,
+        std::chrono::milliseconds delay = std::chrono::milliseconds::zero()) {
+        std::string header = "HTTP/1.1 200 OK\r\n";
+        if (!contentType.empty()) {
+            header += "Content-Type: " + contentType + "\r\n";
+        }
+        m_responses[path] = {header + "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body, delay};
+    }
+
+    /**
+     * Returns the number of connections accepted.
+     *
+     * @return The number of connections.
+     */
+    int getConnectionCount() const {
+        return m_connectionCount;
+    }
+
+    /**
+     * Returns the number of requests answered.
+     *
+     * @return The number of requests.
+     */
+    int getRequestCount() const {
+        return m_requestCount;
+    }
+
+private:
+    /// A response to a path.
+    struct Response {
+        /// The full response.
+        std::string text;
+        /// The extra wait before the response.
+        std::chrono::milliseconds delay;
+    };
+
+    /// Accepts connections until the server stops.
+    void acceptLoop() {
+        while (!m_isShuttingDown) {
+            int connection = accept(m_socket, nullptr, nullptr);
+            if (connection < 0) {
+                continue;
+            }
+            ++m_connectionCount;
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_connections.push_back(connection);
+            m_connectionThreads.push_back(std::thread(&LocalHttpServer::serve, this, connection));
+        }
+    }
+
+    /**
+     * Answers the requests on one connection until the client closes it.
+     *
+     * @param connection The socket of the connection.
+     */
+    void serve(int connection) {
+        std::string received;
+        char buffer[1024];
+        bool isFirstRequest = true;
+        while (!m_isShuttingDown) {
+            auto requestEnd = received.find("\r\n\r\n");
+            if (requestEnd == std::string::npos) {
+                auto bytesRead = recv(connection, buffer, sizeof(buffer), 0);
+                if (bytesRead <= 0) {
+                    break;
+                }
+                received.append(buffer, bytesRead);
+                continue;
+            }
+            auto request = received.substr(0, requestEnd);
+            received.erase(0, requestEnd + 4);
+            ++m_requestCount;
+            // The request line is "GET <path> HTTP/1.1".
+            auto pathStart = request.find(' ') + 1;
+            auto path = request.substr(pathStart, request.find(' ', pathStart) - pathStart);
+            auto it = m_responses.find(path);
+            auto delay = it == m_responses.end() ? std::chrono::milliseconds::zero() : it->second.delay;
+            auto setupTime = isFirstRequest ? m_connectionSetupTime : std::chrono::milliseconds::zero();
+            std::this_thread::sleep_for(setupTime + m_roundTrip + delay);
+            isFirstRequest = false;
+
+            const std::string notFound = "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n";
+            const std::string& response = it == m_responses.end() ? notFound : it->second.text;
+            size_t sent = 0;
+            while (sent < response.size()) {
+                auto bytesSent = send(connection, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+                if (bytesSent <= 0) {
+                    break;
+                }
+                sent += bytesSent;
+            }
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_connections.begin(); it != m_connections.end(); ++it) {
+            if (*it == connection) {
+                m_connections.erase(it);
+                break;
+            }
+        }
+        close(connection);
+    }
+
+    /// The extra wait before the first response on each connection.
+    const std::chrono::milliseconds m_connectionSetupTime;
+
+    /// The wait before each response.
+    const std::chrono::milliseconds m_roundTrip;
+
+    /// The listening socket.
+    int m_socket;
+
+    /// The port the server listens on.
+    int m_port;
+
+    /// Whether the server is stopping.
+    std::atomic<bool> m_isShuttingDown;
+
+    /// The number of connections accepted.
+    std::atomic<int> m_connectionCount;
+
+    /// The number of requests answered.
+    std::atomic<int> m_requestCount;
+
+    /// The responses, by path.
+    std::map<std::string, Response> m_responses;
+
+    /// The thread which accepts connections.
+    std::thread m_acceptThread;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// The sockets of the open connections.
+    std::vector<int> m_connections;
+
+    /// The threads which answer requests.
+    std::vector<std::thread> m_connectionThreads;
+};
+
+}  // namespace test
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_TEST_AVSCOMMON_UTILS_LIBCURLUTILS_LOCALHTTPSERVER_H_
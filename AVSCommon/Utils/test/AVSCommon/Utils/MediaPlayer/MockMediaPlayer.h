@@ -61,6 +61,23 @@ public:
      * @return The SourceId used by MediaPlayerInterface to identify this @c setSource() request.
      */
     virtual SourceId urlSetSource(const std::string& url) = 0;
+    /**
+     * Variant of prepareNextSource() taking an attachment reader.
+     *
+     * @param attachmentReader The attachment from which to read audio data.
+     * @param audioFormat The audioFormat to be used when playing raw PCM data.
+     * @return The SourceId used by MediaPlayerInterface to identify this @c prepareNextSource() request.
+     */
+    virtual SourceId attachmentPrepareNextSource(
+        std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> attachmentReader,
+        const avsCommon::utils::AudioFormat* audioFormat) = 0;
+    /**
+     * Variant of prepareNextSource() taking a URL with which to fetch audio data.
+     *
+     * @param url The URL with which to fetch the audio data.
+     * @return The SourceId used by MediaPlayerInterface to identify this @c prepareNextSource() request.
+     */
+    virtual SourceId urlPrepareNextSource(const std::string& url) = 0;
 };
 
 /// A mock MediaPlayer for unit tests.
@@ -90,6 +107,10 @@ public:
         const std::string& url,
         std::chrono::milliseconds offset = std::chrono::milliseconds::zero()) /*override*/;
     SourceId setSource(std::shared_ptr<std::istream> stream, bool repeat) /*override*/;
+    SourceId prepareNextSource(const std::string& url) /*override*/;
+    SourceId prepareNextSource(
+        std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> attachmentReader,
+        const avsCommon::utils::AudioFormat* audioFormat = nullptr) /*override*/;
     void setObserver(std::shared_ptr<observer> playerObserver) /*override*/;
     /// @}
 
@@ -99,6 +120,7 @@ public:
     MOCK_METHOD1(stop, bool(SourceId));
     MOCK_METHOD1(getOffset, std::chrono::milliseconds(SourceId));
     MOCK_METHOD0(getNumBytesBuffered, uint64_t());
+    MOCK_METHOD0(cancelNextSource, bool());
 
     /// @name RequiresShutdown overrides
     /// @{
@@ -112,6 +134,12 @@ public:
             const avsCommon::utils::AudioFormat* audioFormat));
     MOCK_METHOD2(streamSetSource, SourceId(std::shared_ptr<std::istream> stream, bool repeat));
     MOCK_METHOD1(urlSetSource, SourceId(const std::string& url));
+    MOCK_METHOD2(
+        attachmentPrepareNextSource,
+        SourceId(
+            std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> attachmentReader,
+            const avsCommon::utils::AudioFormat* audioFormat));
+    MOCK_METHOD1(urlPrepareNextSource, SourceId(const std::string& url));
 
     /**
      * This is a mock method which will generate a new SourceId.
@@ -286,8 +314,10 @@ private:
          *
          * @param timeout How long to wait before giving up on actually reaching the state and delivering
          * an @c onPlaybackFailed() callback, instead.
+         * @param turn The position of this notification among those triggered for the source.  It is not delivered
+         * before the notifications triggered ahead of it, as a @c MediaPlayer reports its states in order.
          */
-        void notify(const std::chrono::milliseconds timeout);
+        void notify(const std::chrono::milliseconds timeout, unsigned int turn);
 
         /// The source whose state we are tracking.
         Source* m_source;
@@ -336,6 +366,18 @@ private:
         /// Offset to report for @c getOffset() calls for this source.
         std::chrono::milliseconds offset;
 
+        /// Used to serialize access to @c triggeredCount and @c deliveredCount.
+        std::mutex deliveryMutex;
+
+        /// Used to wake notifications waiting for their turn to be delivered.
+        std::condition_variable deliveryTurn;
+
+        /// The number of notifications triggered for this source. Access synchronized with @c deliveryMutex.
+        unsigned int triggeredCount;
+
+        /// The number of notifications delivered for this source. Access synchronized with @c deliveryMutex.
+        unsigned int deliveredCount;
+
         /// Tracks if playbackStarted state has been reached.
         SourceState started;
 
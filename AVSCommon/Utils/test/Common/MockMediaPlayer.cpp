@@ -62,6 +62,16 @@ MediaPlayerInterface::SourceId MockMediaPlayer::setSource(std::shared_ptr<std::i
     return streamSetSource(stream, repeat);
 }
 
+MediaPlayerInterface::SourceId MockMediaPlayer::prepareNextSource(const std::string& url) {
+    return urlPrepareNextSource(url);
+}
+
+MediaPlayerInterface::SourceId MockMediaPlayer::prepareNextSource(
+    std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> attachmentReader,
+    const avsCommon::utils::AudioFormat* audioFormat) {
+    return attachmentPrepareNextSource(attachmentReader, audioFormat);
+}
+
 void MockMediaPlayer::setObserver(std::shared_ptr<MediaPlayerObserverInterface> playerObserver) {
     m_playerObserver = playerObserver;
 }
@@ -221,26 +231,39 @@ void MockMediaPlayer::SourceState::trigger() {
     if (m_stateReached) {
         return;
     }
-    m_thread = std::thread(&MockMediaPlayer::SourceState::notify, this, DEFAULT_TIME);
+    unsigned int turn = 0;
+    {
+        std::lock_guard<std::mutex> deliveryLock(m_source->deliveryMutex);
+        turn = m_source->triggeredCount++;
+    }
+    m_thread = std::thread(&MockMediaPlayer::SourceState::notify, this, DEFAULT_TIME, turn);
     m_stateReached = true;
     m_wake.notify_all();
 }
 
-void MockMediaPlayer::SourceState::notify(const std::chrono::milliseconds timeout) {
-    std::unique_lock<std::mutex> lock(m_mutex);
-    auto observer = m_source->mockMediaPlayer->m_playerObserver;
-    if (!m_wake.wait_for(lock, timeout, [this]() { return (m_stateReached || m_shutdown); })) {
-        if (observer) {
-            lock.unlock();
-            observer->onPlaybackError(
-                m_source->sourceId, ErrorType::MEDIA_ERROR_UNKNOWN, m_name + ": wait to notify timed out");
+void MockMediaPlayer::SourceState::notify(const std::chrono::milliseconds timeout, unsigned int turn) {
+    {
+        std::unique_lock<std::mutex> deliveryLock(m_source->deliveryMutex);
+        m_source->deliveryTurn.wait(deliveryLock, [this, turn]() { return m_source->deliveredCount == turn; });
+    }
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        auto observer = m_source->mockMediaPlayer->m_playerObserver;
+        if (!m_wake.wait_for(lock, timeout, [this]() { return (m_stateReached || m_shutdown); })) {
+            if (observer) {
+                lock.unlock();
+                observer->onPlaybackError(
+                    m_source->sourceId, ErrorType::MEDIA_ERROR_UNKNOWN, m_name + ": wait to notify timed out");
+            }
+        } else if (observer) {
+            m_notifyFunction(observer, m_source->sourceId);
         }
-        return;
     }
-    if (observer) {
-        m_notifyFunction(observer, m_source->sourceId);
+    {
+        std::lock_guard<std::mutex> deliveryLock(m_source->deliveryMutex);
+        ++m_source->deliveredCount;
     }
-    return;
+    m_source->deliveryTurn.notify_all();
 }
 
 bool MockMediaPlayer::SourceState::wait(const std::chrono::milliseconds timeout) {
@@ -299,6 +322,8 @@ MockMediaPlayer::Source::Source(MockMediaPlayer* player, SourceId id) :
         mockMediaPlayer{player},
         sourceId{id},
         offset{MEDIA_PLAYER_INVALID_OFFSET},
+        triggeredCount{0},
+        deliveredCount{0},
         started{this, "started", notifyPlaybackStarted},
         paused{this, "paused", notifyPlaybackPaused},
         resumed{this, "resumed", notifyPlaybackResumed},
@@ -14,10 +14,12 @@
  */
 
 #include <list>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include "ExecutorTestUtils.h"
 #include "AVSCommon/Utils/Threading/Executor.h"
+#include "AVSCommon/Utils/Threading/ThreadPool.h"
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -25,6 +27,9 @@ namespace utils {
 namespace threading {
 namespace test {
 
+/// Long timeout for a task to run while the pool's other workers are blocked (we should not reach this).
+static const std::chrono::milliseconds LONG_TIMEOUT_MS(2000);
+
 class ExecutorTest : public ::testing::Test {
 public:
     Executor executor;
@@ -167,6 +172,17 @@ TEST_F(ExecutorTest, submitToFront) {
     ASSERT_EQ(order.back(), 2);
 }
 
+TEST_F(ExecutorTest, executeRunsTasksInOrderWithSubmittedTasks) {
+    std::list<int> order;
+    ASSERT_TRUE(executor.execute([&] { order.push_back(1); }));
+    executor.submit([&] { order.push_back(2); });
+    ASSERT_TRUE(executor.execute([&] { order.push_back(3); }));
+
+    executor.waitForSubmittedTasks();
+
+    ASSERT_EQ(order, std::list<int>({1, 2, 3}));
+}
+
 /// Used by @c futureWaitsForTaskCleanup delay and timestamp the time of lambda parameter destruction.
 struct SlowDestructor {
     /// Constructor.
@@ -245,6 +261,32 @@ TEST_F(ExecutorTest, shutdown) {
     // try to submit a new task and verify that it is rejected
     auto rejected = executor.submit([] {});
     ASSERT_FALSE(rejected.valid());
+    ASSERT_FALSE(executor.execute([] {}));
+
+    // waiting for tasks on a shutdown executor returns immediately
+    executor.waitForSubmittedTasks();
+}
+
+/**
+ * This test verifies that a task still runs when more executors than the shared pool's thread limit are all blocked in
+ * long-running tasks, as they are when downloads and playlist fetches are slow.
+ */
+TEST_F(ExecutorTest, taskRunsWhileSharedPoolIsSaturated) {
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::list<Executor> blockedExecutors(ThreadPool::DEFAULT_MAX_THREADS + 1);
+    std::vector<std::future<void>> blockedTasks;
+    for (auto& blockedExecutor : blockedExecutors) {
+        blockedTasks.push_back(blockedExecutor.submit([released] { released.wait(); }));
+    }
+
+    auto future = executor.submit([] {});
+    auto status = future.wait_for(LONG_TIMEOUT_MS);
+    release.set_value();
+    for (auto& blockedTask : blockedTasks) {
+        blockedTask.wait();
+    }
+    ASSERT_EQ(status, std::future_status::ready);
 }
 
 }  // namespace test
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Timing/LatencyHistogram.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+namespace test {
+
+using namespace std::chrono;
+
+/**
+ * Verify that an empty histogram reports zeros.
+ */
+TEST(LatencyHistogramTest, emptyHistogram) {
+    LatencyHistogram histogram;
+    ASSERT_EQ(histogram.getCount(), 0u);
+    ASSERT_EQ(histogram.getMax(), microseconds::zero());
+    ASSERT_EQ(histogram.getPercentile(50), microseconds::zero());
+}
+
+/**
+ * Verify that latencies land in the bucket whose bound is the first at or above them, and that latencies above the
+ * last bound land in the extra bucket.
+ */
+TEST(LatencyHistogramTest, latenciesLandInTheirBuckets) {
+    LatencyHistogram histogram;
+    histogram.record(nanoseconds(300));
+    histogram.record(microseconds(1));
+    histogram.record(microseconds(3));
+    histogram.record(milliseconds(1));
+    histogram.record(seconds(10));
+    ASSERT_EQ(histogram.getCount(), 5u);
+    ASSERT_EQ(histogram.getBucketCount(0), 2u);
+    ASSERT_EQ(histogram.getBucketCount(1), 0u);
+    ASSERT_EQ(histogram.getBucketCount(2), 1u);
+    ASSERT_EQ(histogram.getBucketCount(9), 1u);
+    ASSERT_EQ(histogram.getBucketCount(LatencyHistogram::BOUNDED_BUCKET_COUNT), 1u);
+    ASSERT_EQ(histogram.getBucketCount(LatencyHistogram::BOUNDED_BUCKET_COUNT + 1), 0u);
+    ASSERT_EQ(histogram.getMax(), seconds(10));
+}
+
+/**
+ * Verify that each bound belongs to its own bucket, and that anything just above it belongs to the next one.
+ */
+TEST(LatencyHistogramTest, boundsAreInclusive) {
+    for (size_t i = 0; i < LatencyHistogram::BOUNDED_BUCKET_COUNT; ++i) {
+        LatencyHistogram histogram;
+        histogram.record(LatencyHistogram::BUCKET_BOUNDS[i]);
+        histogram.record(LatencyHistogram::BUCKET_BOUNDS[i] + microseconds(1));
+        ASSERT_EQ(histogram.getBucketCount(i), 1u) << "bucket=" << i;
+        ASSERT_EQ(histogram.getBucketCount(i + 1), 1u) << "bucket=" << i;
+    }
+}
+
+/**
+ * Verify that latencies under a millisecond are told apart, rather than all being reported as 1 ms.
+ */
+TEST(LatencyHistogramTest, subMillisecondPercentiles) {
+    LatencyHistogram histogram;
+    for (int i = 0; i < 90; ++i) {
+        histogram.record(microseconds(15));
+    }
+    for (int i = 0; i < 10; ++i) {
+        histogram.record(microseconds(150));
+    }
+    ASSERT_EQ(histogram.getPercentile(50), microseconds(20));
+    ASSERT_EQ(histogram.getPercentile(95), microseconds(150));
+    ASSERT_LT(histogram.getPercentile(95), milliseconds(1));
+}
+
+/**
+ * Verify that percentiles report the bound of the bucket holding them, but never more than the maximum.
+ */
+TEST(LatencyHistogramTest, percentiles) {
+    LatencyHistogram histogram;
+    for (int i = 0; i < 98; ++i) {
+        histogram.record(microseconds(800));
+    }
+    histogram.record(milliseconds(15));
+    histogram.record(milliseconds(150));
+    ASSERT_EQ(histogram.getPercentile(50), milliseconds(1));
+    ASSERT_EQ(histogram.getPercentile(99), milliseconds(20));
+    ASSERT_EQ(histogram.getPercentile(100), milliseconds(150));
+
+    LatencyHistogram small;
+    small.record(microseconds(300));
+    ASSERT_EQ(small.getPercentile(50), microseconds(300));
+}
+
+}  // namespace test
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
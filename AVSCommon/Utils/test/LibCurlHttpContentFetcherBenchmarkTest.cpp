@@ -0,0 +1,148 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file LibCurlHttpContentFetcherBenchmarkTest.cpp
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/LibcurlUtils/HTTPContentFetcherFactory.h>
+#include <AVSCommon/Utils/LibcurlUtils/LibCurlHttpContentFetcher.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Timing/LatencyHistogram.h>
+
+#include "AVSCommon/Utils/LibcurlUtils/LocalHttpServer.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+namespace test {
+
+using namespace avsCommon::avs::attachment;
+using namespace avsCommon::sdkInterfaces;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("LibCurlHttpContentFetcherBenchmarkTest");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The round trip to the stand-in server, like that to a content delivery network.
+static const std::chrono::milliseconds ROUND_TRIP(15);
+
+/// The extra time a new connection takes, which stands in for the TCP and TLS handshakes of two more round trips.
+static const std::chrono::milliseconds CONNECTION_SETUP_TIME(30);
+
+/// The number of segments fetched, one after the other like a player working through a playlist.
+static const int SEGMENT_COUNT = 20;
+
+/// The size of each segment.
+static const size_t SEGMENT_SIZE = 64 * 1024;
+
+/// Long timeout for each read of a segment from the local server (we should not reach this).
+static const std::chrono::seconds LONG_TIMEOUT(10);
+
+/**
+ * Fetch @c SEGMENT_COUNT segments one after the other, and record the time from @c getContent() to the end of each.
+ *
+ * @param createFetcher Creates the fetcher of a URL.
+ * @param server The server of the segments.
+ * @param expectedSegment The content of each segment.
+ * @param[out] latencies The latencies of the segments.
+ */
+static void measureSegmentLatency(
+    std::function<std::unique_ptr<HTTPContentFetcherInterface>(const std::string&)> createFetcher,
+    LocalHttpServer* server,
+    const std::string& expectedSegment,
+    timing::LatencyHistogram* latencies) {
+    std::vector<char> buffer(SEGMENT_SIZE);
+    for (int i = 0; i < SEGMENT_COUNT; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        auto fetcher = createFetcher(server->getUrl("/segment" + std::to_string(i) + ".ts"));
+        auto content = fetcher->getContent(HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY);
+        ASSERT_TRUE(content);
+        auto reader = content->dataStream->createReader(avsCommon::utils::sds::ReaderPolicy::BLOCKING);
+        std::string segment;
+        auto readStatus = AttachmentReader::ReadStatus::OK;
+        while (readStatus != AttachmentReader::ReadStatus::CLOSED) {
+            auto bytesRead = reader->read(buffer.data(), buffer.size(), &readStatus, LONG_TIMEOUT);
+            ASSERT_NE(readStatus, AttachmentReader::ReadStatus::OK_TIMEDOUT);
+            segment.append(buffer.data(), bytesRead);
+        }
+        latencies->record(std::chrono::steady_clock::now() - start);
+        ASSERT_EQ(segment, expectedSegment);
+    }
+}
+
+/**
+ * Measure the latency of fetching the segments of a playlist with a thread and a connection per fetcher, as before,
+ * and with fetchers which share a @c CurlMultiLoop.
+ */
+TEST(LibCurlHttpContentFetcherBenchmarkTest, segmentFetchLatency) {
+    std::string segment;
+    for (size_t i = 0; i < SEGMENT_SIZE; ++i) {
+        segment.push_back(static_cast<char>('a' + i % 26));
+    }
+
+    LocalHttpServer ownThreadServer(CONNECTION_SETUP_TIME, ROUND_TRIP);
+    LocalHttpServer loopServer(CONNECTION_SETUP_TIME, ROUND_TRIP);
+    for (int i = 0; i < SEGMENT_COUNT; ++i) {
+        ownThreadServer.setResponse("/segment" + std::to_string(i) + ".ts", "video/MP2T", segment);
+        loopServer.setResponse("/segment" + std::to_string(i) + ".ts", "video/MP2T", segment);
+    }
+
+    timing::LatencyHistogram ownThreadLatencies;
+    measureSegmentLatency(
+        [](const std::string& url) {
+            return std::unique_ptr<HTTPContentFetcherInterface>(new LibCurlHttpContentFetcher(url));
+        },
+        &ownThreadServer,
+        segment,
+        &ownThreadLatencies);
+
+    HTTPContentFetcherFactory factory;
+    timing::LatencyHistogram loopLatencies;
+    measureSegmentLatency(
+        [&factory](const std::string& url) { return factory.create(url); },
+        &loopServer,
+        segment,
+        &loopLatencies);
+
+    ACSDK_INFO(LX("segmentFetchLatency")
+                   .d("segments", SEGMENT_COUNT)
+                   .d("ownThreadLatencies", ownThreadLatencies.toString())
+                   .d("ownThreadConnections", ownThreadServer.getConnectionCount())
+                   .d("loopLatencies", loopLatencies.toString())
+                   .d("loopConnections", loopServer.getConnectionCount()));
+
+    ASSERT_EQ(ownThreadServer.getConnectionCount(), SEGMENT_COUNT);
+    ASSERT_EQ(loopServer.getConnectionCount(), 1);
+}
+
+}  // namespace test
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
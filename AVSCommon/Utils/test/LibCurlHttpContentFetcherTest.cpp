@@ -0,0 +1,242 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file LibCurlHttpContentFetcherTest.cpp
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/AVS/Attachment/InProcessAttachment.h>
+#include <AVSCommon/Utils/LibcurlUtils/HTTPContentFetcherFactory.h>
+#include <AVSCommon/Utils/LibcurlUtils/LibCurlHttpContentFetcher.h>
+#include <AVSCommon/Utils/SDS/InProcessSDS.h>
+
+#include "AVSCommon/Utils/LibcurlUtils/LocalHttpServer.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+namespace test {
+
+using namespace avsCommon::avs::attachment;
+using namespace avsCommon::sdkInterfaces;
+using namespace avsCommon::utils::sds;
+
+/// Long timeout for reads of fetched content, and for a fetcher to stop its transfer (we should not reach this).
+static const std::chrono::seconds LONG_TIMEOUT(10);
+
+/// The path of a playlist on the stand-in server.
+static const std::string PLAYLIST_PATH = "/playlist.m3u8";
+
+/// The content type of the playlist.
+static const std::string PLAYLIST_CONTENT_TYPE = "application/vnd.apple.mpegurl";
+
+/// The playlist.
+static const std::string PLAYLIST = "#EXTM3U\n#EXTINF:10,\nsegment0.ts\n#EXTINF:10,\nsegment1.ts\n";
+
+/// The path of a media segment on the stand-in server.
+static const std::string SEGMENT_PATH = "/segment0.ts";
+
+/// The size of the media segment, which is many times the size of @c SMALL_BUFFER_SIZE.
+static const size_t SEGMENT_SIZE = 256 * 1024;
+
+/// The size of an attachment which cannot hold the media segment.
+static const size_t SMALL_BUFFER_SIZE = 4 * 1024;
+
+/// The number of fetches which should share one connection.
+static const int FETCH_COUNT = 5;
+
+/// The HTTP status code of a successful response.
+static const long HTTP_OK = 200;
+
+/**
+ * Read an attachment until its writer closes it.
+ *
+ * @param attachment The attachment.
+ * @param readDelay How long to wait before each read, to let the writer fill the attachment.
+ * @return The content of the attachment.
+ */
+static std::string readAll(
+    std::shared_ptr<InProcessAttachment> attachment,
+    std::chrono::milliseconds readDelay = std::chrono::milliseconds(0)) {
+    auto reader = attachment->createReader(ReaderPolicy::BLOCKING);
+    std::string content;
+    std::vector<char> buffer(1024);
+    auto readStatus = AttachmentReader::ReadStatus::OK;
+    while (readStatus != AttachmentReader::ReadStatus::CLOSED) {
+        std::this_thread::sleep_for(readDelay);
+        auto bytesRead = reader->read(buffer.data(), buffer.size(), &readStatus, LONG_TIMEOUT);
+        if (AttachmentReader::ReadStatus::OK_TIMEDOUT == readStatus) {
+            break;
+        }
+        content.append(buffer.data(), bytesRead);
+    }
+    return content;
+}
+
+/**
+ * Create an attachment which holds only @c SMALL_BUFFER_SIZE bytes.
+ *
+ * @return The attachment.
+ */
+static std::shared_ptr<InProcessAttachment> createSmallAttachment() {
+    auto buffer = std::make_shared<InProcessSDS::Buffer>(InProcessSDS::calculateBufferSize(SMALL_BUFFER_SIZE));
+    return std::make_shared<InProcessAttachment>("small", InProcessSDS::create(buffer));
+}
+
+/// Test harness for @c LibCurlHttpContentFetcher on a @c CurlMultiLoop.
+class LibCurlHttpContentFetcherTest : public ::testing::Test {
+public:
+    void SetUp() override;
+
+    /// The stand-in server.
+    std::unique_ptr<LocalHttpServer> m_server;
+
+    /// The factory of the fetchers, which share a loop.
+    std::shared_ptr<HTTPContentFetcherFactory> m_factory;
+
+    /// The media segment.
+    std::string m_segment;
+};
+
+void LibCurlHttpContentFetcherTest::SetUp() {
+    m_server.reset(new LocalHttpServer(std::chrono::milliseconds(0), std::chrono::milliseconds(0)));
+    ASSERT_FALSE(m_server->getUrl("/").empty());
+    for (size_t i = 0; i < SEGMENT_SIZE; ++i) {
+        m_segment.push_back(static_cast<char>('a' + i % 26));
+    }
+    m_server->setResponse(PLAYLIST_PATH, PLAYLIST_CONTENT_TYPE, PLAYLIST);
+    m_server->setResponse(SEGMENT_PATH, "video/MP2T", m_segment);
+    m_factory = std::make_shared<HTTPContentFetcherFactory>();
+}
+
+/**
+ * Verify that a fetcher on a loop delivers the status code, the content type and the body.
+ */
+TEST_F(LibCurlHttpContentFetcherTest, fetchEntireBody) {
+    auto fetcher = m_factory->create(m_server->getUrl(PLAYLIST_PATH));
+    auto content = fetcher->getContent(HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY);
+    ASSERT_TRUE(content);
+    ASSERT_EQ(content->statusCode.get(), HTTP_OK);
+    ASSERT_EQ(content->contentType.get(), PLAYLIST_CONTENT_TYPE);
+    ASSERT_EQ(readAll(content->dataStream), PLAYLIST);
+}
+
+/**
+ * Verify that a fetcher on a loop delivers the content type alone.
+ */
+TEST_F(LibCurlHttpContentFetcherTest, fetchContentType) {
+    auto fetcher = m_factory->create(m_server->getUrl(PLAYLIST_PATH));
+    auto content = fetcher->getContent(HTTPContentFetcherInterface::FetchOptions::CONTENT_TYPE);
+    ASSERT_TRUE(content);
+    ASSERT_EQ(content->statusCode.get(), HTTP_OK);
+    ASSERT_EQ(content->contentType.get(), PLAYLIST_CONTENT_TYPE);
+    ASSERT_EQ(content->dataStream, nullptr);
+}
+
+/**
+ * Verify that a missing resource is reported through the status code.
+ */
+TEST_F(LibCurlHttpContentFetcherTest, fetchMissingResource) {
+    auto fetcher = m_factory->create(m_server->getUrl("/missing"));
+    auto content = fetcher->getContent(HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY);
+    ASSERT_TRUE(content);
+    ASSERT_EQ(content->statusCode.get(), 404);
+    ASSERT_TRUE(readAll(content->dataStream).empty());
+}
+
+/**
+ * Verify that consecutive fetches from one factory share a connection, while fetchers of their own do not.
+ */
+TEST_F(LibCurlHttpContentFetcherTest, fetchesReuseConnection) {
+    for (int i = 0; i < FETCH_COUNT; ++i) {
+        auto fetcher = m_factory->create(m_server->getUrl(PLAYLIST_PATH));
+        auto content = fetcher->getContent(HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY);
+        ASSERT_TRUE(content);
+        ASSERT_EQ(readAll(content->dataStream), PLAYLIST);
+    }
+    ASSERT_EQ(m_server->getConnectionCount(), 1);
+
+    for (int i = 0; i < FETCH_COUNT; ++i) {
+        LibCurlHttpContentFetcher fetcher(m_server->getUrl(PLAYLIST_PATH));
+        auto content = fetcher.getContent(HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY);
+        ASSERT_TRUE(content);
+        ASSERT_EQ(readAll(content->dataStream), PLAYLIST);
+    }
+    ASSERT_EQ(m_server->getConnectionCount(), 1 + FETCH_COUNT);
+}
+
+/**
+ * Verify that a writer which is full pauses its transfer without losing data, and without holding up other transfers
+ * on the loop.
+ */
+TEST_F(LibCurlHttpContentFetcherTest, fullWriterPausesTransfer) {
+    auto attachment = createSmallAttachment();
+    std::shared_ptr<AttachmentWriter> writer = attachment->createWriter(WriterPolicy::BLOCKING);
+    auto segmentFetcher = m_factory->create(m_server->getUrl(SEGMENT_PATH));
+    auto segmentContent =
+        segmentFetcher->getContent(HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY, writer);
+    ASSERT_TRUE(segmentContent);
+    ASSERT_EQ(segmentContent->statusCode.get(), HTTP_OK);
+
+    // Nothing reads the segment yet, so its transfer is paused on a full writer.
+    auto playlistFetcher = m_factory->create(m_server->getUrl(PLAYLIST_PATH));
+    auto playlistContent = playlistFetcher->getContent(HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY);
+    ASSERT_TRUE(playlistContent);
+    auto playlist = std::async(std::launch::async, readAll, playlistContent->dataStream, std::chrono::milliseconds(0));
+    ASSERT_EQ(playlist.wait_for(LONG_TIMEOUT), std::future_status::ready);
+    ASSERT_EQ(playlist.get(), PLAYLIST);
+
+    auto segment = std::async(std::launch::async, readAll, attachment, std::chrono::milliseconds(0));
+    // The writer belongs to the caller, so the caller closes it once the fetcher is done.
+    segmentFetcher.reset();
+    writer->close();
+    ASSERT_EQ(segment.wait_for(LONG_TIMEOUT), std::future_status::ready);
+    ASSERT_EQ(segment.get(), m_segment);
+}
+
+/**
+ * Verify that destroying a fetcher of @c CONTENT_TYPE_AND_BODY stops its transfer, even if nothing reads the body.
+ */
+TEST_F(LibCurlHttpContentFetcherTest, destroyingFetcherStopsTransfer) {
+    auto attachment = createSmallAttachment();
+    std::shared_ptr<AttachmentWriter> writer = attachment->createWriter(WriterPolicy::BLOCKING);
+    auto fetcher = m_factory->create(m_server->getUrl(SEGMENT_PATH));
+    auto content = fetcher->getContent(HTTPContentFetcherInterface::FetchOptions::CONTENT_TYPE_AND_BODY, writer);
+    ASSERT_TRUE(content);
+    ASSERT_EQ(content->statusCode.get(), HTTP_OK);
+
+    auto destroyed = std::async(std::launch::async, [&fetcher]() { fetcher.reset(); });
+    ASSERT_EQ(destroyed.wait_for(LONG_TIMEOUT), std::future_status::ready);
+
+    // The loop is still usable.
+    auto playlistFetcher = m_factory->create(m_server->getUrl(PLAYLIST_PATH));
+    auto playlistContent = playlistFetcher->getContent(HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY);
+    ASSERT_TRUE(playlistContent);
+    ASSERT_EQ(readAll(playlistContent->dataStream), PLAYLIST);
+}
+
+}  // namespace test
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,176 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file SharedDataStreamBenchmarkTest.cpp
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/SDS/InProcessSDS.h"
+#include "AVSCommon/Utils/Timing/LatencyHistogram.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+namespace test {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("SharedDataStreamBenchmarkTest");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The size of an audio sample, in bytes.
+static const size_t WORD_SIZE = sizeof(int16_t);
+
+/// The number of samples in one 10 ms frame of 16 kHz audio.
+static const size_t FRAME_WORDS = 160;
+
+/// The capacity of the stream, in words (10 seconds of 16 kHz audio, as used for the microphone stream).
+static const size_t BUFFER_WORDS = 16000 * 10;
+
+/// The number of readers, matching the wake word engine, AudioInputProcessor and one spare.
+static const size_t NUM_READERS = 3;
+
+/// The number of frames written when measuring the per-frame cost.
+static const size_t COST_FRAMES = 200000;
+
+/// The number of frames written when measuring wake-up latency.
+static const size_t LATENCY_FRAMES = 500;
+
+/// The time between frames when measuring wake-up latency.
+static const std::chrono::microseconds LATENCY_FRAME_INTERVAL(200);
+
+/// Long timeout for a blocking reader to receive each frame (we should not reach this).
+static const std::chrono::milliseconds READ_TIMEOUT(2000);
+
+/// Test harness which creates a microphone-shaped @c InProcessSDS.
+class SharedDataStreamBenchmarkTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        auto bufferSize = InProcessSDS::calculateBufferSize(BUFFER_WORDS, WORD_SIZE, NUM_READERS);
+        m_stream = InProcessSDS::create(std::make_shared<InProcessSDS::Buffer>(bufferSize), WORD_SIZE, NUM_READERS);
+        ASSERT_NE(m_stream, nullptr);
+    }
+
+    /**
+     * Write @c COST_FRAMES frames, with every reader consuming each frame after it is written, and log the average
+     * cost of each write and read.
+     *
+     * @param writerPolicy The policy of the writer.
+     * @param readerPolicy The policy of the readers.
+     */
+    void measureFrameCost(InProcessSDS::Writer::Policy writerPolicy, InProcessSDS::Reader::Policy readerPolicy) {
+        auto writer = m_stream->createWriter(writerPolicy);
+        ASSERT_NE(writer, nullptr);
+        std::vector<std::unique_ptr<InProcessSDS::Reader>> readers;
+        for (size_t i = 0; i < NUM_READERS; ++i) {
+            readers.push_back(m_stream->createReader(readerPolicy));
+            ASSERT_NE(readers.back(), nullptr);
+        }
+
+        std::vector<int16_t> frame(FRAME_WORDS, 1);
+        std::chrono::nanoseconds writeTime{0};
+        std::chrono::nanoseconds readTime{0};
+        for (size_t i = 0; i < COST_FRAMES; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            ASSERT_EQ(writer->write(frame.data(), FRAME_WORDS), static_cast<ssize_t>(FRAME_WORDS));
+            auto written = std::chrono::steady_clock::now();
+            for (auto& reader : readers) {
+                ASSERT_EQ(reader->read(frame.data(), FRAME_WORDS, READ_TIMEOUT), static_cast<ssize_t>(FRAME_WORDS));
+            }
+            auto read = std::chrono::steady_clock::now();
+            writeTime += written - start;
+            readTime += read - written;
+        }
+
+        ACSDK_INFO(LX("sdsFrameCost")
+                       .d("writerPolicy", static_cast<int>(writerPolicy))
+                       .d("readerPolicy", static_cast<int>(readerPolicy))
+                       .d("writeNsPerFrame", writeTime.count() / COST_FRAMES)
+                       .d("readNsPerFrame", readTime.count() / (COST_FRAMES * NUM_READERS)));
+    }
+
+    /// The stream under test.
+    std::unique_ptr<InProcessSDS> m_stream;
+};
+
+/**
+ * Measure the per-frame cost of the microphone path: a @c NONBLOCKABLE writer feeding @c NONBLOCKING readers.
+ */
+TEST_F(SharedDataStreamBenchmarkTest, nonblockableWriterFrameCost) {
+    measureFrameCost(InProcessSDS::Writer::Policy::NONBLOCKABLE, InProcessSDS::Reader::Policy::NONBLOCKING);
+}
+
+/**
+ * Measure the per-frame cost of a @c BLOCKING writer feeding @c BLOCKING readers which never have to wait.
+ */
+TEST_F(SharedDataStreamBenchmarkTest, blockingWriterFrameCost) {
+    measureFrameCost(InProcessSDS::Writer::Policy::BLOCKING, InProcessSDS::Reader::Policy::BLOCKING);
+}
+
+/**
+ * Measure the time from the start of a @c write() to the return of a @c read() in a @c BLOCKING reader which was
+ * asleep waiting for it.
+ */
+TEST_F(SharedDataStreamBenchmarkTest, blockingReaderWakeupLatency) {
+    auto writer = m_stream->createWriter(InProcessSDS::Writer::Policy::NONBLOCKABLE);
+    ASSERT_NE(writer, nullptr);
+    std::shared_ptr<InProcessSDS::Reader> reader = m_stream->createReader(InProcessSDS::Reader::Policy::BLOCKING);
+    ASSERT_NE(reader, nullptr);
+
+    std::atomic<std::chrono::steady_clock::rep> writeStart{0};
+    timing::LatencyHistogram latencies;
+    std::thread readerThread([&] {
+        std::vector<int16_t> frame(FRAME_WORDS);
+        for (size_t i = 0; i < LATENCY_FRAMES; ++i) {
+            auto words = reader->read(frame.data(), FRAME_WORDS, READ_TIMEOUT);
+            auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+            if (words != static_cast<ssize_t>(FRAME_WORDS)) {
+                break;
+            }
+            latencies.record(std::chrono::steady_clock::duration(now - writeStart));
+        }
+    });
+
+    std::vector<int16_t> frame(FRAME_WORDS, 1);
+    for (size_t i = 0; i < LATENCY_FRAMES; ++i) {
+        // Give the reader time to consume the previous frame and go back to sleep.
+        std::this_thread::sleep_for(LATENCY_FRAME_INTERVAL);
+        writeStart = std::chrono::steady_clock::now().time_since_epoch().count();
+        ASSERT_EQ(writer->write(frame.data(), FRAME_WORDS), static_cast<ssize_t>(FRAME_WORDS));
+    }
+    readerThread.join();
+    ASSERT_EQ(latencies.getCount(), LATENCY_FRAMES);
+
+    ACSDK_INFO(LX("sdsWakeupLatency").d("latencies", latencies.toString()));
+}
+
+}  // namespace test
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
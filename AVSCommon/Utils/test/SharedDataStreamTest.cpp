@@ -1246,6 +1246,125 @@ TEST_F(SharedDataStreamTest, writerClosedBeforeAttachingReader) {
     ASSERT_EQ(error, Sds::Reader::Error::CLOSED);
 }
 
+/// This tests @c SharedDataStream::Reader::peek() and @c SharedDataStream::Reader::commit().
+TEST_F(SharedDataStreamTest, readerPeekAndCommit) {
+    static const size_t WORDSIZE = 2;
+    static const size_t WORDCOUNT = 4;
+    static const size_t MAXREADERS = 1;
+
+    // Initialize an sds.
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+
+    auto writer = sds->createWriter(Sds::Writer::Policy::NONBLOCKABLE);
+    ASSERT_NE(writer, nullptr);
+    auto reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+
+    // Verify argument checking.
+    Sds::Reader::Span first;
+    Sds::Reader::Span second;
+    ASSERT_EQ(reader->peek(nullptr, &second, 1), Sds::Reader::Error::INVALID);
+    ASSERT_EQ(reader->peek(&first, nullptr, 1), Sds::Reader::Error::INVALID);
+    ASSERT_EQ(reader->peek(&first, &second, 0), Sds::Reader::Error::INVALID);
+    ASSERT_EQ(reader->peek(&first, &second, 1), Sds::Reader::Error::WOULDBLOCK);
+    ASSERT_EQ(reader->commit(1), Sds::Reader::Error::INVALID);
+
+    // Move both ends of the stream three words in, so that the next four words wrap around the end of the buffer.
+    uint16_t words[WORDCOUNT] = {0, 1, 2, 3};
+    uint16_t readWords[WORDCOUNT];
+    ASSERT_EQ(writer->write(words, 3), 3);
+    ASSERT_EQ(reader->read(readWords, 3), 3);
+    ASSERT_EQ(writer->write(words, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+
+    // Verify that peeking returns both spans without consuming them.
+    for (size_t i = 0; i < 2; ++i) {
+        ASSERT_EQ(reader->peek(&first, &second, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+        ASSERT_EQ(first.nWords, 1U);
+        ASSERT_EQ(second.nWords, WORDCOUNT - 1);
+        ASSERT_EQ(static_cast<const uint16_t*>(first.data)[0], words[0]);
+        for (size_t j = 0; j < second.nWords; ++j) {
+            ASSERT_EQ(static_cast<const uint16_t*>(second.data)[j], words[j + 1]);
+        }
+        ASSERT_EQ(reader->tell(), 3U);
+    }
+
+    // Verify that a commit consumes only the requested words, and cannot consume more than is available.
+    ASSERT_EQ(reader->commit(0), Sds::Reader::Error::INVALID);
+    ASSERT_EQ(reader->commit(WORDCOUNT + 1), Sds::Reader::Error::INVALID);
+    ASSERT_EQ(reader->commit(2), 2);
+    ASSERT_EQ(reader->tell(), 5U);
+    ASSERT_EQ(reader->peek(&first, &second, WORDCOUNT), 2);
+    ASSERT_EQ(first.nWords, 2U);
+    ASSERT_EQ(second.nWords, 0U);
+    ASSERT_EQ(static_cast<const uint16_t*>(first.data)[0], words[2]);
+
+    // Verify that a commit reports data which the writer overwrote after it was peeked.
+    ASSERT_EQ(writer->write(words, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(reader->commit(1), Sds::Reader::Error::OVERRUN);
+}
+
+/// This tests @c SharedDataStream::Writer::reserve() and @c SharedDataStream::Writer::commit().
+TEST_F(SharedDataStreamTest, writerReserveAndCommit) {
+    static const size_t WORDSIZE = 2;
+    static const size_t WORDCOUNT = 4;
+    static const size_t MAXREADERS = 1;
+
+    // Initialize an sds.
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+
+    auto writer = sds->createWriter(Sds::Writer::Policy::ALL_OR_NOTHING);
+    ASSERT_NE(writer, nullptr);
+    auto reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+
+    // Verify argument checking.
+    Sds::Writer::Span first;
+    Sds::Writer::Span second;
+    ASSERT_EQ(writer->reserve(nullptr, &second, 1), Sds::Writer::Error::INVALID);
+    ASSERT_EQ(writer->reserve(&first, nullptr, 1), Sds::Writer::Error::INVALID);
+    ASSERT_EQ(writer->reserve(&first, &second, 0), Sds::Writer::Error::INVALID);
+    ASSERT_EQ(writer->commit(1), Sds::Writer::Error::INVALID);
+
+    // Move both ends of the stream three words in, so that the next four words wrap around the end of the buffer.
+    uint16_t words[WORDCOUNT] = {0, 1, 2, 3};
+    uint16_t readWords[WORDCOUNT];
+    ASSERT_EQ(writer->write(words, 3), 3);
+    ASSERT_EQ(reader->read(readWords, 3), 3);
+
+    // Verify that oversized reservations are truncated, and that reserved space wraps into the second span.
+    ASSERT_EQ(writer->reserve(&first, &second, WORDCOUNT * 2), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(first.nWords, 1U);
+    ASSERT_EQ(second.nWords, WORDCOUNT - 1);
+    static_cast<uint16_t*>(first.data)[0] = 10;
+    for (size_t i = 0; i < second.nWords; ++i) {
+        static_cast<uint16_t*>(second.data)[i] = static_cast<uint16_t>(11 + i);
+    }
+
+    // Verify that nothing is visible to readers until it is committed.
+    ASSERT_EQ(reader->read(readWords, WORDCOUNT), Sds::Reader::Error::WOULDBLOCK);
+
+    // Verify that a partial commit publishes only the requested words, and cannot publish more than was reserved.
+    ASSERT_EQ(writer->commit(0), Sds::Writer::Error::INVALID);
+    ASSERT_EQ(writer->commit(WORDCOUNT + 1), Sds::Writer::Error::INVALID);
+    ASSERT_EQ(writer->commit(2), 2);
+    ASSERT_EQ(writer->tell(), 5U);
+    ASSERT_EQ(writer->commit(1), Sds::Writer::Error::INVALID);
+    ASSERT_EQ(reader->read(readWords, WORDCOUNT), 2);
+    ASSERT_EQ(readWords[0], 10);
+    ASSERT_EQ(readWords[1], 11);
+
+    // Verify that the uncommitted space was released, and that an ALL_OR_NOTHING reservation waits for a full buffer.
+    ASSERT_EQ(writer->reserve(&first, &second, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(writer->commit(WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(writer->reserve(&first, &second, 1), Sds::Writer::Error::WOULDBLOCK);
+}
+
 }  // namespace test
 }  // namespace sds
 }  // namespace utils
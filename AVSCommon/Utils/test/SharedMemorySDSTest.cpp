@@ -0,0 +1,337 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file SharedMemorySDSTest.cpp
+
+#ifdef SHARED_MEMORY_SDS
+
+#include <cerrno>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/SDS/SharedMemorySDS.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+namespace test {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("SharedMemorySDSTest");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The size of an audio sample, in bytes.
+static const size_t WORD_SIZE = sizeof(uint16_t);
+
+/// The capacity of the stream, in words.
+static const size_t BUFFER_WORDS = 16000;
+
+/// The maximum number of readers of the stream.
+static const size_t MAX_READERS = 2;
+
+/// The number of samples in one 10 ms frame of 16 kHz audio.
+static const size_t FRAME_WORDS = 160;
+
+/// The number of words the writer process writes (one minute of 16 kHz audio).
+static const size_t TOTAL_WORDS = 16000 * 60;
+
+/// Long timeout for the other process to read or write a frame, or to signal a condition (we should not reach this).
+static const std::chrono::milliseconds READ_TIMEOUT(5000);
+
+/// The exit code of a child process which succeeded.
+static const int CHILD_SUCCESS = 0;
+
+/// The exit code of a child process which failed.
+static const int CHILD_FAILURE = 1;
+
+/**
+ * The value of the sample at a position in the test stream.
+ *
+ * @param index The position of the sample.
+ * @return The value of the sample.
+ */
+static uint16_t sampleAt(size_t index) {
+    return static_cast<uint16_t>(index * 7 + 3);
+}
+
+/**
+ * Wait for a child process to exit.
+ *
+ * @param pid The child process.
+ * @return The exit code of the child, or -1 if it did not exit normally.
+ */
+static int waitForChild(pid_t pid) {
+    int status = 0;
+    if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status)) {
+        return -1;
+    }
+    return WEXITSTATUS(status);
+}
+
+/**
+ * The body of the writer process: open the stream by name, and write @c TOTAL_WORDS samples to it.
+ *
+ * @param name The name of the shared memory object.
+ * @return The exit code of the process.
+ */
+static int runWriterProcess(const std::string& name) {
+    auto buffer = SharedMemoryBuffer::open(name);
+    if (!buffer) {
+        return CHILD_FAILURE;
+    }
+    auto stream = SharedMemorySDS::open(buffer);
+    if (!stream) {
+        return CHILD_FAILURE;
+    }
+    auto writer = stream->createWriter(SharedMemorySDS::Writer::Policy::BLOCKING);
+    if (!writer) {
+        return CHILD_FAILURE;
+    }
+    std::vector<uint16_t> frame(FRAME_WORDS);
+    size_t written = 0;
+    while (written < TOTAL_WORDS) {
+        for (size_t i = 0; i < FRAME_WORDS; ++i) {
+            frame[i] = sampleAt(written + i);
+        }
+        size_t offset = 0;
+        while (offset < FRAME_WORDS) {
+            auto result = writer->write(frame.data() + offset, FRAME_WORDS - offset, READ_TIMEOUT);
+            if (result <= 0) {
+                return CHILD_FAILURE;
+            }
+            offset += result;
+        }
+        written += FRAME_WORDS;
+    }
+    writer->close();
+    return CHILD_SUCCESS;
+}
+
+/// Test harness which creates a uniquely named shared memory object for each test.
+class SharedMemorySDSTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_name = "/SharedMemorySDSTest." + std::to_string(getpid());
+    }
+
+    /// The name of the shared memory object used by the test.
+    std::string m_name;
+};
+
+/**
+ * Verify that a buffer created by one @c SharedMemoryBuffer is visible through another which opened it by name, and
+ * that the name is unlinked when the creator is destroyed.
+ */
+TEST_F(SharedMemorySDSTest, bufferIsSharedByName) {
+    ASSERT_EQ(SharedMemoryBuffer::create("noLeadingSlash", 1), nullptr);
+    auto created = SharedMemoryBuffer::create(m_name, 4096);
+    ASSERT_NE(created, nullptr);
+    ASSERT_EQ(SharedMemoryBuffer::create(m_name, 4096), nullptr);
+
+    auto opened = SharedMemoryBuffer::open(m_name);
+    ASSERT_NE(opened, nullptr);
+    ASSERT_EQ(opened->size(), 4096u);
+    created->data()[100] = 42;
+    ASSERT_EQ(opened->data()[100], 42);
+
+    created.reset();
+    ASSERT_EQ(SharedMemoryBuffer::open(m_name), nullptr);
+    ASSERT_EQ(opened->data()[100], 42);
+}
+
+/**
+ * Verify that a reader in this process receives, in order and without loss, everything written by a writer in a
+ * forked process which attached to the stream by name, and log the throughput.
+ */
+TEST_F(SharedMemorySDSTest, readerReceivesDataFromWriterProcess) {
+    auto bufferSize = SharedMemorySDS::calculateBufferSize(BUFFER_WORDS, WORD_SIZE, MAX_READERS);
+    auto buffer = SharedMemoryBuffer::create(m_name, bufferSize);
+    ASSERT_NE(buffer, nullptr);
+    auto stream = SharedMemorySDS::create(buffer, WORD_SIZE, MAX_READERS);
+    ASSERT_NE(stream, nullptr);
+    // Create the reader first, so that a BLOCKING writer can not overrun it.
+    auto reader = stream->createReader(SharedMemorySDS::Reader::Policy::BLOCKING);
+    ASSERT_NE(reader, nullptr);
+
+    auto start = std::chrono::steady_clock::now();
+    pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if (0 == pid) {
+        _exit(runWriterProcess(m_name));
+    }
+
+    std::vector<uint16_t> frame(FRAME_WORDS);
+    size_t received = 0;
+    size_t mismatches = 0;
+    while (true) {
+        auto result = reader->read(frame.data(), FRAME_WORDS, READ_TIMEOUT);
+        if (result <= 0) {
+            ASSERT_EQ(result, SharedMemorySDS::Reader::Error::CLOSED);
+            break;
+        }
+        for (ssize_t i = 0; i < result; ++i) {
+            if (frame[i] != sampleAt(received + i)) {
+                ++mismatches;
+            }
+        }
+        received += result;
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_EQ(waitForChild(pid), CHILD_SUCCESS);
+    ASSERT_EQ(received, TOTAL_WORDS);
+    ASSERT_EQ(mismatches, 0u);
+
+    auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    ACSDK_INFO(LX("sharedMemorySdsThroughput")
+                   .d("words", received)
+                   .d("elapsedUs", elapsedUs)
+                   .d("wordsPerSecond", elapsedUs ? received * 1000000 / elapsedUs : 0));
+}
+
+/**
+ * Verify that a buffer constructed from a size holds a working stream, as one created by the SDK for its own use
+ * would, and that a failed mapping leaves the buffer empty.
+ */
+TEST_F(SharedMemorySDSTest, anonymousBufferHoldsStream) {
+    ASSERT_EQ(SharedMemoryBuffer(0).size(), 0u);
+
+    auto bufferSize = SharedMemorySDS::calculateBufferSize(BUFFER_WORDS, WORD_SIZE, MAX_READERS);
+    auto buffer = std::make_shared<SharedMemoryBuffer>(bufferSize);
+    ASSERT_EQ(buffer->size(), bufferSize);
+    ASSERT_TRUE(buffer->getName().empty());
+    auto stream = SharedMemorySDS::create(buffer, WORD_SIZE, MAX_READERS);
+    ASSERT_NE(stream, nullptr);
+    auto writer = stream->createWriter(SharedMemorySDS::Writer::Policy::NONBLOCKABLE);
+    auto reader = stream->createReader(SharedMemorySDS::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(writer, nullptr);
+    ASSERT_NE(reader, nullptr);
+
+    std::vector<uint16_t> frame(FRAME_WORDS);
+    for (size_t i = 0; i < FRAME_WORDS; ++i) {
+        frame[i] = sampleAt(i);
+    }
+    ASSERT_EQ(writer->write(frame.data(), FRAME_WORDS), static_cast<ssize_t>(FRAME_WORDS));
+    std::vector<uint16_t> received(FRAME_WORDS);
+    ASSERT_EQ(reader->read(received.data(), FRAME_WORDS), static_cast<ssize_t>(FRAME_WORDS));
+    ASSERT_EQ(received, frame);
+}
+
+/**
+ * Verify that a @c ProcessSharedMutex held by a process which dies can be locked by another process.
+ */
+TEST_F(SharedMemorySDSTest, mutexIsRecoveredWhenOwnerDies) {
+    auto buffer = SharedMemoryBuffer::create(m_name, sizeof(ProcessSharedMutex));
+    ASSERT_NE(buffer, nullptr);
+    auto mutex = new (buffer->data()) ProcessSharedMutex;
+
+    pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if (0 == pid) {
+        // Exit while holding the lock.
+        mutex->lock();
+        _exit(CHILD_SUCCESS);
+    }
+    ASSERT_EQ(waitForChild(pid), CHILD_SUCCESS);
+
+    ASSERT_TRUE(mutex->try_lock());
+    mutex->unlock();
+    {
+        std::lock_guard<ProcessSharedMutex> lock(*mutex);
+    }
+    mutex->~ProcessSharedMutex();
+}
+
+/**
+ * Verify that @c ProcessSharedMutex::lock() throws, rather than returning without the lock, when the mutex can not be
+ * recovered.
+ */
+TEST_F(SharedMemorySDSTest, lockThrowsWhenMutexIsNotRecoverable) {
+    ProcessSharedMutex mutex;
+    // Exit a thread while holding the lock, then unlock without marking the mutex consistent.
+    std::thread([&mutex] { pthread_mutex_lock(mutex.native_handle()); }).join();
+    ASSERT_EQ(pthread_mutex_lock(mutex.native_handle()), EOWNERDEAD);
+    ASSERT_EQ(pthread_mutex_unlock(mutex.native_handle()), 0);
+
+    ASSERT_THROW(mutex.lock(), std::system_error);
+    ASSERT_FALSE(mutex.try_lock());
+}
+
+/**
+ * Verify that a timed wait on a @c ProcessSharedConditionVariable times out, and that a notification from another
+ * process ends a wait.
+ */
+TEST_F(SharedMemorySDSTest, conditionVariableWorksAcrossProcesses) {
+    /// The objects placed in shared memory for this test.
+    struct Shared {
+        ProcessSharedMutex mutex;
+        ProcessSharedConditionVariable conditionVariable;
+        bool flag;
+    };
+    auto buffer = SharedMemoryBuffer::create(m_name, sizeof(Shared));
+    ASSERT_NE(buffer, nullptr);
+    auto shared = new (buffer->data()) Shared;
+    shared->flag = false;
+
+    {
+        std::unique_lock<ProcessSharedMutex> lock(shared->mutex);
+        ASSERT_FALSE(shared->conditionVariable.wait_for(
+            lock, std::chrono::milliseconds(10), [shared] { return shared->flag; }));
+    }
+
+    pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if (0 == pid) {
+        {
+            std::lock_guard<ProcessSharedMutex> lock(shared->mutex);
+            shared->flag = true;
+        }
+        shared->conditionVariable.notify_all();
+        _exit(CHILD_SUCCESS);
+    }
+    {
+        std::unique_lock<ProcessSharedMutex> lock(shared->mutex);
+        ASSERT_TRUE(shared->conditionVariable.wait_for(lock, READ_TIMEOUT, [shared] { return shared->flag; }));
+    }
+    ASSERT_EQ(waitForChild(pid), CHILD_SUCCESS);
+    shared->~Shared();
+}
+
+}  // namespace test
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // SHARED_MEMORY_SDS
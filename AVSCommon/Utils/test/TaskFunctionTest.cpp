@@ -0,0 +1,100 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <array>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Threading/TaskFunction.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+namespace test {
+
+/// A callable too large to be stored inline, which counts its calls.
+struct LargeCallable {
+    /// Increments the counter.
+    void operator()() {
+        ++*counter;
+    }
+
+    /// The counter to increment.
+    std::shared_ptr<int> counter;
+
+    /// Padding to make the callable larger than @c TaskFunction::INLINE_SIZE.
+    std::array<char, TaskFunction::INLINE_SIZE> padding;
+};
+
+static_assert(!TaskFunction::IsStoredInline<LargeCallable>::value, "LargeCallable should be stored on the heap");
+
+TEST(TaskFunctionTest, defaultConstructedIsEmpty) {
+    TaskFunction task;
+    ASSERT_FALSE(task);
+    TaskFunction nullTask(nullptr);
+    ASSERT_FALSE(nullTask);
+}
+
+TEST(TaskFunctionTest, smallCallableIsStoredInlineAndCalled) {
+    auto counter = std::make_shared<int>(0);
+    auto callable = [counter]() { ++*counter; };
+    static_assert(TaskFunction::IsStoredInline<decltype(callable)>::value, "a small lambda should be stored inline");
+
+    TaskFunction task(callable);
+    ASSERT_TRUE(task);
+    task();
+    task();
+    ASSERT_EQ(*counter, 2);
+}
+
+TEST(TaskFunctionTest, largeCallableIsCalled) {
+    auto counter = std::make_shared<int>(0);
+    TaskFunction task(LargeCallable{counter, {}});
+    ASSERT_TRUE(task);
+    task();
+    ASSERT_EQ(*counter, 1);
+}
+
+TEST(TaskFunctionTest, moveTransfersCallableAndReleasesIt) {
+    auto counter = std::make_shared<int>(0);
+    TaskFunction small([counter]() { ++*counter; });
+    TaskFunction large(LargeCallable{counter, {}});
+    ASSERT_EQ(counter.use_count(), 3);
+
+    TaskFunction movedSmall(std::move(small));
+    TaskFunction movedLarge;
+    movedLarge = std::move(large);
+    ASSERT_FALSE(small);
+    ASSERT_FALSE(large);
+    ASSERT_EQ(counter.use_count(), 3);
+
+    movedSmall();
+    movedLarge();
+    ASSERT_EQ(*counter, 2);
+
+    movedSmall = nullptr;
+    ASSERT_EQ(counter.use_count(), 2);
+    movedLarge = std::move(movedSmall);
+    ASSERT_FALSE(movedLarge);
+    ASSERT_EQ(counter.use_count(), 1);
+}
+
+}  // namespace test
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,211 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file TaskQueueBenchmarkTest.cpp
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <memory>
+#include <new>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Threading/Executor.h"
+#include "AVSCommon/Utils/Threading/TaskQueue.h"
+#include "AVSCommon/Utils/Timing/LatencyHistogram.h"
+
+/// The number of heap allocations made by this process so far.
+static std::atomic<size_t> g_allocationCount{0};
+
+void* operator new(std::size_t size) {
+    ++g_allocationCount;
+    void* memory = std::malloc(size ? size : 1);
+    if (!memory) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+namespace test {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("TaskQueueBenchmarkTest");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The number of tasks queued when counting allocations and measuring the cost of queueing.
+static const size_t COST_TASKS = 100000;
+
+/// The number of tasks queued when measuring submit-to-run latency.
+static const size_t LATENCY_TASKS = 2000;
+
+/// Long timeout for a submitted task to start running on the @c Executor (we should not reach this).
+static const std::chrono::milliseconds LONG_TIMEOUT(2000);
+
+/// An object which tasks capture, the way capability agents capture @c this.
+struct Target {
+    /// The number of times @c touch() was called.
+    size_t count = 0;
+
+    /// Called by the tasks.
+    void touch() {
+        ++count;
+    }
+};
+
+/// A task which records the time since it was submitted.
+struct LatencyTask {
+    /// Records the latency and signals that the task has run.
+    void operator()() {
+        latencies->record(std::chrono::steady_clock::now() - submitted);
+        ran->set_value();
+    }
+
+    /// Where to record the latency.
+    timing::LatencyHistogram* latencies;
+
+    /// Set once the task has run.
+    std::promise<void>* ran;
+
+    /// When the task was submitted.
+    std::chrono::steady_clock::time_point submitted;
+};
+
+/**
+ * Queue and run @c COST_TASKS tasks one at a time with @c queueTask, on a @c TaskQueue without a consumer thread, and
+ * return the number of heap allocations and the time taken per task.
+ *
+ * @param queueTask Queues a task capturing the given @c Target.
+ * @param[out] allocationsPerTask The number of heap allocations per task, in hundredths.
+ * @param[out] nsPerTask The time to queue, take and run each task.
+ */
+template <typename QueueTask>
+static void measureQueueCost(QueueTask queueTask, size_t* allocationsPerTask, size_t* nsPerTask) {
+    TaskQueue queue;
+    Target target;
+    TaskFunction task;
+
+    // Warm up, so that the queue's nodes are already allocated.
+    queueTask(&queue, &target);
+    ASSERT_TRUE(queue.tryPop(&task));
+    task();
+    task = nullptr;
+
+    auto allocationsBefore = g_allocationCount.load();
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < COST_TASKS; ++i) {
+        queueTask(&queue, &target);
+        queue.tryPop(&task);
+        task();
+        task = nullptr;
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    auto allocations = g_allocationCount.load() - allocationsBefore;
+
+    ASSERT_EQ(target.count, COST_TASKS + 1);
+    *allocationsPerTask = allocations * 100 / COST_TASKS;
+    *nsPerTask = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / COST_TASKS;
+}
+
+/**
+ * Submit @c LATENCY_TASKS tasks one at a time to an @c Executor with @c submitTask, and record the time from the
+ * start of each submission to the start of the task.
+ *
+ * @param submitTask Submits the given task to the given @c Executor.
+ * @param[out] latencies The latencies of the tasks.
+ */
+template <typename SubmitTask>
+static void measureSubmitToRunLatency(SubmitTask submitTask, timing::LatencyHistogram* latencies) {
+    Executor executor;
+    for (size_t i = 0; i < LATENCY_TASKS; ++i) {
+        std::promise<void> ran;
+        submitTask(&executor, LatencyTask{latencies, &ran, std::chrono::steady_clock::now()});
+        ASSERT_EQ(ran.get_future().wait_for(LONG_TIMEOUT), std::future_status::ready);
+    }
+}
+
+/**
+ * Compare the heap allocations and the time taken to queue, take and run a small task with @c push(), which creates a
+ * @c std::future, and with @c execute(), which does not.  Once the queue's nodes have been allocated, @c execute()
+ * must not allocate at all.
+ */
+TEST(TaskQueueBenchmarkTest, executeDoesNotAllocate) {
+    size_t pushAllocations = 0;
+    size_t pushNs = 0;
+    measureQueueCost(
+        [](TaskQueue* queue, Target* target) { queue->push([target] { target->touch(); }); },
+        &pushAllocations,
+        &pushNs);
+
+    size_t executeAllocations = 0;
+    size_t executeNs = 0;
+    measureQueueCost(
+        [](TaskQueue* queue, Target* target) { queue->execute([target] { target->touch(); }); },
+        &executeAllocations,
+        &executeNs);
+
+    ACSDK_INFO(LX("taskQueueCost")
+                   .d("pushAllocationsPer100Tasks", pushAllocations)
+                   .d("pushNsPerTask", pushNs)
+                   .d("executeAllocationsPer100Tasks", executeAllocations)
+                   .d("executeNsPerTask", executeNs));
+    ASSERT_EQ(executeAllocations, 0u);
+}
+
+/**
+ * Compare the time from submitting a task to an idle @c Executor until it starts to run, with @c submit() and with
+ * @c execute().
+ */
+TEST(TaskQueueBenchmarkTest, submitToRunLatency) {
+    timing::LatencyHistogram submitLatencies;
+    measureSubmitToRunLatency(
+        [](Executor* executor, LatencyTask task) { executor->submit(task); },
+        &submitLatencies);
+
+    timing::LatencyHistogram executeLatencies;
+    measureSubmitToRunLatency(
+        [](Executor* executor, LatencyTask task) { executor->execute(task); },
+        &executeLatencies);
+
+    ACSDK_INFO(LX("executorSubmitToRunLatency")
+                   .d("submitLatencies", submitLatencies.toString())
+                   .d("executeLatencies", executeLatencies.toString()));
+}
+
+}  // namespace test
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
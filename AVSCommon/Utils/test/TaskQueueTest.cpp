@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "ExecutorTestUtils.h"
@@ -277,6 +279,37 @@ TEST_F(TaskQueueTest, pushFailsToEnqueueANewTaskOnAShutdownQueue) {
     ASSERT_EQ(retrievedTask, nullptr);
 }
 
+TEST_F(TaskQueueTest, executeAndVerifyPopReturnsTasksInOrder) {
+    std::vector<int> order;
+    ASSERT_TRUE(queue.execute([&order]() { order.push_back(1); }));
+    ASSERT_TRUE(queue.execute([&order]() { order.push_back(2); }));
+    queue.pushToFront([&order]() { order.push_back(3); });
+
+    TaskFunction task;
+    while (queue.tryPop(&task)) {
+        task();
+    }
+    ASSERT_EQ(order, std::vector<int>({3, 1, 2}));
+    ASSERT_TRUE(queue.isEmpty());
+}
+
+TEST_F(TaskQueueTest, executeFailsToEnqueueANewTaskOnAShutdownQueue) {
+    queue.shutdown();
+    ASSERT_FALSE(queue.execute([]() {}));
+
+    TaskFunction task;
+    ASSERT_FALSE(queue.pop(&task));
+    ASSERT_FALSE(task);
+}
+
+TEST_F(TaskQueueTest, shutdownReleasesQueuedTasks) {
+    auto resource = std::make_shared<int>(VALUE);
+    ASSERT_TRUE(queue.execute([resource]() {}));
+    ASSERT_EQ(resource.use_count(), 2);
+    queue.shutdown();
+    ASSERT_EQ(resource.use_count(), 1);
+}
+
 }  // namespace test
 }  // namespace threading
 }  // namespace utils
@@ -0,0 +1,206 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <future>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Threading/Strand.h"
+#include "AVSCommon/Utils/Threading/ThreadPool.h"
+#include "ExecutorTestUtils.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+namespace test {
+
+/// Long timeout for jobs to run, and the stall timeout of pools which must not grow (we should not reach this).
+static const std::chrono::milliseconds LONG_TIMEOUT_MS(2000);
+
+/// An idle timeout short enough for a test to wait for.
+static const std::chrono::milliseconds TEST_IDLE_TIMEOUT_MS(20);
+
+/// A stall timeout short enough for a test to wait for.
+static const std::chrono::milliseconds TEST_STALL_TIMEOUT_MS(50);
+
+/// The number of jobs queued behind blocked workers in @c blockedWorkersDoNotStarveQueuedJobs.
+static const int QUEUED_JOB_COUNT = 10;
+
+/// The number of tasks each test strand runs.
+static const int TASKS_PER_STRAND = 100;
+
+/// The number of strands which share a pool in @c manyStrandsShareFewThreads.
+static const int STRAND_COUNT = 20;
+
+/**
+ * Releases the test's reference to a pool after the strands using it have been released, first waiting for the
+ * strands' last jobs to drop their references, so that the pool is not destroyed by one of its own workers.
+ *
+ * @param pool The pool to release.
+ */
+static void releasePool(std::shared_ptr<ThreadPool>& pool) {
+    while (pool.use_count() > 1) {
+        std::this_thread::yield();
+    }
+    pool.reset();
+}
+
+/**
+ * Verify that a submitted job runs.
+ */
+TEST(ThreadPoolTest, submittedJobRuns) {
+    ThreadPool pool;
+    std::promise<void> ran;
+    ASSERT_TRUE(pool.submit([&ran] { ran.set_value(); }));
+    ASSERT_EQ(ran.get_future().wait_for(LONG_TIMEOUT_MS), std::future_status::ready);
+    ASSERT_FALSE(pool.submit(nullptr));
+}
+
+/**
+ * Verify that the pool does not start more workers than its limit before the stall timeout, even when more jobs than
+ * that block at once.
+ */
+TEST(ThreadPoolTest, threadCountIsBounded) {
+    const size_t maxThreads = 2;
+    ThreadPool pool(maxThreads, ThreadPool::DEFAULT_IDLE_TIMEOUT, LONG_TIMEOUT_MS);
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<int> done{0};
+    for (int i = 0; i < 5; ++i) {
+        pool.submit([released, &done] {
+            released.wait();
+            ++done;
+        });
+    }
+    ASSERT_EQ(pool.getThreadCount(), maxThreads);
+    release.set_value();
+    auto deadline = std::chrono::steady_clock::now() + LONG_TIMEOUT_MS;
+    while (done < 5 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(SHORT_TIMEOUT_MS);
+    }
+    ASSERT_EQ(done.load(), 5);
+}
+
+/**
+ * Verify that jobs queued behind workers which are all blocked still run, on workers started beyond the limit once
+ * the stall timeout has passed, and that those workers exit again once they are idle.
+ */
+TEST(ThreadPoolTest, blockedWorkersDoNotStarveQueuedJobs) {
+    const size_t maxThreads = 2;
+    ThreadPool pool(maxThreads, TEST_IDLE_TIMEOUT_MS, TEST_STALL_TIMEOUT_MS);
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    for (size_t i = 0; i < maxThreads; ++i) {
+        pool.submit([released] { released.wait(); });
+    }
+    std::vector<std::promise<void>> queued(QUEUED_JOB_COUNT);
+    auto start = std::chrono::steady_clock::now();
+    for (auto& ran : queued) {
+        pool.submit([&ran] { ran.set_value(); });
+    }
+    for (auto& ran : queued) {
+        ASSERT_EQ(ran.get_future().wait_for(LONG_TIMEOUT_MS), std::future_status::ready);
+    }
+    ASSERT_GE(std::chrono::steady_clock::now() - start, TEST_STALL_TIMEOUT_MS);
+    ASSERT_GT(pool.getThreadCount(), maxThreads);
+
+    release.set_value();
+    auto deadline = std::chrono::steady_clock::now() + LONG_TIMEOUT_MS;
+    while (pool.getThreadCount() > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(TEST_IDLE_TIMEOUT_MS);
+    }
+    ASSERT_EQ(pool.getThreadCount(), 0u);
+}
+
+/**
+ * Verify that idle workers exit after the idle timeout.
+ */
+TEST(ThreadPoolTest, idleWorkersExit) {
+    ThreadPool pool(ThreadPool::DEFAULT_MAX_THREADS, TEST_IDLE_TIMEOUT_MS);
+    std::promise<void> ran;
+    pool.submit([&ran] { ran.set_value(); });
+    ASSERT_EQ(ran.get_future().wait_for(LONG_TIMEOUT_MS), std::future_status::ready);
+    auto deadline = std::chrono::steady_clock::now() + LONG_TIMEOUT_MS;
+    while (pool.getThreadCount() > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(TEST_IDLE_TIMEOUT_MS);
+    }
+    ASSERT_EQ(pool.getThreadCount(), 0u);
+}
+
+/**
+ * Verify that many strands run their tasks in order, one at a time each, on a pool with fewer threads than strands.
+ */
+TEST(ThreadPoolTest, manyStrandsShareFewThreads) {
+    const size_t maxThreads = 4;
+    auto pool = std::make_shared<ThreadPool>(maxThreads);
+    std::vector<std::shared_ptr<TaskQueue>> queues;
+    std::vector<std::shared_ptr<Strand>> strands;
+    std::vector<std::vector<int>> results(STRAND_COUNT);
+    std::vector<std::future<void>> lastTasks;
+    for (int s = 0; s < STRAND_COUNT; ++s) {
+        queues.push_back(std::make_shared<TaskQueue>());
+        strands.push_back(Strand::create(queues.back(), pool));
+        ASSERT_NE(strands.back(), nullptr);
+    }
+    for (int i = 0; i < TASKS_PER_STRAND; ++i) {
+        for (int s = 0; s < STRAND_COUNT; ++s) {
+            auto future = queues[s]->push([&results, s, i] { results[s].push_back(i); });
+            strands[s]->notifyTaskQueued();
+            if (TASKS_PER_STRAND - 1 == i) {
+                lastTasks.push_back(std::move(future));
+            }
+        }
+        ASSERT_LE(pool->getThreadCount(), maxThreads);
+    }
+    for (auto& future : lastTasks) {
+        ASSERT_EQ(future.wait_for(LONG_TIMEOUT_MS), std::future_status::ready);
+    }
+    for (int s = 0; s < STRAND_COUNT; ++s) {
+        ASSERT_EQ(results[s].size(), static_cast<size_t>(TASKS_PER_STRAND));
+        for (int i = 0; i < TASKS_PER_STRAND; ++i) {
+            ASSERT_EQ(results[s][i], i);
+        }
+        queues[s]->shutdown();
+        strands[s]->waitForRunningTask();
+    }
+    strands.clear();
+    releasePool(pool);
+}
+
+/**
+ * Verify that @c waitForRunningTask() returns without waiting when called from the strand's own task.
+ */
+TEST(ThreadPoolTest, waitForRunningTaskFromTaskDoesNotDeadlock) {
+    auto pool = std::make_shared<ThreadPool>();
+    auto queue = std::make_shared<TaskQueue>();
+    auto strand = Strand::create(queue, pool);
+    ASSERT_NE(strand, nullptr);
+    auto future = queue->push([strand] { strand->waitForRunningTask(); });
+    strand->notifyTaskQueued();
+    ASSERT_EQ(future.wait_for(LONG_TIMEOUT_MS), std::future_status::ready);
+    queue->shutdown();
+    strand->waitForRunningTask();
+    strand.reset();
+    releasePool(pool);
+}
+
+}  // namespace test
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,122 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file WakeupPipeTest.cpp
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/LibcurlUtils/CurlMultiHandleWrapper.h"
+#include "AVSCommon/Utils/LibcurlUtils/WakeupPipe.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+namespace test {
+
+/// A timeout long enough that a pending wake-up is always seen.
+static const std::chrono::milliseconds LONG_TIMEOUT(2000);
+
+/// A timeout short enough to keep tests that expect no wake-up fast.
+static const std::chrono::milliseconds SHORT_TIMEOUT(10);
+
+/// The number of times to call @c wake() when testing that wake-ups are coalesced.
+static const int NUM_WAKES = 100;
+
+/// Test harness for @c WakeupPipe.
+class WakeupPipeTest : public ::testing::Test {
+public:
+    void SetUp() override;
+
+    /// The pipe under test.
+    std::shared_ptr<WakeupPipe> m_pipe;
+};
+
+void WakeupPipeTest::SetUp() {
+    m_pipe = WakeupPipe::create();
+    ASSERT_NE(m_pipe, nullptr);
+}
+
+/**
+ * Verify that waiting without a wake-up times out.
+ */
+TEST_F(WakeupPipeTest, waitTimesOutWithoutWake) {
+    ASSERT_FALSE(m_pipe->waitForWake(SHORT_TIMEOUT));
+    ASSERT_FALSE(m_pipe->consume());
+}
+
+/**
+ * Verify that a wake-up is seen by @c waitForWake() and is cleared by @c consume().
+ */
+TEST_F(WakeupPipeTest, wakeIsSeenAndConsumed) {
+    m_pipe->wake();
+    ASSERT_TRUE(m_pipe->waitForWake(LONG_TIMEOUT));
+    // waitForWake() does not consume the wake-up.
+    ASSERT_TRUE(m_pipe->waitForWake(SHORT_TIMEOUT));
+    ASSERT_TRUE(m_pipe->consume());
+    ASSERT_FALSE(m_pipe->consume());
+    ASSERT_FALSE(m_pipe->waitForWake(SHORT_TIMEOUT));
+}
+
+/**
+ * Verify that many wake-ups before a @c consume() are coalesced into one.
+ */
+TEST_F(WakeupPipeTest, wakesAreCoalesced) {
+    for (int i = 0; i < NUM_WAKES; ++i) {
+        m_pipe->wake();
+    }
+    ASSERT_TRUE(m_pipe->consume());
+    ASSERT_FALSE(m_pipe->waitForWake(SHORT_TIMEOUT));
+    ASSERT_FALSE(m_pipe->consume());
+}
+
+/**
+ * Verify that a wake-up from another thread ends a wait.
+ */
+TEST_F(WakeupPipeTest, wakeFromAnotherThread) {
+    std::thread waker([this] {
+        std::this_thread::sleep_for(SHORT_TIMEOUT);
+        m_pipe->wake();
+    });
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(m_pipe->waitForWake(LONG_TIMEOUT));
+    ASSERT_LT(std::chrono::steady_clock::now() - start, LONG_TIMEOUT);
+    waker.join();
+    ASSERT_TRUE(m_pipe->consume());
+}
+
+/**
+ * Verify that a wake-up ends a wait on a @c CurlMultiHandleWrapper without being counted as transfer activity.
+ */
+TEST_F(WakeupPipeTest, wakeEndsCurlWaitWithoutCountingAsActivity) {
+    auto multi = CurlMultiHandleWrapper::create();
+    ASSERT_NE(multi, nullptr);
+    m_pipe->wake();
+    int numTransfersUpdated = -1;
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_EQ(multi->wait(LONG_TIMEOUT, &numTransfersUpdated, m_pipe->getReadFd()), CURLM_OK);
+    ASSERT_LT(std::chrono::steady_clock::now() - start, LONG_TIMEOUT);
+    ASSERT_EQ(numTransfersUpdated, 0);
+    ASSERT_TRUE(m_pipe->consume());
+}
+
+}  // namespace test
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
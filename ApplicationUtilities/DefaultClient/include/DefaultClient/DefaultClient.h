@@ -24,6 +24,7 @@
 #include <AFML/AudioActivityTracker.h>
 #include <AFML/FocusManager.h>
 #include <AFML/VisualActivityTracker.h>
+#include <AIP/AudioEncoderInterface.h>
 #include <AIP/AudioInputProcessor.h>
 #include <AIP/AudioProvider.h>
 #include <Alerts/AlertsCapabilityAgent.h>
@@ -107,6 +108,8 @@ public:
      * @param firmwareVersion The firmware version to report to @c AVS or @c INVALID_FIRMWARE_VERSION.
      * @param sendSoftwareInfoOnConnected Whether to send SoftwareInfo upon connecting to @c AVS.
      * @param softwareInfoSenderObserver Object to receive notifications about sending SoftwareInfo.
+     * @param audioEncoder An encoder to compress the PCM audio of Recognize events before it is sent, such as an
+     * @c OpusAudioEncoder, or @c nullptr to send the audio as it is captured.
      * @return A @c std::unique_ptr to a DefaultClient if all went well or @c nullptr otherwise.
      *
      * TODO: Allow the user to pass in a MediaPlayer factory rather than each media player individually.
@@ -144,7 +147,8 @@ public:
             avsCommon::sdkInterfaces::softwareInfo::INVALID_FIRMWARE_VERSION,
         bool sendSoftwareInfoOnConnected = false,
         std::shared_ptr<avsCommon::sdkInterfaces::SoftwareInfoSenderObserverInterface> softwareInfoSenderObserver =
-            nullptr);
+            nullptr,
+        std::shared_ptr<capabilityAgents::aip::AudioEncoderInterface> audioEncoder = nullptr);
 
     /// @name DCFObserverInterface Methods
     /// @{
@@ -390,6 +394,21 @@ public:
         const capabilityAgents::aip::ESPData& espData = capabilityAgents::aip::ESPData::EMPTY_ESP_DATA,
         std::shared_ptr<const std::vector<char>> KWDMetadata = nullptr);
 
+    /**
+     * Lets the client prepare a wake word initiated Alexa interaction, when the wake word engine has heard what may
+     * be a keyword but has not yet confirmed it.  The context for the Recognize event is gathered and the event is
+     * assembled ahead of @c notifyOfWakeWord(), so that less work is left once the keyword is confirmed.
+     *
+     * @param keyword The keyword which may have been heard.
+     */
+    void notifyOfKeyWordCandidate(const std::string& keyword = "");
+
+    /**
+     * Discards the preparation started by @c notifyOfKeyWordCandidate(), when the wake word engine rejects the
+     * candidate.
+     */
+    void notifyOfKeyWordRejected();
+
     /**
      * Begins a tap to talk initiated Alexa interaction. Note that this can also be used for wake word engines that
      * don't support providing both a begin and end index.
@@ -482,6 +501,8 @@ private:
      * @param firmwareVersion The firmware version to report to @c AVS or @c INVALID_FIRMWARE_VERSION.
      * @param sendSoftwareInfoOnConnected Whether to send SoftwareInfo upon connecting to @c AVS.
      * @param softwareInfoSenderObserver Object to receive notifications about sending SoftwareInfo.
+     * @param audioEncoder An encoder to compress the PCM audio of Recognize events before it is sent, such as an
+     * @c OpusAudioEncoder, or @c nullptr to send the audio as it is captured.
      * @return Whether the SDK was initialized properly.
      */
     bool initialize(
@@ -515,7 +536,8 @@ private:
         std::shared_ptr<avsCommon::sdkInterfaces::DCFDelegateInterface> dcfDelegate,
         avsCommon::sdkInterfaces::softwareInfo::FirmwareVersion firmwareVersion,
         bool sendSoftwareInfoOnConnected,
-        std::shared_ptr<avsCommon::sdkInterfaces::SoftwareInfoSenderObserverInterface> softwareInfoSenderObserver);
+        std::shared_ptr<avsCommon::sdkInterfaces::SoftwareInfoSenderObserverInterface> softwareInfoSenderObserver,
+        std::shared_ptr<capabilityAgents::aip::AudioEncoderInterface> audioEncoder);
 
     /// The directive sequencer.
     std::shared_ptr<avsCommon::sdkInterfaces::DirectiveSequencerInterface> m_directiveSequencer;
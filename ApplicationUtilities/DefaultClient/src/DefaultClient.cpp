@@ -78,7 +78,8 @@ std::unique_ptr<DefaultClient> DefaultClient::create(
     std::shared_ptr<avsCommon::sdkInterfaces::DCFDelegateInterface> dcfDelegate,
     avsCommon::sdkInterfaces::softwareInfo::FirmwareVersion firmwareVersion,
     bool sendSoftwareInfoOnConnected,
-    std::shared_ptr<avsCommon::sdkInterfaces::SoftwareInfoSenderObserverInterface> softwareInfoSenderObserver) {
+    std::shared_ptr<avsCommon::sdkInterfaces::SoftwareInfoSenderObserverInterface> softwareInfoSenderObserver,
+    std::shared_ptr<capabilityAgents::aip::AudioEncoderInterface> audioEncoder) {
     std::unique_ptr<DefaultClient> defaultClient(new DefaultClient());
     if (!defaultClient->initialize(
             customerDataManager,
@@ -108,7 +109,8 @@ std::unique_ptr<DefaultClient> DefaultClient::create(
             dcfDelegate,
             firmwareVersion,
             sendSoftwareInfoOnConnected,
-            softwareInfoSenderObserver)) {
+            softwareInfoSenderObserver,
+            audioEncoder)) {
         return nullptr;
     }
 
@@ -146,7 +148,8 @@ bool DefaultClient::initialize(
     std::shared_ptr<avsCommon::sdkInterfaces::DCFDelegateInterface> dcfDelegate,
     avsCommon::sdkInterfaces::softwareInfo::FirmwareVersion firmwareVersion,
     bool sendSoftwareInfoOnConnected,
-    std::shared_ptr<avsCommon::sdkInterfaces::SoftwareInfoSenderObserverInterface> softwareInfoSenderObserver) {
+    std::shared_ptr<avsCommon::sdkInterfaces::SoftwareInfoSenderObserverInterface> softwareInfoSenderObserver,
+    std::shared_ptr<capabilityAgents::aip::AudioEncoderInterface> audioEncoder) {
     if (!audioFactory) {
         ACSDK_ERROR(LX("initializeFailed").d("reason", "nullAudioFactory"));
         return false;
@@ -333,7 +336,9 @@ bool DefaultClient::initialize(
         m_audioFocusManager,
         m_dialogUXStateAggregator,
         m_exceptionSender,
-        m_userInactivityMonitor);
+        m_userInactivityMonitor,
+        capabilityAgents::aip::AudioProvider::null(),
+        audioEncoder);
     if (!m_audioInputProcessor) {
         ACSDK_ERROR(LX("initializeFailed").d("reason", "unableToCreateAudioInputProcessor"));
         return false;
@@ -920,6 +925,14 @@ std::future<bool> DefaultClient::notifyOfWakeWord(
         KWDMetadata);
 }
 
+void DefaultClient::notifyOfKeyWordCandidate(const std::string& keyword) {
+    m_audioInputProcessor->prepareRecognize(keyword);
+}
+
+void DefaultClient::notifyOfKeyWordRejected() {
+    m_audioInputProcessor->cancelPreparedRecognize();
+}
+
 std::future<bool> DefaultClient::notifyOfTapToTalk(
     capabilityAgents::aip::AudioProvider tapToTalkAudioProvider,
     avsCommon::avs::AudioInputStream::Index beginIndex) {
@@ -0,0 +1,153 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_CAPABILITYAGENTS_AIP_INCLUDE_AIP_AUDIOENCODER_H_
+#define ALEXA_CLIENT_SDK_CAPABILITYAGENTS_AIP_INCLUDE_AIP_AUDIOENCODER_H_
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <AVSCommon/AVS/AudioInputStream.h>
+#include <AVSCommon/Utils/AudioFormat.h>
+
+#include "AudioEncoderInterface.h"
+
+namespace alexaClientSDK {
+namespace capabilityAgents {
+namespace aip {
+
+/**
+ * A pipeline stage which reads PCM audio from an @c AudioInputStream, encodes it with an @c AudioEncoderInterface on
+ * a dedicated thread, and writes the encoded frames to a second @c AudioInputStream, which can be streamed in place of
+ * the PCM audio.  Each frame is encoded as soon as all of its samples are available, so the encoded stream lags the
+ * PCM stream by at most one frame.
+ *
+ * This class is not thread-safe; @c startEncoding() and @c stopEncoding() must be called from one thread at a time.
+ */
+class AudioEncoder {
+public:
+    /// The duration of encoded audio which the encoded stream can hold before its oldest frames are overwritten.
+    static const std::chrono::seconds ENCODED_BUFFER_DURATION;
+
+    /**
+     * Creates a new @c AudioEncoder.
+     *
+     * @param encoder The codec to encode with.
+     * @return The new @c AudioEncoder, or @c nullptr if @c encoder is @c nullptr.
+     */
+    static std::unique_ptr<AudioEncoder> create(std::shared_ptr<AudioEncoderInterface> encoder);
+
+    /**
+     * Destructor.  Stops any encoding in progress immediately.
+     */
+    ~AudioEncoder();
+
+    /**
+     * Starts encoding the audio in @c input from the given position, stopping any encoding in progress first.  If the
+     * previous encoding is being drained after @c stopEncoding(false), this waits for the drain to finish, so that
+     * the end of the previous audio is not cut off.
+     *
+     * @param input The stream of PCM audio to encode.
+     * @param inputFormat The format of @c input.
+     * @param offset The position in @c input to start encoding from, relative to @c reference.
+     * @param reference The reference point for @c offset.
+     * @return A new stream which receives the encoded frames, or @c nullptr if the encoding could not be started.
+     */
+    std::shared_ptr<avsCommon::avs::AudioInputStream> startEncoding(
+        std::shared_ptr<avsCommon::avs::AudioInputStream> input,
+        const avsCommon::utils::AudioFormat& inputFormat,
+        avsCommon::avs::AudioInputStream::Index offset,
+        avsCommon::avs::AudioInputStream::Reader::Reference reference);
+
+    /**
+     * Stops encoding.  Once the encoding has stopped, the encoded stream is closed, so that its readers reach its end.
+     *
+     * @param stopImmediately If @c true, the audio which has not been encoded yet is discarded and this function
+     *     waits for the encoding thread to exit.  If @c false, the audio already written to the input stream is
+     *     encoded, with the last frame padded with silence, before the encoded stream is closed; this function does
+     *     not wait for that.
+     */
+    void stopEncoding(bool stopImmediately);
+
+    /**
+     * Returns the name of the encoded format, as given in the format field of a Recognize event.
+     *
+     * @return The name of the encoded format.
+     */
+    std::string getAVSFormatName() const;
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param encoder The codec to encode with.
+     */
+    AudioEncoder(std::shared_ptr<AudioEncoderInterface> encoder);
+
+    /**
+     * The body of the encoding thread, which encodes frames from @c m_reader into @c m_writer until @c m_reader is
+     * closed, then closes @c m_writer.
+     */
+    void encodeLoop();
+
+    /**
+     * Encodes @c m_inputFrame and writes the result to @c m_writer.
+     *
+     * @return @c true if the frame was encoded and written, else @c false.
+     */
+    bool encodeFrame();
+
+    /**
+     * Waits for the encoding thread to exit.
+     *
+     * @param stopImmediately Whether to make the thread exit without encoding the audio which is left.  This should
+     *     only be @c false once @c m_reader has been closed, or the thread may not exit.
+     */
+    void stopThread(bool stopImmediately);
+
+    /// The codec to encode with.
+    std::shared_ptr<AudioEncoderInterface> m_encoder;
+
+    /// The reader of the PCM stream, used by the encoding thread.
+    std::unique_ptr<avsCommon::avs::AudioInputStream::Reader> m_reader;
+
+    /// The writer of the encoded stream, used by the encoding thread.
+    std::unique_ptr<avsCommon::avs::AudioInputStream::Writer> m_writer;
+
+    /// The samples of the frame being gathered.
+    std::vector<int16_t> m_inputFrame;
+
+    /// The encoded frame.
+    std::vector<uint8_t> m_outputFrame;
+
+    /// Set to make the encoding thread exit without encoding the audio which is left.
+    std::atomic<bool> m_stopImmediately;
+
+    /// Whether @c m_reader has been closed by @c stopEncoding(false), so that the encoding thread exits on its own.
+    bool m_isDraining;
+
+    /// The encoding thread.
+    std::thread m_thread;
+};
+
+}  // namespace aip
+}  // namespace capabilityAgents
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_CAPABILITYAGENTS_AIP_INCLUDE_AIP_AUDIOENCODER_H_
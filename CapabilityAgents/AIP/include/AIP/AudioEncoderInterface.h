@@ -0,0 +1,85 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_CAPABILITYAGENTS_AIP_INCLUDE_AIP_AUDIOENCODERINTERFACE_H_
+#define ALEXA_CLIENT_SDK_CAPABILITYAGENTS_AIP_INCLUDE_AIP_AUDIOENCODERINTERFACE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <sys/types.h>
+
+#include <AVSCommon/Utils/AudioFormat.h>
+
+namespace alexaClientSDK {
+namespace capabilityAgents {
+namespace aip {
+
+/**
+ * An interface to a codec which encodes 16-bit PCM audio one frame at a time, for use by @c AudioEncoder.
+ *
+ * The functions of this interface are only called from one thread at a time.
+ */
+class AudioEncoderInterface {
+public:
+    /**
+     * Destructor.
+     */
+    virtual ~AudioEncoderInterface() = default;
+
+    /**
+     * Prepares the codec to encode a new stream, discarding any state left from the previous one.
+     *
+     * @param inputFormat The format of the PCM audio which will be encoded.
+     * @return @c true if the codec can encode audio in this format, else @c false.
+     */
+    virtual bool init(const avsCommon::utils::AudioFormat& inputFormat) = 0;
+
+    /**
+     * Returns the number of samples in each frame passed to @c encode().
+     *
+     * @return The number of samples in each frame.
+     */
+    virtual size_t getInputFrameSize() const = 0;
+
+    /**
+     * Returns the largest number of bytes @c encode() writes for one frame.
+     *
+     * @return The largest encoded frame size, in bytes.
+     */
+    virtual size_t getMaxOutputFrameSize() const = 0;
+
+    /**
+     * Encodes one frame.
+     *
+     * @param input @c getInputFrameSize() samples to encode.
+     * @param[out] output A buffer of at least @c getMaxOutputFrameSize() bytes which receives the encoded frame.
+     * @return The number of bytes written to @c output, or a negative value if the frame could not be encoded.
+     */
+    virtual ssize_t encode(const int16_t* input, uint8_t* output) = 0;
+
+    /**
+     * Returns the name of the encoded format, as given in the format field of a Recognize event.
+     *
+     * @return The name of the encoded format.
+     */
+    virtual std::string getAVSFormatName() const = 0;
+};
+
+}  // namespace aip
+}  // namespace capabilityAgents
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_CAPABILITYAGENTS_AIP_INCLUDE_AIP_AUDIOENCODERINTERFACE_H_
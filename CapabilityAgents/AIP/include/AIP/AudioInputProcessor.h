@@ -16,6 +16,7 @@
 #ifndef ALEXA_CLIENT_SDK_CAPABILITYAGENTS_AIP_INCLUDE_AIP_AUDIOINPUTPROCESSOR_H_
 #define ALEXA_CLIENT_SDK_CAPABILITYAGENTS_AIP_INCLUDE_AIP_AUDIOINPUTPROCESSOR_H_
 
+#include <chrono>
 #include <memory>
 #include <unordered_set>
 #include <vector>
@@ -39,6 +40,8 @@
 #include <AVSCommon/Utils/RequiresShutdown.h>
 #include <AVSCommon/Utils/Threading/Executor.h>
 #include <AVSCommon/Utils/Timing/Timer.h>
+#include "AudioEncoder.h"
+#include "AudioEncoderInterface.h"
 #include "AudioProvider.h"
 #include "ESPData.h"
 #include "Initiator.h"
@@ -73,6 +76,9 @@ public:
     /// A reserved @c Index value which is considered invalid.
     static const auto INVALID_INDEX = std::numeric_limits<avsCommon::avs::AudioInputStream::Index>::max();
 
+    /// How long after @c prepareRecognize() a call to @c recognize() may use the context it gathered.
+    static const std::chrono::milliseconds PREPARED_CONTEXT_TIMEOUT;
+
     /**
      * Creates a new @c AudioInputProcessor instance.
      *
@@ -86,6 +92,9 @@ public:
      * @param defaultAudioProvider A default @c avsCommon::AudioProvider to use for ExpectSpeech if the previous
      *     provider is not readable (@c avsCommon::AudioProvider::alwaysReadable).  This parameter is optional and
      *     defaults to an invalid @c avsCommon::AudioProvider.
+     * @param audioEncoder An encoder for the audio of Recognize events.  If this is given, PCM audio is encoded with it
+     *     before it is streamed, which reduces the upload size; audio which is already encoded is streamed as it is.
+     *     This parameter is optional and defaults to @c nullptr, which streams PCM audio as it is.
      * @return A @c std::shared_ptr to the new @c AudioInputProcessor instance.
      */
     static std::shared_ptr<AudioInputProcessor> create(
@@ -96,7 +105,8 @@ public:
         std::shared_ptr<avsCommon::avs::DialogUXStateAggregator> dialogUXStateAggregator,
         std::shared_ptr<avsCommon::sdkInterfaces::ExceptionEncounteredSenderInterface> exceptionEncounteredSender,
         std::shared_ptr<avsCommon::sdkInterfaces::UserActivityNotifierInterface> userActivityNotifier,
-        AudioProvider defaultAudioProvider = AudioProvider::null());
+        AudioProvider defaultAudioProvider = AudioProvider::null(),
+        std::shared_ptr<AudioEncoderInterface> audioEncoder = nullptr);
 
     /**
      * Adds an observer to be notified of AudioInputProcessor state changes.
@@ -166,6 +176,30 @@ public:
         const ESPData& espData = ESPData::EMPTY_ESP_DATA,
         std::shared_ptr<const std::vector<char>> KWDMetadata = nullptr);
 
+    /**
+     * This function asks the @c AudioInputProcessor to start gathering the context for a Recognize Event which is
+     * likely to follow, for example when a wake word engine reports a keyword candidate before it has verified the
+     * keyword.  Once the context arrives, the Recognize Event is assembled up to its payload.  If @c recognize() is
+     * called within @c PREPARED_CONTEXT_TIMEOUT, it only has to add the payload to that event rather than requesting a
+     * new context, which takes the context request and most of the event building out of the time between the end of
+     * the keyword and the start of streaming.  The context is discarded if it is not used in time, if the wakeword in
+     * the RecognizerState changes, or if @c cancelPreparedRecognize() or @c resetState() is called.
+     *
+     * @note The prepared context reflects the state of the device when this function was called, so it should only be
+     *     called when a Recognize Event is expected shortly afterwards.
+     *
+     * @param keyword The keyword the wake word engine may have heard, or empty for a Recognize Event without one.  A
+     *     new keyword becomes the wakeword of the RecognizerState before the context is gathered, so that the context
+     *     is not discarded when @c recognize() is called with the same keyword.
+     */
+    void prepareRecognize(const std::string& keyword = "");
+
+    /**
+     * This function discards any context gathered by @c prepareRecognize(), for example when a wake word engine
+     * rejects a keyword candidate.  A context request which is still in progress is ignored when it completes.
+     */
+    void cancelPreparedRecognize();
+
     /**
      * This function asks the @c AudioInputProcessor to stop streaming audio and end an ongoing Recognize Event, which
      * transitions it to the @c BUSY state.  This function can only be called in the @c RECOGNIZING state; calling it
@@ -229,6 +263,49 @@ public:
     /// @}
 
 private:
+    /// The type of reader which sends an @c AudioInputStream as the attachment of a Recognize event.
+    using AudioAttachmentReader = avsCommon::avs::attachment::SDSAttachmentReader<avsCommon::avs::AudioInputStream>;
+
+    /**
+     * Receives the context requested by @c prepareRecognize(), and passes it on to the @c AudioInputProcessor along
+     * with the preparation it belongs to, so that a context which arrives after its preparation was discarded can be
+     * ignored.
+     */
+    class PreparedContextRequester : public avsCommon::sdkInterfaces::ContextRequesterInterface {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param audioInputProcessor The @c AudioInputProcessor which requested the context.
+         * @param preparationId The @c m_preparationId of the preparation which requested the context.
+         */
+        PreparedContextRequester(std::weak_ptr<AudioInputProcessor> audioInputProcessor, unsigned int preparationId);
+
+        /// @name ContextRequesterInterface Functions
+        /// @{
+        void onContextAvailable(const std::string& jsonContext) override;
+        void onContextFailure(const avsCommon::sdkInterfaces::ContextRequestError error) override;
+        /// @}
+
+    private:
+        /// The @c AudioInputProcessor which requested the context.
+        std::weak_ptr<AudioInputProcessor> m_audioInputProcessor;
+
+        /// The preparation which requested the context.
+        const unsigned int m_preparationId;
+    };
+
+    /// The progress of the context requested by @c prepareRecognize().
+    enum class PreparationState {
+        /// There is no prepared context.
+        NONE,
+        /// The context has been requested, but has not arrived yet.
+        REQUESTING_CONTEXT,
+        /// The context has arrived, and the Recognize event has been assembled up to its payload in
+        /// @c m_preparedEventPrefix.
+        EVENT_PREPARED
+    };
+
     /**
      * Constructor.
      *
@@ -241,6 +318,7 @@ private:
      * @param defaultAudioProvider A default @c avsCommon::AudioProvider to use for ExpectSpeech if the previous
      *     provider is not readable (@c AudioProvider::alwaysReadable).  This parameter is optional, and ignored if set
      *     to @c AudioProvider::null().
+     * @param audioEncoder An encoder for the audio of Recognize events, or @c nullptr to stream PCM audio as it is.
      *
      * @note This constructor is private so that users are forced to use the @c create() factory function.  The primary
      *     reason for this is to ensure that a @c std::shared_ptr to the instance exists, which is a requirement for
@@ -253,7 +331,8 @@ private:
         std::shared_ptr<avsCommon::sdkInterfaces::FocusManagerInterface> focusManager,
         std::shared_ptr<avsCommon::sdkInterfaces::ExceptionEncounteredSenderInterface> exceptionEncounteredSender,
         std::shared_ptr<avsCommon::sdkInterfaces::UserActivityNotifierInterface> userActivityNotifier,
-        AudioProvider defaultAudioProvider);
+        AudioProvider defaultAudioProvider,
+        std::shared_ptr<AudioEncoderInterface> audioEncoder);
 
     /// @name RequiresShutdown Functions
     /// @{
@@ -379,6 +458,50 @@ private:
      */
     void executeOnContextFailure(const avsCommon::sdkInterfaces::ContextRequestError error);
 
+    /**
+     * This function assembles and sends the Recognize event once everything but its payload is known.  It is called
+     * when the context arrives, or by @c executeRecognize() with an event prepared by @c executePrepareRecognize().
+     *
+     * @param dialogRequestId The dialogRequestId of the Recognize event, which becomes current here.
+     * @param eventPrefix The Recognize event up to its payload, as built by @c buildJsonEventPrefix().
+     */
+    void executeOnRecognizeEventPrefixAvailable(const std::string& dialogRequestId, const std::string& eventPrefix);
+
+    /**
+     * This function starts gathering the context for a Recognize event which is likely to follow.  Any earlier
+     * preparation is discarded first.
+     *
+     * @param keyword The keyword which may have been heard, or empty if there is none.
+     */
+    void executePrepareRecognize(const std::string& keyword);
+
+    /**
+     * This function is called when the context requested by @c executePrepareRecognize() arrives.  If a Recognize is
+     * already waiting for it, the context is passed on to @c executeOnContextAvailable(); otherwise the Recognize event
+     * is assembled up to its payload and kept for the next @c executeRecognize().
+     *
+     * @param preparationId The preparation which requested the context.
+     * @param jsonContext The full system context.
+     */
+    void executeOnPreparedContextAvailable(unsigned int preparationId, const std::string& jsonContext);
+
+    /**
+     * This function is called when the context request made by @c executePrepareRecognize() fails.  The preparation
+     * is discarded, and if a Recognize is already waiting for it, a new context is requested for that Recognize.
+     *
+     * @param preparationId The preparation which requested the context.
+     * @param error The reason the context request failed to complete.
+     */
+    void executeOnPreparedContextFailure(
+        unsigned int preparationId,
+        const avsCommon::sdkInterfaces::ContextRequestError error);
+
+    /**
+     * This function discards the preparation made by @c executePrepareRecognize(), if any.  A context which arrives
+     * for it afterwards is ignored.
+     */
+    void executeCancelPreparedRecognize();
+
     /**
      * This function is called when the @c FocusManager focus changes.  This might occur when another component
      * acquires focus on the dialog channel, in which case the @c AudioInputProcessor will end any activity and return
@@ -521,7 +644,7 @@ private:
      * valid during the @c RECOGNIZING state, and is retained by @c AudioInputProcessor so that it can close the
      * stream from @c executeStopCapture().
      */
-    std::shared_ptr<avsCommon::avs::attachment::InProcessAttachmentReader> m_reader;
+    std::shared_ptr<AudioAttachmentReader> m_reader;
 
     /**
      * The attachment reader used for the wake word engine metadata. It's is populated by a call to @c
@@ -601,6 +724,30 @@ private:
      * initiator should conform to the standard user initiated format.
      */
     std::unique_ptr<std::string> m_precedingExpectSpeechInitiator;
+
+    /// The progress of the context requested by @c executePrepareRecognize().
+    PreparationState m_preparationState;
+
+    /// Identifies the current preparation.  Incremented whenever a preparation is started, used or discarded.
+    unsigned int m_preparationId;
+
+    /// When the current preparation was started.
+    std::chrono::steady_clock::time_point m_preparationTime;
+
+    /// The dialogRequestId of the Recognize event assembled by the current preparation.
+    std::string m_preparedDialogRequestId;
+
+    /// The Recognize event assembled up to its payload by the current preparation, once the context has arrived.
+    std::string m_preparedEventPrefix;
+
+    /// This flag is set to @c true when a Recognize event is waiting for the context of the current preparation.
+    bool m_waitingForPreparedContext;
+
+    /// Encodes the PCM audio of Recognize events, or @c nullptr if they stream PCM audio.
+    std::unique_ptr<AudioEncoder> m_audioEncoder;
+
+    /// This flag is set to @c true while @c m_reader reads the audio encoded by @c m_audioEncoder.
+    bool m_encodingAudio;
     /// @}
 
     /// Set of capability configurations that will get published using DCF
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_CAPABILITYAGENTS_AIP_INCLUDE_AIP_OPUSAUDIOENCODER_H_
+#define ALEXA_CLIENT_SDK_CAPABILITYAGENTS_AIP_INCLUDE_AIP_OPUSAUDIOENCODER_H_
+
+#include <memory>
+
+#include "AudioEncoderInterface.h"
+
+/// The libopus encoder state, declared here so that users of this header do not need the libopus headers.
+struct OpusEncoder;
+
+namespace alexaClientSDK {
+namespace capabilityAgents {
+namespace aip {
+
+/**
+ * An @c AudioEncoderInterface which encodes 16 kHz mono PCM with libopus in the format AVS accepts as "OPUS": 20 ms
+ * frames at a constant 32 kbit/s, which makes every encoded frame 80 bytes.
+ *
+ * The audio is encoded at 16 kHz because that is the rate of the speech AVS recognizes, and of the PCM which
+ * @c AudioInputProcessor accepts.  The 32000 which @c AudioInputProcessor looks for in the format of a provider that
+ * already streams Opus is the bit rate of this format, not a sample rate.
+ *
+ * This class is only built when the SDK is configured with @c -DOPUS_ENCODER=ON.
+ */
+class OpusAudioEncoder : public AudioEncoderInterface {
+public:
+    /**
+     * Creates a new @c OpusAudioEncoder.
+     *
+     * @return The new @c OpusAudioEncoder.
+     */
+    static std::shared_ptr<OpusAudioEncoder> create();
+
+    /**
+     * Destructor.
+     */
+    ~OpusAudioEncoder() override;
+
+    /// @name AudioEncoderInterface Functions
+    /// @{
+    bool init(const avsCommon::utils::AudioFormat& inputFormat) override;
+    size_t getInputFrameSize() const override;
+    size_t getMaxOutputFrameSize() const override;
+    ssize_t encode(const int16_t* input, uint8_t* output) override;
+    std::string getAVSFormatName() const override;
+    /// @}
+
+private:
+    /**
+     * Constructor.
+     */
+    OpusAudioEncoder();
+
+    /// The libopus encoder, created by the first @c init().
+    ::OpusEncoder* m_encoder;
+};
+
+}  // namespace aip
+}  // namespace capabilityAgents
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_CAPABILITYAGENTS_AIP_INCLUDE_AIP_OPUSAUDIOENCODER_H_
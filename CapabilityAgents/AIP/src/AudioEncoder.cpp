@@ -0,0 +1,199 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+#include "AIP/AudioEncoder.h"
+
+namespace alexaClientSDK {
+namespace capabilityAgents {
+namespace aip {
+
+using namespace avsCommon::avs;
+using namespace avsCommon::utils;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("AudioEncoder");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The sample size of the PCM audio which can be encoded.
+static const unsigned int PCM_SAMPLE_SIZE_IN_BITS = 16;
+
+/// The size of the words in the encoded stream, which holds bytes.
+static const size_t ENCODED_WORD_SIZE = 1;
+
+/// The number of readers of the encoded stream: the Recognize attachment, plus one spare.
+static const size_t ENCODED_MAX_READERS = 2;
+
+/**
+ * How long the encoding thread waits for audio before checking whether it has been stopped.  Audio which arrives is
+ * read straight away, so this does not delay the encoding.
+ */
+static const std::chrono::milliseconds READ_TIMEOUT(10);
+
+const std::chrono::seconds AudioEncoder::ENCODED_BUFFER_DURATION(15);
+
+std::unique_ptr<AudioEncoder> AudioEncoder::create(std::shared_ptr<AudioEncoderInterface> encoder) {
+    if (!encoder) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullEncoder"));
+        return nullptr;
+    }
+    return std::unique_ptr<AudioEncoder>(new AudioEncoder(encoder));
+}
+
+AudioEncoder::AudioEncoder(std::shared_ptr<AudioEncoderInterface> encoder) :
+        m_encoder{encoder},
+        m_stopImmediately{false},
+        m_isDraining{false} {
+}
+
+AudioEncoder::~AudioEncoder() {
+    stopThread(true);
+}
+
+std::shared_ptr<AudioInputStream> AudioEncoder::startEncoding(
+    std::shared_ptr<AudioInputStream> input,
+    const AudioFormat& inputFormat,
+    AudioInputStream::Index offset,
+    AudioInputStream::Reader::Reference reference) {
+    stopThread(!m_isDraining);
+
+    if (!input) {
+        ACSDK_ERROR(LX("startEncodingFailed").d("reason", "nullInput"));
+        return nullptr;
+    }
+    if (AudioFormat::Encoding::LPCM != inputFormat.encoding ||
+        PCM_SAMPLE_SIZE_IN_BITS != inputFormat.sampleSizeInBits || input->getWordSize() != sizeof(int16_t)) {
+        ACSDK_ERROR(LX("startEncodingFailed").d("reason", "unsupportedInput").d("encoding", inputFormat.encoding));
+        return nullptr;
+    }
+    if (!m_encoder->init(inputFormat)) {
+        ACSDK_ERROR(LX("startEncodingFailed").d("reason", "encoderInitFailed"));
+        return nullptr;
+    }
+
+    m_reader = input->createReader(AudioInputStream::Reader::Policy::BLOCKING);
+    if (!m_reader || !m_reader->seek(offset, reference)) {
+        ACSDK_ERROR(LX("startEncodingFailed").d("reason", "createReaderFailed"));
+        m_reader.reset();
+        return nullptr;
+    }
+
+    // Size the encoded stream for ENCODED_BUFFER_DURATION of frames of the largest size.
+    size_t framesPerSecond = (inputFormat.sampleRateHz + m_encoder->getInputFrameSize() - 1) /
+                             std::max<size_t>(m_encoder->getInputFrameSize(), 1);
+    size_t encodedWords = framesPerSecond * m_encoder->getMaxOutputFrameSize() * ENCODED_BUFFER_DURATION.count();
+    auto buffer = std::make_shared<AudioInputStream::Buffer>(
+        AudioInputStream::calculateBufferSize(encodedWords, ENCODED_WORD_SIZE, ENCODED_MAX_READERS));
+    std::shared_ptr<AudioInputStream> encoded =
+        AudioInputStream::create(buffer, ENCODED_WORD_SIZE, ENCODED_MAX_READERS);
+    if (!encoded) {
+        ACSDK_ERROR(LX("startEncodingFailed").d("reason", "createEncodedStreamFailed"));
+        m_reader.reset();
+        return nullptr;
+    }
+    m_writer = encoded->createWriter(AudioInputStream::Writer::Policy::NONBLOCKABLE);
+    if (!m_writer) {
+        ACSDK_ERROR(LX("startEncodingFailed").d("reason", "createWriterFailed"));
+        m_reader.reset();
+        return nullptr;
+    }
+
+    m_inputFrame.resize(m_encoder->getInputFrameSize());
+    m_outputFrame.resize(m_encoder->getMaxOutputFrameSize());
+    m_stopImmediately = false;
+    m_thread = std::thread(&AudioEncoder::encodeLoop, this);
+    return encoded;
+}
+
+void AudioEncoder::stopEncoding(bool stopImmediately) {
+    if (stopImmediately) {
+        stopThread(true);
+    } else if (m_reader) {
+        // Encode what has been written so far, then stop.
+        m_reader->close(0, AudioInputStream::Reader::Reference::BEFORE_WRITER);
+        m_isDraining = true;
+    }
+}
+
+std::string AudioEncoder::getAVSFormatName() const {
+    return m_encoder->getAVSFormatName();
+}
+
+void AudioEncoder::encodeLoop() {
+    size_t samplesInFrame = 0;
+    while (!m_stopImmediately) {
+        auto result = m_reader->read(
+            m_inputFrame.data() + samplesInFrame, m_inputFrame.size() - samplesInFrame, READ_TIMEOUT);
+        if (result > 0) {
+            samplesInFrame += result;
+            if (samplesInFrame == m_inputFrame.size()) {
+                if (!encodeFrame()) {
+                    break;
+                }
+                samplesInFrame = 0;
+            }
+        } else if (AudioInputStream::Reader::Error::TIMEDOUT == result) {
+            continue;
+        } else {
+            if (AudioInputStream::Reader::Error::CLOSED == result && samplesInFrame > 0) {
+                // Pad the last frame with silence, so that the end of the audio is not lost.
+                std::fill(m_inputFrame.begin() + samplesInFrame, m_inputFrame.end(), 0);
+                encodeFrame();
+            } else if (AudioInputStream::Reader::Error::CLOSED != result) {
+                ACSDK_ERROR(LX("encodeLoopFailed").d("reason", "readFailed").d("error", result));
+            }
+            break;
+        }
+    }
+    m_writer->close();
+}
+
+bool AudioEncoder::encodeFrame() {
+    auto encodedSize = m_encoder->encode(m_inputFrame.data(), m_outputFrame.data());
+    if (encodedSize < 0 || static_cast<size_t>(encodedSize) > m_outputFrame.size()) {
+        ACSDK_ERROR(LX("encodeFrameFailed").d("reason", "encodeFailed").d("result", encodedSize));
+        return false;
+    }
+    if (encodedSize > 0 && m_writer->write(m_outputFrame.data(), encodedSize) != encodedSize) {
+        ACSDK_ERROR(LX("encodeFrameFailed").d("reason", "writeFailed"));
+        return false;
+    }
+    return true;
+}
+
+void AudioEncoder::stopThread(bool stopImmediately) {
+    if (stopImmediately) {
+        m_stopImmediately = true;
+    }
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    m_reader.reset();
+    m_writer.reset();
+    m_isDraining = false;
+}
+
+}  // namespace aip
+}  // namespace capabilityAgents
+}  // namespace alexaClientSDK
@@ -16,6 +16,7 @@
 #include <sstream>
 
 #include <AVSCommon/AVS/CapabilityConfiguration.h>
+#include <AVSCommon/AVS/EventBuilder.h>
 #include <AVSCommon/AVS/FocusState.h>
 #include <AVSCommon/AVS/MessageRequest.h>
 #include <AVSCommon/Utils/JSON/JSONUtils.h>
@@ -70,12 +71,17 @@ static const avsCommon::avs::NamespaceAndName RECOGNIZER_STATE{NAMESPACE, "Recog
 /// The field identifying the initiator.
 static const std::string INITIATOR_KEY = "initiator";
 
+/// The name of the Recognize event.
+static const std::string RECOGNIZE_EVENT_NAME = "Recognize";
+
 /// The field name for the user voice attachment.
 static const std::string AUDIO_ATTACHMENT_FIELD_NAME = "audio";
 
 /// The field name for the wake word engine metadata.
 static const std::string KWD_METADATA_FIELD_NAME = "wakewordEngineMetadata";
 
+const std::chrono::milliseconds AudioInputProcessor::PREPARED_CONTEXT_TIMEOUT(1000);
+
 /**
  * Creates the SpeechRecognizer capability configuration.
  *
@@ -91,7 +97,8 @@ std::shared_ptr<AudioInputProcessor> AudioInputProcessor::create(
     std::shared_ptr<avsCommon::avs::DialogUXStateAggregator> dialogUXStateAggregator,
     std::shared_ptr<avsCommon::sdkInterfaces::ExceptionEncounteredSenderInterface> exceptionEncounteredSender,
     std::shared_ptr<avsCommon::sdkInterfaces::UserActivityNotifierInterface> userActivityNotifier,
-    AudioProvider defaultAudioProvider) {
+    AudioProvider defaultAudioProvider,
+    std::shared_ptr<AudioEncoderInterface> audioEncoder) {
     if (!directiveSequencer) {
         ACSDK_ERROR(LX("createFailed").d("reason", "nullDirectiveSequencer"));
         return nullptr;
@@ -122,7 +129,8 @@ std::shared_ptr<AudioInputProcessor> AudioInputProcessor::create(
         focusManager,
         exceptionEncounteredSender,
         userActivityNotifier,
-        defaultAudioProvider));
+        defaultAudioProvider,
+        audioEncoder));
 
     if (aip) {
         contextManager->setStateProvider(RECOGNIZER_STATE, aip);
@@ -144,7 +152,7 @@ void AudioInputProcessor::addObserver(std::shared_ptr<ObserverInterface> observe
         ACSDK_ERROR(LX("addObserverFailed").d("reason", "nullObserver"));
         return;
     }
-    m_executor.submit([this, observer]() { m_observers.insert(observer); });
+    m_executor.execute([this, observer]() { m_observers.insert(observer); });
 }
 
 void AudioInputProcessor::removeObserver(std::shared_ptr<ObserverInterface> observer) {
@@ -181,7 +189,7 @@ std::future<bool> AudioInputProcessor::recognize(
     }
 
     if (!espData.isEmpty()) {
-        m_executor.submit([this, espData]() { executePrepareEspPayload(espData); });
+        m_executor.execute([this, espData]() { executePrepareEspPayload(espData); });
     }
 
     return m_executor.submit([this, audioProvider, initiator, begin, keywordEnd, keyword, KWDMetadata]() {
@@ -189,6 +197,14 @@ std::future<bool> AudioInputProcessor::recognize(
     });
 }
 
+void AudioInputProcessor::prepareRecognize(const std::string& keyword) {
+    m_executor.execute([this, keyword]() { executePrepareRecognize(keyword); });
+}
+
+void AudioInputProcessor::cancelPreparedRecognize() {
+    m_executor.execute([this]() { executeCancelPreparedRecognize(); });
+}
+
 std::future<bool> AudioInputProcessor::stopCapture() {
     return m_executor.submit([this]() { return executeStopCapture(); });
 }
@@ -200,15 +216,46 @@ std::future<void> AudioInputProcessor::resetState() {
 void AudioInputProcessor::provideState(
     const avsCommon::avs::NamespaceAndName& stateProviderName,
     unsigned int stateRequestToken) {
-    m_executor.submit([this, stateRequestToken]() { executeProvideState(true, stateRequestToken); });
+    m_executor.execute([this, stateRequestToken]() { executeProvideState(true, stateRequestToken); });
 }
 
 void AudioInputProcessor::onContextAvailable(const std::string& jsonContext) {
-    m_executor.submit([this, jsonContext]() { executeOnContextAvailable(jsonContext); });
+    m_executor.execute([this, jsonContext]() { executeOnContextAvailable(jsonContext); });
 }
 
 void AudioInputProcessor::onContextFailure(const avsCommon::sdkInterfaces::ContextRequestError error) {
-    m_executor.submit([this, error]() { executeOnContextFailure(error); });
+    m_executor.execute([this, error]() { executeOnContextFailure(error); });
+}
+
+AudioInputProcessor::PreparedContextRequester::PreparedContextRequester(
+    std::weak_ptr<AudioInputProcessor> audioInputProcessor,
+    unsigned int preparationId) :
+        m_audioInputProcessor{audioInputProcessor},
+        m_preparationId{preparationId} {
+}
+
+void AudioInputProcessor::PreparedContextRequester::onContextAvailable(const std::string& jsonContext) {
+    auto audioInputProcessor = m_audioInputProcessor.lock();
+    if (!audioInputProcessor) {
+        return;
+    }
+    auto aip = audioInputProcessor.get();
+    auto preparationId = m_preparationId;
+    aip->m_executor.execute([aip, preparationId, jsonContext]() {
+        aip->executeOnPreparedContextAvailable(preparationId, jsonContext);
+    });
+}
+
+void AudioInputProcessor::PreparedContextRequester::onContextFailure(
+    const avsCommon::sdkInterfaces::ContextRequestError error) {
+    auto audioInputProcessor = m_audioInputProcessor.lock();
+    if (!audioInputProcessor) {
+        return;
+    }
+    auto aip = audioInputProcessor.get();
+    auto preparationId = m_preparationId;
+    aip->m_executor.execute(
+        [aip, preparationId, error]() { aip->executeOnPreparedContextFailure(preparationId, error); });
 }
 
 void AudioInputProcessor::handleDirectiveImmediately(std::shared_ptr<avsCommon::avs::AVSDirective> directive) {
@@ -255,12 +302,12 @@ void AudioInputProcessor::onDeregistered() {
 
 void AudioInputProcessor::onFocusChanged(avsCommon::avs::FocusState newFocus) {
     ACSDK_DEBUG9(LX("onFocusChanged").d("newFocus", newFocus));
-    m_executor.submit([this, newFocus]() { executeOnFocusChanged(newFocus); });
+    m_executor.execute([this, newFocus]() { executeOnFocusChanged(newFocus); });
 }
 
 void AudioInputProcessor::onDialogUXStateChanged(
     avsCommon::sdkInterfaces::DialogUXStateObserverInterface::DialogUXState newState) {
-    m_executor.submit([this, newState]() { executeOnDialogUXStateChanged(newState); });
+    m_executor.execute([this, newState]() { executeOnDialogUXStateChanged(newState); });
 }
 
 AudioInputProcessor::AudioInputProcessor(
@@ -270,7 +317,8 @@ AudioInputProcessor::AudioInputProcessor(
     std::shared_ptr<avsCommon::sdkInterfaces::FocusManagerInterface> focusManager,
     std::shared_ptr<avsCommon::sdkInterfaces::ExceptionEncounteredSenderInterface> exceptionEncounteredSender,
     std::shared_ptr<avsCommon::sdkInterfaces::UserActivityNotifierInterface> userActivityNotifier,
-    AudioProvider defaultAudioProvider) :
+    AudioProvider defaultAudioProvider,
+    std::shared_ptr<AudioEncoderInterface> audioEncoder) :
         CapabilityAgent{NAMESPACE, exceptionEncounteredSender},
         RequiresShutdown{"AudioInputProcessor"},
         m_directiveSequencer{directiveSequencer},
@@ -285,7 +333,12 @@ AudioInputProcessor::AudioInputProcessor(
         m_focusState{avsCommon::avs::FocusState::NONE},
         m_preparingToSend{false},
         m_initialDialogUXStateReceived{false},
-        m_precedingExpectSpeechInitiator{nullptr} {
+        m_precedingExpectSpeechInitiator{nullptr},
+        m_preparationState{PreparationState::NONE},
+        m_preparationId{0},
+        m_waitingForPreparedContext{false},
+        m_audioEncoder{audioEncoder ? AudioEncoder::create(audioEncoder) : nullptr},
+        m_encodingAudio{false} {
     m_capabilityConfigurations.insert(getSpeechRecognizerCapabilityConfiguration());
 }
 
@@ -307,6 +360,7 @@ void AudioInputProcessor::doShutdown() {
     m_focusManager.reset();
     m_userActivityNotifier.reset();
     m_observers.clear();
+    m_audioEncoder.reset();
 }
 
 std::future<bool> AudioInputProcessor::expectSpeechTimedOut() {
@@ -314,7 +368,7 @@ std::future<bool> AudioInputProcessor::expectSpeechTimedOut() {
 }
 
 void AudioInputProcessor::handleStopCaptureDirective(std::shared_ptr<DirectiveInfo> info) {
-    m_executor.submit([this, info]() {
+    m_executor.execute([this, info]() {
         bool stopImmediately = true;
         executeStopCapture(stopImmediately, info);
     });
@@ -322,8 +376,9 @@ void AudioInputProcessor::handleStopCaptureDirective(std::shared_ptr<DirectiveIn
 
 void AudioInputProcessor::handleExpectSpeechDirective(std::shared_ptr<DirectiveInfo> info) {
     int64_t timeout;
-    bool found = avsCommon::utils::json::jsonUtils::retrieveValue(
-        info->directive->getPayload(), "timeoutInMilliseconds", &timeout);
+    auto payload = info->directive->getPayloadValue();
+    bool found = payload && payload->IsObject() &&
+                 avsCommon::utils::json::jsonUtils::retrieveValue(*payload, "timeoutInMilliseconds", &timeout);
 
     if (!found) {
         static const char* errorMessage = "missing/invalid timeoutInMilliseconds";
@@ -340,7 +395,7 @@ void AudioInputProcessor::handleExpectSpeechDirective(std::shared_ptr<DirectiveI
         return;
     }
 
-    m_executor.submit([this, timeout, info]() { executeExpectSpeech(std::chrono::milliseconds{timeout}, info); });
+    m_executor.execute([this, timeout, info]() { executeExpectSpeech(std::chrono::milliseconds{timeout}, info); });
 }
 
 void AudioInputProcessor::executePrepareEspPayload(const ESPData& espData) {
@@ -428,6 +483,10 @@ bool AudioInputProcessor::executeRecognize(
         return false;
     }
 
+    /*
+     * A provider which already streams Opus declares the 32 kbit/s bit rate of the AVS "OPUS" format as its rate.  The
+     * audio itself is 16 kHz, which is also what OpusAudioEncoder encodes LPCM providers to.
+     */
     std::unordered_map<int, std::string> mapSampleRatesAVSEncoding = {{32000, "OPUS"}};
     std::string avsEncodingFormat;
     std::unordered_map<int, std::string>::iterator itSampleRateAVSEncoding;
@@ -466,6 +525,12 @@ bool AudioInputProcessor::executeRecognize(
             return false;
     }
 
+    // Encode PCM audio before streaming it, if we have an encoder.
+    bool encodeAudio = m_audioEncoder && avsCommon::utils::AudioFormat::Encoding::LPCM == provider.format.encoding;
+    if (encodeAudio) {
+        avsEncodingFormat = m_audioEncoder->getAVSFormatName();
+    }
+
     if (provider.format.endianness != avsCommon::utils::AudioFormat::Endianness::LITTLE) {
         ACSDK_ERROR(LX("executeRecognizeFailed")
                         .d("reason", "unsupportedEndianness")
@@ -527,19 +592,34 @@ bool AudioInputProcessor::executeRecognize(
     // clang-format on
 
     // Set up an attachment reader for the event.
-    avsCommon::avs::attachment::InProcessAttachmentReader::SDSTypeIndex offset = 0;
-    avsCommon::avs::attachment::InProcessAttachmentReader::SDSTypeReader::Reference reference =
-        avsCommon::avs::attachment::InProcessAttachmentReader::SDSTypeReader::Reference::BEFORE_WRITER;
+    AudioAttachmentReader::SDSTypeIndex offset = 0;
+    AudioAttachmentReader::SDSTypeReader::Reference reference =
+        AudioAttachmentReader::SDSTypeReader::Reference::BEFORE_WRITER;
     if (INVALID_INDEX != begin) {
         offset = begin;
-        reference = avsCommon::avs::attachment::InProcessAttachmentReader::SDSTypeReader::Reference::ABSOLUTE;
+        reference = AudioAttachmentReader::SDSTypeReader::Reference::ABSOLUTE;
     }
-    m_reader = avsCommon::avs::attachment::InProcessAttachmentReader::create(
-        sds::ReaderPolicy::NONBLOCKING, provider.stream, offset, reference);
+    auto stream = provider.stream;
+    if (encodeAudio) {
+        // Stream the encoded audio from its start instead.
+        stream = m_audioEncoder->startEncoding(provider.stream, provider.format, offset, reference);
+        if (!stream) {
+            ACSDK_ERROR(LX("executeRecognizeFailed").d("reason", "Failed to start encoding"));
+            return false;
+        }
+        offset = 0;
+        reference = AudioAttachmentReader::SDSTypeReader::Reference::ABSOLUTE;
+    }
+    m_reader = AudioAttachmentReader::create(
+        sds::ReaderPolicy::NONBLOCKING, stream, offset, reference);
     if (!m_reader) {
         ACSDK_ERROR(LX("executeRecognizeFailed").d("reason", "Failed to create attachment reader"));
+        if (encodeAudio) {
+            m_audioEncoder->stopEncoding(true);
+        }
         return false;
     }
+    m_encodingAudio = encodeAudio;
 
     if (KWDMetadata) {
         m_KWDMetadataReader = avsCommon::avs::attachment::AttachmentUtils::createAttachmentReader(*KWDMetadata);
@@ -559,10 +639,28 @@ bool AudioInputProcessor::executeRecognize(
     if (!keyword.empty() && m_wakeword != keyword) {
         m_wakeword = keyword;
         executeProvideState();
+        // A prepared context still carries the old wakeword.
+        executeCancelPreparedRecognize();
     }
 
-    //  Start assembling the context; we'll service the callback after assembling our Recognize event.
-    m_contextManager->getContext(shared_from_this());
+    // Use the context gathered by prepareRecognize() if it is recent enough; otherwise start assembling the context.
+    // Either way, we'll service it after assembling our Recognize event.
+    if (PreparationState::NONE != m_preparationState && !m_waitingForPreparedContext &&
+        std::chrono::steady_clock::now() - m_preparationTime > PREPARED_CONTEXT_TIMEOUT) {
+        ACSDK_DEBUG(LX("executeRecognize").d("reason", "preparedContextExpired"));
+        executeCancelPreparedRecognize();
+    }
+    std::string preparedDialogRequestId;
+    std::string preparedEventPrefix;
+    if (PreparationState::EVENT_PREPARED == m_preparationState) {
+        preparedDialogRequestId = std::move(m_preparedDialogRequestId);
+        preparedEventPrefix = std::move(m_preparedEventPrefix);
+        executeCancelPreparedRecognize();
+    } else if (PreparationState::REQUESTING_CONTEXT == m_preparationState) {
+        m_waitingForPreparedContext = true;
+    } else {
+        m_contextManager->getContext(shared_from_this());
+    }
 
     // Stop the ExpectSpeech timer so we don't get a timeout.
     m_expectingSpeechTimer.stop();
@@ -576,12 +674,25 @@ bool AudioInputProcessor::executeRecognize(
     // We can't assemble the MessageRequest until we receive the context.
     m_recognizeRequest.reset();
 
+    if (!preparedEventPrefix.empty()) {
+        executeOnRecognizeEventPrefixAvailable(preparedDialogRequestId, preparedEventPrefix);
+    }
+
     return true;
 }
 
 void AudioInputProcessor::executeOnContextAvailable(const std::string jsonContext) {
     ACSDK_DEBUG(LX("executeOnContextAvailable").sensitive("jsonContext", jsonContext));
 
+    auto dialogRequestId = avsCommon::utils::uuidGeneration::generateUUID();
+    auto eventPrefix =
+        avsCommon::avs::buildJsonEventPrefix(NAMESPACE, RECOGNIZE_EVENT_NAME, dialogRequestId, jsonContext).second;
+    executeOnRecognizeEventPrefixAvailable(dialogRequestId, eventPrefix);
+}
+
+void AudioInputProcessor::executeOnRecognizeEventPrefixAvailable(
+    const std::string& dialogRequestId,
+    const std::string& eventPrefix) {
     // Should already be RECOGNIZING if we get here.
     if (m_state != ObserverInterface::State::RECOGNIZING) {
         ACSDK_ERROR(
@@ -611,18 +722,20 @@ void AudioInputProcessor::executeOnContextAvailable(const std::string jsonContex
         }
     }
 
-    // Assemble the MessageRequest.  It will be sent by executeOnFocusChanged when we acquire the channel.
-    auto dialogRequestId = avsCommon::utils::uuidGeneration::generateUUID();
+    // Assemble the MessageRequest.  It will be sent by executeOnFocusChanged when we acquire the channel.  The
+    // dialogRequestId only becomes current now, even if it was generated when the event was prepared.
     m_directiveSequencer->setDialogRequestId(dialogRequestId);
     if (!m_espPayload.empty()) {
         auto msgIdAndESPJsonEvent =
             buildJsonEventString("ReportEchoSpatialPerceptionData", dialogRequestId, m_espPayload);
         m_espPayload.clear();
         m_espRequest = std::make_shared<avsCommon::avs::MessageRequest>(msgIdAndESPJsonEvent.second);
+        m_espRequest->setPriority(avsCommon::avs::MessageRequest::Priority::INTERACTIVE);
         m_espRequest->addObserver(shared_from_this());
     }
-    auto msgIdAndJsonEvent = buildJsonEventString("Recognize", dialogRequestId, m_recognizePayload, jsonContext);
-    m_recognizeRequest = std::make_shared<avsCommon::avs::MessageRequest>(msgIdAndJsonEvent.second);
+    auto jsonEvent = avsCommon::avs::completeJsonEventString(eventPrefix, m_recognizePayload);
+    m_recognizeRequest = std::make_shared<avsCommon::avs::MessageRequest>(jsonEvent);
+    m_recognizeRequest->setPriority(avsCommon::avs::MessageRequest::Priority::INTERACTIVE);
 
     if (m_KWDMetadataReader) {
         m_recognizeRequest->addAttachmentReader(KWD_METADATA_FIELD_NAME, m_KWDMetadataReader);
@@ -645,6 +758,74 @@ void AudioInputProcessor::executeOnContextFailure(const avsCommon::sdkInterfaces
     executeResetState();
 }
 
+void AudioInputProcessor::executePrepareRecognize(const std::string& keyword) {
+    if (m_waitingForPreparedContext) {
+        ACSDK_DEBUG(LX("executePrepareRecognizeIgnored").d("reason", "recognizeWaitingForPreparedContext"));
+        return;
+    }
+    executeCancelPreparedRecognize();
+    // Update state before the context is gathered, so that the context carries the keyword of the coming Recognize.
+    if (!keyword.empty() && m_wakeword != keyword) {
+        m_wakeword = keyword;
+        executeProvideState();
+    }
+    ++m_preparationId;
+    m_preparationState = PreparationState::REQUESTING_CONTEXT;
+    m_preparationTime = std::chrono::steady_clock::now();
+    m_contextManager->getContext(std::make_shared<PreparedContextRequester>(shared_from_this(), m_preparationId));
+}
+
+void AudioInputProcessor::executeOnPreparedContextAvailable(
+    unsigned int preparationId,
+    const std::string& jsonContext) {
+    if (preparationId != m_preparationId || PreparationState::REQUESTING_CONTEXT != m_preparationState) {
+        ACSDK_DEBUG(LX("executeOnPreparedContextAvailableIgnored").d("reason", "preparationDiscarded"));
+        return;
+    }
+    if (!m_waitingForPreparedContext) {
+        // Everything in the Recognize event but its payload can be assembled now, ahead of executeRecognize().
+        m_preparedDialogRequestId = avsCommon::utils::uuidGeneration::generateUUID();
+        m_preparedEventPrefix = avsCommon::avs::buildJsonEventPrefix(
+                                    NAMESPACE, RECOGNIZE_EVENT_NAME, m_preparedDialogRequestId, jsonContext)
+                                    .second;
+        if (m_preparedEventPrefix.empty()) {
+            ACSDK_WARN(LX("executeOnPreparedContextAvailableFailed").d("reason", "buildJsonEventPrefixFailed"));
+            executeCancelPreparedRecognize();
+            return;
+        }
+        m_preparationState = PreparationState::EVENT_PREPARED;
+        return;
+    }
+    m_waitingForPreparedContext = false;
+    executeCancelPreparedRecognize();
+    executeOnContextAvailable(jsonContext);
+}
+
+void AudioInputProcessor::executeOnPreparedContextFailure(
+    unsigned int preparationId,
+    const avsCommon::sdkInterfaces::ContextRequestError error) {
+    if (preparationId != m_preparationId || PreparationState::REQUESTING_CONTEXT != m_preparationState) {
+        return;
+    }
+    ACSDK_WARN(LX("executeOnPreparedContextFailure").d("error", error));
+    executeCancelPreparedRecognize();
+}
+
+void AudioInputProcessor::executeCancelPreparedRecognize() {
+    if (PreparationState::NONE == m_preparationState) {
+        return;
+    }
+    ++m_preparationId;
+    m_preparationState = PreparationState::NONE;
+    m_preparedDialogRequestId.clear();
+    m_preparedEventPrefix.clear();
+    if (m_waitingForPreparedContext) {
+        // A Recognize is still waiting for the context, so request a new one for it.
+        m_waitingForPreparedContext = false;
+        m_contextManager->getContext(shared_from_this());
+    }
+}
+
 void AudioInputProcessor::executeOnFocusChanged(avsCommon::avs::FocusState newFocus) {
     ACSDK_DEBUG(LX("executeOnFocusChanged").d("newFocus", newFocus));
 
@@ -691,7 +872,14 @@ bool AudioInputProcessor::executeStopCapture(bool stopImmediately, std::shared_p
     // Create a lambda to do the StopCapture.
     std::function<void()> stopCapture = [=] {
         ACSDK_DEBUG(LX("stopCapture").d("stopImmediately", stopImmediately));
-        if (stopImmediately) {
+        if (m_encodingAudio) {
+            // The encoded stream ends once the encoder has encoded the audio written so far.
+            m_audioEncoder->stopEncoding(stopImmediately);
+            m_encodingAudio = false;
+            if (stopImmediately) {
+                m_reader->close(avsCommon::avs::attachment::AttachmentReader::ClosePoint::IMMEDIATELY);
+            }
+        } else if (stopImmediately) {
             m_reader->close(avsCommon::avs::attachment::AttachmentReader::ClosePoint::IMMEDIATELY);
         } else {
             m_reader->close(avsCommon::avs::attachment::AttachmentReader::ClosePoint::AFTER_DRAINING_CURRENT_BUFFER);
@@ -723,6 +911,10 @@ void AudioInputProcessor::executeResetState() {
     // Irrespective of current state, clean up and go back to idle.
     m_expectingSpeechTimer.stop();
     m_precedingExpectSpeechInitiator.reset();
+    if (m_encodingAudio) {
+        m_audioEncoder->stopEncoding(true);
+        m_encodingAudio = false;
+    }
     if (m_reader) {
         m_reader->close();
     }
@@ -732,6 +924,8 @@ void AudioInputProcessor::executeResetState() {
     m_espRequest.reset();
     m_preparingToSend = false;
     m_deferredStopCapture = nullptr;
+    m_waitingForPreparedContext = false;
+    executeCancelPreparedRecognize();
     if (m_focusState != avsCommon::avs::FocusState::NONE) {
         m_focusManager->releaseChannel(CHANNEL_NAME, shared_from_this());
     }
@@ -764,8 +958,9 @@ bool AudioInputProcessor::executeExpectSpeech(std::chrono::milliseconds timeout,
     }
 
     m_precedingExpectSpeechInitiator = memory::make_unique<std::string>("");
-    bool found = json::jsonUtils::retrieveValue(
-        info->directive->getPayload(), INITIATOR_KEY, m_precedingExpectSpeechInitiator.get());
+    auto payload = info->directive->getPayloadValue();
+    bool found = payload && payload->IsObject() &&
+                 json::jsonUtils::retrieveValue(*payload, INITIATOR_KEY, m_precedingExpectSpeechInitiator.get());
     if (found) {
         ACSDK_DEBUG(LX(__func__).d("initiatorFound", *m_precedingExpectSpeechInitiator));
     } else {
@@ -803,6 +998,7 @@ bool AudioInputProcessor::executeExpectSpeechTimedOut() {
     m_precedingExpectSpeechInitiator.reset();
     auto msgIdAndJsonEvent = buildJsonEventString("ExpectSpeechTimedOut");
     auto request = std::make_shared<avsCommon::avs::MessageRequest>(msgIdAndJsonEvent.second);
+    request->setPriority(avsCommon::avs::MessageRequest::Priority::INTERACTIVE);
     request->addObserver(shared_from_this());
     m_messageSender->sendMessage(request);
     setState(ObserverInterface::State::IDLE);
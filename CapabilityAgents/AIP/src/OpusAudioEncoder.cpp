@@ -0,0 +1,132 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <opus.h>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+#include "AIP/OpusAudioEncoder.h"
+
+namespace alexaClientSDK {
+namespace capabilityAgents {
+namespace aip {
+
+using namespace avsCommon::utils;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("OpusAudioEncoder");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The sample rate AVS expects Opus audio to be encoded from, which is the rate of the PCM AVS accepts.
+static const unsigned int SAMPLE_RATE_HZ = 16000;
+
+/// The sample size of the PCM audio which can be encoded.
+static const unsigned int SAMPLE_SIZE_IN_BITS = 16;
+
+/// The number of channels AVS expects Opus audio to have.
+static const unsigned int NUM_CHANNELS = 1;
+
+/// The number of samples in a 20 ms frame.
+static const size_t FRAME_SIZE = SAMPLE_RATE_HZ / 50;
+
+/// The constant bit rate AVS expects Opus audio to be encoded at.
+static const opus_int32 BIT_RATE = 32000;
+
+/// The size of an encoded frame at @c BIT_RATE.
+static const size_t ENCODED_FRAME_SIZE = BIT_RATE / 8 / 50;
+
+/// The name AVS gives this format.
+static const std::string AVS_FORMAT_NAME = "OPUS";
+
+std::shared_ptr<OpusAudioEncoder> OpusAudioEncoder::create() {
+    return std::shared_ptr<OpusAudioEncoder>(new OpusAudioEncoder());
+}
+
+OpusAudioEncoder::OpusAudioEncoder() : m_encoder{nullptr} {
+}
+
+OpusAudioEncoder::~OpusAudioEncoder() {
+    if (m_encoder) {
+        opus_encoder_destroy(m_encoder);
+    }
+}
+
+bool OpusAudioEncoder::init(const AudioFormat& inputFormat) {
+    if (AudioFormat::Encoding::LPCM != inputFormat.encoding || SAMPLE_RATE_HZ != inputFormat.sampleRateHz ||
+        SAMPLE_SIZE_IN_BITS != inputFormat.sampleSizeInBits || NUM_CHANNELS != inputFormat.numChannels ||
+        AudioFormat::Endianness::LITTLE != inputFormat.endianness) {
+        ACSDK_ERROR(LX("initFailed")
+                        .d("reason", "unsupportedFormat")
+                        .d("encoding", inputFormat.encoding)
+                        .d("sampleRateHz", inputFormat.sampleRateHz)
+                        .d("numChannels", inputFormat.numChannels));
+        return false;
+    }
+
+    if (!m_encoder) {
+        int error = OPUS_OK;
+        m_encoder = opus_encoder_create(SAMPLE_RATE_HZ, NUM_CHANNELS, OPUS_APPLICATION_VOIP, &error);
+        if (OPUS_OK != error || !m_encoder) {
+            ACSDK_ERROR(LX("initFailed").d("reason", "createFailed").d("error", opus_strerror(error)));
+            m_encoder = nullptr;
+            return false;
+        }
+    } else if (opus_encoder_ctl(m_encoder, OPUS_RESET_STATE) != OPUS_OK) {
+        ACSDK_ERROR(LX("initFailed").d("reason", "resetFailed"));
+        return false;
+    }
+
+    if (opus_encoder_ctl(m_encoder, OPUS_SET_BITRATE(BIT_RATE)) != OPUS_OK ||
+        opus_encoder_ctl(m_encoder, OPUS_SET_VBR(0)) != OPUS_OK ||
+        opus_encoder_ctl(m_encoder, OPUS_SET_SIGNAL(OPUS_SIGNAL_VOICE)) != OPUS_OK) {
+        ACSDK_ERROR(LX("initFailed").d("reason", "configureFailed"));
+        return false;
+    }
+    return true;
+}
+
+size_t OpusAudioEncoder::getInputFrameSize() const {
+    return FRAME_SIZE;
+}
+
+size_t OpusAudioEncoder::getMaxOutputFrameSize() const {
+    return ENCODED_FRAME_SIZE;
+}
+
+ssize_t OpusAudioEncoder::encode(const int16_t* input, uint8_t* output) {
+    if (!m_encoder) {
+        ACSDK_ERROR(LX("encodeFailed").d("reason", "notInitialized"));
+        return -1;
+    }
+    auto result = opus_encode(m_encoder, input, FRAME_SIZE, output, ENCODED_FRAME_SIZE);
+    if (result < 0) {
+        ACSDK_ERROR(LX("encodeFailed").d("error", opus_strerror(result)));
+    }
+    return result;
+}
+
+std::string OpusAudioEncoder::getAVSFormatName() const {
+    return AVS_FORMAT_NAME;
+}
+
+}  // namespace aip
+}  // namespace capabilityAgents
+}  // namespace alexaClientSDK
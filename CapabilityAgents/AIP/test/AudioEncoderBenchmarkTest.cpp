@@ -0,0 +1,256 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file AudioEncoderBenchmarkTest.cpp
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Timing/LatencyHistogram.h>
+
+#include "AIP/AudioEncoder.h"
+#ifdef OPUS_ENCODER
+#include "AIP/OpusAudioEncoder.h"
+#endif
+
+namespace alexaClientSDK {
+namespace capabilityAgents {
+namespace aip {
+namespace test {
+
+using namespace avsCommon::avs;
+using namespace avsCommon::utils;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("AudioEncoderBenchmarkTest");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The format of the PCM audio.
+static const AudioFormat PCM_FORMAT = {AudioFormat::Encoding::LPCM, AudioFormat::Endianness::LITTLE, 16000, 16, 1};
+
+/// The duration of audio encoded when measuring the cost of encoding, which fits in the encoded stream.
+static const unsigned int AUDIO_SECONDS = 10;
+
+/// The number of frames written one at a time when measuring the latency of encoding.
+static const size_t LATENCY_FRAMES = 500;
+
+/// Long timeout for each read of an encoded frame (we should not reach this).
+static const std::chrono::seconds LONG_TIMEOUT(2);
+
+/**
+ * An @c AudioEncoderInterface which copies 20 ms frames of PCM, giving the bytes sent without encoding and the cost
+ * of the encoding stage itself.
+ */
+class PassThroughEncoder : public AudioEncoderInterface {
+public:
+    bool init(const AudioFormat& inputFormat) override {
+        return true;
+    }
+    size_t getInputFrameSize() const override {
+        return PCM_FORMAT.sampleRateHz / 50;
+    }
+    size_t getMaxOutputFrameSize() const override {
+        return getInputFrameSize() * sizeof(int16_t);
+    }
+    ssize_t encode(const int16_t* input, uint8_t* output) override {
+        std::memcpy(output, input, getMaxOutputFrameSize());
+        return getMaxOutputFrameSize();
+    }
+    std::string getAVSFormatName() const override {
+        return "AUDIO_L16_RATE_16000_CHANNELS_1";
+    }
+};
+
+/**
+ * Generates audio with the spectrum of a voice: a few harmonics of a slowly varying pitch, plus some noise.
+ *
+ * @param samples The number of samples to generate.
+ * @return The audio.
+ */
+static std::vector<int16_t> generateAudio(size_t samples) {
+    std::vector<int16_t> audio(samples);
+    unsigned int noise = 1;
+    double phase = 0;
+    for (size_t i = 0; i < samples; ++i) {
+        double seconds = static_cast<double>(i) / PCM_FORMAT.sampleRateHz;
+        double pitch = 150 + 50 * std::sin(2 * M_PI * seconds);
+        phase += 2 * M_PI * pitch / PCM_FORMAT.sampleRateHz;
+        noise = noise * 1103515245 + 12345;
+        double value = 4000 * std::sin(phase) + 2000 * std::sin(2 * phase) + 1000 * std::sin(3 * phase) +
+                       static_cast<int>((noise >> 16) % 512) - 256;
+        audio[i] = static_cast<int16_t>(value);
+    }
+    return audio;
+}
+
+/**
+ * Creates a PCM stream which can hold @c AUDIO_SECONDS of audio.
+ *
+ * @param[out] writer The writer of the stream.
+ * @return The stream.
+ */
+static std::shared_ptr<AudioInputStream> createStream(std::unique_ptr<AudioInputStream::Writer>* writer) {
+    size_t words = PCM_FORMAT.sampleRateHz * (AUDIO_SECONDS + 1);
+    auto buffer =
+        std::make_shared<AudioInputStream::Buffer>(AudioInputStream::calculateBufferSize(words, sizeof(int16_t), 2));
+    std::shared_ptr<AudioInputStream> stream = AudioInputStream::create(buffer, sizeof(int16_t), 2);
+    *writer = stream->createWriter(AudioInputStream::Writer::Policy::NONBLOCKABLE);
+    return stream;
+}
+
+/**
+ * Encodes @c AUDIO_SECONDS of audio as fast as possible, and returns the CPU time taken per second of audio and the
+ * number of bytes produced per second of audio.
+ *
+ * @param encoder The codec to measure.
+ * @param[out] cpuUsPerAudioSecond The CPU time taken to encode each second of audio, in all threads.
+ * @param[out] bytesPerAudioSecond The number of encoded bytes for each second of audio.
+ */
+static void measureEncodingCost(
+    std::shared_ptr<AudioEncoderInterface> encoder,
+    long* cpuUsPerAudioSecond,
+    size_t* bytesPerAudioSecond) {
+    std::unique_ptr<AudioInputStream::Writer> writer;
+    auto stream = createStream(&writer);
+    ASSERT_TRUE(writer);
+    auto audio = generateAudio(PCM_FORMAT.sampleRateHz * AUDIO_SECONDS);
+    ASSERT_EQ(writer->write(audio.data(), audio.size()), static_cast<ssize_t>(audio.size()));
+
+    auto audioEncoder = AudioEncoder::create(encoder);
+    ASSERT_TRUE(audioEncoder);
+    auto start = std::clock();
+    auto encoded = audioEncoder->startEncoding(stream, PCM_FORMAT, 0, AudioInputStream::Reader::Reference::ABSOLUTE);
+    ASSERT_TRUE(encoded);
+    auto reader = encoded->createReader(AudioInputStream::Reader::Policy::BLOCKING);
+    ASSERT_TRUE(reader);
+    audioEncoder->stopEncoding(false);
+
+    std::vector<uint8_t> chunk(4096);
+    size_t totalBytes = 0;
+    ssize_t result;
+    while ((result = reader->read(chunk.data(), chunk.size(), LONG_TIMEOUT)) > 0) {
+        totalBytes += result;
+    }
+    ASSERT_EQ(result, AudioInputStream::Reader::Error::CLOSED);
+    auto cpuUs = (std::clock() - start) * 1000000L / CLOCKS_PER_SEC;
+
+    *cpuUsPerAudioSecond = cpuUs / AUDIO_SECONDS;
+    *bytesPerAudioSecond = totalBytes / AUDIO_SECONDS;
+}
+
+/**
+ * Writes @c LATENCY_FRAMES frames one at a time, and records the time from writing each frame until its encoded frame
+ * can be read.
+ *
+ * @param encoder The codec to measure.
+ * @param[out] latencies The latencies of the frames.
+ */
+static void measureEncodingLatency(
+    std::shared_ptr<AudioEncoderInterface> encoder,
+    timing::LatencyHistogram* latencies) {
+    std::unique_ptr<AudioInputStream::Writer> writer;
+    auto stream = createStream(&writer);
+    ASSERT_TRUE(writer);
+    auto frameSize = encoder->getInputFrameSize();
+    auto audio = generateAudio(frameSize * LATENCY_FRAMES);
+
+    auto audioEncoder = AudioEncoder::create(encoder);
+    ASSERT_TRUE(audioEncoder);
+    auto encoded = audioEncoder->startEncoding(stream, PCM_FORMAT, 0, AudioInputStream::Reader::Reference::ABSOLUTE);
+    ASSERT_TRUE(encoded);
+    auto reader = encoded->createReader(AudioInputStream::Reader::Policy::BLOCKING);
+    ASSERT_TRUE(reader);
+
+    std::vector<uint8_t> chunk(encoder->getMaxOutputFrameSize());
+    for (size_t i = 0; i < LATENCY_FRAMES; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        ASSERT_EQ(writer->write(audio.data() + i * frameSize, frameSize), static_cast<ssize_t>(frameSize));
+        ASSERT_GT(reader->read(chunk.data(), chunk.size(), LONG_TIMEOUT), 0);
+        latencies->record(std::chrono::steady_clock::now() - start);
+        // Drain the rest of the frame, if it arrived in pieces.
+        while (reader->tell(AudioInputStream::Reader::Reference::BEFORE_WRITER) > 0) {
+            reader->read(chunk.data(), chunk.size());
+        }
+    }
+    audioEncoder->stopEncoding(true);
+}
+
+/**
+ * Measure the cost and latency of an encoder, and report them.
+ *
+ * @param name The name of the encoder in the report.
+ * @param createEncoder Creates a fresh instance of the encoder to measure.
+ * @param[out] bytesPerAudioSecond The number of encoded bytes for each second of audio.
+ */
+static void benchmark(
+    const std::string& name,
+    std::function<std::shared_ptr<AudioEncoderInterface>()> createEncoder,
+    size_t* bytesPerAudioSecond) {
+    long cpuUsPerAudioSecond = 0;
+    timing::LatencyHistogram latencies;
+    auto encoder = createEncoder();
+    ASSERT_TRUE(encoder);
+    measureEncodingCost(encoder, &cpuUsPerAudioSecond, bytesPerAudioSecond);
+    encoder = createEncoder();
+    ASSERT_TRUE(encoder);
+    measureEncodingLatency(encoder, &latencies);
+    ACSDK_INFO(LX("benchmark")
+                   .d("encoder", name)
+                   .d("cpuUsPerAudioSecond", cpuUsPerAudioSecond)
+                   .d("bytesPerAudioSecond", *bytesPerAudioSecond)
+                   .d("latencies", latencies.toString()));
+}
+
+/**
+ * Measure the CPU time per second of audio, the bytes sent per second of audio, and the latency added by the encoding
+ * stage, for PCM copied through the stage.
+ */
+TEST(AudioEncoderBenchmarkTest, pcmEncodingCostAndLatency) {
+    size_t bytesPerAudioSecond = 0;
+    benchmark("pcm", []() { return std::make_shared<PassThroughEncoder>(); }, &bytesPerAudioSecond);
+    EXPECT_EQ(bytesPerAudioSecond, PCM_FORMAT.sampleRateHz * sizeof(int16_t));
+}
+
+#ifdef OPUS_ENCODER
+/**
+ * Measure the CPU time per second of audio, the bytes sent per second of audio, and the latency added by encoding
+ * with Opus.  This is only built with @c -DOPUS_ENCODER=ON.
+ */
+TEST(AudioEncoderBenchmarkTest, opusEncodingCostAndLatency) {
+    size_t bytesPerAudioSecond = 0;
+    benchmark("opus", []() { return OpusAudioEncoder::create(); }, &bytesPerAudioSecond);
+    EXPECT_EQ(bytesPerAudioSecond, 4000u);
+}
+#endif
+
+}  // namespace test
+}  // namespace aip
+}  // namespace capabilityAgents
+}  // namespace alexaClientSDK
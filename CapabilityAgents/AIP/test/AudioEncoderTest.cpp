@@ -0,0 +1,277 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file AudioEncoderTest.cpp
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "AIP/AudioEncoder.h"
+#include "MockAudioEncoder.h"
+
+namespace alexaClientSDK {
+namespace capabilityAgents {
+namespace aip {
+namespace test {
+
+using namespace testing;
+using namespace avsCommon::avs;
+using namespace avsCommon::utils;
+
+/// The number of words in the PCM stream.
+static const size_t SDS_WORDS = 16000;
+
+/// The maximum number of readers of the PCM stream.
+static const size_t SDS_MAXREADERS = 2;
+
+/// The format of the PCM stream.
+static const AudioFormat PCM_FORMAT = {AudioFormat::Encoding::LPCM, AudioFormat::Endianness::LITTLE, 16000, 16, 1};
+
+/// Long timeout for an encoded frame, or the end of the encoded stream, to be read (we should not reach this).
+static const std::chrono::seconds TEST_TIMEOUT(2);
+
+/// A timeout for waiting for something which should not happen.
+static const std::chrono::milliseconds SHORT_TIMEOUT(100);
+
+/// How long the slow codec takes to encode each frame, so that a drain is still running when encoding restarts.
+static const std::chrono::milliseconds SLOW_ENCODE_TIME(20);
+
+/// The number of samples in each frame of @c MockAudioEncoder.
+static const size_t FRAME_SIZE = MockAudioEncoder::FRAME_SIZE;
+
+/// The size of each encoded frame of @c MockAudioEncoder.
+static const size_t ENCODED_FRAME_SIZE = MockAudioEncoder::ENCODED_FRAME_SIZE;
+
+/// Test harness for @c AudioEncoder.
+class AudioEncoderTest : public ::testing::Test {
+public:
+    void SetUp() override;
+
+    /**
+     * Writes samples to the PCM stream, whose values are their positions in the stream.
+     *
+     * @param count The number of samples to write.
+     */
+    void writeSamples(size_t count);
+
+    /**
+     * Reads one encoded frame and checks that it holds the first and the last sample of the given frame.
+     *
+     * @param reader The reader of the encoded stream.
+     * @param frame The index of the frame in the PCM stream.
+     * @param lastSample The expected last sample, if it is not the position of the last sample of the frame.
+     */
+    void expectEncodedFrame(AudioInputStream::Reader* reader, size_t frame, int lastSample = -1);
+
+    /**
+     * Starts encoding the PCM stream.
+     *
+     * @param reference Where to start encoding: at the start of the stream or at the writer.
+     * @return The encoded stream.
+     */
+    std::shared_ptr<AudioInputStream> startEncoding(
+        AudioInputStream::Reader::Reference reference = AudioInputStream::Reader::Reference::ABSOLUTE);
+
+    /// The PCM stream.
+    std::shared_ptr<AudioInputStream> m_stream;
+
+    /// The writer of the PCM stream.
+    std::unique_ptr<AudioInputStream::Writer> m_writer;
+
+    /// The number of samples written to the PCM stream.
+    size_t m_samplesWritten;
+
+    /// The codec.
+    std::shared_ptr<NiceMock<MockAudioEncoder>> m_encoder;
+
+    /// The @c AudioEncoder under test.
+    std::unique_ptr<AudioEncoder> m_audioEncoder;
+};
+
+void AudioEncoderTest::SetUp() {
+    auto bufferSize = AudioInputStream::calculateBufferSize(SDS_WORDS, sizeof(int16_t), SDS_MAXREADERS);
+    auto buffer = std::make_shared<AudioInputStream::Buffer>(bufferSize);
+    m_stream = AudioInputStream::create(buffer, sizeof(int16_t), SDS_MAXREADERS);
+    ASSERT_TRUE(m_stream);
+    m_writer = m_stream->createWriter(AudioInputStream::Writer::Policy::NONBLOCKABLE);
+    ASSERT_TRUE(m_writer);
+    m_samplesWritten = 0;
+    m_encoder = std::make_shared<NiceMock<MockAudioEncoder>>();
+    m_audioEncoder = AudioEncoder::create(m_encoder);
+    ASSERT_TRUE(m_audioEncoder);
+}
+
+void AudioEncoderTest::writeSamples(size_t count) {
+    std::vector<int16_t> samples(count);
+    std::iota(samples.begin(), samples.end(), static_cast<int16_t>(m_samplesWritten));
+    ASSERT_EQ(m_writer->write(samples.data(), count), static_cast<ssize_t>(count));
+    m_samplesWritten += count;
+}
+
+void AudioEncoderTest::expectEncodedFrame(AudioInputStream::Reader* reader, size_t frame, int lastSample) {
+    int16_t encoded[2];
+    size_t bytesRead = 0;
+    while (bytesRead < ENCODED_FRAME_SIZE) {
+        auto result = reader->read(
+            reinterpret_cast<uint8_t*>(encoded) + bytesRead, ENCODED_FRAME_SIZE - bytesRead, TEST_TIMEOUT);
+        ASSERT_GT(result, 0);
+        bytesRead += result;
+    }
+    EXPECT_EQ(encoded[0], static_cast<int16_t>(frame * FRAME_SIZE));
+    EXPECT_EQ(encoded[1], lastSample < 0 ? static_cast<int16_t>((frame + 1) * FRAME_SIZE - 1) : lastSample);
+}
+
+std::shared_ptr<AudioInputStream> AudioEncoderTest::startEncoding(AudioInputStream::Reader::Reference reference) {
+    return m_audioEncoder->startEncoding(m_stream, PCM_FORMAT, 0, reference);
+}
+
+/// Verify that @c AudioEncoder::create() fails without a codec.
+TEST_F(AudioEncoderTest, createWithoutEncoder) {
+    EXPECT_FALSE(AudioEncoder::create(nullptr));
+}
+
+/// Verify that encoding does not start when the codec rejects the format, or the audio is not PCM.
+TEST_F(AudioEncoderTest, startEncodingFailsForUnsupportedFormat) {
+    auto opusFormat = PCM_FORMAT;
+    opusFormat.encoding = AudioFormat::Encoding::OPUS;
+    EXPECT_FALSE(
+        m_audioEncoder->startEncoding(m_stream, opusFormat, 0, AudioInputStream::Reader::Reference::ABSOLUTE));
+
+    EXPECT_CALL(*m_encoder, init(_)).WillOnce(Return(false));
+    EXPECT_FALSE(startEncoding());
+}
+
+/**
+ * Verify that each frame is encoded as soon as its last sample is written, and not before, and that encoding starts
+ * from the requested position.
+ */
+TEST_F(AudioEncoderTest, encodesEachFrameOnceComplete) {
+    // The first frame is written before encoding starts.
+    writeSamples(FRAME_SIZE);
+    auto encoded = startEncoding();
+    ASSERT_TRUE(encoded);
+    auto reader = encoded->createReader(AudioInputStream::Reader::Policy::BLOCKING);
+    ASSERT_TRUE(reader);
+    expectEncodedFrame(reader.get(), 0);
+
+    writeSamples(FRAME_SIZE / 2);
+    uint8_t byte;
+    EXPECT_EQ(reader->read(&byte, 1, SHORT_TIMEOUT), AudioInputStream::Reader::Error::TIMEDOUT);
+
+    writeSamples(FRAME_SIZE / 2);
+    expectEncodedFrame(reader.get(), 1);
+
+    m_audioEncoder->stopEncoding(true);
+    EXPECT_EQ(reader->read(&byte, 1, TEST_TIMEOUT), AudioInputStream::Reader::Error::CLOSED);
+}
+
+/**
+ * Verify that stopping without @c stopImmediately encodes the audio written so far, padding the last frame with
+ * silence, and then closes the encoded stream.
+ */
+TEST_F(AudioEncoderTest, stopEncodingEncodesRemainingAudio) {
+    auto encoded = startEncoding();
+    ASSERT_TRUE(encoded);
+    auto reader = encoded->createReader(AudioInputStream::Reader::Policy::BLOCKING);
+    ASSERT_TRUE(reader);
+
+    writeSamples(FRAME_SIZE + FRAME_SIZE / 2);
+    m_audioEncoder->stopEncoding(false);
+    writeSamples(FRAME_SIZE);
+
+    expectEncodedFrame(reader.get(), 0);
+    expectEncodedFrame(reader.get(), 1, 0);
+    uint8_t byte;
+    EXPECT_EQ(reader->read(&byte, 1, TEST_TIMEOUT), AudioInputStream::Reader::Error::CLOSED);
+}
+
+/// Verify that stopping with @c stopImmediately closes the encoded stream without encoding a partial frame.
+TEST_F(AudioEncoderTest, stopEncodingImmediately) {
+    auto encoded = startEncoding();
+    ASSERT_TRUE(encoded);
+    auto reader = encoded->createReader(AudioInputStream::Reader::Policy::BLOCKING);
+    ASSERT_TRUE(reader);
+
+    EXPECT_CALL(*m_encoder, encode(_, _)).Times(0);
+    writeSamples(FRAME_SIZE / 2);
+    m_audioEncoder->stopEncoding(true);
+
+    uint8_t byte;
+    EXPECT_EQ(reader->read(&byte, 1, TEST_TIMEOUT), AudioInputStream::Reader::Error::CLOSED);
+}
+
+/// Verify that starting again stops the previous encoding and encodes from the new position.
+TEST_F(AudioEncoderTest, restartEncoding) {
+    auto first = startEncoding();
+    ASSERT_TRUE(first);
+    auto firstReader = first->createReader(AudioInputStream::Reader::Policy::BLOCKING);
+    ASSERT_TRUE(firstReader);
+
+    writeSamples(FRAME_SIZE);
+    expectEncodedFrame(firstReader.get(), 0);
+
+    auto second = startEncoding(AudioInputStream::Reader::Reference::BEFORE_WRITER);
+    ASSERT_TRUE(second);
+    auto secondReader = second->createReader(AudioInputStream::Reader::Policy::BLOCKING);
+    ASSERT_TRUE(secondReader);
+
+    uint8_t byte;
+    EXPECT_EQ(firstReader->read(&byte, 1, TEST_TIMEOUT), AudioInputStream::Reader::Error::CLOSED);
+    writeSamples(FRAME_SIZE);
+    expectEncodedFrame(secondReader.get(), 1);
+}
+
+/**
+ * Verify that starting again while the previous encoding is being drained lets the drain finish, so that the end of
+ * the previous audio is still encoded.
+ */
+TEST_F(AudioEncoderTest, restartEncodingAfterDrain) {
+    auto slowEncode = [](const int16_t* input, uint8_t* output) {
+        std::this_thread::sleep_for(SLOW_ENCODE_TIME);
+        std::memcpy(output, input, sizeof(int16_t));
+        std::memcpy(output + sizeof(int16_t), input + FRAME_SIZE - 1, sizeof(int16_t));
+        return static_cast<ssize_t>(ENCODED_FRAME_SIZE);
+    };
+    EXPECT_CALL(*m_encoder, encode(_, _)).WillRepeatedly(Invoke(slowEncode));
+
+    auto first = startEncoding();
+    ASSERT_TRUE(first);
+    auto firstReader = first->createReader(AudioInputStream::Reader::Policy::BLOCKING);
+    ASSERT_TRUE(firstReader);
+
+    const size_t frameCount = 5;
+    writeSamples(frameCount * FRAME_SIZE);
+    m_audioEncoder->stopEncoding(false);
+    auto second = startEncoding(AudioInputStream::Reader::Reference::BEFORE_WRITER);
+    ASSERT_TRUE(second);
+
+    for (size_t frame = 0; frame < frameCount; ++frame) {
+        expectEncodedFrame(firstReader.get(), frame);
+    }
+    uint8_t byte;
+    EXPECT_EQ(firstReader->read(&byte, 1, TEST_TIMEOUT), AudioInputStream::Reader::Error::CLOSED);
+}
+
+}  // namespace test
+}  // namespace aip
+}  // namespace capabilityAgents
+}  // namespace alexaClientSDK
@@ -17,8 +17,10 @@
 
 #include <cstring>
 #include <climits>
+#include <future>
 #include <numeric>
 #include <sstream>
+#include <thread>
 #include <vector>
 #include <gtest/gtest.h>
 
@@ -27,6 +29,7 @@
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
+#include <AVSCommon/SDKInterfaces/KeyWordObserverInterface.h>
 #include <AVSCommon/SDKInterfaces/MockDirectiveSequencer.h>
 #include <AVSCommon/SDKInterfaces/MockMessageSender.h>
 #include <AVSCommon/SDKInterfaces/MockContextManager.h>
@@ -37,9 +40,11 @@
 #include <AVSCommon/Utils/UUIDGeneration/UUIDGeneration.h>
 #include <AVSCommon/AVS/Attachment/MockAttachmentManager.h>
 #include <AVSCommon/Utils/JSON/JSONUtils.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
 #include <AVSCommon/Utils/Memory/Memory.h>
 
 #include "AIP/AudioInputProcessor.h"
+#include "MockAudioEncoder.h"
 #include "MockObserver.h"
 
 using namespace testing;
@@ -52,6 +57,16 @@ namespace test {
 
 using avsCommon::sdkInterfaces::AudioInputProcessorObserverInterface;
 
+/// String to identify log entries originating from this file.
+static const std::string TAG("AudioInputProcessorTest");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
 /// The name of the @c FocusManager channel used by @c AudioInputProvider.
 static const std::string CHANNEL_NAME = avsCommon::sdkInterfaces::FocusManagerInterface::DIALOG_CHANNEL_NAME;
 
@@ -208,6 +223,26 @@ static const bool VERIFY_TIMEOUT = true;
 /// General timeout for tests to fail.
 static const std::chrono::seconds TEST_TIMEOUT(10);
 
+/// The namespace of the only state in @c PREPARED_CONTEXT.
+static const std::string PREPARED_CONTEXT_NAMESPACE = "PreparedContext";
+
+/// A context which answers the request made by @c AudioInputProcessor::prepareRecognize().
+static const std::string PREPARED_CONTEXT =
+    R"({"context":[{"header":{"namespace":")" + PREPARED_CONTEXT_NAMESPACE + R"(","name":"State"},"payload":{}}]})";
+
+/// The namespace of the only state in @c RECOGNIZE_CONTEXT.
+static const std::string RECOGNIZE_CONTEXT_NAMESPACE = "RecognizeContext";
+
+/// A context which answers the request made by @c AudioInputProcessor::recognize().
+static const std::string RECOGNIZE_CONTEXT =
+    R"({"context":[{"header":{"namespace":")" + RECOGNIZE_CONTEXT_NAMESPACE + R"(","name":"State"},"payload":{}}]})";
+
+/// How long the context manager takes to answer a request for the context in @c measureKeywordToFirstAudioByte().
+static const std::chrono::milliseconds CONTEXT_DELAY(50);
+
+/// How long before the keyword a wake word engine reports its candidate in @c measureKeywordToFirstAudioByte().
+static const std::chrono::milliseconds KEYWORD_CANDIDATE_LEAD_TIME(100);
+
 /// JSON value for a ReportEchoSpatialPerceptionData event's name.
 static const std::string ESP_EVENT_NAME = "ReportEchoSpatialPerceptionData";
 
@@ -534,6 +569,48 @@ std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> RecognizeEvent::ge
     return m_reader->reader;
 }
 
+/**
+ * A keyword observer which passes keyword candidates and detections on to an @c AudioInputProcessor, as an application
+ * does.
+ */
+class KeywordForwarder : public avsCommon::sdkInterfaces::KeyWordObserverInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param audioInputProcessor The @c AudioInputProcessor to pass keywords on to.
+     * @param audioProvider The provider of the stream in which keywords are heard.
+     */
+    KeywordForwarder(std::shared_ptr<AudioInputProcessor> audioInputProcessor, const AudioProvider& audioProvider) :
+            m_audioInputProcessor{audioInputProcessor},
+            m_audioProvider{audioProvider} {
+    }
+
+    void onKeyWordDetected(
+        std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+        std::string keyword,
+        avsCommon::avs::AudioInputStream::Index beginIndex,
+        avsCommon::avs::AudioInputStream::Index endIndex,
+        std::shared_ptr<const std::vector<char>> KWDMetadata) override {
+        m_audioInputProcessor->recognize(m_audioProvider, Initiator::WAKEWORD, beginIndex, endIndex, keyword);
+    }
+
+    void onKeyWordCandidate(std::shared_ptr<avsCommon::avs::AudioInputStream> stream, std::string keyword) override {
+        m_audioInputProcessor->prepareRecognize(keyword);
+    }
+
+    void onKeyWordRejected(std::shared_ptr<avsCommon::avs::AudioInputStream> stream, std::string keyword) override {
+        m_audioInputProcessor->cancelPreparedRecognize();
+    }
+
+private:
+    /// The @c AudioInputProcessor to pass keywords on to.
+    std::shared_ptr<AudioInputProcessor> m_audioInputProcessor;
+
+    /// The provider of the stream in which keywords are heard.
+    AudioProvider m_audioProvider;
+};
+
 /// Class to monitor DialogUXStateAggregator for the @c THINKING state and automatically move it to @c IDLE.
 class TestDialogUXStateObserver : public avsCommon::sdkInterfaces::DialogUXStateObserverInterface {
 public:
@@ -633,6 +710,36 @@ protected:
      */
     bool testContextFailure(avsCommon::sdkInterfaces::ContextRequestError error);
 
+    /// Enumerate what happens to the context requested by @c prepareRecognize() during @c testPreparedRecognize().
+    enum class PreparedContextPoint {
+        /// The context arrives before @c recognize() is called.
+        BEFORE_RECOGNIZE,
+        /// The context arrives after @c recognize() is called.
+        AFTER_RECOGNIZE,
+        /// The preparation is cancelled before @c recognize() is called, and the context arrives afterwards.
+        CANCELLED
+    };
+
+    /**
+     * Function to call @c AudioInputProcessor::prepareRecognize() followed by a tap-initiated
+     * @c AudioInputProcessor::recognize(), and verify that the Recognize event is sent with the prepared context, or
+     * with a newly requested context if the preparation was cancelled.
+     *
+     * @param contextPoint What happens to the prepared context.
+     * @return @c true if the call works correctly, else @c false.
+     */
+    bool testPreparedRecognize(PreparedContextPoint contextPoint);
+
+    /**
+     * Function to report a keyword through a @c KeywordForwarder, optionally after a keyword candidate, and measure
+     * the time from the keyword until the first byte of audio is read from the attachment of the Recognize event, as
+     * the connection would read it to send it.  The context manager takes @c CONTEXT_DELAY to answer each request.
+     *
+     * @param reportCandidate Whether to report a keyword candidate @c KEYWORD_CANDIDATE_LEAD_TIME before the keyword.
+     * @param[out] latency The time from the keyword to the first byte of audio.
+     */
+    void measureKeywordToFirstAudioByte(bool reportCandidate, std::chrono::microseconds* latency);
+
     /**
      * Function to receive a StopCapture directive and verify that @c AudioInputProcessor responds to it
      * correctly.
@@ -1022,6 +1129,132 @@ bool AudioInputProcessorTest::testContextFailure(avsCommon::sdkInterfaces::Conte
     return false;
 }
 
+bool AudioInputProcessorTest::testPreparedRecognize(PreparedContextPoint contextPoint) {
+    std::mutex mutex;
+    std::condition_variable conditionVariable;
+    bool done = false;
+    RecognizeEvent recognize(*m_audioProvider, Initiator::TAP);
+    std::shared_ptr<avsCommon::sdkInterfaces::ContextRequesterInterface> preparedRequester;
+
+    {
+        // Enforce the sequence; the first request is made by prepareRecognize().
+        InSequence dummy;
+        EXPECT_CALL(*m_mockContextManager, getContext(_))
+            .WillOnce(Invoke([&](std::shared_ptr<avsCommon::sdkInterfaces::ContextRequesterInterface> requester) {
+                preparedRequester = requester;
+                if (PreparedContextPoint::BEFORE_RECOGNIZE == contextPoint) {
+                    requester->onContextAvailable(PREPARED_CONTEXT);
+                }
+            }));
+        if (PreparedContextPoint::CANCELLED == contextPoint) {
+            EXPECT_CALL(*m_mockContextManager, getContext(_)).WillOnce(InvokeWithoutArgs([this] {
+                m_audioInputProcessor->onContextAvailable(RECOGNIZE_CONTEXT);
+            }));
+        }
+    }
+    EXPECT_CALL(*m_mockUserActivityNotifier, onUserActive()).Times(2);
+    EXPECT_CALL(*m_mockObserver, onStateChanged(AudioInputProcessorObserverInterface::State::RECOGNIZING));
+    EXPECT_CALL(*m_mockFocusManager, acquireChannel(CHANNEL_NAME, _, NAMESPACE)).WillOnce(InvokeWithoutArgs([this] {
+        m_audioInputProcessor->onFocusChanged(avsCommon::avs::FocusState::FOREGROUND);
+        return true;
+    }));
+    EXPECT_CALL(*m_mockDirectiveSequencer, setDialogRequestId(_));
+    auto expectedNamespace =
+        PreparedContextPoint::CANCELLED == contextPoint ? RECOGNIZE_CONTEXT_NAMESPACE : PREPARED_CONTEXT_NAMESPACE;
+    EXPECT_CALL(*m_mockMessageSender, sendMessage(_))
+        .WillOnce(Invoke([&, expectedNamespace](std::shared_ptr<avsCommon::avs::MessageRequest> request) {
+            EXPECT_NE(request->getJsonContent().find(expectedNamespace), std::string::npos);
+            std::lock_guard<std::mutex> lock(mutex);
+            done = true;
+            conditionVariable.notify_one();
+        }));
+
+    m_audioInputProcessor->prepareRecognize();
+    if (PreparedContextPoint::CANCELLED == contextPoint) {
+        m_audioInputProcessor->cancelPreparedRecognize();
+    }
+    if (!recognize.send(m_audioInputProcessor).get()) {
+        return false;
+    }
+    // recognize() is executed after prepareRecognize(), so the prepared context has been requested by now.
+    if (!preparedRequester) {
+        return false;
+    }
+    if (PreparedContextPoint::BEFORE_RECOGNIZE != contextPoint) {
+        preparedRequester->onContextAvailable(PREPARED_CONTEXT);
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    return conditionVariable.wait_for(lock, TEST_TIMEOUT, [&done] { return done; });
+}
+
+void AudioInputProcessorTest::measureKeywordToFirstAudioByte(
+    bool reportCandidate,
+    std::chrono::microseconds* latency) {
+    std::mutex mutex;
+    std::condition_variable conditionVariable;
+    bool done = false;
+    std::chrono::steady_clock::time_point firstByteTime;
+    std::vector<std::thread> contextThreads;
+    auto forwarder = std::make_shared<KeywordForwarder>(m_audioInputProcessor, *m_audioProvider);
+
+    EXPECT_CALL(*m_mockContextManager, setState(RECOGNIZER_STATE, _, _, _))
+        .WillRepeatedly(Return(avsCommon::sdkInterfaces::SetStateResult::SUCCESS));
+    EXPECT_CALL(*m_mockContextManager, getContext(_))
+        .WillRepeatedly(Invoke([&](std::shared_ptr<avsCommon::sdkInterfaces::ContextRequesterInterface> requester) {
+            contextThreads.emplace_back([requester, reportCandidate] {
+                std::this_thread::sleep_for(CONTEXT_DELAY);
+                requester->onContextAvailable(reportCandidate ? PREPARED_CONTEXT : RECOGNIZE_CONTEXT);
+            });
+        }));
+    EXPECT_CALL(*m_mockUserActivityNotifier, onUserActive()).Times(AnyNumber());
+    EXPECT_CALL(*m_mockObserver, onStateChanged(_)).Times(AnyNumber());
+    EXPECT_CALL(*m_mockFocusManager, acquireChannel(CHANNEL_NAME, _, NAMESPACE)).WillOnce(InvokeWithoutArgs([this] {
+        m_audioInputProcessor->onFocusChanged(avsCommon::avs::FocusState::FOREGROUND);
+        return true;
+    }));
+    EXPECT_CALL(*m_mockFocusManager, releaseChannel(CHANNEL_NAME, _)).Times(AnyNumber());
+    EXPECT_CALL(*m_mockDirectiveSequencer, setDialogRequestId(_));
+    EXPECT_CALL(*m_mockMessageSender, sendMessage(_))
+        .WillOnce(Invoke([&](std::shared_ptr<avsCommon::avs::MessageRequest> request) {
+            auto expectedNamespace = reportCandidate ? PREPARED_CONTEXT_NAMESPACE : RECOGNIZE_CONTEXT_NAMESPACE;
+            EXPECT_NE(request->getJsonContent().find(expectedNamespace), std::string::npos);
+            ASSERT_GT(request->attachmentReadersCount(), 0);
+            auto audio = request->getAttachmentReader(request->attachmentReadersCount() - 1);
+            ASSERT_NE(audio, nullptr);
+            Sample sample;
+            auto status = avsCommon::avs::attachment::AttachmentReader::ReadStatus::OK;
+            ASSERT_EQ(audio->reader->read(&sample, sizeof(sample), &status), sizeof(sample));
+            std::lock_guard<std::mutex> lock(mutex);
+            firstByteTime = std::chrono::steady_clock::now();
+            done = true;
+            conditionVariable.notify_one();
+        }));
+
+    // The keyword and the audio before it are already in the stream when the wake word engine reports them.
+    auto begin = m_writer->tell();
+    EXPECT_EQ(m_writer->write(m_pattern.data(), m_pattern.size()), static_cast<ssize_t>(m_pattern.size()));
+    if (reportCandidate) {
+        forwarder->onKeyWordCandidate(m_audioProvider->stream, KEYWORD_TEXT);
+        std::this_thread::sleep_for(KEYWORD_CANDIDATE_LEAD_TIME);
+    }
+    auto keywordTime = std::chrono::steady_clock::now();
+    forwarder->onKeyWordDetected(
+        m_audioProvider->stream, KEYWORD_TEXT, begin + PREROLL_WORDS, begin + PREROLL_WORDS + WAKEWORD_WORDS, nullptr);
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        EXPECT_TRUE(conditionVariable.wait_for(lock, TEST_TIMEOUT, [&done] { return done; }));
+        *latency = std::chrono::duration_cast<std::chrono::microseconds>(firstByteTime - keywordTime);
+    }
+    m_audioInputProcessor->resetState().wait();
+    for (auto& thread : contextThreads) {
+        thread.join();
+    }
+    Mock::VerifyAndClearExpectations(m_mockContextManager.get());
+    Mock::VerifyAndClearExpectations(m_mockFocusManager.get());
+    Mock::VerifyAndClearExpectations(m_mockMessageSender.get());
+}
+
 bool AudioInputProcessorTest::testStopCaptureDirectiveSucceeds(bool withDialogRequestId) {
     std::mutex mutex;
     std::condition_variable conditionVariable;
@@ -1834,6 +2067,117 @@ TEST_F(AudioInputProcessorTest, contextFailureBuildContextError) {
     ASSERT_TRUE(testContextFailure(avsCommon::sdkInterfaces::ContextRequestError::BUILD_CONTEXT_ERROR));
 }
 
+/**
+ * This function verifies that a Recognize event uses the context gathered by @c AudioInputProcessor::prepareRecognize()
+ * instead of requesting a new one, when the context arrives before @c AudioInputProcessor::recognize() is called.
+ */
+TEST_F(AudioInputProcessorTest, recognizeUsesPreparedContext) {
+    ASSERT_TRUE(testPreparedRecognize(PreparedContextPoint::BEFORE_RECOGNIZE));
+}
+
+/**
+ * This function verifies that a Recognize event waits for the context gathered by
+ * @c AudioInputProcessor::prepareRecognize() instead of requesting a new one, when the context arrives after
+ * @c AudioInputProcessor::recognize() is called.
+ */
+TEST_F(AudioInputProcessorTest, recognizeWaitsForPreparedContext) {
+    ASSERT_TRUE(testPreparedRecognize(PreparedContextPoint::AFTER_RECOGNIZE));
+}
+
+/**
+ * This function verifies that a Recognize event requests a new context after
+ * @c AudioInputProcessor::cancelPreparedRecognize(), and that the cancelled context is ignored when it arrives.
+ */
+TEST_F(AudioInputProcessorTest, recognizeIgnoresCancelledPreparedContext) {
+    ASSERT_TRUE(testPreparedRecognize(PreparedContextPoint::CANCELLED));
+}
+
+/**
+ * This function measures the time from a keyword detection to the first byte of audio read from the Recognize event,
+ * with and without a keyword candidate reported beforehand, and verifies that a candidate takes the context request out
+ * of that time.
+ */
+TEST_F(AudioInputProcessorTest, keywordToFirstAudioByteWithCandidate) {
+    std::chrono::microseconds latency;
+    std::chrono::microseconds candidateLatency;
+    measureKeywordToFirstAudioByte(false, &latency);
+    measureKeywordToFirstAudioByte(true, &candidateLatency);
+    ACSDK_INFO(LX("keywordToFirstAudioByte")
+                   .d("latencyUs", latency.count())
+                   .d("withKeywordCandidateLatencyUs", candidateLatency.count()));
+    EXPECT_GE(latency, CONTEXT_DELAY);
+    EXPECT_LT(candidateLatency, CONTEXT_DELAY);
+}
+
+/**
+ * This function verifies that an @c AudioInputProcessor created with an encoder sends a Recognize event in the
+ * encoder's format, with the encoded audio as its attachment.
+ */
+TEST_F(AudioInputProcessorTest, recognizeStreamsEncodedAudio) {
+    auto encoder = std::make_shared<NiceMock<MockAudioEncoder>>();
+    EXPECT_CALL(*m_mockContextManager, setStateProvider(RECOGNIZER_STATE, Ne(nullptr)));
+    auto audioInputProcessor = AudioInputProcessor::create(
+        m_mockDirectiveSequencer,
+        m_mockMessageSender,
+        m_mockContextManager,
+        m_mockFocusManager,
+        m_dialogUXStateAggregator,
+        m_mockExceptionEncounteredSender,
+        m_mockUserActivityNotifier,
+        *m_audioProvider,
+        encoder);
+    ASSERT_NE(audioInputProcessor, nullptr);
+
+    std::promise<std::shared_ptr<avsCommon::avs::MessageRequest>> sentRequest;
+    EXPECT_CALL(*m_mockContextManager, getContext(_)).WillOnce(InvokeWithoutArgs([&audioInputProcessor] {
+        audioInputProcessor->onContextAvailable(RECOGNIZE_CONTEXT);
+    }));
+    EXPECT_CALL(*m_mockUserActivityNotifier, onUserActive()).Times(2);
+    EXPECT_CALL(*m_mockFocusManager, acquireChannel(CHANNEL_NAME, _, NAMESPACE))
+        .WillOnce(InvokeWithoutArgs([&audioInputProcessor] {
+            audioInputProcessor->onFocusChanged(avsCommon::avs::FocusState::FOREGROUND);
+            return true;
+        }));
+    EXPECT_CALL(*m_mockDirectiveSequencer, setDialogRequestId(_));
+    EXPECT_CALL(*m_mockMessageSender, sendMessage(_))
+        .WillOnce(Invoke([&sentRequest](std::shared_ptr<avsCommon::avs::MessageRequest> request) {
+            sentRequest.set_value(request);
+        }));
+
+    ASSERT_TRUE(audioInputProcessor->recognize(*m_audioProvider, Initiator::TAP).get());
+    auto requestFuture = sentRequest.get_future();
+    ASSERT_EQ(requestFuture.wait_for(TEST_TIMEOUT), std::future_status::ready);
+    auto request = requestFuture.get();
+    rapidjson::Document document;
+    document.Parse(request->getJsonContent().c_str());
+    auto payload = document.FindMember(MESSAGE_EVENT_KEY)->value.FindMember(MESSAGE_PAYLOAD_KEY);
+    EXPECT_EQ(getJsonString(payload->value, AUDIO_FORMAT_KEY), "MOCK");
+
+    // Write one frame, and expect its first and last samples as the encoded audio.
+    size_t frameSize = MockAudioEncoder::FRAME_SIZE;
+    EXPECT_EQ(m_writer->write(m_pattern.data(), frameSize), static_cast<ssize_t>(frameSize));
+    auto reader = request->getAttachmentReader(request->attachmentReadersCount() - 1)->reader;
+    Sample encoded[2];
+    size_t bytesRead = 0;
+    auto deadline = std::chrono::steady_clock::now() + TEST_TIMEOUT;
+    while (bytesRead < sizeof(encoded) && std::chrono::steady_clock::now() < deadline) {
+        avsCommon::avs::attachment::AttachmentReader::ReadStatus status;
+        auto result =
+            reader->read(reinterpret_cast<uint8_t*>(encoded) + bytesRead, sizeof(encoded) - bytesRead, &status);
+        if (0 == result) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        bytesRead += result;
+    }
+    ASSERT_EQ(bytesRead, sizeof(encoded));
+    EXPECT_EQ(encoded[0], m_pattern[0]);
+    EXPECT_EQ(encoded[1], m_pattern[frameSize - 1]);
+
+    EXPECT_CALL(*m_mockFocusManager, releaseChannel(CHANNEL_NAME, _));
+    audioInputProcessor->resetState().wait();
+    audioInputProcessor->shutdown();
+}
+
 /// This function verifies that StopCapture directives fail in @c State::IDLE.
 TEST_F(AudioInputProcessorTest, preHandleAndHandleDirectiveStopCaptureWhenIdle) {
     ASSERT_TRUE(testStopCaptureDirectiveFails(WITH_DIALOG_REQUEST_ID));
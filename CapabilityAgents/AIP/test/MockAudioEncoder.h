@@ -0,0 +1,68 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_CAPABILITYAGENTS_AIP_TEST_MOCKAUDIOENCODER_H_
+#define ALEXA_CLIENT_SDK_CAPABILITYAGENTS_AIP_TEST_MOCKAUDIOENCODER_H_
+
+#include <cstring>
+
+#include <gmock/gmock.h>
+
+#include "AIP/AudioEncoderInterface.h"
+
+namespace alexaClientSDK {
+namespace capabilityAgents {
+namespace aip {
+namespace test {
+
+/**
+ * Mock class that implements the @c AudioEncoderInterface.  By default it accepts any format and "encodes" each frame
+ * of @c FRAME_SIZE samples into @c ENCODED_FRAME_SIZE bytes: the first and the last sample of the frame.
+ */
+class MockAudioEncoder : public AudioEncoderInterface {
+public:
+    /// The number of samples in each frame.
+    static const size_t FRAME_SIZE = 160;
+
+    /// The size of each encoded frame.
+    static const size_t ENCODED_FRAME_SIZE = 2 * sizeof(int16_t);
+
+    /// Constructor, which sets up the default behavior.
+    MockAudioEncoder() {
+        using namespace testing;
+        ON_CALL(*this, init(_)).WillByDefault(Return(true));
+        ON_CALL(*this, getInputFrameSize()).WillByDefault(Return(FRAME_SIZE));
+        ON_CALL(*this, getMaxOutputFrameSize()).WillByDefault(Return(ENCODED_FRAME_SIZE));
+        ON_CALL(*this, getAVSFormatName()).WillByDefault(Return("MOCK"));
+        ON_CALL(*this, encode(_, _)).WillByDefault(Invoke([](const int16_t* input, uint8_t* output) {
+            std::memcpy(output, input, sizeof(int16_t));
+            std::memcpy(output + sizeof(int16_t), input + FRAME_SIZE - 1, sizeof(int16_t));
+            return static_cast<ssize_t>(ENCODED_FRAME_SIZE);
+        }));
+    }
+
+    MOCK_METHOD1(init, bool(const avsCommon::utils::AudioFormat& inputFormat));
+    MOCK_CONST_METHOD0(getInputFrameSize, size_t());
+    MOCK_CONST_METHOD0(getMaxOutputFrameSize, size_t());
+    MOCK_METHOD2(encode, ssize_t(const int16_t* input, uint8_t* output));
+    MOCK_CONST_METHOD0(getAVSFormatName, std::string());
+};
+
+}  // namespace test
+}  // namespace aip
+}  // namespace capabilityAgents
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_CAPABILITYAGENTS_AIP_TEST_MOCKAUDIOENCODER_H_
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file OpusAudioEncoderTest.cpp
+
+#include <gtest/gtest.h>
+
+#ifdef OPUS_ENCODER
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <opus.h>
+
+#include "AIP/OpusAudioEncoder.h"
+
+namespace alexaClientSDK {
+namespace capabilityAgents {
+namespace aip {
+namespace test {
+
+using namespace avsCommon::utils;
+
+/// The format of the PCM audio AVS accepts, which is what @c OpusAudioEncoder encodes.
+static const AudioFormat PCM_FORMAT = {AudioFormat::Encoding::LPCM, AudioFormat::Endianness::LITTLE, 16000, 16, 1};
+
+/// The sample rate of @c PCM_FORMAT.
+static const int SAMPLE_RATE_HZ = 16000;
+
+/// The number of 20 ms frames encoded in the round trip, which is one second of audio.
+static const size_t FRAME_COUNT = 50;
+
+/// The frequency of the tone encoded in the round trip.
+static const double TONE_HZ = 440.0;
+
+/// The amplitude of the tone encoded in the round trip.
+static const double TONE_AMPLITUDE = 8000.0;
+
+/// The longest delay through the encoder and decoder searched for when lining up the decoded audio with the input.
+static const size_t MAX_CODEC_DELAY = 480;
+
+/// The lowest signal to noise ratio accepted for the decoded tone, in dB.
+static const double MIN_SNR_DB = 10.0;
+
+/// Verify that the encoder only accepts the audio AVS expects, 16 kHz 16-bit mono little endian PCM.
+TEST(OpusAudioEncoderTest, initChecksFormat) {
+    auto encoder = OpusAudioEncoder::create();
+    ASSERT_TRUE(encoder);
+    EXPECT_TRUE(encoder->init(PCM_FORMAT));
+    EXPECT_EQ(encoder->getAVSFormatName(), "OPUS");
+
+    auto format = PCM_FORMAT;
+    format.sampleRateHz = 32000;
+    EXPECT_FALSE(encoder->init(format));
+    format = PCM_FORMAT;
+    format.numChannels = 2;
+    EXPECT_FALSE(encoder->init(format));
+}
+
+/**
+ * Encode a second of a tone, decode it again with libopus, and verify that every frame has the constant size AVS
+ * expects and that the decoded audio is the tone.
+ */
+TEST(OpusAudioEncoderTest, roundTrip) {
+    auto encoder = OpusAudioEncoder::create();
+    ASSERT_TRUE(encoder);
+    ASSERT_TRUE(encoder->init(PCM_FORMAT));
+    auto frameSize = encoder->getInputFrameSize();
+    ASSERT_EQ(frameSize, static_cast<size_t>(SAMPLE_RATE_HZ / 50));
+
+    std::vector<int16_t> input(frameSize * FRAME_COUNT);
+    for (size_t i = 0; i < input.size(); ++i) {
+        input[i] = static_cast<int16_t>(TONE_AMPLITUDE * std::sin(2 * M_PI * TONE_HZ * i / SAMPLE_RATE_HZ));
+    }
+
+    int error = OPUS_OK;
+    auto decoder = opus_decoder_create(SAMPLE_RATE_HZ, PCM_FORMAT.numChannels, &error);
+    ASSERT_EQ(error, OPUS_OK);
+    ASSERT_NE(decoder, nullptr);
+
+    std::vector<uint8_t> encoded(encoder->getMaxOutputFrameSize());
+    std::vector<int16_t> decoded(input.size());
+    for (size_t frame = 0; frame < FRAME_COUNT; ++frame) {
+        auto encodedSize = encoder->encode(&input[frame * frameSize], encoded.data());
+        ASSERT_EQ(encodedSize, static_cast<ssize_t>(encoder->getMaxOutputFrameSize()));
+        auto decodedSize = opus_decode(
+            decoder, encoded.data(), encodedSize, &decoded[frame * frameSize], static_cast<int>(frameSize), 0);
+        ASSERT_EQ(decodedSize, static_cast<int>(frameSize));
+    }
+    opus_decoder_destroy(decoder);
+
+    // Compare the second half of the audio, once the codec has settled, at the delay which lines it up best.
+    double bestSnrDb = -INFINITY;
+    for (size_t delay = 0; delay <= MAX_CODEC_DELAY; ++delay) {
+        double signal = 0;
+        double noise = 0;
+        for (size_t i = input.size() / 2; i < input.size(); ++i) {
+            double expected = input[i - delay];
+            double difference = decoded[i] - expected;
+            signal += expected * expected;
+            noise += difference * difference;
+        }
+        bestSnrDb = std::max(bestSnrDb, 10 * std::log10(signal / std::max(noise, 1.0)));
+    }
+    EXPECT_GE(bestSnrDb, MIN_SNR_DB);
+}
+
+}  // namespace test
+}  // namespace aip
+}  // namespace capabilityAgents
+}  // namespace alexaClientSDK
+
+#endif  // OPUS_ENCODER
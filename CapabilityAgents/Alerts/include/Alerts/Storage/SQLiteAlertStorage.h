@@ -93,10 +93,13 @@ private:
      *
      * @param dbFilePath The location of the SQLite database file.
      * @param alertsAudioFactory A factory that can produce default alert sounds.
+     * @param maxCommitDelay The longest a write may wait to be committed, or zero to commit every write straight
+     * away.  See @c SQLiteDatabase.
      */
     SQLiteAlertStorage(
         const std::string& dbFilePath,
-        const std::shared_ptr<avsCommon::sdkInterfaces::audio::AlertsAudioFactoryInterface>& alertsAudioFactory);
+        const std::shared_ptr<avsCommon::sdkInterfaces::audio::AlertsAudioFactoryInterface>& alertsAudioFactory,
+        std::chrono::milliseconds maxCommitDelay);
 
     /**
      * Utility function to migrate an existing V1 Alerts database file to the V2 format.
@@ -287,14 +287,16 @@ std::unique_ptr<SQLiteAlertStorage> SQLiteAlertStorage::create(
         return nullptr;
     }
 
-    return std::unique_ptr<SQLiteAlertStorage>(new SQLiteAlertStorage(alertDbFilePath, alertsAudioFactory));
+    return std::unique_ptr<SQLiteAlertStorage>(new SQLiteAlertStorage(
+        alertDbFilePath, alertsAudioFactory, SQLiteDatabase::getMaxCommitDelay(alertsConfigurationRoot)));
 }
 
 SQLiteAlertStorage::SQLiteAlertStorage(
     const std::string& dbFilePath,
-    const std::shared_ptr<avsCommon::sdkInterfaces::audio::AlertsAudioFactoryInterface>& alertsAudioFactory) :
+    const std::shared_ptr<avsCommon::sdkInterfaces::audio::AlertsAudioFactoryInterface>& alertsAudioFactory,
+    std::chrono::milliseconds maxCommitDelay) :
         m_alertsAudioFactory{alertsAudioFactory},
-        m_db{dbFilePath} {
+        m_db{dbFilePath, maxCommitDelay} {
 }
 
 SQLiteAlertStorage::~SQLiteAlertStorage() {
@@ -108,6 +108,7 @@ public:
     void onPlaybackResumed(SourceId id) override;
     void onBufferUnderrun(SourceId id) override;
     void onBufferRefilled(SourceId id) override;
+    void onPlaybackNearlyFinished(SourceId id) override;
     void onTags(SourceId id, std::unique_ptr<const VectorOfTags> vectorOfTags) override;
     /// @}
 
@@ -149,13 +150,13 @@ private:
     /// @}
 
     /**
-     * This function deserializes a @c Directive's payload into a @c rapidjson::Document.
+     * This function gets a @c Directive's parsed payload, and reports the directive as failed if it is not a JSON
+     * object.
      *
-     * @param info The @c DirectiveInfo to read the payload string from.
-     * @param[out] document The @c rapidjson::Document to parse the payload into.
-     * @return @c true if parsing was successful, else @c false.
+     * @param info The @c DirectiveInfo to read the payload from.
+     * @return The parsed payload, which remains valid while @c info is held, or @c nullptr if it is not an object.
      */
-    bool parseDirectivePayload(std::shared_ptr<DirectiveInfo> info, rapidjson::Document* document);
+    const rapidjson::Value* getDirectivePayload(std::shared_ptr<DirectiveInfo> info);
 
     /**
      * This function handles a @c PLAY directive.
@@ -256,6 +257,9 @@ private:
     /// @copydoc MediaPlayerObserverInterface::onBufferRefilled()
     void executeOnBufferRefilled(SourceId id);
 
+    /// @copydoc MediaPlayerObserverInterface::onPlaybackNearlyFinished()
+    void executeOnPlaybackNearlyFinished(SourceId id);
+
     /// @copydoc MediaPlayerObserverInterface::onTags()
     void executeOnTags(SourceId id, std::shared_ptr<const VectorOfTags> vectorOfTags);
 
@@ -270,6 +274,37 @@ private:
     /// This fuction plays the next @c AudioItem in the queue.
     void playNextItem();
 
+    /**
+     * This function makes the next @c AudioItem in the queue current once @c MediaPlayer has switched to the source
+     * prepared for it by @c prepareNextItem().  The @c MediaPlayer starts that source on its own, so there is no
+     * @c setSource() or @c play() call.
+     */
+    void playPreparedItem();
+
+    /**
+     * This function starts the progress report timers for an @c AudioItem which has just started to play.
+     *
+     * @param item The @c AudioItem.
+     */
+    void startProgressReportTimers(const AudioItem& item);
+
+    /**
+     * This function sends the @c PlaybackNearlyFinished event for the current @c AudioItem, once, and then prepares
+     * the next @c AudioItem in the queue.
+     */
+    void handlePlaybackNearlyFinished();
+
+    /**
+     * This function asks @c MediaPlayer to pre-roll the next @c AudioItem in the queue, so that it plays without a gap
+     * after the current one.  Nothing is prepared before the current @c AudioItem is nearly finished, or when the next
+     * @c AudioItem has already been prepared.  @c AudioItems which start at an offset, or which are read from an
+     * attachment, are left to @c playNextItem().
+     */
+    void prepareNextItem();
+
+    /// This function discards the @c AudioItem prepared by @c prepareNextItem(), before the queue changes.
+    void cancelPreparedItem();
+
     /**
      * This function stops playback of the current song, and optionally starts the next queued song.
      *
@@ -438,6 +473,18 @@ private:
     /// The id of the currently (or most recently) playing @c MediaPlayer source.
     SourceId m_sourceId;
 
+    /**
+     * The id of the @c MediaPlayer source prepared for the @c AudioItem at the front of the queue, or
+     * @c MediaPlayerInterface::ERROR if it has not been prepared.
+     */
+    SourceId m_preparedSourceId;
+
+    /// Whether @c MediaPlayer has reported that the current source is nearly finished.
+    bool m_isPlaybackNearlyFinished;
+
+    /// Whether the @c PlaybackNearlyFinished event has been sent for the current @c AudioItem.
+    bool m_isPlaybackNearlyFinishedSent;
+
     /// When in the @c BUFFER_UNDERRUN state, this records the time at which the state was entered.
     std::chrono::steady_clock::time_point m_bufferUnderrunTimestamp;
 
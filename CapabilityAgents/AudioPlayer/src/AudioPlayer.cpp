@@ -19,7 +19,6 @@
 
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
-#include <rapidjson/error/en.h>
 
 #include <AVSCommon/AVS/CapabilityConfiguration.h>
 #include <AVSCommon/Utils/JSON/JSONUtils.h>
@@ -140,7 +139,7 @@ void AudioPlayer::provideState(
     const avsCommon::avs::NamespaceAndName& stateProviderName,
     unsigned int stateRequestToken) {
     ACSDK_DEBUG(LX("provideState").d("stateRequestToken", stateRequestToken));
-    m_executor.submit([this, stateRequestToken] { executeProvideState(true, stateRequestToken); });
+    m_executor.execute([this, stateRequestToken] { executeProvideState(true, stateRequestToken); });
 }
 
 void AudioPlayer::handleDirectiveImmediately(std::shared_ptr<AVSDirective> directive) {
@@ -183,7 +182,7 @@ void AudioPlayer::cancelDirective(std::shared_ptr<DirectiveInfo> info) {
 
 void AudioPlayer::onDeregistered() {
     ACSDK_DEBUG(LX("onDeregistered"));
-    m_executor.submit([this] {
+    m_executor.execute([this] {
         executeStop();
         m_audioItems.clear();
     });
@@ -199,7 +198,7 @@ DirectiveHandlerConfiguration AudioPlayer::getConfiguration() const {
 
 void AudioPlayer::onFocusChanged(FocusState newFocus) {
     ACSDK_DEBUG(LX("onFocusChanged").d("newFocus", newFocus));
-    m_executor.submit([this, newFocus] { executeOnFocusChanged(newFocus); });
+    m_executor.execute([this, newFocus] { executeOnFocusChanged(newFocus); });
 
     switch (newFocus) {
         case FocusState::FOREGROUND:
@@ -265,42 +264,47 @@ void AudioPlayer::onFocusChanged(FocusState newFocus) {
 
 void AudioPlayer::onPlaybackStarted(SourceId id) {
     ACSDK_DEBUG(LX("onPlaybackStarted").d("id", id));
-    m_executor.submit([this, id] { executeOnPlaybackStarted(id); });
+    m_executor.execute([this, id] { executeOnPlaybackStarted(id); });
 }
 
 void AudioPlayer::onPlaybackStopped(SourceId id) {
     ACSDK_DEBUG(LX("onPlaybackStopped").d("id", id));
-    m_executor.submit([this, id] { executeOnPlaybackStopped(id); });
+    m_executor.execute([this, id] { executeOnPlaybackStopped(id); });
 }
 
 void AudioPlayer::onPlaybackFinished(SourceId id) {
     ACSDK_DEBUG(LX("onPlaybackFinished").d("id", id));
-    m_executor.submit([this, id] { executeOnPlaybackFinished(id); });
+    m_executor.execute([this, id] { executeOnPlaybackFinished(id); });
 }
 
 void AudioPlayer::onPlaybackError(SourceId id, const ErrorType& type, std::string error) {
     ACSDK_DEBUG(LX("onPlaybackError").d("type", type).d("error", error).d("id", id));
-    m_executor.submit([this, id, type, error] { executeOnPlaybackError(id, type, error); });
+    m_executor.execute([this, id, type, error] { executeOnPlaybackError(id, type, error); });
 }
 
 void AudioPlayer::onPlaybackPaused(SourceId id) {
     ACSDK_DEBUG(LX("onPlaybackPaused").d("id", id));
-    m_executor.submit([this, id] { executeOnPlaybackPaused(id); });
+    m_executor.execute([this, id] { executeOnPlaybackPaused(id); });
 }
 
 void AudioPlayer::onPlaybackResumed(SourceId id) {
     ACSDK_DEBUG(LX("onPlaybackResumed").d("id", id));
-    m_executor.submit([this, id] { executeOnPlaybackResumed(id); });
+    m_executor.execute([this, id] { executeOnPlaybackResumed(id); });
 }
 
 void AudioPlayer::onBufferUnderrun(SourceId id) {
     ACSDK_DEBUG(LX("onBufferUnderrun").d("id", id));
-    m_executor.submit([this, id] { executeOnBufferUnderrun(id); });
+    m_executor.execute([this, id] { executeOnBufferUnderrun(id); });
 }
 
 void AudioPlayer::onBufferRefilled(SourceId id) {
     ACSDK_DEBUG(LX("onBufferRefilled").d("id", id));
-    m_executor.submit([this, id] { executeOnBufferRefilled(id); });
+    m_executor.execute([this, id] { executeOnBufferRefilled(id); });
+}
+
+void AudioPlayer::onPlaybackNearlyFinished(SourceId id) {
+    ACSDK_DEBUG(LX("onPlaybackNearlyFinished").d("id", id));
+    m_executor.execute([this, id] { executeOnPlaybackNearlyFinished(id); });
 }
 
 void AudioPlayer::onTags(SourceId id, std::unique_ptr<const VectorOfTags> vectorOfTags) {
@@ -310,7 +314,7 @@ void AudioPlayer::onTags(SourceId id, std::unique_ptr<const VectorOfTags> vector
         return;
     }
     std::shared_ptr<const VectorOfTags> sharedVectorOfTags(std::move(vectorOfTags));
-    m_executor.submit([this, id, sharedVectorOfTags] { executeOnTags(id, sharedVectorOfTags); });
+    m_executor.execute([this, id, sharedVectorOfTags] { executeOnTags(id, sharedVectorOfTags); });
 }
 
 void AudioPlayer::addObserver(std::shared_ptr<avsCommon::sdkInterfaces::AudioPlayerObserverInterface> observer) {
@@ -319,7 +323,7 @@ void AudioPlayer::addObserver(std::shared_ptr<avsCommon::sdkInterfaces::AudioPla
         ACSDK_ERROR(LX("addObserver").m("Observer is null."));
         return;
     }
-    m_executor.submit([this, observer] {
+    m_executor.execute([this, observer] {
         if (!m_observers.insert(observer).second) {
             ACSDK_ERROR(LX("addObserver").m("Duplicate observer."));
         }
@@ -332,7 +336,7 @@ void AudioPlayer::removeObserver(std::shared_ptr<avsCommon::sdkInterfaces::Audio
         ACSDK_ERROR(LX("removeObserver").m("Observer is null."));
         return;
     }
-    m_executor.submit([this, observer] {
+    m_executor.execute([this, observer] {
         if (m_observers.erase(observer) == 0) {
             ACSDK_WARN(LX("removeObserver").m("Nonexistent observer."));
         }
@@ -363,6 +367,9 @@ AudioPlayer::AudioPlayer(
         m_focus{FocusState::NONE},
         m_initialOffset{0},
         m_sourceId{MediaPlayerInterface::ERROR},
+        m_preparedSourceId{MediaPlayerInterface::ERROR},
+        m_isPlaybackNearlyFinished{false},
+        m_isPlaybackNearlyFinishedSent{false},
         m_offset{std::chrono::milliseconds{std::chrono::milliseconds::zero()}},
         m_isStopCalled{false} {
     m_capabilityConfigurations.insert(getAudioPlayerCapabilityConfiguration());
@@ -390,36 +397,35 @@ void AudioPlayer::doShutdown() {
     m_playbackRouter.reset();
 }
 
-bool AudioPlayer::parseDirectivePayload(std::shared_ptr<DirectiveInfo> info, rapidjson::Document* document) {
-    rapidjson::ParseResult result = document->Parse(info->directive->getPayload());
-    if (result) {
-        return true;
+const rapidjson::Value* AudioPlayer::getDirectivePayload(std::shared_ptr<DirectiveInfo> info) {
+    auto payload = info->directive->getPayloadValue();
+    if (payload && payload->IsObject()) {
+        return payload;
     }
 
-    ACSDK_ERROR(LX("parseDirectivePayloadFailed")
-                    .d("reason", rapidjson::GetParseError_En(result.Code()))
-                    .d("offset", result.Offset())
+    ACSDK_ERROR(LX("getDirectivePayloadFailed")
+                    .d("reason", payload ? "payloadNotAnObject" : "parseFailed")
                     .d("messageId", info->directive->getMessageId()));
     sendExceptionEncounteredAndReportFailed(
         info, "Unable to parse payload", ExceptionErrorType::UNEXPECTED_INFORMATION_RECEIVED);
-    return false;
+    return nullptr;
 }
 
 void AudioPlayer::handlePlayDirective(std::shared_ptr<DirectiveInfo> info) {
     ACSDK_DEBUG1(LX("handlePlayDirective"));
     ACSDK_DEBUG9(LX("PLAY").d("payload", info->directive->getPayload()));
-    rapidjson::Document payload;
-    if (!parseDirectivePayload(info, &payload)) {
+    auto payload = getDirectivePayload(info);
+    if (!payload) {
         return;
     }
 
     PlayBehavior playBehavior;
-    if (!jsonUtils::retrieveValue(payload, "playBehavior", &playBehavior)) {
+    if (!jsonUtils::retrieveValue(*payload, "playBehavior", &playBehavior)) {
         playBehavior = PlayBehavior::ENQUEUE;
     }
 
     rapidjson::Value::ConstMemberIterator audioItemJson;
-    if (!jsonUtils::findNode(payload, "audioItem", &audioItemJson)) {
+    if (!jsonUtils::findNode(*payload, "audioItem", &audioItemJson)) {
         ACSDK_ERROR(LX("handlePlayDirectiveFailed")
                         .d("reason", "missingAudioItem")
                         .d("messageId", info->directive->getMessageId()));
@@ -529,29 +535,29 @@ void AudioPlayer::handlePlayDirective(std::shared_ptr<DirectiveInfo> info) {
     //     playback; we don't wait for playback to complete.
     setHandlingCompleted(info);
 
-    m_executor.submit([this, playBehavior, audioItem] { executePlay(playBehavior, audioItem); });
+    m_executor.execute([this, playBehavior, audioItem] { executePlay(playBehavior, audioItem); });
 }
 
 void AudioPlayer::handleStopDirective(std::shared_ptr<DirectiveInfo> info) {
     ACSDK_DEBUG1(LX("handleStopDirective"));
     setHandlingCompleted(info);
-    m_executor.submit([this] { executeStop(); });
+    m_executor.execute([this] { executeStop(); });
 }
 
 void AudioPlayer::handleClearQueueDirective(std::shared_ptr<DirectiveInfo> info) {
     ACSDK_DEBUG1(LX("handleClearQueue"));
-    rapidjson::Document payload;
-    if (!parseDirectivePayload(info, &payload)) {
+    auto payload = getDirectivePayload(info);
+    if (!payload) {
         return;
     }
 
     ClearBehavior clearBehavior;
-    if (!jsonUtils::retrieveValue(payload, "clearBehavior", &clearBehavior)) {
+    if (!jsonUtils::retrieveValue(*payload, "clearBehavior", &clearBehavior)) {
         clearBehavior = ClearBehavior::CLEAR_ENQUEUED;
     }
 
     setHandlingCompleted(info);
-    m_executor.submit([this, clearBehavior] { executeClearQueue(clearBehavior); });
+    m_executor.execute([this, clearBehavior] { executeClearQueue(clearBehavior); });
 }
 
 void AudioPlayer::removeDirective(std::shared_ptr<DirectiveInfo> info) {
@@ -724,6 +730,11 @@ void AudioPlayer::executeOnPlaybackStarted(SourceId id) {
     changeActivity(PlayerActivity::PLAYING);
 
     sendPlaybackStartedEvent();
+
+    // MediaPlayer may have read all of a short source before playback started.
+    if (m_isPlaybackNearlyFinished) {
+        handlePlaybackNearlyFinished();
+    }
 }
 
 void AudioPlayer::executeOnPlaybackStopped(SourceId id) {
@@ -790,16 +801,19 @@ void AudioPlayer::executeOnPlaybackFinished(SourceId id) {
              * We used to send PlaybackNearlyFinished right after we sent PlaybackStarted.  But we found a problem when
              * we are playing Audible such that after sending PlaybackNearlyFinished, AVS will send us the next item to
              * start buffering.  But since we don't actually access the url until we finish playing the current chapter,
-             * by the time we open the url, the url has already expired so we got a 403 reponse. To address this
-             * problem, we are sending the PlaybackNearlyFinished event just before we send PlaybackFinished.
-             *
-             * TODO: Once MediaPlayer can notify of nearly finished, send there instead (ACSDK-417).
+             * by the time we open the url, the url has already expired so we got a 403 reponse.  The event is now sent
+             * when MediaPlayer reports that it is nearly finished, and the next item is prepared right away.  A
+             * MediaPlayer which does not report it gets the event just before PlaybackFinished, as before.
              */
-            sendPlaybackNearlyFinishedEvent();
+            if (!m_isPlaybackNearlyFinishedSent) {
+                sendPlaybackNearlyFinishedEvent();
+            }
 
             sendPlaybackFinishedEvent();
             if (m_audioItems.empty()) {
                 handlePlaybackCompleted();
+            } else if (MediaPlayerInterface::ERROR != m_preparedSourceId) {
+                playPreparedItem();
             } else {
                 playNextItem();
             }
@@ -835,6 +849,13 @@ void AudioPlayer::handlePlaybackCompleted() {
 void AudioPlayer::executeOnPlaybackError(SourceId id, const ErrorType& type, std::string error) {
     ACSDK_ERROR(LX("executeOnPlaybackError").d("id", id).d("type", type).d("error", error));
 
+    if (MediaPlayerInterface::ERROR != id && id == m_preparedSourceId) {
+        // The next item failed to pre-roll.  It is left in the queue, to be played (or to fail) after the current one.
+        ACSDK_WARN(LX("executeOnPlaybackError").d("reason", "preparedSourceFailed").d("id", id));
+        m_preparedSourceId = MediaPlayerInterface::ERROR;
+        return;
+    }
+
     if (id != m_sourceId) {
         ACSDK_ERROR(
             LX("executeOnPlaybackErrorFailed").d("reason", "invalidSourceId").d("id", id).d("m_sourceId", m_sourceId));
@@ -926,6 +947,66 @@ void AudioPlayer::executeOnTags(SourceId id, std::shared_ptr<const VectorOfTags>
     sendStreamMetadataExtractedEvent(vectorOfTags);
 }
 
+void AudioPlayer::executeOnPlaybackNearlyFinished(SourceId id) {
+    ACSDK_DEBUG1(LX("executeOnPlaybackNearlyFinished").d("id", id));
+
+    if (id != m_sourceId) {
+        ACSDK_ERROR(LX("executeOnPlaybackNearlyFinishedFailed")
+                        .d("reason", "invalidSourceId")
+                        .d("id", id)
+                        .d("m_sourceId", m_sourceId));
+        return;
+    }
+
+    m_isPlaybackNearlyFinished = true;
+    switch (m_currentActivity) {
+        case PlayerActivity::PLAYING:
+        case PlayerActivity::PAUSED:
+        case PlayerActivity::BUFFER_UNDERRUN:
+            handlePlaybackNearlyFinished();
+            return;
+        case PlayerActivity::IDLE:
+        case PlayerActivity::STOPPED:
+        case PlayerActivity::FINISHED:
+            // Playback has not started yet; executeOnPlaybackStarted() handles it.
+            return;
+    }
+    ACSDK_ERROR(LX("executeOnPlaybackNearlyFinishedFailed")
+                    .d("reason", "unexpectedActivity")
+                    .d("m_currentActivity", m_currentActivity));
+}
+
+void AudioPlayer::handlePlaybackNearlyFinished() {
+    if (!m_isPlaybackNearlyFinishedSent) {
+        m_isPlaybackNearlyFinishedSent = true;
+        sendPlaybackNearlyFinishedEvent();
+    }
+    prepareNextItem();
+}
+
+void AudioPlayer::prepareNextItem() {
+    if (!m_isPlaybackNearlyFinishedSent || MediaPlayerInterface::ERROR != m_preparedSourceId ||
+        m_audioItems.empty()) {
+        return;
+    }
+    auto& item = m_audioItems.front();
+    if (item.stream.reader || item.stream.offset != std::chrono::milliseconds::zero()) {
+        ACSDK_DEBUG1(LX("prepareNextItemSkipped").d("reason", "itemNotPlayableFromStartOfUrl"));
+        return;
+    }
+    m_preparedSourceId = m_mediaPlayer->prepareNextSource(item.stream.url);
+    ACSDK_DEBUG1(LX("prepareNextItem").d("preparedSourceId", m_preparedSourceId));
+}
+
+void AudioPlayer::cancelPreparedItem() {
+    if (MediaPlayerInterface::ERROR == m_preparedSourceId) {
+        return;
+    }
+    ACSDK_DEBUG1(LX("cancelPreparedItem").d("preparedSourceId", m_preparedSourceId));
+    m_mediaPlayer->cancelNextSource();
+    m_preparedSourceId = MediaPlayerInterface::ERROR;
+}
+
 void AudioPlayer::executePlay(PlayBehavior playBehavior, const AudioItem& audioItem) {
     ACSDK_DEBUG1(LX("executePlay").d("playBehavior", playBehavior));
 
@@ -949,6 +1030,7 @@ void AudioPlayer::executePlay(PlayBehavior playBehavior, const AudioItem& audioI
             executeStop(true);
         // FALL-THROUGH
         case PlayBehavior::REPLACE_ENQUEUED:
+            cancelPreparedItem();
             m_audioItems.clear();
         // FALL-THROUGH
         case PlayBehavior::ENQUEUE:
@@ -981,8 +1063,9 @@ void AudioPlayer::executePlay(PlayBehavior playBehavior, const AudioItem& audioI
         case PlayerActivity::PLAYING:
         case PlayerActivity::PAUSED:
         case PlayerActivity::BUFFER_UNDERRUN:
-            // If we're already 'playing', the new song should have been enqueued above and there's nothing more to do
-            // here.
+            // If we're already 'playing', the new song should have been enqueued above.  If the current song is nearly
+            // finished, start to pre-roll the new one.
+            prepareNextItem();
             return;
     }
     ACSDK_ERROR(LX("executePlayFailed").d("reason", "unexpectedActivity").d("m_currentActivity", m_currentActivity));
@@ -993,6 +1076,10 @@ void AudioPlayer::playNextItem() {
     // Cancel any timers that have been started as this is a new item that we
     // are going to play now.
     cancelTimers();
+    // Setting a new source discards any source prepared in the MediaPlayer.
+    m_preparedSourceId = MediaPlayerInterface::ERROR;
+    m_isPlaybackNearlyFinished = false;
+    m_isPlaybackNearlyFinishedSent = false;
     if (m_audioItems.empty()) {
         sendPlaybackFailedEvent(m_token, ErrorType::MEDIA_ERROR_INTERNAL_DEVICE_ERROR, "queue is empty");
         ACSDK_ERROR(LX("playNextItemFailed").d("reason", "emptyQueue"));
@@ -1030,11 +1117,32 @@ void AudioPlayer::playNextItem() {
         return;
     }
 
+    startProgressReportTimers(item);
+}
+
+void AudioPlayer::playPreparedItem() {
+    ACSDK_DEBUG1(LX("playPreparedItem").d("preparedSourceId", m_preparedSourceId));
+    cancelTimers();
+
+    auto item = m_audioItems.front();
+    m_audioItems.pop_front();
+    m_token = item.stream.token;
+    m_audioItemId = item.id;
+    m_initialOffset = item.stream.offset;
+    m_sourceId = m_preparedSourceId;
+    m_preparedSourceId = MediaPlayerInterface::ERROR;
+    m_isPlaybackNearlyFinished = false;
+    m_isPlaybackNearlyFinishedSent = false;
+
+    startProgressReportTimers(item);
+}
+
+void AudioPlayer::startProgressReportTimers(const AudioItem& item) {
     if (std::chrono::milliseconds::max() != item.stream.progressReport.delay) {
         const auto deltaBetweenDelayAndOffset = item.stream.progressReport.delay - item.stream.offset;
         if (deltaBetweenDelayAndOffset >= std::chrono::milliseconds::zero()) {
             m_delayTimer.start(deltaBetweenDelayAndOffset, [this] {
-                m_executor.submit([this] { sendProgressReportDelayElapsedEvent(); });
+                m_executor.execute([this] { sendProgressReportDelayElapsedEvent(); });
             });
         }
     }
@@ -1087,6 +1195,7 @@ void AudioPlayer::executeClearQueue(ClearBehavior clearBehavior) {
             executeStop();
         // FALL-THROUGH
         case ClearBehavior::CLEAR_ENQUEUED:
+            cancelPreparedItem();
             m_audioItems.clear();
             sendPlaybackQueueClearedEvent();
             return;
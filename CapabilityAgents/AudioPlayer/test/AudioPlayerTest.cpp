@@ -110,6 +110,15 @@ static const std::string FORMAT_TEST("AUDIO_MPEG");
 /// URL for testing.
 static const std::string URL_TEST("cid:Test");
 
+/// URL of an enqueued item which is streamed over http, for testing.
+static const std::string URL_NEXT_TEST("https://example.com/next.mp3");
+
+/// Token of the item enqueued after @c TOKEN_TEST, for testing.
+static const std::string NEXT_TOKEN_TEST("Next_Token_Test");
+
+/// The id of the @c MediaPlayer source prepared for the next item, for testing.
+static const MediaPlayerInterface::SourceId PREPARED_SOURCE_ID_TEST{100};
+
 /// ENQUEUE playBehavior.
 static const std::string NAME_ENQUEUE("ENQUEUE");
 
@@ -211,6 +220,29 @@ static const std::string REPLACE_ALL_PAYLOAD_TEST =
 "}";
 // clang-format on
 
+/// ENQUEUE payload of an item streamed over http, which follows the item of @c createEnqueuePayloadTest().
+// clang-format off
+static const std::string ENQUEUE_NEXT_PAYLOAD_TEST =
+"{"
+    "\"playBehavior\":\"" + NAME_ENQUEUE + "\","
+    "\"audioItem\": {"
+        "\"audioItemId\":\"" + AUDIO_ITEM_ID_2 + "\","
+        "\"stream\": {"
+            "\"url\":\"" + URL_NEXT_TEST + "\","
+            "\"streamFormat\":\"" + FORMAT_TEST + "\","
+            "\"offsetInMilliseconds\":0,"
+            "\"expiryTime\":\"" + EXPIRY_TEST + "\","
+            "\"progressReport\": {"
+                "\"progressReportDelayInMilliseconds\":" + std::to_string(PROGRESS_REPORT_DELAY) + ","
+                "\"progressReportIntervalInMilliseconds\":" + std::to_string(PROGRESS_REPORT_INTERVAL) +
+            "},"
+            "\"token\":\"" + NEXT_TOKEN_TEST + "\","
+            "\"expectedPreviousToken\":\"" + TOKEN_TEST + "\""
+        "}"
+    "}"
+"}";
+// clang-format on
+
 /// Empty payload for testing.
 static const std::string EMPTY_PAYLOAD_TEST = "{}";
 
@@ -461,6 +493,11 @@ public:
      */
     void sendPlayDirective(long offsetInMilliseconds = OFFSET_IN_MILLISECONDS_TEST);
 
+    /**
+     * This is invoked to enqueue, while the first item plays, an item streamed over http.
+     */
+    void sendEnqueueNextDirective();
+
     /**
      * Consolidate code to send ClearQueue directive
      */
@@ -573,6 +610,16 @@ std::future<bool> AudioPlayerTest::wakeOnReleaseChannel() {
     return returnValue;
 }
 
+void AudioPlayerTest::sendEnqueueNextDirective() {
+    auto avsMessageHeader = std::make_shared<AVSMessageHeader>(NAMESPACE_AUDIO_PLAYER, NAME_PLAY, MESSAGE_ID_TEST_2);
+
+    std::shared_ptr<AVSDirective> playDirective = AVSDirective::create(
+        "", avsMessageHeader, ENQUEUE_NEXT_PAYLOAD_TEST, m_attachmentManager, CONTEXT_ID_TEST_2);
+
+    m_audioPlayer->CapabilityAgent::preHandleDirective(playDirective, std::move(m_mockDirectiveHandlerResult));
+    m_audioPlayer->CapabilityAgent::handleDirective(MESSAGE_ID_TEST_2);
+}
+
 void AudioPlayerTest::wakeOnSendMessage() {
     m_wakeSendMessagePromise.set_value();
 }
@@ -1093,6 +1140,79 @@ TEST_F(AudioPlayerTest, testOnPlaybackFinished) {
     ASSERT_TRUE(result);
 }
 
+/**
+ * Test that @c onPlaybackNearlyFinished sends a PlaybackNearlyFinished message, and that an item enqueued after it is
+ * prepared and then played without a further @c setSource() or @c play().
+ */
+
+TEST_F(AudioPlayerTest, testPrepareNextItemWhenNearlyFinished) {
+    m_expectedMessages.insert({PLAYBACK_STARTED_NAME, 0});
+    m_expectedMessages.insert({PLAYBACK_NEARLY_FINISHED_NAME, 0});
+    m_expectedMessages.insert({PLAYBACK_FINISHED_NAME, 0});
+
+    EXPECT_CALL(*(m_mockMessageSender.get()), sendMessage(_))
+        .Times(AtLeast(1))
+        .WillRepeatedly(Invoke([this](std::shared_ptr<avsCommon::avs::MessageRequest> request) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            verifyMessageMap(request, &m_expectedMessages);
+            m_messageSentTrigger.notify_one();
+        }));
+
+    sendPlayDirective();
+    auto currentSourceId = m_mockMediaPlayer->getCurrentSourceId();
+
+    EXPECT_CALL(*(m_mockMediaPlayer.get()), urlPrepareNextSource(URL_NEXT_TEST))
+        .Times(1)
+        .WillOnce(Return(PREPARED_SOURCE_ID_TEST));
+    EXPECT_CALL(*(m_mockMediaPlayer.get()), urlSetSource(_)).Times(0);
+    EXPECT_CALL(*(m_mockMediaPlayer.get()), play(_)).Times(0);
+
+    m_audioPlayer->onPlaybackNearlyFinished(currentSourceId);
+    sendEnqueueNextDirective();
+    m_audioPlayer->onPlaybackFinished(currentSourceId);
+    m_audioPlayer->onPlaybackStarted(PREPARED_SOURCE_ID_TEST);
+
+    // Both items send PlaybackStarted: the second once the MediaPlayer has switched to the prepared source.
+    std::unique_lock<std::mutex> lock(m_mutex);
+    bool result = m_messageSentTrigger.wait_for(lock, WAIT_TIMEOUT, [this] {
+        return m_expectedMessages[PLAYBACK_STARTED_NAME] == 2 && m_expectedMessages[PLAYBACK_FINISHED_NAME] == 1;
+    });
+    ASSERT_TRUE(result);
+    ASSERT_TRUE(m_testAudioPlayerObserver->waitFor(PlayerActivity::PLAYING, WAIT_TIMEOUT));
+    // The event is sent when the MediaPlayer reports it, and not again before PlaybackFinished.
+    ASSERT_EQ(m_expectedMessages[PLAYBACK_NEARLY_FINISHED_NAME], 1);
+}
+
+/**
+ * Test that when the prepared item fails to pre-roll, it is played with @c setSource() once the current item finishes.
+ */
+
+TEST_F(AudioPlayerTest, testPreparedItemErrorFallsBackToSetSource) {
+    sendPlayDirective();
+    auto currentSourceId = m_mockMediaPlayer->getCurrentSourceId();
+
+    EXPECT_CALL(*(m_mockMediaPlayer.get()), urlPrepareNextSource(URL_NEXT_TEST))
+        .Times(1)
+        .WillOnce(Return(PREPARED_SOURCE_ID_TEST));
+
+    m_audioPlayer->onPlaybackNearlyFinished(currentSourceId);
+    sendEnqueueNextDirective();
+    m_audioPlayer->onPlaybackError(PREPARED_SOURCE_ID_TEST, ErrorType::MEDIA_ERROR_UNKNOWN, "TEST_ERROR");
+
+    std::promise<void> setSourcePromise;
+    auto setSourceFuture = setSourcePromise.get_future();
+    EXPECT_CALL(*(m_mockMediaPlayer.get()), urlSetSource(URL_NEXT_TEST))
+        .Times(1)
+        .WillOnce(InvokeWithoutArgs([this, &setSourcePromise] {
+            setSourcePromise.set_value();
+            return m_mockMediaPlayer->mockSetSource();
+        }));
+
+    m_audioPlayer->onPlaybackFinished(currentSourceId);
+
+    ASSERT_EQ(std::future_status::ready, setSourceFuture.wait_for(WAIT_TIMEOUT));
+}
+
 /**
  * Test @c onBufferUnderrun and expect a PlaybackStutterStarted message
  */
@@ -154,13 +154,13 @@ private:
     bool init();
 
     /**
-     * This method deserializes a @c Directive's payload into a @c rapidjson::Document.
+     * This method gets a @c Directive's parsed payload, and reports the directive as failed if it is not a JSON
+     * object.
      *
-     * @param info The @c DirectiveInfo to read the payload string from.
-     * @param[out] document The @c rapidjson::Document to parse the payload into.
-     * @return @c true if parsing was successful, else @c false.
+     * @param info The @c DirectiveInfo to read the payload from.
+     * @return The parsed payload, which remains valid while @c info is held, or @c nullptr if it is not an object.
      */
-    bool parseDirectivePayload(std::shared_ptr<DirectiveInfo> info, rapidjson::Document* document);
+    const rapidjson::Value* getDirectivePayload(std::shared_ptr<DirectiveInfo> info);
 
     /**
      * This method handles a SetIndicator directive.
@@ -46,8 +46,12 @@ public:
      * Constructor.
      *
      * @param dbFilePath The location of the SQLite database file.
+     * @param maxCommitDelay The longest a write may wait to be committed, or zero to commit every write straight
+     * away.  See @c SQLiteDatabase.
      */
-    SQLiteNotificationsStorage(const std::string& databaseFilePath);
+    SQLiteNotificationsStorage(
+        const std::string& databaseFilePath,
+        std::chrono::milliseconds maxCommitDelay = std::chrono::milliseconds::zero());
 
     ~SQLiteNotificationsStorage();
 
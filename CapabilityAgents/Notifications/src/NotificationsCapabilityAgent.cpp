@@ -17,7 +17,6 @@
 
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
-#include <rapidjson/error/en.h>
 
 #include <AVSCommon/AVS/CapabilityConfiguration.h>
 #include <AVSCommon/Utils/JSON/JSONUtils.h>
@@ -286,8 +285,8 @@ void NotificationsCapabilityAgent::cancelDirective(std::shared_ptr<DirectiveInfo
 }
 
 void NotificationsCapabilityAgent::handleSetIndicatorDirective(std::shared_ptr<DirectiveInfo> info) {
-    rapidjson::Document payload;
-    if (!parseDirectivePayload(info, &payload)) {
+    auto payload = getDirectivePayload(info);
+    if (!payload) {
         ACSDK_ERROR(LX("handleSetIndicatorDirectiveFailed").d("reason", "could not parse directive payload"));
         sendExceptionEncounteredAndReportFailed(info, "failed to parse directive");
         return;
@@ -296,7 +295,7 @@ void NotificationsCapabilityAgent::handleSetIndicatorDirective(std::shared_ptr<D
     // extract all fields from the payload to load up a NotificationIndicator
 
     bool persistVisualIndicator = false;
-    if (!jsonUtils::retrieveValue(payload, PERSIST_VISUAL_INDICATOR_KEY, &persistVisualIndicator)) {
+    if (!jsonUtils::retrieveValue(*payload, PERSIST_VISUAL_INDICATOR_KEY, &persistVisualIndicator)) {
         ACSDK_ERROR(LX("handleSetIndicatorDirectiveFailed")
                         .d("reason", "payload missing persistVisualIndicator")
                         .d("messageId", info->directive->getMessageId()));
@@ -305,7 +304,7 @@ void NotificationsCapabilityAgent::handleSetIndicatorDirective(std::shared_ptr<D
     }
 
     bool playAudioIndicator = false;
-    if (!jsonUtils::retrieveValue(payload, PLAY_AUDIO_INDICATOR_KEY, &playAudioIndicator)) {
+    if (!jsonUtils::retrieveValue(*payload, PLAY_AUDIO_INDICATOR_KEY, &playAudioIndicator)) {
         ACSDK_ERROR(LX("handleSetIndicatorDirectiveFailed")
                         .d("reason", "payload missing playAudioIndicator")
                         .d("messageId", info->directive->getMessageId()));
@@ -318,7 +317,7 @@ void NotificationsCapabilityAgent::handleSetIndicatorDirective(std::shared_ptr<D
 
     if (playAudioIndicator) {
         rapidjson::Value::ConstMemberIterator assetJson;
-        if (!jsonUtils::findNode(payload, ASSET_KEY, &assetJson)) {
+        if (!jsonUtils::findNode(*payload, ASSET_KEY, &assetJson)) {
             ACSDK_ERROR(LX("handleSetIndicatorDirectiveFailed")
                             .d("reason", "payload missing asset")
                             .d("messageId", info->directive->getMessageId()));
@@ -684,20 +683,17 @@ void NotificationsCapabilityAgent::setHandlingCompleted(std::shared_ptr<Directiv
     removeDirective(info->directive->getMessageId());
 }
 
-bool NotificationsCapabilityAgent::parseDirectivePayload(
-    std::shared_ptr<DirectiveInfo> info,
-    rapidjson::Document* document) {
-    rapidjson::ParseResult result = document->Parse(info->directive->getPayload());
-    if (result) {
-        return true;
+const rapidjson::Value* NotificationsCapabilityAgent::getDirectivePayload(std::shared_ptr<DirectiveInfo> info) {
+    auto payload = info->directive->getPayloadValue();
+    if (payload && payload->IsObject()) {
+        return payload;
     }
-    ACSDK_ERROR(LX("parseDirectivePayloadFailed")
-                    .d("reason", rapidjson::GetParseError_En(result.Code()))
-                    .d("offset", result.Offset())
+    ACSDK_ERROR(LX("getDirectivePayloadFailed")
+                    .d("reason", payload ? "payloadNotAnObject" : "parseFailed")
                     .d("messageId", info->directive->getMessageId()));
     sendExceptionEncounteredAndReportFailed(
         info, "Unable to parse payload", ExceptionErrorType::UNEXPECTED_INFORMATION_RECEIVED);
-    return false;
+    return nullptr;
 }
 
 void NotificationsCapabilityAgent::doShutdown() {
@@ -85,11 +85,14 @@ std::unique_ptr<SQLiteNotificationsStorage> SQLiteNotificationsStorage::create(
         return nullptr;
     }
 
-    return std::unique_ptr<SQLiteNotificationsStorage>(new SQLiteNotificationsStorage(notificationDatabaseFilePath));
+    return std::unique_ptr<SQLiteNotificationsStorage>(new SQLiteNotificationsStorage(
+        notificationDatabaseFilePath, SQLiteDatabase::getMaxCommitDelay(notificationConfigurationRoot)));
 }
 
-SQLiteNotificationsStorage::SQLiteNotificationsStorage(const std::string& databaseFilePath) :
-        m_database{databaseFilePath} {
+SQLiteNotificationsStorage::SQLiteNotificationsStorage(
+    const std::string& databaseFilePath,
+    std::chrono::milliseconds maxCommitDelay) :
+        m_database{databaseFilePath, maxCommitDelay} {
 }
 
 bool SQLiteNotificationsStorage::createDatabase() {
@@ -45,8 +45,12 @@ public:
      * Constructor.
      *
      * @param dbFilePath The location of the SQLite database file.
+     * @param maxCommitDelay The longest a write may wait to be committed, or zero to commit every write straight
+     * away.  See @c SQLiteDatabase.
      */
-    SQLiteSettingStorage(const std::string& databaseFilePath);
+    SQLiteSettingStorage(
+        const std::string& databaseFilePath,
+        std::chrono::milliseconds maxCommitDelay = std::chrono::milliseconds::zero());
 
     bool createDatabase() override;
 
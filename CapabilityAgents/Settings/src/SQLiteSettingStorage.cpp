@@ -71,10 +71,14 @@ std::unique_ptr<SQLiteSettingStorage> SQLiteSettingStorage::create(
         return nullptr;
     }
 
-    return std::unique_ptr<SQLiteSettingStorage>(new SQLiteSettingStorage(settingDbFilePath));
+    return std::unique_ptr<SQLiteSettingStorage>(
+        new SQLiteSettingStorage(settingDbFilePath, SQLiteDatabase::getMaxCommitDelay(settingsConfigurationRoot)));
 }
 
-SQLiteSettingStorage::SQLiteSettingStorage(const std::string& databaseFilePath) : m_database{databaseFilePath} {
+SQLiteSettingStorage::SQLiteSettingStorage(
+    const std::string& databaseFilePath,
+    std::chrono::milliseconds maxCommitDelay) :
+        m_database{databaseFilePath, maxCommitDelay} {
 }
 
 bool SQLiteSettingStorage::createDatabase() {
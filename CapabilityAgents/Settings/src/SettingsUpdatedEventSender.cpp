@@ -105,6 +105,7 @@ void SettingsUpdatedEventSender::onSettingChanged(const std::unordered_map<std::
     }
 
     std::shared_ptr<MessageRequest> request = std::make_shared<MessageRequest>(msgIdAndJsonEvent.second);
+    request->setPriority(MessageRequest::Priority::BACKGROUND);
     m_messageSender->sendMessage(request);
 }
 
@@ -148,15 +148,6 @@ private:
         std::shared_ptr<avsCommon::sdkInterfaces::MessageSenderInterface> messageSender,
         std::shared_ptr<avsCommon::sdkInterfaces::ExceptionEncounteredSenderInterface> exceptionEncounteredSender);
 
-    /**
-     * Parses the payload from a string into a rapidjson document.
-     *
-     * @param payload The payload as a string.
-     * @param document The document that will contain the payload.
-     * @return A bool indicating the results of the operation.
-     */
-    bool parseDirectivePayload(std::string payload, rapidjson::Document* document);
-
     /**
      * Performs clean-up after a successful handling of a directive.
      *
@@ -16,7 +16,6 @@
 #include <rapidjson/document.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
-#include <rapidjson/error/en.h>
 
 #include <AVSCommon/AVS/CapabilityConfiguration.h>
 #include <AVSCommon/AVS/SpeakerConstants/SpeakerConstants.h>
@@ -167,24 +166,6 @@ void SpeakerManager::handleDirectiveImmediately(std::shared_ptr<AVSDirective> di
     handleDirective(std::make_shared<DirectiveInfo>(directive, nullptr));
 };
 
-bool SpeakerManager::parseDirectivePayload(std::string payload, Document* document) {
-    if (!document) {
-        ACSDK_ERROR(LX("parseDirectivePayloadFailed").d("reason", "nullDocument"));
-        return false;
-    }
-
-    ParseResult result = document->Parse(payload);
-    if (!result) {
-        ACSDK_ERROR(LX("parseDirectivePayloadFailed")
-                        .d("reason", "parseFailed")
-                        .d("error", GetParseError_En(result.Code()))
-                        .d("offset", result.Offset()));
-        return false;
-    }
-
-    return true;
-}
-
 void SpeakerManager::sendExceptionEncountered(
     std::shared_ptr<CapabilityAgent::DirectiveInfo> info,
     const std::string& message,
@@ -244,8 +225,8 @@ void SpeakerManager::handleDirective(std::shared_ptr<CapabilityAgent::DirectiveI
     // Only speakers that are synced with AVS should be modified by AVS Directives.
     SpeakerInterface::Type directiveType = SpeakerInterface::Type::AVS_SYNCED;
 
-    Document payload(kObjectType);
-    if (!parseDirectivePayload(info->directive->getPayload(), &payload)) {
+    auto payload = info->directive->getPayloadValue();
+    if (!payload || !payload->IsObject()) {
         sendExceptionEncountered(info, "Payload Parsing Failed", ExceptionErrorType::UNEXPECTED_INFORMATION_RECEIVED);
         return;
     }
@@ -256,7 +237,7 @@ void SpeakerManager::handleDirective(std::shared_ptr<CapabilityAgent::DirectiveI
      */
     if (directiveName == SET_VOLUME.name) {
         int64_t volume;
-        if (jsonUtils::retrieveValue(payload, VOLUME_KEY, &volume) &&
+        if (jsonUtils::retrieveValue(*payload, VOLUME_KEY, &volume) &&
             withinBounds(volume, static_cast<int64_t>(AVS_SET_VOLUME_MIN), static_cast<int64_t>(AVS_SET_VOLUME_MAX))) {
             m_executor.submit([this, volume, directiveType, info] {
                 /*
@@ -288,7 +269,7 @@ void SpeakerManager::handleDirective(std::shared_ptr<CapabilityAgent::DirectiveI
         // SET_VOLUME
     } else if (directiveName == ADJUST_VOLUME.name) {
         int64_t delta;
-        if (jsonUtils::retrieveValue(payload, VOLUME_KEY, &delta) &&
+        if (jsonUtils::retrieveValue(*payload, VOLUME_KEY, &delta) &&
             withinBounds(
                 delta, static_cast<int64_t>(AVS_ADJUST_VOLUME_MIN), static_cast<int64_t>(AVS_ADJUST_VOLUME_MAX))) {
             m_executor.submit([this, delta, directiveType, info] {
@@ -321,7 +302,7 @@ void SpeakerManager::handleDirective(std::shared_ptr<CapabilityAgent::DirectiveI
         // ADJUST_VOLUME
     } else if (directiveName == SET_MUTE.name) {
         bool mute = false;
-        if (jsonUtils::retrieveValue(payload, MUTE_KEY, &mute)) {
+        if (jsonUtils::retrieveValue(*payload, MUTE_KEY, &mute)) {
             m_executor.submit([this, mute, directiveType, info] {
                 /*
                  * Since AVS doesn't have a concept of Speaker IDs or types, no-op if a directive
@@ -152,7 +152,7 @@ avsCommon::avs::DirectiveHandlerConfiguration SpeechSynthesizer::getConfiguratio
 
 void SpeechSynthesizer::addObserver(std::shared_ptr<SpeechSynthesizerObserverInterface> observer) {
     ACSDK_DEBUG9(LX("addObserver").d("observer", observer.get()));
-    m_executor.submit([this, observer]() { m_observers.insert(observer); });
+    m_executor.execute([this, observer]() { m_observers.insert(observer); });
 }
 
 void SpeechSynthesizer::removeObserver(std::shared_ptr<SpeechSynthesizerObserverInterface> observer) {
@@ -168,12 +168,12 @@ void SpeechSynthesizer::onDeregistered() {
 void SpeechSynthesizer::handleDirectiveImmediately(std::shared_ptr<avsCommon::avs::AVSDirective> directive) {
     ACSDK_DEBUG9(LX("handleDirectiveImmediately").d("messageId", directive->getMessageId()));
     auto info = createDirectiveInfo(directive, nullptr);
-    m_executor.submit([this, info]() { executeHandleImmediately(info); });
+    m_executor.execute([this, info]() { executeHandleImmediately(info); });
 }
 
 void SpeechSynthesizer::preHandleDirective(std::shared_ptr<DirectiveInfo> info) {
     ACSDK_DEBUG9(LX("preHandleDirective").d("messageId", info->directive->getMessageId()));
-    m_executor.submit([this, info]() { executePreHandle(info); });
+    m_executor.execute([this, info]() { executePreHandle(info); });
 }
 
 void SpeechSynthesizer::handleDirective(std::shared_ptr<DirectiveInfo> info) {
@@ -181,12 +181,12 @@ void SpeechSynthesizer::handleDirective(std::shared_ptr<DirectiveInfo> info) {
     if (info->directive->getName() == "Speak") {
         ACSDK_METRIC_MSG(TAG, info->directive, Metrics::Location::SPEECH_SYNTHESIZER_RECEIVE);
     }
-    m_executor.submit([this, info]() { executeHandle(info); });
+    m_executor.execute([this, info]() { executeHandle(info); });
 }
 
 void SpeechSynthesizer::cancelDirective(std::shared_ptr<DirectiveInfo> info) {
     ACSDK_DEBUG9(LX("cancelDirective").d("messageId", info->directive->getMessageId()));
-    m_executor.submit([this, info]() { executeCancel(info); });
+    m_executor.execute([this, info]() { executeCancel(info); });
 }
 
 void SpeechSynthesizer::onFocusChanged(FocusState newFocus) {
@@ -212,7 +212,7 @@ void SpeechSynthesizer::onFocusChanged(FocusState newFocus) {
     }
 
     auto messageId = (m_currentInfo && m_currentInfo->directive) ? m_currentInfo->directive->getMessageId() : "";
-    m_executor.submit([this]() { executeStateChange(); });
+    m_executor.execute([this]() { executeStateChange(); });
     // Block until we achieve the desired state.
     if (m_waitOnStateChange.wait_for(
             lock, STATE_CHANGE_TIMEOUT, [this]() { return m_currentState == m_desiredState; })) {
@@ -233,7 +233,7 @@ void SpeechSynthesizer::provideState(
     ACSDK_DEBUG9(LX("provideState").d("token", stateRequestToken));
     std::lock_guard<std::mutex> lock(m_mutex);
     auto state = m_currentState;
-    m_executor.submit([this, state, stateRequestToken]() { executeProvideState(state, stateRequestToken); });
+    m_executor.execute([this, state, stateRequestToken]() { executeProvideState(state, stateRequestToken); });
 }
 
 void SpeechSynthesizer::onContextAvailable(const std::string& jsonContext) {
@@ -254,11 +254,11 @@ void SpeechSynthesizer::onPlaybackStarted(SourceId id) {
                         .d("reason", "mismatchSourceId")
                         .d("callbackSourceId", id)
                         .d("sourceId", m_mediaSourceId));
-        m_executor.submit([this] {
+        m_executor.execute([this] {
             executePlaybackError(ErrorType::MEDIA_ERROR_INTERNAL_DEVICE_ERROR, "executePlaybackStartedFailed");
         });
     } else {
-        m_executor.submit([this]() { executePlaybackStarted(); });
+        m_executor.execute([this]() { executePlaybackStarted(); });
     }
 }
 
@@ -271,11 +271,11 @@ void SpeechSynthesizer::onPlaybackFinished(SourceId id) {
                         .d("reason", "mismatchSourceId")
                         .d("callbackSourceId", id)
                         .d("sourceId", m_mediaSourceId));
-        m_executor.submit([this] {
+        m_executor.execute([this] {
             executePlaybackError(ErrorType::MEDIA_ERROR_INTERNAL_DEVICE_ERROR, "executePlaybackFinishedFailed");
         });
     } else {
-        m_executor.submit([this]() { executePlaybackFinished(); });
+        m_executor.execute([this]() { executePlaybackFinished(); });
     }
 }
 
@@ -284,7 +284,7 @@ void SpeechSynthesizer::onPlaybackError(
     const avsCommon::utils::mediaPlayer::ErrorType& type,
     std::string error) {
     ACSDK_DEBUG9(LX("onPlaybackError").d("callbackSourceId", id));
-    m_executor.submit([this, type, error]() { executePlaybackError(type, error); });
+    m_executor.execute([this, type, error]() { executePlaybackError(type, error); });
 }
 
 void SpeechSynthesizer::onPlaybackStopped(SourceId id) {
@@ -400,8 +400,8 @@ void SpeechSynthesizer::executePreHandleAfterValidation(std::shared_ptr<SpeakDir
         return;
     }
 
-    Document payload;
-    if (payload.Parse(speakInfo->directive->getPayload()).HasParseError()) {
+    auto payload = speakInfo->directive->getPayloadValue();
+    if (!payload || !payload->IsObject()) {
         const std::string message("unableToParsePayload" + speakInfo->directive->getMessageId());
         ACSDK_ERROR(
             LX("executePreHandleFailed").d("reason", message).d("messageId", speakInfo->directive->getMessageId()));
@@ -410,15 +410,15 @@ void SpeechSynthesizer::executePreHandleAfterValidation(std::shared_ptr<SpeakDir
         return;
     }
 
-    Value::ConstMemberIterator it = payload.FindMember(KEY_TOKEN);
-    if (payload.MemberEnd() == it) {
+    Value::ConstMemberIterator it = payload->FindMember(KEY_TOKEN);
+    if (payload->MemberEnd() == it) {
         sendExceptionEncounteredAndReportMissingProperty(speakInfo, KEY_TOKEN);
         return;
     }
     speakInfo->token = it->value.GetString();
 
-    it = payload.FindMember(KEY_FORMAT);
-    if (payload.MemberEnd() == it) {
+    it = payload->FindMember(KEY_FORMAT);
+    if (payload->MemberEnd() == it) {
         sendExceptionEncounteredAndReportMissingProperty(speakInfo, KEY_FORMAT);
         return;
     }
@@ -433,8 +433,8 @@ void SpeechSynthesizer::executePreHandleAfterValidation(std::shared_ptr<SpeakDir
             speakInfo, avsCommon::avs::ExceptionErrorType::UNEXPECTED_INFORMATION_RECEIVED, message);
     }
 
-    it = payload.FindMember(KEY_URL);
-    if (payload.MemberEnd() == it) {
+    it = payload->FindMember(KEY_URL);
+    if (payload->MemberEnd() == it) {
         sendExceptionEncounteredAndReportMissingProperty(speakInfo, KEY_URL);
         return;
     }
@@ -918,7 +918,7 @@ void SpeechSynthesizer::resetMediaSourceId() {
 
 void SpeechSynthesizer::onDialogUXStateChanged(
     avsCommon::sdkInterfaces::DialogUXStateObserverInterface::DialogUXState newState) {
-    m_executor.submit([this, newState]() { executeOnDialogUXStateChanged(newState); });
+    m_executor.execute([this, newState]() { executeOnDialogUXStateChanged(newState); });
 }
 
 void SpeechSynthesizer::executeOnDialogUXStateChanged(
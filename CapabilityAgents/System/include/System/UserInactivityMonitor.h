@@ -127,6 +127,9 @@ private:
     /// Mutex to synchronize access to @c m_lastTimeActive and @c m_inactivityObservers.
     std::mutex m_mutex;
 
+    /// The period of send events.
+    const std::chrono::milliseconds m_sendPeriod;
+
     /**
      * Timer for sending events every hour.
      * Declared after @c m_mutex so m_eventTimer does not access @c m_mutex after it has been destroyed.
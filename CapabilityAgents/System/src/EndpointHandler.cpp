@@ -106,7 +106,8 @@ void EndpointHandler::handleDirective(std::shared_ptr<avsCommon::avs::Capability
         return;
     }
     std::string newEndpoint;
-    if (!jsonUtils::retrieveValue(info->directive->getPayload(), ENDPOINT_PAYLOAD_KEY, &newEndpoint)) {
+    auto payload = info->directive->getPayloadValue();
+    if (!payload || !payload->IsObject() || !jsonUtils::retrieveValue(*payload, ENDPOINT_PAYLOAD_KEY, &newEndpoint)) {
         ACSDK_ERROR(LX("handleDirectiveFailed").d("reason", "payloadMissingEndpointKey"));
         removeDirectiveGracefully(info, true, "payloadMissingEndpointKey");
     } else {
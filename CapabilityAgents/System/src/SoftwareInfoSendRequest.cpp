@@ -152,6 +152,7 @@ void SoftwareInfoSendRequest::send() {
         return;
     }
     auto request = std::make_shared<MessageRequest>(jsonContent);
+    request->setPriority(MessageRequest::Priority::BACKGROUND);
     request->addObserver(shared_from_this());
     m_messageSender->sendMessage(request);
 }
@@ -96,6 +96,7 @@ UserInactivityMonitor::UserInactivityMonitor(
         CapabilityAgent{USER_INACTIVITY_MONITOR_NAMESPACE, exceptionEncounteredSender},
         RequiresShutdown{"UserInactivityMonitor"},
         m_messageSender{messageSender},
+        m_sendPeriod{sendPeriod},
         m_lastTimeActive{std::chrono::steady_clock::now()} {
     m_eventTimer.start(
         sendPeriod,
@@ -127,7 +128,11 @@ void UserInactivityMonitor::sendInactivityReport() {
     jsonUtils::convertToValue(inactivityPayload, &inactivityPayloadString);
 
     auto inactivityEvent = buildJsonEventString(INACTIVITY_EVENT_NAME, "", inactivityPayloadString);
-    m_messageSender->sendMessage(std::make_shared<MessageRequest>(inactivityEvent.second));
+    auto request = std::make_shared<MessageRequest>(inactivityEvent.second);
+    // A report which has not been sent by the time the next one is due is stale, so there is no point sending it.
+    request->setPriority(MessageRequest::Priority::BACKGROUND);
+    request->setDeadline(std::chrono::steady_clock::now() + m_sendPeriod);
+    m_messageSender->sendMessage(request);
 
     notifyObservers();
 }
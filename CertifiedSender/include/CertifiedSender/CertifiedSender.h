@@ -29,6 +29,7 @@
 
 #include <deque>
 #include <memory>
+#include <vector>
 
 namespace alexaClientSDK {
 namespace certifiedSender {
@@ -37,6 +38,8 @@ namespace certifiedSender {
 static const int CERTIFIED_SENDER_QUEUE_SIZE_WARN_LIMIT = 25;
 /// The maximum number of items we can store for sending.
 static const int CERTIFIED_SENDER_QUEUE_SIZE_HARD_LIMIT = 50;
+/// The number of messages which may be sent before the first of them has completed.
+static const int CERTIFIED_SENDER_MAX_MESSAGES_IN_FLIGHT = 1;
 
 /**
  * This class provides a guaranteed message delivery service to AVS.  Upon calling the single api,
@@ -51,6 +54,18 @@ static const int CERTIFIED_SENDER_QUEUE_SIZE_HARD_LIMIT = 50;
  * This class maintains the ordering of messages passed to it.  For example, if @c sendJSONMessage is invoked with
  * messages A then B then C, then this class guarantees that the messages will be sent to AVS in the same order -
  * A then B then C.
+ *
+ * By default a message is only sent once the one before it has completed, so a backlog drains at one round trip per
+ * message.  The setting 'maxMessagesInFlight' lets several messages be sent before the first of them completes.  They
+ * are still sent in order, and each stays stored until AVS has processed it.  Only the order in which messages are
+ * sent is kept, though: AVS may process messages which are in flight together in any order, and a message which fails
+ * is sent again once the messages sent after it have completed.  So a message is not sent while one it depends on is
+ * in flight.  Two messages depend on each other if they have the same namespace and either the same payload "token"
+ * (such as an @c AlertStarted and an @c AlertStopped for one alert), or at least one of them has no token.  Messages
+ * with a token are given their namespace and token as ordering key, so the transport does not hold them back behind
+ * events about other items of the namespace.  Messages which AVS has processed are erased from storage in batches.
+ * The transport only sends several events at once if the ACL is configured to, so 'maxMessagesInFlight' should not
+ * be larger than the ACL's 'maxConcurrentEventStreams'.
  */
 class CertifiedSender
         : public avsCommon::utils::RequiresShutdown
@@ -106,8 +121,21 @@ private:
          *
          * @param jsonContent The JSON text to be sent to AVS.
          * @param dbId The database id associated with this @c MessageRequest.
+         * @param isPipelined Whether other messages may be in flight while this one is, in which case a message with
+         * a payload token is given its namespace and token as ordering key rather than its namespace alone.  The
+         * namespace and token are only read from @c jsonContent in that case, since no other message can be in
+         * flight for @c dependsOn() to be asked about.
+         */
+        CertifiedMessageRequest(const std::string& jsonContent, int dbId, bool isPipelined);
+
+        /**
+         * Whether AVS must process another message before this one, if the other was sent first.  That is the case
+         * when both have the same namespace and either the same payload token, or at least one of them has none.
+         *
+         * @param other The other message.
+         * @return Whether this message depends on @c other.
          */
-        CertifiedMessageRequest(const std::string& jsonContent, int dbId);
+        bool dependsOn(const CertifiedMessageRequest& other) const;
 
         void exceptionReceived(const std::string& exceptionMessage) override;
 
@@ -121,6 +149,14 @@ private:
          */
         avsCommon::sdkInterfaces::MessageRequestObserverInterface::Status waitForCompletion();
 
+        /**
+         * A non-blocking check of whether the @c MessageSender has completed processing the message.
+         *
+         * @param[out] status The status returned by the @c MessageSender, if it has completed.
+         * @return Whether the @c MessageSender has completed processing the message.
+         */
+        bool getCompletionStatus(avsCommon::sdkInterfaces::MessageRequestObserverInterface::Status* status);
+
         /**
          * Utility function to return the database id associated with this @c MessageRequest.
          *
@@ -146,6 +182,18 @@ private:
         int m_dbId;
         /// A control so we may allow the message to stop waiting to be sent.
         bool m_isShuttingDown;
+        /// The namespace of the event, or an empty string if the message is not pipelined.
+        const std::string m_namespace;
+        /// The token in the payload of the event, or an empty string if it has none or is not pipelined.
+        const std::string m_token;
+    };
+
+    /// A message which has been passed to the @c MessageSender and has not yet been handled here.
+    struct InFlightMessage {
+        /// The message.
+        std::shared_ptr<CertifiedMessageRequest> message;
+        /// The value of @c m_dataGeneration when the message was sent.
+        unsigned int dataGeneration;
     };
 
     /**
@@ -157,6 +205,7 @@ private:
      * @param dataManager A dataManager object that will track the CustomerDataHandler.
      * @param queueSizeWarnLimit The number of items we can store for sending without emitting a warning.
      * @param queueSizeHardLimit The maximum number of items we can store for sending.
+     * @param maxMessagesInFlight The number of messages which may be sent before the first of them has completed.
      */
     CertifiedSender(
         std::shared_ptr<avsCommon::sdkInterfaces::MessageSenderInterface> messageSender,
@@ -164,7 +213,8 @@ private:
         std::shared_ptr<MessageStorageInterface> storage,
         std::shared_ptr<registrationManager::CustomerDataManager> dataManager,
         int queueSizeWarnLimit = CERTIFIED_SENDER_QUEUE_SIZE_WARN_LIMIT,
-        int queueSizeHardLimit = CERTIFIED_SENDER_QUEUE_SIZE_HARD_LIMIT);
+        int queueSizeHardLimit = CERTIFIED_SENDER_QUEUE_SIZE_HARD_LIMIT,
+        int maxMessagesInFlight = CERTIFIED_SENDER_MAX_MESSAGES_IN_FLIGHT);
 
     void onConnectionStatusChanged(
         const avsCommon::sdkInterfaces::ConnectionStatusObserverInterface::Status status,
@@ -192,10 +242,22 @@ private:
      */
     void mainloop();
 
+    /**
+     * Whether a message depends on any of the messages in flight.
+     *
+     * @note This method must be called while @c m_mutex is acquired.
+     *
+     * @param message The message.
+     * @return Whether the message must wait for a message in flight to complete before it is sent.
+     */
+    bool dependsOnMessageInFlight(const CertifiedMessageRequest& message);
+
     /// A queue size threshold, beyond which we will emit warnings if more items are added.
     int m_queueSizeWarnLimit;
     /// The maximum possible size of the queue.
     int m_queueSizeHardLimit;
+    /// The number of messages which may be sent before the first of them has completed.
+    int m_maxMessagesInFlight;
 
     /// The thread that will actually handle the sending of messages.
     std::thread m_workerThread;
@@ -212,12 +274,18 @@ private:
     /// Our queue of requests that should be sent.
     std::deque<std::shared_ptr<CertifiedMessageRequest>> m_messagesToSend;
 
+    /// The messages which have been sent and not yet handled, in the order they were sent.
+    std::deque<InFlightMessage> m_messagesInFlight;
+
+    /// Messages which failed, and are sent again once all the messages in flight have completed.
+    std::vector<std::shared_ptr<CertifiedMessageRequest>> m_messagesToRetry;
+
+    /// Incremented by @c clearData(), so that messages which were in flight at the time are neither erased nor retried.
+    unsigned int m_dataGeneration;
+
     /// The entity which actually sends the messages to AVS.
     std::shared_ptr<avsCommon::sdkInterfaces::MessageSenderInterface> m_messageSender;
 
-    /// The message currently being sent.
-    std::shared_ptr<CertifiedMessageRequest> m_currentMessage;
-
     // The connection object we are observing.
     std::shared_ptr<avsCommon::sdkInterfaces::AVSConnectionManagerInterface> m_connection;
 
@@ -19,6 +19,7 @@
 #include <memory>
 #include <string>
 #include <queue>
+#include <vector>
 
 namespace alexaClientSDK {
 namespace certifiedSender {
@@ -112,6 +113,15 @@ public:
      */
     virtual bool erase(int messageId) = 0;
 
+    /**
+     * Erases several messages from the database.  Implementations should erase them together, so that they cost
+     * no more than erasing a single message.  By default, this erases the messages one at a time.
+     *
+     * @param messageIds The ids of the messages to be erased.
+     * @return Whether all the messages were successfully erased.
+     */
+    virtual bool erase(const std::vector<int>& messageIds);
+
     /**
      * A utility function to clear the database of all records.  Note that the database will still exist, as will
      * the tables.  Only the rows will be erased.
@@ -121,6 +131,14 @@ public:
     virtual bool clearDatabase() = 0;
 };
 
+inline bool MessageStorageInterface::erase(const std::vector<int>& messageIds) {
+    bool erased = true;
+    for (auto messageId : messageIds) {
+        erased = erase(messageId) && erased;
+    }
+    return erased;
+}
+
 }  // namespace certifiedSender
 }  // namespace alexaClientSDK
 
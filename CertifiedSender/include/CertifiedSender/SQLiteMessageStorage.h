@@ -44,8 +44,14 @@ public:
      * Constructor.
      *
      * @param dbFilePath The location of the SQLite database file.
+     * @param maxCommitDelay The longest a write may wait to be committed, or zero to commit every write straight
+     * away.  See @c SQLiteDatabase.  This only applies to erasing messages: @c store() always commits before it
+     * returns, so that a crash cannot lose a message which has been accepted.  A crash can at worst bring back messages
+     * which were erased, which are then sent again.
      */
-    SQLiteMessageStorage(const std::string& databaseFilePath);
+    SQLiteMessageStorage(
+        const std::string& databaseFilePath,
+        std::chrono::milliseconds maxCommitDelay = std::chrono::milliseconds::zero());
 
     ~SQLiteMessageStorage();
 
@@ -55,12 +61,20 @@ public:
 
     void close() override;
 
+    /**
+     * Stores the message and commits it before returning, even in group-commit mode.
+     */
     bool store(const std::string& message, int* id) override;
 
     bool load(std::queue<StoredMessage>* messageContainer) override;
 
     bool erase(int messageId) override;
 
+    /**
+     * Erases the messages with as few statements as SQLite allows, so that they are erased in as few transactions.
+     */
+    bool erase(const std::vector<int>& messageIds) override;
+
     bool clearDatabase() override;
 
 private:
@@ -15,6 +15,8 @@
 
 #include "CertifiedSender/CertifiedSender.h"
 
+#include <rapidjson/document.h>
+
 #include <AVSCommon/AVS/MessageRequest.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 #include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
@@ -38,11 +40,71 @@ static const std::string TAG("CertifiedSender");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-CertifiedSender::CertifiedMessageRequest::CertifiedMessageRequest(const std::string& jsonContent, int dbId) :
+/// The key in our config file to find the root of settings for this component.
+static const std::string CERTIFIED_SENDER_CONFIGURATION_ROOT_KEY = "certifiedSender";
+/// The key in our config file to find the number of items we can store without emitting a warning.
+static const std::string QUEUE_SIZE_WARN_LIMIT_KEY = "queueSizeWarnLimit";
+/// The key in our config file to find the maximum number of items we can store.
+static const std::string QUEUE_SIZE_HARD_LIMIT_KEY = "queueSizeHardLimit";
+/// The key in our config file to find the number of messages which may be sent before the first of them completes.
+static const std::string MAX_MESSAGES_IN_FLIGHT_KEY = "maxMessagesInFlight";
+/// The key in an event which holds the event.
+static const std::string EVENT_KEY = "event";
+/// The key in an event which holds the payload.
+static const std::string PAYLOAD_KEY = "payload";
+/// The key in a payload which holds the token of the item the event is about.
+static const std::string TOKEN_KEY = "token";
+/// The separator between the namespace and the token in the ordering key of a pipelined message.
+static const std::string ORDERING_KEY_TOKEN_SEPARATOR = ":";
+
+/**
+ * Finds the token of the item an event is about, such as the alert an @c AlertStopped event is for.
+ *
+ * @param jsonContent The JSON content of the event.
+ * @return The string value of "token" in the payload of the event, or an empty string if there is none.
+ */
+static std::string findPayloadToken(const std::string& jsonContent) {
+    rapidjson::Document document;
+    document.Parse(jsonContent.c_str());
+    if (document.HasParseError() || !document.IsObject()) {
+        return "";
+    }
+    auto event = document.FindMember(EVENT_KEY.c_str());
+    if (event == document.MemberEnd() || !event->value.IsObject()) {
+        return "";
+    }
+    auto payload = event->value.FindMember(PAYLOAD_KEY.c_str());
+    if (payload == event->value.MemberEnd() || !payload->value.IsObject()) {
+        return "";
+    }
+    auto token = payload->value.FindMember(TOKEN_KEY.c_str());
+    if (token == payload->value.MemberEnd() || !token->value.IsString()) {
+        return "";
+    }
+    return std::string(token->value.GetString(), token->value.GetStringLength());
+}
+
+CertifiedSender::CertifiedMessageRequest::CertifiedMessageRequest(
+    const std::string& jsonContent,
+    int dbId,
+    bool isPipelined) :
         MessageRequest{jsonContent},
         m_responseReceived{false},
         m_dbId{dbId},
-        m_isShuttingDown{false} {
+        m_isShuttingDown{false},
+        m_namespace{isPipelined ? getOrderingKey() : ""},
+        m_token{isPipelined ? findPayloadToken(jsonContent) : ""} {
+    // Certified messages are retried until they are delivered, so they must not hold up interactive messages.
+    setPriority(Priority::BACKGROUND);
+    if (!m_token.empty()) {
+        // Events about different items of a namespace do not depend on each other, so the transport need not send
+        // them one at a time.  Events which do depend on each other are never in flight together; see dependsOn().
+        setOrderingKey(m_namespace + ORDERING_KEY_TOKEN_SEPARATOR + m_token);
+    }
+}
+
+bool CertifiedSender::CertifiedMessageRequest::dependsOn(const CertifiedMessageRequest& other) const {
+    return m_namespace == other.m_namespace && (m_token.empty() || other.m_token.empty() || m_token == other.m_token);
 }
 
 void CertifiedSender::CertifiedMessageRequest::exceptionReceived(const std::string& exceptionMessage) {
@@ -73,6 +135,15 @@ MessageRequestObserverInterface::Status CertifiedSender::CertifiedMessageRequest
     return m_sendMessageStatus;
 }
 
+bool CertifiedSender::CertifiedMessageRequest::getCompletionStatus(MessageRequestObserverInterface::Status* status) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_responseReceived) {
+        return false;
+    }
+    *status = m_sendMessageStatus;
+    return true;
+}
+
 int CertifiedSender::CertifiedMessageRequest::getDbId() {
     return m_dbId;
 }
@@ -88,8 +159,16 @@ std::shared_ptr<CertifiedSender> CertifiedSender::create(
     std::shared_ptr<AVSConnectionManagerInterface> connection,
     std::shared_ptr<MessageStorageInterface> storage,
     std::shared_ptr<registrationManager::CustomerDataManager> dataManager) {
-    auto certifiedSender =
-        std::shared_ptr<CertifiedSender>(new CertifiedSender(messageSender, connection, storage, dataManager));
+    auto configurationRoot = ConfigurationNode::getRoot()[CERTIFIED_SENDER_CONFIGURATION_ROOT_KEY];
+    int queueSizeWarnLimit = CERTIFIED_SENDER_QUEUE_SIZE_WARN_LIMIT;
+    int queueSizeHardLimit = CERTIFIED_SENDER_QUEUE_SIZE_HARD_LIMIT;
+    int maxMessagesInFlight = CERTIFIED_SENDER_MAX_MESSAGES_IN_FLIGHT;
+    configurationRoot.getInt(QUEUE_SIZE_WARN_LIMIT_KEY, &queueSizeWarnLimit, CERTIFIED_SENDER_QUEUE_SIZE_WARN_LIMIT);
+    configurationRoot.getInt(QUEUE_SIZE_HARD_LIMIT_KEY, &queueSizeHardLimit, CERTIFIED_SENDER_QUEUE_SIZE_HARD_LIMIT);
+    configurationRoot.getInt(MAX_MESSAGES_IN_FLIGHT_KEY, &maxMessagesInFlight, CERTIFIED_SENDER_MAX_MESSAGES_IN_FLIGHT);
+
+    auto certifiedSender = std::shared_ptr<CertifiedSender>(new CertifiedSender(
+        messageSender, connection, storage, dataManager, queueSizeWarnLimit, queueSizeHardLimit, maxMessagesInFlight));
 
     if (!certifiedSender->init()) {
         ACSDK_ERROR(LX("createFailed").m("Could not initialize certifiedSender."));
@@ -107,13 +186,16 @@ CertifiedSender::CertifiedSender(
     std::shared_ptr<MessageStorageInterface> storage,
     std::shared_ptr<registrationManager::CustomerDataManager> dataManager,
     int queueSizeWarnLimit,
-    int queueSizeHardLimit) :
+    int queueSizeHardLimit,
+    int maxMessagesInFlight) :
         RequiresShutdown("CertifiedSender"),
         CustomerDataHandler(dataManager),
         m_queueSizeWarnLimit{queueSizeWarnLimit},
         m_queueSizeHardLimit{queueSizeHardLimit},
+        m_maxMessagesInFlight{maxMessagesInFlight},
         m_isShuttingDown{false},
         m_isConnected{false},
+        m_dataGeneration{0},
         m_messageSender{messageSender},
         m_connection{connection},
         m_storage{storage} {
@@ -122,8 +204,8 @@ CertifiedSender::CertifiedSender(
 CertifiedSender::~CertifiedSender() {
     std::unique_lock<std::mutex> lock(m_mutex);
     m_isShuttingDown = true;
-    if (m_currentMessage) {
-        m_currentMessage->shutdown();
+    for (auto& inFlight : m_messagesInFlight) {
+        inFlight.message->shutdown();
     }
     lock.unlock();
 
@@ -143,6 +225,13 @@ bool CertifiedSender::init() {
         return false;
     }
 
+    if (m_maxMessagesInFlight <= 0) {
+        ACSDK_ERROR(LX("initFailed")
+                        .d("maxMessagesInFlight", m_maxMessagesInFlight)
+                        .m("The number of messages in flight must be positive."));
+        return false;
+    }
+
     if (!m_storage->open()) {
         ACSDK_INFO(LX("init : Database file does not exist.  Creating."));
         if (!m_storage->createDatabase()) {
@@ -157,50 +246,94 @@ bool CertifiedSender::init() {
 }
 
 void CertifiedSender::mainloop() {
+    std::vector<std::shared_ptr<CertifiedMessageRequest>> messagesToSend;
+    std::vector<int> messageIdsToErase;
+
     while (true) {
         std::unique_lock<std::mutex> lock(m_mutex);
 
-        m_currentMessage.reset();
-
-        if ((!m_isConnected || m_messagesToSend.empty()) && !m_isShuttingDown) {
-            m_workerThreadCV.wait(
-                lock, [this]() { return ((m_isConnected && !m_messagesToSend.empty()) || m_isShuttingDown); });
-        }
+        m_workerThreadCV.wait(lock, [this]() {
+            return m_isShuttingDown || !m_messagesInFlight.empty() || (m_isConnected && !m_messagesToSend.empty());
+        });
 
         if (m_isShuttingDown) {
             ACSDK_DEBUG9(LX("CertifiedSender worker thread done.  exiting mainloop."));
             return;
         }
 
-        m_currentMessage = m_messagesToSend.front();
+        // Fill the window, unless failed messages are waiting for the messages sent after them to complete.  The next
+        // message also waits while a message it depends on is in flight, so that AVS processes the two in order.
+        while (m_isConnected && m_messagesToRetry.empty() && !m_messagesToSend.empty() &&
+               static_cast<int>(m_messagesInFlight.size()) < m_maxMessagesInFlight &&
+               !dependsOnMessageInFlight(*m_messagesToSend.front())) {
+            messagesToSend.push_back(m_messagesToSend.front());
+            m_messagesInFlight.push_back({m_messagesToSend.front(), m_dataGeneration});
+            m_messagesToSend.pop_front();
+        }
+
+        auto oldestMessage = m_messagesInFlight.front().message;
 
         lock.unlock();
 
-        // We have a message to send - send it!
-        m_messageSender->sendMessage(m_currentMessage);
+        for (auto& message : messagesToSend) {
+            m_messageSender->sendMessage(message);
+        }
+        messagesToSend.clear();
+
+        // Messages usually complete in the order they are sent, so waiting for the oldest rarely holds up the others.
+        oldestMessage->waitForCompletion();
+
+        lock.lock();
+
+        if (m_isShuttingDown) {
+            ACSDK_DEBUG9(LX("CertifiedSender worker thread done.  exiting mainloop."));
+            return;
+        }
+
+        MessageRequestObserverInterface::Status status;
+        while (!m_messagesInFlight.empty() && m_messagesInFlight.front().message->getCompletionStatus(&status)) {
+            auto inFlight = m_messagesInFlight.front();
+            m_messagesInFlight.pop_front();
 
-        auto status = m_currentMessage->waitForCompletion();
+            if (inFlight.dataGeneration != m_dataGeneration) {
+                // The message was sent before clearData(), and is neither in storage nor to be sent again.
+                continue;
+            }
 
-        if (MessageRequest::isServerStatus(status)) {
-            lock.lock();
+            if (MessageRequest::isServerStatus(status)) {
+                messageIdsToErase.push_back(inFlight.message->getDbId());
+            } else {
+                // If we couldn't send the message ok, let's send a fresh instance.  This allows ACL to continue
+                // interacting with the old instance (for example, if it is involved in a complex flow of exception /
+                // onCompleted handling), and allows us to safely try sending the new instance.
+                m_messagesToRetry.push_back(std::make_shared<CertifiedMessageRequest>(
+                    inFlight.message->getJsonContent(), inFlight.message->getDbId(), m_maxMessagesInFlight > 1));
+            }
+        }
 
-            if (!m_storage->erase(m_currentMessage->getDbId())) {
-                ACSDK_ERROR(LX("mainloop : could not erase message from storage."));
+        if (!messageIdsToErase.empty()) {
+            if (!m_storage->erase(messageIdsToErase)) {
+                ACSDK_ERROR(LX("mainloop : could not erase messages from storage.")
+                                .d("count", messageIdsToErase.size()));
             }
+            messageIdsToErase.clear();
+        }
 
-            m_messagesToSend.pop_front();
-            lock.unlock();
-        } else {
-            // If we couldn't send the message ok, let's push a fresh instance to the front of the deque.  This allows
-            // ACL to continue interacting with the old instance (for example, if it is involved in a complex flow
-            // of exception / onCompleted handling), and allows us to safely try sending the new instance.
-            lock.lock();
-            m_messagesToSend.pop_front();
-            m_messagesToSend.push_front(std::make_shared<CertifiedMessageRequest>(
-                m_currentMessage->getJsonContent(), m_currentMessage->getDbId()));
-            lock.unlock();
+        if (m_messagesInFlight.empty() && !m_messagesToRetry.empty()) {
+            // Send the failed messages again ahead of the rest, in the order they were first sent.
+            m_messagesToSend.insert(m_messagesToSend.begin(), m_messagesToRetry.begin(), m_messagesToRetry.end());
+            m_messagesToRetry.clear();
+        }
+    }
+}
+
+bool CertifiedSender::dependsOnMessageInFlight(const CertifiedMessageRequest& message) {
+    for (auto& inFlight : m_messagesInFlight) {
+        if (message.dependsOn(*inFlight.message)) {
+            return true;
         }
     }
+    return false;
 }
 
 void CertifiedSender::onConnectionStatusChanged(
@@ -218,7 +351,7 @@ std::future<bool> CertifiedSender::sendJSONMessage(const std::string& jsonMessag
 bool CertifiedSender::executeSendJSONMessage(std::string jsonMessage) {
     std::unique_lock<std::mutex> lock(m_mutex);
 
-    int queueSize = static_cast<int>(m_messagesToSend.size());
+    int queueSize = static_cast<int>(m_messagesToSend.size() + m_messagesInFlight.size() + m_messagesToRetry.size());
 
     if (queueSize >= m_queueSizeHardLimit) {
         ACSDK_ERROR(LX("executeSendJSONMessage").m("Queue size is at max limit.  Cannot add message to send."));
@@ -235,7 +368,8 @@ bool CertifiedSender::executeSendJSONMessage(std::string jsonMessage) {
         return false;
     }
 
-    m_messagesToSend.push_back(std::make_shared<CertifiedMessageRequest>(jsonMessage, messageId));
+    m_messagesToSend.push_back(
+        std::make_shared<CertifiedMessageRequest>(jsonMessage, messageId, m_maxMessagesInFlight > 1));
 
     lock.unlock();
 
@@ -252,6 +386,8 @@ void CertifiedSender::clearData() {
     auto result = m_executor.submit([this]() {
         std::unique_lock<std::mutex> lock(m_mutex);
         m_messagesToSend.clear();
+        m_messagesToRetry.clear();
+        ++m_dataGeneration;
         m_storage->clearDatabase();
     });
     result.wait();
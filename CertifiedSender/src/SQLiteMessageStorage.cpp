@@ -21,6 +21,7 @@
 #include <AVSCommon/Utils/File/FileUtils.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 
+#include <algorithm>
 #include <fstream>
 
 namespace alexaClientSDK {
@@ -55,6 +56,8 @@ static const std::string DATABASE_COLUMN_MESSAGE_TEXT_NAME = "message_text";
 static const std::string CREATE_MESSAGES_TABLE_SQL_STRING = std::string("CREATE TABLE ") + MESSAGES_TABLE_NAME + " (" +
                                                             DATABASE_COLUMN_ID_NAME + " INT PRIMARY KEY NOT NULL," +
                                                             DATABASE_COLUMN_MESSAGE_TEXT_NAME + " TEXT NOT NULL);";
+/// The most ids erased by one statement, well below the number of parameters SQLite allows in a statement.
+static const size_t MAX_IDS_PER_ERASE = 100;
 
 std::unique_ptr<SQLiteMessageStorage> SQLiteMessageStorage::create(
     const avsCommon::utils::configuration::ConfigurationNode& configurationRoot) {
@@ -75,11 +78,14 @@ std::unique_ptr<SQLiteMessageStorage> SQLiteMessageStorage::create(
         return nullptr;
     }
 
-    return std::unique_ptr<SQLiteMessageStorage>(new SQLiteMessageStorage(certifiedSenderDatabaseFilePath));
+    return std::unique_ptr<SQLiteMessageStorage>(new SQLiteMessageStorage(
+        certifiedSenderDatabaseFilePath, SQLiteDatabase::getMaxCommitDelay(certifiedSenderConfigurationRoot)));
 }
 
-SQLiteMessageStorage::SQLiteMessageStorage(const std::string& certifiedSenderDatabaseFilePath) :
-        m_database{certifiedSenderDatabaseFilePath} {
+SQLiteMessageStorage::SQLiteMessageStorage(
+    const std::string& certifiedSenderDatabaseFilePath,
+    std::chrono::milliseconds maxCommitDelay) :
+        m_database{certifiedSenderDatabaseFilePath, maxCommitDelay} {
 }
 
 SQLiteMessageStorage::~SQLiteMessageStorage() {
@@ -148,6 +154,12 @@ bool SQLiteMessageStorage::store(const std::string& message, int* id) {
         return false;
     }
 
+    // A message must survive a crash once it has been accepted, so it is not left for a group commit.
+    if (!m_database.commit()) {
+        ACSDK_ERROR(LX("storeFailed").m("Could not commit."));
+        return false;
+    }
+
     *id = nextId;
 
     return true;
@@ -225,6 +237,39 @@ bool SQLiteMessageStorage::erase(int messageId) {
     return true;
 }
 
+bool SQLiteMessageStorage::erase(const std::vector<int>& messageIds) {
+    for (size_t first = 0; first < messageIds.size(); first += MAX_IDS_PER_ERASE) {
+        size_t count = std::min(MAX_IDS_PER_ERASE, messageIds.size() - first);
+
+        std::string sqlString = "DELETE FROM " + MESSAGES_TABLE_NAME + " WHERE id IN (?";
+        for (size_t i = 1; i < count; ++i) {
+            sqlString += ",?";
+        }
+        sqlString += ");";
+
+        auto statement = m_database.createStatement(sqlString);
+
+        if (!statement) {
+            ACSDK_ERROR(LX("eraseFailed").m("Could not create statement."));
+            return false;
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            if (!statement->bindIntParameter(static_cast<int>(i) + 1, messageIds[first + i])) {
+                ACSDK_ERROR(LX("eraseFailed").m("Could not bind messageId."));
+                return false;
+            }
+        }
+
+        if (!statement->step()) {
+            ACSDK_ERROR(LX("eraseFailed").m("Could not perform step."));
+            return false;
+        }
+    }
+
+    return true;
+}
+
 bool SQLiteMessageStorage::clearDatabase() {
     if (!m_database.clearTable(MESSAGES_TABLE_NAME)) {
         ACSDK_ERROR(LX("clearDatabaseFailed").m("could not clear messages table."));
@@ -0,0 +1,414 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file CertifiedSenderBenchmarkTest.cpp
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <AVSCommon/AVS/AbstractAVSConnectionManager.h>
+#include <AVSCommon/AVS/Initialization/AlexaClientSDKInit.h>
+#include <AVSCommon/SDKInterfaces/MessageSenderInterface.h>
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <RegistrationManager/CustomerDataManager.h>
+
+#include "CertifiedSender/CertifiedSender.h"
+#include "CertifiedSender/SQLiteMessageStorage.h"
+
+namespace alexaClientSDK {
+namespace certifiedSender {
+namespace test {
+
+using namespace avsCommon::avs;
+using namespace avsCommon::avs::initialization;
+using namespace avsCommon::sdkInterfaces;
+using namespace avsCommon::utils::configuration;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("CertifiedSenderBenchmarkTest");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The database file used by the @c SQLiteMessageStorage.
+static const std::string DB_FILE_PATH = "CertifiedSenderBenchmarkTest.db";
+
+/// The number of messages queued while offline, and drained once connected.
+static const int BACKLOG_SIZE = 500;
+
+/// The round trip of each message through the stand-in transport.
+static const std::chrono::milliseconds ROUND_TRIP(5);
+
+/// The number of messages in flight for the pipelined drain.
+static const int PIPELINED_MESSAGES_IN_FLIGHT = 8;
+
+/// The number of events the stand-in transport sends at once unless configured otherwise, as for @c HTTP2Transport.
+static const int DEFAULT_MAX_CONCURRENT_EVENT_STREAMS = 1;
+
+/// Long timeout for the backlog of messages to complete and be erased from storage (we should not reach this).
+static const std::chrono::seconds LONG_TIMEOUT(30);
+
+/**
+ * Builds a message the size of a typical event, an @c AlertStopped.  Each message of the backlog is about a different
+ * alert, so that the messages do not depend on each other.
+ *
+ * @param index The index of the message in the backlog.
+ * @return The message.
+ */
+static std::string createMessage(int index) {
+    return R"({"context":[],"event":{"header":{"namespace":"Alerts","name":"AlertStopped",)"
+           R"("messageId":"6d3b3e0c-7b4d-4b8a-9c2e-1f0a2b3c4d5e"},"payload":{"token":"amzn1.alert.token.)" +
+           std::to_string(index) + R"("}}})";
+}
+
+class MockConnection : public AbstractAVSConnectionManager {
+    MOCK_METHOD0(enable, void());
+    MOCK_METHOD0(disable, void());
+    MOCK_METHOD0(isEnabled, bool());
+    MOCK_METHOD0(reconnect, void());
+    MOCK_CONST_METHOD0(isConnected, bool());
+    MOCK_METHOD1(addMessageObserver, void(std::shared_ptr<MessageObserverInterface> observer));
+    MOCK_METHOD1(removeMessageObserver, void(std::shared_ptr<MessageObserverInterface> observer));
+};
+
+/**
+ * A stand-in for the HTTP/2 transport, which completes every message @c ROUND_TRIP after it was sent.  Like
+ * @c HTTP2Transport, it sends at most a given number of messages at once, and while several may be sent at once it
+ * holds back a message whose ordering key matches one in flight or one queued ahead of it.
+ */
+class LoopbackMessageSender : public MessageSenderInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param maxConcurrentEventStreams The number of messages which may be sent at once.
+     */
+    LoopbackMessageSender(int maxConcurrentEventStreams) :
+            m_maxConcurrentEventStreams{maxConcurrentEventStreams},
+            m_completedCount{0},
+            m_maxOutstandingCount{0},
+            m_isShuttingDown{false} {
+        m_thread = std::thread(&LoopbackMessageSender::completionLoop, this);
+    }
+
+    /**
+     * Destructor.
+     */
+    ~LoopbackMessageSender() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_isShuttingDown = true;
+        }
+        m_cv.notify_all();
+        m_thread.join();
+    }
+
+    void sendMessage(std::shared_ptr<MessageRequest> request) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queued.push_back(request);
+        dispatch();
+        m_cv.notify_all();
+    }
+
+    /**
+     * Waits for a number of messages to have completed.
+     *
+     * @param count The number of messages.
+     * @return Whether they completed within @c LONG_TIMEOUT.
+     */
+    bool waitForCompleted(int count) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_cv.wait_for(lock, LONG_TIMEOUT, [this, count]() { return m_completedCount >= count; });
+    }
+
+    /**
+     * Returns the largest number of messages which have been sent at once.
+     *
+     * @return The largest number of messages which have been sent at once.
+     */
+    int getMaxOutstandingCount() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_maxOutstandingCount;
+    }
+
+private:
+    /// A message which has been sent and not yet completed.
+    struct Outstanding {
+        /// When the message completes.
+        std::chrono::steady_clock::time_point completionTime;
+        /// The message.
+        std::shared_ptr<MessageRequest> request;
+    };
+
+    /// Sends the queued messages which the transport would send now.  @c m_mutex must be held.
+    void dispatch() {
+        auto it = m_queued.begin();
+        std::unordered_set<std::string> blockedOrderingKeys;
+        for (auto& outstanding : m_outstanding) {
+            blockedOrderingKeys.insert(outstanding.request->getOrderingKey());
+        }
+        while (it != m_queued.end() && static_cast<int>(m_outstanding.size()) < m_maxConcurrentEventStreams) {
+            if (m_maxConcurrentEventStreams > 1 && !blockedOrderingKeys.insert((*it)->getOrderingKey()).second) {
+                ++it;
+                continue;
+            }
+            m_outstanding.push_back({std::chrono::steady_clock::now() + ROUND_TRIP, *it});
+            it = m_queued.erase(it);
+        }
+        m_maxOutstandingCount = std::max(m_maxOutstandingCount, static_cast<int>(m_outstanding.size()));
+    }
+
+    /// Completes each message at its completion time.
+    void completionLoop() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (!m_isShuttingDown) {
+            if (m_outstanding.empty()) {
+                m_cv.wait(lock);
+                continue;
+            }
+            auto completionTime = m_outstanding.front().completionTime;
+            if (std::chrono::steady_clock::now() < completionTime) {
+                m_cv.wait_until(lock, completionTime);
+                continue;
+            }
+            auto request = m_outstanding.front().request;
+            m_outstanding.pop_front();
+            lock.unlock();
+            request->sendCompleted(MessageRequestObserverInterface::Status::SUCCESS_NO_CONTENT);
+            lock.lock();
+            ++m_completedCount;
+            dispatch();
+            m_cv.notify_all();
+        }
+    }
+
+    /// The number of messages which may be sent at once.
+    const int m_maxConcurrentEventStreams;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// Notified when a message is sent or completed, and on shutdown.
+    std::condition_variable m_cv;
+
+    /// The messages passed to @c sendMessage() and not yet sent, in order.
+    std::list<std::shared_ptr<MessageRequest>> m_queued;
+
+    /// The messages sent and not yet completed, in the order of their completion times.
+    std::deque<Outstanding> m_outstanding;
+
+    /// The number of messages completed.
+    int m_completedCount;
+
+    /// The largest number of messages which have been sent at once.
+    int m_maxOutstandingCount;
+
+    /// Whether the destructor has been called.
+    bool m_isShuttingDown;
+
+    /// The thread which completes the messages.
+    std::thread m_thread;
+};
+
+/// Message storage which counts the messages erased, so that the end of a drain can be waited for.
+class CountingMessageStorage : public MessageStorageInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param storage The storage which holds the messages.
+     */
+    CountingMessageStorage(std::unique_ptr<SQLiteMessageStorage> storage) :
+            m_storage{std::move(storage)},
+            m_erasedCount{0} {
+    }
+
+    bool createDatabase() override {
+        return m_storage->createDatabase();
+    }
+
+    bool open() override {
+        return m_storage->open();
+    }
+
+    void close() override {
+        m_storage->close();
+    }
+
+    bool store(const std::string& message, int* id) override {
+        return m_storage->store(message, id);
+    }
+
+    bool load(std::queue<StoredMessage>* messageContainer) override {
+        return m_storage->load(messageContainer);
+    }
+
+    bool erase(int messageId) override {
+        return erase(std::vector<int>{messageId});
+    }
+
+    bool erase(const std::vector<int>& messageIds) override {
+        bool erased = m_storage->erase(messageIds);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_erasedCount += static_cast<int>(messageIds.size());
+        m_cv.notify_all();
+        return erased;
+    }
+
+    bool clearDatabase() override {
+        return m_storage->clearDatabase();
+    }
+
+    /**
+     * Waits for a number of messages to have been erased.
+     *
+     * @param count The number of messages.
+     * @return Whether they were erased within @c LONG_TIMEOUT.
+     */
+    bool waitForErased(int count) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_cv.wait_for(lock, LONG_TIMEOUT, [this, count]() { return m_erasedCount >= count; });
+    }
+
+private:
+    /// The storage which holds the messages.
+    std::unique_ptr<SQLiteMessageStorage> m_storage;
+
+    /// Serializes access to @c m_erasedCount.
+    std::mutex m_mutex;
+
+    /// Notified when messages are erased.
+    std::condition_variable m_cv;
+
+    /// The number of messages erased.
+    int m_erasedCount;
+};
+
+/**
+ * Queues @c BACKLOG_SIZE messages in a @c CertifiedSender while it is offline, then connects it and measures how long
+ * the backlog takes to drain through a @c LoopbackMessageSender.
+ *
+ * @param maxMessagesInFlight The number of messages which may be in flight.
+ * @param maxConcurrentEventStreams The number of messages the transport sends at once.
+ * @param[out] drainMs The time from connecting until every message had completed and been erased from storage.
+ * @param[out] maxSentAtOnce The largest number of messages the transport sent at once.
+ */
+static void measureDrain(
+    int maxMessagesInFlight,
+    int maxConcurrentEventStreams,
+    long long* drainMs,
+    int* maxSentAtOnce) {
+    std::remove(DB_FILE_PATH.c_str());
+    auto configuration = std::shared_ptr<std::stringstream>(new std::stringstream());
+    (*configuration) << R"({"certifiedSender":{"databaseFilePath":")" << DB_FILE_PATH
+                     << R"(","queueSizeWarnLimit":)" << BACKLOG_SIZE << R"(,"queueSizeHardLimit":)" << BACKLOG_SIZE
+                     << R"(,"maxMessagesInFlight":)" << maxMessagesInFlight << "}}";
+    ASSERT_TRUE(AlexaClientSDKInit::initialize({configuration}));
+
+    auto sender = std::make_shared<LoopbackMessageSender>(maxConcurrentEventStreams);
+    auto connection = std::make_shared<MockConnection>();
+    auto sqliteStorage = SQLiteMessageStorage::create(ConfigurationNode::getRoot());
+    ASSERT_TRUE(sqliteStorage);
+    auto storage = std::make_shared<CountingMessageStorage>(std::move(sqliteStorage));
+    auto certifiedSender = CertifiedSender::create(
+        sender, connection, storage, std::make_shared<registrationManager::CustomerDataManager>());
+    ASSERT_TRUE(certifiedSender);
+
+    std::vector<std::future<bool>> stored;
+    for (int i = 0; i < BACKLOG_SIZE; ++i) {
+        stored.push_back(certifiedSender->sendJSONMessage(createMessage(i)));
+    }
+    for (auto& future : stored) {
+        ASSERT_TRUE(future.get());
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::static_pointer_cast<ConnectionStatusObserverInterface>(certifiedSender)
+        ->onConnectionStatusChanged(
+            ConnectionStatusObserverInterface::Status::CONNECTED,
+            ConnectionStatusObserverInterface::ChangedReason::ACL_CLIENT_REQUEST);
+    ASSERT_TRUE(sender->waitForCompleted(BACKLOG_SIZE));
+    ASSERT_TRUE(storage->waitForErased(BACKLOG_SIZE));
+    *drainMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    *maxSentAtOnce = sender->getMaxOutstandingCount();
+
+    connection->removeConnectionStatusObserver(certifiedSender);
+    certifiedSender.reset();
+
+    std::queue<MessageStorageInterface::StoredMessage> remaining;
+    ASSERT_TRUE(storage->load(&remaining));
+    ASSERT_TRUE(remaining.empty());
+
+    storage->close();
+    AlexaClientSDKInit::uninitialize();
+    std::remove(DB_FILE_PATH.c_str());
+}
+
+/**
+ * Measure how long a backlog of @c BACKLOG_SIZE messages takes to drain with one message in flight at a time, and
+ * with @c PIPELINED_MESSAGES_IN_FLIGHT, both through a transport which sends one event at a time and through one
+ * which sends as many as are in flight.
+ */
+TEST(CertifiedSenderBenchmarkTest, backlogDrainTime) {
+    long long serialDrainMs = 0;
+    int maxSentAtOnce = 0;
+    measureDrain(1, DEFAULT_MAX_CONCURRENT_EVENT_STREAMS, &serialDrainMs, &maxSentAtOnce);
+    EXPECT_EQ(maxSentAtOnce, 1);
+
+    long long singleStreamDrainMs = 0;
+    measureDrain(
+        PIPELINED_MESSAGES_IN_FLIGHT, DEFAULT_MAX_CONCURRENT_EVENT_STREAMS, &singleStreamDrainMs, &maxSentAtOnce);
+    EXPECT_EQ(maxSentAtOnce, 1);
+
+    long long pipelinedDrainMs = 0;
+    measureDrain(PIPELINED_MESSAGES_IN_FLIGHT, PIPELINED_MESSAGES_IN_FLIGHT, &pipelinedDrainMs, &maxSentAtOnce);
+    // The messages share a namespace, so unless they are keyed by their tokens the transport sends them one at a time.
+    EXPECT_EQ(maxSentAtOnce, PIPELINED_MESSAGES_IN_FLIGHT);
+
+    ACSDK_INFO(LX("backlogDrainTime")
+                   .d("messages", BACKLOG_SIZE)
+                   .d("roundTripMs", ROUND_TRIP.count())
+                   .d("serialDrainMs", serialDrainMs)
+                   .d("serialMessagesPerSecond", BACKLOG_SIZE * 1000 / std::max(serialDrainMs, 1LL))
+                   .d("pipelinedMessagesInFlight", PIPELINED_MESSAGES_IN_FLIGHT)
+                   .d("singleStreamDrainMs", singleStreamDrainMs)
+                   .d("pipelinedDrainMs", pipelinedDrainMs)
+                   .d("pipelinedMessagesPerSecond", BACKLOG_SIZE * 1000 / std::max(pipelinedDrainMs, 1LL)));
+}
+
+}  // namespace test
+}  // namespace certifiedSender
+}  // namespace alexaClientSDK
@@ -13,7 +13,14 @@
  * permissions and limitations under the License.
  */
 
+#include <chrono>
+#include <condition_variable>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -30,6 +37,32 @@ namespace alexaClientSDK {
 namespace certifiedSender {
 namespace test {
 
+using namespace avsCommon::avs;
+using namespace avsCommon::sdkInterfaces;
+
+/// Long timeout for messages to be sent, and for acknowledged messages to be erased (we should not reach this).
+static const std::chrono::seconds LONG_TIMEOUT(2);
+
+/// How long to wait before checking that a message which must wait has not been sent.
+static const std::chrono::milliseconds SHORT_TIMEOUT(100);
+
+/// An Alerts event about several alerts at once, which has no payload token.
+static const std::string DELETE_ALERTS_SUCCEEDED =
+    R"({"event":{"header":{"namespace":"Alerts","name":"DeleteAlertsSucceeded","messageId":"1"},)"
+    R"("payload":{"tokens":["tokenA","tokenB"]}}})";
+
+/**
+ * Builds an Alerts event about one alert.
+ *
+ * @param name The name of the event.
+ * @param token The token of the alert.
+ * @return The JSON content of the event.
+ */
+static std::string createAlertsEvent(const std::string& name, const std::string& token) {
+    return R"({"event":{"header":{"namespace":"Alerts","name":")" + name +
+           R"(","messageId":"1"},"payload":{"token":")" + token + R"("}}})";
+}
+
 class MockConnection : public avsCommon::avs::AbstractAVSConnectionManager {
     MOCK_METHOD0(enable, void());
     MOCK_METHOD0(disable, void());
@@ -52,10 +85,55 @@ public:
     MOCK_METHOD2(store, bool(const std::string& message, int* id));
     MOCK_METHOD1(load, bool(std::queue<StoredMessage>* messageContainer));
     MOCK_METHOD1(erase, bool(int messageId));
+    MOCK_METHOD1(erase, bool(const std::vector<int>& messageIds));
     MOCK_METHOD0(clearDatabase, bool());
     virtual ~MockMessageStorage() = default;
 };
 
+/// A message sender which records the messages sent, and leaves the test to complete them.
+class RecordingMessageSender : public MessageSenderInterface {
+public:
+    void sendMessage(std::shared_ptr<MessageRequest> request) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_sent.push_back(request);
+        m_cv.notify_all();
+    }
+
+    /**
+     * Waits for a number of messages to have been sent.
+     *
+     * @param count The number of messages.
+     * @return The messages sent, or an empty vector if fewer were sent within @c LONG_TIMEOUT.
+     */
+    std::vector<std::shared_ptr<MessageRequest>> waitForSent(size_t count) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_cv.wait_for(lock, LONG_TIMEOUT, [this, count]() { return m_sent.size() >= count; })) {
+            return {};
+        }
+        return m_sent;
+    }
+
+    /**
+     * Returns the number of messages sent.
+     *
+     * @return The number of messages sent.
+     */
+    size_t getSentCount() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_sent.size();
+    }
+
+private:
+    /// Serializes access to @c m_sent.
+    std::mutex m_mutex;
+
+    /// Notified when a message is sent.
+    std::condition_variable m_cv;
+
+    /// The messages sent, in order.
+    std::vector<std::shared_ptr<MessageRequest>> m_sent;
+};
+
 class CertifiedSenderTest : public ::testing::Test {
 public:
 protected:
@@ -104,6 +182,188 @@ TEST_F(CertifiedSenderTest, clearDataTest) {
     m_certifiedSender->clearData();
 }
 
+/**
+ * Check that with several messages in flight, messages are sent in order without waiting for the ones before them,
+ * the messages AVS has processed are erased together, and a message which failed is sent again once the messages
+ * sent after it have completed.
+ */
+TEST_F(CertifiedSenderTest, messagesInFlightTest) {
+    static const std::string CONFIGURATION = R"({
+        "certifiedSender" : {
+            "databaseFilePath":"database.db",
+            "maxMessagesInFlight":3
+        }
+    })";
+    avsCommon::avs::initialization::AlexaClientSDKInit::uninitialize();
+    auto configuration = std::shared_ptr<std::stringstream>(new std::stringstream());
+    (*configuration) << CONFIGURATION;
+    ASSERT_TRUE(avsCommon::avs::initialization::AlexaClientSDKInit::initialize({configuration}));
+
+    auto sender = std::make_shared<RecordingMessageSender>();
+    auto storage = std::make_shared<MockMessageStorage>();
+    EXPECT_CALL(*storage, open()).WillOnce(Return(true));
+    auto certifiedSender = CertifiedSender::create(
+        sender, m_connection, storage, std::make_shared<registrationManager::CustomerDataManager>());
+    ASSERT_TRUE(certifiedSender);
+
+    int nextId = 1;
+    EXPECT_CALL(*storage, store(_, _)).Times(4).WillRepeatedly(Invoke([&nextId](const std::string&, int* id) {
+        *id = nextId++;
+        return true;
+    }));
+    std::promise<void> erased;
+    EXPECT_CALL(*storage, erase(TypedEq<const std::vector<int>&>(std::vector<int>{1, 3})))
+        .WillOnce(Invoke([&erased](const std::vector<int>&) {
+            erased.set_value();
+            return true;
+        }));
+    for (int i = 1; i <= 4; ++i) {
+        ASSERT_TRUE(certifiedSender->sendJSONMessage(createAlertsEvent("AlertStopped", std::to_string(i))).get());
+    }
+
+    std::static_pointer_cast<ConnectionStatusObserverInterface>(certifiedSender)
+        ->onConnectionStatusChanged(
+            ConnectionStatusObserverInterface::Status::CONNECTED,
+            ConnectionStatusObserverInterface::ChangedReason::ACL_CLIENT_REQUEST);
+
+    // The first three are sent together, and the fourth waits for room in the window.
+    auto sent = sender->waitForSent(3);
+    ASSERT_EQ(sent.size(), 3u);
+    ASSERT_EQ(sent[0]->getJsonContent(), createAlertsEvent("AlertStopped", "1"));
+    ASSERT_EQ(sent[1]->getJsonContent(), createAlertsEvent("AlertStopped", "2"));
+    ASSERT_EQ(sent[2]->getJsonContent(), createAlertsEvent("AlertStopped", "3"));
+    ASSERT_EQ(sender->getSentCount(), 3u);
+
+    // They are about different alerts, so each is keyed by its token and the transport does not hold it back.
+    ASSERT_EQ(sent[0]->getOrderingKey(), "Alerts:1");
+    ASSERT_EQ(sent[1]->getOrderingKey(), "Alerts:2");
+    ASSERT_EQ(sent[2]->getOrderingKey(), "Alerts:3");
+
+    // The second fails, and the first and third are processed by AVS.
+    sent[2]->sendCompleted(MessageRequestObserverInterface::Status::SUCCESS);
+    sent[1]->sendCompleted(MessageRequestObserverInterface::Status::NOT_CONNECTED);
+    sent[0]->sendCompleted(MessageRequestObserverInterface::Status::SUCCESS);
+    ASSERT_EQ(std::future_status::ready, erased.get_future().wait_for(LONG_TIMEOUT));
+
+    // The second is sent again before the fourth.
+    sent = sender->waitForSent(5);
+    ASSERT_EQ(sent.size(), 5u);
+    ASSERT_EQ(sent[3]->getJsonContent(), createAlertsEvent("AlertStopped", "2"));
+    ASSERT_EQ(sent[4]->getJsonContent(), createAlertsEvent("AlertStopped", "4"));
+
+    m_connection->removeConnectionStatusObserver(certifiedSender);
+}
+
+/**
+ * Check that with several messages in flight, a message is not sent while a message it depends on is in flight: one
+ * about the same alert, or one of the same namespace without a token.  Messages are still sent in order.
+ */
+TEST_F(CertifiedSenderTest, dependentMessagesInFlightTest) {
+    static const std::string CONFIGURATION = R"({
+        "certifiedSender" : {
+            "databaseFilePath":"database.db",
+            "maxMessagesInFlight":3
+        }
+    })";
+    avsCommon::avs::initialization::AlexaClientSDKInit::uninitialize();
+    auto configuration = std::shared_ptr<std::stringstream>(new std::stringstream());
+    (*configuration) << CONFIGURATION;
+    ASSERT_TRUE(avsCommon::avs::initialization::AlexaClientSDKInit::initialize({configuration}));
+
+    auto sender = std::make_shared<RecordingMessageSender>();
+    auto storage = std::make_shared<MockMessageStorage>();
+    EXPECT_CALL(*storage, open()).WillOnce(Return(true));
+    auto certifiedSender = CertifiedSender::create(
+        sender, m_connection, storage, std::make_shared<registrationManager::CustomerDataManager>());
+    ASSERT_TRUE(certifiedSender);
+
+    int nextId = 1;
+    EXPECT_CALL(*storage, store(_, _)).Times(4).WillRepeatedly(Invoke([&nextId](const std::string&, int* id) {
+        *id = nextId++;
+        return true;
+    }));
+    EXPECT_CALL(*storage, erase(An<const std::vector<int>&>())).WillRepeatedly(Return(true));
+    const std::string alertStartedA = createAlertsEvent("AlertStarted", "tokenA");
+    const std::string alertStoppedA = createAlertsEvent("AlertStopped", "tokenA");
+    const std::string alertStartedB = createAlertsEvent("AlertStarted", "tokenB");
+    for (auto& message : {alertStartedA, alertStoppedA, alertStartedB, DELETE_ALERTS_SUCCEEDED}) {
+        ASSERT_TRUE(certifiedSender->sendJSONMessage(message).get());
+    }
+
+    std::static_pointer_cast<ConnectionStatusObserverInterface>(certifiedSender)
+        ->onConnectionStatusChanged(
+            ConnectionStatusObserverInterface::Status::CONNECTED,
+            ConnectionStatusObserverInterface::ChangedReason::ACL_CLIENT_REQUEST);
+
+    // The AlertStopped is about the same alert as the AlertStarted, so it waits, and the rest wait behind it.
+    auto sent = sender->waitForSent(1);
+    ASSERT_EQ(sent.size(), 1u);
+    ASSERT_EQ(sent[0]->getJsonContent(), alertStartedA);
+    std::this_thread::sleep_for(SHORT_TIMEOUT);
+    ASSERT_EQ(sender->getSentCount(), 1u);
+
+    // Once it completes, the AlertStopped and the AlertStarted of another alert are in flight together.  The event
+    // without a token depends on both.
+    sent[0]->sendCompleted(MessageRequestObserverInterface::Status::SUCCESS);
+    sent = sender->waitForSent(3);
+    ASSERT_EQ(sent.size(), 3u);
+    ASSERT_EQ(sent[1]->getJsonContent(), alertStoppedA);
+    ASSERT_EQ(sent[2]->getJsonContent(), alertStartedB);
+    ASSERT_NE(sent[1]->getOrderingKey(), sent[2]->getOrderingKey());
+    std::this_thread::sleep_for(SHORT_TIMEOUT);
+    ASSERT_EQ(sender->getSentCount(), 3u);
+
+    sent[2]->sendCompleted(MessageRequestObserverInterface::Status::SUCCESS);
+    std::this_thread::sleep_for(SHORT_TIMEOUT);
+    ASSERT_EQ(sender->getSentCount(), 3u);
+    sent[1]->sendCompleted(MessageRequestObserverInterface::Status::SUCCESS);
+    sent = sender->waitForSent(4);
+    ASSERT_EQ(sent.size(), 4u);
+    ASSERT_EQ(sent[3]->getJsonContent(), DELETE_ALERTS_SUCCEEDED);
+    ASSERT_EQ(sent[3]->getOrderingKey(), "Alerts");
+
+    m_connection->removeConnectionStatusObserver(certifiedSender);
+}
+
+/**
+ * Check that with one message in flight at a time, messages keep the ordering key of their namespace.
+ */
+TEST_F(CertifiedSenderTest, serialMessageOrderingKeyTest) {
+    static const std::string MESSAGE =
+        R"({"event":{"header":{"namespace":"Alerts","name":"AlertStopped","messageId":"1"},"payload":{}}})";
+    auto sender = std::make_shared<RecordingMessageSender>();
+    auto storage = std::make_shared<MockMessageStorage>();
+    EXPECT_CALL(*storage, open()).WillOnce(Return(true));
+    EXPECT_CALL(*storage, store(_, _)).WillOnce(Invoke([](const std::string&, int* id) {
+        *id = 1;
+        return true;
+    }));
+    auto certifiedSender = CertifiedSender::create(
+        sender, m_connection, storage, std::make_shared<registrationManager::CustomerDataManager>());
+    ASSERT_TRUE(certifiedSender);
+    ASSERT_TRUE(certifiedSender->sendJSONMessage(MESSAGE).get());
+
+    std::static_pointer_cast<ConnectionStatusObserverInterface>(certifiedSender)
+        ->onConnectionStatusChanged(
+            ConnectionStatusObserverInterface::Status::CONNECTED,
+            ConnectionStatusObserverInterface::ChangedReason::ACL_CLIENT_REQUEST);
+
+    auto sent = sender->waitForSent(1);
+    ASSERT_EQ(sent.size(), 1u);
+    ASSERT_EQ(sent[0]->getOrderingKey(), "Alerts");
+
+    std::promise<void> erased;
+    EXPECT_CALL(*storage, erase(TypedEq<const std::vector<int>&>(std::vector<int>{1})))
+        .WillOnce(Invoke([&erased](const std::vector<int>&) {
+            erased.set_value();
+            return true;
+        }));
+    sent[0]->sendCompleted(MessageRequestObserverInterface::Status::SUCCESS);
+    ASSERT_EQ(std::future_status::ready, erased.get_future().wait_for(LONG_TIMEOUT));
+
+    m_connection->removeConnectionStatusObserver(certifiedSender);
+}
+
 }  // namespace test
 }  // namespace certifiedSender
 }  // namespace alexaClientSDK
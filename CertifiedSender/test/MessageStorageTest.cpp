@@ -20,6 +20,7 @@
 
 #include <AVSCommon/Utils/File/FileUtils.h>
 
+#include <chrono>
 #include <fstream>
 #include <queue>
 #include <memory>
@@ -46,6 +47,8 @@ static const std::string TEST_MESSAGE_ONE = "test_message_one";
 static const std::string TEST_MESSAGE_TWO = "test_message_two";
 /// A test message text.
 static const std::string TEST_MESSAGE_THREE = "test_message_three";
+/// A group-commit delay longer than any test, so that nothing is committed by the committer thread.
+static const std::chrono::milliseconds LONG_COMMIT_DELAY(10000);
 
 /**
  * A class which helps drive this unit test suite.
@@ -201,6 +204,29 @@ TEST_F(MessageStorageTest, testDatabaseErase) {
     ASSERT_EQ(dbMessages.front().message, TEST_MESSAGE_THREE);
 }
 
+/**
+ * Test erasing several records from the database at once.
+ */
+TEST_F(MessageStorageTest, testDatabaseEraseSeveral) {
+    createDatabase();
+    ASSERT_TRUE(isOpen(m_storage));
+
+    int firstId = 0;
+    int secondId = 0;
+    int thirdId = 0;
+    ASSERT_TRUE(m_storage->store(TEST_MESSAGE_ONE, &firstId));
+    ASSERT_TRUE(m_storage->store(TEST_MESSAGE_TWO, &secondId));
+    ASSERT_TRUE(m_storage->store(TEST_MESSAGE_THREE, &thirdId));
+
+    // erase the first and the last, then verify only the second is left
+    ASSERT_TRUE(m_storage->erase(std::vector<int>{firstId, thirdId}));
+
+    std::queue<MessageStorageInterface::StoredMessage> dbMessages;
+    ASSERT_TRUE(m_storage->load(&dbMessages));
+    ASSERT_EQ(static_cast<int>(dbMessages.size()), 1);
+    ASSERT_EQ(dbMessages.front().message, TEST_MESSAGE_TWO);
+}
+
 /**
  * Test clearing the database.
  */
@@ -226,6 +252,27 @@ TEST_F(MessageStorageTest, testDatabaseClear) {
     ASSERT_EQ(static_cast<int>(dbMessages.size()), 0);
 }
 
+/**
+ * Test that with a group-commit delay, a stored message is committed before @c store() returns, so that another
+ * connection to the database sees it straight away.
+ */
+TEST_F(MessageStorageTest, testStoreCommitsWithGroupCommitDelay) {
+    SQLiteMessageStorage groupCommitStorage(g_dbTestFilePath, LONG_COMMIT_DELAY);
+    ASSERT_TRUE(groupCommitStorage.createDatabase());
+
+    int dbId = 0;
+    ASSERT_TRUE(groupCommitStorage.store(TEST_MESSAGE_ONE, &dbId));
+
+    ASSERT_TRUE(m_storage->open());
+    std::queue<MessageStorageInterface::StoredMessage> dbMessages;
+    ASSERT_TRUE(m_storage->load(&dbMessages));
+    ASSERT_EQ(static_cast<int>(dbMessages.size()), 1);
+    ASSERT_EQ(dbMessages.front().message, TEST_MESSAGE_ONE);
+
+    m_storage->close();
+    groupCommitStorage.close();
+}
+
 }  // namespace test
 }  // namespace certifiedSender
 }  // namespace alexaClientSDK
@@ -34,6 +34,7 @@
 #include <AVSCommon/SDKInterfaces/StateProviderInterface.h>
 #include <AVSCommon/AVS/StateRefreshPolicy.h>
 #include <AVSCommon/AVS/NamespaceAndName.h>
+#include <AVSCommon/Utils/Timing/LatencyHistogram.h>
 
 namespace alexaClientSDK {
 namespace contextManager {
@@ -41,15 +42,29 @@ namespace contextManager {
 /**
  * Class manages the requests for getting context from @c ContextRequesters and updating the state from
  * @c StateProviders.
+ *
+ * Each state is validated and serialized, together with its header, once when it changes rather than on every
+ * @c getContext(), and the assembled context is kept and shared by all requests until one of the states changes.
+ *
+ * A state provider which has not answered a @c provideState request by its deadline does not hold up the context if
+ * it has provided a state before: that last known state is used instead.  Only a provider with no state to fall back
+ * on can make the request fail, once @c provideState has gone unanswered for two seconds.  The time each provider
+ * takes to answer is recorded, and can be read with @c getProvideStateLatencies().
  */
 class ContextManager : public avsCommon::sdkInterfaces::ContextManagerInterface {
 public:
+    /// The time a state provider has by default to answer a @c provideState request before its last state is used.
+    static const std::chrono::milliseconds DEFAULT_PROVIDE_STATE_DEADLINE;
+
     /**
      * Create a new @c ContextManager instance.
      *
+     * @param defaultProvideStateDeadline The time a state provider has to answer a @c provideState request before its
+     * last known state is used instead, unless it has its own deadline.
      * @return Returns a new @c ContextManager.
      */
-    static std::shared_ptr<ContextManager> create();
+    static std::shared_ptr<ContextManager> create(
+        std::chrono::milliseconds defaultProvideStateDeadline = DEFAULT_PROVIDE_STATE_DEADLINE);
 
     /// Destructor.
     ~ContextManager() override;
@@ -66,6 +81,26 @@ public:
 
     void getContext(std::shared_ptr<avsCommon::sdkInterfaces::ContextRequesterInterface> contextRequester) override;
 
+    /**
+     * Sets the time a state provider has to answer a @c provideState request before its last known state is used
+     * instead. The deadline is kept if the state provider is removed and set again.
+     *
+     * @param stateProviderName The namespace and name of the state provider.
+     * @param deadline The time the state provider has to answer.
+     */
+    void setProvideStateDeadline(
+        const avsCommon::avs::NamespaceAndName& stateProviderName,
+        std::chrono::milliseconds deadline);
+
+    /**
+     * Returns how long each state provider has taken to answer @c provideState requests, including the answers which
+     * came after its deadline.
+     *
+     * @return A histogram of the latencies of each state provider which has been asked for its state.
+     */
+    std::unordered_map<avsCommon::avs::NamespaceAndName, avsCommon::utils::timing::LatencyHistogram>
+    getProvideStateLatencies();
+
 private:
     /**
      * This class has all the information about a @c StateProviderInterface needed by the contextManager.
@@ -80,6 +115,12 @@ private:
         /// RefreshPolicy for the state of a @c StateProviderInterface.
         avsCommon::avs::StateRefreshPolicy refreshPolicy;
 
+        /**
+         * The state with its header, serialized as it appears in the context, or an empty string if it has not been
+         * built from @c jsonState yet.
+         */
+        std::string fragment;
+
         /**
          * Constructor.
          *
@@ -93,8 +134,13 @@ private:
             avsCommon::avs::StateRefreshPolicy initRefreshPolicy = avsCommon::avs::StateRefreshPolicy::ALWAYS);
     };
 
-    /// Constructor.
-    ContextManager();
+    /**
+     * Constructor.
+     *
+     * @param defaultProvideStateDeadline The time a state provider has to answer a @c provideState request, unless it
+     * has its own deadline.
+     */
+    ContextManager(std::chrono::milliseconds defaultProvideStateDeadline);
 
     /**
      * Initialize a new instance of @c ContextManager.
@@ -121,10 +167,20 @@ private:
      */
     void requestStatesLocked(std::unique_lock<std::mutex>& stateProviderLock);
 
+    /**
+     * Waits for the @c StateProviderInterfaces asked by @c requestStatesLocked to answer. A provider which misses its
+     * deadline is no longer waited for if it has a last known state to fall back on.
+     *
+     * @param stateProviderLock The lock acquired on the @c m_stateProviderMutex.
+     * @return @c true if every provider has answered or has a state to fall back on, or @c false if a provider with
+     * no state has not answered within @c PROVIDE_STATE_DEFAULT_TIMEOUT.
+     */
+    bool waitForStatesLocked(std::unique_lock<std::mutex>& stateProviderLock);
+
     /**
      * Sends the context to all @c ContextRequesterInterfaces in the queue. It sends failure to all the
      * @c ContextRequesterInterfaces if an error was encountered while updating the states or building the context.
-     * It removes the @c ContextRequesterInterface from the queue after sending context or failure.
+     * It takes the @c ContextRequesterInterfaces off the queue before sending them the context or failure.
      *
      * @param context The context JSON string. This is an empty string if a failure needs to be reported.
      * @param contextRequestError The error to send to the context requesters. If the context is not an empty string,
@@ -142,33 +198,27 @@ private:
     void updateStatesLoop();
 
     /**
-     * Builds the context header.
+     * Builds the serialized JSON state object for a state provider. The state includes the header and the payload.
      *
      * @param namespaceAndName Namespace and name of the state provider.
-     * @param allocator The rapidjson allocator to use to build the JSON header.
-     * @return Header as a JSON object if successful else empty value.
+     * @param jsonPayloadValue The payload value associated with the "payload" key.
+     * @return The serialized state if successful, else an empty string.
      */
-    rapidjson::Value buildHeader(
+    std::string buildState(
         const avsCommon::avs::NamespaceAndName& namespaceAndName,
-        rapidjson::Document::AllocatorType& allocator);
+        const std::string& jsonPayloadValue);
 
     /**
-     * Builds a JSON state object. The state includes the header and the payload.
+     * Builds the context from the states of all the state providers, rebuilding only the states which have changed
+     * since they were last built. The @c m_stateProviderMutex needs to be acquired before this function is called.
      *
-     * @param namespaceAndName Namespace and name of the state provider.
-     * @param jsonPayloadValue The payload value associated with the "payload" key.
-     * @param allocator The rapidjson allocator to use to build the JSON header.
-     * @return A state object if successful else empty value.
+     * @return The context, or @c nullptr if a state could not be built.
      */
-    rapidjson::Value buildState(
-        const avsCommon::avs::NamespaceAndName& namespaceAndName,
-        const std::string jsonPayloadValue,
-        rapidjson::Document::AllocatorType& allocator);
+    std::shared_ptr<const std::string> buildContextLocked();
 
     /**
-     * Builds the context states from a map of state provider namespace and name to state information provided by each
-     * of the @c stateProviderInterfaces and sends the context by calling @c onContextAvailable for each of the context
-     * requesters.
+     * Sends the context, which is reused from the previous request if no state has changed since, by calling
+     * @c onContextAvailable for each of the context requesters.
      */
     void sendContextToRequesters();
 
@@ -178,6 +228,12 @@ private:
      */
     std::unordered_map<avsCommon::avs::NamespaceAndName, std::shared_ptr<StateInfo>> m_namespaceNameToStateInfo;
 
+    /**
+     * The context which was last built, or @c nullptr if a state provider or state has changed since.
+     * @c m_stateProviderMutex must be acquired before accessing it.
+     */
+    std::shared_ptr<const std::string> m_cachedContext;
+
     /// Queue of contextRequesters. @c m_contextRequesterMutex must be acquired before accessing the queue.
     std::queue<std::shared_ptr<avsCommon::sdkInterfaces::ContextRequesterInterface>> m_contextRequesterQueue;
 
@@ -187,6 +243,34 @@ private:
      */
     std::unordered_set<avsCommon::avs::NamespaceAndName> m_pendingOnStateProviders;
 
+    /**
+     * The state providers which have been sent the current @c provideState request and have not answered yet,
+     * including those which are no longer waited for. @c m_stateProviderMutex must be acquired before accessing it.
+     */
+    std::unordered_set<avsCommon::avs::NamespaceAndName> m_unansweredStateProviders;
+
+    /**
+     * When the current @c provideState requests were sent. @c m_stateProviderMutex must be acquired before accessing
+     * it.
+     */
+    std::chrono::steady_clock::time_point m_stateRequestTime;
+
+    /// The time a state provider has to answer a @c provideState request, unless it has its own deadline.
+    const std::chrono::milliseconds m_defaultProvideStateDeadline;
+
+    /**
+     * The state providers with their own deadline for answering @c provideState. @c m_stateProviderMutex must be
+     * acquired before accessing the map.
+     */
+    std::unordered_map<avsCommon::avs::NamespaceAndName, std::chrono::milliseconds> m_provideStateDeadlines;
+
+    /**
+     * The time each state provider has taken to answer @c provideState requests. @c m_stateProviderMutex must be
+     * acquired before accessing the map.
+     */
+    std::unordered_map<avsCommon::avs::NamespaceAndName, avsCommon::utils::timing::LatencyHistogram>
+        m_provideStateLatencies;
+
     /// Mutex to manage writes and reads to and from @c m_namespaceNameToStateInfo.
     std::mutex m_stateProviderMutex;
 
@@ -13,13 +13,17 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <string>
 
 #include <AVSCommon/Utils/Logger/Logger.h>
 
 #include "ContextManager/ContextManager.h"
 
-/// A state provider is expected to respond to a @c provideState request within this timeout period.
+/**
+ * A state provider is expected to respond to a @c provideState request within this timeout period. A provider which
+ * has no earlier state to fall back on is waited for this long before the context request fails.
+ */
 static const std::chrono::seconds PROVIDE_STATE_DEFAULT_TIMEOUT = std::chrono::seconds(2);
 
 namespace alexaClientSDK {
@@ -30,6 +34,7 @@ using namespace avsCommon;
 using namespace avsCommon::avs;
 using namespace avsCommon::sdkInterfaces;
 using namespace avsCommon::utils;
+using namespace avsCommon::utils::timing;
 
 /// String to identify log entries originating from this file.
 static const std::string TAG("ContextManager");
@@ -56,8 +61,10 @@ static const std::string PAYLOAD_JSON_KEY = "payload";
 /// The context json key.
 static const std::string CONTEXT_JSON_KEY = "context";
 
-std::shared_ptr<ContextManager> ContextManager::create() {
-    std::shared_ptr<ContextManager> contextManager(new ContextManager());
+const std::chrono::milliseconds ContextManager::DEFAULT_PROVIDE_STATE_DEADLINE = std::chrono::milliseconds(500);
+
+std::shared_ptr<ContextManager> ContextManager::create(std::chrono::milliseconds defaultProvideStateDeadline) {
+    std::shared_ptr<ContextManager> contextManager(new ContextManager(defaultProvideStateDeadline));
     contextManager->init();
     return contextManager;
 }
@@ -71,6 +78,13 @@ ContextManager::~ContextManager() {
     if (m_updateStatesThread.joinable()) {
         m_updateStatesThread.join();
     }
+
+    for (const auto& latencies : m_provideStateLatencies) {
+        ACSDK_DEBUG0(LX("provideStateLatencies")
+                         .d("namespace", latencies.first.nameSpace)
+                         .d("name", latencies.first.name)
+                         .d("latencies", latencies.second.toString()));
+    }
 }
 
 void ContextManager::setStateProvider(
@@ -78,7 +92,9 @@ void ContextManager::setStateProvider(
     std::shared_ptr<StateProviderInterface> stateProvider) {
     std::lock_guard<std::mutex> stateProviderLock(m_stateProviderMutex);
     if (!stateProvider) {
-        m_namespaceNameToStateInfo.erase(stateProviderName);
+        if (m_namespaceNameToStateInfo.erase(stateProviderName)) {
+            m_cachedContext.reset();
+        }
         ACSDK_DEBUG5(LX("setStateProvider")
                          .d("action", "removedStateProvider")
                          .d("namespace", stateProviderName.nameSpace)
@@ -88,6 +104,7 @@ void ContextManager::setStateProvider(
     auto stateInfoMappingIt = m_namespaceNameToStateInfo.find(stateProviderName);
     if (m_namespaceNameToStateInfo.end() == stateInfoMappingIt) {
         m_namespaceNameToStateInfo[stateProviderName] = std::make_shared<StateInfo>(stateProvider);
+        m_cachedContext.reset();
     } else {
         stateInfoMappingIt->second->stateProvider = stateProvider;
     }
@@ -114,6 +131,14 @@ SetStateResult ContextManager::setState(
     }
     SetStateResult status = updateStateLocked(stateProviderName, jsonState, refreshPolicy);
     if (SetStateResult::SUCCESS == status) {
+        if (m_unansweredStateProviders.erase(stateProviderName)) {
+            auto latency = std::chrono::steady_clock::now() - m_stateRequestTime;
+            m_provideStateLatencies[stateProviderName].record(latency);
+            ACSDK_DEBUG9(LX("setState")
+                             .d("namespace", stateProviderName.nameSpace)
+                             .d("name", stateProviderName.name)
+                             .d("latencyUs", std::chrono::duration_cast<std::chrono::microseconds>(latency).count()));
+        }
         auto it = m_pendingOnStateProviders.find(stateProviderName);
         if (it != m_pendingOnStateProviders.end()) {
             m_pendingOnStateProviders.erase(it);
@@ -130,6 +155,18 @@ SetStateResult ContextManager::setState(
     return status;
 }
 
+void ContextManager::setProvideStateDeadline(
+    const NamespaceAndName& stateProviderName,
+    std::chrono::milliseconds deadline) {
+    std::lock_guard<std::mutex> stateProviderLock(m_stateProviderMutex);
+    m_provideStateDeadlines[stateProviderName] = deadline;
+}
+
+std::unordered_map<NamespaceAndName, LatencyHistogram> ContextManager::getProvideStateLatencies() {
+    std::lock_guard<std::mutex> stateProviderLock(m_stateProviderMutex);
+    return m_provideStateLatencies;
+}
+
 void ContextManager::getContext(std::shared_ptr<ContextRequesterInterface> contextRequester) {
     std::lock_guard<std::mutex> contextRequesterLock(m_contextRequesterMutex);
     m_contextRequesterQueue.push(contextRequester);
@@ -151,7 +188,10 @@ ContextManager::StateInfo::StateInfo(
         refreshPolicy{initRefreshPolicy} {
 }
 
-ContextManager::ContextManager() : m_stateRequestToken{0}, m_shutdown{false} {
+ContextManager::ContextManager(std::chrono::milliseconds defaultProvideStateDeadline) :
+        m_defaultProvideStateDeadline{defaultProvideStateDeadline},
+        m_stateRequestToken{0},
+        m_shutdown{false} {
 }
 
 void ContextManager::init() {
@@ -172,9 +212,19 @@ SetStateResult ContextManager::updateStateLocked(
             return SetStateResult::STATE_PROVIDER_NOT_REGISTERED;
         }
         m_namespaceNameToStateInfo[stateProviderName] = std::make_shared<StateInfo>(nullptr, jsonState, refreshPolicy);
+        m_cachedContext.reset();
     } else {
-        stateInfoMappingIt->second->jsonState = jsonState;
-        stateInfoMappingIt->second->refreshPolicy = refreshPolicy;
+        auto& stateInfo = stateInfoMappingIt->second;
+        // Providers with an ALWAYS refresh policy usually report an unchanged state, which needs no rebuilding.
+        if (stateInfo->jsonState != jsonState) {
+            stateInfo->jsonState = jsonState;
+            stateInfo->fragment.clear();
+            m_cachedContext.reset();
+        }
+        if (stateInfo->refreshPolicy != refreshPolicy) {
+            stateInfo->refreshPolicy = refreshPolicy;
+            m_cachedContext.reset();
+        }
         ACSDK_DEBUG9(LX("updateStateLocked")
                          .d("action", "updatedState")
                          .sensitive("state", jsonState)
@@ -195,11 +245,16 @@ void ContextManager::requestStatesLocked(std::unique_lock<std::mutex>& stateProv
     }
     unsigned int curStateReqToken(m_stateRequestToken);
 
+    // Answers to earlier requests which never came are of no interest any more.
+    m_pendingOnStateProviders.clear();
+    m_unansweredStateProviders.clear();
+    m_stateRequestTime = std::chrono::steady_clock::now();
     for (auto it = m_namespaceNameToStateInfo.begin(); it != m_namespaceNameToStateInfo.end(); ++it) {
         auto& stateInfo = it->second;
         if (StateRefreshPolicy::ALWAYS == stateInfo->refreshPolicy ||
             StateRefreshPolicy::SOMETIMES == stateInfo->refreshPolicy) {
             m_pendingOnStateProviders.insert(it->first);
+            m_unansweredStateProviders.insert(it->first);
             stateProviderLock.unlock();
             stateInfo->stateProvider->provideState(it->first, curStateReqToken);
             stateProviderLock.lock();
@@ -207,20 +262,70 @@ void ContextManager::requestStatesLocked(std::unique_lock<std::mutex>& stateProv
     }
 }
 
+bool ContextManager::waitForStatesLocked(std::unique_lock<std::mutex>& stateProviderLock) {
+    auto timeout = m_stateRequestTime + PROVIDE_STATE_DEFAULT_TIMEOUT;
+    while (true) {
+        auto now = std::chrono::steady_clock::now();
+        auto wakeTime = timeout;
+        for (auto it = m_pendingOnStateProviders.begin(); it != m_pendingOnStateProviders.end();) {
+            auto stateInfoIt = m_namespaceNameToStateInfo.find(*it);
+            if (m_namespaceNameToStateInfo.end() == stateInfoIt) {
+                // The provider has been removed since it was asked for its state.
+                it = m_pendingOnStateProviders.erase(it);
+                continue;
+            }
+            auto& stateInfo = stateInfoIt->second;
+            if (stateInfo->jsonState.empty() && StateRefreshPolicy::SOMETIMES != stateInfo->refreshPolicy) {
+                // There is nothing to fall back on, so wait for the provider until the timeout.
+                ++it;
+                continue;
+            }
+            auto deadlineIt = m_provideStateDeadlines.find(*it);
+            auto deadline = m_stateRequestTime +
+                            (m_provideStateDeadlines.end() == deadlineIt ? m_defaultProvideStateDeadline
+                                                                          : deadlineIt->second);
+            deadline = std::min(deadline, timeout);
+            if (deadline <= now) {
+                ACSDK_WARN(LX("provideStateDeadlineMissed")
+                               .d("namespace", it->nameSpace)
+                               .d("name", it->name)
+                               .d("action", "usingLastKnownState"));
+                it = m_pendingOnStateProviders.erase(it);
+                continue;
+            }
+            wakeTime = std::min(wakeTime, deadline);
+            ++it;
+        }
+        if (m_pendingOnStateProviders.empty()) {
+            return true;
+        }
+        if (timeout <= now) {
+            return false;
+        }
+        m_setStateCompleteNotifier.wait_until(stateProviderLock, wakeTime);
+    }
+}
+
 void ContextManager::sendContextAndClearQueue(
     const std::string& context,
     const ContextRequestError& contextRequestError) {
-    std::unique_lock<std::mutex> contextRequesterLock(m_contextRequesterMutex);
-    while (!m_contextRequesterQueue.empty()) {
-        auto currentContextRequester = m_contextRequesterQueue.front();
-        contextRequesterLock.unlock();
+    /*
+     * Take the whole queue before notifying anyone, so that a request made in response to this context waits for a
+     * fresh one instead of being answered with this one.
+     */
+    std::queue<std::shared_ptr<ContextRequesterInterface>> contextRequesters;
+    {
+        std::lock_guard<std::mutex> contextRequesterLock(m_contextRequesterMutex);
+        std::swap(contextRequesters, m_contextRequesterQueue);
+    }
+    while (!contextRequesters.empty()) {
+        auto currentContextRequester = contextRequesters.front();
         if (!context.empty()) {
             currentContextRequester->onContextAvailable(context);
         } else {
             currentContextRequester->onContextFailure(contextRequestError);
         }
-        contextRequesterLock.lock();
-        m_contextRequesterQueue.pop();
+        contextRequesters.pop();
     }
 }
 
@@ -237,15 +342,11 @@ void ContextManager::updateStatesLoop() {
         std::unique_lock<std::mutex> stateProviderLock(m_stateProviderMutex);
         requestStatesLocked(stateProviderLock);
 
-        if (!m_pendingOnStateProviders.empty()) {
-            if (!m_setStateCompleteNotifier.wait_for(stateProviderLock, PROVIDE_STATE_DEFAULT_TIMEOUT, [this]() {
-                    return m_pendingOnStateProviders.empty();
-                })) {
-                stateProviderLock.unlock();
-                ACSDK_ERROR(LX("updateStatesLoopFailed").d("reason", "stateProviderTimedOut"));
-                sendContextAndClearQueue("", ContextRequestError::STATE_PROVIDER_TIMEDOUT);
-                continue;
-            }
+        if (!waitForStatesLocked(stateProviderLock)) {
+            stateProviderLock.unlock();
+            ACSDK_ERROR(LX("updateStatesLoopFailed").d("reason", "stateProviderTimedOut"));
+            sendContextAndClearQueue("", ContextRequestError::STATE_PROVIDER_TIMEDOUT);
+            continue;
         }
         stateProviderLock.unlock();
 
@@ -253,50 +354,34 @@ void ContextManager::updateStatesLoop() {
     }
 }
 
-Value ContextManager::buildHeader(const NamespaceAndName& namespaceAndName, Document::AllocatorType& allocator) {
-    Value header(kObjectType);
-
-    header.AddMember(StringRef(NAMESPACE_JSON_KEY), namespaceAndName.nameSpace, allocator);
-    header.AddMember(StringRef(NAME_JSON_KEY), namespaceAndName.name, allocator);
-
-    return header;
-}
-
-Value ContextManager::buildState(
-    const NamespaceAndName& namespaceAndName,
-    const std::string jsonPayloadValue,
-    Document::AllocatorType& allocator) {
+std::string ContextManager::buildState(const NamespaceAndName& namespaceAndName, const std::string& jsonPayloadValue) {
     Document payload;
-    Value state(kObjectType);
-    Value header = buildHeader(namespaceAndName, allocator);
-
-    // If the header is an empty object or during parsing the payload, an error occurs, return an empty event value.
-    if (header.ObjectEmpty()) {
-        ACSDK_ERROR(LX("buildStateFailed").d("reason", "emptyHeader"));
-        return state;
-    }
-
     if (payload.Parse(jsonPayloadValue).HasParseError()) {
         ACSDK_ERROR(LX("buildStateFailed").d("reason", "parseError").d("payload", jsonPayloadValue));
-        return state;
+        return "";
     }
 
-    state.AddMember(StringRef(HEADER_JSON_KEY), header, allocator);
-    state.AddMember(StringRef(PAYLOAD_JSON_KEY), Value(payload, allocator), allocator);
-
-    return state;
+    StringBuffer buffer;
+    Writer<StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key(HEADER_JSON_KEY.c_str(), HEADER_JSON_KEY.length());
+    writer.StartObject();
+    writer.Key(NAMESPACE_JSON_KEY.c_str(), NAMESPACE_JSON_KEY.length());
+    writer.String(namespaceAndName.nameSpace.c_str(), namespaceAndName.nameSpace.length());
+    writer.Key(NAME_JSON_KEY.c_str(), NAME_JSON_KEY.length());
+    writer.String(namespaceAndName.name.c_str(), namespaceAndName.name.length());
+    writer.EndObject();
+    writer.Key(PAYLOAD_JSON_KEY.c_str(), PAYLOAD_JSON_KEY.length());
+    if (!payload.Accept(writer) || !writer.EndObject()) {
+        ACSDK_ERROR(LX("buildStateFailed").d("reason", "convertingJsonToStringFailed"));
+        return "";
+    }
+    return std::string(buffer.GetString(), buffer.GetSize());
 }
 
-void ContextManager::sendContextToRequesters() {
-    bool errorBuildingContext = false;
-    Document jsonContext;
-    StringBuffer jsonContextBuf;
-
-    jsonContext.SetObject();
-    Value statesArray(kArrayType);
-    Document::AllocatorType& allocator = jsonContext.GetAllocator();
-
-    std::unique_lock<std::mutex> stateProviderLock(m_stateProviderMutex);
+std::shared_ptr<const std::string> ContextManager::buildContextLocked() {
+    auto context = std::make_shared<std::string>("{\"" + CONTEXT_JSON_KEY + "\":[");
+    bool firstState = true;
     for (auto it = m_namespaceNameToStateInfo.begin(); it != m_namespaceNameToStateInfo.end(); ++it) {
         auto& stateInfo = it->second;
         if (stateInfo->jsonState.empty() && StateRefreshPolicy::SOMETIMES == stateInfo->refreshPolicy) {
@@ -307,30 +392,36 @@ void ContextManager::sendContextToRequesters() {
             ACSDK_DEBUG9(LX("buildContextIgnored").d("namespace", it->first.nameSpace).d("name", it->first.name));
             continue;
         }
-        Value jsonState = buildState(it->first, stateInfo->jsonState, allocator);
-        if (jsonState.ObjectEmpty()) {
-            ACSDK_ERROR(LX("buildContextFailed").d("reason", "buildStateFailed"));
-            errorBuildingContext = true;
-            break;
+        if (stateInfo->fragment.empty()) {
+            stateInfo->fragment = buildState(it->first, stateInfo->jsonState);
+            if (stateInfo->fragment.empty()) {
+                ACSDK_ERROR(LX("buildContextFailed").d("reason", "buildStateFailed"));
+                return nullptr;
+            }
+        }
+        if (!firstState) {
+            context->push_back(',');
         }
-        statesArray.PushBack(Value(jsonState, allocator).Move(), allocator);
+        context->append(stateInfo->fragment);
+        firstState = false;
     }
-    stateProviderLock.unlock();
+    context->append("]}");
+    return context;
+}
 
-    if (!errorBuildingContext) {
-        jsonContext.AddMember(StringRef(CONTEXT_JSON_KEY), statesArray, allocator);
-        Writer<StringBuffer> writer(jsonContextBuf);
-        if (!jsonContext.Accept(writer)) {
-            ACSDK_ERROR(LX("buildContextFailed").d("reason", "convertingJsonToStringFailed"));
-            errorBuildingContext = true;
-        }
+void ContextManager::sendContextToRequesters() {
+    std::unique_lock<std::mutex> stateProviderLock(m_stateProviderMutex);
+    if (!m_cachedContext) {
+        m_cachedContext = buildContextLocked();
     }
+    auto context = m_cachedContext;
+    stateProviderLock.unlock();
 
-    if (errorBuildingContext) {
+    if (!context) {
         sendContextAndClearQueue("", ContextRequestError::BUILD_CONTEXT_ERROR);
     } else {
-        ACSDK_DEBUG5(LX("buildContextSuccessful").sensitive("context", jsonContextBuf.GetString()));
-        sendContextAndClearQueue(jsonContextBuf.GetString());
+        ACSDK_DEBUG5(LX("buildContextSuccessful").sensitive("context", *context));
+        sendContextAndClearQueue(*context);
     }
 }
 
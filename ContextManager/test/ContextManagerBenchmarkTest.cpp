@@ -0,0 +1,209 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file ContextManagerBenchmarkTest.cpp
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/SDKInterfaces/ContextRequesterInterface.h>
+#include <AVSCommon/SDKInterfaces/StateProviderInterface.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Timing/LatencyHistogram.h>
+
+#include "ContextManager/ContextManager.h"
+
+namespace alexaClientSDK {
+namespace contextManager {
+namespace test {
+
+using namespace avsCommon::avs;
+using namespace avsCommon::sdkInterfaces;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("ContextManagerBenchmarkTest");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The number of state providers which are asked for their state on every request, like the media players.
+static const int ALWAYS_PROVIDER_COUNT = 5;
+
+/// The number of states which are only set when they change, like the settings and the alerts.
+static const int NEVER_PROVIDER_COUNT = 10;
+
+/// The number of items in each state's payload, which brings the context to a few kB, as on a real device.
+static const int PAYLOAD_ITEMS = 4;
+
+/// The number of context requests which are measured.
+static const int REQUEST_COUNT = 1000;
+
+/**
+ * The pause between requests, which lets the @c ContextManager finish with one request before the next is made.
+ * Otherwise a request made while the previous context is being delivered is answered with that context.
+ */
+static const std::chrono::milliseconds PAUSE_BETWEEN_REQUESTS(1);
+
+/// Long timeout for the context to arrive after @c getContext() (we should not reach this).
+static const std::chrono::seconds LONG_TIMEOUT(2);
+
+/**
+ * Builds a payload of the size and shape of a typical state.
+ *
+ * @param index A number which distinguishes this state from the others.
+ * @param offset The playback offset reported in the state.
+ * @return The JSON payload.
+ */
+static std::string buildPayload(int index, long offset) {
+    std::string payload = "{\"playerActivity\":\"PLAYING\",\"offsetInMilliseconds\":" + std::to_string(offset) +
+                          ",\"token\":\"amzn1.as-ct.v1.ThirdPartyStream#" + std::to_string(index) + "\",\"items\":[";
+    for (int i = 0; i < PAYLOAD_ITEMS; ++i) {
+        if (i > 0) {
+            payload += ",";
+        }
+        payload += "{\"token\":\"a8b4c3d2-" + std::to_string(index) + "-" + std::to_string(i) +
+                   "\",\"type\":\"ALARM\",\"scheduledTime\":\"2018-04-01T12:00:00+0000\",\"enabled\":true}";
+    }
+    return payload + "]}";
+}
+
+/// A state provider which answers @c provideState() straight away, optionally with a state which always changes.
+class ImmediateStateProvider : public StateProviderInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param contextManager The @c ContextManager to answer.
+     * @param index A number which distinguishes this provider's state from the others.
+     * @param changesEveryTime Whether the state changes between every two requests, like a playing media player.
+     */
+    ImmediateStateProvider(std::shared_ptr<ContextManager> contextManager, int index, bool changesEveryTime) :
+            m_contextManager{contextManager},
+            m_index{index},
+            m_changesEveryTime{changesEveryTime},
+            m_offset{0} {
+    }
+
+    void provideState(const NamespaceAndName& stateProviderName, const unsigned int stateRequestToken) override {
+        if (m_changesEveryTime) {
+            m_offset += 10;
+        }
+        m_contextManager->setState(
+            stateProviderName, buildPayload(m_index, m_offset), StateRefreshPolicy::ALWAYS, stateRequestToken);
+    }
+
+private:
+    /// The @c ContextManager to answer.
+    std::shared_ptr<ContextManager> m_contextManager;
+
+    /// A number which distinguishes this provider's state from the others.
+    const int m_index;
+
+    /// Whether the state changes between every two requests.
+    const bool m_changesEveryTime;
+
+    /// The playback offset reported in the state.
+    long m_offset;
+};
+
+/// A context requester which records when the context arrives.
+class TimingContextRequester : public ContextRequesterInterface {
+public:
+    void onContextAvailable(const std::string& context) override {
+        m_arrived.set_value(!context.empty());
+    }
+
+    void onContextFailure(const ContextRequestError error) override {
+        m_arrived.set_value(false);
+    }
+
+    /**
+     * Waits for the context.
+     *
+     * @return Whether a context arrived within @c LONG_TIMEOUT.
+     */
+    bool waitForContext() {
+        auto future = m_arrived.get_future();
+        return std::future_status::ready == future.wait_for(LONG_TIMEOUT) && future.get();
+    }
+
+private:
+    /// Set once the context or a failure arrives.
+    std::promise<bool> m_arrived;
+};
+
+/**
+ * Registers @c ALWAYS_PROVIDER_COUNT state providers and @c NEVER_PROVIDER_COUNT states with a @c ContextManager,
+ * requests the context @c REQUEST_COUNT times one after another, and records the time from each @c getContext() to
+ * the arrival of the context.
+ *
+ * @param changingProviders The number of state providers whose state changes between every two requests.
+ * @param[out] latencies The latencies of the requests.
+ */
+static void measureGetContextLatency(int changingProviders, avsCommon::utils::timing::LatencyHistogram* latencies) {
+    auto contextManager = ContextManager::create();
+    ASSERT_TRUE(contextManager);
+    std::vector<std::shared_ptr<ImmediateStateProvider>> providers;
+    for (int i = 0; i < ALWAYS_PROVIDER_COUNT; ++i) {
+        NamespaceAndName name("Provider" + std::to_string(i), "State");
+        providers.push_back(std::make_shared<ImmediateStateProvider>(contextManager, i, i < changingProviders));
+        contextManager->setStateProvider(name, providers.back());
+    }
+    for (int i = 0; i < NEVER_PROVIDER_COUNT; ++i) {
+        NamespaceAndName name("Setting" + std::to_string(i), "State");
+        ASSERT_EQ(
+            SetStateResult::SUCCESS,
+            contextManager->setState(name, buildPayload(ALWAYS_PROVIDER_COUNT + i, 0), StateRefreshPolicy::NEVER));
+    }
+
+    for (int i = 0; i < REQUEST_COUNT; ++i) {
+        auto requester = std::make_shared<TimingContextRequester>();
+        auto start = std::chrono::steady_clock::now();
+        contextManager->getContext(requester);
+        ASSERT_TRUE(requester->waitForContext());
+        latencies->record(std::chrono::steady_clock::now() - start);
+        std::this_thread::sleep_for(PAUSE_BETWEEN_REQUESTS);
+    }
+}
+
+/**
+ * Measure the @c getContext() latency with fifteen states, when none of them change between requests and when one
+ * of them changes every time.
+ */
+TEST(ContextManagerBenchmarkTest, getContextLatency) {
+    avsCommon::utils::timing::LatencyHistogram unchangedLatencies;
+    measureGetContextLatency(0, &unchangedLatencies);
+
+    avsCommon::utils::timing::LatencyHistogram oneChangedLatencies;
+    measureGetContextLatency(1, &oneChangedLatencies);
+
+    ACSDK_INFO(LX("getContextLatency")
+                   .d("unchangedLatencies", unchangedLatencies.toString())
+                   .d("oneChangedLatencies", oneChangedLatencies.toString()));
+}
+
+}  // namespace test
+}  // namespace contextManager
+}  // namespace alexaClientSDK
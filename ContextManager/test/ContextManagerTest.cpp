@@ -122,6 +122,9 @@ static const std::chrono::milliseconds TIMEOUT_SLEEP_TIME = std::chrono::millise
  */
 static const std::chrono::milliseconds DEFAULT_TIMEOUT = std::chrono::milliseconds(50);
 
+/// A provide state deadline which a @c MockStateProvider sleeping for @c TIMEOUT_SLEEP_TIME misses.
+static const std::chrono::milliseconds SHORT_DEADLINE = std::chrono::milliseconds(20);
+
 /// Timeout for the @c ContextRequester to get the failure.
 static const std::chrono::milliseconds FAILURE_TIMEOUT = std::chrono::milliseconds(110);
 
@@ -789,6 +792,90 @@ TEST_F(ContextManagerTest, testEmptyProvider) {
     ASSERT_TRUE(m_contextRequester->checkContextString(CONTEXT_TEST, m_contextRequester->getContextString()));
 }
 
+/**
+ * Set the states with a @c StateRefreshPolicy @c NEVER and request the context. Then change the state of one
+ * @c StateProviderInterface and request the context again. Expect that the second context has the new state rather
+ * than the one built for the first request.
+ */
+TEST_F(ContextManagerTest, testContextUpdatedAfterStateChange) {
+    ASSERT_EQ(
+        SetStateResult::SUCCESS,
+        m_contextManager->setState(
+            SPEECH_SYNTHESIZER, SPEECH_SYNTHESIZER_PAYLOAD_PLAYING, StateRefreshPolicy::NEVER));
+    ASSERT_EQ(
+        SetStateResult::SUCCESS,
+        m_contextManager->setState(AUDIO_PLAYER, AUDIO_PLAYER_PAYLOAD, StateRefreshPolicy::NEVER));
+    m_contextManager->getContext(m_contextRequester);
+    ASSERT_TRUE(m_contextRequester->waitForContext(DEFAULT_TIMEOUT));
+    ASSERT_NE(m_contextRequester->getContextString().find(SPEECH_SYNTHESIZER_PAYLOAD_PLAYING), std::string::npos);
+
+    ASSERT_EQ(
+        SetStateResult::SUCCESS,
+        m_contextManager->setState(
+            SPEECH_SYNTHESIZER, SPEECH_SYNTHESIZER_PAYLOAD_FINISHED, StateRefreshPolicy::NEVER));
+    m_contextRequester2 = MockContextRequester::create(m_contextManager);
+    m_contextManager->getContext(m_contextRequester2);
+    ASSERT_TRUE(m_contextRequester2->waitForContext(DEFAULT_TIMEOUT));
+    auto context = m_contextRequester2->getContextString();
+    ASSERT_EQ(context.find(SPEECH_SYNTHESIZER_PAYLOAD_PLAYING), std::string::npos);
+    ASSERT_NE(context.find(SPEECH_SYNTHESIZER_PAYLOAD_FINISHED), std::string::npos);
+}
+
+/**
+ * Set the states with a @c StateRefreshPolicy @c NEVER and request the context. Then remove one of the
+ * @c StateProviderInterfaces and request the context again. Expect that the second context no longer has its state.
+ */
+TEST_F(ContextManagerTest, testRemovedProviderLeavesContext) {
+    ASSERT_EQ(
+        SetStateResult::SUCCESS,
+        m_contextManager->setState(
+            SPEECH_SYNTHESIZER, SPEECH_SYNTHESIZER_PAYLOAD_FINISHED, StateRefreshPolicy::NEVER));
+    ASSERT_EQ(
+        SetStateResult::SUCCESS,
+        m_contextManager->setState(AUDIO_PLAYER, AUDIO_PLAYER_PAYLOAD, StateRefreshPolicy::NEVER));
+    m_contextManager->getContext(m_contextRequester);
+    ASSERT_TRUE(m_contextRequester->waitForContext(DEFAULT_TIMEOUT));
+    ASSERT_TRUE(m_contextRequester->checkContextString(CONTEXT_TEST, m_contextRequester->getContextString()));
+
+    m_contextManager->setStateProvider(AUDIO_PLAYER, nullptr);
+    m_contextRequester2 = MockContextRequester::create(m_contextManager);
+    m_contextManager->getContext(m_contextRequester2);
+    ASSERT_TRUE(m_contextRequester2->waitForContext(DEFAULT_TIMEOUT));
+    auto context = m_contextRequester2->getContextString();
+    ASSERT_NE(context.find(NAMESPACE_SPEECH_SYNTHESIZER), std::string::npos);
+    ASSERT_EQ(context.find(NAMESPACE_AUDIO_PLAYER), std::string::npos);
+}
+
+/**
+ * Register a @c StateProviderInterface which responds slowly to @c provideState requests, with a short deadline, and
+ * set its state. Request for context by calling @c getContext. Expect that the context is returned before the
+ * provider answers, with the state which was set before.
+ */
+TEST_F(ContextManagerTest, testSlowProviderFallsBackToLastState) {
+    m_alerts = MockStateProvider::create(
+        m_contextManager, ALERTS, ALERTS_PAYLOAD, StateRefreshPolicy::ALWAYS, TIMEOUT_SLEEP_TIME);
+    m_contextManager->setStateProvider(ALERTS, m_alerts);
+    m_contextManager->setProvideStateDeadline(ALERTS, SHORT_DEADLINE);
+    ASSERT_EQ(
+        SetStateResult::SUCCESS, m_contextManager->setState(ALERTS, ALERTS_PAYLOAD, StateRefreshPolicy::ALWAYS));
+    m_contextManager->getContext(m_contextRequester);
+    ASSERT_TRUE(m_contextRequester->waitForContext(DEFAULT_TIMEOUT));
+    ASSERT_NE(m_contextRequester->getContextString().find(NAMESPACE_ALERTS), std::string::npos);
+}
+
+/**
+ * Request for context by calling @c getContext. Expect that the time each @c StateProviderInterface took to answer
+ * @c provideState is recorded.
+ */
+TEST_F(ContextManagerTest, testProvideStateLatenciesRecorded) {
+    m_contextManager->getContext(m_contextRequester);
+    ASSERT_TRUE(m_contextRequester->waitForContext(DEFAULT_TIMEOUT));
+    auto latencies = m_contextManager->getProvideStateLatencies();
+    ASSERT_EQ(latencies[SPEECH_SYNTHESIZER].getCount(), 1u);
+    ASSERT_EQ(latencies[AUDIO_PLAYER].getCount(), 1u);
+    ASSERT_GE(latencies[SPEECH_SYNTHESIZER].getMax(), DEFAULT_SLEEP_TIME);
+}
+
 }  // namespace test
 }  // namespace contextManager
 }  // namespace alexaClientSDK
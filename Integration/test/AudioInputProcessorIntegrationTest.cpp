@@ -15,13 +15,16 @@
 
 /// @file AudioInputProcessorIntegrationTest.cpp
 
+#include <algorithm>
 #include <chrono>
 #include <deque>
 #include <fstream>
 #include <future>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -43,6 +46,7 @@
 #include <AVSCommon/SDKInterfaces/KeyWordObserverInterface.h>
 #include <AVSCommon/Utils/JSON/JSONUtils.h>
 #include <AVSCommon/Utils/Logger/LogEntry.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
 
 #include "Integration/ACLTestContext.h"
 #include "Integration/ObservableMessageRequest.h"
@@ -145,6 +149,16 @@ static const std::chrono::seconds SHORT_TIMEOUT_DURATION(2);
 static const std::chrono::seconds NO_TIMEOUT_DURATION(0);
 // The length of RIFF container format which is the header of a wav file.
 static const int RIFF_HEADER_SIZE = 44;
+// The time between a keyword candidate and the confirmed keyword, as reported by a wake word engine.
+static const std::chrono::milliseconds KEYWORD_CANDIDATE_LEAD_TIME(300);
+// The number of Recognize events measured with and without a keyword candidate.
+static const int LATENCY_ROUNDS = 3;
+// The keyword reported to the AudioInputProcessor in the latency measurement.
+static const std::string LATENCY_KEYWORD = "ALEXA";
+// The length of the keyword in the latency measurement, and of the preroll the AudioInputProcessor sends before it.
+static const std::chrono::milliseconds LATENCY_KEYWORD_DURATION(500);
+// How often the audio attachment of a Recognize event is checked for its first read by the connection.
+static const std::chrono::microseconds FIRST_READ_POLL_INTERVAL(100);
 /// The compatible sample rate for OPUS 32KHz.
 static const unsigned int COMPATIBLE_SAMPLE_RATE_OPUS_32 = 32000;
 #ifdef KWD_KITTAI
@@ -216,6 +230,35 @@ public:
     }
 };
 
+/**
+ * A keyword observer which passes keyword candidates and detections on to an @c AudioInputProcessor, as an application
+ * does with a wake word engine that reports candidates.
+ */
+class keyWordCandidateTrigger : public KeyWordObserverInterface {
+public:
+    keyWordCandidateTrigger(std::shared_ptr<AudioInputProcessor> aip, std::shared_ptr<AudioProvider> audioProvider) {
+        m_aip = aip;
+        m_audioProvider = audioProvider;
+    }
+    void onKeyWordDetected(
+        std::shared_ptr<AudioInputStream> stream,
+        std::string keyword,
+        AudioInputStream::Index beginIndex,
+        AudioInputStream::Index endIndex,
+        std::shared_ptr<const std::vector<char>> KWDMetadata = nullptr) {
+        m_aip->recognize(*m_audioProvider, Initiator::WAKEWORD, beginIndex, endIndex, keyword);
+    }
+    void onKeyWordCandidate(std::shared_ptr<AudioInputStream> stream, std::string keyword) {
+        m_aip->prepareRecognize(keyword);
+    }
+    void onKeyWordRejected(std::shared_ptr<AudioInputStream> stream, std::string keyword) {
+        m_aip->cancelPreparedRecognize();
+    }
+
+    std::shared_ptr<AudioInputProcessor> m_aip;
+    std::shared_ptr<AudioProvider> m_audioProvider;
+};
+
 class holdToTalkButton {
 public:
     bool startRecognizing(std::shared_ptr<AudioInputProcessor> aip, std::shared_ptr<AudioProvider> audioProvider) {
@@ -1064,6 +1107,81 @@ TEST_F(AudioInputProcessorTest, tapToTalkSilence) {
     ASSERT_EQ(params.type, TestDirectiveHandler::DirectiveParams::Type::TIMEOUT);
 }
 
+/**
+ * Measure the time from a wake word until the connection reads the first byte of audio from the Recognize event, with
+ * and without a keyword candidate reported shortly before, as a wake word engine which reports candidates would.
+ *
+ * To do this, silence ending in the keyword is fed into a stream before each keyword is reported, and the
+ * audio attachment of the Recognize event is polled until the connection has read from it.  The AudioInputProcessor
+ * is then observed to return to IDLE before the next one.
+ */
+TEST_F(AudioInputProcessorTest, wakeWordToFirstAudioByteWithKeywordCandidate) {
+    bool error;
+    std::string file = g_inputPath + SILENCE_AUDIO_FILE;
+    std::vector<int16_t> audioData = readAudioFromFile<int16_t>(file, RIFF_HEADER_SIZE, &error);
+    ASSERT_FALSE(error);
+    AudioInputStream::Index keywordWords =
+        m_compatibleAudioFormat.sampleRateHz * LATENCY_KEYWORD_DURATION.count() / 1000;
+    // The AudioInputProcessor only sends the keyword indices when there is a full preroll before the keyword.
+    ASSERT_GE(audioData.size(), 2 * keywordWords);
+
+    auto trigger = std::make_shared<keyWordCandidateTrigger>(m_AudioInputProcessor, m_TapToTalkAudioProvider);
+    auto measureWakeWord = [&](bool reportCandidate, std::vector<std::chrono::microseconds>* latencies) {
+        m_AudioBufferWriter->write(audioData.data(), audioData.size());
+        AudioInputStream::Index endIndex = m_AudioBufferWriter->tell();
+        AudioInputStream::Index beginIndex = endIndex - keywordWords;
+        // The attachment starts a preroll before the keyword and holds everything up to the writer.
+        uint64_t unreadBytes = 2 * keywordWords * m_AudioBuffer->getWordSize();
+        if (reportCandidate) {
+            trigger->onKeyWordCandidate(m_AudioBuffer, LATENCY_KEYWORD);
+            std::this_thread::sleep_for(KEYWORD_CANDIDATE_LEAD_TIME);
+        }
+        auto start = std::chrono::steady_clock::now();
+        trigger->onKeyWordDetected(m_AudioBuffer, LATENCY_KEYWORD, beginIndex, endIndex);
+
+        // The first read may happen before the request is handed back here, so this is an upper bound.
+        TestMessageSender::SendParams sendParams = m_avsConnectionManager->waitForNext(SHORT_TIMEOUT_DURATION);
+        ASSERT_EQ(sendParams.type, TestMessageSender::SendParams::Type::SEND);
+        ASSERT_GT(sendParams.request->attachmentReadersCount(), 0);
+        auto audio = sendParams.request->getAttachmentReader(sendParams.request->attachmentReadersCount() - 1);
+        ASSERT_NE(nullptr, audio);
+        while (audio->reader->getNumUnreadBytes() >= unreadBytes) {
+            ASSERT_LT(std::chrono::steady_clock::now() - start, LONG_TIMEOUT_DURATION);
+            std::this_thread::sleep_for(FIRST_READ_POLL_INTERVAL);
+        }
+        latencies->push_back(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+
+        // Let AVS close the interaction on the silence which follows the keyword.
+        m_AudioBufferWriter->write(audioData.data(), audioData.size());
+        auto state = AudioInputProcessorObserverInterface::State::IDLE;
+        do {
+            state = m_StateObserver->waitForNext(LONG_TIMEOUT_DURATION);
+        } while (state != AudioInputProcessorObserverInterface::State::IDLE);
+        m_AudioInputProcessor->resetState().wait();
+        while (m_avsConnectionManager->waitForNext(NO_TIMEOUT_DURATION).type ==
+               TestMessageSender::SendParams::Type::SEND) {
+        }
+    };
+
+    std::vector<std::chrono::microseconds> latencies;
+    std::vector<std::chrono::microseconds> candidateLatencies;
+    for (int i = 0; i < LATENCY_ROUNDS; ++i) {
+        measureWakeWord(false, &latencies);
+        ASSERT_FALSE(HasFatalFailure());
+        measureWakeWord(true, &candidateLatencies);
+        ASSERT_FALSE(HasFatalFailure());
+    }
+    std::sort(latencies.begin(), latencies.end());
+    std::sort(candidateLatencies.begin(), candidateLatencies.end());
+    auto latency = latencies[LATENCY_ROUNDS / 2];
+    auto candidateLatency = candidateLatencies[LATENCY_ROUNDS / 2];
+    ACSDK_INFO(LX("wakeWordToFirstAudioByte")
+                   .d("medianLatencyUs", latency.count())
+                   .d("withKeywordCandidateMedianLatencyUs", candidateLatency.count()));
+    EXPECT_LE(candidateLatency, latency);
+}
+
 /**
  * Test AudioInputProcessor's ability to handle no audio being written triggered by a tap to talk button.
  *
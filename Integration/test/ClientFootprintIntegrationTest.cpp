@@ -0,0 +1,287 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file ClientFootprintIntegrationTest.cpp
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <Alerts/Storage/SQLiteAlertStorage.h>
+#include <Audio/AudioFactory.h>
+#include <AVSCommon/AVS/SpeakerConstants/SpeakerConstants.h>
+#include <AVSCommon/SDKInterfaces/SpeakerInterface.h>
+#include <AVSCommon/Utils/DeviceInfo.h>
+#include <AVSCommon/Utils/LibcurlUtils/HTTPContentFetcherFactory.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Network/InternetConnectionMonitor.h>
+#include <AVSCommon/Utils/Threading/ThreadPool.h>
+#include <CertifiedSender/SQLiteMessageStorage.h>
+#include <DCFDelegate/DCFDelegate.h>
+#include <DefaultClient/DefaultClient.h>
+#include <Notifications/SQLiteNotificationsStorage.h>
+#include <RegistrationManager/CustomerDataManager.h>
+#include <Settings/SQLiteSettingStorage.h>
+
+#include "Integration/SDKTestContext.h"
+#include "Integration/TestAuthDelegate.h"
+#include "Integration/TestHttpPut.h"
+#include "Integration/TestMediaPlayer.h"
+#include "Integration/TestMiscStorage.h"
+
+namespace alexaClientSDK {
+namespace integration {
+namespace test {
+
+using namespace avsCommon::sdkInterfaces;
+using namespace avsCommon::utils;
+using namespace avsCommon::utils::configuration;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("ClientFootprintIntegrationTest");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// Path to the AlexaClientSDKConfig.json file (from command line arguments).
+static std::string g_configPath;
+
+/// Path to resources (e.g. audio files) for tests (from command line arguments).
+static std::string g_inputPath;
+
+/// Time to wait for idle pool workers to exit, after the client has finished starting up.
+static const auto IDLE_SETTLE_TIME = threading::ThreadPool::DEFAULT_IDLE_TIMEOUT + std::chrono::seconds(1);
+
+/// The number of threads and resident memory of this process at one point in time.
+struct Footprint {
+    /// The number of threads.
+    long threads;
+
+    /// The resident set size, in kB.
+    long rssKb;
+};
+
+/**
+ * Reads the number of threads and the resident set size of this process from /proc.
+ *
+ * @return The current @c Footprint, with zeros for any value which could not be read.
+ */
+static Footprint readFootprint() {
+    Footprint footprint{0, 0};
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        std::istringstream fields(line);
+        std::string key;
+        fields >> key;
+        if ("Threads:" == key) {
+            fields >> footprint.threads;
+        } else if ("VmRSS:" == key) {
+            fields >> footprint.rssKb;
+        }
+    }
+    return footprint;
+}
+
+/// A speaker which does nothing, so that the client can be built without audio hardware.
+class NullSpeaker : public SpeakerInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param type The type of the speaker.
+     */
+    NullSpeaker(Type type) : m_type{type} {
+    }
+
+    /// @name SpeakerInterface Functions
+    /// @{
+    bool setVolume(int8_t volume) override {
+        return true;
+    }
+    bool adjustVolume(int8_t delta) override {
+        return true;
+    }
+    bool setMute(bool mute) override {
+        return true;
+    }
+    bool getSpeakerSettings(SpeakerSettings* settings) override {
+        if (!settings) {
+            return false;
+        }
+        settings->volume = avsCommon::avs::speakerConstants::AVS_SET_VOLUME_MAX;
+        settings->mute = false;
+        return true;
+    }
+    Type getSpeakerType() override {
+        return m_type;
+    }
+    /// @}
+
+private:
+    /// The type of the speaker.
+    const Type m_type;
+};
+
+/// Test harness which owns a temporary directory for the client's databases.
+class ClientFootprintIntegrationTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        char directoryTemplate[] = "/tmp/ClientFootprintIntegrationTest.XXXXXX";
+        ASSERT_NE(mkdtemp(directoryTemplate), nullptr);
+        m_directory = directoryTemplate;
+
+        // Point every database at the temporary directory, and provide the settings the client requires.
+        std::ostringstream overlay;
+        overlay << R"({)"
+                << R"("cblAuthDelegate":{"databaseFilePath":")" << m_directory << R"(/cblAuthDelegate.db"},)"
+                << R"("miscDatabase":{"databaseFilePath":")" << m_directory << R"(/miscDatabase.db"},)"
+                << R"("alertsCapabilityAgent":{"databaseFilePath":")" << m_directory << R"(/alerts.db"},)"
+                << R"("settings":{"databaseFilePath":")" << m_directory << R"(/settings.db",)"
+                << R"("defaultAVSClientSettings":{"locale":"en-US"}},)"
+                << R"("certifiedSender":{"databaseFilePath":")" << m_directory << R"(/certifiedSender.db"},)"
+                << R"("notifications":{"databaseFilePath":")" << m_directory << R"(/notifications.db"})"
+                << R"(})";
+        m_context = SDKTestContext::create(g_configPath, overlay.str());
+        ASSERT_TRUE(m_context);
+    }
+
+    void TearDown() override {
+        m_context.reset();
+        std::string command = "rm -rf " + m_directory;
+        if (system(command.c_str()) != 0) {
+            ACSDK_WARN(LX("tearDownFailed").d("reason", "removeDirectoryFailed").d("directory", m_directory));
+        }
+    }
+
+    /// The temporary directory holding the client's databases.
+    std::string m_directory;
+
+    /// The initialized SDK.
+    std::unique_ptr<SDKTestContext> m_context;
+};
+
+/**
+ * Build a complete @c DefaultClient, and report the number of threads and the resident memory of the process before
+ * it is built, just after, and once it has settled.
+ */
+TEST_F(ClientFootprintIntegrationTest, reportFootprintOfDefaultClient) {
+    auto config = ConfigurationNode::getRoot();
+    std::shared_ptr<DeviceInfo> deviceInfo = DeviceInfo::create(config);
+    if (!deviceInfo) {
+        // The test does not talk to AVS, so fill in placeholder device information if the configuration has none.
+        deviceInfo = DeviceInfo::create("clientId", "productId", "deviceSerialNumber");
+    }
+    ASSERT_TRUE(deviceInfo);
+
+    auto before = readFootprint();
+
+    auto customerDataManager = std::make_shared<registrationManager::CustomerDataManager>();
+    auto speakMediaPlayer = std::make_shared<TestMediaPlayer>();
+    auto audioMediaPlayer = std::make_shared<TestMediaPlayer>();
+    auto alertsMediaPlayer = std::make_shared<TestMediaPlayer>();
+    auto notificationsMediaPlayer = std::make_shared<TestMediaPlayer>();
+    auto ringtoneMediaPlayer = std::make_shared<TestMediaPlayer>();
+    auto syncedSpeaker = std::make_shared<NullSpeaker>(SpeakerInterface::Type::AVS_SYNCED);
+    auto localSpeaker = std::make_shared<NullSpeaker>(SpeakerInterface::Type::LOCAL);
+    auto audioFactory = std::make_shared<applicationUtilities::resources::audio::AudioFactory>();
+    auto authDelegate = std::make_shared<TestAuthDelegate>();
+
+    auto alertStorage = capabilityAgents::alerts::storage::SQLiteAlertStorage::create(config, audioFactory->alerts());
+    auto messageStorage = certifiedSender::SQLiteMessageStorage::create(config);
+    auto notificationsStorage = capabilityAgents::notifications::SQLiteNotificationsStorage::create(config);
+    auto settingsStorage = capabilityAgents::settings::SQLiteSettingStorage::create(config);
+    ASSERT_TRUE(alertStorage);
+    ASSERT_TRUE(messageStorage);
+    ASSERT_TRUE(notificationsStorage);
+    ASSERT_TRUE(settingsStorage);
+
+    auto internetConnectionMonitor = network::InternetConnectionMonitor::create(
+        std::make_shared<libcurlUtils::HTTPContentFetcherFactory>());
+    ASSERT_TRUE(internetConnectionMonitor);
+
+    std::shared_ptr<DCFDelegateInterface> dcfDelegate = dcfDelegate::DCFDelegate::create(
+        authDelegate, std::make_shared<TestMiscStorage>(), std::make_shared<TestHttpPut>(), config, deviceInfo);
+    ASSERT_TRUE(dcfDelegate);
+
+    auto client = defaultClient::DefaultClient::create(
+        customerDataManager,
+        {},
+        {},
+        speakMediaPlayer,
+        audioMediaPlayer,
+        alertsMediaPlayer,
+        notificationsMediaPlayer,
+        ringtoneMediaPlayer,
+        syncedSpeaker,
+        syncedSpeaker,
+        syncedSpeaker,
+        syncedSpeaker,
+        localSpeaker,
+        {},
+        audioFactory,
+        authDelegate,
+        std::move(alertStorage),
+        std::move(messageStorage),
+        std::move(notificationsStorage),
+        std::move(settingsStorage),
+        {},
+        {},
+        std::move(internetConnectionMonitor),
+        false,
+        dcfDelegate);
+    ASSERT_TRUE(client);
+
+    auto created = readFootprint();
+    std::this_thread::sleep_for(IDLE_SETTLE_TIME);
+    auto settled = readFootprint();
+
+    ACSDK_INFO(LX("defaultClientFootprint")
+                   .d("threadsBefore", before.threads)
+                   .d("threadsCreated", created.threads)
+                   .d("threadsSettled", settled.threads)
+                   .d("rssKbBefore", before.rssKb)
+                   .d("rssKbCreated", created.rssKb)
+                   .d("rssKbSettled", settled.rssKb));
+
+    client.reset();
+}
+
+}  // namespace test
+}  // namespace integration
+}  // namespace alexaClientSDK
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    if (argc < 3) {
+        std::cerr << "USAGE: " << std::string(argv[0]) << " <path_to_AlexaClientSDKConfig.json> <path_to_inputs_folder>"
+                  << std::endl;
+        return 1;
+
+    } else {
+        alexaClientSDK::integration::test::g_configPath = std::string(argv[1]);
+        alexaClientSDK::integration::test::g_inputPath = std::string(argv[2]);
+        return RUN_ALL_TESTS();
+    }
+}
@@ -0,0 +1,296 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file DecodedAudioCacheIntegrationTest.cpp
+
+#include <sys/resource.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <Alerts/Renderer/Renderer.h>
+#include <Alerts/Renderer/RendererObserverInterface.h>
+#include <Audio/AudioFactory.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/MediaPlayer/MediaPlayerObserverInterface.h>
+
+#ifdef GSTREAMER_MEDIA_PLAYER
+#include <MediaPlayer/DecodedAudioCache.h>
+#include <MediaPlayer/MediaPlayer.h>
+#endif
+
+#include "Integration/SDKTestContext.h"
+
+namespace alexaClientSDK {
+namespace integration {
+namespace test {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("DecodedAudioCacheIntegrationTest");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// Path to the AlexaClientSDKConfig.json file (from command line arguments).
+static std::string g_configPath;
+
+/// Path to resources (e.g. audio files) for tests (from command line arguments).
+static std::string g_inputPath;
+
+#ifdef GSTREAMER_MEDIA_PLAYER
+
+using namespace applicationUtilities::resources::audio;
+using namespace capabilityAgents::alerts::renderer;
+using namespace mediaPlayer;
+
+/// How long the alarm rings for each measurement.
+static const std::chrono::minutes ALARM_DURATION(10);
+
+/// The longest time to wait for a state change of the renderer, or for playback to start.
+static const std::chrono::seconds WAIT_TIMEOUT(10);
+
+/// The number of times the notification chime is played for each measurement of its time to first sample.
+static const int CHIME_PLAY_COUNT = 5;
+
+/**
+ * Returns the CPU time, user and system, used by all threads of this process so far.
+ *
+ * @return The CPU time.
+ */
+static std::chrono::microseconds getCpuTime() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return std::chrono::seconds(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+           std::chrono::microseconds(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+}
+
+/// An observer of a @c Renderer, which can wait for the renderer to reach a state.
+class RendererStateObserver : public RendererObserverInterface {
+public:
+    void onRendererStateChange(State state, const std::string& reason) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_state = state;
+        m_wakeTrigger.notify_all();
+    }
+
+    /**
+     * Wait for the renderer to reach a state.
+     *
+     * @param state The state.
+     * @return Whether the renderer reached the state before the timeout.
+     */
+    bool waitFor(State state) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_wakeTrigger.wait_for(lock, WAIT_TIMEOUT, [this, state]() { return m_state == state; });
+    }
+
+private:
+    /// Serializes access to @c m_state.
+    std::mutex m_mutex;
+
+    /// Notified when @c m_state changes.
+    std::condition_variable m_wakeTrigger;
+
+    /// The last state of the renderer.
+    State m_state = State::UNSET;
+};
+
+/// An observer of a @c MediaPlayer, which can wait for playback to start.
+class PlaybackStartedObserver : public avsCommon::utils::mediaPlayer::MediaPlayerObserverInterface {
+public:
+    void onPlaybackStarted(SourceId id) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_startedId = id;
+        m_wakeTrigger.notify_all();
+    }
+
+    void onPlaybackFinished(SourceId id) override {
+    }
+
+    void onPlaybackError(SourceId id, const avsCommon::utils::mediaPlayer::ErrorType& type, std::string error)
+        override {
+    }
+
+    /**
+     * Wait for playback of a source to start.
+     *
+     * @param id The source.
+     * @return Whether playback started before the timeout.
+     */
+    bool waitForPlaybackStarted(SourceId id) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_wakeTrigger.wait_for(lock, WAIT_TIMEOUT, [this, id]() { return m_startedId == id; });
+    }
+
+private:
+    /// Serializes access to @c m_startedId.
+    std::mutex m_mutex;
+
+    /// Notified when playback starts.
+    std::condition_variable m_wakeTrigger;
+
+    /// The last source to start.
+    SourceId m_startedId = avsCommon::utils::mediaPlayer::MediaPlayerInterface::ERROR;
+};
+
+class DecodedAudioCacheIntegrationTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_context = SDKTestContext::create(g_configPath);
+        ASSERT_TRUE(m_context);
+        m_audioFactory = std::make_shared<AudioFactory>();
+    }
+
+    void TearDown() override {
+        m_context.reset();
+    }
+
+    /**
+     * Ring the default alarm for @c ALARM_DURATION through a @c Renderer, as an alert would.
+     *
+     * @param cache The cache to play the alarm from, or @c nullptr to decode it on every loop.
+     * @return The CPU time used while the alarm rang.
+     */
+    std::chrono::microseconds ringAlarm(std::shared_ptr<DecodedAudioCache> cache) {
+        auto mediaPlayer = MediaPlayer::create(
+            nullptr, avsCommon::sdkInterfaces::SpeakerInterface::Type::LOCAL, "AlarmMediaPlayer", cache);
+        EXPECT_TRUE(mediaPlayer);
+        if (!mediaPlayer) {
+            return std::chrono::microseconds::zero();
+        }
+        auto renderer = Renderer::create(mediaPlayer);
+        auto observer = std::make_shared<RendererStateObserver>();
+        renderer->setObserver(observer);
+
+        auto start = getCpuTime();
+        renderer->start(m_audioFactory->alerts()->alarmDefault());
+        EXPECT_TRUE(observer->waitFor(RendererObserverInterface::State::STARTED));
+        std::this_thread::sleep_for(ALARM_DURATION);
+        renderer->stop();
+        EXPECT_TRUE(observer->waitFor(RendererObserverInterface::State::STOPPED));
+        auto cpuTime = getCpuTime() - start;
+
+        mediaPlayer->shutdown();
+        return cpuTime;
+    }
+
+    /**
+     * Play the notification chime a few times, and measure how long it takes to start.
+     *
+     * @param cache The cache to play the chime from, or @c nullptr to decode it each time.
+     * @return The average time from the request to play the chime to the start of playback.
+     */
+    std::chrono::microseconds timeChimeStart(std::shared_ptr<DecodedAudioCache> cache) {
+        auto mediaPlayer = MediaPlayer::create(
+            nullptr, avsCommon::sdkInterfaces::SpeakerInterface::Type::AVS_SYNCED, "ChimeMediaPlayer", cache);
+        EXPECT_TRUE(mediaPlayer);
+        if (!mediaPlayer) {
+            return std::chrono::microseconds::zero();
+        }
+        auto observer = std::make_shared<PlaybackStartedObserver>();
+        mediaPlayer->setObserver(observer);
+
+        std::chrono::microseconds total = std::chrono::microseconds::zero();
+        for (int i = 0; i < CHIME_PLAY_COUNT; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            auto id = mediaPlayer->setSource(m_audioFactory->notifications()->notificationDefault()(), false);
+            EXPECT_TRUE(mediaPlayer->play(id));
+            EXPECT_TRUE(observer->waitForPlaybackStarted(id));
+            total += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+            mediaPlayer->stop(id);
+        }
+
+        mediaPlayer->shutdown();
+        return total / CHIME_PLAY_COUNT;
+    }
+
+    /// The SDK, initialized with the configuration of the test.
+    std::unique_ptr<SDKTestContext> m_context;
+
+    /// The source of the earcons.
+    std::shared_ptr<AudioFactory> m_audioFactory;
+};
+
+/**
+ * Compare the CPU time used while the default alarm rings for ten minutes, when it is decoded on every loop and when
+ * it is played from a @c DecodedAudioCache.
+ */
+TEST_F(DecodedAudioCacheIntegrationTest, alarmCpuUsage) {
+    auto uncachedCpuTime = ringAlarm(nullptr);
+
+    auto cache = DecodedAudioCache::create();
+    ASSERT_TRUE(cache);
+    auto decodeStart = getCpuTime();
+    ASSERT_TRUE(cache->prefetch(m_audioFactory->alerts()->alarmDefault()).get());
+    auto decodeCpuTime = getCpuTime() - decodeStart;
+    auto cachedCpuTime = ringAlarm(cache);
+
+    ACSDK_INFO(LX("alarmCpuUsage")
+                   .d("alarmSeconds", std::chrono::seconds(ALARM_DURATION).count())
+                   .d("uncachedCpuMs", uncachedCpuTime.count() / 1000)
+                   .d("decodeCpuMs", decodeCpuTime.count() / 1000)
+                   .d("cachedCpuMs", cachedCpuTime.count() / 1000)
+                   .d("cachedBytes", cache->getCachedBytes()));
+
+    ASSERT_LT(cachedCpuTime + decodeCpuTime, uncachedCpuTime);
+}
+
+/**
+ * Compare the time for the notification chime to start playing, when it is decoded each time and when it is played
+ * from a @c DecodedAudioCache which decoded it at startup.
+ */
+TEST_F(DecodedAudioCacheIntegrationTest, notificationTimeToFirstSample) {
+    auto uncachedStart = timeChimeStart(nullptr);
+
+    auto cache = DecodedAudioCache::create();
+    ASSERT_TRUE(cache);
+    ASSERT_TRUE(cache->prefetch(m_audioFactory->notifications()->notificationDefault()).get());
+    auto cachedStart = timeChimeStart(cache);
+
+    ACSDK_INFO(LX("notificationTimeToFirstSample")
+                   .d("uncachedUs", uncachedStart.count())
+                   .d("cachedUs", cachedStart.count()));
+}
+
+#endif  // GSTREAMER_MEDIA_PLAYER
+
+}  // namespace test
+}  // namespace integration
+}  // namespace alexaClientSDK
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    if (argc < 3) {
+        std::cerr << "USAGE: " << std::string(argv[0]) << " <path_to_AlexaClientSDKConfig.json> <path_to_inputs_folder>"
+                  << std::endl;
+        return 1;
+
+    } else {
+        alexaClientSDK::integration::test::g_configPath = std::string(argv[1]);
+        alexaClientSDK::integration::test::g_inputPath = std::string(argv[2]);
+        return RUN_ALL_TESTS();
+    }
+}
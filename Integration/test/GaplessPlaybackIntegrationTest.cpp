@@ -0,0 +1,303 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file GaplessPlaybackIntegrationTest.cpp
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/AVS/Attachment/InProcessAttachment.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/MediaPlayer/MediaPlayerObserverInterface.h>
+
+#ifdef GSTREAMER_MEDIA_PLAYER
+#include <MediaPlayer/MediaPlayer.h>
+#endif
+
+#include "Integration/SDKTestContext.h"
+
+namespace alexaClientSDK {
+namespace integration {
+namespace test {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("GaplessPlaybackIntegrationTest");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// Path to the AlexaClientSDKConfig.json file (from command line arguments).
+static std::string g_configPath;
+
+/// Path to resources (e.g. audio files) for tests (from command line arguments).
+static std::string g_inputPath;
+
+#ifdef GSTREAMER_MEDIA_PLAYER
+
+using namespace avsCommon::avs::attachment;
+using namespace avsCommon::utils::mediaPlayer;
+using namespace mediaPlayer;
+
+/// The local file played as each track.
+static const std::string TRACK_FILE_PATH("/recognize_test.wav");
+
+/// The longest time to wait for a notification from the @c MediaPlayer.
+static const std::chrono::seconds WAIT_TIMEOUT(10);
+
+/// The offset of the byte rate in the header of a WAV file.
+static const size_t WAV_BYTE_RATE_OFFSET = 28;
+
+/// The offset of the first chunk after the RIFF header of a WAV file.
+static const size_t WAV_FIRST_CHUNK_OFFSET = 12;
+
+/// The size of the id and of the size of a chunk of a WAV file.
+static const size_t WAV_CHUNK_HEADER_SIZE = 8;
+
+/**
+ * Reads a little endian 32 bit value.
+ *
+ * @param data The bytes of the value.
+ * @return The value.
+ */
+static uint32_t readUint32(const char* data) {
+    auto bytes = reinterpret_cast<const unsigned char*>(data);
+    return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+}
+
+/**
+ * Works out the duration of the audio in a WAV file from its header.
+ *
+ * @param wav The contents of the file.
+ * @return The duration, or zero if the header could not be read.
+ */
+static std::chrono::milliseconds getWavDuration(const std::vector<char>& wav) {
+    if (wav.size() < WAV_BYTE_RATE_OFFSET + sizeof(uint32_t)) {
+        return std::chrono::milliseconds::zero();
+    }
+    uint32_t byteRate = readUint32(&wav[WAV_BYTE_RATE_OFFSET]);
+    size_t offset = WAV_FIRST_CHUNK_OFFSET;
+    while (byteRate && offset + WAV_CHUNK_HEADER_SIZE <= wav.size()) {
+        uint32_t chunkSize = readUint32(&wav[offset + sizeof(uint32_t)]);
+        if (!std::strncmp(&wav[offset], "data", sizeof(uint32_t))) {
+            return std::chrono::milliseconds(uint64_t(chunkSize) * 1000 / byteRate);
+        }
+        offset += WAV_CHUNK_HEADER_SIZE + chunkSize;
+    }
+    return std::chrono::milliseconds::zero();
+}
+
+/// An observer of a @c MediaPlayer, which records when each source started and finished playing.
+class PlaybackTimeObserver : public MediaPlayerObserverInterface {
+public:
+    void onPlaybackStarted(SourceId id) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_started[id] = std::chrono::steady_clock::now();
+        m_wakeTrigger.notify_all();
+    }
+
+    void onPlaybackFinished(SourceId id) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_finished[id] = std::chrono::steady_clock::now();
+        m_wakeTrigger.notify_all();
+    }
+
+    void onPlaybackNearlyFinished(SourceId id) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_nearlyFinished[id] = std::chrono::steady_clock::now();
+        m_wakeTrigger.notify_all();
+    }
+
+    void onPlaybackError(SourceId id, const ErrorType& type, std::string error) override {
+        ACSDK_ERROR(LX("onPlaybackError").d("id", id).d("type", type).d("error", error));
+    }
+
+    /**
+     * Wait for the @c MediaPlayer to read all of the data of a source.
+     *
+     * @param id The source.
+     * @return Whether the notification came before the timeout.
+     */
+    bool waitForPlaybackNearlyFinished(SourceId id) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_wakeTrigger.wait_for(lock, WAIT_TIMEOUT, [this, id]() { return m_nearlyFinished.count(id) != 0; });
+    }
+
+    /**
+     * Wait for playback of a source to finish.
+     *
+     * @param id The source.
+     * @return Whether playback finished before the timeout.
+     */
+    bool waitForPlaybackFinished(SourceId id) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_wakeTrigger.wait_for(lock, WAIT_TIMEOUT, [this, id]() { return m_finished.count(id) != 0; });
+    }
+
+    /**
+     * The time from the start of playback of one source to the end of playback of another.
+     *
+     * @param startedId The source which started.
+     * @param finishedId The source which finished.
+     * @return The time between the two notifications.
+     */
+    std::chrono::milliseconds getElapsed(SourceId startedId, SourceId finishedId) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return std::chrono::duration_cast<std::chrono::milliseconds>(m_finished[finishedId] - m_started[startedId]);
+    }
+
+private:
+    /// Serializes access to the times.
+    std::mutex m_mutex;
+
+    /// Notified when a notification is received.
+    std::condition_variable m_wakeTrigger;
+
+    /// When each source started playing.
+    std::unordered_map<SourceId, std::chrono::steady_clock::time_point> m_started;
+
+    /// When each source finished playing.
+    std::unordered_map<SourceId, std::chrono::steady_clock::time_point> m_finished;
+
+    /// When all of the data of each source had been read.
+    std::unordered_map<SourceId, std::chrono::steady_clock::time_point> m_nearlyFinished;
+};
+
+class GaplessPlaybackIntegrationTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_context = SDKTestContext::create(g_configPath);
+        ASSERT_TRUE(m_context);
+        std::ifstream file(g_inputPath + TRACK_FILE_PATH, std::ifstream::binary);
+        ASSERT_TRUE(file.good());
+        m_track.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        m_trackDuration = getWavDuration(m_track);
+        ASSERT_GT(m_trackDuration, std::chrono::milliseconds::zero());
+
+        m_mediaPlayer = MediaPlayer::create(
+            nullptr, avsCommon::sdkInterfaces::SpeakerInterface::Type::AVS_SYNCED, "GaplessMediaPlayer");
+        ASSERT_TRUE(m_mediaPlayer);
+        m_observer = std::make_shared<PlaybackTimeObserver>();
+        m_mediaPlayer->setObserver(m_observer);
+    }
+
+    void TearDown() override {
+        if (m_mediaPlayer) {
+            m_mediaPlayer->shutdown();
+        }
+        m_context.reset();
+    }
+
+    /**
+     * Creates a reader of an attachment holding the whole track.
+     *
+     * @return The reader, or @c nullptr on failure.
+     */
+    std::shared_ptr<AttachmentReader> createTrackReader() {
+        auto attachment = std::make_shared<InProcessAttachment>("gaplessTrack" + std::to_string(++m_trackCount));
+        auto writer = attachment->createWriter();
+        AttachmentWriter::WriteStatus status;
+        if (!writer || writer->write(m_track.data(), m_track.size(), &status) != m_track.size()) {
+            return nullptr;
+        }
+        writer->close();
+        return attachment->createReader(avsCommon::utils::sds::ReaderPolicy::NONBLOCKING);
+    }
+
+    /// The SDK, initialized with the configuration of the test.
+    std::unique_ptr<SDKTestContext> m_context;
+
+    /// The player of the tracks.
+    std::shared_ptr<MediaPlayer> m_mediaPlayer;
+
+    /// Records the notifications of @c m_mediaPlayer.
+    std::shared_ptr<PlaybackTimeObserver> m_observer;
+
+    /// The contents of the track file.
+    std::vector<char> m_track;
+
+    /// The duration of the track.
+    std::chrono::milliseconds m_trackDuration;
+
+    /// The number of attachments created, used to give each one an id.
+    int m_trackCount = 0;
+};
+
+/**
+ * Play the same track twice in a row, first by setting and playing the second track once the first has finished, and
+ * then by preparing the second track while the first plays.  The gap between the tracks is the time from the start of
+ * the first to the end of the second, less the duration of the two tracks.
+ */
+TEST_F(GaplessPlaybackIntegrationTest, interTrackGap) {
+    auto first = m_mediaPlayer->setSource(createTrackReader());
+    ASSERT_NE(MediaPlayerInterface::ERROR, first);
+    ASSERT_TRUE(m_mediaPlayer->play(first));
+    ASSERT_TRUE(m_observer->waitForPlaybackFinished(first));
+    auto second = m_mediaPlayer->setSource(createTrackReader());
+    ASSERT_NE(MediaPlayerInterface::ERROR, second);
+    ASSERT_TRUE(m_mediaPlayer->play(second));
+    ASSERT_TRUE(m_observer->waitForPlaybackFinished(second));
+    auto sequentialGap = m_observer->getElapsed(first, second) - 2 * m_trackDuration;
+
+    first = m_mediaPlayer->setSource(createTrackReader());
+    ASSERT_NE(MediaPlayerInterface::ERROR, first);
+    ASSERT_TRUE(m_mediaPlayer->play(first));
+    ASSERT_TRUE(m_observer->waitForPlaybackNearlyFinished(first));
+    second = m_mediaPlayer->prepareNextSource(createTrackReader());
+    ASSERT_NE(MediaPlayerInterface::ERROR, second);
+    ASSERT_TRUE(m_observer->waitForPlaybackFinished(second));
+    auto preparedGap = m_observer->getElapsed(first, second) - 2 * m_trackDuration;
+
+    ACSDK_INFO(LX("interTrackGap")
+                   .d("trackMs", m_trackDuration.count())
+                   .d("sequentialGapMs", sequentialGap.count())
+                   .d("preparedGapMs", preparedGap.count()));
+
+    ASSERT_LT(preparedGap, sequentialGap);
+}
+
+#endif  // GSTREAMER_MEDIA_PLAYER
+
+}  // namespace test
+}  // namespace integration
+}  // namespace alexaClientSDK
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    if (argc < 3) {
+        std::cerr << "USAGE: " << std::string(argv[0]) << " <path_to_AlexaClientSDKConfig.json> <path_to_inputs_folder>"
+                  << std::endl;
+        return 1;
+
+    } else {
+        alexaClientSDK::integration::test::g_configPath = std::string(argv[1]);
+        alexaClientSDK::integration::test::g_inputPath = std::string(argv[2]);
+        return RUN_ALL_TESTS();
+    }
+}
@@ -16,6 +16,7 @@
 #include "KWDProvider/KeywordDetectorProvider.h"
 
 #ifdef KWD_KITTAI
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <KittAi/KittAiKeyWordDetector.h>
 #elif KWD_SENSORY
 #include <Sensory/SensoryKeywordDetector.h>
@@ -30,6 +31,21 @@ static const float KITT_AI_AUDIO_GAIN = 2.0;
 
 /// Whether Kitt.ai should apply front end audio processing.
 static const bool KITT_AI_APPLY_FRONT_END_PROCESSING = true;
+
+/// The amount of audio pushed to the Kitt.ai engine at a time.
+static const std::chrono::milliseconds KITT_AI_MS_TO_PUSH_PER_ITERATION(20);
+
+/// The key in our config file to find the root of the Kitt.ai configuration.
+static const std::string KITT_AI_CONFIG_ROOT_KEY("kittAi");
+
+/// The key in our config file to find how much more sensitive the engine which reports keyword candidates is.
+static const std::string KITT_AI_CANDIDATE_SENSITIVITY_MARGIN_KEY("candidateSensitivityMargin");
+
+/**
+ * The default for how much more sensitive than @c KITT_AI_SENSITIVITY the engine which reports keyword candidates is.
+ * Candidates are not reported by default, since their engine runs on every chunk of audio.
+ */
+static const double KITT_AI_DEFAULT_CANDIDATE_SENSITIVITY_MARGIN = 0.0;
 #endif
 
 using namespace alexaClientSDK;
@@ -43,6 +59,13 @@ std::unique_ptr<kwd::AbstractKeywordDetector> KeywordDetectorProvider::create(
         keyWordDetectorStateObservers,
     const std::string& pathToInputFolder) {
 #if defined(KWD_KITTAI)
+    double candidateSensitivityMargin = KITT_AI_DEFAULT_CANDIDATE_SENSITIVITY_MARGIN;
+    avsCommon::utils::configuration::ConfigurationNode::getRoot()[KITT_AI_CONFIG_ROOT_KEY].getValue(
+        KITT_AI_CANDIDATE_SENSITIVITY_MARGIN_KEY,
+        &candidateSensitivityMargin,
+        KITT_AI_DEFAULT_CANDIDATE_SENSITIVITY_MARGIN,
+        &rapidjson::Value::IsNumber,
+        &rapidjson::Value::GetDouble);
     return alexaClientSDK::kwd::KittAiKeyWordDetector::create(
         stream,
         audioFormat,
@@ -51,7 +74,9 @@ std::unique_ptr<kwd::AbstractKeywordDetector> KeywordDetectorProvider::create(
         pathToInputFolder + "/common.res",
         {{pathToInputFolder + "/alexa.umdl", "ALEXA", KITT_AI_SENSITIVITY}},
         KITT_AI_AUDIO_GAIN,
-        KITT_AI_APPLY_FRONT_END_PROCESSING);
+        KITT_AI_APPLY_FRONT_END_PROCESSING,
+        KITT_AI_MS_TO_PUSH_PER_ITERATION,
+        candidateSensitivityMargin);
 
 #elif defined(KWD_SENSORY)
     return kwd::SensoryKeywordDetector::create(
@@ -70,6 +70,9 @@ public:
      * lead to less delay but more CPU usage. Additionally, larger amounts of data fed into the engine per iteration
      * might lead longer delays before receiving keyword detection events. This has been defaulted to 20 milliseconds
      * as it is a good trade off between CPU usage and recognition delay.
+     * @param candidateSensitivityMargin How much more sensitive than each keyword's @c sensitivity a second engine
+     * should be, to report keyword candidates before a keyword is confirmed, or 0 to report no candidates.  The second
+     * engine doubles the CPU usage of detection.
      * @return A new @c KittAiKeyWordDetector, or @c nullptr if the operation failed.
      * @see https://github.com/Kitt-AI/snowboy for more information regarding @c audioGain and @c applyFrontEnd.
      */
@@ -83,7 +86,8 @@ public:
         const std::vector<KittAiConfiguration> kittAiConfigurations,
         float audioGain,
         bool applyFrontEnd,
-        std::chrono::milliseconds msToPushPerIteration = std::chrono::milliseconds(20));
+        std::chrono::milliseconds msToPushPerIteration = std::chrono::milliseconds(20),
+        double candidateSensitivityMargin = 0.0);
 
     /**
      * Destructor.
@@ -108,6 +112,9 @@ private:
      * lead to less delay but more CPU usage. Additionally, larger amounts of data fed into the engine per iteration
      * might lead longer delays before receiving keyword detection events. This has been defaulted to 20 milliseconds
      * as it is a good trade off between CPU usage and recognition delay.
+     * @param candidateSensitivityMargin How much more sensitive than each keyword's @c sensitivity a second engine
+     * should be, to report keyword candidates before a keyword is confirmed, or 0 to report no candidates.  The second
+     * engine doubles the CPU usage of detection.
      * @see https://github.com/Kitt-AI/snowboy for more information regarding @c audioGain and @c applyFrontEnd.
      */
     KittAiKeyWordDetector(
@@ -120,7 +127,8 @@ private:
         const std::vector<KittAiConfiguration> kittAiConfigurations,
         float audioGain,
         bool applyFrontEnd,
-        std::chrono::milliseconds msToPushPerIteration = std::chrono::milliseconds(20));
+        std::chrono::milliseconds msToPushPerIteration = std::chrono::milliseconds(20),
+        double candidateSensitivityMargin = 0.0);
 
     /**
      * Initializes the stream reader and kicks off a thread to read data from the stream. This function should only be
@@ -142,6 +150,15 @@ private:
     /// The main function that reads data and feeds it into the engine.
     void detectionLoop();
 
+    /**
+     * Reports a keyword candidate from @c m_kittAiCandidateEngine, or the rejection of a candidate which was not
+     * confirmed in time.
+     *
+     * @param candidateResult The result of the candidate engine for the latest audio.
+     * @param detected Whether @c m_kittAiEngine detected a keyword in the latest audio.
+     */
+    void reportCandidate(int candidateResult, bool detected);
+
     /// Indicates whether the internal main loop should keep running.
     std::atomic<bool> m_isShuttingDown;
 
@@ -164,11 +181,23 @@ private:
     /// The Kitt.ai engine instantiation.
     std::unique_ptr<snowboy::SnowboyDetect> m_kittAiEngine;
 
+    /// A more sensitive Kitt.ai engine which reports keyword candidates, or @c nullptr if candidates are not reported.
+    std::unique_ptr<snowboy::SnowboyDetect> m_kittAiCandidateEngine;
+
+    /// The keyword of the candidate waiting to be confirmed or rejected, or empty if there is none.
+    std::string m_candidateKeyWord;
+
+    /// The position in @c m_stream at which @c m_candidateKeyWord was reported.
+    avsCommon::avs::AudioInputStream::Index m_candidateIndex;
+
     /**
      * The max number of samples to push into the underlying engine per iteration. This will be determined based on the
      * sampling rate of the audio data passed in.
      */
     const size_t m_maxSamplesPerPush;
+
+    /// The number of samples after which a candidate which has not been confirmed is rejected.
+    const avsCommon::avs::AudioInputStream::Index m_candidateTimeoutSamples;
 };
 
 }  // namespace kwd
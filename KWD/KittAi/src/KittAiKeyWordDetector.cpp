@@ -13,6 +13,7 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 
@@ -64,6 +65,12 @@ static const int KITT_AI_ERROR_DETECTION_RESULT = -1;
 /// Kitt.ai returns 0 if no keyword was detected but audio has been heard.
 static const int KITT_AI_NO_DETECTION_RESULT = 0;
 
+/// The highest sensitivity Kitt.ai accepts.
+static const double KITT_AI_MAX_SENSITIVITY = 1.0;
+
+/// How long after a keyword candidate the keyword must be confirmed before the candidate is rejected.
+static const std::chrono::milliseconds KEYWORD_CANDIDATE_TIMEOUT(500);
+
 std::unique_ptr<KittAiKeyWordDetector> KittAiKeyWordDetector::create(
     std::shared_ptr<AudioInputStream> stream,
     AudioFormat audioFormat,
@@ -73,7 +80,8 @@ std::unique_ptr<KittAiKeyWordDetector> KittAiKeyWordDetector::create(
     const std::vector<KittAiConfiguration> kittAiConfigurations,
     float audioGain,
     bool applyFrontEnd,
-    std::chrono::milliseconds msToPushPerIteration) {
+    std::chrono::milliseconds msToPushPerIteration,
+    double candidateSensitivityMargin) {
     if (!stream) {
         ACSDK_ERROR(LX("createFailed").d("reason", "nullStream"));
         return nullptr;
@@ -92,7 +100,8 @@ std::unique_ptr<KittAiKeyWordDetector> KittAiKeyWordDetector::create(
         kittAiConfigurations,
         audioGain,
         applyFrontEnd,
-        msToPushPerIteration));
+        msToPushPerIteration,
+        candidateSensitivityMargin));
     if (!detector->init(audioFormat)) {
         ACSDK_ERROR(LX("createFailed").d("reason", "initDetectorFailed"));
         return nullptr;
@@ -116,25 +125,40 @@ KittAiKeyWordDetector::KittAiKeyWordDetector(
     const std::vector<KittAiConfiguration> kittAiConfigurations,
     float audioGain,
     bool applyFrontEnd,
-    std::chrono::milliseconds msToPushPerIteration) :
+    std::chrono::milliseconds msToPushPerIteration,
+    double candidateSensitivityMargin) :
         AbstractKeywordDetector(keyWordObservers, keyWordDetectorStateObservers),
         m_stream{stream},
-        m_maxSamplesPerPush{(audioFormat.sampleRateHz / HERTZ_PER_KILOHERTZ) * msToPushPerIteration.count()} {
+        m_candidateIndex{0},
+        m_maxSamplesPerPush{(audioFormat.sampleRateHz / HERTZ_PER_KILOHERTZ) * msToPushPerIteration.count()},
+        m_candidateTimeoutSamples{(audioFormat.sampleRateHz / HERTZ_PER_KILOHERTZ) *
+                                  static_cast<AudioInputStream::Index>(KEYWORD_CANDIDATE_TIMEOUT.count())} {
     std::stringstream sensitivities;
+    std::stringstream candidateSensitivities;
     std::stringstream modelPaths;
     for (unsigned int i = 0; i < kittAiConfigurations.size(); ++i) {
         modelPaths << kittAiConfigurations.at(i).modelFilePath;
         sensitivities << kittAiConfigurations.at(i).sensitivity;
+        candidateSensitivities << std::min(
+            kittAiConfigurations.at(i).sensitivity + candidateSensitivityMargin, KITT_AI_MAX_SENSITIVITY);
         m_detectionResultsToKeyWords[i + 1] = kittAiConfigurations.at(i).keyword;
         if (kittAiConfigurations.size() - 1 != i) {
             modelPaths << KITT_DELIMITER;
             sensitivities << KITT_DELIMITER;
+            candidateSensitivities << KITT_DELIMITER;
         }
     }
     m_kittAiEngine = avsCommon::utils::memory::make_unique<snowboy::SnowboyDetect>(resourceFilePath, modelPaths.str());
     m_kittAiEngine->SetSensitivity(sensitivities.str());
     m_kittAiEngine->SetAudioGain(audioGain);
     m_kittAiEngine->ApplyFrontend(applyFrontEnd);
+    if (candidateSensitivityMargin > 0) {
+        m_kittAiCandidateEngine =
+            avsCommon::utils::memory::make_unique<snowboy::SnowboyDetect>(resourceFilePath, modelPaths.str());
+        m_kittAiCandidateEngine->SetSensitivity(candidateSensitivities.str());
+        m_kittAiCandidateEngine->SetAudioGain(audioGain);
+        m_kittAiCandidateEngine->ApplyFrontend(applyFrontEnd);
+    }
 }
 
 bool KittAiKeyWordDetector::init(avsCommon::utils::AudioFormat audioFormat) {
@@ -203,7 +227,12 @@ void KittAiKeyWordDetector::detectionLoop() {
         } else if (wordsRead > 0) {
             // Words were successfully read.
             notifyKeyWordDetectorStateObservers(KeyWordDetectorStateObserverInterface::KeyWordDetectorState::ACTIVE);
+            int candidateResult = KITT_AI_NO_DETECTION_RESULT;
+            if (m_kittAiCandidateEngine) {
+                candidateResult = m_kittAiCandidateEngine->RunDetection(audioDataToPush, wordsRead);
+            }
             int detectionResult = m_kittAiEngine->RunDetection(audioDataToPush, wordsRead);
+            reportCandidate(candidateResult, detectionResult > 0);
             if (detectionResult > 0) {
                 // > 0 indicates a keyword was found
                 if (m_detectionResultsToKeyWords.find(detectionResult) == m_detectionResultsToKeyWords.end()) {
@@ -248,5 +277,32 @@ void KittAiKeyWordDetector::detectionLoop() {
     m_streamReader->close();
 }
 
+void KittAiKeyWordDetector::reportCandidate(int candidateResult, bool detected) {
+    if (detected) {
+        // The keyword is confirmed, so there is nothing to reject.
+        m_candidateKeyWord.clear();
+        return;
+    }
+    if (!m_candidateKeyWord.empty()) {
+        if (m_streamReader->tell() - m_candidateIndex > m_candidateTimeoutSamples) {
+            ACSDK_DEBUG5(LX("reportCandidate").d("action", "reject").d("keyword", m_candidateKeyWord));
+            notifyKeyWordRejectedObservers(m_stream, m_candidateKeyWord);
+            m_candidateKeyWord.clear();
+        }
+        return;
+    }
+    if (candidateResult > 0) {
+        auto it = m_detectionResultsToKeyWords.find(candidateResult);
+        if (it == m_detectionResultsToKeyWords.end()) {
+            ACSDK_ERROR(LX("reportCandidateFailed").d("reason", "retrievingCandidateKeyWordFailed"));
+            return;
+        }
+        ACSDK_DEBUG5(LX("reportCandidate").d("action", "notify").d("keyword", it->second));
+        m_candidateKeyWord = it->second;
+        m_candidateIndex = m_streamReader->tell();
+        notifyKeyWordCandidateObservers(m_stream, m_candidateKeyWord);
+    }
+}
+
 }  // namespace kwd
 }  // namespace alexaClientSDK
@@ -109,6 +109,12 @@ static const bool KITTAI_APPLY_FRONTEND_PROCESSING = false;
  */
 static const double KITTAI_SENSITIVITY = 0.6;
 
+/// How much more sensitive the engine which reports keyword candidates is than @c KITTAI_SENSITIVITY.
+static const double KITTAI_CANDIDATE_SENSITIVITY_MARGIN = 0.2;
+
+/// The amount of data in milliseconds to push to Kitt.ai at a time.
+static const std::chrono::milliseconds MS_TO_PUSH_PER_ITERATION(20);
+
 /// A test observer that mocks out the KeyWordObserverInterface##onKeyWordDetected() call.
 class testKeyWordObserver : public KeyWordObserverInterface {
 public:
@@ -130,6 +136,22 @@ public:
         m_detectionOccurred.notify_one();
     };
 
+    /// Implementation of the KeyWordObserverInterface##onKeyWordCandidate() call.
+    void onKeyWordCandidate(std::shared_ptr<AudioInputStream> stream, std::string keyword) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_candidateKeyWords.push_back(keyword);
+    }
+
+    /**
+     * Returns the keywords of the candidates reported so far.
+     *
+     * @return The keywords of the candidates.
+     */
+    std::vector<std::string> getCandidateKeyWords() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_candidateKeyWords;
+    }
+
     /**
      * Waits for the KeyWordObserverInterface##onKeyWordDetected() call N times.
      *
@@ -151,6 +173,9 @@ private:
     /// The detection results that have occurred.
     std::vector<detectionResult> m_detectionResults;
 
+    /// The keywords of the candidates that have been reported.
+    std::vector<std::string> m_candidateKeyWords;
+
     /// A lock to guard against new detections.
     std::mutex m_mutex;
 
@@ -454,6 +479,51 @@ TEST_F(KittAiKeyWordTest, getExpectedNumberOfDetectionsInAlexaStopAlexaJokeAudio
     }
 }
 
+/**
+ * Tests that a detector with a candidate engine reports keyword candidates for the four_alexa.wav file, and still
+ * detects the expected keywords.
+ */
+TEST_F(KittAiKeyWordTest, getCandidatesInFourAlexasAudioFile) {
+    auto fourAlexasBuffer = std::make_shared<avsCommon::avs::AudioInputStream::Buffer>(500000);
+    auto fourAlexasSds = avsCommon::avs::AudioInputStream::create(fourAlexasBuffer, 2, 1);
+    std::shared_ptr<AudioInputStream> fourAlexasAudioBuffer = std::move(fourAlexasSds);
+
+    std::unique_ptr<AudioInputStream::Writer> fourAlexasAudioBufferWriter =
+        fourAlexasAudioBuffer->createWriter(avsCommon::avs::AudioInputStream::Writer::Policy::NONBLOCKABLE);
+
+    std::string audioFilePath = inputsDirPath + FOUR_ALEXAS_AUDIO_FILE;
+    bool error;
+    std::vector<int16_t> audioData = readAudioFromFile(audioFilePath, &error);
+    ASSERT_FALSE(error);
+
+    fourAlexasAudioBufferWriter->write(audioData.data(), audioData.size());
+
+    auto detector = KittAiKeyWordDetector::create(
+        fourAlexasAudioBuffer,
+        compatibleAudioFormat,
+        {keyWordObserver1},
+        std::unordered_set<std::shared_ptr<KeyWordDetectorStateObserverInterface>>(),
+        inputsDirPath + RESOURCE_FILE,
+        {config},
+        KITTAI_AUDIO_GAIN,
+        KITTAI_APPLY_FRONTEND_PROCESSING,
+        MS_TO_PUSH_PER_ITERATION,
+        KITTAI_CANDIDATE_SENSITIVITY_MARGIN);
+    ASSERT_TRUE(detector);
+    auto detections = keyWordObserver1->waitForNDetections(NUM_ALEXAS_IN_FOUR_ALEXAS_AUDIO_FILE, DEFAULT_TIMEOUT);
+    ASSERT_EQ(detections.size(), NUM_ALEXAS_IN_FOUR_ALEXAS_AUDIO_FILE);
+
+    for (auto index : END_INDICES_OF_ALEXAS_IN_FOUR_ALEXAS_AUDIO_FILE) {
+        ASSERT_TRUE(isResultPresent(detections, index, MODEL_KEYWORD));
+    }
+
+    auto candidates = keyWordObserver1->getCandidateKeyWords();
+    ASSERT_FALSE(candidates.empty());
+    for (auto& keyword : candidates) {
+        ASSERT_EQ(keyword, MODEL_KEYWORD);
+    }
+}
+
 /**
  * Tests that we get back the expected number of keywords for the alexa_stop_alexa_joke.wav file for two keyword
  * observer.
@@ -94,6 +94,29 @@ protected:
         avsCommon::avs::AudioInputStream::Index endIndex,
         std::shared_ptr<const std::vector<char>> KWDMetadata = nullptr) const;
 
+    /**
+     * Notifies all keyword observers that the engine has heard what may be a keyword.  Engines which score a keyword
+     * in stages should call this once the first stage fires, and then either @c notifyKeyWordObservers() or
+     * @c notifyKeyWordRejectedObservers().
+     *
+     * @param stream The stream in which the keyword may have been spoken.
+     * @param keyword The keyword which may have been spoken.
+     */
+    void notifyKeyWordCandidateObservers(
+        std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+        const std::string& keyword) const;
+
+    /**
+     * Notifies all keyword observers that the engine has rejected the candidate it reported with
+     * @c notifyKeyWordCandidateObservers().
+     *
+     * @param stream The stream in which the candidate was heard.
+     * @param keyword The keyword of the candidate.
+     */
+    void notifyKeyWordRejectedObservers(
+        std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+        const std::string& keyword) const;
+
     /**
      * Notifies all keyword detector state observers of state changes in the derived detector.
      *
@@ -76,6 +76,24 @@ void AbstractKeywordDetector::notifyKeyWordObservers(
     }
 }
 
+void AbstractKeywordDetector::notifyKeyWordCandidateObservers(
+    std::shared_ptr<AudioInputStream> stream,
+    const std::string& keyword) const {
+    std::lock_guard<std::mutex> lock(m_keyWordObserversMutex);
+    for (auto keyWordObserver : m_keyWordObservers) {
+        keyWordObserver->onKeyWordCandidate(stream, keyword);
+    }
+}
+
+void AbstractKeywordDetector::notifyKeyWordRejectedObservers(
+    std::shared_ptr<AudioInputStream> stream,
+    const std::string& keyword) const {
+    std::lock_guard<std::mutex> lock(m_keyWordObserversMutex);
+    for (auto keyWordObserver : m_keyWordObservers) {
+        keyWordObserver->onKeyWordRejected(stream, keyword);
+    }
+}
+
 void AbstractKeywordDetector::notifyKeyWordDetectorStateObservers(
     KeyWordDetectorStateObserverInterface::KeyWordDetectorState state) {
     if (m_detectorState != state) {
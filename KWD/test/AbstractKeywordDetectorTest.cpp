@@ -42,6 +42,12 @@ public:
             avsCommon::avs::AudioInputStream::Index beginIndex,
             avsCommon::avs::AudioInputStream::Index endIndex,
             std::shared_ptr<const std::vector<char>> KWDMetadata));
+    MOCK_METHOD2(
+        onKeyWordCandidate,
+        void(std::shared_ptr<avsCommon::avs::AudioInputStream> stream, std::string keyword));
+    MOCK_METHOD2(
+        onKeyWordRejected,
+        void(std::shared_ptr<avsCommon::avs::AudioInputStream> stream, std::string keyword));
 };
 
 /// A test observer that mocks out the KeyWordDetectorStateObserverInterface##onStateChanged() call.
@@ -65,6 +71,20 @@ public:
         notifyKeyWordObservers(nullptr, "ALEXA", 0, 0);
     };
 
+    /**
+     * Notifies all KeyWordObservers of a keyword candidate with dummy values.
+     */
+    void sendKeyWordCandidateCallToObservers() {
+        notifyKeyWordCandidateObservers(nullptr, "ALEXA");
+    };
+
+    /**
+     * Notifies all KeyWordObservers that the keyword candidate was rejected, with dummy values.
+     */
+    void sendKeyWordRejectedCallToObservers() {
+        notifyKeyWordRejectedObservers(nullptr, "ALEXA");
+    };
+
     /**
      * Notifies all KeyWordDetectorStateObservers.
      *
@@ -124,6 +144,26 @@ TEST_F(AbstractKeyWordDetectorTest, testRemoveKeyWordObserver) {
     detector->sendKeyWordCallToObservers();
 }
 
+TEST_F(AbstractKeyWordDetectorTest, testKeyWordCandidateAndRejection) {
+    detector->addKeyWordObserver(keyWordObserver1);
+    detector->addKeyWordObserver(keyWordObserver2);
+
+    EXPECT_CALL(*keyWordObserver1, onKeyWordCandidate(_, "ALEXA")).Times(1);
+    EXPECT_CALL(*keyWordObserver2, onKeyWordCandidate(_, "ALEXA")).Times(1);
+    EXPECT_CALL(*keyWordObserver1, onKeyWordDetected(_, _, _, _, _)).Times(0);
+    detector->sendKeyWordCandidateCallToObservers();
+
+    EXPECT_CALL(*keyWordObserver1, onKeyWordRejected(_, "ALEXA")).Times(1);
+    EXPECT_CALL(*keyWordObserver2, onKeyWordRejected(_, "ALEXA")).Times(1);
+    detector->sendKeyWordRejectedCallToObservers();
+
+    detector->removeKeyWordObserver(keyWordObserver1);
+
+    EXPECT_CALL(*keyWordObserver1, onKeyWordCandidate(_, _)).Times(0);
+    EXPECT_CALL(*keyWordObserver2, onKeyWordCandidate(_, "ALEXA")).Times(1);
+    detector->sendKeyWordCandidateCallToObservers();
+}
+
 TEST_F(AbstractKeyWordDetectorTest, testAddStateObserver) {
     detector->addKeyWordDetectorStateObserver(stateObserver1);
 
@@ -77,6 +77,12 @@ private:
 private:
     /// The @c AttachmentReader to read audioData from.
     std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> m_reader;
+
+    /**
+     * Whether @c m_reader signals when data may be available, so that the read loop can wait for data rather than
+     * retry on a timer.
+     */
+    bool m_isDataAvailableSignaled;
 };
 
 }  // namespace mediaPlayer
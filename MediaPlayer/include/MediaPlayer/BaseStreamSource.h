@@ -16,6 +16,8 @@
 #ifndef ALEXA_CLIENT_SDK_MEDIAPLAYER_INCLUDE_MEDIAPLAYER_BASESTREAMSOURCE_H_
 #define ALEXA_CLIENT_SDK_MEDIAPLAYER_INCLUDE_MEDIAPLAYER_BASESTREAMSOURCE_H_
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 
 #include <gst/gst.h>
@@ -43,6 +45,15 @@ public:
     bool hasAdditionalData() override;
     bool handleEndOfStream() override;
     void preprocess() override;
+    void setBitrate(unsigned int bitsPerSecond) override;
+
+    /**
+     * Moves this source to another @c PipelineInterface, which has taken over the appSrc and decoder elements of this
+     * source.  The @c MediaPlayer uses this when a source prepared to play next becomes its current source.
+     *
+     * @param pipeline The @c PipelineInterface which now holds the elements of this source.
+     */
+    void setPipeline(PipelineInterface* pipeline);
 
 protected:
     /**
@@ -90,7 +101,7 @@ protected:
     GstAppSrc* getAppSrc() const;
 
     /**
-     * Signal gstreamer about the end of data from this instance.
+     * Signal gstreamer about the end of data from this instance, and notify the @c PipelineInterface.
      */
     void signalEndOfData();
 
@@ -115,6 +126,45 @@ protected:
      */
     void clearOnReadDataHandler();
 
+    /**
+     * Returns the size of the chunks of data to push to the @c appsrc element.  Once the bitrate of the stream is
+     * known, a chunk holds about a tenth of a second of audio.
+     *
+     * @return The size of a chunk, in bytes.
+     */
+    gsize getChunkSize() const;
+
+    /**
+     * Takes a buffer of @c getChunkSize() bytes from the pool of this source.  The buffer goes back to the pool once
+     * the pipeline is done with it, so that a steady stream of chunks does not allocate.
+     *
+     * @return The buffer, or @c nullptr if no buffer could be allocated.
+     */
+    GstBuffer* acquireChunkBuffer();
+
+    /**
+     * Notes that data may have become available to read, and resumes the read loop if it is waiting for data.  This
+     * may be called from any thread.
+     */
+    void signalDataAvailable();
+
+    /**
+     * Returns the number of calls to @c signalDataAvailable() so far.  A source takes this before it reads, and passes
+     * it to @c waitForDataAvailable() if the read finds no data.
+     *
+     * @return The number of calls to @c signalDataAvailable().
+     */
+    uint64_t getDataAvailableSignalCount() const;
+
+    /**
+     * Stops the read loop until @c signalDataAvailable() is called, for a source whose reads found no data, instead of
+     * retrying on a timer.  If data was signalled since the read began, the read loop carries on instead.
+     *
+     * @param signalCountBeforeRead The value of @c getDataAvailableSignalCount() before the read.
+     * @return The value for @c handleReadData() to return.
+     */
+    gboolean waitForDataAvailable(uint64_t signalCountBeforeRead);
+
 private:
     /**
      * The callback for pushing data into the appsrc element.
@@ -157,6 +207,18 @@ private:
      */
     static gboolean onReadData(gpointer source);
 
+    /**
+     * Resumes the read loop once data may be available.
+     *
+     * @return Whether this callback should be called again on the worker thread (always @c false).
+     */
+    gboolean handleDataAvailable();
+
+    /**
+     * Deactivates and releases @c m_bufferPool.  Buffers still in use are freed once the pipeline is done with them.
+     */
+    void releaseBufferPool();
+
     /// The @c PipelineInterface through which the source of the @c AudioPipeline may be set.
     PipelineInterface* m_pipeline;
 
@@ -181,7 +243,7 @@ private:
     /// ID of the handler installed to receive seek data signals.
     guint m_seekDataHandlerId;
 
-    /// Mutex to serialize access to idle callback IDs.
+    /// Mutex to serialize access to idle callback IDs, and to @c m_pipeline from the streaming thread.
     std::mutex m_callbackIdMutex;
 
     /// ID of idle callback to handle need data.
@@ -189,6 +251,27 @@ private:
 
     /// ID of idle callback to handle enough data.
     guint m_enoughDataCallbackId;
+
+    /// Function to invoke on the worker thread when data may be available.
+    const std::function<gboolean()> m_handleDataAvailableFunction;
+
+    /// ID of idle callback to handle data becoming available.
+    guint m_dataAvailableCallbackId;
+
+    /// The number of calls to @c signalDataAvailable().
+    std::atomic<uint64_t> m_dataAvailableSignalCount;
+
+    /// Whether the read loop is stopped until data is signalled.
+    std::atomic<bool> m_isWaitingForData;
+
+    /// The size of the chunks of data to push to the @c appsrc element.
+    gsize m_chunkSize;
+
+    /// The pool of buffers of @c m_bufferPoolChunkSize bytes from which chunks are taken.
+    GstBufferPool* m_bufferPool;
+
+    /// The size of the buffers of @c m_bufferPool.
+    gsize m_bufferPoolChunkSize;
 };
 
 }  // namespace mediaPlayer
@@ -0,0 +1,175 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_MEDIAPLAYER_INCLUDE_MEDIAPLAYER_DECODEDAUDIOCACHE_H_
+#define ALEXA_CLIENT_SDK_MEDIAPLAYER_INCLUDE_MEDIAPLAYER_DECODEDAUDIOCACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <AVSCommon/Utils/AudioFormat.h>
+#include <AVSCommon/Utils/Threading/Executor.h>
+
+namespace alexaClientSDK {
+namespace mediaPlayer {
+
+/**
+ * A cache of short sounds, such as the alert, notification and communications earcons, decoded to PCM.
+ *
+ * The earcons are compressed, and a @c MediaPlayer decoded them again each time they were played, and on every loop
+ * of a ringing alarm.  A @c MediaPlayer given a cache looks up each stream it is asked to play in the cache, and plays
+ * the decoded audio of a stream found there directly.  Streams are identified by their content, so the same sound
+ * from any @c std::istream is found.  The cache keeps the compressed audio of each sound it holds, and a stream is
+ * only found if its content is identical, so that two sounds can never be confused.  A stream not yet in the cache is
+ * played as before while it is decoded in the background, so that it is found the next time.  A sound which cannot be
+ * decoded, or whose decoded audio would take the cache over its cap, is remembered as such, and is played as before
+ * without being decoded again.  It counts only its compressed audio toward the cap.  Sounds may also be decoded ahead
+ * of time with @c prefetch().
+ */
+class DecodedAudioCache {
+public:
+    /// A sound decoded to PCM.
+    struct DecodedAudio {
+        /// The format of the samples.
+        avsCommon::utils::AudioFormat format;
+
+        /// The samples.
+        std::vector<uint8_t> samples;
+    };
+
+    /// The default cap on the total size of the decoded and compressed audio in the cache.
+    static const size_t DEFAULT_MAX_CACHED_BYTES;
+
+    /**
+     * Create a DecodedAudioCache.
+     *
+     * @param maxCachedBytes The cap on the total size of the decoded and compressed audio in the cache.  Sounds which
+     * would take the cache over the cap are not cached.
+     * @return The new @c DecodedAudioCache, or @c nullptr if GStreamer could not be initialized.
+     */
+    static std::shared_ptr<DecodedAudioCache> create(size_t maxCachedBytes = DEFAULT_MAX_CACHED_BYTES);
+
+    /**
+     * Destructor.  Waits for any decoding in progress to finish.
+     */
+    ~DecodedAudioCache();
+
+    /**
+     * Look up the decoded audio of a stream.  If the stream is not in the cache, it is decoded in the background, so
+     * that it is found the next time it is looked up.
+     *
+     * @param stream The stream, which is read to its end and then rewound.
+     * @return The decoded audio, or @c nullptr if the stream is not in the cache.
+     */
+    std::shared_ptr<const DecodedAudio> get(std::istream& stream);
+
+    /**
+     * Decode a sound in the background, so that it is in the cache before it is first played.
+     *
+     * @param streamFunction Creates a stream of the sound, such as a function of the audio factories.
+     * @return A future which is @c true once the sound is in the cache, or @c false if it cannot be cached.
+     */
+    std::future<bool> prefetch(std::function<std::unique_ptr<std::istream>()> streamFunction);
+
+    /**
+     * Returns the total size of the decoded and compressed audio in the cache, including that of the sounds being
+     * decoded.
+     *
+     * @return The size, in bytes.
+     */
+    size_t getCachedBytes();
+
+    /**
+     * Decode compressed audio to 16-bit interleaved PCM, at the sample rate and with the channels of the audio.
+     *
+     * @param encoded The compressed audio.
+     * @param maxBytes The largest size of decoded audio to return.
+     * @return The decoded audio, or @c nullptr if the audio cannot be decoded or decodes to more than @c maxBytes.
+     */
+    static std::shared_ptr<const DecodedAudio> decode(const std::string& encoded, size_t maxBytes);
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param maxCachedBytes The cap on the total size of the decoded and compressed audio in the cache.
+     */
+    DecodedAudioCache(size_t maxCachedBytes);
+
+    /**
+     * Decode a sound and add it to the cache.  This runs on @c m_executor.
+     *
+     * @param encoded The compressed audio of the sound.
+     * @return Whether the sound is in the cache.
+     */
+    bool executeDecode(const std::string& encoded);
+
+    /**
+     * Add a sound to be decoded to the cache, counting its compressed audio toward the cap.  This must be called with
+     * @c m_mutex held.
+     *
+     * @param encoded The compressed audio of the sound.
+     * @return @c true if the sound was added, or @c false if it would take the cache over its cap.
+     */
+    bool addPendingSoundLocked(const std::string& encoded);
+
+    /**
+     * Mark a sound which could not be cached as failed, so that it is not decoded again.  This must be called with
+     * @c m_mutex held.
+     *
+     * @param encoded The compressed audio of the sound.
+     */
+    void failPendingSoundLocked(const std::string& encoded);
+
+    /// A sound in the cache.
+    struct Sound {
+        /// The decoded audio, or @c nullptr if the sound is being decoded or could not be cached.
+        std::shared_ptr<const DecodedAudio> audio;
+
+        /// Whether the sound could not be decoded, or its decoded audio did not fit under the cap.
+        bool failed;
+    };
+
+    /// The cap on the total size of the decoded and compressed audio in the cache.
+    const size_t m_maxCachedBytes;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /**
+     * The sounds in the cache, by their compressed audio.  A sound being decoded is in the map without its audio, so
+     * that it is not decoded a second time while it is in progress.
+     */
+    std::unordered_map<std::string, Sound> m_sounds;
+
+    /// The total size of the decoded and compressed audio in the cache.
+    size_t m_cachedBytes;
+
+    /// Decodes sounds in the background.  This is declared last, so that it is shut down before the cache goes away.
+    avsCommon::utils::threading::Executor m_executor;
+};
+
+}  // namespace mediaPlayer
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_MEDIAPLAYER_INCLUDE_MEDIAPLAYER_DECODEDAUDIOCACHE_H_
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_MEDIAPLAYER_INCLUDE_MEDIAPLAYER_DECODEDAUDIOSOURCE_H_
+#define ALEXA_CLIENT_SDK_MEDIAPLAYER_INCLUDE_MEDIAPLAYER_DECODEDAUDIOSOURCE_H_
+
+#include <cstddef>
+#include <memory>
+
+#include "MediaPlayer/BaseStreamSource.h"
+#include "MediaPlayer/DecodedAudioCache.h"
+
+namespace alexaClientSDK {
+namespace mediaPlayer {
+
+/**
+ * A source which plays a sound from a @c DecodedAudioCache.  The decoded samples are handed to the pipeline without
+ * being copied, and a repeating sound loops over them without being decoded again.
+ */
+class DecodedAudioSource : public BaseStreamSource {
+public:
+    /**
+     * Create a DecodedAudioSource.
+     *
+     * @param pipeline The @c PipelineInterface through which the source of the @c AudioPipeline may be set.
+     * @param audio The decoded sound.
+     * @param repeat Whether the sound should be replayed until stopped.
+     */
+    static std::unique_ptr<DecodedAudioSource> create(
+        PipelineInterface* pipeline,
+        std::shared_ptr<const DecodedAudioCache::DecodedAudio> audio,
+        bool repeat);
+
+    /**
+     * Destructor.
+     */
+    ~DecodedAudioSource() override;
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param pipeline The @c PipelineInterface through which the source of the @c AudioPipeline may be set.
+     * @param audio The decoded sound.
+     * @param repeat Whether the sound should be replayed until stopped.
+     */
+    DecodedAudioSource(
+        PipelineInterface* pipeline,
+        std::shared_ptr<const DecodedAudioCache::DecodedAudio> audio,
+        bool repeat);
+
+    /// @name Overridden SourceInterface methods.
+    /// @{
+    bool isPlaybackRemote() const override;
+    bool hasAdditionalData() override;
+    /// @}
+
+    /// @name RequiresShutdown Functions
+    /// @{
+    void doShutdown() override{};
+    /// @}
+
+    /// @name Overridden BaseStreamSource methods.
+    /// @{
+    bool isOpen() override;
+    void close() override;
+    gboolean handleReadData() override;
+    gboolean handleSeekData(guint64 offset) override;
+    /// @}
+
+    /// The decoded sound.
+    std::shared_ptr<const DecodedAudioCache::DecodedAudio> m_audio;
+
+    /// Play the sound over and over until told to stop.
+    bool m_repeat;
+
+    /// The offset in @c m_audio of the next sample to play.
+    size_t m_offset;
+};
+
+}  // namespace mediaPlayer
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_MEDIAPLAYER_INCLUDE_MEDIAPLAYER_DECODEDAUDIOSOURCE_H_
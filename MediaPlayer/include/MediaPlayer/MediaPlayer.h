@@ -37,6 +37,8 @@
 #include <AVSCommon/Utils/PlaylistParser/PlaylistParserInterface.h>
 #include <PlaylistParser/UrlContentToAttachmentConverter.h>
 
+#include "MediaPlayer/BaseStreamSource.h"
+#include "MediaPlayer/DecodedAudioCache.h"
 #include "MediaPlayer/OffsetManager.h"
 #include "MediaPlayer/PipelineInterface.h"
 #include "MediaPlayer/SourceInterface.h"
@@ -62,6 +64,9 @@ public:
      *
      * @param contentFetcherFactory Used to create objects that can fetch remote HTTP content.
      * @param type The type used to categorize the speaker for volume control.
+     * @param name The name of the player.
+     * @param decodedAudioCache The cache from which to play @c std::istream sources without decoding them again, or
+     * @c nullptr to decode them each time they are played.
      * @return An instance of the @c MediaPlayer if successful else a @c nullptr.
      */
     static std::shared_ptr<MediaPlayer> create(
@@ -69,7 +74,8 @@ public:
             nullptr,
         avsCommon::sdkInterfaces::SpeakerInterface::Type type =
             avsCommon::sdkInterfaces::SpeakerInterface::Type::AVS_SYNCED,
-        std::string name = "");
+        std::string name = "",
+        std::shared_ptr<DecodedAudioCache> decodedAudioCache = nullptr);
 
     /**
      * Destructor.
@@ -84,6 +90,11 @@ public:
     SourceId setSource(std::shared_ptr<std::istream> stream, bool repeat) override;
     SourceId setSource(const std::string& url, std::chrono::milliseconds offset = std::chrono::milliseconds::zero())
         override;
+    SourceId prepareNextSource(const std::string& url) override;
+    SourceId prepareNextSource(
+        std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> attachmentReader,
+        const avsCommon::utils::AudioFormat* format = nullptr) override;
+    bool cancelNextSource() override;
 
     bool play(SourceId id) override;
     bool stop(SourceId id) override;
@@ -115,6 +126,7 @@ public:
     GstElement* getDecoder() const override;
     GstElement* getPipeline() const override;
     guint queueCallback(const std::function<gboolean()>* callback) override;
+    void notifyEndOfData() override;
     /// @}
 
     /// @name Overriden UrlContentToAttachmentConverter::ErrorObserverInterface methods.
@@ -129,6 +141,8 @@ private:
      * The @c AudioPipeline consists of the following elements:
      * @li @c appsrc The appsrc element is used as the source to which audio data is provided.
      * @li @c decoder Decodebin is used as the decoder element to decode audio.
+     * @li @c concat The optional concat element plays the decoded audio of each source linked to it in turn, so that a
+     * source prepared to play next follows the current one without a gap.
      * @li @c converter An audio-converter is used to convert between audio formats.
      * @li @c volume The volume element is used as a volume control.
      * @li @c resampler The optional resampler element is used to convert to a specified format
@@ -137,7 +151,9 @@ private:
      * @li @c pipeline The pipeline is a bin consisting of the @c appsrc, the @c decoder, the @c converter, and the
      * @c audioSink.
      *
-     * The data flow through the elements is appsrc -> decoder ->  converter -> volume -> audioSink.
+     * The data flow through the elements is appsrc -> decoder -> converter -> volume -> audioSink.  Once a source is
+     * prepared to play next, the concat element is inserted between the decoders and the converter until the pipeline
+     * is stopped.
      * Ideally we would want to use playsink or playbin directly to automate as much as possible. However, this
      * causes problems with multiple pipelines and volume settings in pulse audio. Pending further investigation.
      */
@@ -148,6 +164,9 @@ private:
         /// The decoder element.
         GstElement* decoder;
 
+        /// The concat element.
+        GstElement* concat;
+
         /// The converter element.
         GstElement* converter;
 
@@ -170,22 +189,83 @@ private:
         AudioPipeline() :
                 appsrc{nullptr},
                 decoder{nullptr},
+                concat{nullptr},
                 converter{nullptr},
                 volume{nullptr},
                 audioSink{nullptr},
                 pipeline{nullptr} {};
     };
 
+    /**
+     * Holds the appsrc and decoder elements of a source prepared to play after the current one.  These form a second
+     * branch of the @c AudioPipeline, linked to its own sink pad of the concat element.  It also observes the errors
+     * of the @c UrlContentToAttachmentConverter streaming the prepared source.
+     */
+    class NextSourcePipeline
+            : public PipelineInterface
+            , public playlistParser::UrlContentToAttachmentConverter::ErrorObserverInterface {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param mediaPlayer The @c MediaPlayer whose pipeline holds the elements.
+         * @param id The id of the prepared source.
+         */
+        NextSourcePipeline(MediaPlayer* mediaPlayer, SourceId id);
+
+        /// @name Overridden PipelineInterface methods.
+        /// @{
+        void setAppSrc(GstAppSrc* appSrc) override;
+        GstAppSrc* getAppSrc() const override;
+        void setDecoder(GstElement* decoder) override;
+        GstElement* getDecoder() const override;
+        GstElement* getPipeline() const override;
+        guint queueCallback(const std::function<gboolean()>* callback) override;
+        void notifyEndOfData() override;
+        /// @}
+
+        /// @name Overriden UrlContentToAttachmentConverter::ErrorObserverInterface methods.
+        /// @{
+        void onError() override;
+        /// @}
+
+        /**
+         * Whether the prepared source has pushed all of its data to the appsrc element.
+         *
+         * @return @c true if all of the data has been pushed, else @c false.
+         */
+        bool isEndOfData() const;
+
+    private:
+        /// The @c MediaPlayer whose pipeline holds the elements.
+        MediaPlayer* m_mediaPlayer;
+
+        /// The id of the prepared source.
+        const SourceId m_id;
+
+        /// The source element.
+        GstAppSrc* m_appSrc;
+
+        /// The decoder element.
+        GstElement* m_decoder;
+
+        /// Whether the prepared source has pushed all of its data to the appsrc element.
+        bool m_isEndOfData;
+    };
+
     /**
      * Constructor.
      *
      * @param contentFetcherFactory Used to create objects that can fetch remote HTTP content.
      * @param type The type used to categorize the speaker for volume control.
+     * @param name The name of the player.
+     * @param decodedAudioCache The cache from which to play @c std::istream sources, or @c nullptr.
      */
     MediaPlayer(
         std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory,
         avsCommon::sdkInterfaces::SpeakerInterface::Type type,
-        std::string name);
+        std::string name,
+        std::shared_ptr<DecodedAudioCache> decodedAudioCache);
 
     /**
      * Initializes GStreamer and starts a main event loop on a new thread.
@@ -219,7 +299,7 @@ private:
 
     /**
      * Stops the currently playing audio and removes the transient elements.  The transient elements
-     * are appsrc and decoder.
+     * are appsrc and decoder, and those of any source prepared to play next.
      */
     void tearDownTransientPipelineElements();
 
@@ -229,8 +309,49 @@ private:
     void resetPipeline();
 
     /**
-     * This handles linking the source pad of the decoder to the sink pad of the converter once the pad-added signal
-     * has been emitted by the decoder element.
+     * Requests a new sink pad of the concat element, to which the decoder of a source is linked.
+     *
+     * @return The new pad, or @c nullptr on failure.
+     */
+    GstPad* requestConcatPad();
+
+    /**
+     * Adds the concat element to the pipeline ahead of the converter, and requests @c m_concatPad for the decoder of
+     * the current source.  If the decoder is already linked to the converter, it is relinked to @c m_concatPad from a
+     * pad probe once no data is flowing.  The concat element is removed again on failure.
+     *
+     * @return @c true if the concat element was added, else @c false.
+     */
+    bool insertConcat();
+
+    /**
+     * Relinks the decoder of the current source to the converter through the concat element.  This is called from an
+     * idle probe on the decoder's source pad, so no buffer is in flight while the pads are relinked.
+     *
+     * @param decoderPad The source pad of the decoder, linked to the sink pad of the converter.
+     * @param info The probe info.
+     * @param concatPad The sink pad of the concat element to link @c decoderPad to.
+     * @return @c GST_PAD_PROBE_REMOVE, as the relinking is only done once.
+     */
+    static GstPadProbeReturn onDecoderPadIdle(GstPad* decoderPad, GstPadProbeInfo* info, gpointer concatPad);
+
+    /**
+     * Unlinks the concat element from the converter and removes it from the pipeline, releasing @c m_concatPad.  This
+     * should only be called with no prepared source and no data flowing, after which the pipeline is as set up by
+     * @c setupPipeline().
+     */
+    void removeConcat();
+
+    /**
+     * Releases a sink pad of the concat element requested with @c requestConcatPad().
+     *
+     * @param pad The pad to release.  This is set to @c nullptr.
+     */
+    void releaseConcatPad(GstPad** pad);
+
+    /**
+     * This handles linking the source pad of the decoder to the sink pad of the converter, or of the concat element if
+     * it is in the pipeline, once the pad-added signal has been emitted by the decoder element.
      *
      * @note Pads are the element's interface. Data streams from one element's source pad to another element's sink pad.
      *
@@ -241,7 +362,8 @@ private:
     static void onPadAdded(GstElement* src, GstPad* pad, gpointer mediaPlayer);
 
     /**
-     * Performs the linking of the decoder and converter elements once the pads have been added to the decoder element.
+     * Performs the linking of the decoder and the converter or concat element once the pads have been added to the
+     * decoder element.
      *
      * @param promise A void promise to fulfill once this method completes.
      * @param src The element for which the pad has been added.
@@ -281,9 +403,10 @@ private:
     /**
      * Send tags that are found in the stream to the observer.
      *
+     * @param id The id of the source whose stream holds the tags.
      * @param vectorOfTags Vector containing tags that are found in the stream.
      */
-    void sendStreamTagsToObserver(std::unique_ptr<const VectorOfTags> vectorOfTags);
+    void sendStreamTagsToObserver(SourceId id, std::unique_ptr<const VectorOfTags> vectorOfTags);
 
     /**
      * Worker thread handler for setting the source of audio to play.
@@ -315,6 +438,72 @@ private:
      */
     void handleSetIStreamSource(std::shared_ptr<std::istream> stream, bool repeat, std::promise<SourceId>* promise);
 
+    /**
+     * Worker thread handler for preparing the source of audio to play after the current one.
+     *
+     * @param reader The @c AttachmentReader with which to receive the audio to play.
+     * @param promise A promise to fulfill with a @c SourceId value once the source has been prepared.
+     * @param audioFormat The audioFormat to be used to interpret raw audio data.
+     */
+    void handlePrepareNextAttachmentReaderSource(
+        std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> reader,
+        std::promise<SourceId>* promise,
+        const avsCommon::utils::AudioFormat* audioFormat);
+
+    /**
+     * Worker thread handler for preparing the source of audio to play after the current one.
+     *
+     * @param url The url to prepare as the source.
+     * @param promise A promise to fulfill with a @c SourceId value once the source has been prepared.
+     */
+    void handlePrepareNextUrlSource(const std::string& url, std::promise<SourceId>* promise);
+
+    /**
+     * Worker thread handler for discarding the source prepared to play after the current one.
+     *
+     * @param promise A promise to fulfill with whether there was a prepared source.
+     */
+    void handleCancelNextSource(std::promise<bool>* promise);
+
+    /**
+     * Creates the prepared source in @c m_nextPipeline, inserts the concat element if needed, links the source to it
+     * and brings it to the state of the pipeline, so that it starts decoding.
+     *
+     * @param reader The @c AttachmentReader with which to receive the audio to play.
+     * @param audioFormat The audioFormat to be used to interpret raw audio data.
+     * @return @c true if the source was prepared, else @c false.
+     */
+    bool startNextSource(
+        std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> reader,
+        const avsCommon::utils::AudioFormat* audioFormat);
+
+    /**
+     * Stops and removes the elements of the source prepared to play next, without notifying the observer.
+     */
+    void discardNextSource();
+
+    /**
+     * Makes the prepared source the current one, once the concat element has switched to it.  This removes the
+     * elements of the current source, and notifies the observer that the current source has finished and that the
+     * prepared one has started.
+     */
+    void switchToNextSource();
+
+    /**
+     * Whether the concat element is playing the source prepared to play next.
+     *
+     * @return @c true if the concat element has switched to the prepared source, else @c false.
+     */
+    bool isNextSourceActive();
+
+    /**
+     * Whether a message was posted by the elements of the source prepared to play next.
+     *
+     * @param message The message posted on the bus.
+     * @return @c true if the message was posted by the prepared source, else @c false.
+     */
+    bool isFromNextSource(GstMessage* message);
+
     /**
      * Internal method to update the volume according to a gstreamer bug fix
      * https://bugzilla.gnome.org/show_bug.cgi?id=793081
@@ -420,6 +609,21 @@ private:
      */
     void sendPlaybackFinished();
 
+    /**
+     * Sends the playback nearly finished notification to the observer, once per source.
+     */
+    void sendPlaybackNearlyFinished();
+
+    /**
+     * Sends the playback error notification for the source prepared to play next to the observer, and discards it.
+     *
+     * @param type The error type.
+     * @param error The error details.
+     */
+    void sendNextSourceError(
+        const alexaClientSDK::avsCommon::utils::mediaPlayer::ErrorType& type,
+        const std::string& error);
+
     /**
      * Sends the playback paused notification to the observer.
      */
@@ -486,6 +690,21 @@ private:
      */
     static gboolean onErrorCallback(gpointer pointer);
 
+    /**
+     * Notification of an error streaming a source prepared to play next, which may since have become the current
+     * one.  Like @c onError(), this does not block.
+     *
+     * @param id The id of the source.
+     */
+    void onSourceError(SourceId id);
+
+    /**
+     * Worker thread handler for an error streaming a source.
+     *
+     * @param id The id of the source.
+     */
+    void handleSourceError(SourceId id);
+
     /**
      * Save offset of stream before we teardown the pipeline.
      */
@@ -505,12 +724,18 @@ private:
     /// Used to stream urls into attachments
     std::shared_ptr<playlistParser::UrlContentToAttachmentConverter> m_urlConverter;
 
+    /// Used to stream the url of the source prepared to play next into an attachment.
+    std::shared_ptr<playlistParser::UrlContentToAttachmentConverter> m_nextUrlConverter;
+
     /// An instance of the @c OffsetManager.
     OffsetManager m_offsetManager;
 
     /// Used to create objects that can fetch remote HTTP content.
     std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> m_contentFetcherFactory;
 
+    /// The cache from which to play @c std::istream sources, or @c nullptr to decode them each time.
+    std::shared_ptr<DecodedAudioCache> m_decodedAudioCache;
+
     /// An instance of the @c AudioPipeline.
     AudioPipeline m_pipeline;
 
@@ -532,6 +757,9 @@ private:
     /// Flag to indicate when a playback finished notification has been sent to the observer.
     bool m_playbackFinishedSent;
 
+    /// Flag to indicate when a playback nearly finished notification has been sent to the observer.
+    bool m_playbackNearlyFinishedSent;
+
     /// Flag to indicate whether a playback is paused.
     bool m_isPaused;
 
@@ -547,6 +775,21 @@ private:
     /// The current source id.
     SourceId m_currentId;
 
+    /// The sink pad of the concat element to which the decoder of @c m_source is linked.
+    GstPad* m_concatPad;
+
+    /// Holds the elements of the source prepared to play next.
+    std::shared_ptr<NextSourcePipeline> m_nextPipeline;
+
+    /// The source prepared to play after @c m_source, or @c nullptr.
+    std::shared_ptr<BaseStreamSource> m_nextSource;
+
+    /// The id of the source prepared to play next.
+    SourceId m_nextId;
+
+    /// The sink pad of the concat element to which the decoder of @c m_nextSource is linked.
+    GstPad* m_nextConcatPad;
+
     /// Flag to indicate whether a play is currently pending a callback.
     bool m_playPending;
 
@@ -77,6 +77,12 @@ public:
      */
     virtual guint queueCallback(const std::function<gboolean()>* callback) = 0;
 
+    /**
+     * Notifies the @c AudioPipeline that its source has pushed all of its data to the appSrc element.  This is called
+     * on the worker thread of the @c MediaPlayer.
+     */
+    virtual void notifyEndOfData() = 0;
+
 protected:
     /**
      * Destructor.
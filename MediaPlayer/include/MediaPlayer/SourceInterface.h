@@ -70,6 +70,15 @@ public:
      * @return A boolean indicating whether the source is from a remote or local source
      */
     virtual bool isPlaybackRemote() const = 0;
+
+    /**
+     * Tells the source the bitrate of the stream it provides, once the pipeline has found it, so that the source can
+     * size the chunks of data it pushes to the stream.
+     *
+     * @param bitsPerSecond The bitrate of the stream.
+     */
+    virtual void setBitrate(unsigned int bitsPerSecond) {
+    }
 };
 
 }  // namespace mediaPlayer
@@ -37,18 +37,20 @@ static const std::string TAG("AttachmentReaderSource");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-/// The number of bytes read from the attachment with each read in the read loop.
-static const unsigned int CHUNK_SIZE(4096);
-
 std::unique_ptr<AttachmentReaderSource> AttachmentReaderSource::create(
     PipelineInterface* pipeline,
     std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> attachmentReader,
     const avsCommon::utils::AudioFormat* audioFormat) {
     std::unique_ptr<AttachmentReaderSource> result(new AttachmentReaderSource(pipeline, attachmentReader));
-    if (result->init(audioFormat)) {
-        return result;
+    if (!result->init(audioFormat)) {
+        return nullptr;
+    }
+    if (attachmentReader) {
+        auto source = result.get();
+        result->m_isDataAvailableSignaled =
+            attachmentReader->setDataAvailableCallback([source]() { source->signalDataAvailable(); });
     }
-    return nullptr;
+    return result;
 };
 
 AttachmentReaderSource::~AttachmentReaderSource() {
@@ -59,7 +61,8 @@ AttachmentReaderSource::AttachmentReaderSource(
     PipelineInterface* pipeline,
     std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> reader) :
         BaseStreamSource{pipeline, "AttachmentReaderSource"},
-        m_reader{reader} {};
+        m_reader{reader},
+        m_isDataAvailableSignaled{false} {};
 
 bool AttachmentReaderSource::isPlaybackRemote() const {
     return false;
@@ -71,6 +74,10 @@ bool AttachmentReaderSource::isOpen() {
 
 void AttachmentReaderSource::close() {
     if (m_reader) {
+        if (m_isDataAvailableSignaled) {
+            m_reader->setDataAvailableCallback(nullptr);
+            m_isDataAvailableSignaled = false;
+        }
         m_reader->close();
     }
     m_reader.reset();
@@ -82,10 +89,10 @@ gboolean AttachmentReaderSource::handleReadData() {
         return false;
     }
 
-    auto buffer = gst_buffer_new_allocate(nullptr, CHUNK_SIZE, nullptr);
+    auto buffer = acquireChunkBuffer();
 
     if (!buffer) {
-        ACSDK_ERROR(LX("handleReadDataFailed").d("reason", "gstBufferNewAllocateFailed"));
+        ACSDK_ERROR(LX("handleReadDataFailed").d("reason", "acquireChunkBufferFailed"));
         signalEndOfData();
         return false;
     }
@@ -98,6 +105,7 @@ gboolean AttachmentReaderSource::handleReadData() {
         return false;
     }
 
+    auto signalCount = getDataAvailableSignalCount();
     auto status = AttachmentReader::ReadStatus::OK;
     auto size = m_reader->read(info.data, info.size, &status, std::chrono::milliseconds(1));
 
@@ -130,6 +138,9 @@ gboolean AttachmentReaderSource::handleReadData() {
                 }
             } else {
                 gst_buffer_unref(buffer);
+                if (m_isDataAvailableSignaled) {
+                    return waitForDataAvailable(signalCount);
+                }
                 updateOnReadDataHandler();
             }
             return true;
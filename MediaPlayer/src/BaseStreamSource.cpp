@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+#include <chrono>
 #include <cstring>
 
 #include <AVSCommon/Utils/Logger/Logger.h>
@@ -40,6 +42,40 @@ static const std::string TAG("BaseStreamSource");
 /// The interval to wait (in milliseconds) between successive attempts to read audio data when none is available.
 static const guint RETRY_INTERVALS_MILLISECONDS[] = {0, 10, 10, 10, 20, 20, 50, 100};
 
+/// The smallest chunk of data pushed to the @c appsrc element, and the unit in which chunk sizes are rounded up.
+static const gsize MIN_CHUNK_SIZE = 4096;
+
+/// The largest chunk of data pushed to the @c appsrc element.
+static const gsize MAX_CHUNK_SIZE = 64 * 1024;
+
+/// The duration of the audio a chunk should hold, once the bitrate of the stream is known.
+static const std::chrono::milliseconds CHUNK_DURATION(100);
+
+/// The number of bits in a byte.
+static const unsigned int BITS_PER_BYTE = 8;
+
+/**
+ * Creates an active pool of buffers.
+ *
+ * @param size The size of the buffers.
+ * @return The pool, or @c nullptr if it could not be created.
+ */
+static GstBufferPool* createBufferPool(gsize size) {
+    auto pool = gst_buffer_pool_new();
+    if (!pool) {
+        return nullptr;
+    }
+    auto config = gst_buffer_pool_get_config(pool);
+    // No minimum and no maximum: buffers are allocated as needed, and reused once the pipeline releases them.
+    gst_buffer_pool_config_set_params(config, nullptr, size, 0, 0);
+    if (!gst_buffer_pool_set_config(pool, config) || !gst_buffer_pool_set_active(pool, TRUE)) {
+        ACSDK_ERROR(LX("createBufferPoolFailed").d("size", size));
+        gst_object_unref(pool);
+        return nullptr;
+    }
+    return pool;
+}
+
 /**
  * Method that returns a string to be used in CAPS negotiation (generating right PADS between gstreamer elements based
  * on audio data.) For raw PCM data without header audioFormat information needs to be passed explicitly for a
@@ -94,7 +130,14 @@ BaseStreamSource::BaseStreamSource(PipelineInterface* pipeline, const std::strin
         m_enoughDataHandlerId{0},
         m_seekDataHandlerId{0},
         m_needDataCallbackId{0},
-        m_enoughDataCallbackId{0} {
+        m_enoughDataCallbackId{0},
+        m_handleDataAvailableFunction{[this]() { return handleDataAvailable(); }},
+        m_dataAvailableCallbackId{0},
+        m_dataAvailableSignalCount{0},
+        m_isWaitingForData{false},
+        m_chunkSize{MIN_CHUNK_SIZE},
+        m_bufferPool{nullptr},
+        m_bufferPoolChunkSize{0} {
 }
 
 BaseStreamSource::~BaseStreamSource() {
@@ -121,12 +164,20 @@ BaseStreamSource::~BaseStreamSource() {
         if (m_enoughDataCallbackId && !g_source_remove(m_enoughDataCallbackId)) {
             ACSDK_ERROR(LX("gSourceRemove failed for m_enoughDataCallbackId"));
         }
+        if (m_dataAvailableCallbackId && !g_source_remove(m_dataAvailableCallbackId)) {
+            ACSDK_ERROR(LX("gSourceRemove failed for m_dataAvailableCallbackId"));
+        }
     }
     uninstallOnReadDataHandler();
+    releaseBufferPool();
 }
 
 bool BaseStreamSource::init(const AudioFormat* audioFormat) {
-    auto appsrc = reinterpret_cast<GstAppSrc*>(gst_element_factory_make("appsrc", "src"));
+    /*
+     * The elements are left to be named by GStreamer: the MediaPlayer may hold a second source, prepared to play after
+     * this one, in the same pipeline, and element names must be unique within it.
+     */
+    auto appsrc = reinterpret_cast<GstAppSrc*>(gst_element_factory_make("appsrc", nullptr));
     if (!appsrc) {
         ACSDK_ERROR(LX("initFailed").d("reason", "createSourceElementFailed"));
         return false;
@@ -144,11 +195,12 @@ bool BaseStreamSource::init(const AudioFormat* audioFormat) {
         }
         gst_app_src_set_caps(GST_APP_SRC(appsrc), audioCaps);
         g_object_set(G_OBJECT(appsrc), "format", GST_FORMAT_TIME, NULL);
+        setBitrate(audioFormat->sampleRateHz * audioFormat->sampleSizeInBits * audioFormat->numChannels);
     } else {
         ACSDK_DEBUG9(LX("initNoAudioFormat"));
     }
 
-    auto decoder = gst_element_factory_make("decodebin", "decoder");
+    auto decoder = gst_element_factory_make("decodebin", nullptr);
     if (!decoder) {
         ACSDK_ERROR(LX("initFailed").d("reason", "createDecoderElementFailed"));
         return false;
@@ -216,6 +268,12 @@ bool BaseStreamSource::init(const AudioFormat* audioFormat) {
     return true;
 }
 
+void BaseStreamSource::setPipeline(PipelineInterface* pipeline) {
+    // The signal handlers queue callbacks through m_pipeline on the streaming thread while holding this lock.
+    std::lock_guard<std::mutex> lock(m_callbackIdMutex);
+    m_pipeline = pipeline;
+}
+
 GstAppSrc* BaseStreamSource::getAppSrc() const {
     if (!m_pipeline) {
         return nullptr;
@@ -233,6 +291,7 @@ void BaseStreamSource::signalEndOfData() {
     }
     ACSDK_DEBUG9(LX("gstAppSrcEndOfStreamSuccess"));
     clearOnReadDataHandler();
+    m_pipeline->notifyEndOfData();
 }
 
 void BaseStreamSource::installOnReadDataHandler() {
@@ -289,6 +348,87 @@ void BaseStreamSource::clearOnReadDataHandler() {
     m_sourceId = 0;
 }
 
+gsize BaseStreamSource::getChunkSize() const {
+    return m_chunkSize;
+}
+
+void BaseStreamSource::setBitrate(unsigned int bitsPerSecond) {
+    if (0 == bitsPerSecond) {
+        return;
+    }
+    gsize chunkSize = gst_util_uint64_scale(bitsPerSecond / BITS_PER_BYTE, CHUNK_DURATION.count(), 1000);
+    chunkSize = (chunkSize + MIN_CHUNK_SIZE - 1) / MIN_CHUNK_SIZE * MIN_CHUNK_SIZE;
+    chunkSize = std::min(std::max(chunkSize, MIN_CHUNK_SIZE), MAX_CHUNK_SIZE);
+    if (chunkSize != m_chunkSize) {
+        ACSDK_DEBUG5(LX("setBitrate").d("bitsPerSecond", bitsPerSecond).d("chunkSize", chunkSize));
+        m_chunkSize = chunkSize;
+    }
+}
+
+GstBuffer* BaseStreamSource::acquireChunkBuffer() {
+    if (!m_bufferPool || m_bufferPoolChunkSize != m_chunkSize) {
+        releaseBufferPool();
+        m_bufferPool = createBufferPool(m_chunkSize);
+        m_bufferPoolChunkSize = m_chunkSize;
+    }
+    GstBuffer* buffer = nullptr;
+    if (m_bufferPool && GST_FLOW_OK == gst_buffer_pool_acquire_buffer(m_bufferPool, &buffer, nullptr)) {
+        // A recycled buffer may still be trimmed to the size of the last chunk read into it.
+        gst_buffer_set_size(buffer, m_bufferPoolChunkSize);
+        return buffer;
+    }
+    ACSDK_WARN(LX("acquireChunkBuffer").d("reason", "bufferPoolUnavailable").d("action", "allocateBuffer"));
+    return gst_buffer_new_allocate(nullptr, m_chunkSize, nullptr);
+}
+
+void BaseStreamSource::releaseBufferPool() {
+    if (m_bufferPool) {
+        gst_buffer_pool_set_active(m_bufferPool, FALSE);
+        gst_object_unref(m_bufferPool);
+        m_bufferPool = nullptr;
+    }
+}
+
+void BaseStreamSource::signalDataAvailable() {
+    ++m_dataAvailableSignalCount;
+    if (!m_isWaitingForData.exchange(false)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_callbackIdMutex);
+    if (!m_dataAvailableCallbackId) {
+        m_dataAvailableCallbackId = m_pipeline->queueCallback(&m_handleDataAvailableFunction);
+    }
+}
+
+uint64_t BaseStreamSource::getDataAvailableSignalCount() const {
+    return m_dataAvailableSignalCount;
+}
+
+gboolean BaseStreamSource::waitForDataAvailable(uint64_t signalCountBeforeRead) {
+    /*
+     * Start waiting before checking for a signal: a signal which comes after the check then finds the read loop
+     * waiting, and resumes it.
+     */
+    m_isWaitingForData = true;
+    if (m_dataAvailableSignalCount != signalCountBeforeRead) {
+        ACSDK_DEBUG9(LX("waitForDataAvailable").d("action", "readAgain"));
+        m_isWaitingForData = false;
+        return true;
+    }
+    ACSDK_DEBUG9(LX("waitForDataAvailable").d("action", "stopReadLoop").d("sourceId", m_sourceId));
+    // Returning false removes the onReadData() handler.
+    clearOnReadDataHandler();
+    return false;
+}
+
+gboolean BaseStreamSource::handleDataAvailable() {
+    ACSDK_DEBUG9(LX("handleDataAvailableCalled"));
+    std::lock_guard<std::mutex> lock(m_callbackIdMutex);
+    m_dataAvailableCallbackId = 0;
+    installOnReadDataHandler();
+    return false;
+}
+
 void BaseStreamSource::onNeedData(GstElement* pipeline, guint size, gpointer pointer) {
     ACSDK_DEBUG9(LX("onNeedDataCalled").d("size", size));
     auto source = static_cast<BaseStreamSource*>(pointer);
@@ -323,6 +463,12 @@ gboolean BaseStreamSource::handleEnoughData() {
     ACSDK_DEBUG9(LX("handleEnoughDataCalled"));
     std::lock_guard<std::mutex> lock(m_callbackIdMutex);
     m_enoughDataCallbackId = 0;
+    // The read loop stays stopped until the next need-data, even if data becomes available in the meantime.
+    m_isWaitingForData = false;
+    if (m_dataAvailableCallbackId) {
+        g_source_remove(m_dataAvailableCallbackId);
+        m_dataAvailableCallbackId = 0;
+    }
     uninstallOnReadDataHandler();
     return false;
 }
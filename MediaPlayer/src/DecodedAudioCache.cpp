@@ -0,0 +1,317 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <iterator>
+
+#include <gst/gst.h>
+#include <gst/app/gstappsink.h>
+#include <gst/app/gstappsrc.h>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+#include "MediaPlayer/DecodedAudioCache.h"
+
+namespace alexaClientSDK {
+namespace mediaPlayer {
+
+using namespace avsCommon::utils;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("DecodedAudioCache");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The pipeline which decodes a sound.  The sink does not sync to the clock, so the sound is decoded at full speed.
+static const char* DECODE_PIPELINE_DESCRIPTION =
+    "appsrc name=src ! decodebin ! audioconvert ! audio/x-raw,format=S16LE,layout=interleaved ! "
+    "appsink name=sink sync=false";
+
+/// The size of a decoded sample.
+static const unsigned int SAMPLE_SIZE_IN_BITS = 16;
+
+/// The longest time to wait for a sound to be decoded.
+static const GstClockTime DECODE_TIMEOUT = 10 * GST_SECOND;
+
+const size_t DecodedAudioCache::DEFAULT_MAX_CACHED_BYTES = 32 * 1024 * 1024;
+
+/// The state of the decoding of a sound, shared with the streaming thread of the decode pipeline.
+struct DecodeState {
+    /// The decoded audio.
+    std::shared_ptr<DecodedAudioCache::DecodedAudio> audio;
+
+    /// The largest size of decoded audio to accept.
+    size_t maxBytes;
+
+    /// Whether the decoded audio outgrew @c maxBytes, or came in a format which could not be read.
+    bool failed;
+};
+
+/**
+ * Reads the sample rate and channels of the decoded audio from the caps of its first sample.
+ *
+ * @param sample The first sample.
+ * @param[out] format The format to complete.
+ * @return Whether the format could be read.
+ */
+static bool readFormat(GstSample* sample, AudioFormat* format) {
+    auto caps = gst_sample_get_caps(sample);
+    if (!caps || gst_caps_get_size(caps) < 1) {
+        return false;
+    }
+    auto structure = gst_caps_get_structure(caps, 0);
+    gint rate = 0;
+    gint channels = 0;
+    if (!gst_structure_get_int(structure, "rate", &rate) || !gst_structure_get_int(structure, "channels", &channels) ||
+        rate <= 0 || channels <= 0) {
+        return false;
+    }
+    format->encoding = AudioFormat::Encoding::LPCM;
+    format->endianness = AudioFormat::Endianness::LITTLE;
+    format->sampleRateHz = rate;
+    format->sampleSizeInBits = SAMPLE_SIZE_IN_BITS;
+    format->numChannels = channels;
+    format->dataSigned = true;
+    format->layout = AudioFormat::Layout::INTERLEAVED;
+    return true;
+}
+
+/**
+ * Appends a decoded sample to the decoded audio.  This is called on the streaming thread of the decode pipeline.
+ *
+ * @param appSink The sink of the decode pipeline.
+ * @param pointer The @c DecodeState.
+ * @return @c GST_FLOW_OK to go on decoding, or @c GST_FLOW_EOS to stop.
+ */
+static GstFlowReturn onNewSample(GstAppSink* appSink, gpointer pointer) {
+    auto state = static_cast<DecodeState*>(pointer);
+    auto sample = gst_app_sink_pull_sample(appSink);
+    if (!sample) {
+        return GST_FLOW_EOS;
+    }
+    if (state->audio->samples.empty() && !readFormat(sample, &state->audio->format)) {
+        ACSDK_ERROR(LX("decodeFailed").d("reason", "unreadableFormat"));
+        state->failed = true;
+    }
+    auto buffer = gst_sample_get_buffer(sample);
+    GstMapInfo info;
+    if (!state->failed && buffer && gst_buffer_map(buffer, &info, GST_MAP_READ)) {
+        if (state->audio->samples.size() + info.size > state->maxBytes) {
+            state->failed = true;
+        } else {
+            state->audio->samples.insert(state->audio->samples.end(), info.data, info.data + info.size);
+        }
+        gst_buffer_unmap(buffer, &info);
+    }
+    gst_sample_unref(sample);
+    if (state->failed) {
+        // Stopping the flow does not reach the bus, so wake the thread waiting for the decoding to end.
+        gst_element_post_message(GST_ELEMENT(appSink), gst_message_new_eos(GST_OBJECT(appSink)));
+        return GST_FLOW_EOS;
+    }
+    return GST_FLOW_OK;
+}
+
+std::shared_ptr<DecodedAudioCache> DecodedAudioCache::create(size_t maxCachedBytes) {
+    if (!gst_init_check(nullptr, nullptr, nullptr)) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "gstInitCheckFailed"));
+        return nullptr;
+    }
+    return std::shared_ptr<DecodedAudioCache>(new DecodedAudioCache(maxCachedBytes));
+}
+
+DecodedAudioCache::DecodedAudioCache(size_t maxCachedBytes) : m_maxCachedBytes{maxCachedBytes}, m_cachedBytes{0} {
+}
+
+DecodedAudioCache::~DecodedAudioCache() {
+    m_executor.shutdown();
+}
+
+std::shared_ptr<const DecodedAudioCache::DecodedAudio> DecodedAudioCache::get(std::istream& stream) {
+    std::string encoded{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+    stream.clear();
+    stream.seekg(0);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_sounds.find(encoded);
+        if (it != m_sounds.end()) {
+            ACSDK_DEBUG9(LX("get")
+                             .d("size", encoded.size())
+                             .d("hit", it->second.audio != nullptr)
+                             .d("failed", it->second.failed));
+            return it->second.audio;
+        }
+        if (!addPendingSoundLocked(encoded)) {
+            return nullptr;
+        }
+    }
+    ACSDK_DEBUG5(LX("get").d("size", encoded.size()).d("action", "decodeInBackground"));
+    m_executor.submit([this, encoded]() { executeDecode(encoded); });
+    return nullptr;
+}
+
+std::future<bool> DecodedAudioCache::prefetch(std::function<std::unique_ptr<std::istream>()> streamFunction) {
+    return m_executor.submit([this, streamFunction]() {
+        auto stream = streamFunction ? streamFunction() : nullptr;
+        if (!stream) {
+            ACSDK_ERROR(LX("prefetchFailed").d("reason", "nullStream"));
+            return false;
+        }
+        std::string encoded{std::istreambuf_iterator<char>(*stream), std::istreambuf_iterator<char>()};
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_sounds.find(encoded);
+            if (it != m_sounds.end()) {
+                // Decoding runs on m_executor, so any earlier decode of this sound has already finished.
+                return it->second.audio != nullptr;
+            }
+            if (!addPendingSoundLocked(encoded)) {
+                return false;
+            }
+        }
+        return executeDecode(encoded);
+    });
+}
+
+size_t DecodedAudioCache::getCachedBytes() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_cachedBytes;
+}
+
+std::shared_ptr<const DecodedAudioCache::DecodedAudio> DecodedAudioCache::decode(
+    const std::string& encoded,
+    size_t maxBytes) {
+    if (encoded.empty()) {
+        ACSDK_ERROR(LX("decodeFailed").d("reason", "emptyAudio"));
+        return nullptr;
+    }
+
+    GError* error = nullptr;
+    auto pipeline = gst_parse_launch(DECODE_PIPELINE_DESCRIPTION, &error);
+    if (!pipeline || error) {
+        ACSDK_ERROR(LX("decodeFailed").d("reason", "gstParseLaunchFailed").d("error", error ? error->message : ""));
+        if (error) {
+            g_error_free(error);
+        }
+        if (pipeline) {
+            gst_object_unref(pipeline);
+        }
+        return nullptr;
+    }
+    auto appSrc = gst_bin_get_by_name(GST_BIN(pipeline), "src");
+    auto appSink = gst_bin_get_by_name(GST_BIN(pipeline), "sink");
+    auto bus = gst_element_get_bus(pipeline);
+
+    DecodeState state{std::make_shared<DecodedAudio>(), maxBytes, false};
+    GstAppSinkCallbacks callbacks = {};
+    callbacks.new_sample = onNewSample;
+    gst_app_sink_set_callbacks(GST_APP_SINK(appSink), &callbacks, &state, nullptr);
+
+    auto buffer = gst_buffer_new_allocate(nullptr, encoded.size(), nullptr);
+    gst_buffer_fill(buffer, 0, encoded.data(), encoded.size());
+    gst_app_src_push_buffer(GST_APP_SRC(appSrc), buffer);
+    gst_app_src_end_of_stream(GST_APP_SRC(appSrc));
+
+    bool succeeded = false;
+    if (GST_STATE_CHANGE_FAILURE == gst_element_set_state(pipeline, GST_STATE_PLAYING)) {
+        ACSDK_ERROR(LX("decodeFailed").d("reason", "setStatePlayingFailed"));
+    } else {
+        auto message = gst_bus_timed_pop_filtered(
+            bus, DECODE_TIMEOUT, static_cast<GstMessageType>(GST_MESSAGE_EOS | GST_MESSAGE_ERROR));
+        if (!message) {
+            ACSDK_ERROR(LX("decodeFailed").d("reason", "timedOut"));
+        } else if (GST_MESSAGE_ERROR == GST_MESSAGE_TYPE(message)) {
+            GError* messageError = nullptr;
+            gst_message_parse_error(message, &messageError, nullptr);
+            ACSDK_ERROR(LX("decodeFailed").d("reason", "pipelineError").d("error", messageError->message));
+            g_error_free(messageError);
+        } else {
+            succeeded = true;
+        }
+        if (message) {
+            gst_message_unref(message);
+        }
+    }
+    gst_element_set_state(pipeline, GST_STATE_NULL);
+    gst_object_unref(bus);
+    gst_object_unref(appSink);
+    gst_object_unref(appSrc);
+    gst_object_unref(pipeline);
+
+    if (state.failed) {
+        ACSDK_DEBUG5(LX("decodeFailed").d("reason", "tooLargeOrUnreadable").d("maxBytes", maxBytes));
+        return nullptr;
+    }
+    if (!succeeded || state.audio->samples.empty()) {
+        return nullptr;
+    }
+    state.audio->samples.shrink_to_fit();
+    return state.audio;
+}
+
+bool DecodedAudioCache::addPendingSoundLocked(const std::string& encoded) {
+    if (m_cachedBytes + encoded.size() > m_maxCachedBytes) {
+        ACSDK_WARN(LX("addPendingSoundLocked").d("size", encoded.size()).m("not cached, cache is full"));
+        return false;
+    }
+    m_sounds[encoded] = Sound{nullptr, false};
+    m_cachedBytes += encoded.size();
+    return true;
+}
+
+void DecodedAudioCache::failPendingSoundLocked(const std::string& encoded) {
+    auto it = m_sounds.find(encoded);
+    if (it != m_sounds.end()) {
+        it->second.failed = true;
+    }
+}
+
+bool DecodedAudioCache::executeDecode(const std::string& encoded) {
+    size_t remainingBytes = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        remainingBytes = m_maxCachedBytes > m_cachedBytes ? m_maxCachedBytes - m_cachedBytes : 0;
+    }
+    auto audio = decode(encoded, remainingBytes);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!audio) {
+        ACSDK_WARN(LX("executeDecode").d("size", encoded.size()).m("not cached"));
+        failPendingSoundLocked(encoded);
+        return false;
+    }
+    if (m_cachedBytes + audio->samples.size() > m_maxCachedBytes) {
+        ACSDK_WARN(LX("executeDecode").d("size", encoded.size()).m("not cached, cache is full"));
+        failPendingSoundLocked(encoded);
+        return false;
+    }
+    m_cachedBytes += audio->samples.size();
+    m_sounds[encoded].audio = audio;
+    ACSDK_DEBUG5(LX("executeDecode")
+                     .d("size", encoded.size())
+                     .d("decodedBytes", audio->samples.size())
+                     .d("sampleRateHz", audio->format.sampleRateHz)
+                     .d("numChannels", audio->format.numChannels)
+                     .d("cachedBytes", m_cachedBytes));
+    return true;
+}
+
+}  // namespace mediaPlayer
+}  // namespace alexaClientSDK
@@ -0,0 +1,152 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+#include "MediaPlayer/DecodedAudioSource.h"
+
+namespace alexaClientSDK {
+namespace mediaPlayer {
+
+using namespace avsCommon::utils;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("DecodedAudioSource");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The number of bits in a byte.
+static const unsigned int BITS_PER_BYTE = 8;
+
+/**
+ * Releases the reference to a decoded sound held by a @c GstBuffer wrapping its samples.
+ *
+ * @param pointer The reference, a @c std::shared_ptr<const DecodedAudio> allocated with @c new.
+ */
+static void releaseAudio(gpointer pointer) {
+    delete static_cast<std::shared_ptr<const DecodedAudioCache::DecodedAudio>*>(pointer);
+}
+
+std::unique_ptr<DecodedAudioSource> DecodedAudioSource::create(
+    PipelineInterface* pipeline,
+    std::shared_ptr<const DecodedAudioCache::DecodedAudio> audio,
+    bool repeat) {
+    if (!audio || audio->samples.empty()) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "noAudio"));
+        return nullptr;
+    }
+    std::unique_ptr<DecodedAudioSource> result(new DecodedAudioSource(pipeline, audio, repeat));
+    if (result->init(&audio->format)) {
+        return result;
+    }
+    return nullptr;
+}
+
+DecodedAudioSource::DecodedAudioSource(
+    PipelineInterface* pipeline,
+    std::shared_ptr<const DecodedAudioCache::DecodedAudio> audio,
+    bool repeat) :
+        BaseStreamSource{pipeline, "DecodedAudioSource"},
+        m_audio{audio},
+        m_repeat{repeat},
+        m_offset{0} {
+}
+
+DecodedAudioSource::~DecodedAudioSource() {
+    close();
+}
+
+bool DecodedAudioSource::isPlaybackRemote() const {
+    return false;
+}
+
+bool DecodedAudioSource::hasAdditionalData() {
+    if (!m_repeat) {
+        return false;
+    }
+    m_offset = 0;
+    return true;
+}
+
+bool DecodedAudioSource::isOpen() {
+    return m_audio != nullptr;
+}
+
+void DecodedAudioSource::close() {
+    m_audio.reset();
+}
+
+gboolean DecodedAudioSource::handleReadData() {
+    if (!isOpen()) {
+        ACSDK_ERROR(LX("handleReadDataFailed").d("reason", "audioIsNullPtr"));
+        return false;
+    }
+
+    auto& samples = m_audio->samples;
+    if (m_repeat && m_offset >= samples.size()) {
+        m_offset = 0;
+    }
+    if (m_offset >= samples.size()) {
+        signalEndOfData();
+        return false;
+    }
+
+    auto size = std::min(static_cast<size_t>(getChunkSize()), samples.size() - m_offset);
+    auto buffer = gst_buffer_new_wrapped_full(
+        GST_MEMORY_FLAG_READONLY,
+        const_cast<uint8_t*>(samples.data()),
+        samples.size(),
+        m_offset,
+        size,
+        new std::shared_ptr<const DecodedAudioCache::DecodedAudio>(m_audio),
+        releaseAudio);
+    if (!buffer) {
+        ACSDK_ERROR(LX("handleReadDataFailed").d("reason", "gstBufferNewWrappedFullFailed"));
+        signalEndOfData();
+        return false;
+    }
+    m_offset += size;
+
+    installOnReadDataHandler();
+    auto flowRet = gst_app_src_push_buffer(getAppSrc(), buffer);
+    if (flowRet != GST_FLOW_OK) {
+        ACSDK_ERROR(
+            LX("handleReadDataFailed").d("reason", "gstAppSrcPushBufferFailed").d("error", gst_flow_get_name(flowRet)));
+        return false;
+    }
+    return true;
+}
+
+gboolean DecodedAudioSource::handleSeekData(guint64 offset) {
+    if (!isOpen()) {
+        return false;
+    }
+    // The source pushes audio in GST_FORMAT_TIME, so the offset is in nanoseconds.
+    auto& format = m_audio->format;
+    size_t frameSize = format.numChannels * format.sampleSizeInBits / BITS_PER_BYTE;
+    auto frames = gst_util_uint64_scale(offset, format.sampleRateHz, GST_SECOND);
+    m_offset = std::min(static_cast<size_t>(frames * frameSize), m_audio->samples.size());
+    return true;
+}
+
+}  // namespace mediaPlayer
+}  // namespace alexaClientSDK
@@ -37,9 +37,6 @@ static const std::string TAG("IStreamSource");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-/// The number of bytes read from the attachment with each read in the read loop.
-static const unsigned int CHUNK_SIZE(4096);
-
 std::unique_ptr<IStreamSource> IStreamSource::create(
     PipelineInterface* pipeline,
     std::shared_ptr<std::istream> stream,
@@ -87,10 +84,10 @@ gboolean IStreamSource::handleReadData() {
         return false;
     }
 
-    auto buffer = gst_buffer_new_allocate(nullptr, CHUNK_SIZE, nullptr);
+    auto buffer = acquireChunkBuffer();
 
     if (!buffer) {
-        ACSDK_ERROR(LX("handleReadDataFailed").d("reason", "gstBufferNewAllocateFailed"));
+        ACSDK_ERROR(LX("handleReadDataFailed").d("reason", "acquireChunkBufferFailed"));
         signalEndOfData();
         return false;
     }
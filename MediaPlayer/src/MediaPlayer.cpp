@@ -25,6 +25,7 @@
 #include <PlaylistParser/UrlContentToAttachmentConverter.h>
 
 #include "MediaPlayer/AttachmentReaderSource.h"
+#include "MediaPlayer/DecodedAudioSource.h"
 #include "MediaPlayer/ErrorTypeConversion.h"
 #include "MediaPlayer/IStreamSource.h"
 #include "MediaPlayer/Normalizer.h"
@@ -91,6 +92,18 @@ static const int8_t GST_ADJUST_VOLUME_MAX = 1;
 /// Represents the zero volume to avoid the actual 0.0 value. Used as a fix for GStreamer crashing on 0 volume for PCM.
 static const gdouble VOLUME_ZERO = 0.0000001;
 
+/// The name template of the request sink pads of the concat element.
+static const char* CONCAT_SINK_PAD_TEMPLATE = "sink_%u";
+
+/**
+ * Deletes a callback queued with @c g_idle_add_full() once the main loop is done with it.
+ *
+ * @param callback The @c std::function<gboolean()> to delete.
+ */
+static void destroyCallback(gpointer callback) {
+    delete static_cast<std::function<gboolean()>*>(callback);
+}
+
 /**
  * Processes tags found in the tagList.
  * Called through gst_tag_list_foreach.
@@ -141,12 +154,33 @@ static void collectOneTag(const GstTagList* tagList, const gchar* tag, gpointer
     }
 }
 
+/**
+ * Reads the bitrate of the stream from a tag message.
+ *
+ * @param message The tag message.
+ * @return The bitrate, in bits per second, or zero if the message does not carry one.
+ */
+static guint getBitrate(GstMessage* message) {
+    GstTagList* tags = nullptr;
+    gst_message_parse_tag(message, &tags);
+    if (!tags) {
+        return 0;
+    }
+    guint bitrate = 0;
+    if (!gst_tag_list_get_uint(tags, GST_TAG_BITRATE, &bitrate)) {
+        gst_tag_list_get_uint(tags, GST_TAG_NOMINAL_BITRATE, &bitrate);
+    }
+    gst_tag_list_unref(tags);
+    return bitrate;
+}
+
 std::shared_ptr<MediaPlayer> MediaPlayer::create(
     std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory,
     SpeakerInterface::Type type,
-    std::string name) {
+    std::string name,
+    std::shared_ptr<DecodedAudioCache> decodedAudioCache) {
     ACSDK_DEBUG9(LX("createCalled"));
-    std::shared_ptr<MediaPlayer> mediaPlayer(new MediaPlayer(contentFetcherFactory, type, name));
+    std::shared_ptr<MediaPlayer> mediaPlayer(new MediaPlayer(contentFetcherFactory, type, name, decodedAudioCache));
     if (mediaPlayer->init()) {
         return mediaPlayer;
     } else {
@@ -212,6 +246,50 @@ MediaPlayer::SourceId MediaPlayer::setSource(const std::string& url, std::chrono
     return ERROR_SOURCE_ID;
 }
 
+MediaPlayer::SourceId MediaPlayer::prepareNextSource(const std::string& url) {
+    ACSDK_DEBUG9(LX("prepareNextSourceForUrlCalled").sensitive("url", url));
+    std::promise<MediaPlayer::SourceId> promise;
+    auto future = promise.get_future();
+    std::function<gboolean()> callback = [this, url, &promise]() {
+        handlePrepareNextUrlSource(url, &promise);
+        return false;
+    };
+    if (queueCallback(&callback) != UNQUEUED_CALLBACK) {
+        return future.get();
+    }
+    return ERROR_SOURCE_ID;
+}
+
+MediaPlayer::SourceId MediaPlayer::prepareNextSource(
+    std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> reader,
+    const avsCommon::utils::AudioFormat* audioFormat) {
+    ACSDK_DEBUG9(LX("prepareNextSourceCalled").d("sourceType", "AttachmentReader"));
+    std::promise<MediaPlayer::SourceId> promise;
+    auto future = promise.get_future();
+    std::function<gboolean()> callback = [this, &reader, &promise, audioFormat]() {
+        handlePrepareNextAttachmentReaderSource(std::move(reader), &promise, audioFormat);
+        return false;
+    };
+    if (queueCallback(&callback) != UNQUEUED_CALLBACK) {
+        return future.get();
+    }
+    return ERROR_SOURCE_ID;
+}
+
+bool MediaPlayer::cancelNextSource() {
+    ACSDK_DEBUG9(LX("cancelNextSourceCalled"));
+    std::promise<bool> promise;
+    auto future = promise.get_future();
+    std::function<gboolean()> callback = [this, &promise]() {
+        handleCancelNextSource(&promise);
+        return false;
+    };
+    if (queueCallback(&callback) != UNQUEUED_CALLBACK) {
+        return future.get();
+    }
+    return false;
+}
+
 uint64_t MediaPlayer::getNumBytesBuffered() {
     ACSDK_DEBUG9(LX("getNumBytesBuffered"));
     if (m_pipeline.appsrc) {
@@ -528,21 +606,75 @@ GstElement* MediaPlayer::getPipeline() const {
     return m_pipeline.pipeline;
 }
 
+void MediaPlayer::notifyEndOfData() {
+    sendPlaybackNearlyFinished();
+}
+
+MediaPlayer::NextSourcePipeline::NextSourcePipeline(MediaPlayer* mediaPlayer, SourceId id) :
+        m_mediaPlayer{mediaPlayer},
+        m_id{id},
+        m_appSrc{nullptr},
+        m_decoder{nullptr},
+        m_isEndOfData{false} {
+}
+
+void MediaPlayer::NextSourcePipeline::setAppSrc(GstAppSrc* appSrc) {
+    m_appSrc = appSrc;
+}
+
+GstAppSrc* MediaPlayer::NextSourcePipeline::getAppSrc() const {
+    return m_appSrc;
+}
+
+void MediaPlayer::NextSourcePipeline::setDecoder(GstElement* decoder) {
+    m_decoder = decoder;
+}
+
+GstElement* MediaPlayer::NextSourcePipeline::getDecoder() const {
+    return m_decoder;
+}
+
+GstElement* MediaPlayer::NextSourcePipeline::getPipeline() const {
+    return m_mediaPlayer->getPipeline();
+}
+
+guint MediaPlayer::NextSourcePipeline::queueCallback(const std::function<gboolean()>* callback) {
+    return m_mediaPlayer->queueCallback(callback);
+}
+
+void MediaPlayer::NextSourcePipeline::notifyEndOfData() {
+    m_isEndOfData = true;
+}
+
+void MediaPlayer::NextSourcePipeline::onError() {
+    m_mediaPlayer->onSourceError(m_id);
+}
+
+bool MediaPlayer::NextSourcePipeline::isEndOfData() const {
+    return m_isEndOfData;
+}
+
 MediaPlayer::MediaPlayer(
     std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory,
     SpeakerInterface::Type type,
-    std::string name) :
+    std::string name,
+    std::shared_ptr<DecodedAudioCache> decodedAudioCache) :
         RequiresShutdown{name},
         m_lastVolume{GST_SET_VOLUME_MAX},
         m_isMuted{false},
         m_contentFetcherFactory{contentFetcherFactory},
+        m_decodedAudioCache{decodedAudioCache},
         m_speakerType{type},
         m_playbackStartedSent{false},
         m_playbackFinishedSent{false},
+        m_playbackNearlyFinishedSent{false},
         m_isPaused{false},
         m_isBufferUnderrun{false},
         m_playerObserver{nullptr},
         m_currentId{ERROR},
+        m_concatPad{nullptr},
+        m_nextId{ERROR},
+        m_nextConcatPad{nullptr},
         m_playPending{false},
         m_pausePending{false},
         m_resumePending{false},
@@ -707,6 +839,7 @@ void MediaPlayer::tearDownTransientPipelineElements() {
     m_pauseImmediately = false;
     m_playbackStartedSent = false;
     m_playbackFinishedSent = false;
+    m_playbackNearlyFinishedSent = false;
     m_isPaused = false;
     m_isBufferUnderrun = false;
     if (m_pipeline.audioSink) {
@@ -720,6 +853,7 @@ void MediaPlayer::resetPipeline() {
     m_pipeline.pipeline = nullptr;
     m_pipeline.appsrc = nullptr;
     m_pipeline.decoder = nullptr;
+    m_pipeline.concat = nullptr;
     m_pipeline.converter = nullptr;
     m_pipeline.volume = nullptr;
     m_pipeline.resample = nullptr;
@@ -796,6 +930,10 @@ void MediaPlayer::doShutdown() {
         m_urlConverter->shutdown();
     }
     m_urlConverter.reset();
+    if (m_nextUrlConverter) {
+        m_nextUrlConverter->shutdown();
+    }
+    m_nextUrlConverter.reset();
     m_playerObserver.reset();
 }
 
@@ -819,10 +957,138 @@ void MediaPlayer::onPadAdded(GstElement* decoder, GstPad* pad, gpointer pointer)
 
 void MediaPlayer::handlePadAdded(std::promise<void>* promise, GstElement* decoder, GstPad* pad) {
     ACSDK_DEBUG9(LX("handlePadAddedSignalCalled"));
-    gst_element_link(decoder, m_pipeline.converter);
+    GstPad* concatPad = nullptr;
+    if (decoder == m_pipeline.decoder) {
+        if (!m_pipeline.concat) {
+            gst_element_link(decoder, m_pipeline.converter);
+            promise->set_value();
+            return;
+        }
+        concatPad = m_concatPad;
+    } else if (m_nextPipeline && decoder == m_nextPipeline->getDecoder()) {
+        concatPad = m_nextConcatPad;
+    }
+    if (!concatPad) {
+        ACSDK_WARN(LX("handlePadAddedFailed").d("reason", "decoderNotLinkedToConcat"));
+    } else if (gst_pad_is_linked(concatPad)) {
+        ACSDK_DEBUG9(LX("handlePadAdded").m("concat pad already linked"));
+    } else if (GST_PAD_LINK_FAILED(gst_pad_link(pad, concatPad))) {
+        ACSDK_ERROR(LX("handlePadAddedFailed").d("reason", "linkDecoderToConcatFailed"));
+    }
     promise->set_value();
 }
 
+GstPad* MediaPlayer::requestConcatPad() {
+    auto pad = gst_element_get_request_pad(m_pipeline.concat, CONCAT_SINK_PAD_TEMPLATE);
+    if (!pad) {
+        ACSDK_ERROR(LX("requestConcatPadFailed").d("reason", "gstElementGetRequestPadFailed"));
+    }
+    return pad;
+}
+
+bool MediaPlayer::insertConcat() {
+    m_pipeline.concat = gst_element_factory_make("concat", "concat");
+    if (!m_pipeline.concat) {
+        ACSDK_ERROR(LX("insertConcatFailed").d("reason", "createConcatElementFailed"));
+        return false;
+    }
+    gst_bin_add(GST_BIN(m_pipeline.pipeline), m_pipeline.concat);
+
+    m_concatPad = requestConcatPad();
+    if (!m_concatPad) {
+        ACSDK_ERROR(LX("insertConcatFailed").d("reason", "requestConcatPadFailed"));
+        removeConcat();
+        return false;
+    }
+
+    auto converterPad = gst_element_get_static_pad(m_pipeline.converter, "sink");
+    auto decoderPad = gst_pad_get_peer(converterPad);
+    gst_object_unref(converterPad);
+    if (!decoderPad) {
+        // The decoder has not added its pad yet, so handlePadAdded() will link it to m_concatPad.
+        if (!gst_element_link(m_pipeline.concat, m_pipeline.converter) ||
+            !gst_element_sync_state_with_parent(m_pipeline.concat)) {
+            ACSDK_ERROR(LX("insertConcatFailed").d("reason", "linkConcatToConverterFailed"));
+            removeConcat();
+            return false;
+        }
+        return true;
+    }
+
+    /*
+     * The concat element moves on to its next sink pad when the current one reaches the end of its stream.  If that
+     * has already happened, the pipeline is ending and would never switch to the prepared source.
+     */
+    if (GST_PAD_IS_EOS(decoderPad)) {
+        ACSDK_ERROR(LX("insertConcatFailed").d("reason", "currentSourceEnded"));
+        gst_object_unref(decoderPad);
+        removeConcat();
+        return false;
+    }
+
+    if (!gst_element_sync_state_with_parent(m_pipeline.concat)) {
+        ACSDK_ERROR(LX("insertConcatFailed").d("reason", "syncStateWithPipelineFailed"));
+        gst_object_unref(decoderPad);
+        removeConcat();
+        return false;
+    }
+
+    // The decoder is relinked through the concat element between two buffers, so no data of the current source is lost.
+    gst_pad_add_probe(
+        decoderPad,
+        GST_PAD_PROBE_TYPE_IDLE,
+        &MediaPlayer::onDecoderPadIdle,
+        gst_object_ref(m_concatPad),
+        reinterpret_cast<GDestroyNotify>(&gst_object_unref));
+    gst_object_unref(decoderPad);
+    return true;
+}
+
+GstPadProbeReturn MediaPlayer::onDecoderPadIdle(GstPad* decoderPad, GstPadProbeInfo* info, gpointer concatPad) {
+    auto converterPad = gst_pad_get_peer(decoderPad);
+    auto concat = gst_pad_get_parent_element(static_cast<GstPad*>(concatPad));
+    if (!converterPad || !concat) {
+        ACSDK_ERROR(LX("onDecoderPadIdleFailed").d("reason", "padsNoLongerLinked"));
+    } else {
+        auto concatSrcPad = gst_element_get_static_pad(concat, "src");
+        gst_pad_unlink(decoderPad, converterPad);
+        if (GST_PAD_LINK_FAILED(gst_pad_link(concatSrcPad, converterPad)) ||
+            GST_PAD_LINK_FAILED(gst_pad_link(decoderPad, static_cast<GstPad*>(concatPad)))) {
+            ACSDK_ERROR(LX("onDecoderPadIdleFailed").d("reason", "linkThroughConcatFailed"));
+        }
+        gst_object_unref(concatSrcPad);
+    }
+    if (converterPad) {
+        gst_object_unref(converterPad);
+    }
+    if (concat) {
+        gst_object_unref(concat);
+    }
+    return GST_PAD_PROBE_REMOVE;
+}
+
+void MediaPlayer::removeConcat() {
+    if (!m_pipeline.concat) {
+        return;
+    }
+    releaseConcatPad(&m_concatPad);
+    gst_element_set_state(m_pipeline.concat, GST_STATE_NULL);
+    gst_element_unlink(m_pipeline.concat, m_pipeline.converter);
+    gst_bin_remove(GST_BIN(m_pipeline.pipeline), m_pipeline.concat);
+    m_pipeline.concat = nullptr;
+}
+
+void MediaPlayer::releaseConcatPad(GstPad** pad) {
+    if (!*pad) {
+        return;
+    }
+    if (m_pipeline.concat) {
+        gst_element_release_request_pad(m_pipeline.concat, *pad);
+    }
+    gst_object_unref(*pad);
+    *pad = nullptr;
+}
+
 gboolean MediaPlayer::onBusMessage(GstBus* bus, GstMessage* message, gpointer mediaPlayer) {
     return static_cast<MediaPlayer*>(mediaPlayer)->handleBusMessage(message);
 }
@@ -874,11 +1140,20 @@ gboolean MediaPlayer::handleBusMessage(GstMessage* message) {
                         break;
                     }
                 } else {
+                    // The current source ended before the concat element could switch to a prepared one.
+                    sendNextSourceError(ErrorType::MEDIA_ERROR_INTERNAL_DEVICE_ERROR, "currentSourceEndedFirst");
                     sendPlaybackFinished();
                 }
             }
             break;
 
+        case GST_MESSAGE_STREAM_START:
+            // The concat element starts a new stream when it switches to the source prepared to play next.
+            if (GST_MESSAGE_SRC(message) == GST_OBJECT_CAST(m_pipeline.pipeline) && isNextSourceActive()) {
+                switchToNextSource();
+            }
+            break;
+
         case GST_MESSAGE_ERROR: {
             GError* error;
             gchar* debug;
@@ -889,8 +1164,16 @@ gboolean MediaPlayer::handleBusMessage(GstMessage* message) {
                             .d("source", messageSrcName)
                             .d("error", error->message)
                             .d("debug", debug ? debug : "noInfo"));
-            bool isPlaybackRemote = m_source ? m_source->isPlaybackRemote() : false;
-            sendPlaybackError(gerrorToErrorType(error, isPlaybackRemote), error->message);
+            if (isFromNextSource(message) && !isNextSourceActive()) {
+                sendNextSourceError(gerrorToErrorType(error, m_nextSource->isPlaybackRemote()), error->message);
+            } else {
+                if (isFromNextSource(message)) {
+                    // The prepared source has already taken over from the current one, so the error is its own.
+                    switchToNextSource();
+                }
+                bool isPlaybackRemote = m_source ? m_source->isPlaybackRemote() : false;
+                sendPlaybackError(gerrorToErrorType(error, isPlaybackRemote), error->message);
+            }
             g_error_free(error);
             g_free(debug);
             break;
@@ -952,7 +1235,7 @@ gboolean MediaPlayer::handleBusMessage(GstMessage* message) {
                 } else if (newState == GST_STATE_NULL && oldState == GST_STATE_READY) {
                     sendPlaybackStopped();
                 }
-            } else if (g_str_has_prefix(GST_MESSAGE_SRC_NAME(message), "tsdemux")) {
+            } else if (g_str_has_prefix(GST_MESSAGE_SRC_NAME(message), "tsdemux") && !isFromNextSource(message)) {
                 /*
                  * tsdemux element can be used to determine if the music sources are MPEG-TS.
                  */
@@ -986,6 +1269,10 @@ gboolean MediaPlayer::handleBusMessage(GstMessage* message) {
         }
 
         case GST_MESSAGE_BUFFERING: {
+            if (isFromNextSource(message)) {
+                // The prepared source buffers ahead while the current one plays, so it must not pause the pipeline.
+                break;
+            }
             gint bufferPercent = 0;
             gst_message_parse_buffering(message, &bufferPercent);
             ACSDK_DEBUG9(LX("handleBusMessage").d("message", "GST_MESSAGE_BUFFERING").d("percent", bufferPercent));
@@ -1026,8 +1313,15 @@ gboolean MediaPlayer::handleBusMessage(GstMessage* message) {
             break;
         }
         case GST_MESSAGE_TAG: {
+            // Tags of the prepared source are posted while the current one still plays, so they belong to the next id.
+            bool isNextSource = isFromNextSource(message);
+            std::shared_ptr<SourceInterface> source = isNextSource ? m_nextSource : m_source;
+            auto bitrate = getBitrate(message);
+            if (bitrate && source) {
+                source->setBitrate(bitrate);
+            }
             auto vectorOfTags = collectTags(message);
-            sendStreamTagsToObserver(std::move(vectorOfTags));
+            sendStreamTagsToObserver(isNextSource ? m_nextId : m_currentId, std::move(vectorOfTags));
             break;
         }
         default:
@@ -1050,10 +1344,10 @@ std::unique_ptr<const VectorOfTags> MediaPlayer::collectTags(GstMessage* message
     return make_unique<const VectorOfTags>(vectorOfTags);
 }
 
-void MediaPlayer::sendStreamTagsToObserver(std::unique_ptr<const VectorOfTags> vectorOfTags) {
-    ACSDK_DEBUG(LX("callingOnTags"));
+void MediaPlayer::sendStreamTagsToObserver(SourceId id, std::unique_ptr<const VectorOfTags> vectorOfTags) {
+    ACSDK_DEBUG(LX("callingOnTags").d("id", id));
     if (m_playerObserver) {
-        m_playerObserver->onTags(m_currentId, std::move(vectorOfTags));
+        m_playerObserver->onTags(id, std::move(vectorOfTags));
     }
 }
 
@@ -1097,7 +1391,14 @@ void MediaPlayer::handleSetIStreamSource(
 
     tearDownTransientPipelineElements();
 
-    std::shared_ptr<SourceInterface> source = IStreamSource::create(this, stream, repeat);
+    std::shared_ptr<SourceInterface> source;
+    auto decodedAudio = m_decodedAudioCache && stream ? m_decodedAudioCache->get(*stream) : nullptr;
+    if (decodedAudio) {
+        ACSDK_DEBUG5(LX("handleSetIStreamSource").m("playing decoded audio from cache"));
+        source = DecodedAudioSource::create(this, decodedAudio, repeat);
+    } else {
+        source = IStreamSource::create(this, stream, repeat);
+    }
 
     if (!source) {
         ACSDK_ERROR(LX("handleSetIStreamSourceFailed").d("reason", "sourceIsNullptr"));
@@ -1151,6 +1452,241 @@ void MediaPlayer::handleSetUrlSource(
     handleSetAttachmentReaderSource(reader, promise);
 }
 
+void MediaPlayer::handlePrepareNextAttachmentReaderSource(
+    std::shared_ptr<AttachmentReader> reader,
+    std::promise<MediaPlayer::SourceId>* promise,
+    const avsCommon::utils::AudioFormat* audioFormat) {
+    ACSDK_DEBUG(LX("handlePrepareNextSourceCalled"));
+
+    if (!m_source) {
+        ACSDK_ERROR(LX("handlePrepareNextAttachmentReaderSourceFailed").d("reason", "sourceNotSet"));
+        promise->set_value(ERROR_SOURCE_ID);
+        return;
+    }
+
+    discardNextSource();
+
+    auto id = ++g_id;
+    m_nextPipeline = std::make_shared<NextSourcePipeline>(this, id);
+    if (!startNextSource(reader, audioFormat)) {
+        ACSDK_ERROR(LX("handlePrepareNextAttachmentReaderSourceFailed").d("reason", "startNextSourceFailed"));
+        discardNextSource();
+        promise->set_value(ERROR_SOURCE_ID);
+        return;
+    }
+
+    m_nextId = id;
+    promise->set_value(m_nextId);
+}
+
+void MediaPlayer::handlePrepareNextUrlSource(const std::string& url, std::promise<SourceId>* promise) {
+    ACSDK_DEBUG(LX("handlePrepareNextSourceForUrlCalled"));
+
+    if (!m_source) {
+        ACSDK_ERROR(LX("prepareNextSourceUrlFailed").d("reason", "sourceNotSet"));
+        promise->set_value(ERROR_SOURCE_ID);
+        return;
+    }
+
+    discardNextSource();
+
+    auto id = ++g_id;
+    m_nextPipeline = std::make_shared<NextSourcePipeline>(this, id);
+    m_nextUrlConverter = alexaClientSDK::playlistParser::UrlContentToAttachmentConverter::create(
+        m_contentFetcherFactory, url, m_nextPipeline);
+    if (!m_nextUrlConverter) {
+        ACSDK_ERROR(LX("prepareNextSourceUrlFailed").d("reason", "badUrlConverter"));
+        discardNextSource();
+        promise->set_value(ERROR_SOURCE_ID);
+        return;
+    }
+    auto attachment = m_nextUrlConverter->getAttachment();
+    if (!attachment) {
+        ACSDK_ERROR(LX("prepareNextSourceUrlFailed").d("reason", "badAttachmentReceived"));
+        discardNextSource();
+        promise->set_value(ERROR_SOURCE_ID);
+        return;
+    }
+    std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> reader =
+        attachment->createReader(sds::ReaderPolicy::NONBLOCKING);
+    if (!reader) {
+        ACSDK_ERROR(LX("prepareNextSourceUrlFailed").d("reason", "failedToCreateAttachmentReader"));
+        discardNextSource();
+        promise->set_value(ERROR_SOURCE_ID);
+        return;
+    }
+    if (!startNextSource(reader, nullptr)) {
+        ACSDK_ERROR(LX("prepareNextSourceUrlFailed").d("reason", "startNextSourceFailed"));
+        discardNextSource();
+        promise->set_value(ERROR_SOURCE_ID);
+        return;
+    }
+
+    m_nextId = id;
+    promise->set_value(m_nextId);
+}
+
+void MediaPlayer::handleCancelNextSource(std::promise<bool>* promise) {
+    ACSDK_DEBUG(LX("handleCancelNextSourceCalled").d("nextId", m_nextId));
+    bool wasPrepared = m_nextSource != nullptr;
+    discardNextSource();
+    promise->set_value(wasPrepared);
+}
+
+bool MediaPlayer::startNextSource(
+    std::shared_ptr<AttachmentReader> reader,
+    const avsCommon::utils::AudioFormat* audioFormat) {
+    m_nextSource = AttachmentReaderSource::create(m_nextPipeline.get(), reader, audioFormat);
+    if (!m_nextSource) {
+        ACSDK_ERROR(LX("startNextSourceFailed").d("reason", "sourceIsNullptr"));
+        return false;
+    }
+
+    if (!g_signal_connect(m_nextPipeline->getDecoder(), "pad-added", G_CALLBACK(onPadAdded), this)) {
+        ACSDK_ERROR(LX("startNextSourceFailed").d("reason", "connectPadAddedSignalFailed"));
+        return false;
+    }
+
+    // Sources which are not followed by a prepared one play without the concat element, so it is only added now.
+    if (!m_pipeline.concat && !insertConcat()) {
+        ACSDK_ERROR(LX("startNextSourceFailed").d("reason", "insertConcatFailed"));
+        return false;
+    }
+
+    // See insertConcat() for why the prepared source could never play after the end of the current one.
+    if (m_concatPad && GST_PAD_IS_EOS(m_concatPad)) {
+        ACSDK_ERROR(LX("startNextSourceFailed").d("reason", "currentSourceEnded"));
+        return false;
+    }
+
+    m_nextConcatPad = requestConcatPad();
+    if (!m_nextConcatPad) {
+        ACSDK_ERROR(LX("startNextSourceFailed").d("reason", "requestConcatPadFailed"));
+        return false;
+    }
+
+    m_nextSource->preprocess();
+
+    // Bring the new elements to the state of the pipeline, so that the prepared source is decoded ahead of the switch.
+    if (!gst_element_sync_state_with_parent(m_nextPipeline->getDecoder()) ||
+        !gst_element_sync_state_with_parent(GST_ELEMENT(m_nextPipeline->getAppSrc()))) {
+        ACSDK_ERROR(LX("startNextSourceFailed").d("reason", "syncStateWithPipelineFailed"));
+        return false;
+    }
+    return true;
+}
+
+void MediaPlayer::discardNextSource() {
+    if (m_nextId != ERROR_SOURCE_ID) {
+        ACSDK_DEBUG(LX("discardNextSource").d("nextId", m_nextId));
+    }
+    if (m_nextPipeline) {
+        if (m_nextPipeline->getAppSrc()) {
+            gst_element_set_state(GST_ELEMENT(m_nextPipeline->getAppSrc()), GST_STATE_NULL);
+        }
+        if (m_nextPipeline->getDecoder()) {
+            gst_element_set_state(m_nextPipeline->getDecoder(), GST_STATE_NULL);
+        }
+    }
+    if (m_nextSource) {
+        m_nextSource->shutdown();
+    }
+    m_nextSource.reset();
+    releaseConcatPad(&m_nextConcatPad);
+    if (m_nextUrlConverter) {
+        m_nextUrlConverter->shutdown();
+    }
+    m_nextUrlConverter.reset();
+    m_nextPipeline.reset();
+    m_nextId = ERROR_SOURCE_ID;
+}
+
+void MediaPlayer::switchToNextSource() {
+    ACSDK_DEBUG(LX("switchToNextSource").d("currentId", m_currentId).d("nextId", m_nextId));
+    auto finishedId = m_currentId;
+
+    // The current source has played to its end, so its offset is its duration.
+    gint64 duration = -1;
+    if (m_pipeline.decoder && gst_element_query_duration(m_pipeline.decoder, GST_FORMAT_TIME, &duration)) {
+        std::chrono::milliseconds startStreamingPoint = std::chrono::milliseconds::zero();
+        if (m_urlConverter) {
+            startStreamingPoint = m_urlConverter->getStartStreamingPoint();
+        }
+        m_offsetBeforeTeardown =
+            startStreamingPoint +
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::nanoseconds(duration));
+    } else {
+        saveOffsetBeforeTeardown();
+    }
+
+    // Only the elements of the current source are stopped, as the rest of the pipeline is playing the prepared one.
+    if (m_pipeline.appsrc) {
+        gst_element_set_state(GST_ELEMENT(m_pipeline.appsrc), GST_STATE_NULL);
+    }
+    if (m_pipeline.decoder) {
+        gst_element_set_state(m_pipeline.decoder, GST_STATE_NULL);
+    }
+    if (m_source) {
+        m_source->shutdown();
+    }
+    m_source.reset();
+    releaseConcatPad(&m_concatPad);
+    if (m_urlConverter) {
+        m_urlConverter->shutdown();
+    }
+
+    m_pipeline.appsrc = m_nextPipeline->getAppSrc();
+    m_pipeline.decoder = m_nextPipeline->getDecoder();
+    m_nextSource->setPipeline(this);
+    bool isEndOfData = m_nextPipeline->isEndOfData();
+    m_nextPipeline.reset();
+    m_source = std::move(m_nextSource);
+    m_urlConverter = std::move(m_nextUrlConverter);
+    m_concatPad = m_nextConcatPad;
+    m_nextConcatPad = nullptr;
+    m_currentId = m_nextId;
+    m_nextId = ERROR_SOURCE_ID;
+    m_offsetManager.clear();
+    m_offsetManager.setIsSeekable(true);
+    m_playbackStartedSent = false;
+    m_playbackFinishedSent = false;
+    m_playbackNearlyFinishedSent = false;
+    m_isBufferUnderrun = false;
+
+    ACSDK_DEBUG(LX("callingOnPlaybackFinished").d("currentId", finishedId));
+    if (m_playerObserver) {
+        m_playerObserver->onPlaybackFinished(finishedId);
+    }
+    sendPlaybackStarted();
+    if (isEndOfData) {
+        sendPlaybackNearlyFinished();
+    }
+}
+
+bool MediaPlayer::isNextSourceActive() {
+    if (!m_nextConcatPad) {
+        return false;
+    }
+    GstPad* activePad = nullptr;
+    g_object_get(m_pipeline.concat, "active-pad", &activePad, NULL);
+    bool isActive = activePad == m_nextConcatPad;
+    if (activePad) {
+        gst_object_unref(activePad);
+    }
+    return isActive;
+}
+
+bool MediaPlayer::isFromNextSource(GstMessage* message) {
+    if (!m_nextPipeline || !m_nextSource) {
+        return false;
+    }
+    auto source = GST_MESSAGE_SRC(message);
+    auto appsrc = GST_OBJECT_CAST(m_nextPipeline->getAppSrc());
+    auto decoder = GST_OBJECT_CAST(m_nextPipeline->getDecoder());
+    return (appsrc && source == appsrc) ||
+           (decoder && (source == decoder || gst_object_has_as_ancestor(source, decoder)));
+}
+
 void MediaPlayer::handlePlay(SourceId id, std::promise<bool>* promise) {
     ACSDK_DEBUG(LX("handlePlayCalled").d("idPassed", id).d("currentId", (m_currentId)));
     if (!validateSourceAndId(id)) {
@@ -1460,6 +1996,29 @@ void MediaPlayer::sendPlaybackFinished() {
     m_urlConverter.reset();
 }
 
+void MediaPlayer::sendPlaybackNearlyFinished() {
+    if (m_currentId == ERROR_SOURCE_ID || m_playbackNearlyFinishedSent) {
+        return;
+    }
+    m_playbackNearlyFinishedSent = true;
+    ACSDK_DEBUG(LX("callingOnPlaybackNearlyFinished").d("currentId", m_currentId));
+    if (m_playerObserver) {
+        m_playerObserver->onPlaybackNearlyFinished(m_currentId);
+    }
+}
+
+void MediaPlayer::sendNextSourceError(const ErrorType& type, const std::string& error) {
+    if (m_nextId == ERROR_SOURCE_ID) {
+        return;
+    }
+    auto nextId = m_nextId;
+    ACSDK_DEBUG(LX("callingOnPlaybackError").d("type", type).d("error", error).d("nextId", nextId));
+    discardNextSource();
+    if (m_playerObserver) {
+        m_playerObserver->onPlaybackError(nextId, type, error);
+    }
+}
+
 void MediaPlayer::sendPlaybackPaused() {
     ACSDK_DEBUG(LX("callingOnPlaybackPaused").d("currentId", m_currentId));
     m_pausePending = false;
@@ -1547,14 +2106,36 @@ gboolean MediaPlayer::onErrorCallback(gpointer pointer) {
     return false;
 }
 
+void MediaPlayer::onSourceError(SourceId id) {
+    ACSDK_DEBUG9(LX("onSourceError").d("id", id));
+    // As in onError(), the callback is queued without waiting for it, so the main loop owns and deletes it.
+    auto callback = new std::function<gboolean()>([this, id]() {
+        handleSourceError(id);
+        return false;
+    });
+    g_idle_add_full(
+        G_PRIORITY_DEFAULT_IDLE, reinterpret_cast<GSourceFunc>(&onCallback), callback, &destroyCallback);
+}
+
+void MediaPlayer::handleSourceError(SourceId id) {
+    if (id == m_nextId) {
+        sendNextSourceError(ErrorType::MEDIA_ERROR_INTERNAL_DEVICE_ERROR, "streamingError");
+    } else if (id == m_currentId) {
+        sendPlaybackError(ErrorType::MEDIA_ERROR_INTERNAL_DEVICE_ERROR, "streamingError");
+    }
+}
+
 void MediaPlayer::cleanUpSource() {
     if (m_pipeline.pipeline) {
         gst_element_set_state(m_pipeline.pipeline, GST_STATE_NULL);
     }
+    discardNextSource();
     if (m_source) {
         m_source->shutdown();
     }
     m_source.reset();
+    // The pipeline is stopped, so the concat element can be taken out before the next source is set.
+    removeConcat();
 }
 }  // namespace mediaPlayer
 }  // namespace alexaClientSDK
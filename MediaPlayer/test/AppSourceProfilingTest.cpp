@@ -0,0 +1,485 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file AppSourceProfilingTest.cpp
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gst/gst.h>
+#include <gtest/gtest.h>
+
+#include <AVSCommon/AVS/Attachment/InProcessAttachment.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/MediaPlayer/MediaPlayerObserverInterface.h>
+
+#include "MediaPlayer/MediaPlayer.h"
+
+namespace alexaClientSDK {
+namespace mediaPlayer {
+namespace test {
+
+using namespace avsCommon::avs::attachment;
+using namespace avsCommon::utils;
+using namespace avsCommon::utils::mediaPlayer;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("AppSourceProfilingTest");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The path to the input directory, from the command line arguments.
+static std::string inputsDirPath;
+
+/// The MP3 file in the input directory.
+static const std::string MP3_FILE_PATH("/fox_dog.mp3");
+
+/// The length of the MP3 file.
+static const std::chrono::milliseconds MP3_FILE_LENGTH(2688);
+
+/// The sample rate of the raw speech-like audio.
+static const unsigned int PCM_SAMPLE_RATE_HZ = 16000;
+
+/// The length of the raw speech-like audio.
+static const std::chrono::seconds PCM_LENGTH(4);
+
+/// The frequency of the tone in the raw audio.
+static const double PCM_TONE_HZ = 440.0;
+
+/// How often the writer delivers audio to the attachment, as a network connection would.
+static const std::chrono::milliseconds WRITE_INTERVAL(20);
+
+/// How much audio the writer delivers at once before it falls back to delivering it as it plays.
+static const std::chrono::milliseconds WRITE_HEAD_START(200);
+
+/// How long to wait beyond the length of the audio for playback to finish.
+static const std::chrono::seconds FINISH_TIMEOUT_MARGIN(5);
+
+/// The number of blocks of memory allocated through the default @c GstAllocator.
+static std::atomic<uint64_t> memoryAllocations(0);
+
+/// The number of times the default @c GMainContext polled, which is once per wakeup of the main loop.
+static std::atomic<uint64_t> mainLoopWakeups(0);
+
+/// The system memory allocator, which the counting allocator allocates from.
+static GstAllocator* systemAllocator = nullptr;
+
+/// Whether buffer pools refuse to hand out buffers, so that each chunk is allocated on its own as before the pool.
+static std::atomic<bool> bufferPoolsDisabled(false);
+
+/// The @c acquire_buffer implementation of @c GstBufferPool, which @c unpooledAcquireBuffer defers to.
+static GstFlowReturn (*defaultAcquireBuffer)(GstBufferPool*, GstBuffer**, GstBufferPoolAcquireParams*) = nullptr;
+
+/// An allocator which counts the memory allocated through it, so the buffers created while playing can be counted.
+struct CountingAllocator {
+    /// The parent instance.
+    GstAllocator parent;
+};
+
+/// The class of the @c CountingAllocator.
+struct CountingAllocatorClass {
+    /// The parent class.
+    GstAllocatorClass parentClass;
+};
+
+G_DEFINE_TYPE(CountingAllocator, counting_allocator, GST_TYPE_ALLOCATOR);
+
+/**
+ * Counts an allocation, and allocates from the system memory allocator.
+ *
+ * @param allocator The @c CountingAllocator.
+ * @param size The size of the memory.
+ * @param params The parameters of the allocation.
+ * @return The memory.
+ */
+static GstMemory* countingAlloc(GstAllocator* allocator, gsize size, GstAllocationParams* params) {
+    ++memoryAllocations;
+    return gst_allocator_alloc(systemAllocator, size, params);
+}
+
+/**
+ * Frees memory.  Memory allocated from the system allocator is freed by that allocator, so this is never reached.
+ *
+ * @param allocator The @c CountingAllocator.
+ * @param memory The memory.
+ */
+static void countingFree(GstAllocator* allocator, GstMemory* memory) {
+    gst_allocator_free(memory->allocator, memory);
+}
+
+/**
+ * Initializes the class of the @c CountingAllocator.
+ *
+ * @param klass The class.
+ */
+static void counting_allocator_class_init(CountingAllocatorClass* klass) {
+    auto allocatorClass = GST_ALLOCATOR_CLASS(klass);
+    allocatorClass->alloc = countingAlloc;
+    allocatorClass->free = countingFree;
+}
+
+/**
+ * Initializes a @c CountingAllocator.
+ *
+ * @param allocator The allocator.
+ */
+static void counting_allocator_init(CountingAllocator* allocator) {
+    GST_ALLOCATOR_CAST(allocator)->mem_type = "CountingMemory";
+}
+
+/**
+ * Counts a wakeup of the main loop, and polls.
+ *
+ * @param fds The file descriptors to poll.
+ * @param nfds The number of file descriptors.
+ * @param timeout The longest time to wait, in milliseconds.
+ * @return The number of file descriptors with events.
+ */
+static gint countingPoll(GPollFD* fds, guint nfds, gint timeout) {
+    ++mainLoopWakeups;
+    return g_poll(fds, nfds, timeout);
+}
+
+/**
+ * Acquires a buffer from a pool, unless @c bufferPoolsDisabled is set.  Only plain @c GstBufferPool instances, which
+ * are the pools the sources create, are refused, so that a source falls back to allocating each chunk with
+ * @c gst_buffer_new_allocate.
+ *
+ * @param pool The pool.
+ * @param[out] buffer The buffer.
+ * @param params The parameters of the acquisition.
+ * @return The result of the acquisition.
+ */
+static GstFlowReturn unpooledAcquireBuffer(
+    GstBufferPool* pool,
+    GstBuffer** buffer,
+    GstBufferPoolAcquireParams* params) {
+    if (bufferPoolsDisabled && G_OBJECT_TYPE(pool) == GST_TYPE_BUFFER_POOL) {
+        return GST_FLOW_ERROR;
+    }
+    return defaultAcquireBuffer(pool, buffer, params);
+}
+
+/**
+ * Installs the counting allocator as the default allocator, counts the wakeups of the default main context, which
+ * the @c MediaPlayer runs its main loop on, and lets buffer pools be disabled.
+ */
+static void installCounters() {
+    systemAllocator = gst_allocator_find(GST_ALLOCATOR_SYSMEM);
+    gst_allocator_set_default(GST_ALLOCATOR_CAST(g_object_new(counting_allocator_get_type(), nullptr)));
+    g_main_context_set_poll_func(g_main_context_default(), countingPoll);
+    auto poolClass = static_cast<GstBufferPoolClass*>(g_type_class_ref(GST_TYPE_BUFFER_POOL));
+    defaultAcquireBuffer = poolClass->acquire_buffer;
+    poolClass->acquire_buffer = unpooledAcquireBuffer;
+}
+
+/// The counts taken while a sound played.
+struct Profile {
+    /// The blocks of memory allocated.
+    uint64_t memoryAllocations;
+
+    /// The wakeups of the main loop.
+    uint64_t mainLoopWakeups;
+
+    /// The time the sound took to play.
+    std::chrono::milliseconds duration;
+};
+
+/// An observer of a @c MediaPlayer, which can wait for playback to finish.
+class PlaybackFinishedObserver : public MediaPlayerObserverInterface {
+public:
+    void onPlaybackStarted(SourceId id) override {
+    }
+
+    void onPlaybackFinished(SourceId id) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_finishedId = id;
+        m_wakeTrigger.notify_all();
+    }
+
+    void onPlaybackError(SourceId id, const ErrorType& type, std::string error) override {
+        ACSDK_ERROR(LX("onPlaybackError").d("id", id).d("error", error));
+    }
+
+    /**
+     * Wait for playback of a source to finish.
+     *
+     * @param id The source.
+     * @param timeout The longest time to wait.
+     * @return Whether playback finished before the timeout.
+     */
+    bool waitForPlaybackFinished(SourceId id, std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_wakeTrigger.wait_for(lock, timeout, [this, id]() { return m_finishedId == id; });
+    }
+
+private:
+    /// Serializes access to @c m_finishedId.
+    std::mutex m_mutex;
+
+    /// Notified when playback finishes.
+    std::condition_variable m_wakeTrigger;
+
+    /// The last source to finish.
+    SourceId m_finishedId = MediaPlayerInterface::ERROR;
+};
+
+/**
+ * An @c AttachmentReader which does not support the data-available callback, so that an @c AttachmentReaderSource
+ * reading from it falls back to retrying on a timer when it runs out of data, as every source did before the callback.
+ */
+class PollingAttachmentReader : public AttachmentReader {
+public:
+    /**
+     * Constructor.
+     *
+     * @param reader The reader to read from.
+     */
+    PollingAttachmentReader(std::shared_ptr<AttachmentReader> reader) : m_reader{reader} {
+    }
+
+    std::size_t read(
+        void* buf,
+        std::size_t numBytes,
+        ReadStatus* readStatus,
+        std::chrono::milliseconds timeoutMs = std::chrono::milliseconds(0)) override {
+        return m_reader->read(buf, numBytes, readStatus, timeoutMs);
+    }
+
+    bool seek(uint64_t offset) override {
+        return m_reader->seek(offset);
+    }
+
+    uint64_t getNumUnreadBytes() override {
+        return m_reader->getNumUnreadBytes();
+    }
+
+    void close(ClosePoint closePoint = ClosePoint::AFTER_DRAINING_CURRENT_BUFFER) override {
+        m_reader->close(closePoint);
+    }
+
+private:
+    /// The reader to read from.
+    std::shared_ptr<AttachmentReader> m_reader;
+};
+
+/**
+ * Writes audio into an attachment as a network connection would deliver it: a head start at once, and then a burst
+ * every @c WRITE_INTERVAL as fast as the audio plays.
+ *
+ * @param writer The writer of the attachment, which is closed once all the audio is written.
+ * @param data The audio.
+ * @param bytesPerSecond The rate at which the audio plays.
+ */
+static void writeInRealTime(
+    std::shared_ptr<AttachmentWriter> writer,
+    const std::vector<uint8_t>& data,
+    size_t bytesPerSecond) {
+    auto burstSize = std::max<size_t>(1, bytesPerSecond * WRITE_INTERVAL.count() / 1000);
+    auto headStart = std::min(data.size(), bytesPerSecond * WRITE_HEAD_START.count() / 1000);
+    AttachmentWriter::WriteStatus status;
+    writer->write(data.data(), headStart, &status);
+
+    auto nextWrite = std::chrono::steady_clock::now();
+    for (size_t offset = headStart; offset < data.size(); offset += burstSize) {
+        nextWrite += WRITE_INTERVAL;
+        std::this_thread::sleep_until(nextWrite);
+        writer->write(data.data() + offset, std::min(burstSize, data.size() - offset), &status);
+    }
+    writer->close();
+}
+
+class AppSourceProfilingTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_mediaPlayer = MediaPlayer::create(nullptr);
+        ASSERT_TRUE(m_mediaPlayer);
+        m_observer = std::make_shared<PlaybackFinishedObserver>();
+        m_mediaPlayer->setObserver(m_observer);
+    }
+
+    void TearDown() override {
+        m_mediaPlayer->shutdown();
+    }
+
+    /**
+     * Play audio from an attachment while it is written in real time, and count the allocations and wakeups.
+     *
+     * @param data The audio.
+     * @param bytesPerSecond The rate at which the audio plays.
+     * @param length The length of the audio.
+     * @param format The format of the audio if it is raw, or @c nullptr if it is to be decoded.
+     * @param polling Whether the source should retry reads on a timer, rather than wait for data to be written.
+     * @param[out] profile The counts.
+     */
+    void profilePlayback(
+        const std::vector<uint8_t>& data,
+        size_t bytesPerSecond,
+        std::chrono::milliseconds length,
+        const AudioFormat* format,
+        bool polling,
+        Profile* profile) {
+        auto attachment = std::make_shared<InProcessAttachment>("profiling");
+        std::shared_ptr<AttachmentWriter> writer = attachment->createWriter();
+        std::shared_ptr<AttachmentReader> reader =
+            attachment->createReader(InProcessAttachmentReader::SDSTypeReader::Policy::NONBLOCKING);
+        if (polling) {
+            reader = std::make_shared<PollingAttachmentReader>(reader);
+        }
+
+        auto allocationsBefore = memoryAllocations.load();
+        auto wakeupsBefore = mainLoopWakeups.load();
+        auto start = std::chrono::steady_clock::now();
+
+        auto id = m_mediaPlayer->setSource(reader, format);
+        ASSERT_NE(id, MediaPlayerInterface::ERROR);
+        std::thread writerThread(writeInRealTime, writer, std::cref(data), bytesPerSecond);
+        ASSERT_TRUE(m_mediaPlayer->play(id));
+        auto finished = m_observer->waitForPlaybackFinished(id, length + FINISH_TIMEOUT_MARGIN);
+        writerThread.join();
+        ASSERT_TRUE(finished);
+
+        profile->duration =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        profile->memoryAllocations = memoryAllocations - allocationsBefore;
+        profile->mainLoopWakeups = mainLoopWakeups - wakeupsBefore;
+    }
+
+    /**
+     * Report the counts taken while a sound played.
+     *
+     * @param scenario The name of the sound.
+     * @param profile The counts.
+     */
+    void report(const std::string& scenario, const Profile& profile) {
+        auto seconds = std::max<double>(profile.duration.count() / 1000.0, 1.0);
+        ACSDK_INFO(LX("profile")
+                       .d("scenario", scenario)
+                       .d("durationMs", profile.duration.count())
+                       .d("memoryAllocations", profile.memoryAllocations)
+                       .d("mainLoopWakeups", profile.mainLoopWakeups)
+                       .d("memoryAllocationsPerSecond", static_cast<uint64_t>(profile.memoryAllocations / seconds))
+                       .d("mainLoopWakeupsPerSecond", static_cast<uint64_t>(profile.mainLoopWakeups / seconds)));
+    }
+
+    /**
+     * Profile a sound with a source which retries its reads on a timer, with one which waits for data to be written,
+     * and with one which waits but allocates each chunk on its own rather than from its pool.  Report all three, and
+     * verify that waiting does not wake the main loop more often, and that the pool does not allocate more often.
+     *
+     * @param scenario The name of the sound.
+     * @param data The audio.
+     * @param bytesPerSecond The rate at which the audio plays.
+     * @param length The length of the audio.
+     * @param format The format of the audio if it is raw, or @c nullptr if it is to be decoded.
+     */
+    void compareReadLoops(
+        const std::string& scenario,
+        const std::vector<uint8_t>& data,
+        size_t bytesPerSecond,
+        std::chrono::milliseconds length,
+        const AudioFormat* format) {
+        Profile polling;
+        profilePlayback(data, bytesPerSecond, length, format, true, &polling);
+        report(scenario + "/polling", polling);
+        Profile waiting;
+        profilePlayback(data, bytesPerSecond, length, format, false, &waiting);
+        report(scenario + "/waiting", waiting);
+        EXPECT_LE(waiting.mainLoopWakeups, polling.mainLoopWakeups);
+
+        bufferPoolsDisabled = true;
+        Profile unpooled;
+        profilePlayback(data, bytesPerSecond, length, format, false, &unpooled);
+        bufferPoolsDisabled = false;
+        report(scenario + "/unpooled", unpooled);
+        EXPECT_LE(waiting.memoryAllocations, unpooled.memoryAllocations);
+    }
+
+    /// The player under test.
+    std::shared_ptr<MediaPlayer> m_mediaPlayer;
+
+    /// The observer of @c m_mediaPlayer.
+    std::shared_ptr<PlaybackFinishedObserver> m_observer;
+};
+
+/**
+ * Profile raw 16 kHz mono speech-like audio streamed into an attachment, as a text to speech response is.
+ */
+TEST_F(AppSourceProfilingTest, rawSpeechFromAttachment) {
+    AudioFormat format;
+    format.encoding = AudioFormat::Encoding::LPCM;
+    format.endianness = AudioFormat::Endianness::LITTLE;
+    format.sampleRateHz = PCM_SAMPLE_RATE_HZ;
+    format.sampleSizeInBits = 16;
+    format.numChannels = 1;
+    format.dataSigned = true;
+    format.layout = AudioFormat::Layout::INTERLEAVED;
+
+    size_t sampleCount = PCM_SAMPLE_RATE_HZ * PCM_LENGTH.count();
+    std::vector<uint8_t> data;
+    data.reserve(sampleCount * 2);
+    for (size_t i = 0; i < sampleCount; ++i) {
+        auto sample = static_cast<int16_t>(8000 * std::sin(2 * M_PI * PCM_TONE_HZ * i / PCM_SAMPLE_RATE_HZ));
+        data.push_back(static_cast<uint8_t>(sample & 0xff));
+        data.push_back(static_cast<uint8_t>((sample >> 8) & 0xff));
+    }
+
+    compareReadLoops("rawSpeechFromAttachment", data, PCM_SAMPLE_RATE_HZ * 2, PCM_LENGTH, &format);
+}
+
+/**
+ * Profile an MP3 file streamed into an attachment, as encoded speech is.
+ */
+TEST_F(AppSourceProfilingTest, mp3FromAttachment) {
+    std::ifstream file(inputsDirPath + MP3_FILE_PATH, std::ifstream::binary);
+    ASSERT_TRUE(file.good());
+    std::vector<uint8_t> data{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    ASSERT_FALSE(data.empty());
+
+    compareReadLoops("mp3FromAttachment", data, data.size() * 1000 / MP3_FILE_LENGTH.count(), MP3_FILE_LENGTH, nullptr);
+}
+
+}  // namespace test
+}  // namespace mediaPlayer
+}  // namespace alexaClientSDK
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    if (argc < 2) {
+        std::cerr << "Usage: " << std::string(argv[0]) << " <absolute path to test inputs folder>" << std::endl;
+        return 1;
+    }
+    alexaClientSDK::mediaPlayer::test::inputsDirPath = std::string(argv[1]);
+    gst_init(&argc, &argv);
+    alexaClientSDK::mediaPlayer::test::installCounters();
+    return RUN_ALL_TESTS();
+}
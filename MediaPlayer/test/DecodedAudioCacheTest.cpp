@@ -0,0 +1,227 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file DecodedAudioCacheTest.cpp
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Memory/Memory.h>
+
+#include "MediaPlayer/DecodedAudioCache.h"
+
+namespace alexaClientSDK {
+namespace mediaPlayer {
+namespace test {
+
+using namespace avsCommon::utils;
+using namespace avsCommon::utils::memory;
+
+/// The path to the input directory, from the command line arguments.
+static std::string inputsDirPath;
+
+/// The MP3 file in the input directory.
+static const std::string MP3_FILE_PATH("/fox_dog.mp3");
+
+/// The length of the MP3 file.
+static const std::chrono::milliseconds MP3_FILE_LENGTH(2688);
+
+/// The tolerance on the length of the decoded audio, to allow for the padding of the MP3 frames.
+static const std::chrono::milliseconds LENGTH_TOLERANCE(100);
+
+/// The longest time to wait for a sound to be decoded.
+static const std::chrono::seconds DECODE_TIMEOUT(10);
+
+/// The number of bits in a byte.
+static const unsigned int BITS_PER_BYTE = 8;
+
+/**
+ * Opens the MP3 file.
+ *
+ * @return A stream of the file.
+ */
+static std::unique_ptr<std::istream> openMp3File() {
+    return make_unique<std::ifstream>(inputsDirPath + MP3_FILE_PATH, std::ifstream::binary);
+}
+
+/**
+ * Returns the length of some decoded audio.
+ *
+ * @param audio The decoded audio.
+ * @return The length of the audio.
+ */
+static std::chrono::milliseconds getLength(const DecodedAudioCache::DecodedAudio& audio) {
+    auto bytesPerSecond =
+        audio.format.sampleRateHz * audio.format.numChannels * audio.format.sampleSizeInBits / BITS_PER_BYTE;
+    return std::chrono::milliseconds(audio.samples.size() * 1000 / bytesPerSecond);
+}
+
+/**
+ * Verify that an MP3 file decodes to 16-bit interleaved PCM of the length of the file.
+ */
+TEST(DecodedAudioCacheTest, decodeMp3) {
+    ASSERT_NE(DecodedAudioCache::create(), nullptr);
+    std::stringstream encoded;
+    encoded << openMp3File()->rdbuf();
+    auto audio = DecodedAudioCache::decode(encoded.str(), DecodedAudioCache::DEFAULT_MAX_CACHED_BYTES);
+    ASSERT_NE(audio, nullptr);
+    ASSERT_EQ(audio->format.encoding, AudioFormat::Encoding::LPCM);
+    ASSERT_EQ(audio->format.sampleSizeInBits, 16u);
+    ASSERT_TRUE(audio->format.dataSigned);
+    ASSERT_GT(audio->format.sampleRateHz, 0u);
+    ASSERT_GT(audio->format.numChannels, 0u);
+    ASSERT_LE(getLength(*audio), MP3_FILE_LENGTH + LENGTH_TOLERANCE);
+    ASSERT_GE(getLength(*audio), MP3_FILE_LENGTH - LENGTH_TOLERANCE);
+}
+
+/**
+ * Verify that data which is not audio does not decode.
+ */
+TEST(DecodedAudioCacheTest, decodeGarbage) {
+    ASSERT_NE(DecodedAudioCache::create(), nullptr);
+    ASSERT_EQ(DecodedAudioCache::decode(std::string(4096, 'x'), DecodedAudioCache::DEFAULT_MAX_CACHED_BYTES), nullptr);
+}
+
+/**
+ * Verify that a stream not in the cache is decoded in the background, is found by its content on a later lookup, and
+ * is left ready to be read again from its start.
+ */
+TEST(DecodedAudioCacheTest, getDecodesInBackground) {
+    auto cache = DecodedAudioCache::create();
+    ASSERT_NE(cache, nullptr);
+    auto stream = openMp3File();
+    ASSERT_EQ(cache->get(*stream), nullptr);
+    ASSERT_EQ(stream->tellg(), std::streampos(0));
+
+    ASSERT_TRUE(cache->prefetch(openMp3File).get());
+    auto otherStream = openMp3File();
+    auto audio = cache->get(*otherStream);
+    ASSERT_NE(audio, nullptr);
+    std::stringstream encoded;
+    encoded << openMp3File()->rdbuf();
+    ASSERT_EQ(cache->getCachedBytes(), encoded.str().size() + audio->samples.size());
+}
+
+/**
+ * Verify that a stream of the same size as a cached sound, but with different content, is not taken for that sound.
+ */
+TEST(DecodedAudioCacheTest, sameSizeDifferentContentIsNotFound) {
+    auto cache = DecodedAudioCache::create();
+    ASSERT_NE(cache, nullptr);
+    ASSERT_TRUE(cache->prefetch(openMp3File).get());
+
+    std::stringstream encoded;
+    encoded << openMp3File()->rdbuf();
+    auto altered = encoded.str();
+    ASSERT_FALSE(altered.empty());
+    altered.back() ^= 1;
+    std::istringstream alteredStream(altered);
+    ASSERT_EQ(cache->get(alteredStream), nullptr);
+    ASSERT_NE(cache->get(*openMp3File()), nullptr);
+}
+
+/**
+ * Verify that a prefetched sound is in the cache when it is first played.
+ */
+TEST(DecodedAudioCacheTest, prefetch) {
+    auto cache = DecodedAudioCache::create();
+    ASSERT_NE(cache, nullptr);
+    auto future = cache->prefetch(openMp3File);
+    ASSERT_EQ(future.wait_for(DECODE_TIMEOUT), std::future_status::ready);
+    ASSERT_TRUE(future.get());
+    ASSERT_NE(cache->get(*openMp3File()), nullptr);
+}
+
+/**
+ * Verify that a sound which would take the cache over its cap is not cached.
+ */
+TEST(DecodedAudioCacheTest, capIsRespected) {
+    auto cache = DecodedAudioCache::create(1024);
+    ASSERT_NE(cache, nullptr);
+    ASSERT_FALSE(cache->prefetch(openMp3File).get());
+    ASSERT_EQ(cache->get(*openMp3File()), nullptr);
+    ASSERT_EQ(cache->getCachedBytes(), 0u);
+}
+
+/**
+ * Verify that a sound which could not be decoded is remembered, counting only its compressed audio toward the cap, so
+ * that it is not decoded again when it is next played.
+ */
+TEST(DecodedAudioCacheTest, failedDecodeIsRemembered) {
+    const std::string garbage(4096, 'x');
+    auto cache = DecodedAudioCache::create();
+    ASSERT_NE(cache, nullptr);
+    auto openGarbage = [&garbage]() -> std::unique_ptr<std::istream> {
+        return make_unique<std::istringstream>(garbage);
+    };
+    ASSERT_FALSE(cache->prefetch(openGarbage).get());
+    ASSERT_EQ(cache->getCachedBytes(), garbage.size());
+
+    ASSERT_EQ(cache->get(*openGarbage()), nullptr);
+    auto future = cache->prefetch(openGarbage);
+    ASSERT_EQ(future.wait_for(DECODE_TIMEOUT), std::future_status::ready);
+    ASSERT_FALSE(future.get());
+    ASSERT_EQ(cache->getCachedBytes(), garbage.size());
+}
+
+/**
+ * Verify that a sound whose decoded audio would take the cache over its cap is remembered, counting only its
+ * compressed audio toward the cap, and is not found on a later lookup.
+ */
+TEST(DecodedAudioCacheTest, tooLargeDecodeIsRemembered) {
+    std::stringstream encoded;
+    encoded << openMp3File()->rdbuf();
+    auto cache = DecodedAudioCache::create(encoded.str().size() + 1024);
+    ASSERT_NE(cache, nullptr);
+    ASSERT_FALSE(cache->prefetch(openMp3File).get());
+    ASSERT_EQ(cache->getCachedBytes(), encoded.str().size());
+    ASSERT_EQ(cache->get(*openMp3File()), nullptr);
+    ASSERT_FALSE(cache->prefetch(openMp3File).get());
+    ASSERT_EQ(cache->getCachedBytes(), encoded.str().size());
+}
+
+/**
+ * Verify that the compressed audio of a sound counts toward the cap, so that a sound which is larger than the cap is
+ * not kept.
+ */
+TEST(DecodedAudioCacheTest, compressedAudioCountsTowardCap) {
+    std::stringstream encoded;
+    encoded << openMp3File()->rdbuf();
+    auto cache = DecodedAudioCache::create(encoded.str().size() - 1);
+    ASSERT_NE(cache, nullptr);
+    ASSERT_EQ(cache->get(*openMp3File()), nullptr);
+    ASSERT_FALSE(cache->prefetch(openMp3File).get());
+    ASSERT_EQ(cache->getCachedBytes(), 0u);
+}
+
+}  // namespace test
+}  // namespace mediaPlayer
+}  // namespace alexaClientSDK
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    if (argc < 2) {
+        std::cerr << "Usage: " << std::string(argv[0]) << " <absolute path to test inputs folder>" << std::endl;
+        return 1;
+    }
+    alexaClientSDK::mediaPlayer::test::inputsDirPath = std::string(argv[1]);
+    return RUN_ALL_TESTS();
+}
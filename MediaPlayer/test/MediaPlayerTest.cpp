@@ -87,6 +87,9 @@ static const std::chrono::milliseconds TOLERANCE(200);
 /// Padding to add to offsets when necessary.
 static const std::chrono::milliseconds PADDING(10);
 
+/// Tolerance on the length of playback from a @c DecodedAudioCache, to allow for the padding of the MP3 frames.
+static const std::chrono::milliseconds DECODED_AUDIO_TOLERANCE(200);
+
 static std::unordered_map<std::string, std::string> urlsToContentTypes;
 
 static std::unordered_map<std::string, std::string> urlsToContent;
@@ -421,6 +424,14 @@ public:
      */
     int getOnTagsCallCount();
 
+    /**
+     * This gets the number of times onTags was called with the given id.
+     *
+     * @param id The @c SourceId passed to onTags.
+     * @return The number of calls for @c id.
+     */
+    int getOnTagsCallCount(SourceId id);
+
 private:
     /// Mutex to protect the flags @c m_playbackStarted and .@c m_playbackFinished.
     std::mutex m_mutex;
@@ -441,6 +452,7 @@ private:
     int m_onPlaybackStartedCallCount = 0;
     int m_onPlaybackFinishedCallCount = 0;
     int m_onTagsCallCount = 0;
+    std::unordered_map<SourceId, int> m_onTagsCallCounts;
 
     /// Flag to set when a playback start message is received.
     bool m_playbackStarted;
@@ -569,11 +581,17 @@ int MockPlayerObserver::getOnTagsCallCount() {
     return m_onTagsCallCount;
 }
 
+int MockPlayerObserver::getOnTagsCallCount(SourceId id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_onTagsCallCounts[id];
+}
+
 void MockPlayerObserver::onTags(SourceId id, std::unique_ptr<const VectorOfTags> vectorOfTags) {
     std::lock_guard<std::mutex> lock(m_mutex);
     m_lastId = id;
     m_tags = true;
     m_onTagsCallCount++;
+    m_onTagsCallCounts[id]++;
     m_wakeTags.notify_all();
 }
 
@@ -609,6 +627,12 @@ public:
      */
     void setIStreamSource(MediaPlayer::SourceId* id, bool repeat = false);
 
+    /**
+     * Replaces the @c MediaPlayer with one which plays IStream sources from a @c DecodedAudioCache which already holds
+     * the decoded test stream.
+     */
+    void useDecodedAudioCache();
+
     /// An instance of the @c MediaPlayer
     std::shared_ptr<MediaPlayer> m_mediaPlayer;
 
@@ -644,6 +668,18 @@ void MediaPlayerTest::setIStreamSource(MediaPlayer::SourceId* id, bool repeat) {
     }
 }
 
+void MediaPlayerTest::useDecodedAudioCache() {
+    auto cache = DecodedAudioCache::create();
+    ASSERT_TRUE(cache);
+    auto openStream = []() { return make_unique<std::ifstream>(inputsDirPath + MP3_FILE_PATH, std::ifstream::binary); };
+    ASSERT_TRUE(cache->prefetch(openStream).get());
+    m_mediaPlayer->shutdown();
+    m_mediaPlayer = MediaPlayer::create(
+        std::make_shared<MockContentFetcherFactory>(), SpeakerInterface::Type::AVS_SYNCED, "CachedMediaPlayer", cache);
+    ASSERT_TRUE(m_mediaPlayer);
+    m_mediaPlayer->setObserver(m_playerObserver);
+}
+
 /**
  * Read an audio file into a buffer. Set the source of the @c MediaPlayer to the buffer. Playback audio till the end.
  * Check whether the playback started and playback finished notifications are received.
@@ -756,6 +792,40 @@ TEST_F(MediaPlayerTest, testStartPlayCallAfterStopPlayDifferentSource) {
     ASSERT_TRUE(m_playerObserver->waitForPlaybackStopped(sourceId));
 }
 
+/**
+ * Play an IStream source through a @c MediaPlayer with a @c DecodedAudioCache which already holds the decoded stream.
+ * Check that the stream plays to the end, and that it plays again from the cache.
+ */
+TEST_F(MediaPlayerTest, testPlayFromDecodedAudioCache) {
+    useDecodedAudioCache();
+
+    for (int i = 0; i < 2; ++i) {
+        MediaPlayer::SourceId sourceId;
+        setIStreamSource(&sourceId);
+        auto start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(m_mediaPlayer->play(sourceId));
+        ASSERT_TRUE(m_playerObserver->waitForPlaybackStarted(sourceId));
+        ASSERT_TRUE(m_playerObserver->waitForPlaybackFinished(sourceId));
+        ASSERT_GE(std::chrono::steady_clock::now() - start, MP3_FILE_LENGTH - DECODED_AUDIO_TOLERANCE);
+    }
+}
+
+/**
+ * Play a repeating IStream source from a @c DecodedAudioCache past the end of the stream, and then stop it.
+ */
+TEST_F(MediaPlayerTest, testStopRepeatingPlayFromDecodedAudioCache) {
+    useDecodedAudioCache();
+
+    MediaPlayer::SourceId sourceId;
+    setIStreamSource(&sourceId, true);
+    ASSERT_TRUE(m_mediaPlayer->play(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackStarted(sourceId));
+    std::this_thread::sleep_for(MP3_FILE_LENGTH + std::chrono::seconds(1));
+    ASSERT_EQ(m_playerObserver->getOnPlaybackFinishedCallCount(), 0);
+    ASSERT_TRUE(m_mediaPlayer->stop(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackStopped(sourceId));
+}
+
 /*
  * Pause an audio after playback has started.
  */
@@ -914,6 +984,64 @@ TEST_F(MediaPlayerTest, testPlayingTwoAttachments) {
     ASSERT_TRUE(m_playerObserver->waitForPlaybackStopped(sourceId));
 }
 
+/**
+ * Check that a source prepared while another plays starts without a call to @c play once the first has finished.
+ * Expect a playback started and a playback finished notification for each source.
+ */
+TEST_F(MediaPlayerTest, testPrepareNextSource) {
+    MediaPlayer::SourceId sourceId;
+    setAttachmentReaderSource(&sourceId);
+    ASSERT_TRUE(m_mediaPlayer->play(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackStarted(sourceId));
+
+    auto nextId = m_mediaPlayer->prepareNextSource(std::unique_ptr<AttachmentReader>(new MockAttachmentReader()));
+    ASSERT_NE(ERROR_SOURCE_ID, nextId);
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackStarted(nextId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackFinished(nextId));
+    ASSERT_EQ(m_playerObserver->getOnPlaybackStartedCallCount(), 2);
+    ASSERT_EQ(m_playerObserver->getOnPlaybackFinishedCallCount(), 2);
+}
+
+/**
+ * Check that the tags of a prepared source, which are read while the current source still plays, are reported with
+ * the id of the prepared source rather than that of the current one.
+ */
+TEST_F(MediaPlayerTest, testPrepareNextSourceReadsTags) {
+    MediaPlayer::SourceId sourceId;
+    setAttachmentReaderSource(&sourceId);
+    ASSERT_TRUE(m_mediaPlayer->play(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackStarted(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForTags(sourceId));
+
+    auto nextId = m_mediaPlayer->prepareNextSource(std::unique_ptr<AttachmentReader>(new MockAttachmentReader()));
+    ASSERT_NE(ERROR_SOURCE_ID, nextId);
+    ASSERT_TRUE(m_playerObserver->waitForTags(nextId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackFinished(nextId));
+    /*
+     * fox_dog.mp3 returns 3 sets of tags.
+     */
+    ASSERT_EQ(m_playerObserver->getOnTagsCallCount(sourceId), 3);
+    ASSERT_EQ(m_playerObserver->getOnTagsCallCount(nextId), 3);
+}
+
+/**
+ * Check that a prepared source which is cancelled does not play, and that the current source plays to its end.
+ */
+TEST_F(MediaPlayerTest, testCancelNextSource) {
+    MediaPlayer::SourceId sourceId;
+    setAttachmentReaderSource(&sourceId);
+    ASSERT_FALSE(m_mediaPlayer->cancelNextSource());
+    ASSERT_TRUE(m_mediaPlayer->play(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackStarted(sourceId));
+
+    auto nextId = m_mediaPlayer->prepareNextSource(std::unique_ptr<AttachmentReader>(new MockAttachmentReader()));
+    ASSERT_NE(ERROR_SOURCE_ID, nextId);
+    ASSERT_TRUE(m_mediaPlayer->cancelNextSource());
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackFinished(sourceId));
+    ASSERT_FALSE(m_playerObserver->waitForPlaybackStarted(nextId, MP3_FILE_LENGTH));
+    ASSERT_EQ(m_playerObserver->getOnPlaybackStartedCallCount(), 1);
+}
+
 /**
  * Check playback of an attachment that is received sporadically. Playback started notification should be received
  * when the playback starts. Wait for playback to finish and expect the playback finished notification is received.
@@ -124,6 +124,45 @@ private:
      */
     static void removeCarriageReturnFromLine(std::string* line);
 
+    /**
+     * Fetches a URL to learn its content type and, if it is a playlist, its content.  When the content fetcher
+     * supports @c FetchOptions::CONTENT_TYPE_AND_BODY, both come from a single request, and a missing or unspecific
+     * content type is replaced by one sniffed from the start of the body.  Otherwise only the content type is
+     * fetched, and the content must be fetched with @c getContentFromPlaylistUrlIntoString().
+     *
+     * @param url The URL to fetch.
+     * @param [out] contentType The content type of the URL.
+     * @param [out] content The playlist content, if it was fetched.
+     * @param [out] contentFetched Whether the playlist content was fetched.
+     * @return @c true if no error occured or @c false otherwise.
+     */
+    bool getContentTypeAndPlaylistContent(
+        const std::string& url,
+        std::string* contentType,
+        std::string* content,
+        bool* contentFetched) const;
+
+    /**
+     * Reads from an attachment until it is closed or at least a given number of bytes has been read.
+     *
+     * @param reader The reader to read from.
+     * @param minBytes The number of bytes after which reading stops, even if the attachment is still open.
+     * @param [out] content The string to append what was read to.
+     * @return @c true if no error occured or @c false otherwise.
+     */
+    static bool readIntoString(
+        avsCommon::avs::attachment::AttachmentReader* reader,
+        size_t minBytes,
+        std::string* content);
+
+    /**
+     * Determines the playlist content type from the first bytes of a body, for servers which do not give one.
+     *
+     * @param prefix The first bytes of the body.
+     * @return The content type of an M3U or PLS playlist, or an empty string if the body is neither.
+     */
+    static std::string sniffContentType(const std::string& prefix);
+
     /**
      * Retrieves content from a URL and stores it into a string.
      *
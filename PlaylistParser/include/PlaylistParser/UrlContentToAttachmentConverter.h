@@ -16,7 +16,12 @@
 #ifndef ALEXA_CLIENT_SDK_PLAYLISTPARSER_INCLUDE_PLAYLISTPARSER_URLCONTENTTOATTACHMENTCONVERTER_H_
 #define ALEXA_CLIENT_SDK_PLAYLISTPARSER_INCLUDE_PLAYLISTPARSER_URLCONTENTTOATTACHMENTCONVERTER_H_
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include <AVSCommon/AVS/Attachment/InProcessAttachment.h>
 #include <AVSCommon/AVS/Attachment/InProcessAttachmentWriter.h>
@@ -26,17 +31,42 @@
 #include <AVSCommon/Utils/PlaylistParser/PlaylistParserObserverInterface.h>
 #include <AVSCommon/Utils/RequiresShutdown.h>
 #include <AVSCommon/Utils/Threading/Executor.h>
+#include <AVSCommon/Utils/Threading/ThreadPool.h>
 
 #include "PlaylistParser/PlaylistParser.h"
 
 namespace alexaClientSDK {
 namespace playlistParser {
 
-/// Class that handles the streaming of urls containing media into @c Attachments.
+/**
+ * Class that handles the streaming of urls containing media into @c Attachments.
+ *
+ * The entries of a playlist are downloaded ahead of playback: up to a window of entries are fetched concurrently into
+ * staging buffers of their own, and copied into the attachment one after another, in playlist order.  A slow entry
+ * then only delays the entries behind it if the entries already staged run out before it arrives.
+ */
 class UrlContentToAttachmentConverter
         : public avsCommon::utils::playlistParser::PlaylistParserObserverInterface
         , public avsCommon::utils::RequiresShutdown {
 public:
+    /// The default number of playlist entries downloaded ahead of the one being copied into the attachment.
+    static const size_t DEFAULT_PREFETCH_WINDOW;
+
+    /// The default total size of the staging buffers.
+    static const size_t DEFAULT_MAX_PREFETCH_BYTES;
+
+    /// Statistics about how well the downloads kept ahead of the attachment.
+    struct BufferHealth {
+        /// The number of playlist entries copied into the attachment.
+        size_t entriesWritten;
+        /// The number of times the attachment waited for the data of the entry being copied into it.
+        size_t stallCount;
+        /// The total time the attachment waited for data.
+        std::chrono::milliseconds stallTime;
+        /// The largest number of entries staged at once.
+        size_t maxEntriesStaged;
+    };
+
     /// Class to observe errors that arise from converting a URL to to an @c Attachment
     class ErrorObserverInterface {
     public:
@@ -59,6 +89,10 @@ public:
      * @param startTime The desired time to attempt to start streaming from. Note that this will only succeed
      * in cases where the URL points to a playlist with metadata about individual chunks within it. If none are found,
      * streaming will begin from the beginning.
+     * @param prefetchWindow The number of playlist entries to download concurrently.  Zero downloads each entry
+     * straight into the attachment, one after another.
+     * @param maxPrefetchBytes The total size of the staging buffers, which are shared equally by the entries in the
+     * window.  An entry larger than its share streams through its buffer.
      * @return A @c std::shared_ptr to the new @c UrlContentToAttachmentConverter object or @c nullptr on failure.
      *
      * @note This object is intended to be used once. Subsequent calls to @c convertPlaylistToAttachment() will fail.
@@ -67,7 +101,9 @@ public:
         std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory,
         const std::string& url,
         std::shared_ptr<ErrorObserverInterface> observer,
-        std::chrono::milliseconds startTime = std::chrono::milliseconds::zero());
+        std::chrono::milliseconds startTime = std::chrono::milliseconds::zero(),
+        size_t prefetchWindow = DEFAULT_PREFETCH_WINDOW,
+        size_t maxPrefetchBytes = DEFAULT_MAX_PREFETCH_BYTES);
 
     /**
      * Returns the attachment into which the URL content was streamed into.
@@ -90,9 +126,44 @@ public:
      */
     std::chrono::milliseconds getDesiredStreamingPoint();
 
+    /**
+     * Gets statistics about how well the downloads have kept ahead of the attachment so far.
+     *
+     * @return The statistics.
+     */
+    BufferHealth getBufferHealth();
+
     void doShutdown() override;
 
 private:
+    /// A playlist entry which is downloaded ahead of being copied into the attachment.
+    struct Segment {
+        /**
+         * Constructor.
+         *
+         * @param url The URL of the entry.
+         */
+        Segment(const std::string& url);
+
+        /// The URL of the entry.
+        const std::string url;
+
+        /// The staging buffer, which is created when the download starts.
+        std::shared_ptr<avsCommon::avs::attachment::InProcessAttachment> staging;
+
+        /// The writer of the download into @c staging.
+        std::shared_ptr<avsCommon::avs::attachment::AttachmentWriter> stagingWriter;
+
+        /// The reader which copies @c staging into the attachment.
+        std::unique_ptr<avsCommon::avs::attachment::AttachmentReader> stagingReader;
+
+        /// Whether the download has ended.
+        bool isDownloadDone;
+
+        /// Whether the download succeeded.
+        bool isDownloadSuccessful;
+    };
+
     /**
      * Constructor.
      *
@@ -102,12 +173,16 @@ private:
      * @param desiredStartTime The desired time to attempt to start streaming from. Note that this will only succeed
      * in cases where the URL points to a playlist with metadata about individual chunks within it. If none are found,
      * streaming will begin from the beginning.
+     * @param prefetchWindow The number of playlist entries to download concurrently.
+     * @param maxPrefetchBytes The total size of the staging buffers.
      */
     UrlContentToAttachmentConverter(
         std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory,
         const std::string& url,
         std::shared_ptr<ErrorObserverInterface> observer,
-        std::chrono::milliseconds startTime);
+        std::chrono::milliseconds startTime,
+        size_t prefetchWindow,
+        size_t maxPrefetchBytes);
 
     void onPlaylistEntryParsed(
         int requestId,
@@ -131,8 +206,56 @@ private:
      */
     bool writeUrlContentIntoStream(std::string url);
 
+    /**
+     * Copies a downloaded entry from its staging buffer into the internal stream, waiting for the download as needed.
+     *
+     * @param segment The entry.
+     * @return @c true if the content was successfully downloaded and written or @c false otherwise.
+     */
+    bool writeSegmentIntoStream(std::shared_ptr<Segment> segment);
+
+    /**
+     * Writes data into the internal stream, waiting for space as needed.
+     *
+     * @param data The data.
+     * @param size The number of bytes.
+     * @return Whether all of the data was written.
+     */
+    bool writeIntoStream(const char* data, size_t size);
+
     /// @}
 
+    /**
+     * Queues a playlist entry for download, and starts the download if the window has room.
+     *
+     * @param segment The entry.
+     */
+    void queueSegment(std::shared_ptr<Segment> segment);
+
+    /**
+     * Starts the downloads of queued entries while the window has room.  @c m_prefetchMutex must be held.
+     */
+    void startDownloadsLocked();
+
+    /**
+     * Downloads an entry into its staging buffer.  This runs on @c m_downloadPool.
+     *
+     * @param segment The entry.
+     */
+    void downloadSegment(std::shared_ptr<Segment> segment);
+
+    /**
+     * Frees the window slot of an entry which has been copied into the stream.
+     *
+     * @param segment The entry.
+     */
+    void releaseSegment(std::shared_ptr<Segment> segment);
+
+    /**
+     * Stops downloading entries, because the stream has been closed.
+     */
+    void abandonSegments();
+
     /// The initial desired offset from which streaming should begin.
     const std::chrono::milliseconds m_desiredStreamPoint;
 
@@ -157,6 +280,30 @@ private:
     /// Flag to indicate if a shutdown is occurring.
     std::atomic<bool> m_shuttingDown;
 
+    /// The number of playlist entries downloaded concurrently, or zero to download them straight into the stream.
+    const size_t m_prefetchWindow;
+
+    /// The size of the staging buffer of each entry.
+    const size_t m_stagingBufferSize;
+
+    /// Serializes access to the members below.
+    std::mutex m_prefetchMutex;
+
+    /// Notified when a download starts or ends, or when the entries are abandoned.
+    std::condition_variable m_prefetchCondition;
+
+    /// Entries whose downloads have not started yet, in playlist order.
+    std::deque<std::shared_ptr<Segment>> m_queuedSegments;
+
+    /// Entries whose downloads have started and which have not been copied into the stream yet.
+    std::vector<std::shared_ptr<Segment>> m_stagedSegments;
+
+    /// Whether the stream has been closed, so that no more entries are downloaded.
+    bool m_areSegmentsAbandoned;
+
+    /// Statistics about how well the downloads have kept ahead of the stream.
+    BufferHealth m_bufferHealth;
+
     /**
      * @name @c onPlaylistEntryParsed Callback Variables
      *
@@ -196,6 +343,13 @@ private:
      *     before the Executor Thread Variables are destroyed.
      */
     avsCommon::utils::threading::Executor m_executor;
+
+    /**
+     * The threads which download the entries in the window, or @c nullptr without a window.
+     *
+     * @note This declaration comes last so that running downloads finish before anything they use is destroyed.
+     */
+    std::unique_ptr<avsCommon::utils::threading::ThreadPool> m_downloadPool;
 };
 
 }  // namespace playlistParser
@@ -40,6 +40,21 @@ static const std::string M3U_CONTENT_TYPE = "mpegurl";
 /// The HTML content-type of a PLS playlist.
 static const std::string PLS_CONTENT_TYPE = "scpls";
 
+/// The content-type given to a URL whose body was sniffed to be an M3U playlist.
+static const std::string SNIFFED_M3U_CONTENT_TYPE = "audio/mpegurl";
+
+/// The content-type given to a URL whose body was sniffed to be a PLS playlist.
+static const std::string SNIFFED_PLS_CONTENT_TYPE = "audio/x-scpls";
+
+/// Content-types which say nothing about the body, so that it is sniffed for a playlist header.
+static const std::vector<std::string> UNSPECIFIC_CONTENT_TYPES = {"", "text/plain", "application/octet-stream"};
+
+/// The byte order mark which may begin a UTF-8 playlist.
+static const std::string UTF8_BYTE_ORDER_MARK = "\xEF\xBB\xBF";
+
+/// The number of bytes read from the start of a body to sniff its type.
+static const size_t SNIFF_SIZE(64);
+
 /// The number of bytes read from the attachment with each read in the read loop.
 static const size_t CHUNK_SIZE(1024);
 
@@ -133,16 +148,15 @@ void PlaylistParser::doDepthFirstSearch(
                 urlAndInfo.length);
             continue;
         }
-        auto contentFetcher = m_contentFetcherFactory->create(urlAndInfo.url);
-        auto httpContent = contentFetcher->getContent(
-            avsCommon::sdkInterfaces::HTTPContentFetcherInterface::FetchOptions::CONTENT_TYPE);
-        if (!httpContent || !(*httpContent)) {
-            ACSDK_ERROR(LX("getHTTPContent").d("reason", "badHTTPContentReceived"));
+        std::string contentType;
+        std::string playlistContent;
+        bool playlistContentFetched = false;
+        if (!getContentTypeAndPlaylistContent(
+                urlAndInfo.url, &contentType, &playlistContent, &playlistContentFetched)) {
             observer->onPlaylistEntryParsed(
                 id, urlAndInfo.url, avsCommon::utils::playlistParser::PlaylistParseResult::ERROR, urlAndInfo.length);
             return;
         }
-        std::string contentType = httpContent->contentType.get();
         ACSDK_DEBUG9(LX("PlaylistParser")
                          .d("contentType", contentType)
                          .sensitive("url", urlAndInfo.url)
@@ -150,8 +164,7 @@ void PlaylistParser::doDepthFirstSearch(
         std::transform(contentType.begin(), contentType.end(), contentType.begin(), ::tolower);
         // Checking the HTML content type to see if the URL is a playlist.
         if (contentType.find(M3U_CONTENT_TYPE) != std::string::npos) {
-            std::string playlistContent;
-            if (!getContentFromPlaylistUrlIntoString(urlAndInfo.url, &playlistContent)) {
+            if (!playlistContentFetched && !getContentFromPlaylistUrlIntoString(urlAndInfo.url, &playlistContent)) {
                 ACSDK_ERROR(LX("failedToRetrieveContent").sensitive("url", urlAndInfo.url));
                 observer->onPlaylistEntryParsed(
                     id,
@@ -258,8 +271,7 @@ void PlaylistParser::doDepthFirstSearch(
                     urlAndInfo.length);
                 continue;
             }
-            std::string playlistContent;
-            if (!getContentFromPlaylistUrlIntoString(urlAndInfo.url, &playlistContent)) {
+            if (!playlistContentFetched && !getContentFromPlaylistUrlIntoString(urlAndInfo.url, &playlistContent)) {
                 observer->onPlaylistEntryParsed(
                     id,
                     urlAndInfo.url,
@@ -292,33 +304,76 @@ void PlaylistParser::doDepthFirstSearch(
     }
 }
 
-bool PlaylistParser::getContentFromPlaylistUrlIntoString(const std::string& url, std::string* content) const {
-    if (!content) {
-        ACSDK_ERROR(LX("getContentFromPlaylistUrlIntoStringFailed").d("reason", "nullString"));
-        return false;
-    }
+bool PlaylistParser::getContentTypeAndPlaylistContent(
+    const std::string& url,
+    std::string* contentType,
+    std::string* content,
+    bool* contentFetched) const {
+    *contentFetched = false;
     auto contentFetcher = m_contentFetcherFactory->create(url);
-    auto httpContent =
-        contentFetcher->getContent(avsCommon::sdkInterfaces::HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY);
+    auto httpContent = contentFetcher->getContent(
+        avsCommon::sdkInterfaces::HTTPContentFetcherInterface::FetchOptions::CONTENT_TYPE_AND_BODY);
     if (!httpContent) {
-        ACSDK_ERROR(LX("getContentFromPlaylistUrlIntoStringFailed").d("reason", "nullHTTPContentReceived"));
-        return false;
+        // The content fetcher does not support a single request, so learn only the content type with this one.
+        ACSDK_DEBUG9(LX("getContentTypeAndPlaylistContent").d("reason", "contentTypeAndBodyNotSupported"));
+        contentFetcher = m_contentFetcherFactory->create(url);
+        httpContent = contentFetcher->getContent(
+            avsCommon::sdkInterfaces::HTTPContentFetcherInterface::FetchOptions::CONTENT_TYPE);
     }
-    if (!(*httpContent)) {
-        ACSDK_ERROR(LX("getContentFromPlaylistUrlIntoStringFailed").d("reason", "badHTTPContentReceived"));
+    if (!httpContent || !(*httpContent)) {
+        ACSDK_ERROR(LX("getHTTPContent").d("reason", "badHTTPContentReceived"));
         return false;
     }
+    *contentType = httpContent->contentType.get();
+    if (!httpContent->dataStream) {
+        return true;
+    }
+
+    std::string lowerCaseContentType = *contentType;
+    std::transform(
+        lowerCaseContentType.begin(), lowerCaseContentType.end(), lowerCaseContentType.begin(), ::tolower);
+    bool isPlaylist = lowerCaseContentType.find(M3U_CONTENT_TYPE) != std::string::npos ||
+                      lowerCaseContentType.find(PLS_CONTENT_TYPE) != std::string::npos;
+    if (!isPlaylist && std::find(UNSPECIFIC_CONTENT_TYPES.begin(), UNSPECIFIC_CONTENT_TYPES.end(),
+                                 lowerCaseContentType) == UNSPECIFIC_CONTENT_TYPES.end()) {
+        // This is media, which may be a live stream, so stop the transfer by destroying the content fetcher.
+        return true;
+    }
+
     auto reader = httpContent->dataStream->createReader(avsCommon::utils::sds::ReaderPolicy::BLOCKING);
     if (!reader) {
-        ACSDK_ERROR(LX("getContentFromPlaylistUrlIntoStringFailed").d("reason", "failedToCreateStreamReader"));
+        ACSDK_ERROR(LX("getContentTypeAndPlaylistContentFailed").d("reason", "failedToCreateStreamReader"));
+        return false;
+    }
+    std::string playlistContent;
+    if (!isPlaylist) {
+        if (!readIntoString(reader.get(), SNIFF_SIZE, &playlistContent)) {
+            return false;
+        }
+        auto sniffedContentType = sniffContentType(playlistContent);
+        if (sniffedContentType.empty()) {
+            return true;
+        }
+        ACSDK_DEBUG9(LX("sniffedPlaylist").d("contentType", sniffedContentType).sensitive("url", url));
+        *contentType = sniffedContentType;
+    }
+    if (!readIntoString(reader.get(), std::string::npos, &playlistContent)) {
         return false;
     }
+    *content = playlistContent;
+    *contentFetched = true;
+    return true;
+}
+
+bool PlaylistParser::readIntoString(
+    avsCommon::avs::attachment::AttachmentReader* reader,
+    size_t minBytes,
+    std::string* content) {
     avsCommon::avs::attachment::AttachmentReader::ReadStatus readStatus =
         avsCommon::avs::attachment::AttachmentReader::ReadStatus::OK;
-    std::string playlistContent;
     std::vector<char> buffer(CHUNK_SIZE, 0);
     bool streamClosed = false;
-    while (!streamClosed) {
+    while (!streamClosed && content->size() < minBytes) {
         auto bytesRead = reader->read(buffer.data(), buffer.size(), &readStatus);
         switch (readStatus) {
             case avsCommon::avs::attachment::AttachmentReader::ReadStatus::CLOSED:
@@ -330,15 +385,61 @@ bool PlaylistParser::getContentFromPlaylistUrlIntoString(const std::string& url,
             case avsCommon::avs::attachment::AttachmentReader::ReadStatus::OK:
             case avsCommon::avs::attachment::AttachmentReader::ReadStatus::OK_WOULDBLOCK:
             case avsCommon::avs::attachment::AttachmentReader::ReadStatus::OK_TIMEDOUT:
-                playlistContent.append(buffer.data(), bytesRead);
+                content->append(buffer.data(), bytesRead);
                 break;
             case avsCommon::avs::attachment::AttachmentReader::ReadStatus::ERROR_OVERRUN:
             case avsCommon::avs::attachment::AttachmentReader::ReadStatus::ERROR_BYTES_LESS_THAN_WORD_SIZE:
             case avsCommon::avs::attachment::AttachmentReader::ReadStatus::ERROR_INTERNAL:
-                ACSDK_ERROR(LX("getContentFromPlaylistUrlIntoStringFailed").d("reason", "readError"));
+                ACSDK_ERROR(LX("readIntoStringFailed").d("reason", "readError"));
                 return false;
         }
     }
+    return true;
+}
+
+std::string PlaylistParser::sniffContentType(const std::string& prefix) {
+    size_t start = 0;
+    if (prefix.compare(0, UTF8_BYTE_ORDER_MARK.length(), UTF8_BYTE_ORDER_MARK) == 0) {
+        start = UTF8_BYTE_ORDER_MARK.length();
+    }
+    while (start < prefix.length() && std::isspace(static_cast<unsigned char>(prefix.at(start)))) {
+        ++start;
+    }
+    if (prefix.compare(start, M3U8_PLAYLIST_HEADER.length(), M3U8_PLAYLIST_HEADER) == 0) {
+        return SNIFFED_M3U_CONTENT_TYPE;
+    }
+    if (prefix.compare(start, PLS_PLAYLIST_HEADER.length(), PLS_PLAYLIST_HEADER) == 0) {
+        return SNIFFED_PLS_CONTENT_TYPE;
+    }
+    return "";
+}
+
+bool PlaylistParser::getContentFromPlaylistUrlIntoString(const std::string& url, std::string* content) const {
+    if (!content) {
+        ACSDK_ERROR(LX("getContentFromPlaylistUrlIntoStringFailed").d("reason", "nullString"));
+        return false;
+    }
+    auto contentFetcher = m_contentFetcherFactory->create(url);
+    auto httpContent =
+        contentFetcher->getContent(avsCommon::sdkInterfaces::HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY);
+    if (!httpContent) {
+        ACSDK_ERROR(LX("getContentFromPlaylistUrlIntoStringFailed").d("reason", "nullHTTPContentReceived"));
+        return false;
+    }
+    if (!(*httpContent)) {
+        ACSDK_ERROR(LX("getContentFromPlaylistUrlIntoStringFailed").d("reason", "badHTTPContentReceived"));
+        return false;
+    }
+    auto reader = httpContent->dataStream->createReader(avsCommon::utils::sds::ReaderPolicy::BLOCKING);
+    if (!reader) {
+        ACSDK_ERROR(LX("getContentFromPlaylistUrlIntoStringFailed").d("reason", "failedToCreateStreamReader"));
+        return false;
+    }
+    std::string playlistContent;
+    if (!readIntoString(reader.get(), std::string::npos, &playlistContent)) {
+        ACSDK_ERROR(LX("getContentFromPlaylistUrlIntoStringFailed").d("reason", "readError"));
+        return false;
+    }
     *content = playlistContent;
     return true;
 }
@@ -15,6 +15,8 @@
 
 #include "PlaylistParser/UrlContentToAttachmentConverter.h"
 
+#include <algorithm>
+
 #include <AVSCommon/Utils/Logger/Logger.h>
 
 namespace alexaClientSDK {
@@ -33,16 +35,41 @@ static const std::string TAG("UrlContentToAttachmentConverter");
 static const std::chrono::milliseconds UNVALID_DURATION =
     avsCommon::utils::playlistParser::PlaylistParserObserverInterface::INVALID_DURATION;
 
+/// The timeout of the blocking reads and writes which copy staged entries, after which shutdown is checked.
+static const std::chrono::milliseconds COPY_TIMEOUT(100);
+
+/// The shortest wait for the data of an entry which counts as a stall.
+static const std::chrono::milliseconds STALL_THRESHOLD(10);
+
+/// The size of the chunks in which staged entries are copied into the stream.
+static const size_t COPY_CHUNK_SIZE = 4096;
+
+const size_t UrlContentToAttachmentConverter::DEFAULT_PREFETCH_WINDOW = 3;
+
+const size_t UrlContentToAttachmentConverter::DEFAULT_MAX_PREFETCH_BYTES = 3 * 512 * 1024;
+
+UrlContentToAttachmentConverter::Segment::Segment(const std::string& url) :
+        url{url},
+        isDownloadDone{false},
+        isDownloadSuccessful{false} {
+}
+
 std::shared_ptr<UrlContentToAttachmentConverter> UrlContentToAttachmentConverter::create(
     std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory,
     const std::string& url,
     std::shared_ptr<ErrorObserverInterface> observer,
-    std::chrono::milliseconds startTime) {
+    std::chrono::milliseconds startTime,
+    size_t prefetchWindow,
+    size_t maxPrefetchBytes) {
     if (!contentFetcherFactory) {
         return nullptr;
     }
-    auto thisSharedPointer = std::shared_ptr<UrlContentToAttachmentConverter>(
-        new UrlContentToAttachmentConverter(contentFetcherFactory, url, observer, startTime));
+    if (prefetchWindow > 0 && maxPrefetchBytes < prefetchWindow) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "maxPrefetchBytesTooSmall").d("maxPrefetchBytes", maxPrefetchBytes));
+        return nullptr;
+    }
+    auto thisSharedPointer = std::shared_ptr<UrlContentToAttachmentConverter>(new UrlContentToAttachmentConverter(
+        contentFetcherFactory, url, observer, startTime, prefetchWindow, maxPrefetchBytes));
     auto retVal = thisSharedPointer->m_playlistParser->parsePlaylist(url, thisSharedPointer);
     if (0 == retVal) {
         thisSharedPointer->shutdown();
@@ -59,18 +86,28 @@ UrlContentToAttachmentConverter::UrlContentToAttachmentConverter(
     std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory,
     const std::string& url,
     std::shared_ptr<ErrorObserverInterface> observer,
-    std::chrono::milliseconds startTime) :
+    std::chrono::milliseconds startTime,
+    size_t prefetchWindow,
+    size_t maxPrefetchBytes) :
         RequiresShutdown{"UrlContentToAttachmentConverter"},
         m_desiredStreamPoint{startTime},
         m_contentFetcherFactory{contentFetcherFactory},
         m_observer{observer},
         m_shuttingDown{false},
+        m_prefetchWindow{prefetchWindow},
+        m_stagingBufferSize{prefetchWindow > 0 ? maxPrefetchBytes / prefetchWindow : 0},
+        m_areSegmentsAbandoned{false},
+        m_bufferHealth{0, 0, std::chrono::milliseconds::zero(), 0},
         m_runningTotal{0},
         m_startedStreaming{false},
         m_streamWriterClosed{false} {
+    if (m_prefetchWindow > 0) {
+        m_downloadPool.reset(new avsCommon::utils::threading::ThreadPool(m_prefetchWindow));
+    }
     m_playlistParser = PlaylistParser::create(m_contentFetcherFactory);
     m_startStreamingPointFuture = m_startStreamingPointPromise.get_future();
-    m_stream = std::make_shared<avsCommon::avs::attachment::InProcessAttachment>(url);
+    m_stream = std::make_shared<avsCommon::avs::attachment::InProcessAttachment>(
+        url, avsCommon::avs::attachment::AttachmentBufferPool::SizeHint::MEDIA_STREAM);
     m_streamWriter = m_stream->createWriter(avsCommon::utils::sds::WriterPolicy::BLOCKING);
 }
 
@@ -82,6 +119,11 @@ std::chrono::milliseconds UrlContentToAttachmentConverter::getDesiredStreamingPo
     return m_desiredStreamPoint;
 }
 
+UrlContentToAttachmentConverter::BufferHealth UrlContentToAttachmentConverter::getBufferHealth() {
+    std::lock_guard<std::mutex> lock(m_prefetchMutex);
+    return m_bufferHealth;
+}
+
 void UrlContentToAttachmentConverter::onPlaylistEntryParsed(
     int requestId,
     std::string url,
@@ -120,9 +162,15 @@ void UrlContentToAttachmentConverter::onPlaylistEntryParsed(
                 }
             });
             break;
-        case avsCommon::utils::playlistParser::PlaylistParseResult::SUCCESS:
-            m_executor.submit([this, url]() {
-                if (!m_streamWriterClosed && !writeUrlContentIntoStream(url)) {
+        case avsCommon::utils::playlistParser::PlaylistParseResult::SUCCESS: {
+            std::shared_ptr<Segment> segment;
+            if (m_prefetchWindow > 0) {
+                segment = std::make_shared<Segment>(url);
+                queueSegment(segment);
+            }
+            m_executor.submit([this, url, segment]() {
+                if (!m_streamWriterClosed &&
+                    !(segment ? writeSegmentIntoStream(segment) : writeUrlContentIntoStream(url))) {
                     ACSDK_ERROR(LX("writeUrlContentToStreamFailed"));
                     std::unique_lock<std::mutex> lock{m_mutex};
                     auto observer = m_observer;
@@ -134,14 +182,29 @@ void UrlContentToAttachmentConverter::onPlaylistEntryParsed(
                 ACSDK_DEBUG9(LX("closingWriter"));
                 m_streamWriter->close();
                 m_streamWriterClosed = true;
+                abandonSegments();
+                auto health = getBufferHealth();
+                ACSDK_DEBUG5(LX("streamFinished")
+                                 .d("entriesWritten", health.entriesWritten)
+                                 .d("stallCount", health.stallCount)
+                                 .d("stallTimeMs", health.stallTime.count())
+                                 .d("maxEntriesStaged", health.maxEntriesStaged));
             });
             break;
-        case avsCommon::utils::playlistParser::PlaylistParseResult::STILL_ONGOING:
-            m_executor.submit([this, url]() {
-                if (!m_streamWriterClosed && !writeUrlContentIntoStream(url)) {
+        }
+        case avsCommon::utils::playlistParser::PlaylistParseResult::STILL_ONGOING: {
+            std::shared_ptr<Segment> segment;
+            if (m_prefetchWindow > 0) {
+                segment = std::make_shared<Segment>(url);
+                queueSegment(segment);
+            }
+            m_executor.submit([this, url, segment]() {
+                if (!m_streamWriterClosed &&
+                    !(segment ? writeSegmentIntoStream(segment) : writeUrlContentIntoStream(url))) {
                     ACSDK_ERROR(LX("writeUrlContentToStreamFailed").d("info", "closingWriter"));
                     m_streamWriter->close();
                     m_streamWriterClosed = true;
+                    abandonSegments();
                     std::unique_lock<std::mutex> lock{m_mutex};
                     auto observer = m_observer;
                     lock.unlock();
@@ -151,6 +214,7 @@ void UrlContentToAttachmentConverter::onPlaylistEntryParsed(
                 }
             });
             break;
+        }
         default:
             return;
     }
@@ -177,6 +241,167 @@ bool UrlContentToAttachmentConverter::writeUrlContentIntoStream(std::string url)
     return true;
 }
 
+bool UrlContentToAttachmentConverter::writeSegmentIntoStream(std::shared_ptr<Segment> segment) {
+    ACSDK_DEBUG9(LX("writeSegmentIntoStream").d("info", "beginning"));
+    {
+        std::unique_lock<std::mutex> lock(m_prefetchMutex);
+        // This is the oldest entry not yet written, so its download starts as soon as it is queued.
+        m_prefetchCondition.wait(
+            lock, [this, segment]() { return segment->stagingReader || m_areSegmentsAbandoned || m_shuttingDown; });
+        if (!segment->stagingReader) {
+            return false;
+        }
+    }
+
+    std::vector<char> buffer(COPY_CHUNK_SIZE);
+    bool isStalled = false;
+    auto readStatus = avsCommon::avs::attachment::AttachmentReader::ReadStatus::OK;
+    while (readStatus != avsCommon::avs::attachment::AttachmentReader::ReadStatus::CLOSED) {
+        if (m_shuttingDown) {
+            return false;
+        }
+        auto readStart = std::chrono::steady_clock::now();
+        auto bytesRead = segment->stagingReader->read(buffer.data(), buffer.size(), &readStatus, COPY_TIMEOUT);
+        auto waitTime =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - readStart);
+        if (waitTime >= STALL_THRESHOLD) {
+            std::lock_guard<std::mutex> lock(m_prefetchMutex);
+            if (!isStalled) {
+                ++m_bufferHealth.stallCount;
+            }
+            m_bufferHealth.stallTime += waitTime;
+            isStalled = true;
+        } else if (bytesRead > 0) {
+            isStalled = false;
+        }
+        switch (readStatus) {
+            case avsCommon::avs::attachment::AttachmentReader::ReadStatus::OK:
+            case avsCommon::avs::attachment::AttachmentReader::ReadStatus::OK_WOULDBLOCK:
+            case avsCommon::avs::attachment::AttachmentReader::ReadStatus::OK_TIMEDOUT:
+            case avsCommon::avs::attachment::AttachmentReader::ReadStatus::CLOSED:
+                break;
+            case avsCommon::avs::attachment::AttachmentReader::ReadStatus::ERROR_OVERRUN:
+            case avsCommon::avs::attachment::AttachmentReader::ReadStatus::ERROR_BYTES_LESS_THAN_WORD_SIZE:
+            case avsCommon::avs::attachment::AttachmentReader::ReadStatus::ERROR_INTERNAL:
+                ACSDK_ERROR(LX("writeSegmentIntoStreamFailed").d("reason", "readFailed"));
+                return false;
+        }
+        if (bytesRead > 0 && !writeIntoStream(buffer.data(), bytesRead)) {
+            return false;
+        }
+    }
+
+    bool isDownloadSuccessful = false;
+    {
+        // The download ends before it closes the staging buffer.
+        std::lock_guard<std::mutex> lock(m_prefetchMutex);
+        isDownloadSuccessful = segment->isDownloadSuccessful;
+    }
+    releaseSegment(segment);
+    if (!isDownloadSuccessful || m_shuttingDown) {
+        return false;
+    }
+    ACSDK_DEBUG9(LX("writeSegmentIntoStreamSuccess"));
+    return true;
+}
+
+bool UrlContentToAttachmentConverter::writeIntoStream(const char* data, size_t size) {
+    size_t totalBytesWritten = 0;
+    while (totalBytesWritten < size) {
+        if (m_shuttingDown) {
+            return false;
+        }
+        auto writeStatus = avsCommon::avs::attachment::AttachmentWriter::WriteStatus::OK;
+        totalBytesWritten +=
+            m_streamWriter->write(data + totalBytesWritten, size - totalBytesWritten, &writeStatus, COPY_TIMEOUT);
+        switch (writeStatus) {
+            case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::OK:
+            case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::TIMEDOUT:
+            case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::OK_BUFFER_FULL:
+                continue;
+            case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::CLOSED:
+            case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::ERROR_BYTES_LESS_THAN_WORD_SIZE:
+            case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::ERROR_INTERNAL:
+                ACSDK_ERROR(LX("writeIntoStreamFailed").d("reason", "writeFailed"));
+                return false;
+        }
+    }
+    return true;
+}
+
+void UrlContentToAttachmentConverter::queueSegment(std::shared_ptr<Segment> segment) {
+    std::lock_guard<std::mutex> lock(m_prefetchMutex);
+    m_queuedSegments.push_back(segment);
+    startDownloadsLocked();
+}
+
+void UrlContentToAttachmentConverter::startDownloadsLocked() {
+    while (!m_areSegmentsAbandoned && !m_queuedSegments.empty() && m_stagedSegments.size() < m_prefetchWindow) {
+        auto segment = m_queuedSegments.front();
+        m_queuedSegments.pop_front();
+        // Staging buffers are all of one size, so they are reused from the pool as entries come and go.
+        segment->staging = std::make_shared<avsCommon::avs::attachment::InProcessAttachment>(
+            segment->url,
+            avsCommon::avs::attachment::AttachmentBufferPool::getDefaultPool()->createSDS(m_stagingBufferSize));
+        segment->stagingWriter = segment->staging->createWriter(avsCommon::utils::sds::WriterPolicy::BLOCKING);
+        segment->stagingReader = segment->staging->createReader(avsCommon::utils::sds::ReaderPolicy::BLOCKING);
+        if (!segment->stagingWriter || !segment->stagingReader) {
+            ACSDK_ERROR(LX("startDownloadFailed").d("reason", "createStagingBufferFailed"));
+            segment->stagingReader.reset();
+            m_areSegmentsAbandoned = true;
+            break;
+        }
+        m_stagedSegments.push_back(segment);
+        m_bufferHealth.maxEntriesStaged = std::max(m_bufferHealth.maxEntriesStaged, m_stagedSegments.size());
+        m_downloadPool->submit([this, segment]() { downloadSegment(segment); });
+    }
+    m_prefetchCondition.notify_all();
+}
+
+void UrlContentToAttachmentConverter::downloadSegment(std::shared_ptr<Segment> segment) {
+    auto contentFetcher = m_contentFetcherFactory->create(segment->url);
+    auto httpContent = contentFetcher->getContent(
+        avsCommon::sdkInterfaces::HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY, segment->stagingWriter);
+    bool isSuccessful = false;
+    if (!httpContent) {
+        ACSDK_ERROR(LX("getContentFailed").d("reason", "nullHTTPContentReceived"));
+    } else if (!(*httpContent)) {
+        ACSDK_ERROR(LX("getContentFailed").d("reason", "badHTTPContentReceived"));
+    } else {
+        isSuccessful = true;
+    }
+    // This waits for the whole body to be written into the staging buffer.
+    contentFetcher.reset();
+    {
+        std::lock_guard<std::mutex> lock(m_prefetchMutex);
+        segment->isDownloadDone = true;
+        segment->isDownloadSuccessful = isSuccessful;
+    }
+    segment->stagingWriter->close();
+}
+
+void UrlContentToAttachmentConverter::releaseSegment(std::shared_ptr<Segment> segment) {
+    std::lock_guard<std::mutex> lock(m_prefetchMutex);
+    auto it = std::find(m_stagedSegments.begin(), m_stagedSegments.end(), segment);
+    if (it != m_stagedSegments.end()) {
+        m_stagedSegments.erase(it);
+    }
+    ++m_bufferHealth.entriesWritten;
+    startDownloadsLocked();
+}
+
+void UrlContentToAttachmentConverter::abandonSegments() {
+    std::lock_guard<std::mutex> lock(m_prefetchMutex);
+    m_areSegmentsAbandoned = true;
+    m_queuedSegments.clear();
+    // Closing the staging buffers ends downloads which are waiting for them to be read.
+    for (auto& segment : m_stagedSegments) {
+        segment->stagingWriter->close();
+    }
+    m_stagedSegments.clear();
+    m_prefetchCondition.notify_all();
+}
+
 void UrlContentToAttachmentConverter::doShutdown() {
     m_streamWriter->close();
 
@@ -185,9 +410,12 @@ void UrlContentToAttachmentConverter::doShutdown() {
         m_observer.reset();
     }
     m_shuttingDown = true;
+    abandonSegments();
     m_executor.shutdown();
     m_playlistParser->shutdown();
     m_playlistParser.reset();
+    // Running downloads end once their staging buffers are closed.
+    m_downloadPool.reset();
     m_streamWriter.reset();
     if (!m_startedStreaming) {
         m_startStreamingPointPromise.set_value(std::chrono::seconds::zero());
@@ -0,0 +1,227 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file PlaylistParserBenchmarkTest.cpp
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/LibcurlUtils/HTTPContentFetcherFactory.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/PlaylistParser/PlaylistParserObserverInterface.h>
+#include <AVSCommon/Utils/Timing/LatencyHistogram.h>
+
+#include "AVSCommon/Utils/LibcurlUtils/LocalHttpServer.h"
+#include "PlaylistParser/PlaylistParser.h"
+
+namespace alexaClientSDK {
+namespace playlistParser {
+namespace test {
+
+using namespace avsCommon::sdkInterfaces;
+using namespace avsCommon::utils::playlistParser;
+using avsCommon::utils::libcurlUtils::test::LocalHttpServer;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("PlaylistParserBenchmarkTest");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The time the stand-in server waits before answering each request, like the round trip to a radio station.
+static const std::chrono::milliseconds ROUND_TRIP(20);
+
+/// The number of times each chain is parsed.
+static const int PARSE_COUNT = 10;
+
+/// Long timeout for the first URL of a playlist to be parsed (we should not reach this).
+static const std::chrono::seconds LONG_TIMEOUT(10);
+
+/// A content fetcher which does not support @c FetchOptions::CONTENT_TYPE_AND_BODY, as every fetcher used to.
+class TwoRequestContentFetcher : public HTTPContentFetcherInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param fetcher The fetcher to pass the other options to.
+     */
+    TwoRequestContentFetcher(std::unique_ptr<HTTPContentFetcherInterface> fetcher) : m_fetcher{std::move(fetcher)} {
+    }
+
+    std::unique_ptr<avsCommon::utils::HTTPContent> getContent(
+        FetchOptions option,
+        std::shared_ptr<avsCommon::avs::attachment::AttachmentWriter> writer) override {
+        if (FetchOptions::CONTENT_TYPE_AND_BODY == option) {
+            return nullptr;
+        }
+        return m_fetcher->getContent(option, writer);
+    }
+
+private:
+    /// The fetcher to pass the other options to.
+    std::unique_ptr<HTTPContentFetcherInterface> m_fetcher;
+};
+
+/// A factory of @c TwoRequestContentFetchers.
+class TwoRequestContentFetcherFactory : public HTTPContentFetcherInterfaceFactoryInterface {
+public:
+    std::unique_ptr<HTTPContentFetcherInterface> create(const std::string& url) override {
+        return std::unique_ptr<HTTPContentFetcherInterface>(
+            new TwoRequestContentFetcher(m_factory.create(url)));
+    }
+
+private:
+    /// The factory of the fetchers to pass the other options to.
+    avsCommon::utils::libcurlUtils::HTTPContentFetcherFactory m_factory;
+};
+
+/// An observer which records when the first URL arrives.
+class FirstUrlObserver : public PlaylistParserObserverInterface {
+public:
+    /**
+     * Constructor.
+     */
+    FirstUrlObserver() : m_hasFirstUrl{false} {
+    }
+
+    void onPlaylistEntryParsed(
+        int requestId,
+        std::string url,
+        PlaylistParseResult parseResult,
+        std::chrono::milliseconds duration) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_hasFirstUrl) {
+            m_hasFirstUrl = true;
+            m_firstUrl.set_value(PlaylistParseResult::ERROR == parseResult ? "" : url);
+        }
+    }
+
+    /**
+     * Waits for the first URL.
+     *
+     * @return The first URL, or an empty string if none arrived within @c LONG_TIMEOUT.
+     */
+    std::string waitForFirstUrl() {
+        auto future = m_firstUrl.get_future();
+        return std::future_status::ready == future.wait_for(LONG_TIMEOUT) ? future.get() : "";
+    }
+
+private:
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// Whether the first URL has arrived.
+    bool m_hasFirstUrl;
+
+    /// Set to the first URL.
+    std::promise<std::string> m_firstUrl;
+};
+
+/**
+ * Parses a playlist @c PARSE_COUNT times, and records the time to the first URL and the requests made.
+ *
+ * @param factory The factory of the content fetchers.
+ * @param server The server of the playlist.
+ * @param url The URL of the playlist.
+ * @param expectedFirstUrl The first URL in the playlist.
+ * @param[out] latencies The times from @c parsePlaylist() to the first URL.
+ * @param[out] requestsPerParse The number of requests made by each parse.
+ */
+static void measureTimeToFirstUrl(
+    std::shared_ptr<HTTPContentFetcherInterfaceFactoryInterface> factory,
+    LocalHttpServer* server,
+    const std::string& url,
+    const std::string& expectedFirstUrl,
+    avsCommon::utils::timing::LatencyHistogram* latencies,
+    int* requestsPerParse) {
+    auto parser = PlaylistParser::create(factory);
+    ASSERT_TRUE(parser);
+    int requestsBefore = server->getRequestCount();
+    for (int i = 0; i < PARSE_COUNT; ++i) {
+        auto observer = std::make_shared<FirstUrlObserver>();
+        auto start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(parser->parsePlaylist(url, observer));
+        ASSERT_EQ(expectedFirstUrl, observer->waitForFirstUrl());
+        latencies->record(std::chrono::steady_clock::now() - start);
+    }
+    parser->shutdown();
+    *requestsPerParse = (server->getRequestCount() - requestsBefore) / PARSE_COUNT;
+}
+
+/**
+ * Measure the time to the first URL of a PLS playlist which points to an M3U playlist, which points to an HLS
+ * playlist served without a content type, with one request per playlist and with two.
+ */
+TEST(PlaylistParserBenchmarkTest, nestedPlaylistTimeToFirstUrl) {
+    LocalHttpServer server(std::chrono::milliseconds::zero(), ROUND_TRIP);
+    ASSERT_FALSE(server.getUrl("/").empty());
+    auto firstUrl = server.getUrl("/segment1.aac");
+    auto hlsPlaylist = "#EXTM3U\n#EXT-X-TARGETDURATION:10\n#EXTINF:10,\n" + firstUrl + "\n#EXTINF:10,\n" +
+                       server.getUrl("/segment2.aac") + "\n#EXT-X-ENDLIST\n";
+    server.setResponse("/untyped.m3u8", "", hlsPlaylist);
+    server.setResponse("/untyped.m3u", "audio/x-mpegurl", server.getUrl("/untyped.m3u8") + "\n");
+    server.setResponse(
+        "/untyped.pls",
+        "audio/x-scpls",
+        "[playlist]\nNumberOfEntries=1\nFile1=" + server.getUrl("/untyped.m3u") + "\n");
+    // Without a single request, the HLS playlist cannot be sniffed, so this chain gives it its content type.
+    server.setResponse("/typed.m3u8", "application/vnd.apple.mpegurl", hlsPlaylist);
+    server.setResponse("/typed.m3u", "audio/x-mpegurl", server.getUrl("/typed.m3u8") + "\n");
+    server.setResponse(
+        "/typed.pls",
+        "audio/x-scpls",
+        "[playlist]\nNumberOfEntries=1\nFile1=" + server.getUrl("/typed.m3u") + "\n");
+
+    avsCommon::utils::timing::LatencyHistogram oneRequestLatencies;
+    int oneRequestRequests = 0;
+    measureTimeToFirstUrl(
+        std::make_shared<avsCommon::utils::libcurlUtils::HTTPContentFetcherFactory>(),
+        &server,
+        server.getUrl("/untyped.pls"),
+        firstUrl,
+        &oneRequestLatencies,
+        &oneRequestRequests);
+
+    avsCommon::utils::timing::LatencyHistogram twoRequestLatencies;
+    int twoRequestRequests = 0;
+    measureTimeToFirstUrl(
+        std::make_shared<TwoRequestContentFetcherFactory>(),
+        &server,
+        server.getUrl("/typed.pls"),
+        firstUrl,
+        &twoRequestLatencies,
+        &twoRequestRequests);
+
+    ACSDK_INFO(LX("nestedPlaylistTimeToFirstUrl")
+                   .d("roundTripMs", ROUND_TRIP.count())
+                   .d("oneRequestLatencies", oneRequestLatencies.toString())
+                   .d("oneRequestRequests", oneRequestRequests)
+                   .d("twoRequestLatencies", twoRequestLatencies.toString())
+                   .d("twoRequestRequests", twoRequestRequests));
+    ASSERT_LT(oneRequestRequests, twoRequestRequests);
+}
+
+}  // namespace test
+}  // namespace playlistParser
+}  // namespace alexaClientSDK
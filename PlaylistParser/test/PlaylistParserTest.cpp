@@ -13,6 +13,7 @@
  * permissions and limitations under the License.
  */
 
+#include <atomic>
 #include <memory>
 #include <chrono>
 #include <mutex>
@@ -225,6 +226,18 @@ static const std::vector<std::chrono::milliseconds> TEST_HLS_LIVE_STREAM_DURATIO
 
 static const size_t NUM_PARSES_EXPECTED_WHEN_NO_PARSING = 1;
 
+/// An HLS playlist served without a content type.
+static const std::string TEST_HLS_NO_CONTENT_TYPE_PLAYLIST_URL{"http://sanjayisthecoolest.com/noContentType.m3u8"};
+
+/// A PLS playlist served as plain text.
+static const std::string TEST_PLS_TEXT_PLAIN_PLAYLIST_URL{"http://sanjayisthecoolest.com/textPlain.pls"};
+
+/// The number of requests to parse @c TEST_M3U_PLAYLIST_URL with one request per URL: the playlist and its two URLs.
+static const int TEST_M3U_PLAYLIST_REQUESTS = 3;
+
+/// The number of requests to parse @c TEST_M3U_PLAYLIST_URL when the playlist needs a second request for its content.
+static const int TEST_M3U_PLAYLIST_REQUESTS_WITHOUT_CONTENT_TYPE_AND_BODY = 4;
+
 static const std::unordered_map<std::string, std::string> urlsToContentTypes{
     // Valid playlist content types
     {TEST_M3U_PLAYLIST_URL, "audio/mpegurl"},
@@ -233,6 +246,9 @@ static const std::unordered_map<std::string, std::string> urlsToContentTypes{
     {TEST_PLS_PLAYLIST_URL, "audio/x-scpls"},
     {TEST_HLS_RECURSIVE_PLAYLIST_URL, "audio/mpegurl"},
     {TEST_HLS_LIVE_STREAM_PLAYLIST_URL, "audio/mpegurl"},
+    // Playlists without a playlist content type
+    {TEST_HLS_NO_CONTENT_TYPE_PLAYLIST_URL, ""},
+    {TEST_PLS_TEXT_PLAIN_PLAYLIST_URL, "text/plain"},
     // Not playlist content types
     {"http://stream.radiotime.com/sample.mp3", "audio/mpeg"},
     {"http://live-mp3-128.kexp.org", "audio/mpeg"},
@@ -252,17 +268,49 @@ static std::unordered_map<std::string, std::string> urlsToContent{
     {TEST_HLS_PLAYLIST_URL, TEST_HLS_PLAYLIST_CONTENT},
     {TEST_PLS_PLAYLIST_URL, TEST_PLS_CONTENT},
     {TEST_HLS_RECURSIVE_PLAYLIST_URL, TEST_HLS_RECURSIVE_PLAYLIST_CONTENT},
-    {TEST_HLS_LIVE_STREAM_PLAYLIST_URL, TEST_HLS_LIVE_STREAM_PLAYLIST_CONTENT_1}};
+    {TEST_HLS_LIVE_STREAM_PLAYLIST_URL, TEST_HLS_LIVE_STREAM_PLAYLIST_CONTENT_1},
+    {TEST_HLS_NO_CONTENT_TYPE_PLAYLIST_URL, TEST_HLS_PLAYLIST_CONTENT},
+    {TEST_PLS_TEXT_PLAIN_PLAYLIST_URL, TEST_PLS_CONTENT}};
 
 /// A mock content fetcher
 class MockContentFetcher : public avsCommon::sdkInterfaces::HTTPContentFetcherInterface {
 public:
-    MockContentFetcher(const std::string& url) : m_url{url} {
+    /**
+     * Constructor.
+     *
+     * @param url The URL to fetch.
+     * @param supportsContentTypeAndBody Whether @c FetchOptions::CONTENT_TYPE_AND_BODY is supported.
+     * @param requestCount The count to increment with each request.
+     */
+    MockContentFetcher(const std::string& url, bool supportsContentTypeAndBody, std::atomic<int>* requestCount) :
+            m_url{url},
+            m_supportsContentTypeAndBody{supportsContentTypeAndBody},
+            m_requestCount{requestCount} {
     }
 
     std::unique_ptr<avsCommon::utils::HTTPContent> getContent(
         FetchOptions fetchOption,
         std::shared_ptr<avsCommon::avs::attachment::AttachmentWriter> writer) {
+        if (fetchOption == FetchOptions::CONTENT_TYPE_AND_BODY) {
+            if (!m_supportsContentTypeAndBody) {
+                return nullptr;
+            }
+            auto it1 = urlsToContentTypes.find(m_url);
+            if (it1 == urlsToContentTypes.end()) {
+                return nullptr;
+            }
+            // Only playlists have a body here, which is what the parser reads.
+            auto body = getContent(FetchOptions::ENTIRE_BODY, writer);
+            std::promise<long> statusPromise;
+            auto statusFuture = statusPromise.get_future();
+            statusPromise.set_value(200);
+            std::promise<std::string> contentTypePromise;
+            auto contentTypeFuture = contentTypePromise.get_future();
+            contentTypePromise.set_value(it1->second);
+            return avsCommon::utils::memory::make_unique<avsCommon::utils::HTTPContent>(avsCommon::utils::HTTPContent{
+                std::move(statusFuture), std::move(contentTypeFuture), body ? body->dataStream : nullptr});
+        }
+        ++*m_requestCount;
         if (fetchOption == FetchOptions::CONTENT_TYPE) {
             auto it1 = urlsToContentTypes.find(m_url);
             if (it1 == urlsToContentTypes.end()) {
@@ -325,13 +373,47 @@ private:
     };
 
     std::string m_url;
+
+    /// Whether @c FetchOptions::CONTENT_TYPE_AND_BODY is supported.
+    bool m_supportsContentTypeAndBody;
+
+    /// The count to increment with each request.
+    std::atomic<int>* m_requestCount;
 };
 
 /// A mock factory that creates mock content fetchers
 class MockContentFetcherFactory : public avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param supportsContentTypeAndBody Whether the fetchers support @c FetchOptions::CONTENT_TYPE_AND_BODY.
+     */
+    MockContentFetcherFactory(bool supportsContentTypeAndBody = true) :
+            m_supportsContentTypeAndBody{supportsContentTypeAndBody},
+            m_requestCount{0} {
+    }
+
     std::unique_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> create(const std::string& url) {
-        return avsCommon::utils::memory::make_unique<MockContentFetcher>(url);
+        return avsCommon::utils::memory::make_unique<MockContentFetcher>(
+            url, m_supportsContentTypeAndBody, &m_requestCount);
+    }
+
+    /**
+     * Returns the number of requests made by the fetchers.
+     *
+     * @return The number of requests.
+     */
+    int getRequestCount() const {
+        return m_requestCount;
     }
+
+private:
+    /// Whether the fetchers support @c FetchOptions::CONTENT_TYPE_AND_BODY.
+    bool m_supportsContentTypeAndBody;
+
+    /// The number of requests made by the fetchers.
+    std::atomic<int> m_requestCount;
 };
 
 /**
@@ -543,6 +625,58 @@ TEST_F(PlaylistParserTest, testParsingLiveStreamPlaylist) {
     }
 }
 
+/**
+ * Tests that parsing a playlist makes a single request for each URL.
+ */
+TEST_F(PlaylistParserTest, testOneRequestPerUrl) {
+    ASSERT_TRUE(playlistParser->parsePlaylist(TEST_M3U_PLAYLIST_URL, testObserver));
+    auto results = testObserver->waitForNCallbacks(TEST_M3U_PLAYLIST_URL_EXPECTED_PARSES);
+    ASSERT_EQ(TEST_M3U_PLAYLIST_URL_EXPECTED_PARSES, results.size());
+    ASSERT_EQ(TEST_M3U_PLAYLIST_REQUESTS, mockFactory->getRequestCount());
+}
+
+/**
+ * Tests that with content fetchers which do not support @c FetchOptions::CONTENT_TYPE_AND_BODY, the content of each
+ * playlist is fetched with a second request.
+ */
+TEST_F(PlaylistParserTest, testParsingWithoutContentTypeAndBody) {
+    auto legacyFactory = std::make_shared<MockContentFetcherFactory>(false);
+    auto legacyParser = PlaylistParser::create(legacyFactory);
+    ASSERT_TRUE(legacyParser->parsePlaylist(TEST_M3U_PLAYLIST_URL, testObserver));
+    auto results = testObserver->waitForNCallbacks(TEST_M3U_PLAYLIST_URL_EXPECTED_PARSES);
+    ASSERT_EQ(TEST_M3U_PLAYLIST_URL_EXPECTED_PARSES, results.size());
+    for (unsigned int i = 0; i < results.size(); ++i) {
+        ASSERT_EQ(results.at(i).url, TEST_M3U_PLAYLIST_URLS.at(i));
+    }
+    ASSERT_EQ(TEST_M3U_PLAYLIST_REQUESTS_WITHOUT_CONTENT_TYPE_AND_BODY, legacyFactory->getRequestCount());
+    legacyParser->shutdown();
+}
+
+/**
+ * Tests that an HLS playlist served without a content type is recognized by its header.
+ */
+TEST_F(PlaylistParserTest, testSniffingPlaylistWithoutContentType) {
+    ASSERT_TRUE(playlistParser->parsePlaylist(TEST_HLS_NO_CONTENT_TYPE_PLAYLIST_URL, testObserver));
+    auto results = testObserver->waitForNCallbacks(TEST_HLS_PLAYLIST_URL_EXPECTED_PARSES);
+    ASSERT_EQ(TEST_HLS_PLAYLIST_URL_EXPECTED_PARSES, results.size());
+    for (unsigned int i = 0; i < results.size(); ++i) {
+        ASSERT_EQ(results.at(i).url, TEST_HLS_PLAYLIST_URLS.at(i));
+        ASSERT_EQ(results.at(i).duration, TEST_HLS_DURATIONS.at(i));
+    }
+}
+
+/**
+ * Tests that a PLS playlist served as plain text is recognized by its header.
+ */
+TEST_F(PlaylistParserTest, testSniffingPlaylistServedAsText) {
+    ASSERT_TRUE(playlistParser->parsePlaylist(TEST_PLS_TEXT_PLAIN_PLAYLIST_URL, testObserver));
+    auto results = testObserver->waitForNCallbacks(TEST_PLS_PLAYLIST_URL_EXPECTED_PARSES);
+    ASSERT_EQ(TEST_PLS_PLAYLIST_URL_EXPECTED_PARSES, results.size());
+    for (unsigned int i = 0; i < results.size(); ++i) {
+        ASSERT_EQ(results.at(i).url, TEST_PLS_PLAYLIST_URLS.at(i));
+    }
+}
+
 }  // namespace test
 }  // namespace playlistParser
 }  // namespace alexaClientSDK
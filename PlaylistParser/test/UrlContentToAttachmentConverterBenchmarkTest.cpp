@@ -0,0 +1,222 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file UrlContentToAttachmentConverterBenchmarkTest.cpp
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/LibcurlUtils/HTTPContentFetcherFactory.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+#include "AVSCommon/Utils/LibcurlUtils/LocalHttpServer.h"
+#include "PlaylistParser/UrlContentToAttachmentConverter.h"
+
+namespace alexaClientSDK {
+namespace playlistParser {
+namespace test {
+
+using namespace avsCommon::avs::attachment;
+using namespace avsCommon::utils::libcurlUtils;
+using namespace avsCommon::utils::libcurlUtils::test;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("UrlContentToAttachmentConverterBenchmarkTest");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The round trip to the stand-in server, like that to a content delivery network.
+static const std::chrono::milliseconds ROUND_TRIP(60);
+
+/// The extra wait of every @c SLOW_SEGMENT_PERIOD th segment, like a server which is sometimes slow to answer.
+static const std::chrono::milliseconds SLOW_SEGMENT_DELAY(200);
+
+/// How often a segment is slow.
+static const int SLOW_SEGMENT_PERIOD = 3;
+
+/// The number of segments in the playlist.
+static const int SEGMENT_COUNT = 12;
+
+/// The size of each segment.
+static const size_t SEGMENT_SIZE = 32 * 1024;
+
+/// How long the consumer takes to play each segment.
+static const std::chrono::milliseconds SEGMENT_PLAY_TIME(100);
+
+/// How late a segment may arrive without counting as an underrun, which allows for the oversleeping of the player.
+static const std::chrono::milliseconds UNDERRUN_TOLERANCE(5);
+
+/// Long timeout for each read of the attachment by the player (we should not reach this).
+static const std::chrono::seconds LONG_TIMEOUT(10);
+
+/// How the consumer fared while playing the attachment.
+struct PlaybackResult {
+    /// The content played.
+    std::string content;
+    /// The number of times a segment was late.
+    int underrunCount;
+    /// The time spent waiting for late segments.
+    std::chrono::milliseconds starvedTime;
+};
+
+/// An observer which counts errors.
+class CountingErrorObserver : public UrlContentToAttachmentConverter::ErrorObserverInterface {
+public:
+    CountingErrorObserver() : errorCount{0} {
+    }
+
+    void onError() override {
+        ++errorCount;
+    }
+
+    /// The number of errors.
+    std::atomic<int> errorCount;
+};
+
+/**
+ * Play an attachment in real time: once the first data arrives, each segment is due @c SEGMENT_PLAY_TIME after the
+ * previous one, and a segment which arrives late restarts the schedule from when it arrived, as a player does after
+ * rebuffering.
+ *
+ * @param attachment The attachment.
+ * @return How the playback went.
+ */
+static PlaybackResult play(std::shared_ptr<InProcessAttachment> attachment) {
+    PlaybackResult result{"", 0, std::chrono::milliseconds::zero()};
+    auto reader = attachment->createReader(avsCommon::utils::sds::ReaderPolicy::BLOCKING);
+    std::vector<char> buffer(SEGMENT_SIZE);
+    auto readStatus = AttachmentReader::ReadStatus::OK;
+    bool isPlaying = false;
+    auto due = std::chrono::steady_clock::now();
+    while (readStatus != AttachmentReader::ReadStatus::CLOSED) {
+        size_t segmentBytes = 0;
+        while (segmentBytes < SEGMENT_SIZE && readStatus != AttachmentReader::ReadStatus::CLOSED) {
+            segmentBytes += reader->read(
+                buffer.data() + segmentBytes, SEGMENT_SIZE - segmentBytes, &readStatus, LONG_TIMEOUT);
+            if (AttachmentReader::ReadStatus::OK_TIMEDOUT == readStatus) {
+                return result;
+            }
+        }
+        if (0 == segmentBytes) {
+            break;
+        }
+        auto arrived = std::chrono::steady_clock::now();
+        if (!isPlaying) {
+            isPlaying = true;
+            due = arrived;
+        } else if (arrived > due + UNDERRUN_TOLERANCE) {
+            ++result.underrunCount;
+            result.starvedTime += std::chrono::duration_cast<std::chrono::milliseconds>(arrived - due);
+            due = arrived;
+        } else {
+            due = std::max(due, arrived);
+        }
+        result.content.append(buffer.data(), segmentBytes);
+        due += SEGMENT_PLAY_TIME;
+        std::this_thread::sleep_until(due);
+    }
+    return result;
+}
+
+/**
+ * Stream the playlist through a converter, and play the attachment.
+ *
+ * @param server The server of the playlist.
+ * @param prefetchWindow The number of segments the converter downloads concurrently.
+ * @param[out] health The buffer health reported by the converter.
+ * @return How the playback went.
+ */
+static PlaybackResult streamPlaylist(
+    LocalHttpServer* server,
+    size_t prefetchWindow,
+    UrlContentToAttachmentConverter::BufferHealth* health) {
+    auto observer = std::make_shared<CountingErrorObserver>();
+    auto converter = UrlContentToAttachmentConverter::create(
+        std::make_shared<HTTPContentFetcherFactory>(),
+        server->getUrl("/playlist.m3u8"),
+        observer,
+        std::chrono::milliseconds::zero(),
+        prefetchWindow);
+    EXPECT_TRUE(converter);
+    if (!converter) {
+        return {"", 0, std::chrono::milliseconds::zero()};
+    }
+    auto result = play(converter->getAttachment());
+    *health = converter->getBufferHealth();
+    converter->shutdown();
+    EXPECT_EQ(observer->errorCount, 0);
+    return result;
+}
+
+/**
+ * Measure the underruns of a real-time player of an HLS stream, whose server is sometimes slow, with each segment
+ * downloaded after the previous one, as before, and with the default prefetch window.
+ */
+TEST(UrlContentToAttachmentConverterBenchmarkTest, underrunsWithSlowSegments) {
+    LocalHttpServer serialServer(std::chrono::milliseconds::zero(), ROUND_TRIP);
+    LocalHttpServer prefetchServer(std::chrono::milliseconds::zero(), ROUND_TRIP);
+    std::string playlist = "#EXTM3U\n#EXT-X-TARGETDURATION:1\n";
+    std::string expectedContent;
+    for (int i = 0; i < SEGMENT_COUNT; ++i) {
+        std::string segment(SEGMENT_SIZE, static_cast<char>('a' + i % 26));
+        auto path = "/segment" + std::to_string(i) + ".ts";
+        auto delay = (i % SLOW_SEGMENT_PERIOD == SLOW_SEGMENT_PERIOD - 1) ? SLOW_SEGMENT_DELAY
+                                                                           : std::chrono::milliseconds::zero();
+        serialServer.setResponse(path, "video/MP2T", segment, delay);
+        prefetchServer.setResponse(path, "video/MP2T", segment, delay);
+        playlist += "#EXTINF:0.1,\n" + path.substr(1) + "\n";
+        expectedContent += segment;
+    }
+    playlist += "#EXT-X-ENDLIST\n";
+    serialServer.setResponse("/playlist.m3u8", "application/vnd.apple.mpegurl", playlist);
+    prefetchServer.setResponse("/playlist.m3u8", "application/vnd.apple.mpegurl", playlist);
+
+    UrlContentToAttachmentConverter::BufferHealth serialHealth;
+    auto serial = streamPlaylist(&serialServer, 0, &serialHealth);
+    UrlContentToAttachmentConverter::BufferHealth prefetchHealth;
+    auto prefetch =
+        streamPlaylist(&prefetchServer, UrlContentToAttachmentConverter::DEFAULT_PREFETCH_WINDOW, &prefetchHealth);
+
+    ACSDK_INFO(LX("underrunsWithSlowSegments")
+                   .d("segments", SEGMENT_COUNT)
+                   .d("serialUnderruns", serial.underrunCount)
+                   .d("serialStarvedMs", serial.starvedTime.count())
+                   .d("prefetchUnderruns", prefetch.underrunCount)
+                   .d("prefetchStarvedMs", prefetch.starvedTime.count())
+                   .d("prefetchStalls", prefetchHealth.stallCount)
+                   .d("prefetchStallMs", prefetchHealth.stallTime.count())
+                   .d("prefetchMaxEntriesStaged", prefetchHealth.maxEntriesStaged));
+
+    ASSERT_TRUE(serial.content == expectedContent);
+    ASSERT_TRUE(prefetch.content == expectedContent);
+    ASSERT_EQ(prefetchHealth.entriesWritten, static_cast<size_t>(SEGMENT_COUNT));
+    ASSERT_LE(prefetchHealth.maxEntriesStaged, UrlContentToAttachmentConverter::DEFAULT_PREFETCH_WINDOW);
+}
+
+}  // namespace test
+}  // namespace playlistParser
+}  // namespace alexaClientSDK
@@ -52,6 +52,10 @@ public:
         avsCommon::avs::AudioInputStream::Index beginIndex = UNSPECIFIED_INDEX,
         avsCommon::avs::AudioInputStream::Index endIndex = UNSPECIFIED_INDEX,
         std::shared_ptr<const std::vector<char>> KWDMetadata = nullptr) override;
+
+    void onKeyWordCandidate(std::shared_ptr<avsCommon::avs::AudioInputStream> stream, std::string keyword) override;
+
+    void onKeyWordRejected(std::shared_ptr<avsCommon::avs::AudioInputStream> stream, std::string keyword) override;
     /// @}
 
 private:
@@ -52,5 +52,21 @@ void KeywordObserver::onKeyWordDetected(
     }
 }
 
+void KeywordObserver::onKeyWordCandidate(
+    std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+    std::string keyword) {
+    if (m_client) {
+        m_client->notifyOfKeyWordCandidate(keyword);
+    }
+}
+
+void KeywordObserver::onKeyWordRejected(
+    std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+    std::string keyword) {
+    if (m_client) {
+        m_client->notifyOfKeyWordRejected();
+    }
+}
+
 }  // namespace sampleApp
 }  // namespace alexaClientSDK
@@ -22,6 +22,10 @@
 #include <KWDProvider/KeywordDetectorProvider.h>
 #endif
 
+#ifdef OPUS_ENCODER
+#include <AIP/OpusAudioEncoder.h>
+#endif
+
 #ifdef ENABLE_ESP
 #include <ESP/ESPDataProvider.h>
 #else
@@ -318,17 +322,27 @@ bool SampleApplication::initialize(
         return false;
     }
 
+    /*
+     * The earcons played by the notifications, ringtone and alerts media players are decoded once, and then played
+     * from this cache rather than decoded again each time they are played.
+     */
+    auto decodedAudioCache = alexaClientSDK::mediaPlayer::DecodedAudioCache::create();
+
     m_notificationsMediaPlayer = alexaClientSDK::mediaPlayer::MediaPlayer::create(
         httpContentFetcherFactory,
         avsCommon::sdkInterfaces::SpeakerInterface::Type::AVS_SYNCED,
-        "NotificationsMediaPlayer");
+        "NotificationsMediaPlayer",
+        decodedAudioCache);
     if (!m_notificationsMediaPlayer) {
         ACSDK_CRITICAL(LX("Failed to create media player for notifications!"));
         return false;
     }
 
     m_ringtoneMediaPlayer = alexaClientSDK::mediaPlayer::MediaPlayer::create(
-        httpContentFetcherFactory, avsCommon::sdkInterfaces::SpeakerInterface::Type::AVS_SYNCED, "RingtoneMediaPlayer");
+        httpContentFetcherFactory,
+        avsCommon::sdkInterfaces::SpeakerInterface::Type::AVS_SYNCED,
+        "RingtoneMediaPlayer",
+        decodedAudioCache);
     if (!m_ringtoneMediaPlayer) {
         alexaClientSDK::sampleApp::ConsolePrinter::simplePrint("Failed to create media player for ringtones!");
         return false;
@@ -340,7 +354,10 @@ bool SampleApplication::initialize(
      * control.
      */
     m_alertsMediaPlayer = alexaClientSDK::mediaPlayer::MediaPlayer::create(
-        httpContentFetcherFactory, avsCommon::sdkInterfaces::SpeakerInterface::Type::LOCAL, "AlertsMediaPlayer");
+        httpContentFetcherFactory,
+        avsCommon::sdkInterfaces::SpeakerInterface::Type::LOCAL,
+        "AlertsMediaPlayer",
+        decodedAudioCache);
     if (!m_alertsMediaPlayer) {
         ACSDK_CRITICAL(LX("Failed to create media player for alerts!"));
         return false;
@@ -373,6 +390,27 @@ bool SampleApplication::initialize(
 
     auto audioFactory = std::make_shared<alexaClientSDK::applicationUtilities::resources::audio::AudioFactory>();
 
+    // Decode the earcons in the background, so that even the first time each is played it need not be decoded.
+    if (decodedAudioCache) {
+        auto alertsAudio = audioFactory->alerts();
+        auto notificationsAudio = audioFactory->notifications();
+        auto communicationsAudio = audioFactory->communications();
+        for (const auto& streamFunction : {alertsAudio->alarmDefault(),
+                                           alertsAudio->timerDefault(),
+                                           alertsAudio->reminderDefault(),
+                                           alertsAudio->alarmShort(),
+                                           alertsAudio->timerShort(),
+                                           alertsAudio->reminderShort(),
+                                           notificationsAudio->notificationDefault(),
+                                           communicationsAudio->callIncomingRingtone(),
+                                           communicationsAudio->outboundRingtone(),
+                                           communicationsAudio->callConnectedRingtone(),
+                                           communicationsAudio->callDisconnectedRingtone(),
+                                           communicationsAudio->dropInConnectedRingtone()}) {
+            decodedAudioCache->prefetch(streamFunction);
+        }
+    }
+
     // Creating the alert storage object to be used for rendering and storing alerts.
     auto alertStorage =
         alexaClientSDK::capabilityAgents::alerts::storage::SQLiteAlertStorage::create(config, audioFactory->alerts());
@@ -466,6 +504,20 @@ bool SampleApplication::initialize(
         ACSDK_CRITICAL(LX("Failed to create InternetConnectionMonitor"));
         return false;
     }
+
+    /*
+     * Creating the encoder of Recognize audio - when the SDK is built with Opus, the captured PCM is compressed before
+     * it is streamed to AVS.
+     */
+    std::shared_ptr<capabilityAgents::aip::AudioEncoderInterface> audioEncoder;
+#ifdef OPUS_ENCODER
+    audioEncoder = capabilityAgents::aip::OpusAudioEncoder::create();
+    if (!audioEncoder) {
+        ACSDK_CRITICAL(LX("Failed to create OpusAudioEncoder"));
+        return false;
+    }
+#endif
+
     /*
      * Creating the DefaultClient - this component serves as an out-of-box default object that instantiates and "glues"
      * together all the modules.
@@ -499,7 +551,8 @@ bool SampleApplication::initialize(
             m_dcfDelegate,
             firmwareVersion,
             true,
-            nullptr);
+            nullptr,
+            audioEncoder);
 
     if (!client) {
         ACSDK_CRITICAL(LX("Failed to create default SDK client!"));
@@ -16,12 +16,17 @@
 #ifndef ALEXA_CLIENT_SDK_STORAGE_SQLITESTORAGE_INCLUDE_SQLITESTORAGE_SQLITEDATABASE_H_
 #define ALEXA_CLIENT_SDK_STORAGE_SQLITESTORAGE_INCLUDE_SQLITESTORAGE_SQLITEDATABASE_H_
 
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <sqlite3.h>
 
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <SQLiteStorage/SQLiteStatement.h>
 
 namespace alexaClientSDK {
@@ -32,16 +37,45 @@ namespace sqliteStorage {
  * A basic class for performing basic SQLite database operations.  This the boilerplate code used to manage the
  * SQLiteDatabase.  This database is not thread-safe, and must be protected before being used in a mutlithreaded
  * fashion.
+ *
+ * By default every write is committed, and synced to storage, as its own transaction.  When a maximum commit delay is
+ * given, the database is instead used in group-commit mode: it is switched to a WAL journal, writes are made inside a
+ * transaction which stays open, and a background thread commits that transaction no later than the delay after the
+ * first write in it.  A burst of writes then costs one sync instead of one each, and the threads making the writes
+ * never wait for storage.  Reads through this object see the writes which are still waiting to be committed, since
+ * they are made on the same connection.  A crash or power loss loses at most the writes of the last delay, and never
+ * leaves a transaction half-applied.
  */
 class SQLiteDatabase {
 public:
+    /**
+     * Reads the maximum commit delay from the configuration of a database, which is the node that also holds its
+     * @c databaseFilePath.  For example, this enables group commit with a delay of 100 milliseconds:
+     *
+     * @code{.json}
+     * "settings": {
+     *     "databaseFilePath": "/home/ubuntu/Build/settings.db",
+     *     "maxCommitDelayInMilliseconds": 100
+     * }
+     * @endcode
+     *
+     * @param databaseConfiguration The configuration of the database.
+     * @return The maximum commit delay, or zero if none is set.
+     */
+    static std::chrono::milliseconds getMaxCommitDelay(
+        const avsCommon::utils::configuration::ConfigurationNode& databaseConfiguration);
+
     /**
      * Constructor.  The internal variables are initialized.
      *
      * @param filePath The location of the file that the SQLite DB will use as it's backing storage when initialize or
      * open are called.
+     * @param maxCommitDelay The longest a write may wait to be committed, which enables group-commit mode if it is not
+     * zero.
      */
-    SQLiteDatabase(const std::string& filePath);
+    SQLiteDatabase(
+        const std::string& filePath,
+        std::chrono::milliseconds maxCommitDelay = std::chrono::milliseconds::zero());
 
     /**
      * Destructor.
@@ -94,10 +128,19 @@ public:
     bool clearTable(const std::string& tableName);
 
     /**
-     * If open, close the internal SQLite DB.  Do nothing if there is no DB open.
+     * If open, close the internal SQLite DB.  Do nothing if there is no DB open.  In group-commit mode, the writes
+     * waiting to be committed are committed first.
      */
     void close();
 
+    /**
+     * In group-commit mode, commits the writes waiting to be committed straight away, for callers which need them to
+     * be durable before they go on.  Does nothing otherwise.
+     *
+     * @return true if there is no write left to commit, false if there was an error.
+     */
+    bool commit();
+
     /**
      * Create an SQLiteStatement object to execute the provided string.
      *
@@ -114,11 +157,64 @@ public:
     bool isDatabaseReady();
 
 private:
+    /**
+     * Switches a newly opened database to group-commit mode, if it is enabled.
+     *
+     * @return true if successful, false if there was an error.
+     */
+    bool startGroupCommit();
+
+    /**
+     * Stops the committer thread and commits the writes waiting to be committed.
+     */
+    void stopGroupCommit();
+
+    /**
+     * Records that a write has been made, so that the committer thread commits it.
+     */
+    void onWrite();
+
+    /**
+     * Commits the open transaction and begins the next one.
+     *
+     * @return true if the transaction was committed, false if there was an error.
+     */
+    bool commitTransaction();
+
+    /**
+     * The loop of the committer thread.
+     */
+    void commitLoop();
+
     /// The path to use when creating/opening the internal SQLite DB.
     const std::string m_storageFilePath;
 
+    /// The longest a write may wait to be committed, or zero if every write is committed straight away.
+    const std::chrono::milliseconds m_maxCommitDelay;
+
     /// The sqlite database handle.
     sqlite3* m_dbHandle;
+
+    /// Serializes commits made by the committer thread and by @c commit().
+    std::mutex m_transactionMutex;
+
+    /// Protects the committer thread's state below.
+    std::mutex m_commitMutex;
+
+    /// Notified when a write is made and when the committer thread must stop.
+    std::condition_variable m_commitCondition;
+
+    /// Whether there are writes waiting to be committed.
+    bool m_hasPendingWrites;
+
+    /// When the first of the writes waiting to be committed was made.
+    std::chrono::steady_clock::time_point m_firstPendingWrite;
+
+    /// Whether the committer thread must stop.
+    bool m_stopCommitter;
+
+    /// The thread which commits in group-commit mode.
+    std::thread m_committerThread;
 };
 
 }  // namespace sqliteStorage
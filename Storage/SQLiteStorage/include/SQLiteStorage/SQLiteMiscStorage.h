@@ -16,6 +16,12 @@
 #ifndef ALEXA_CLIENT_SDK_STORAGE_SQLITESTORAGE_INCLUDE_SQLITESTORAGE_SQLITEMISCSTORAGE_H_
 #define ALEXA_CLIENT_SDK_STORAGE_SQLITESTORAGE_INCLUDE_SQLITESTORAGE_SQLITEMISCSTORAGE_H_
 
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 #include <AVSCommon/SDKInterfaces/Storage/MiscStorageInterface.h>
 #include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <SQLiteStorage/SQLiteDatabase.h>
@@ -104,58 +110,133 @@ private:
      * Constructor.
      *
      * @param dbFilePath The location of the SQLite database file.
+     * @param maxCommitDelay The longest a write may wait to be committed, or zero to commit every write straight
+     * away.  See @c SQLiteDatabase.
      */
-    SQLiteMiscStorage(const std::string& dbFilePath);
+    SQLiteMiscStorage(const std::string& dbFilePath, std::chrono::milliseconds maxCommitDelay);
+
+    /**
+     * The schema of a table, and the statements prepared for it.  An entry is made the first time a table is used and
+     * kept until the table is deleted or the database is closed, so that the common operations do not have to query
+     * the schema or compile their SQL on every call.
+     */
+    struct CachedTable {
+        /// The key column type.
+        KeyType keyType;
+
+        /// The value column type.
+        ValueType valueType;
+
+        /// Selects the value for a key.
+        std::unique_ptr<SQLiteStatement> getStatement;
+
+        /// Inserts a new entry.
+        std::unique_ptr<SQLiteStatement> addStatement;
+
+        /// Updates the value of an existing entry.
+        std::unique_ptr<SQLiteStatement> updateStatement;
+
+        /// Inserts an entry, or replaces the value of an existing one.
+        std::unique_ptr<SQLiteStatement> putStatement;
+
+        /// Deletes an entry.
+        std::unique_ptr<SQLiteStatement> removeStatement;
+    };
 
     /**
-     * Method that will get the key column type and value column type.
+     * Method that will find the cache entry of a table, reading the table's schema from the database if it has not
+     * been used before.  This must be called with @c m_mutex held.
      *
      * @param componentName The component name.
      * @param tableName The table name.
-     * @param [out] *keyType The key column type.
-     * @param [out] *valueType The value column name.
-     * @return true if the key and value column types were found, else false
+     * @param [out] errorReason Set to the reason if the table could not be found.
+     * @return The cache entry, or @c nullptr if the database is not ready or the table does not exist.
      */
-    bool getKeyValueTypes(
+    CachedTable* getCachedTable(
         const std::string& componentName,
         const std::string& tableName,
-        KeyType* keyType,
-        ValueType* valueType);
+        std::string* errorReason);
+
+    /**
+     * Method that will read the key column type and value column type from the database.
+     *
+     * @param dbTableName The table name as it is in the DB.
+     * @param [out] *keyType The key column type.
+     * @param [out] *valueType The value column name.
+     * @return true if the key and value column types were read, else false
+     */
+    bool readKeyValueTypes(const std::string& dbTableName, KeyType* keyType, ValueType* valueType);
+
+    /**
+     * Method that will get a cached statement ready to be bound and run, preparing it if this is its first use.
+     *
+     * @param [in,out] statement The cached statement.
+     * @param sqlString The SQL of the statement, which is only used when it is prepared.
+     * @return The statement, or @c nullptr if it could not be prepared or reset.
+     */
+    SQLiteStatement* getCachedStatement(std::unique_ptr<SQLiteStatement>* statement, const std::string& sqlString);
+
+    /**
+     * Method that will read the value of a key with the table's cached statement.  This must be called with
+     * @c m_mutex held.
+     *
+     * @param table The cache entry of the table.
+     * @param dbTableName The table name as it is in the DB.
+     * @param key The key.
+     * @param [out] value Set to the value, or left untouched if there is no entry for the key.
+     * @return true if the query succeeded, else false
+     */
+    bool getValue(CachedTable* table, const std::string& dbTableName, const std::string& key, std::string* value);
+
+    /**
+     * Method that will run one of the table's cached statements which write to it.  This must be called with
+     * @c m_mutex held.
+     *
+     * @param [in,out] statement The cached statement.
+     * @param sqlString The SQL of the statement, with the key as its first parameter.
+     * @param key The key.
+     * @param value The value, which is bound as the second parameter unless it is @c nullptr.
+     * @return true if the statement ran successfully, else false
+     */
+    bool runWriteStatement(
+        std::unique_ptr<SQLiteStatement>* statement,
+        const std::string& sqlString,
+        const std::string& key,
+        const std::string* value);
 
     /**
      * Helper method that will check key column type.
      *
-     * @param componentName The component name.
-     * @param tableName The table name to check.
+     * @param table The cache entry of the table to check.
      * @param keyType The KeyType that needs to be matched.
      * @return an error message if the checks fail, else a blank string
      */
-    std::string checkKeyType(const std::string& componentName, const std::string& tableName, KeyType keyType);
+    std::string checkKeyType(const CachedTable& table, KeyType keyType);
 
     /**
      * Helper method that will check value column type.
      *
-     * @param componentName The component name.
-     * @param tableName The table name to check.
+     * @param table The cache entry of the table to check.
      * @param valueType The ValueType that needs to be matched.
      * @return an error message if the checks fail, else a blank string
      */
-    std::string checkValueType(const std::string& componentName, const std::string& tableName, ValueType valueType);
+    std::string checkValueType(const CachedTable& table, ValueType valueType);
 
     /**
      * Helper method that will check key and value column type.
      *
-     * @param componentName The component name.
-     * @param tableName The table name to check.
+     * @param table The cache entry of the table to check.
      * @param keyType The KeyType that needs to be matched.
      * @param valueType The ValueType that needs to be matched.
      * @return an error message if the checks fail, else a blank string
      */
-    std::string checkKeyValueType(
-        const std::string& componentName,
-        const std::string& tableName,
-        KeyType keyType,
-        ValueType valueType);
+    std::string checkKeyValueType(const CachedTable& table, KeyType keyType, ValueType valueType);
+
+    /// Serializes access to the database and the cache, which may be used from several threads.
+    std::mutex m_mutex;
+
+    /// The tables used so far, by their name in the DB.
+    std::unordered_map<std::string, CachedTable> m_tableCache;
 
     /// The underlying database class.
     alexaClientSDK::storage::sqliteStorage::SQLiteDatabase m_db;
@@ -17,6 +17,7 @@
 #define ALEXA_CLIENT_SDK_STORAGE_SQLITESTORAGE_INCLUDE_SQLITESTORAGE_SQLITESTATEMENT_H_
 
 #include <sqlite3.h>
+#include <functional>
 #include <string>
 
 namespace alexaClientSDK {
@@ -70,6 +71,14 @@ public:
      */
     bool reset();
 
+    /**
+     * Sets all the parameters bound to the statement back to NULL.  Together with @c reset(), this lets a statement be
+     * prepared once and run many times with different parameters.
+     *
+     * @return Whether the bindings were cleared.
+     */
+    bool clearBindings();
+
     /**
      * Binds an integer to an index within a query.
      * NOTE: The left-most index for SQLite bind operations begins at 1, not 0.
@@ -178,12 +187,23 @@ public:
      */
     void finalize();
 
+    /**
+     * Sets a function to be called after each successful step of this statement, if the statement writes to the
+     * database.  @c SQLiteDatabase uses this to learn when there are writes to commit.
+     *
+     * @param onWrite The function to call.
+     */
+    void setOnWrite(std::function<void()> onWrite);
+
 private:
     /// Our internal SQLite statement handle.
     sqlite3_stmt* m_handle;
 
     /// The result of the last step operation.
     int m_stepResult;
+
+    /// Called after each successful step, if this statement writes to the database.
+    std::function<void()> m_onWrite;
 };
 
 }  // namespace sqliteStorage
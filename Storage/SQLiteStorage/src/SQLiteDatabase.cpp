@@ -34,9 +34,27 @@ static const std::string TAG("SQLiteDatabase");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-SQLiteDatabase::SQLiteDatabase(const std::string& storageFilePath) :
+/// The key in a database's configuration for its maximum commit delay.
+static const std::string MAX_COMMIT_DELAY_KEY = "maxCommitDelayInMilliseconds";
+
+std::chrono::milliseconds SQLiteDatabase::getMaxCommitDelay(
+    const avsCommon::utils::configuration::ConfigurationNode& databaseConfiguration) {
+    std::chrono::milliseconds maxCommitDelay;
+    databaseConfiguration.getDuration<std::chrono::milliseconds>(
+        MAX_COMMIT_DELAY_KEY, &maxCommitDelay, std::chrono::milliseconds::zero());
+    if (maxCommitDelay < std::chrono::milliseconds::zero()) {
+        ACSDK_WARN(LX("getMaxCommitDelay").d("reason", "negativeDelayIgnored").d("delay", maxCommitDelay.count()));
+        return std::chrono::milliseconds::zero();
+    }
+    return maxCommitDelay;
+}
+
+SQLiteDatabase::SQLiteDatabase(const std::string& storageFilePath, std::chrono::milliseconds maxCommitDelay) :
         m_storageFilePath{storageFilePath},
-        m_dbHandle{nullptr} {
+        m_maxCommitDelay{maxCommitDelay},
+        m_dbHandle{nullptr},
+        m_hasPendingWrites{false},
+        m_stopCommitter{false} {
 }
 
 SQLiteDatabase::~SQLiteDatabase() {
@@ -68,6 +86,11 @@ bool SQLiteDatabase::initialize() {
         return false;
     }
 
+    if (!startGroupCommit()) {
+        close();
+        return false;
+    }
+
     return true;
 }
 
@@ -88,6 +111,11 @@ bool SQLiteDatabase::open() {
         return false;
     }
 
+    if (!startGroupCommit()) {
+        close();
+        return false;
+    }
+
     return true;
 }
 
@@ -101,6 +129,7 @@ bool SQLiteDatabase::performQuery(const std::string& sqlString) {
         return false;
     }
 
+    onWrite();
     return true;
 }
 
@@ -119,11 +148,13 @@ bool SQLiteDatabase::clearTable(const std::string& tableName) {
         return false;
     }
 
+    onWrite();
     return true;
 }
 
 void SQLiteDatabase::close() {
     if (m_dbHandle) {
+        stopGroupCommit();
         closeSQLiteDatabase(m_dbHandle);
         m_dbHandle = nullptr;
     }
@@ -136,11 +167,140 @@ std::unique_ptr<alexaClientSDK::storage::sqliteStorage::SQLiteStatement> SQLiteD
     if (!statement->isValid()) {
         ACSDK_ERROR(LX("createStatementFailed").d("sqlString", sqlString));
         statement = nullptr;
+    } else if (m_maxCommitDelay > std::chrono::milliseconds::zero()) {
+        statement->setOnWrite([this] { onWrite(); });
     }
 
     return statement;
 }
 
+bool SQLiteDatabase::commit() {
+    if (!m_committerThread.joinable()) {
+        return true;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_commitMutex);
+        m_hasPendingWrites = false;
+    }
+    if (!commitTransaction()) {
+        onWrite();
+        return false;
+    }
+    return true;
+}
+
+bool SQLiteDatabase::startGroupCommit() {
+    if (m_maxCommitDelay <= std::chrono::milliseconds::zero()) {
+        return true;
+    }
+
+    // The committer thread uses the connection at the same time as the callers, which needs SQLite's serialized mode.
+    if (!sqlite3_db_mutex(m_dbHandle)) {
+        ACSDK_WARN(LX("startGroupCommit")
+                       .d("reason", "connectionNotSerialized")
+                       .m("Committing every write straight away instead."));
+        return true;
+    }
+
+    auto statement = createStatement("PRAGMA journal_mode=WAL;");
+    const int JOURNAL_MODE_COLUMN = 0;
+    if (!statement || !statement->step() || SQLITE_ROW != statement->getStepResult() ||
+        statement->getColumnText(JOURNAL_MODE_COLUMN) != "wal") {
+        ACSDK_ERROR(LX("startGroupCommitFailed").d("reason", "couldNotEnableWal").d("file path", m_storageFilePath));
+        return false;
+    }
+    statement->finalize();
+
+    if (!alexaClientSDK::storage::sqliteStorage::performQuery(m_dbHandle, "BEGIN;")) {
+        ACSDK_ERROR(LX("startGroupCommitFailed").d("reason", "couldNotBeginTransaction"));
+        return false;
+    }
+
+    m_hasPendingWrites = false;
+    m_stopCommitter = false;
+    m_committerThread = std::thread(&SQLiteDatabase::commitLoop, this);
+    return true;
+}
+
+void SQLiteDatabase::stopGroupCommit() {
+    if (!m_committerThread.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_commitMutex);
+        m_stopCommitter = true;
+    }
+    m_commitCondition.notify_one();
+    m_committerThread.join();
+
+    if (!sqlite3_get_autocommit(m_dbHandle) &&
+        !alexaClientSDK::storage::sqliteStorage::performQuery(m_dbHandle, "COMMIT;")) {
+        ACSDK_ERROR(LX("stopGroupCommitFailed").d("reason", "couldNotCommit").d("file path", m_storageFilePath));
+    }
+}
+
+void SQLiteDatabase::onWrite() {
+    if (m_maxCommitDelay <= std::chrono::milliseconds::zero()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_commitMutex);
+    if (!m_hasPendingWrites) {
+        m_hasPendingWrites = true;
+        m_firstPendingWrite = std::chrono::steady_clock::now();
+        m_commitCondition.notify_one();
+    }
+}
+
+bool SQLiteDatabase::commitTransaction() {
+    std::lock_guard<std::mutex> lock(m_transactionMutex);
+
+    // If an earlier BEGIN failed, the writes since then were committed as they were made.
+    if (!sqlite3_get_autocommit(m_dbHandle) &&
+        !alexaClientSDK::storage::sqliteStorage::performQuery(m_dbHandle, "COMMIT;")) {
+        // This fails if a caller is in the middle of a write, and the transaction then stays open.
+        ACSDK_WARN(LX("commitTransactionFailed").d("file path", m_storageFilePath));
+        return false;
+    }
+
+    if (!alexaClientSDK::storage::sqliteStorage::performQuery(m_dbHandle, "BEGIN;")) {
+        ACSDK_ERROR(LX("commitTransactionFailed").d("reason", "couldNotBeginTransaction"));
+    }
+    return true;
+}
+
+void SQLiteDatabase::commitLoop() {
+    std::unique_lock<std::mutex> lock(m_commitMutex);
+    while (true) {
+        m_commitCondition.wait(lock, [this] { return m_stopCommitter || m_hasPendingWrites; });
+        if (m_stopCommitter) {
+            return;
+        }
+
+        auto deadline = m_firstPendingWrite + m_maxCommitDelay;
+        if (m_commitCondition.wait_until(lock, deadline, [this] { return m_stopCommitter; })) {
+            return;
+        }
+        if (!m_hasPendingWrites) {
+            // commit() got there first.
+            continue;
+        }
+
+        // Writes made from now on set the flag again, so that they are committed by the next cycle if this commit
+        // misses them.  The lock is released so that writers calling onWrite() never wait for the sync.
+        m_hasPendingWrites = false;
+        lock.unlock();
+        bool committed = commitTransaction();
+        lock.lock();
+        if (!committed && !m_hasPendingWrites) {
+            m_hasPendingWrites = true;
+            m_firstPendingWrite = std::chrono::steady_clock::now();
+        }
+    }
+}
+
 }  // namespace sqliteStorage
 }  // namespace storage
 }  // namespace alexaClientSDK
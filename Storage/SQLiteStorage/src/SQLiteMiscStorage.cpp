@@ -58,8 +58,6 @@ static const std::string UNKNOWN_KEY_VALUE_TYPE = "UNKNOWN";
 /// DB type
 static const std::string TEXT_DB_TYPE = "TEXT";
 
-/// Boolean to check if table exists
-static const bool CHECK_TABLE_EXISTS = true;
 /// Boolean to check if table doesn't exist
 static const bool CHECK_TABLE_NOT_EXISTS = false;
 
@@ -138,10 +136,12 @@ std::unique_ptr<SQLiteMiscStorage> SQLiteMiscStorage::create(const Configuration
         return nullptr;
     }
 
-    return std::unique_ptr<SQLiteMiscStorage>(new SQLiteMiscStorage(miscDbFilePath));
+    return std::unique_ptr<SQLiteMiscStorage>(new SQLiteMiscStorage(
+        miscDbFilePath, SQLiteDatabase::getMaxCommitDelay(miscDatabaseConfigurationRoot)));
 }
 
-SQLiteMiscStorage::SQLiteMiscStorage(const std::string& dbFilePath) : m_db{dbFilePath} {
+SQLiteMiscStorage::SQLiteMiscStorage(const std::string& dbFilePath, std::chrono::milliseconds maxCommitDelay) :
+        m_db{dbFilePath, maxCommitDelay} {
 }
 
 SQLiteMiscStorage::~SQLiteMiscStorage() {
@@ -149,6 +149,8 @@ SQLiteMiscStorage::~SQLiteMiscStorage() {
 }
 
 bool SQLiteMiscStorage::open() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tableCache.clear();
     if (!m_db.open()) {
         ACSDK_ERROR(LX("openDatabaseFailed"));
         return false;
@@ -158,10 +160,15 @@ bool SQLiteMiscStorage::open() {
 }
 
 void SQLiteMiscStorage::close() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // The cached statements must be finalized before the database can be closed.
+    m_tableCache.clear();
     m_db.close();
 }
 
 bool SQLiteMiscStorage::createDatabase() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tableCache.clear();
     if (!m_db.initialize()) {
         ACSDK_ERROR(LX("createDatabaseFailed"));
         return false;
@@ -257,32 +264,44 @@ std::string getDBDataType(const std::string& keyValueType) {
     return "";
 }
 
-bool SQLiteMiscStorage::getKeyValueTypes(
+SQLiteMiscStorage::CachedTable* SQLiteMiscStorage::getCachedTable(
     const std::string& componentName,
     const std::string& tableName,
-    KeyType* keyType,
-    ValueType* valueType) {
-    const std::string errorEvent = "getKeyValueTypesFailed";
-    const std::string errorReason = basicDBChecks(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    std::string* errorReason) {
+    *errorReason = basicDBChecks(m_db, componentName, tableName);
+    if (!errorReason->empty()) {
+        return nullptr;
+    }
 
-    if (!errorReason.empty()) {
-        ACSDK_ERROR(LX(errorEvent).m(errorReason));
-        return false;
+    std::string dbTableName = getDBTableName(componentName, tableName);
+    auto it = m_tableCache.find(dbTableName);
+    if (it != m_tableCache.end()) {
+        return &it->second;
     }
 
-    if (!keyType || !valueType) {
-        ACSDK_ERROR(LX(errorEvent).m("Key/value pointers are null"));
-        return false;
+    if (!m_db.tableExists(dbTableName)) {
+        *errorReason = "Table does not exist";
+        return nullptr;
     }
 
-    std::string dbTableName = getDBTableName(componentName, tableName);
+    CachedTable table;
+    if (!readKeyValueTypes(dbTableName, &table.keyType, &table.valueType)) {
+        *errorReason = "Unable to get key/value column types";
+        return nullptr;
+    }
+
+    return &(m_tableCache[dbTableName] = std::move(table));
+}
+
+bool SQLiteMiscStorage::readKeyValueTypes(const std::string& dbTableName, KeyType* keyType, ValueType* valueType) {
+    const std::string errorEvent = "readKeyValueTypesFailed";
 
     const std::string sqlString = "PRAGMA table_info(" + dbTableName + ");";
 
     auto sqlStatement = m_db.createStatement(sqlString);
 
     if ((!sqlStatement) || (!sqlStatement->step())) {
-        ACSDK_ERROR(LX(errorEvent).d("Could not get metadata of table", tableName));
+        ACSDK_ERROR(LX(errorEvent).d("Could not get metadata of table", dbTableName));
         return false;
     }
 
@@ -291,6 +310,9 @@ bool SQLiteMiscStorage::getKeyValueTypes(
 
     std::string columnName, columnType;
 
+    *keyType = KeyType::UNKNOWN_KEY;
+    *valueType = ValueType::UNKNOWN_VALUE;
+
     while (SQLITE_ROW == sqlStatement->getStepResult()) {
         int numberColumns = sqlStatement->getColumnCount();
 
@@ -332,114 +354,119 @@ bool SQLiteMiscStorage::getKeyValueTypes(
     return true;
 }
 
-std::string SQLiteMiscStorage::checkKeyType(
-    const std::string& componentName,
-    const std::string& tableName,
-    KeyType keyType) {
-    if (keyType == KeyType::UNKNOWN_KEY) {
-        return "Cannot check for unknown key column type";
+SQLiteStatement* SQLiteMiscStorage::getCachedStatement(
+    std::unique_ptr<SQLiteStatement>* statement,
+    const std::string& sqlString) {
+    if (!*statement) {
+        *statement = m_db.createStatement(sqlString);
+        return statement->get();
     }
 
-    const std::string basicDBChecksError = basicDBChecks(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
-    if (!basicDBChecksError.empty()) {
-        return basicDBChecksError;
+    if (!(*statement)->reset() || !(*statement)->clearBindings()) {
+        statement->reset();
+        return nullptr;
     }
 
-    KeyType keyColumnType;
-    ValueType valueColumnType;
+    return statement->get();
+}
 
-    if (!getKeyValueTypes(componentName, tableName, &keyColumnType, &valueColumnType)) {
-        return "Unable to get key column type";
+bool SQLiteMiscStorage::getValue(
+    CachedTable* table,
+    const std::string& dbTableName,
+    const std::string& key,
+    std::string* value) {
+    const std::string sqlString =
+        "SELECT " + VALUE_COLUMN_NAME + " FROM " + dbTableName + " WHERE " + KEY_COLUMN_NAME + "=?;";
+    auto sqlStatement = getCachedStatement(&table->getStatement, sqlString);
+    if (!sqlStatement) {
+        return false;
     }
 
-    if (keyColumnType == KeyType::UNKNOWN_KEY) {
-        return "Unknown key column type";
+    const int KEY_PARAMETER_INDEX = 1;
+    if (!sqlStatement->bindStringParameter(KEY_PARAMETER_INDEX, key) || !sqlStatement->step()) {
+        sqlStatement->reset();
+        return false;
     }
 
-    if (keyColumnType != keyType) {
-        return "Unexpected key column type";
+    if (SQLITE_ROW == sqlStatement->getStepResult()) {
+        const int RESULT_COLUMN_POSITION = 0;
+        *value = sqlStatement->getColumnText(RESULT_COLUMN_POSITION);
     }
 
-    return "";
+    // Reset now rather than on the next use, so that the statement does not keep a read transaction open.
+    sqlStatement->reset();
+    return true;
 }
 
-std::string SQLiteMiscStorage::checkValueType(
-    const std::string& componentName,
-    const std::string& tableName,
-    ValueType valueType) {
-    if (valueType == ValueType::UNKNOWN_VALUE) {
-        return "Cannot check for unknown value column type";
+bool SQLiteMiscStorage::runWriteStatement(
+    std::unique_ptr<SQLiteStatement>* statement,
+    const std::string& sqlString,
+    const std::string& key,
+    const std::string* value) {
+    auto sqlStatement = getCachedStatement(statement, sqlString);
+    if (!sqlStatement) {
+        return false;
     }
 
-    const std::string basicDBChecksError = basicDBChecks(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
-    if (!basicDBChecksError.empty()) {
-        return basicDBChecksError;
-    }
+    const int KEY_PARAMETER_INDEX = 1;
+    const int VALUE_PARAMETER_INDEX = 2;
+    bool success = sqlStatement->bindStringParameter(KEY_PARAMETER_INDEX, key) &&
+                   (!value || sqlStatement->bindStringParameter(VALUE_PARAMETER_INDEX, *value)) &&
+                   sqlStatement->step();
 
-    KeyType keyColumnType;
-    ValueType valueColumnType;
+    // The bound strings belong to the caller, so they must not be left bound once this returns.
+    sqlStatement->reset();
+    sqlStatement->clearBindings();
+    return success;
+}
 
-    if (!getKeyValueTypes(componentName, tableName, &keyColumnType, &valueColumnType)) {
-        return "Unable to get value column type";
+std::string SQLiteMiscStorage::checkKeyType(const CachedTable& table, KeyType keyType) {
+    if (keyType == KeyType::UNKNOWN_KEY) {
+        return "Cannot check for unknown key column type";
     }
 
-    if (valueColumnType == ValueType::UNKNOWN_VALUE) {
-        return "Unknown value column type";
+    if (table.keyType == KeyType::UNKNOWN_KEY) {
+        return "Unknown key column type";
     }
 
-    if (valueColumnType != valueType) {
-        return "Unexpected value column type";
+    if (table.keyType != keyType) {
+        return "Unexpected key column type";
     }
 
     return "";
 }
 
-std::string SQLiteMiscStorage::checkKeyValueType(
-    const std::string& componentName,
-    const std::string& tableName,
-    KeyType keyType,
-    ValueType valueType) {
-    if (keyType == KeyType::UNKNOWN_KEY) {
-        return "Cannot check for unknown key column type";
-    }
+std::string SQLiteMiscStorage::checkValueType(const CachedTable& table, ValueType valueType) {
     if (valueType == ValueType::UNKNOWN_VALUE) {
         return "Cannot check for unknown value column type";
     }
 
-    const std::string basicDBChecksError = basicDBChecks(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
-    if (!basicDBChecksError.empty()) {
-        return basicDBChecksError;
-    }
-
-    KeyType keyColumnType;
-    ValueType valueColumnType;
-
-    if (!getKeyValueTypes(componentName, tableName, &keyColumnType, &valueColumnType)) {
-        return "Unable to get key/value column types";
-    }
-
-    if (keyColumnType == KeyType::UNKNOWN_KEY) {
-        return "Unknown key column type";
-    }
-    if (valueColumnType == ValueType::UNKNOWN_VALUE) {
+    if (table.valueType == ValueType::UNKNOWN_VALUE) {
         return "Unknown value column type";
     }
 
-    if (keyColumnType != keyType) {
-        return "Unexpected key column type";
-    }
-    if (valueColumnType != valueType) {
+    if (table.valueType != valueType) {
         return "Unexpected value column type";
     }
 
     return "";
 }
 
+std::string SQLiteMiscStorage::checkKeyValueType(const CachedTable& table, KeyType keyType, ValueType valueType) {
+    const std::string keyTypeError = checkKeyType(table, keyType);
+    if (!keyTypeError.empty()) {
+        return keyTypeError;
+    }
+
+    return checkValueType(table, valueType);
+}
+
 bool SQLiteMiscStorage::createTable(
     const std::string& componentName,
     const std::string& tableName,
     KeyType keyType,
     ValueType valueType) {
+    std::lock_guard<std::mutex> lock(m_mutex);
     const std::string errorEvent = "createTableFailed";
     const std::string errorReason = basicDBChecks(m_db, componentName, tableName, CHECK_TABLE_NOT_EXISTS);
 
@@ -470,14 +497,20 @@ bool SQLiteMiscStorage::createTable(
         return false;
     }
 
+    // The schema is known, so there is no need to read it back on first use.
+    CachedTable& table = m_tableCache[dbTableName];
+    table.keyType = keyType;
+    table.valueType = valueType;
+
     return true;
 }
 
 bool SQLiteMiscStorage::clearTable(const std::string& componentName, const std::string& tableName) {
+    std::lock_guard<std::mutex> lock(m_mutex);
     const std::string errorEvent = "clearTableFailed";
-    const std::string errorReason = basicDBChecks(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    std::string errorReason;
 
-    if (!errorReason.empty()) {
+    if (!getCachedTable(componentName, tableName, &errorReason)) {
         ACSDK_ERROR(LX(errorEvent).m(errorReason));
         return false;
     }
@@ -493,10 +526,11 @@ bool SQLiteMiscStorage::clearTable(const std::string& componentName, const std::
 }
 
 bool SQLiteMiscStorage::deleteTable(const std::string& componentName, const std::string& tableName) {
+    std::lock_guard<std::mutex> lock(m_mutex);
     const std::string errorEvent = "deleteTableFailed";
-    const std::string errorReason = basicDBChecks(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    std::string errorReason;
 
-    if (!errorReason.empty()) {
+    if (!getCachedTable(componentName, tableName, &errorReason)) {
         ACSDK_ERROR(LX(errorEvent).m(errorReason));
         return false;
     }
@@ -514,6 +548,9 @@ bool SQLiteMiscStorage::deleteTable(const std::string& componentName, const std:
         return false;
     }
 
+    // The table's statements must be finalized before it can be dropped.
+    m_tableCache.erase(dbTableName);
+
     const std::string sqlString = "DROP TABLE IF EXISTS " + dbTableName + ";";
     if (!m_db.performQuery(sqlString)) {
         ACSDK_ERROR(LX(errorEvent).d("Could not delete table", tableName));
@@ -528,6 +565,7 @@ bool SQLiteMiscStorage::get(
     const std::string& tableName,
     const std::string& key,
     std::string* value) {
+    std::lock_guard<std::mutex> lock(m_mutex);
     const std::string errorEvent = "getFromTableFailed";
 
     if (!value) {
@@ -535,34 +573,24 @@ bool SQLiteMiscStorage::get(
         return false;
     }
 
-    const std::string errorReason = basicDBChecks(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
-    if (!errorReason.empty()) {
+    std::string errorReason;
+    auto table = getCachedTable(componentName, tableName, &errorReason);
+    if (!table) {
         ACSDK_ERROR(LX(errorEvent).m(errorReason));
         return false;
     }
 
-    std::string dbTableName = getDBTableName(componentName, tableName);
-
-    const std::string keyTypeError = checkKeyType(componentName, tableName, KeyType::STRING_KEY);
+    const std::string keyTypeError = checkKeyType(*table, KeyType::STRING_KEY);
     if (!keyTypeError.empty()) {
         ACSDK_ERROR(LX(errorEvent).m(keyTypeError));
         return false;
     }
 
-    const std::string sqlString = "SELECT value FROM " + dbTableName + " WHERE " + KEY_COLUMN_NAME + "='" + key + "';";
-
-    auto sqliteStatement = m_db.createStatement(sqlString);
-
-    if ((!sqliteStatement) || (!sqliteStatement->step())) {
+    if (!getValue(table, getDBTableName(componentName, tableName), key, value)) {
         ACSDK_ERROR(LX(errorEvent).d("Could not get value for " + key + " from table", tableName));
         return false;
     }
 
-    if (SQLITE_ROW == sqliteStatement->getStepResult()) {
-        const int RESULT_COLUMN_POSITION = 0;
-        *value = sqliteStatement->getColumnText(RESULT_COLUMN_POSITION);
-    }
-
     return true;
 }
 
@@ -571,6 +599,7 @@ bool SQLiteMiscStorage::tableEntryExists(
     const std::string& tableName,
     const std::string& key,
     bool* tableEntryExistsValue) {
+    std::lock_guard<std::mutex> lock(m_mutex);
     const std::string errorEvent = "tableEntryExistsFailed";
 
     if (!tableEntryExistsValue) {
@@ -578,26 +607,21 @@ bool SQLiteMiscStorage::tableEntryExists(
         return false;
     }
 
-    const std::string errorReason = basicDBChecks(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
-    if (!errorReason.empty()) {
+    std::string errorReason;
+    auto table = getCachedTable(componentName, tableName, &errorReason);
+    if (!table) {
         ACSDK_ERROR(LX(errorEvent).m(errorReason));
         return false;
     }
 
-    KeyType keyColumnType;
-    ValueType valueColumnType;
-    if (!getKeyValueTypes(componentName, tableName, &keyColumnType, &valueColumnType)) {
-        ACSDK_ERROR(LX(errorEvent).m("Unable to get key/value column types"));
-        return false;
-    }
-    if (keyColumnType != KeyType::STRING_KEY) {
+    if (table->keyType != KeyType::STRING_KEY) {
         ACSDK_ERROR(LX(errorEvent).m("Unexpected key column types"));
         return false;
     }
 
-    if (valueColumnType == ValueType::STRING_VALUE) {
+    if (table->valueType == ValueType::STRING_VALUE) {
         std::string tableEntry;
-        if (!get(componentName, tableName, key, &tableEntry)) {
+        if (!getValue(table, getDBTableName(componentName, tableName), key, &tableEntry)) {
             ACSDK_ERROR(LX(errorEvent).m("Unable to get table entry"));
             return false;
         }
@@ -612,6 +636,7 @@ bool SQLiteMiscStorage::tableExists(
     const std::string& componentName,
     const std::string& tableName,
     bool* tableExistsValue) {
+    std::lock_guard<std::mutex> lock(m_mutex);
     const std::string errorEvent = "tableExistsFailed";
 
     if (!tableExistsValue) {
@@ -626,7 +651,7 @@ bool SQLiteMiscStorage::tableExists(
     }
 
     std::string dbTableName = getDBTableName(componentName, tableName);
-    *tableExistsValue = m_db.tableExists(dbTableName);
+    *tableExistsValue = m_tableCache.count(dbTableName) || m_db.tableExists(dbTableName);
     return true;
 }
 
@@ -635,37 +660,38 @@ bool SQLiteMiscStorage::add(
     const std::string& tableName,
     const std::string& key,
     const std::string& value) {
+    std::lock_guard<std::mutex> lock(m_mutex);
     const std::string errorEvent = "addToTableFailed";
-    const std::string errorReason = basicDBChecks(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    std::string errorReason;
+    auto table = getCachedTable(componentName, tableName, &errorReason);
 
-    if (!errorReason.empty()) {
+    if (!table) {
         ACSDK_ERROR(LX(errorEvent).m(errorReason));
         return false;
     }
 
-    const std::string keyValueTypeError =
-        checkKeyValueType(componentName, tableName, KeyType::STRING_KEY, ValueType::STRING_VALUE);
+    const std::string keyValueTypeError = checkKeyValueType(*table, KeyType::STRING_KEY, ValueType::STRING_VALUE);
     if (!keyValueTypeError.empty()) {
         ACSDK_ERROR(LX(errorEvent).m(keyValueTypeError));
         return false;
     }
 
-    bool tableEntryExistsValue;
-    if (!tableEntryExists(componentName, tableName, key, &tableEntryExistsValue)) {
+    std::string dbTableName = getDBTableName(componentName, tableName);
+
+    std::string tableEntry;
+    if (!getValue(table, dbTableName, key, &tableEntry)) {
         ACSDK_ERROR(LX(errorEvent).d("Unable to get table entry information for " + key + " in table", tableName));
         return false;
     }
-    if (tableEntryExistsValue) {
+    if (!tableEntry.empty()) {
         ACSDK_ERROR(LX(errorEvent).d("An entry already exists for " + key + " in table", tableName));
         return false;
     }
 
-    std::string dbTableName = getDBTableName(componentName, tableName);
-
-    const std::string sqlString = "INSERT INTO " + dbTableName + " (" + KEY_COLUMN_NAME + ", " + VALUE_COLUMN_NAME +
-                                  ") VALUES ('" + key + "', '" + value + "');";
+    const std::string sqlString =
+        "INSERT INTO " + dbTableName + " (" + KEY_COLUMN_NAME + ", " + VALUE_COLUMN_NAME + ") VALUES (?, ?);";
 
-    if (!m_db.performQuery(sqlString)) {
+    if (!runWriteStatement(&table->addStatement, sqlString, key, &value)) {
         ACSDK_ERROR(LX(errorEvent).d("Could not add entry (" + key + ", " + value + ") to table", tableName));
         return false;
     }
@@ -678,37 +704,39 @@ bool SQLiteMiscStorage::update(
     const std::string& tableName,
     const std::string& key,
     const std::string& value) {
+    std::lock_guard<std::mutex> lock(m_mutex);
     const std::string errorEvent = "updateTableEntryFailed";
-    const std::string errorReason = basicDBChecks(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    std::string errorReason;
+    auto table = getCachedTable(componentName, tableName, &errorReason);
 
-    if (!errorReason.empty()) {
+    if (!table) {
         ACSDK_ERROR(LX(errorEvent).m(errorReason));
         return false;
     }
 
-    const std::string keyValueTypeError =
-        checkKeyValueType(componentName, tableName, KeyType::STRING_KEY, ValueType::STRING_VALUE);
+    const std::string keyValueTypeError = checkKeyValueType(*table, KeyType::STRING_KEY, ValueType::STRING_VALUE);
     if (!keyValueTypeError.empty()) {
         ACSDK_ERROR(LX(errorEvent).m(keyValueTypeError));
         return false;
     }
 
-    bool tableEntryExistsValue;
-    if (!tableEntryExists(componentName, tableName, key, &tableEntryExistsValue)) {
+    std::string dbTableName = getDBTableName(componentName, tableName);
+
+    std::string tableEntry;
+    if (!getValue(table, dbTableName, key, &tableEntry)) {
         ACSDK_ERROR(LX(errorEvent).d("Unable to get table entry information for " + key + " in table", tableName));
         return false;
     }
-    if (!tableEntryExistsValue) {
+    if (tableEntry.empty()) {
         ACSDK_ERROR(LX(errorEvent).d("An entry does not exist for " + key + " in table", tableName));
         return false;
     }
 
-    std::string dbTableName = getDBTableName(componentName, tableName);
-
-    const std::string sqlString = "UPDATE " + dbTableName + " SET " + VALUE_COLUMN_NAME + "='" + value + "' WHERE " +
-                                  KEY_COLUMN_NAME + "='" + key + "';";
+    // The parameters are numbered so that the key is the first, as for the other write statements.
+    const std::string sqlString =
+        "UPDATE " + dbTableName + " SET " + VALUE_COLUMN_NAME + "=?2 WHERE " + KEY_COLUMN_NAME + "=?1;";
 
-    if (!m_db.performQuery(sqlString)) {
+    if (!runWriteStatement(&table->updateStatement, sqlString, key, &value)) {
         ACSDK_ERROR(LX(errorEvent).d("Could not update entry for " + key + " in table", tableName));
         return false;
     }
@@ -721,44 +749,30 @@ bool SQLiteMiscStorage::put(
     const std::string& tableName,
     const std::string& key,
     const std::string& value) {
+    std::lock_guard<std::mutex> lock(m_mutex);
     const std::string errorEvent = "putToTableFailed";
-    const std::string errorReason = basicDBChecks(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    std::string errorReason;
+    auto table = getCachedTable(componentName, tableName, &errorReason);
 
-    if (!errorReason.empty()) {
+    if (!table) {
         ACSDK_ERROR(LX(errorEvent).m(errorReason));
         return false;
     }
 
-    const std::string keyValueTypeError =
-        checkKeyValueType(componentName, tableName, KeyType::STRING_KEY, ValueType::STRING_VALUE);
+    const std::string keyValueTypeError = checkKeyValueType(*table, KeyType::STRING_KEY, ValueType::STRING_VALUE);
     if (!keyValueTypeError.empty()) {
         ACSDK_ERROR(LX(errorEvent).m(keyValueTypeError));
         return false;
     }
 
-    bool tableEntryExistsValue;
-    if (!tableEntryExists(componentName, tableName, key, &tableEntryExistsValue)) {
-        ACSDK_ERROR(LX(errorEvent).d("Unable to get table entry information for " + key + " in table", tableName));
-        return false;
-    }
-
     std::string dbTableName = getDBTableName(componentName, tableName);
 
-    std::string sqlString;
-    std::string errorValue;
-
-    if (!tableEntryExistsValue) {
-        sqlString = "INSERT INTO " + dbTableName + " (" + KEY_COLUMN_NAME + ", " + VALUE_COLUMN_NAME + ") VALUES ('" +
-                    key + "', '" + value + "');";
-        errorValue = "Could not add entry (" + key + ", " + value + ") to table";
-    } else {
-        sqlString = "UPDATE " + dbTableName + " SET " + VALUE_COLUMN_NAME + "='" + value + "' WHERE " +
-                    KEY_COLUMN_NAME + "='" + key + "';";
-        errorValue = "Could not update entry for " + key + " in table";
-    }
+    // The key is the primary key, so replacing the row on a conflict inserts or updates in a single statement.
+    const std::string sqlString = "INSERT OR REPLACE INTO " + dbTableName + " (" + KEY_COLUMN_NAME + ", " +
+                                  VALUE_COLUMN_NAME + ") VALUES (?, ?);";
 
-    if (!m_db.performQuery(sqlString)) {
-        ACSDK_ERROR(LX(errorEvent).d(errorValue, tableName));
+    if (!runWriteStatement(&table->putStatement, sqlString, key, &value)) {
+        ACSDK_ERROR(LX(errorEvent).d("Could not put entry (" + key + ", " + value + ") to table", tableName));
         return false;
     }
 
@@ -766,35 +780,37 @@ bool SQLiteMiscStorage::put(
 }
 
 bool SQLiteMiscStorage::remove(const std::string& componentName, const std::string& tableName, const std::string& key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
     const std::string errorEvent = "removeTableEntryFailed";
-    const std::string errorReason = basicDBChecks(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    std::string errorReason;
+    auto table = getCachedTable(componentName, tableName, &errorReason);
 
-    if (!errorReason.empty()) {
+    if (!table) {
         ACSDK_ERROR(LX(errorEvent).m(errorReason));
         return false;
     }
 
-    const std::string keyTypeError = checkKeyType(componentName, tableName, KeyType::STRING_KEY);
+    const std::string keyTypeError = checkKeyType(*table, KeyType::STRING_KEY);
     if (!keyTypeError.empty()) {
         ACSDK_ERROR(LX(errorEvent).m(keyTypeError));
         return false;
     }
 
-    bool tableEntryExistsValue;
-    if (!tableEntryExists(componentName, tableName, key, &tableEntryExistsValue)) {
+    std::string dbTableName = getDBTableName(componentName, tableName);
+
+    std::string tableEntry;
+    if (!getValue(table, dbTableName, key, &tableEntry)) {
         ACSDK_ERROR(LX(errorEvent).d("Unable to get table entry information for " + key + " in table", tableName));
         return false;
     }
-    if (!tableEntryExistsValue) {
+    if (tableEntry.empty()) {
         ACSDK_ERROR(LX(errorEvent).d("An entry does not exist for " + key + " in table", tableName));
         return false;
     }
 
-    std::string dbTableName = getDBTableName(componentName, tableName);
-
-    const std::string sqlString = "DELETE FROM " + dbTableName + " WHERE " + KEY_COLUMN_NAME + "='" + key + "';";
+    const std::string sqlString = "DELETE FROM " + dbTableName + " WHERE " + KEY_COLUMN_NAME + "=?;";
 
-    if (!m_db.performQuery(sqlString)) {
+    if (!runWriteStatement(&table->removeStatement, sqlString, key, nullptr)) {
         ACSDK_ERROR(LX(errorEvent).d("Could not remove entry for " + key + " in table", tableName));
         return false;
     }
@@ -806,10 +822,12 @@ bool SQLiteMiscStorage::load(
     const std::string& componentName,
     const std::string& tableName,
     std::unordered_map<std::string, std::string>* valueContainer) {
+    std::lock_guard<std::mutex> lock(m_mutex);
     const std::string errorEvent = "loadFromTableFailed";
-    const std::string errorReason = basicDBChecks(m_db, componentName, tableName, CHECK_TABLE_EXISTS);
+    std::string errorReason;
+    auto table = getCachedTable(componentName, tableName, &errorReason);
 
-    if (!errorReason.empty()) {
+    if (!table) {
         ACSDK_ERROR(LX(errorEvent).m(errorReason));
         return false;
     }
@@ -819,8 +837,7 @@ bool SQLiteMiscStorage::load(
         return false;
     }
 
-    const std::string keyValueTypeError =
-        checkKeyValueType(componentName, tableName, KeyType::STRING_KEY, ValueType::STRING_VALUE);
+    const std::string keyValueTypeError = checkKeyValueType(*table, KeyType::STRING_KEY, ValueType::STRING_VALUE);
     if (!keyValueTypeError.empty()) {
         ACSDK_ERROR(LX(errorEvent).m(keyValueTypeError));
         return false;
@@ -72,13 +72,26 @@ bool SQLiteStatement::step() {
         return false;
     }
 
+    if (m_onWrite) {
+        m_onWrite();
+    }
+
     return true;
 }
 
 bool SQLiteStatement::reset() {
     int rcode = sqlite3_reset(m_handle);
     if (rcode != SQLITE_OK) {
-        ACSDK_ERROR(LX("SQLiteStatement::stepFailed").m("Could not reset the prepared statement.").d("rcode", rcode));
+        ACSDK_ERROR(LX("SQLiteStatement::resetFailed").m("Could not reset the prepared statement.").d("rcode", rcode));
+        return false;
+    }
+    return true;
+}
+
+bool SQLiteStatement::clearBindings() {
+    int rcode = sqlite3_clear_bindings(m_handle);
+    if (rcode != SQLITE_OK) {
+        ACSDK_ERROR(LX("SQLiteStatement::clearBindingsFailed").m("Could not clear the bindings.").d("rcode", rcode));
         return false;
     }
     return true;
@@ -214,6 +227,12 @@ void SQLiteStatement::finalize() {
     }
 }
 
+void SQLiteStatement::setOnWrite(std::function<void()> onWrite) {
+    if (m_handle && !sqlite3_stmt_readonly(m_handle)) {
+        m_onWrite = std::move(onWrite);
+    }
+}
+
 }  // namespace sqliteStorage
 }  // namespace storage
 }  // namespace alexaClientSDK
@@ -14,7 +14,13 @@
  */
 
 #include <chrono>
+#include <csignal>
 #include <cstdlib>
+#include <thread>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include <gtest/gtest.h>
 
@@ -29,6 +35,21 @@ namespace test {
 /// Variable for storing the working directory.  This is where all of the test databases will be created.
 static std::string g_workingDirectory;
 
+/// The table written by the group-commit tests.
+static const std::string TABLE_NAME = "rows";
+
+/// A commit delay which no group-commit test waits for.
+static const std::chrono::milliseconds LONG_COMMIT_DELAY(10000);
+
+/// A commit delay short enough for many commits to happen during a test.
+static const std::chrono::milliseconds SHORT_COMMIT_DELAY(5);
+
+/// Long timeout for the committer thread to commit a write (we should not reach this).
+static const std::chrono::seconds LONG_TIMEOUT(5);
+
+/// The exit code of a child process which failed before it could be killed.
+static const int CHILD_FAILURE = 1;
+
 /// An example of a path that doesn't exist in a system.
 static const std::string BAD_PATH =
     "_/_/_/there/is/no/way/this/path/should/exist/,/so/it/should/cause/an/error/when/creating/the/db";
@@ -48,6 +69,69 @@ static std::string generateDbFilePath() {
     return filePath;
 }
 
+/**
+ * Helper function that creates the table written by the group-commit tests.
+ *
+ * @param db The database.
+ * @return Whether the table was created.
+ */
+static bool createRowsTable(SQLiteDatabase* db) {
+    return db->performQuery("CREATE TABLE " + TABLE_NAME + " (id INT PRIMARY KEY NOT NULL);");
+}
+
+/**
+ * Helper function that inserts one row into the table written by the group-commit tests.
+ *
+ * @param db The database.
+ * @param id The id of the row.
+ * @return Whether the row was inserted.
+ */
+static bool insertRow(SQLiteDatabase* db, int id) {
+    auto statement = db->createStatement("INSERT INTO " + TABLE_NAME + " (id) VALUES (?);");
+    return statement && statement->bindIntParameter(1, id) && statement->step();
+}
+
+/**
+ * Helper function that counts the rows in the table written by the group-commit tests.
+ *
+ * @param db The database.
+ * @param[out] maxId The largest id, or -1 if there are no rows.
+ * @return The number of rows, or -1 if they could not be counted.
+ */
+static int countRows(SQLiteDatabase* db, int* maxId = nullptr) {
+    auto statement = db->createStatement("SELECT COUNT(*), IFNULL(MAX(id), -1) FROM " + TABLE_NAME + ";");
+    if (!statement || !statement->step() || SQLITE_ROW != statement->getStepResult()) {
+        return -1;
+    }
+    if (maxId) {
+        *maxId = statement->getColumnInt(1);
+    }
+    return statement->getColumnInt(0);
+}
+
+/**
+ * Helper function that checks the integrity of a database.
+ *
+ * @param db The database.
+ * @return Whether SQLite found the database intact.
+ */
+static bool isIntact(SQLiteDatabase* db) {
+    auto statement = db->createStatement("PRAGMA integrity_check;");
+    return statement && statement->step() && SQLITE_ROW == statement->getStepResult() &&
+           "ok" == statement->getColumnText(0);
+}
+
+/**
+ * Helper function that waits for a child process which is expected to be killed.
+ *
+ * @param pid The child process.
+ * @return Whether the child was killed by @c SIGKILL, rather than exiting.
+ */
+static bool waitForKilledChild(pid_t pid) {
+    int status = 0;
+    return waitpid(pid, &status, 0) == pid && WIFSIGNALED(status) && SIGKILL == WTERMSIG(status);
+}
+
 /// Test to close DB then open it.
 TEST(SQLiteDatabaseTest, CloseThenOpen) {
     auto dbFilePath = generateDbFilePath();
@@ -130,6 +214,142 @@ TEST(SQLiteDatabaseTest, OpenTwice) {
     db1.close();
 }
 
+/// Test that in group-commit mode, reads see the writes which are not yet committed, and other connections do not.
+TEST(SQLiteDatabaseTest, GroupCommitReadsSeePendingWrites) {
+    auto dbFilePath = generateDbFilePath();
+    SQLiteDatabase db(dbFilePath, LONG_COMMIT_DELAY);
+    ASSERT_TRUE(db.initialize());
+    ASSERT_TRUE(createRowsTable(&db));
+    ASSERT_TRUE(db.commit());
+
+    ASSERT_TRUE(insertRow(&db, 0));
+    ASSERT_TRUE(insertRow(&db, 1));
+    ASSERT_EQ(countRows(&db), 2);
+
+    SQLiteDatabase other(dbFilePath);
+    ASSERT_TRUE(other.open());
+    ASSERT_EQ(countRows(&other), 0);
+
+    ASSERT_TRUE(db.commit());
+    ASSERT_EQ(countRows(&other), 2);
+
+    other.close();
+    db.close();
+}
+
+/// Test that in group-commit mode, writes are committed by the committer thread once the delay has passed.
+TEST(SQLiteDatabaseTest, GroupCommitCommitsAfterDelay) {
+    auto dbFilePath = generateDbFilePath();
+    SQLiteDatabase db(dbFilePath, SHORT_COMMIT_DELAY);
+    ASSERT_TRUE(db.initialize());
+    ASSERT_TRUE(createRowsTable(&db));
+    ASSERT_TRUE(insertRow(&db, 0));
+
+    SQLiteDatabase other(dbFilePath);
+    ASSERT_TRUE(other.open());
+    auto deadline = std::chrono::steady_clock::now() + LONG_TIMEOUT;
+    while (countRows(&other) != 1 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(SHORT_COMMIT_DELAY);
+    }
+    ASSERT_EQ(countRows(&other), 1);
+
+    other.close();
+    db.close();
+}
+
+/// Test that in group-commit mode, closing the database commits the writes which are not yet committed.
+TEST(SQLiteDatabaseTest, GroupCommitCloseCommitsPendingWrites) {
+    auto dbFilePath = generateDbFilePath();
+    SQLiteDatabase db(dbFilePath, LONG_COMMIT_DELAY);
+    ASSERT_TRUE(db.initialize());
+    ASSERT_TRUE(createRowsTable(&db));
+    ASSERT_TRUE(insertRow(&db, 0));
+    db.close();
+
+    SQLiteDatabase reopened(dbFilePath);
+    ASSERT_TRUE(reopened.open());
+    ASSERT_EQ(countRows(&reopened), 1);
+    reopened.close();
+}
+
+/**
+ * Test that when the writer is killed in the middle of a batch, the database is intact, the committed writes are all
+ * there, and none of the writes of the batch is.
+ */
+TEST(SQLiteDatabaseTest, GroupCommitKillMidBatchLosesOnlyTheBatch) {
+    const int COMMITTED_ROWS = 100;
+    const int PENDING_ROWS = 50;
+    auto dbFilePath = generateDbFilePath();
+
+    pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if (0 == pid) {
+        SQLiteDatabase db(dbFilePath, LONG_COMMIT_DELAY);
+        if (!db.initialize() || !createRowsTable(&db)) {
+            _exit(CHILD_FAILURE);
+        }
+        for (int id = 0; id < COMMITTED_ROWS; ++id) {
+            if (!insertRow(&db, id)) {
+                _exit(CHILD_FAILURE);
+            }
+        }
+        if (!db.commit()) {
+            _exit(CHILD_FAILURE);
+        }
+        for (int id = COMMITTED_ROWS; id < COMMITTED_ROWS + PENDING_ROWS; ++id) {
+            if (!insertRow(&db, id)) {
+                _exit(CHILD_FAILURE);
+            }
+        }
+        raise(SIGKILL);
+        _exit(CHILD_FAILURE);
+    }
+    ASSERT_TRUE(waitForKilledChild(pid));
+
+    SQLiteDatabase db(dbFilePath);
+    ASSERT_TRUE(db.open());
+    ASSERT_TRUE(isIntact(&db));
+    int maxId = 0;
+    ASSERT_EQ(countRows(&db, &maxId), COMMITTED_ROWS);
+    ASSERT_EQ(maxId, COMMITTED_ROWS - 1);
+    db.close();
+}
+
+/**
+ * Test that when the writer is killed at an arbitrary point of a burst of writes, while the committer thread is
+ * committing every few milliseconds, the database is intact and holds exactly the writes made before some point.
+ */
+TEST(SQLiteDatabaseTest, GroupCommitKillDuringBurstKeepsAPrefix) {
+    const std::chrono::milliseconds BURST_DURATION(300);
+    auto dbFilePath = generateDbFilePath();
+
+    pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if (0 == pid) {
+        SQLiteDatabase db(dbFilePath, SHORT_COMMIT_DELAY);
+        if (!db.initialize() || !createRowsTable(&db)) {
+            _exit(CHILD_FAILURE);
+        }
+        for (int id = 0;; ++id) {
+            if (!insertRow(&db, id)) {
+                _exit(CHILD_FAILURE);
+            }
+        }
+    }
+    std::this_thread::sleep_for(BURST_DURATION);
+    ASSERT_EQ(kill(pid, SIGKILL), 0);
+    ASSERT_TRUE(waitForKilledChild(pid));
+
+    SQLiteDatabase db(dbFilePath);
+    ASSERT_TRUE(db.open());
+    ASSERT_TRUE(isIntact(&db));
+    int maxId = 0;
+    int rows = countRows(&db, &maxId);
+    ASSERT_GT(rows, 0);
+    ASSERT_EQ(maxId, rows - 1);
+    db.close();
+}
+
 }  // namespace test
 }  // namespace sqliteStorage
 }  // namespace storage
@@ -0,0 +1,297 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file SQLiteMiscStorageBenchmarkTest.cpp
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/AVS/Initialization/AlexaClientSDKInit.h>
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Timing/LatencyHistogram.h>
+#include <SQLiteStorage/SQLiteDatabase.h>
+#include <SQLiteStorage/SQLiteMiscStorage.h>
+
+namespace alexaClientSDK {
+namespace storage {
+namespace sqliteStorage {
+namespace test {
+
+using namespace avsCommon::avs::initialization;
+using namespace avsCommon::utils::configuration;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("SQLiteMiscStorageBenchmarkTest");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The database file used by @c SQLiteMiscStorage.
+static const std::string DB_FILE_PATH = "SQLiteMiscStorageBenchmarkTest.db";
+
+/// The database file used to replay the queries which @c SQLiteMiscStorage used to make.
+static const std::string UNCACHED_DB_FILE_PATH = "SQLiteMiscStorageBenchmarkTestUncached.db";
+
+/// JSON text for miscDB config.
+// clang-format off
+static const std::string MISC_DB_CONFIG_JSON =
+    "{"
+      "\"miscDatabase\":{"
+        "\"databaseFilePath\":\"" + DB_FILE_PATH + "\""
+        "}"
+    "}";
+// clang-format on
+
+/// Component name for the misc DB tables.
+static const std::string COMPONENT_NAME = "Benchmark";
+
+/// Table name for the misc DB tables.
+static const std::string TABLE_NAME = "settings";
+
+/// The table name as it is in the DB.
+static const std::string DB_TABLE_NAME = COMPONENT_NAME + "_" + TABLE_NAME;
+
+/// The number of distinct keys written and read, like the settings of a device.
+static const int KEY_COUNT = 20;
+
+/// The number of writes measured.
+static const int PUT_COUNT = 200;
+
+/// The number of reads measured.
+static const int GET_COUNT = 2000;
+
+/**
+ * Times each call to an operation.
+ *
+ * @param count The number of calls.
+ * @param operation The operation, which is passed the number of the call and returns whether it succeeded.
+ * @param[out] latencies The latencies of the calls.
+ */
+static void measure(
+    int count,
+    std::function<bool(int)> operation,
+    avsCommon::utils::timing::LatencyHistogram* latencies) {
+    for (int i = 0; i < count; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(operation(i));
+        latencies->record(std::chrono::steady_clock::now() - start);
+    }
+}
+
+/**
+ * Replays the queries which @c SQLiteMiscStorage made for each call before it cached the schema and its statements:
+ * a table-exists query for every check, a @c PRAGMA @c table_info for every type check, and a freshly prepared
+ * statement for the operation itself.
+ */
+class UncachedMiscStorage {
+public:
+    /**
+     * Constructor.
+     *
+     * @param db The database, which holds the table.
+     */
+    UncachedMiscStorage(SQLiteDatabase* db) : m_db{db} {
+    }
+
+    /**
+     * Replays @c get().
+     *
+     * @param key The key.
+     * @param[out] value The value.
+     * @return Whether the queries succeeded.
+     */
+    bool get(const std::string& key, std::string* value) {
+        // basicDBChecks(), then checkKeyType(), which runs basicDBChecks() and getKeyValueTypes().
+        if (!checkTable() || !checkTable() || !checkTypes()) {
+            return false;
+        }
+        auto statement = m_db->createStatement("SELECT value FROM " + DB_TABLE_NAME + " WHERE key='" + key + "';");
+        if (!statement || !statement->step()) {
+            return false;
+        }
+        if (SQLITE_ROW == statement->getStepResult()) {
+            *value = statement->getColumnText(0);
+        }
+        return true;
+    }
+
+    /**
+     * Replays @c put().
+     *
+     * @param key The key.
+     * @param value The value.
+     * @return Whether the queries succeeded.
+     */
+    bool put(const std::string& key, const std::string& value) {
+        // basicDBChecks(), then checkKeyValueType(), then the checks of tableEntryExists() before it calls get().
+        if (!checkTable() || !checkTable() || !checkTypes() || !checkTable() || !checkTypes()) {
+            return false;
+        }
+        std::string existing;
+        if (!get(key, &existing)) {
+            return false;
+        }
+        if (existing.empty()) {
+            return m_db->performQuery(
+                "INSERT INTO " + DB_TABLE_NAME + " (key, value) VALUES ('" + key + "', '" + value + "');");
+        }
+        return m_db->performQuery("UPDATE " + DB_TABLE_NAME + " SET value='" + value + "' WHERE key='" + key + "';");
+    }
+
+private:
+    /**
+     * Replays the table-exists query of @c basicDBChecks().
+     *
+     * @return Whether the table exists.
+     */
+    bool checkTable() {
+        return m_db->tableExists(DB_TABLE_NAME);
+    }
+
+    /**
+     * Replays @c getKeyValueTypes(), which checks the table exists and reads its schema.
+     *
+     * @return Whether the schema was read.
+     */
+    bool checkTypes() {
+        if (!checkTable()) {
+            return false;
+        }
+        auto statement = m_db->createStatement("PRAGMA table_info(" + DB_TABLE_NAME + ");");
+        if (!statement || !statement->step()) {
+            return false;
+        }
+        while (SQLITE_ROW == statement->getStepResult()) {
+            for (int i = 0; i < statement->getColumnCount(); ++i) {
+                auto columnName = statement->getColumnName(i);
+                if ("name" == columnName || "type" == columnName) {
+                    statement->getColumnText(i);
+                }
+            }
+            statement->step();
+        }
+        return true;
+    }
+
+    /// The database.
+    SQLiteDatabase* m_db;
+};
+
+/**
+ * Test harness which creates the same table with @c SQLiteMiscStorage and in a second database for the replayed
+ * queries.
+ */
+class SQLiteMiscStorageBenchmarkTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::remove(DB_FILE_PATH.c_str());
+        std::remove(UNCACHED_DB_FILE_PATH.c_str());
+
+        auto inString = std::shared_ptr<std::istringstream>(new std::istringstream(MISC_DB_CONFIG_JSON));
+        ASSERT_TRUE(AlexaClientSDKInit::initialize({inString}));
+        m_miscStorage = SQLiteMiscStorage::create(ConfigurationNode::getRoot());
+        ASSERT_TRUE(m_miscStorage);
+        ASSERT_TRUE(m_miscStorage->createDatabase());
+        ASSERT_TRUE(m_miscStorage->createTable(
+            COMPONENT_NAME,
+            TABLE_NAME,
+            SQLiteMiscStorage::KeyType::STRING_KEY,
+            SQLiteMiscStorage::ValueType::STRING_VALUE));
+
+        m_uncachedDb.reset(new SQLiteDatabase(UNCACHED_DB_FILE_PATH));
+        ASSERT_TRUE(m_uncachedDb->initialize());
+        ASSERT_TRUE(m_uncachedDb->performQuery(
+            "CREATE TABLE " + DB_TABLE_NAME + " (key TEXT PRIMARY KEY NOT NULL,value TEXT NOT NULL);"));
+    }
+
+    void TearDown() override {
+        if (m_miscStorage) {
+            m_miscStorage->close();
+        }
+        if (m_uncachedDb) {
+            m_uncachedDb->close();
+        }
+        AlexaClientSDKInit::uninitialize();
+        std::remove(DB_FILE_PATH.c_str());
+        std::remove(UNCACHED_DB_FILE_PATH.c_str());
+    }
+
+    /// The storage under test.
+    std::unique_ptr<SQLiteMiscStorage> m_miscStorage;
+
+    /// The database for the replayed queries.
+    std::unique_ptr<SQLiteDatabase> m_uncachedDb;
+};
+
+/**
+ * Measure the latency of @c put() and @c get() on a table of @c KEY_COUNT settings, and the latency of the queries
+ * which they used to make.
+ */
+TEST_F(SQLiteMiscStorageBenchmarkTest, putAndGetLatency) {
+    UncachedMiscStorage uncached(m_uncachedDb.get());
+    auto key = [](int i) { return "key" + std::to_string(i % KEY_COUNT); };
+    auto value = [](int i) { return "value" + std::to_string(i); };
+    std::string result;
+
+    avsCommon::utils::timing::LatencyHistogram uncachedPutLatencies;
+    measure(
+        PUT_COUNT,
+        [&](int i) { return uncached.put(key(i), value(i)); },
+        &uncachedPutLatencies);
+
+    avsCommon::utils::timing::LatencyHistogram putLatencies;
+    measure(
+        PUT_COUNT,
+        [&](int i) { return m_miscStorage->put(COMPONENT_NAME, TABLE_NAME, key(i), value(i)); },
+        &putLatencies);
+
+    avsCommon::utils::timing::LatencyHistogram uncachedGetLatencies;
+    measure(
+        GET_COUNT,
+        [&](int i) { return uncached.get(key(i), &result) && !result.empty(); },
+        &uncachedGetLatencies);
+
+    avsCommon::utils::timing::LatencyHistogram getLatencies;
+    measure(
+        GET_COUNT,
+        [&](int i) { return m_miscStorage->get(COMPONENT_NAME, TABLE_NAME, key(i), &result) && !result.empty(); },
+        &getLatencies);
+
+    ACSDK_INFO(LX("miscStorageLatency")
+                   .d("uncachedPutLatencies", uncachedPutLatencies.toString())
+                   .d("putLatencies", putLatencies.toString())
+                   .d("uncachedGetLatencies", uncachedGetLatencies.toString())
+                   .d("getLatencies", getLatencies.toString()));
+
+    // The last value written for each key must be the one read back.
+    ASSERT_TRUE(m_miscStorage->get(COMPONENT_NAME, TABLE_NAME, key(PUT_COUNT - 1), &result));
+    ASSERT_EQ(result, value(PUT_COUNT - 1));
+}
+
+}  // namespace test
+}  // namespace sqliteStorage
+}  // namespace storage
+}  // namespace alexaClientSDK
@@ -15,6 +15,8 @@
 
 #include <SQLiteStorage/SQLiteMiscStorage.h>
 
+#include <cstdio>
+
 #include <gtest/gtest.h>
 
 #include <AVSCommon/AVS/Initialization/AlexaClientSDKInit.h>
@@ -43,6 +45,9 @@ static const std::string MISC_DB_CONFIG_JSON =
     "}";
 // clang-format on
 
+/// The database file used to test @c SQLiteStatement directly.
+static const std::string STATEMENT_DB_FILE_PATH = "SQLiteMiscStorageTestStatement.db";
+
 /**
  * Test harness for @c SQLiteMiscStorage class.
  */
@@ -276,6 +281,176 @@ TEST_F(SQLiteMiscStorageTest, createDeleteTable) {
     ASSERT_FALSE(tableExists);
 }
 
+/// Tests that put() inserts a new entry and replaces an existing one, leaving other entries alone
+TEST_F(SQLiteMiscStorageTest, putNewAndExistingKeys) {
+    const std::string tableName = "SQLiteMiscStoragePutTest";
+    std::string tableEntryValue;
+    std::unordered_map<std::string, std::string> valuesContainer;
+    deleteTestTable(tableName);
+
+    createTestTable(tableName, SQLiteMiscStorage::KeyType::STRING_KEY, SQLiteMiscStorage::ValueType::STRING_VALUE);
+
+    /// A new key is inserted
+    ASSERT_TRUE(m_miscStorage->put(COMPONENT_NAME, tableName, "key1", "value1"));
+    ASSERT_TRUE(m_miscStorage->put(COMPONENT_NAME, tableName, "key2", "value2"));
+    ASSERT_TRUE(m_miscStorage->get(COMPONENT_NAME, tableName, "key1", &tableEntryValue));
+    ASSERT_EQ(tableEntryValue, "value1");
+
+    /// An existing key is replaced, rather than duplicated
+    ASSERT_TRUE(m_miscStorage->put(COMPONENT_NAME, tableName, "key1", "newValue1"));
+    ASSERT_TRUE(m_miscStorage->load(COMPONENT_NAME, tableName, &valuesContainer));
+    ASSERT_EQ(valuesContainer.size(), 2u);
+    ASSERT_EQ(valuesContainer["key1"], "newValue1");
+    ASSERT_EQ(valuesContainer["key2"], "value2");
+
+    /// add() still refuses a key which put() created, and update() changes it
+    ASSERT_FALSE(m_miscStorage->add(COMPONENT_NAME, tableName, "key2", "addedValue2"));
+    ASSERT_TRUE(m_miscStorage->update(COMPONENT_NAME, tableName, "key2", "updatedValue2"));
+    ASSERT_TRUE(m_miscStorage->get(COMPONENT_NAME, tableName, "key2", &tableEntryValue));
+    ASSERT_EQ(tableEntryValue, "updatedValue2");
+
+    ASSERT_TRUE(m_miscStorage->clearTable(COMPONENT_NAME, tableName));
+    deleteTestTable(tableName);
+}
+
+/// Tests that keys and values containing quotes and other SQL syntax are stored verbatim
+TEST_F(SQLiteMiscStorageTest, keysAndValuesWithQuotes) {
+    const std::string tableName = "SQLiteMiscStorageQuotesTest";
+    const std::string quotedKey = "it's a \"key\"";
+    const std::string quotedValue = "'); DROP TABLE SQLiteMiscStorageTest_SQLiteMiscStorageQuotesTest; --";
+    const std::string updatedValue = "value with '' doubled ' quotes";
+    std::string tableEntryValue;
+    bool tableEntryExists;
+    deleteTestTable(tableName);
+
+    createTestTable(tableName, SQLiteMiscStorage::KeyType::STRING_KEY, SQLiteMiscStorage::ValueType::STRING_VALUE);
+
+    ASSERT_TRUE(m_miscStorage->add(COMPONENT_NAME, tableName, quotedKey, quotedValue));
+    ASSERT_TRUE(m_miscStorage->tableEntryExists(COMPONENT_NAME, tableName, quotedKey, &tableEntryExists));
+    ASSERT_TRUE(tableEntryExists);
+    ASSERT_TRUE(m_miscStorage->get(COMPONENT_NAME, tableName, quotedKey, &tableEntryValue));
+    ASSERT_EQ(tableEntryValue, quotedValue);
+
+    ASSERT_TRUE(m_miscStorage->update(COMPONENT_NAME, tableName, quotedKey, updatedValue));
+    ASSERT_TRUE(m_miscStorage->get(COMPONENT_NAME, tableName, quotedKey, &tableEntryValue));
+    ASSERT_EQ(tableEntryValue, updatedValue);
+
+    ASSERT_TRUE(m_miscStorage->put(COMPONENT_NAME, tableName, quotedValue, quotedKey));
+    ASSERT_TRUE(m_miscStorage->get(COMPONENT_NAME, tableName, quotedValue, &tableEntryValue));
+    ASSERT_EQ(tableEntryValue, quotedKey);
+
+    ASSERT_TRUE(m_miscStorage->remove(COMPONENT_NAME, tableName, quotedKey));
+    ASSERT_TRUE(m_miscStorage->tableEntryExists(COMPONENT_NAME, tableName, quotedKey, &tableEntryExists));
+    ASSERT_FALSE(tableEntryExists);
+
+    /// A key which only matches because of SQL syntax is not found
+    ASSERT_TRUE(m_miscStorage->tableEntryExists(COMPONENT_NAME, tableName, "' OR '1'='1", &tableEntryExists));
+    ASSERT_FALSE(tableEntryExists);
+
+    ASSERT_TRUE(m_miscStorage->clearTable(COMPONENT_NAME, tableName));
+    deleteTestTable(tableName);
+}
+
+/**
+ * Tests that the cached schema and statements of a table are not used once it is cleared or deleted, so that a
+ * re-created table starts empty and can be written again.
+ */
+TEST_F(SQLiteMiscStorageTest, cacheInvalidatedByClearAndDelete) {
+    const std::string tableName = "SQLiteMiscStorageCacheTest";
+    std::string tableEntryValue;
+    bool tableExists;
+    bool tableEntryExists;
+    deleteTestTable(tableName);
+
+    createTestTable(tableName, SQLiteMiscStorage::KeyType::STRING_KEY, SQLiteMiscStorage::ValueType::STRING_VALUE);
+
+    /// Use every statement, so that all of them are cached
+    ASSERT_TRUE(m_miscStorage->add(COMPONENT_NAME, tableName, "key", "value"));
+    ASSERT_TRUE(m_miscStorage->update(COMPONENT_NAME, tableName, "key", "updatedValue"));
+    ASSERT_TRUE(m_miscStorage->put(COMPONENT_NAME, tableName, "otherKey", "otherValue"));
+    ASSERT_TRUE(m_miscStorage->get(COMPONENT_NAME, tableName, "key", &tableEntryValue));
+    ASSERT_TRUE(m_miscStorage->remove(COMPONENT_NAME, tableName, "otherKey"));
+
+    /// Cleared entries are not found, and the cached statements still work on the cleared table
+    ASSERT_TRUE(m_miscStorage->clearTable(COMPONENT_NAME, tableName));
+    ASSERT_TRUE(m_miscStorage->tableEntryExists(COMPONENT_NAME, tableName, "key", &tableEntryExists));
+    ASSERT_FALSE(tableEntryExists);
+    ASSERT_TRUE(m_miscStorage->add(COMPONENT_NAME, tableName, "key", "valueAfterClear"));
+    ASSERT_TRUE(m_miscStorage->get(COMPONENT_NAME, tableName, "key", &tableEntryValue));
+    ASSERT_EQ(tableEntryValue, "valueAfterClear");
+
+    /// A deleted table is gone, even though it was cached
+    ASSERT_TRUE(m_miscStorage->clearTable(COMPONENT_NAME, tableName));
+    ASSERT_TRUE(m_miscStorage->deleteTable(COMPONENT_NAME, tableName));
+    ASSERT_TRUE(m_miscStorage->tableExists(COMPONENT_NAME, tableName, &tableExists));
+    ASSERT_FALSE(tableExists);
+    ASSERT_FALSE(m_miscStorage->get(COMPONENT_NAME, tableName, "key", &tableEntryValue));
+    ASSERT_FALSE(m_miscStorage->put(COMPONENT_NAME, tableName, "key", "value"));
+
+    /// A re-created table starts empty and every operation works on it
+    ASSERT_TRUE(m_miscStorage->createTable(
+        COMPONENT_NAME, tableName, SQLiteMiscStorage::KeyType::STRING_KEY, SQLiteMiscStorage::ValueType::STRING_VALUE));
+    ASSERT_TRUE(m_miscStorage->tableEntryExists(COMPONENT_NAME, tableName, "key", &tableEntryExists));
+    ASSERT_FALSE(tableEntryExists);
+    ASSERT_TRUE(m_miscStorage->add(COMPONENT_NAME, tableName, "key", "valueAfterDelete"));
+    ASSERT_TRUE(m_miscStorage->update(COMPONENT_NAME, tableName, "key", "updatedValueAfterDelete"));
+    ASSERT_TRUE(m_miscStorage->put(COMPONENT_NAME, tableName, "otherKey", "otherValueAfterDelete"));
+    ASSERT_TRUE(m_miscStorage->get(COMPONENT_NAME, tableName, "key", &tableEntryValue));
+    ASSERT_EQ(tableEntryValue, "updatedValueAfterDelete");
+    ASSERT_TRUE(m_miscStorage->remove(COMPONENT_NAME, tableName, "otherKey"));
+
+    /// The table is read back from the database once the cache is dropped by closing and re-opening it
+    m_miscStorage->close();
+    ASSERT_TRUE(m_miscStorage->open());
+    ASSERT_TRUE(m_miscStorage->get(COMPONENT_NAME, tableName, "key", &tableEntryValue));
+    ASSERT_EQ(tableEntryValue, "updatedValueAfterDelete");
+
+    ASSERT_TRUE(m_miscStorage->clearTable(COMPONENT_NAME, tableName));
+    deleteTestTable(tableName);
+}
+
+/// Tests that @c SQLiteStatement::clearBindings() sets every bound parameter back to NULL
+TEST_F(SQLiteMiscStorageTest, statementClearBindings) {
+    std::remove(STATEMENT_DB_FILE_PATH.c_str());
+    SQLiteDatabase db(STATEMENT_DB_FILE_PATH);
+    ASSERT_TRUE(db.initialize());
+
+    auto statement = db.createStatement("SELECT ?1 IS NULL, ?2 IS NULL;");
+    ASSERT_NE(statement, nullptr);
+    const int RESULT_COLUMN_FIRST = 0;
+    const int RESULT_COLUMN_SECOND = 1;
+
+    ASSERT_TRUE(statement->bindStringParameter(1, "first"));
+    ASSERT_TRUE(statement->bindIntParameter(2, 2));
+    ASSERT_TRUE(statement->step());
+    ASSERT_EQ(statement->getStepResult(), SQLITE_ROW);
+    ASSERT_EQ(statement->getColumnInt(RESULT_COLUMN_FIRST), 0);
+    ASSERT_EQ(statement->getColumnInt(RESULT_COLUMN_SECOND), 0);
+
+    /// reset() alone keeps the bindings
+    ASSERT_TRUE(statement->reset());
+    ASSERT_TRUE(statement->step());
+    ASSERT_EQ(statement->getColumnInt(RESULT_COLUMN_FIRST), 0);
+    ASSERT_EQ(statement->getColumnInt(RESULT_COLUMN_SECOND), 0);
+
+    /// clearBindings() drops all of them, and the statement can be bound again
+    ASSERT_TRUE(statement->reset());
+    ASSERT_TRUE(statement->clearBindings());
+    ASSERT_TRUE(statement->step());
+    ASSERT_EQ(statement->getColumnInt(RESULT_COLUMN_FIRST), 1);
+    ASSERT_EQ(statement->getColumnInt(RESULT_COLUMN_SECOND), 1);
+
+    ASSERT_TRUE(statement->reset());
+    ASSERT_TRUE(statement->bindStringParameter(1, "again"));
+    ASSERT_TRUE(statement->step());
+    ASSERT_EQ(statement->getColumnInt(RESULT_COLUMN_FIRST), 0);
+    ASSERT_EQ(statement->getColumnInt(RESULT_COLUMN_SECOND), 1);
+
+    statement.reset();
+    db.close();
+    std::remove(STATEMENT_DB_FILE_PATH.c_str());
+}
+
 }  // namespace test
 }  // namespace sqliteStorage
 }  // namespace storage
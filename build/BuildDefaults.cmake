@@ -27,6 +27,12 @@ include(MediaPlayer)
 # Setup PortAudio variables.
 include(PortAudio)
 
+# Setup Opus variables.
+include(Opus)
+
+# Setup AudioInputStream variables.
+include(AudioInputStream)
+
 # Setup Test Options variables.
 include(TestOptions)
 
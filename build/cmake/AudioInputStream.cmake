@@ -0,0 +1,16 @@
+#
+# Setup the type of the AudioInputStream.
+#
+# To make AudioInputStream a SharedMemorySDS, so that the SDK can attach to an audio stream which another process
+# (such as an audio front-end) writes to shared memory, run the following command,
+#     cmake <path-to-source> -DSHARED_MEMORY_AUDIO_INPUT_STREAM=ON.
+#
+
+option(SHARED_MEMORY_AUDIO_INPUT_STREAM "Make AudioInputStream a SharedMemorySDS, shared between processes." OFF)
+
+if(SHARED_MEMORY_AUDIO_INPUT_STREAM)
+    if(NOT UNIX OR APPLE)
+        message(FATAL_ERROR "SHARED_MEMORY_AUDIO_INPUT_STREAM needs POSIX shared memory and robust mutexes.")
+    endif()
+    add_definitions(-DSHARED_MEMORY_AUDIO_INPUT_STREAM)
+endif()
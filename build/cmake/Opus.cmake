@@ -0,0 +1,14 @@
+#
+# Setup the Opus encoder for Recognize audio.
+#
+# To build the libopus based encoder, run the following command,
+#     cmake <path-to-source> -DOPUS_ENCODER=ON.
+#
+
+option(OPUS_ENCODER "Enable libopus based encoding of Recognize audio." OFF)
+
+if(OPUS_ENCODER)
+    find_package(PkgConfig)
+    pkg_check_modules(OPUS REQUIRED opus>=1.1)
+    add_definitions(-DOPUS_ENCODER)
+endif()